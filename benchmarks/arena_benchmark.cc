@@ -0,0 +1,159 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// https://developers.google.com/protocol-buffers/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Microbenchmarks for google::protobuf::Arena.
+//
+// Run with e.g. --benchmark_filter=Shared to see how allocation from a single
+// arena shared by many threads scales with the number of threads.
+
+#include <string>
+#include "benchmark/benchmark_api.h"
+#include <google/protobuf/arena.h>
+#include <google/protobuf/stubs/common.h>
+
+using google::protobuf::Arena;
+using google::protobuf::int64;
+
+namespace {
+
+// Number of allocations done between two resets of an arena; roughly the
+// shape of a request handler building a response.
+const int kAllocationsPerRequest = 64;
+
+// A single arena allocated from by every benchmark thread. Created and
+// destroyed by thread 0; the framework synchronizes all threads at the start
+// and end of the KeepRunning() loop. A shared arena cannot be reset while in
+// use, so the shared benchmarks run a fixed number of iterations to bound
+// memory use.
+Arena* shared_arena = NULL;
+const int kSharedIterations = 4096;
+
+void BM_ArenaAllocateSingleThread(benchmark::State& state) {
+  Arena arena;
+  while (state.KeepRunning()) {
+    for (int i = 0; i < kAllocationsPerRequest; i++) {
+      benchmark::DoNotOptimize(Arena::Create<int64>(&arena));
+    }
+    arena.Reset();
+  }
+  state.SetItemsProcessed(state.iterations() * kAllocationsPerRequest);
+}
+BENCHMARK(BM_ArenaAllocateSingleThread);
+
+// Creates an arena per iteration, like a server using one arena per request,
+// and allocates enough from it to need a few blocks.
+void AllocateRequest(const google::protobuf::ArenaOptions& options) {
+  Arena arena(options);
+  for (int i = 0; i < kAllocationsPerRequest; i++) {
+    benchmark::DoNotOptimize(Arena::CreateArray<char>(&arena, 128));
+  }
+}
+
+void BM_ArenaPerRequest(benchmark::State& state) {
+  google::protobuf::ArenaOptions options;
+  while (state.KeepRunning()) {
+    AllocateRequest(options);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ArenaPerRequest);
+
+void BM_ArenaPerRequestPooled(benchmark::State& state) {
+  google::protobuf::ArenaBlockPool pool;
+  google::protobuf::ArenaOptions options;
+  options.block_allocator = &pool;
+  while (state.KeepRunning()) {
+    AllocateRequest(options);
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_ArenaPerRequestPooled);
+
+// Measures arena teardown with many registered destructors, as for a message
+// with thousands of std::string fields. Only the destruction is timed.
+void BM_ArenaDestroyStrings(benchmark::State& state) {
+  const int strings = state.range_x();
+  while (state.KeepRunning()) {
+    state.PauseTiming();
+    Arena* arena = new Arena;
+    for (int i = 0; i < strings; i++) {
+      benchmark::DoNotOptimize(Arena::Create<std::string>(arena));
+      benchmark::DoNotOptimize(Arena::CreateArray<char>(arena, 32));
+    }
+    state.ResumeTiming();
+    delete arena;
+  }
+  state.SetItemsProcessed(state.iterations() * strings);
+}
+BENCHMARK(BM_ArenaDestroyStrings)->Range(64, 64 << 10);
+
+void BM_ArenaAllocateShared(benchmark::State& state) {
+  if (state.thread_index == 0) {
+    // Generous block sizes keep this benchmark about the allocation path
+    // rather than about block growth.
+    google::protobuf::ArenaOptions options;
+    options.max_block_size = 64 << 10;
+    shared_arena = new Arena(options);
+  }
+  while (state.KeepRunning()) {
+    for (int i = 0; i < kAllocationsPerRequest; i++) {
+      benchmark::DoNotOptimize(Arena::CreateArray<char>(shared_arena, 16));
+    }
+  }
+  if (state.thread_index == 0) {
+    delete shared_arena;
+    shared_arena = NULL;
+  }
+  state.SetItemsProcessed(state.iterations() * kAllocationsPerRequest);
+}
+BENCHMARK(BM_ArenaAllocateShared)
+    ->Iterations(kSharedIterations)->ThreadRange(1, 32)->UseRealTime();
+
+void BM_ArenaOwnDestructorShared(benchmark::State& state) {
+  if (state.thread_index == 0) {
+    shared_arena = new Arena;
+  }
+  while (state.KeepRunning()) {
+    for (int i = 0; i < kAllocationsPerRequest; i++) {
+      benchmark::DoNotOptimize(Arena::Create<std::string>(shared_arena));
+    }
+  }
+  if (state.thread_index == 0) {
+    delete shared_arena;
+    shared_arena = NULL;
+  }
+  state.SetItemsProcessed(state.iterations() * kAllocationsPerRequest);
+}
+BENCHMARK(BM_ArenaOwnDestructorShared)
+    ->Iterations(kSharedIterations)->ThreadRange(1, 32)->UseRealTime();
+
+}  // namespace
+
+BENCHMARK_MAIN();
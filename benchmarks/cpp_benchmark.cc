@@ -35,6 +35,10 @@
 #include "benchmarks.pb.h"
 #include "benchmark_messages_proto2.pb.h"
 #include "benchmark_messages_proto3.pb.h"
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
+#include <google/protobuf/util/json_util.h>
+#include <google/protobuf/util/type_resolver.h>
+#include <google/protobuf/util/type_resolver_util.h>
 
 #define PREFIX "dataset."
 #define SUFFIX ".pb"
@@ -152,6 +156,31 @@ class ParseReuseFixture : public Fixture {
   }
 };
 
+// Parses from a ZeroCopyInputStream handing out small chunks, like a network
+// stream, so that many fields straddle two chunks.
+template <class T>
+class ParseStreamFixture : public Fixture {
+ public:
+  ParseStreamFixture(const BenchmarkDataset& dataset)
+      : Fixture(dataset, "_parse_stream") {}
+
+  virtual void BenchmarkCase(benchmark::State& state) {
+    T m;
+    WrappingCounter i(payloads_.size());
+    size_t total = 0;
+
+    while (state.KeepRunning()) {
+      const std::string& payload = payloads_[i.Next()];
+      total += payload.size();
+      google::protobuf::io::ArrayInputStream input(payload.data(),
+                                                   payload.size(), 64);
+      m.ParseFromZeroCopyStream(&input);
+    }
+
+    state.SetBytesProcessed(total);
+  }
+};
+
 template <class T>
 class SerializeFixture : public Fixture {
  public:
@@ -187,6 +216,167 @@ class SerializeFixture : public Fixture {
   std::vector<T*> message_;
 };
 
+// Prints messages as JSON with MessageToJsonString(), which walks the message
+// through reflection.
+template <class T>
+class JsonPrintFixture : public Fixture {
+ public:
+  JsonPrintFixture(const BenchmarkDataset& dataset)
+      : Fixture(dataset, "_json_print") {
+    for (size_t i = 0; i < payloads_.size(); i++) {
+      message_.push_back(new T);
+      message_.back()->ParseFromString(payloads_[i]);
+    }
+  }
+
+  ~JsonPrintFixture() {
+    for (size_t i = 0; i < message_.size(); i++) {
+      delete message_[i];
+    }
+  }
+
+  virtual void BenchmarkCase(benchmark::State& state) {
+    size_t total = 0;
+    std::string str;
+    WrappingCounter i(payloads_.size());
+
+    while (state.KeepRunning()) {
+      str.clear();
+      google::protobuf::util::MessageToJsonString(*message_[i.Next()], &str);
+      total += str.size();
+    }
+
+    state.SetBytesProcessed(total);
+  }
+
+ private:
+  std::vector<T*> message_;
+};
+
+// Prints messages as JSON by serializing them and transcoding the binary
+// form with BinaryToJsonString(), for comparison with JsonPrintFixture.
+template <class T>
+class JsonPrintBinaryFixture : public Fixture {
+ public:
+  JsonPrintBinaryFixture(const BenchmarkDataset& dataset)
+      : Fixture(dataset, "_json_print_binary"),
+        resolver_(google::protobuf::util::NewTypeResolverForDescriptorPool(
+            "type.googleapis.com", DescriptorPool::generated_pool())),
+        type_url_("type.googleapis.com/" + dataset.message_name()) {
+    for (size_t i = 0; i < payloads_.size(); i++) {
+      message_.push_back(new T);
+      message_.back()->ParseFromString(payloads_[i]);
+    }
+  }
+
+  ~JsonPrintBinaryFixture() {
+    for (size_t i = 0; i < message_.size(); i++) {
+      delete message_[i];
+    }
+    delete resolver_;
+  }
+
+  virtual void BenchmarkCase(benchmark::State& state) {
+    size_t total = 0;
+    std::string str;
+    WrappingCounter i(payloads_.size());
+
+    while (state.KeepRunning()) {
+      str.clear();
+      google::protobuf::util::BinaryToJsonString(
+          resolver_, type_url_, message_[i.Next()]->SerializeAsString(), &str);
+      total += str.size();
+    }
+
+    state.SetBytesProcessed(total);
+  }
+
+ private:
+  std::vector<T*> message_;
+  google::protobuf::util::TypeResolver* resolver_;
+  std::string type_url_;
+};
+
+// Parses JSON into a reused message with JsonStringToMessage(), which fills
+// the message through reflection.
+template <class T>
+class JsonParseFixture : public Fixture {
+ public:
+  JsonParseFixture(const BenchmarkDataset& dataset)
+      : Fixture(dataset, "_json_parse") {
+    T message;
+    for (size_t i = 0; i < payloads_.size(); i++) {
+      message.ParseFromString(payloads_[i]);
+      json_.push_back(std::string());
+      google::protobuf::util::MessageToJsonString(message, &json_.back());
+    }
+  }
+
+  virtual void BenchmarkCase(benchmark::State& state) {
+    size_t total = 0;
+    T m;
+    WrappingCounter i(json_.size());
+
+    while (state.KeepRunning()) {
+      const std::string& json = json_[i.Next()];
+      total += json.size();
+      m.Clear();
+      google::protobuf::util::JsonStringToMessage(json, &m);
+    }
+
+    state.SetBytesProcessed(total);
+  }
+
+ private:
+  std::vector<std::string> json_;
+};
+
+// Parses JSON by transcoding it to the binary form with JsonToBinaryString()
+// and parsing that, for comparison with JsonParseFixture.
+template <class T>
+class JsonParseBinaryFixture : public Fixture {
+ public:
+  JsonParseBinaryFixture(const BenchmarkDataset& dataset)
+      : Fixture(dataset, "_json_parse_binary"),
+        resolver_(google::protobuf::util::NewTypeResolverForDescriptorPool(
+            "type.googleapis.com", DescriptorPool::generated_pool())),
+        type_url_("type.googleapis.com/" + dataset.message_name()) {
+    T message;
+    for (size_t i = 0; i < payloads_.size(); i++) {
+      message.ParseFromString(payloads_[i]);
+      json_.push_back(std::string());
+      google::protobuf::util::MessageToJsonString(message, &json_.back());
+    }
+  }
+
+  ~JsonParseBinaryFixture() {
+    delete resolver_;
+  }
+
+  virtual void BenchmarkCase(benchmark::State& state) {
+    size_t total = 0;
+    std::string binary;
+    T m;
+    WrappingCounter i(json_.size());
+
+    while (state.KeepRunning()) {
+      const std::string& json = json_[i.Next()];
+      total += json.size();
+      binary.clear();
+      google::protobuf::util::JsonToBinaryString(resolver_, type_url_, json,
+                                                 &binary);
+      m.ParseFromString(binary);
+    }
+
+    state.SetBytesProcessed(total);
+  }
+
+ private:
+  std::vector<std::string> json_;
+  google::protobuf::util::TypeResolver* resolver_;
+  std::string type_url_;
+};
+
 std::string ReadFile(const std::string& name) {
   std::ifstream file(name.c_str());
   GOOGLE_CHECK(file.is_open()) << "Couldn't find file '" << name <<
@@ -205,8 +395,18 @@ void RegisterBenchmarksForType(const BenchmarkDataset& dataset) {
       new ParseReuseFixture<T>(dataset));
   ::benchmark::internal::RegisterBenchmarkInternal(
       new ParseNewArenaFixture<T>(dataset));
+  ::benchmark::internal::RegisterBenchmarkInternal(
+      new ParseStreamFixture<T>(dataset));
   ::benchmark::internal::RegisterBenchmarkInternal(
       new SerializeFixture<T>(dataset));
+  ::benchmark::internal::RegisterBenchmarkInternal(
+      new JsonPrintFixture<T>(dataset));
+  ::benchmark::internal::RegisterBenchmarkInternal(
+      new JsonPrintBinaryFixture<T>(dataset));
+  ::benchmark::internal::RegisterBenchmarkInternal(
+      new JsonParseFixture<T>(dataset));
+  ::benchmark::internal::RegisterBenchmarkInternal(
+      new JsonParseBinaryFixture<T>(dataset));
 }
 
 void RegisterBenchmarks(const std::string& dataset_bytes) {
@@ -0,0 +1,336 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// https://developers.google.com/protocol-buffers/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Benchmarks for the start-up cost of the generated descriptor pool.
+//
+// Every generated .pb.cc registers its encoded FileDescriptorProto with the
+// generated pool at start-up, and the first reflection call builds the
+// descriptors it needs.  These benchmarks do the same with a synthetic schema
+// of as many files as the argument, comparing files registered with
+// EncodedDescriptorDatabase::Add(), which indexes each file as it is added,
+// with AddLazily(), which the generated pool uses.
+//
+// BM_LoadDescriptorSet compares how a tool which reads a descriptor set at
+// start-up gets to its first lookup:  by parsing the set and building every
+// file, or by opening a DescriptorPoolImageDatabase image of it.
+//
+// BM_BuildPool builds every file of the schema and reports how much memory
+// the pool holds afterwards.
+//
+// BM_BuildFiles builds a schema of independent import chains in one batch,
+// on as many threads as the argument.
+//
+// BM_FindMessageTypeByName measures lookups of types which have already been
+// built, from as many threads as the argument, as a server resolving type
+// URLs on every request would do.
+
+#include <atomic>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <vector>
+#include "benchmark/benchmark_api.h"
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/descriptor.pb.h>
+#include <google/protobuf/descriptor_database.h>
+#include <google/protobuf/stubs/common.h>
+#include <google/protobuf/stubs/strutil.h>
+
+using google::protobuf::DescriptorPool;
+using google::protobuf::DescriptorPoolImageDatabase;
+using google::protobuf::DescriptorProto;
+using google::protobuf::EncodedDescriptorDatabase;
+using google::protobuf::FieldDescriptorProto;
+using google::protobuf::FileDescriptorProto;
+using google::protobuf::FileDescriptorSet;
+using google::protobuf::SimpleItoa;
+
+// Count the bytes held by live allocations, so that BM_BuildPool can report
+// the memory footprint of a pool.  Each block is prefixed with its size.
+static std::atomic<long long> live_bytes(0);
+static const size_t kHeaderSize = 16;
+
+void* operator new(size_t size) {
+  char* block = static_cast<char*>(malloc(size + kHeaderSize));
+  if (block == NULL) throw std::bad_alloc();
+  *reinterpret_cast<size_t*>(block) = size;
+  live_bytes += size;
+  return block + kHeaderSize;
+}
+
+void operator delete(void* ptr) throw() {
+  if (ptr == NULL) return;
+  char* block = static_cast<char*>(ptr) - kHeaderSize;
+  live_bytes -= *reinterpret_cast<size_t*>(block);
+  free(block);
+}
+
+namespace {
+
+const int kMessagesPerFile = 20;
+const int kFieldsPerMessage = 15;
+
+enum Registration {
+  INDEX_ON_ADD,
+  INDEX_LAZILY,
+};
+
+enum Loading {
+  BUILD_ALL_FILES,
+  OPEN_IMAGE,
+};
+
+std::string FileName(int file) {
+  return "schema/file" + SimpleItoa(file) + ".proto";
+}
+std::string Package(int file) { return "schema.p" + SimpleItoa(file); }
+
+// Each file depends on the one "width" files before it, and every message has
+// a field of a message type from that file, so that building one file has to
+// look at its dependency.  With the default width, the files form a chain;
+// wider schemas are that many independent chains.
+std::vector<std::string> MakeSchema(int num_files, int width = 1) {
+  std::vector<std::string> encoded_files;
+  for (int i = 0; i < num_files; i++) {
+    FileDescriptorProto file;
+    file.set_name(FileName(i));
+    file.set_package(Package(i));
+    if (i >= width) file.add_dependency(FileName(i - width));
+    file.mutable_options()->set_java_package("com.example.schema");
+    for (int j = 0; j < kMessagesPerFile; j++) {
+      DescriptorProto* message = file.add_message_type();
+      message->set_name("Message" + SimpleItoa(j));
+      for (int k = 0; k < kFieldsPerMessage; k++) {
+        FieldDescriptorProto* field = message->add_field();
+        field->set_name("field_" + SimpleItoa(k));
+        field->set_json_name("field" + SimpleItoa(k));
+        field->set_number(k + 1);
+        field->set_label(FieldDescriptorProto::LABEL_OPTIONAL);
+        if (k == 0 && i >= width) {
+          field->set_type(FieldDescriptorProto::TYPE_MESSAGE);
+          field->set_type_name("." + Package(i - width) + ".Message" +
+                               SimpleItoa(j));
+        } else {
+          field->set_type(k % 2 ? FieldDescriptorProto::TYPE_STRING
+                                : FieldDescriptorProto::TYPE_INT64);
+        }
+      }
+    }
+    encoded_files.push_back(file.SerializeAsString());
+  }
+  return encoded_files;
+}
+
+void Register(const std::vector<std::string>& encoded_files,
+              Registration registration, EncodedDescriptorDatabase* database) {
+  for (int i = 0; i < encoded_files.size(); i++) {
+    if (registration == INDEX_LAZILY) {
+      database->AddLazily(encoded_files[i].data(), encoded_files[i].size());
+    } else {
+      database->Add(encoded_files[i].data(), encoded_files[i].size());
+    }
+  }
+}
+
+// What the static initializers of the generated code do.
+void BM_RegisterFiles(benchmark::State& state) {
+  const std::vector<std::string> encoded_files = MakeSchema(state.range_x());
+  const Registration registration =
+      static_cast<Registration>(state.range_y());
+  while (state.KeepRunning()) {
+    EncodedDescriptorDatabase* database = new EncodedDescriptorDatabase;
+    Register(encoded_files, registration, database);
+    state.PauseTiming();  // Don't time the destructor.
+    delete database;
+    state.ResumeTiming();
+  }
+  state.SetItemsProcessed(state.iterations() * encoded_files.size());
+}
+
+// Start-up up to and including the first reflection call, which looks up a
+// message type in the last file and follows one of its fields into the file
+// before that.
+void BM_TimeToFirstReflectionCall(benchmark::State& state) {
+  const std::vector<std::string> encoded_files = MakeSchema(state.range_x());
+  const Registration registration =
+      static_cast<Registration>(state.range_y());
+  const std::string type_name =
+      Package(encoded_files.size() - 1) + ".Message" +
+      SimpleItoa(kMessagesPerFile - 1);
+  while (state.KeepRunning()) {
+    EncodedDescriptorDatabase* database = new EncodedDescriptorDatabase;
+    Register(encoded_files, registration, database);
+    DescriptorPool* pool = new DescriptorPool(database);
+    pool->InternalSetLazilyBuildDependencies();
+    const google::protobuf::Descriptor* descriptor =
+        pool->FindMessageTypeByName(type_name);
+    benchmark::DoNotOptimize(descriptor->field(0)->message_type());
+    state.PauseTiming();  // Don't time the destructors.
+    delete pool;
+    delete database;
+    state.ResumeTiming();
+  }
+}
+
+// The first lookup is of a type in the last file, as in
+// BM_TimeToFirstReflectionCall.
+void BM_LoadDescriptorSet(benchmark::State& state) {
+  const std::vector<std::string> encoded_files = MakeSchema(state.range_x());
+  const Loading loading = static_cast<Loading>(state.range_y());
+  FileDescriptorSet file_set;
+  std::vector<const FileDescriptorProto*> files;
+  for (int i = 0; i < encoded_files.size(); i++) {
+    file_set.add_file()->ParseFromString(encoded_files[i]);
+    files.push_back(&file_set.file(i));
+  }
+  const std::string serialized_set = file_set.SerializeAsString();
+  std::string image;
+  DescriptorPoolImageDatabase::BuildImage(files, &image);
+  const std::string type_name =
+      Package(encoded_files.size() - 1) + ".Message" +
+      SimpleItoa(kMessagesPerFile - 1);
+
+  while (state.KeepRunning()) {
+    FileDescriptorSet* parsed_set = NULL;
+    DescriptorPoolImageDatabase* database = NULL;
+    DescriptorPool* pool = NULL;
+    if (loading == BUILD_ALL_FILES) {
+      parsed_set = new FileDescriptorSet;
+      parsed_set->ParseFromString(serialized_set);
+      pool = new DescriptorPool;
+      for (int i = 0; i < parsed_set->file_size(); i++) {
+        pool->BuildFile(parsed_set->file(i));
+      }
+    } else {
+      database = new DescriptorPoolImageDatabase(image.data(), image.size());
+      pool = new DescriptorPool(database);
+      pool->InternalSetLazilyBuildDependencies();
+    }
+    benchmark::DoNotOptimize(pool->FindMessageTypeByName(type_name));
+    state.PauseTiming();  // Don't time the destructors.
+    delete pool;
+    delete database;
+    delete parsed_set;
+    state.ResumeTiming();
+  }
+}
+
+// Builds each file in turn from a database which indexes them up front, the
+// way a schema registry loads its schemas.  The label gives the memory held
+// by the pool, not counting the database.
+void BM_BuildPool(benchmark::State& state) {
+  const std::vector<std::string> encoded_files = MakeSchema(state.range_x());
+  long long pool_bytes = 0;
+  while (state.KeepRunning()) {
+    state.PauseTiming();
+    EncodedDescriptorDatabase* database = new EncodedDescriptorDatabase;
+    Register(encoded_files, INDEX_ON_ADD, database);
+    const long long bytes_before = live_bytes;
+    state.ResumeTiming();
+    DescriptorPool* pool = new DescriptorPool(database);
+    for (int i = 0; i < encoded_files.size(); i++) {
+      benchmark::DoNotOptimize(pool->FindFileByName(FileName(i)));
+    }
+    state.PauseTiming();  // Don't time the destructors.
+    pool_bytes = live_bytes - bytes_before;
+    delete pool;
+    delete database;
+    state.ResumeTiming();
+  }
+  const int num_symbols =
+      encoded_files.size() * kMessagesPerFile * (kFieldsPerMessage + 1);
+  state.SetLabel(SimpleItoa(pool_bytes / 1024) + " KiB, " +
+                 SimpleItoa(pool_bytes / num_symbols) + " bytes/symbol");
+}
+
+// Builds a schema of 100 independent chains of 20 files with
+// DescriptorPool::BuildFiles() on as many threads as the argument.
+void BM_BuildFiles(benchmark::State& state) {
+  const std::vector<std::string> encoded_files = MakeSchema(2000, 100);
+  FileDescriptorSet file_set;
+  for (int i = 0; i < encoded_files.size(); i++) {
+    file_set.add_file()->ParseFromString(encoded_files[i]);
+  }
+  while (state.KeepRunning()) {
+    DescriptorPool* pool = new DescriptorPool;
+    benchmark::DoNotOptimize(
+        pool->BuildFiles(file_set, state.range_x(), NULL, NULL));
+    state.PauseTiming();  // Don't time the destructor.
+    delete pool;
+    state.ResumeTiming();
+  }
+  state.SetItemsProcessed(state.iterations() * encoded_files.size());
+}
+
+// All threads share one pool, built by the first lookups.
+void BM_FindMessageTypeByName(benchmark::State& state) {
+  const int kNumFiles = 100;
+  static EncodedDescriptorDatabase* database = NULL;
+  static DescriptorPool* pool = NULL;
+  static std::vector<std::string>* encoded_files = NULL;
+  static std::vector<std::string>* type_names = NULL;
+  if (state.thread_index == 0 && pool == NULL) {
+    encoded_files = new std::vector<std::string>(MakeSchema(kNumFiles));
+    database = new EncodedDescriptorDatabase;
+    Register(*encoded_files, INDEX_LAZILY, database);
+    pool = new DescriptorPool(database);
+    type_names = new std::vector<std::string>;
+    for (int i = 0; i < kNumFiles; i++) {
+      for (int j = 0; j < kMessagesPerFile; j++) {
+        type_names->push_back(Package(i) + ".Message" + SimpleItoa(j));
+        pool->FindMessageTypeByName(type_names->back());
+      }
+    }
+  }
+  int i = state.thread_index;
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(
+        pool->FindMessageTypeByName((*type_names)[i % type_names->size()]));
+    i += 7;
+  }
+  state.SetItemsProcessed(state.iterations());
+}
+
+}  // namespace
+
+#define SCHEMA_SIZES(benchmark)                                         \
+  BENCHMARK(benchmark)                                                  \
+      ->ArgPair(100, INDEX_ON_ADD)->ArgPair(100, INDEX_LAZILY)          \
+      ->ArgPair(2000, INDEX_ON_ADD)->ArgPair(2000, INDEX_LAZILY)
+
+SCHEMA_SIZES(BM_RegisterFiles);
+SCHEMA_SIZES(BM_TimeToFirstReflectionCall);
+BENCHMARK(BM_LoadDescriptorSet)
+    ->ArgPair(2000, BUILD_ALL_FILES)->ArgPair(2000, OPEN_IMAGE);
+BENCHMARK(BM_BuildPool)->Arg(100)->Arg(2000);
+BENCHMARK(BM_BuildFiles)->Arg(1)->Arg(2)->Arg(4)->Arg(8);
+BENCHMARK(BM_FindMessageTypeByName)->ThreadRange(1, 64);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,184 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// https://developers.google.com/protocol-buffers/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Microbenchmarks for messages carrying many extensions, which are stored in
+// an ExtensionSet.
+//
+// The extensions of Envelope are registered at run time rather than declared
+// in benchmark_messages_extensions.proto, kNumExtensions of them.  They cycle
+// through int64, string and Payload message extensions.  The argument of each
+// benchmark is the number of extensions set.
+
+#include <string>
+#include "benchmark/benchmark_api.h"
+#include "benchmark_messages_extensions.pb.h"
+#include <google/protobuf/arena.h>
+#include <google/protobuf/extension_set.h>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
+#include <google/protobuf/stubs/common.h>
+#include <google/protobuf/wire_format_lite.h>
+
+using benchmarks::extensions::Envelope;
+using benchmarks::extensions::Payload;
+using google::protobuf::Arena;
+using google::protobuf::int64;
+using google::protobuf::internal::ExtensionSet;
+using google::protobuf::internal::WireFormatLite;
+
+namespace {
+
+const int kFirstExtension = 100;
+const int kNumExtensions = 200;
+
+void RegisterExtensions() {
+  for (int i = 0; i < kNumExtensions; i++) {
+    const int number = kFirstExtension + i;
+    switch (i % 3) {
+      case 0:
+        ExtensionSet::RegisterExtension(&Envelope::default_instance(), number,
+                                        WireFormatLite::TYPE_INT64, false,
+                                        false);
+        break;
+      case 1:
+        ExtensionSet::RegisterExtension(&Envelope::default_instance(), number,
+                                        WireFormatLite::TYPE_STRING, false,
+                                        false);
+        break;
+      case 2:
+        ExtensionSet::RegisterMessageExtension(
+            &Envelope::default_instance(), number, WireFormatLite::TYPE_MESSAGE,
+            false, false, &Payload::default_instance());
+        break;
+    }
+  }
+}
+
+// Returns an encoded Envelope with the first n extensions set.
+std::string EncodeEnvelope(int n) {
+  Payload payload;
+  payload.set_id(42);
+  payload.set_name("plugin payload");
+  const std::string encoded_payload = payload.SerializeAsString();
+
+  std::string result;
+  {
+    google::protobuf::io::StringOutputStream stream(&result);
+    google::protobuf::io::CodedOutputStream output(&stream);
+    WireFormatLite::WriteInt64(1, 12345, &output);
+    for (int i = 0; i < n; i++) {
+      const int number = kFirstExtension + i;
+      switch (i % 3) {
+        case 0:
+          WireFormatLite::WriteInt64(number, i * 1000, &output);
+          break;
+        case 1:
+          WireFormatLite::WriteString(number, "plugin value", &output);
+          break;
+        case 2:
+          WireFormatLite::WriteBytes(number, encoded_payload, &output);
+          break;
+      }
+    }
+  }
+  return result;
+}
+
+void BM_EnvelopeParse(benchmark::State& state) {
+  const std::string data = EncodeEnvelope(state.range_x());
+  while (state.KeepRunning()) {
+    Envelope envelope;
+    benchmark::DoNotOptimize(envelope.ParseFromString(data));
+  }
+  state.SetBytesProcessed(state.iterations() * data.size());
+}
+BENCHMARK(BM_EnvelopeParse)->Arg(10)->Arg(50)->Arg(200);
+
+void BM_EnvelopeParseArena(benchmark::State& state) {
+  const std::string data = EncodeEnvelope(state.range_x());
+  while (state.KeepRunning()) {
+    Arena arena;
+    Envelope* envelope = Arena::CreateMessage<Envelope>(&arena);
+    benchmark::DoNotOptimize(envelope->ParseFromString(data));
+  }
+  state.SetBytesProcessed(state.iterations() * data.size());
+}
+BENCHMARK(BM_EnvelopeParseArena)->Arg(10)->Arg(50)->Arg(200);
+
+void BM_EnvelopeSerialize(benchmark::State& state) {
+  Envelope envelope;
+  envelope.ParseFromString(EncodeEnvelope(state.range_x()));
+  std::string data;
+  while (state.KeepRunning()) {
+    data.clear();
+    envelope.SerializeToString(&data);
+  }
+  state.SetBytesProcessed(state.iterations() * data.size());
+}
+BENCHMARK(BM_EnvelopeSerialize)->Arg(10)->Arg(50)->Arg(200);
+
+void BM_EnvelopeCopy(benchmark::State& state) {
+  Envelope envelope;
+  envelope.ParseFromString(EncodeEnvelope(state.range_x()));
+  while (state.KeepRunning()) {
+    Envelope copy(envelope);
+    benchmark::DoNotOptimize(copy.ByteSize());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range_x());
+}
+BENCHMARK(BM_EnvelopeCopy)->Arg(10)->Arg(50)->Arg(200);
+
+// Looks up every int64 extension of a set, as the accessors generated for
+// the extensions do.
+void BM_ExtensionSetLookup(benchmark::State& state) {
+  const int n = state.range_x();
+  ExtensionSet set;
+  for (int i = 0; i < n; i++) {
+    set.SetInt64(kFirstExtension + i, WireFormatLite::TYPE_INT64, i, NULL);
+  }
+  while (state.KeepRunning()) {
+    int64 total = 0;
+    for (int i = 0; i < n; i++) {
+      total += set.GetInt64(kFirstExtension + i, 0);
+    }
+    benchmark::DoNotOptimize(total);
+  }
+  state.SetItemsProcessed(state.iterations() * n);
+}
+BENCHMARK(BM_ExtensionSetLookup)->Arg(10)->Arg(50)->Arg(200);
+
+}  // namespace
+
+int main(int argc, char** argv) {
+  RegisterExtensions();
+  ::benchmark::Initialize(&argc, argv);
+  ::benchmark::RunSpecifiedBenchmarks();
+  return 0;
+}
@@ -0,0 +1,153 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// https://developers.google.com/protocol-buffers/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Parsing and serialization benchmarks for lite messages.
+//
+// The same source is linked twice: lite-benchmark uses the regular generated
+// parsers and serializers, lite-benchmark-table-driven uses code generated
+// with --cpp_out=table_driven_parsing,table_driven_serialization.  Comparing
+// the two runs (and the sizes of the two benchmark_messages_lite.pb.o files)
+// shows what the shared table-driven engines cost in throughput and save in
+// code size.
+
+#include <stdlib.h>
+#include <string>
+#include "benchmark/benchmark_api.h"
+#include "benchmark_messages_lite.pb.h"
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
+#include <google/protobuf/stubs/common.h>
+
+using benchmarks::lite::LiteAttribute;
+using benchmarks::lite::LiteBatch;
+using benchmarks::lite::LiteRecord;
+
+namespace {
+
+// A batch of |num_records| records.  Deterministic, so that runs of the two
+// binaries serialize identical bytes.
+void FillBatch(int num_records, LiteBatch* batch) {
+  srand(301);
+  batch->set_source("benchmark");
+  batch->set_sequence(12345678901ULL);
+  for (int i = 0; i < num_records; i++) {
+    LiteRecord* record = batch->add_records();
+    record->set_id(rand());
+    record->set_version(rand() % 100);
+    record->set_name("record name");
+    record->set_payload(std::string(rand() % 64, 'x'));
+    record->set_status(benchmarks::lite::LITE_STATUS_OK);
+    record->set_checksum(static_cast<google::protobuf::uint64>(rand()) << 32);
+    record->set_score(rand() / 7.0);
+    record->set_deleted(i % 2 == 0);
+    record->set_delta(rand() % 1000 - 500);
+    for (int j = 0; j < 3; j++) {
+      LiteAttribute* attribute = record->add_attributes();
+      attribute->set_key("key");
+      attribute->set_value("some attribute value");
+      attribute->set_timestamp(rand());
+    }
+    for (int j = 0; j < 16; j++) {
+      record->add_sizes(rand() % 5000);
+      record->add_offsets(rand());
+    }
+    record->add_tags("tag1");
+    record->add_tags("tag2");
+    record->mutable_owner()->set_key("owner");
+  }
+}
+
+void BM_ByteSize(benchmark::State& state) {
+  LiteBatch batch;
+  FillBatch(state.range_x(), &batch);
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(batch.ByteSizeLong());
+  }
+  state.SetBytesProcessed(state.iterations() * batch.ByteSizeLong());
+}
+BENCHMARK(BM_ByteSize)->Arg(1)->Arg(100);
+
+// SerializeToString: ByteSizeLong followed by the flat array path.
+void BM_SerializeToString(benchmark::State& state) {
+  LiteBatch batch;
+  FillBatch(state.range_x(), &batch);
+  std::string output;
+  while (state.KeepRunning()) {
+    batch.SerializeToString(&output);
+  }
+  state.SetBytesProcessed(state.iterations() * output.size());
+}
+BENCHMARK(BM_SerializeToString)->Arg(1)->Arg(100);
+
+// Serializes to a stream handing out small chunks, so that the
+// CodedOutputStream path is taken instead of the array path.
+void BM_SerializeToStream(benchmark::State& state) {
+  LiteBatch batch;
+  FillBatch(state.range_x(), &batch);
+  const int size = batch.ByteSize();
+  std::string buffer(size, '\0');
+  while (state.KeepRunning()) {
+    google::protobuf::io::ArrayOutputStream output(&buffer[0], size, 64);
+    batch.SerializeToZeroCopyStream(&output);
+  }
+  state.SetBytesProcessed(state.iterations() * size);
+}
+BENCHMARK(BM_SerializeToStream)->Arg(1)->Arg(100);
+
+void BM_Parse(benchmark::State& state) {
+  LiteBatch batch;
+  FillBatch(state.range_x(), &batch);
+  const std::string data = batch.SerializeAsString();
+  LiteBatch parsed;
+  while (state.KeepRunning()) {
+    parsed.ParseFromString(data);
+  }
+  state.SetBytesProcessed(state.iterations() * data.size());
+}
+BENCHMARK(BM_Parse)->Arg(1)->Arg(100);
+
+// Parses from a stream handing out small chunks, so that many fields straddle
+// two chunks.
+void BM_ParseFromStream(benchmark::State& state) {
+  LiteBatch batch;
+  FillBatch(state.range_x(), &batch);
+  const std::string data = batch.SerializeAsString();
+  LiteBatch parsed;
+  while (state.KeepRunning()) {
+    google::protobuf::io::ArrayInputStream input(data.data(), data.size(), 64);
+    parsed.ParseFromZeroCopyStream(&input);
+  }
+  state.SetBytesProcessed(state.iterations() * data.size());
+}
+BENCHMARK(BM_ParseFromStream)->Arg(1)->Arg(100);
+
+}  // namespace
+
+BENCHMARK_MAIN();
@@ -0,0 +1,249 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// https://developers.google.com/protocol-buffers/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Microbenchmarks for google::protobuf::Map, through the map fields of
+// benchmark_messages_map.proto.
+//
+// Build protobuf with and without GOOGLE_PROTOBUF_MAP_FLAT_TABLE (the
+// protobuf_MAP_FLAT_TABLE CMake option) to compare the chaining and the
+// open-addressing Map.  The argument of each benchmark is the number of map
+// entries.
+
+#include <string>
+#include <vector>
+#include "benchmark/benchmark_api.h"
+#include "benchmark_messages_map.pb.h"
+#include <google/protobuf/arena.h>
+#include <google/protobuf/stubs/common.h>
+#include <google/protobuf/stubs/stringpiece.h>
+#include <google/protobuf/stubs/strutil.h>
+
+using benchmarks::maps::Int64MessageMap;
+using benchmarks::maps::MapValue;
+using benchmarks::maps::StringMap;
+using google::protobuf::Arena;
+using google::protobuf::int64;
+
+namespace {
+
+// Keys shaped like HTTP header names, to give the string hash some work.
+std::vector<std::string> StringKeys(int n) {
+  std::vector<std::string> keys;
+  for (int i = 0; i < n; i++) {
+    keys.push_back("x-request-header-" + google::protobuf::SimpleItoa(i * 7919));
+  }
+  return keys;
+}
+
+// Sparse keys, as ids usually are.
+std::vector<int64> Int64Keys(int n) {
+  std::vector<int64> keys;
+  for (int i = 0; i < n; i++) {
+    keys.push_back(static_cast<int64>(i) * 1000003 + 17);
+  }
+  return keys;
+}
+
+void Fill(const std::vector<std::string>& keys, StringMap* message) {
+  for (int i = 0; i < keys.size(); i++) {
+    (*message->mutable_entries())[keys[i]] = keys[i];
+  }
+}
+
+void Fill(const std::vector<int64>& keys, Int64MessageMap* message) {
+  for (int i = 0; i < keys.size(); i++) {
+    MapValue& value = (*message->mutable_entries())[keys[i]];
+    value.set_id(keys[i]);
+    value.set_name("value");
+    value.add_values(i);
+  }
+}
+
+void BM_StringMapInsert(benchmark::State& state) {
+  const std::vector<std::string> keys = StringKeys(state.range_x());
+  while (state.KeepRunning()) {
+    StringMap message;
+    Fill(keys, &message);
+    benchmark::DoNotOptimize(message.entries().size());
+  }
+  state.SetItemsProcessed(state.iterations() * keys.size());
+}
+BENCHMARK(BM_StringMapInsert)->Range(8, 4096);
+
+void BM_StringMapInsertArena(benchmark::State& state) {
+  const std::vector<std::string> keys = StringKeys(state.range_x());
+  while (state.KeepRunning()) {
+    Arena arena;
+    StringMap* message = Arena::CreateMessage<StringMap>(&arena);
+    Fill(keys, message);
+    benchmark::DoNotOptimize(message->entries().size());
+  }
+  state.SetItemsProcessed(state.iterations() * keys.size());
+}
+BENCHMARK(BM_StringMapInsertArena)->Range(8, 4096);
+
+void BM_StringMapLookup(benchmark::State& state) {
+  const std::vector<std::string> keys = StringKeys(state.range_x());
+  StringMap message;
+  Fill(keys, &message);
+  const google::protobuf::Map<std::string, std::string>& entries =
+      message.entries();
+  while (state.KeepRunning()) {
+    for (int i = 0; i < keys.size(); i++) {
+      benchmark::DoNotOptimize(entries.find(keys[i]));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * keys.size());
+}
+BENCHMARK(BM_StringMapLookup)->Range(8, 4096);
+
+// Looks the keys up the way a server looks up the headers of a request: by
+// StringPieces into a larger buffer.  The second argument selects copying
+// each piece into a string for the lookup (0) or looking the piece up
+// directly (1).
+void BM_StringMapLookupPiece(benchmark::State& state) {
+  const std::vector<std::string> keys = StringKeys(state.range_x());
+  StringMap message;
+  Fill(keys, &message);
+  const google::protobuf::Map<std::string, std::string>& entries =
+      message.entries();
+  std::string buffer;
+  for (int i = 0; i < keys.size(); i++) buffer += keys[i];
+  std::vector<google::protobuf::StringPiece> pieces;
+  size_t offset = 0;
+  for (int i = 0; i < keys.size(); i++) {
+    pieces.push_back(
+        google::protobuf::StringPiece(buffer.data() + offset, keys[i].size()));
+    offset += keys[i].size();
+  }
+  const bool direct = state.range_y() != 0;
+  while (state.KeepRunning()) {
+    for (int i = 0; i < pieces.size(); i++) {
+      if (direct) {
+        benchmark::DoNotOptimize(entries.find(pieces[i]));
+      } else {
+        benchmark::DoNotOptimize(entries.find(pieces[i].ToString()));
+      }
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * pieces.size());
+}
+BENCHMARK(BM_StringMapLookupPiece)
+    ->ArgPair(8, 0)->ArgPair(8, 1)->ArgPair(4096, 0)->ArgPair(4096, 1);
+
+void BM_StringMapIterate(benchmark::State& state) {
+  StringMap message;
+  Fill(StringKeys(state.range_x()), &message);
+  const google::protobuf::Map<std::string, std::string>& entries =
+      message.entries();
+  while (state.KeepRunning()) {
+    size_t total = 0;
+    for (google::protobuf::Map<std::string, std::string>::const_iterator it =
+             entries.begin();
+         it != entries.end(); ++it) {
+      total += it->second.size();
+    }
+    benchmark::DoNotOptimize(total);
+  }
+  state.SetItemsProcessed(state.iterations() * entries.size());
+}
+BENCHMARK(BM_StringMapIterate)->Range(8, 4096);
+
+void BM_StringMapParse(benchmark::State& state) {
+  StringMap message;
+  Fill(StringKeys(state.range_x()), &message);
+  const std::string data = message.SerializeAsString();
+  while (state.KeepRunning()) {
+    StringMap parsed;
+    benchmark::DoNotOptimize(parsed.ParseFromString(data));
+  }
+  state.SetBytesProcessed(state.iterations() * data.size());
+}
+BENCHMARK(BM_StringMapParse)->Range(8, 4096);
+
+void BM_Int64MessageMapInsert(benchmark::State& state) {
+  const std::vector<int64> keys = Int64Keys(state.range_x());
+  while (state.KeepRunning()) {
+    Int64MessageMap message;
+    Fill(keys, &message);
+    benchmark::DoNotOptimize(message.entries().size());
+  }
+  state.SetItemsProcessed(state.iterations() * keys.size());
+}
+BENCHMARK(BM_Int64MessageMapInsert)->Range(8, 4096);
+
+void BM_Int64MessageMapLookup(benchmark::State& state) {
+  const std::vector<int64> keys = Int64Keys(state.range_x());
+  Int64MessageMap message;
+  Fill(keys, &message);
+  const google::protobuf::Map<int64, MapValue>& entries = message.entries();
+  while (state.KeepRunning()) {
+    for (int i = 0; i < keys.size(); i++) {
+      benchmark::DoNotOptimize(entries.find(keys[i]));
+      // A miss, which has to probe until it finds an empty slot or list end.
+      benchmark::DoNotOptimize(entries.find(keys[i] + 1));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * keys.size() * 2);
+}
+BENCHMARK(BM_Int64MessageMapLookup)->Range(8, 4096);
+
+void BM_Int64MessageMapIterate(benchmark::State& state) {
+  Int64MessageMap message;
+  Fill(Int64Keys(state.range_x()), &message);
+  const google::protobuf::Map<int64, MapValue>& entries = message.entries();
+  while (state.KeepRunning()) {
+    int64 total = 0;
+    for (google::protobuf::Map<int64, MapValue>::const_iterator it =
+             entries.begin();
+         it != entries.end(); ++it) {
+      total += it->second.id();
+    }
+    benchmark::DoNotOptimize(total);
+  }
+  state.SetItemsProcessed(state.iterations() * entries.size());
+}
+BENCHMARK(BM_Int64MessageMapIterate)->Range(8, 4096);
+
+void BM_Int64MessageMapParse(benchmark::State& state) {
+  Int64MessageMap message;
+  Fill(Int64Keys(state.range_x()), &message);
+  const std::string data = message.SerializeAsString();
+  while (state.KeepRunning()) {
+    Int64MessageMap parsed;
+    benchmark::DoNotOptimize(parsed.ParseFromString(data));
+  }
+  state.SetBytesProcessed(state.iterations() * data.size());
+}
+BENCHMARK(BM_Int64MessageMapParse)->Range(8, 4096);
+
+}  // namespace
+
+BENCHMARK_MAIN();
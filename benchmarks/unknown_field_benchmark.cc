@@ -0,0 +1,155 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// https://developers.google.com/protocol-buffers/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Microbenchmarks for messages that are parsed and serialized again without
+// their unknown fields being looked at, as a proxy does.
+//
+// The messages are RequestHeaders carrying fields RequestHeader does not
+// declare.  These cycle through int64, string and nested message fields, and
+// the argument of each benchmark is how many of them there are.
+
+#include <string>
+#include "benchmark/benchmark_api.h"
+#include "benchmark_messages_unknown.pb.h"
+#include <google/protobuf/arena.h>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
+#include <google/protobuf/unknown_field_set.h>
+#include <google/protobuf/wire_format_lite.h>
+
+using benchmarks::unknown::RequestHeader;
+using google::protobuf::Arena;
+using google::protobuf::UnknownFieldSet;
+using google::protobuf::internal::WireFormatLite;
+
+namespace {
+
+const int kFirstUnknownField = 100;
+
+// Returns an encoded RequestHeader followed by n unknown fields.
+std::string EncodeRequest(int n) {
+  RequestHeader nested;
+  nested.set_id(42);
+  nested.set_route("/backend/nested");
+  const std::string encoded_nested = nested.SerializeAsString();
+
+  std::string result;
+  {
+    google::protobuf::io::StringOutputStream stream(&result);
+    google::protobuf::io::CodedOutputStream output(&stream);
+    WireFormatLite::WriteInt64(1, 12345, &output);
+    WireFormatLite::WriteString(2, "/frontend/request", &output);
+    for (int i = 0; i < n; i++) {
+      const int number = kFirstUnknownField + i;
+      switch (i % 3) {
+        case 0:
+          WireFormatLite::WriteInt64(number, i * 1000, &output);
+          break;
+        case 1:
+          WireFormatLite::WriteString(number, "opaque request value",
+                                      &output);
+          break;
+        case 2:
+          WireFormatLite::WriteBytes(number, encoded_nested, &output);
+          break;
+      }
+    }
+  }
+  return result;
+}
+
+void BM_PassThroughParse(benchmark::State& state) {
+  const std::string data = EncodeRequest(state.range_x());
+  while (state.KeepRunning()) {
+    RequestHeader header;
+    benchmark::DoNotOptimize(header.ParseFromString(data));
+  }
+  state.SetBytesProcessed(state.iterations() * data.size());
+}
+BENCHMARK(BM_PassThroughParse)->Arg(10)->Arg(100)->Arg(1000);
+
+void BM_PassThroughParseArena(benchmark::State& state) {
+  const std::string data = EncodeRequest(state.range_x());
+  while (state.KeepRunning()) {
+    Arena arena;
+    RequestHeader* header = Arena::CreateMessage<RequestHeader>(&arena);
+    benchmark::DoNotOptimize(header->ParseFromString(data));
+  }
+  state.SetBytesProcessed(state.iterations() * data.size());
+}
+BENCHMARK(BM_PassThroughParseArena)->Arg(10)->Arg(100)->Arg(1000);
+
+void BM_PassThroughSerialize(benchmark::State& state) {
+  RequestHeader header;
+  header.ParseFromString(EncodeRequest(state.range_x()));
+  std::string data;
+  while (state.KeepRunning()) {
+    data.clear();
+    header.SerializeToString(&data);
+  }
+  state.SetBytesProcessed(state.iterations() * data.size());
+}
+BENCHMARK(BM_PassThroughSerialize)->Arg(10)->Arg(100)->Arg(1000);
+
+// Parses a request, changes a known field and serializes it again.
+void BM_PassThroughRoundTrip(benchmark::State& state) {
+  const std::string data = EncodeRequest(state.range_x());
+  std::string output;
+  while (state.KeepRunning()) {
+    RequestHeader header;
+    header.ParseFromString(data);
+    header.set_route("/backend/request");
+    output.clear();
+    header.SerializeToString(&output);
+  }
+  state.SetBytesProcessed(state.iterations() * data.size());
+}
+BENCHMARK(BM_PassThroughRoundTrip)->Arg(10)->Arg(100)->Arg(1000);
+
+// Visits every unknown field of a freshly parsed request, which decodes them.
+void BM_UnknownFieldAccess(benchmark::State& state) {
+  const std::string data = EncodeRequest(state.range_x());
+  while (state.KeepRunning()) {
+    RequestHeader header;
+    header.ParseFromString(data);
+    const UnknownFieldSet& unknown_fields = header.unknown_fields();
+    int total = 0;
+    for (int i = 0; i < unknown_fields.field_count(); i++) {
+      total += unknown_fields.field(i).number();
+    }
+    benchmark::DoNotOptimize(total);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range_x());
+}
+BENCHMARK(BM_UnknownFieldAccess)->Arg(10)->Arg(100)->Arg(1000);
+
+}  // namespace
+
+BENCHMARK_MAIN();
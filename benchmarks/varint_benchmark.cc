@@ -0,0 +1,264 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// https://developers.google.com/protocol-buffers/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// Microbenchmarks for varint decoding in CodedInputStream and for reading,
+// sizing and writing packed varint fields with WireFormatLite.
+//
+// Each benchmark takes the value distribution as its argument, so e.g.
+// --benchmark_filter=ReadPacked shows how the bulk decoder fares on short and
+// long varints.
+
+#include <stdlib.h>
+#include <string>
+#include <vector>
+#include "benchmark/benchmark_api.h"
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
+#include <google/protobuf/repeated_field.h>
+#include <google/protobuf/stubs/common.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/wire_format_lite_inl.h>
+
+using google::protobuf::RepeatedField;
+using google::protobuf::int32;
+using google::protobuf::int64;
+using google::protobuf::uint32;
+using google::protobuf::uint64;
+using google::protobuf::uint8;
+using google::protobuf::io::CodedInputStream;
+using google::protobuf::io::CodedOutputStream;
+using google::protobuf::io::StringOutputStream;
+using google::protobuf::internal::WireFormatLite;
+
+namespace {
+
+// Large enough that the branch predictor cannot learn the lengths of all the
+// varints, as it would for a small array decoded over and over.
+const int kValues = 1 << 16;
+
+enum Distribution {
+  // Ids, counts and enum values: a single byte each.
+  SMALL,
+  // A mix of one, two and three byte varints, skewed towards short ones.
+  MIXED,
+  // Hashes and fingerprints: mostly nine or ten bytes.
+  HASHES,
+  // Negative int32 values, which are always sign-extended to ten bytes.
+  NEGATIVE_INT32,
+  // Small signed values encoded with zigzag, as for sint32/sint64 fields.
+  ZIGZAG,
+};
+
+uint64 NextValue(Distribution distribution) {
+  // Deterministic, so that runs are comparable.
+  uint64 r = static_cast<uint64>(rand()) << 32 | static_cast<uint64>(rand());
+  switch (distribution) {
+    case SMALL:
+      return r & 0x7f;
+    case MIXED:
+      switch (r % 8) {
+        case 0:
+          return (r >> 8) & 0x1fffff;
+        case 1:
+        case 2:
+          return (r >> 8) & 0x3fff;
+        default:
+          return (r >> 8) & 0x7f;
+      }
+    case HASHES:
+      return r * GOOGLE_ULONGLONG(0x9e3779b97f4a7c15);
+    case NEGATIVE_INT32:
+      return static_cast<uint64>(static_cast<int64>(-1 - (r & 0xffff)));
+    case ZIGZAG:
+      return WireFormatLite::ZigZagEncode64(
+          static_cast<int64>(r & 0xffff) - 0x8000);
+  }
+  return 0;
+}
+
+// The varints of kValues values drawn from |distribution|, without tags.
+std::string MakeVarints(Distribution distribution) {
+  srand(301);
+  std::string data;
+  {
+    StringOutputStream raw_output(&data);
+    CodedOutputStream output(&raw_output);
+    for (int i = 0; i < kValues; i++) {
+      output.WriteVarint64(NextValue(distribution));
+    }
+  }
+  return data;
+}
+
+void BM_ReadVarint64(benchmark::State& state) {
+  const std::string data =
+      MakeVarints(static_cast<Distribution>(state.range_x()));
+  const uint8* buffer = reinterpret_cast<const uint8*>(data.data());
+  while (state.KeepRunning()) {
+    CodedInputStream input(buffer, data.size());
+    uint64 value;
+    for (int i = 0; i < kValues; i++) {
+      input.ReadVarint64(&value);
+      benchmark::DoNotOptimize(value);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kValues);
+  state.SetBytesProcessed(state.iterations() * data.size());
+}
+BENCHMARK(BM_ReadVarint64)->DenseRange(SMALL, ZIGZAG);
+
+void BM_ReadVarint32(benchmark::State& state) {
+  const std::string data =
+      MakeVarints(static_cast<Distribution>(state.range_x()));
+  const uint8* buffer = reinterpret_cast<const uint8*>(data.data());
+  while (state.KeepRunning()) {
+    CodedInputStream input(buffer, data.size());
+    uint32 value;
+    for (int i = 0; i < kValues; i++) {
+      input.ReadVarint32(&value);
+      benchmark::DoNotOptimize(value);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * kValues);
+  state.SetBytesProcessed(state.iterations() * data.size());
+}
+BENCHMARK(BM_ReadVarint32)->DenseRange(SMALL, ZIGZAG);
+
+template <typename CType, WireFormatLite::FieldType DeclaredType>
+void BM_ReadPacked(benchmark::State& state) {
+  const std::string varints =
+      MakeVarints(static_cast<Distribution>(state.range_x()));
+  std::string data;
+  {
+    StringOutputStream raw_output(&data);
+    CodedOutputStream output(&raw_output);
+    output.WriteVarint32(varints.size());
+    output.WriteString(varints);
+  }
+  const uint8* buffer = reinterpret_cast<const uint8*>(data.data());
+  RepeatedField<CType> values;
+  while (state.KeepRunning()) {
+    CodedInputStream input(buffer, data.size());
+    values.Clear();
+    WireFormatLite::ReadPackedPrimitive<CType, DeclaredType>(&input, &values);
+    benchmark::DoNotOptimize(values.data());
+  }
+  state.SetItemsProcessed(state.iterations() * kValues);
+  state.SetBytesProcessed(state.iterations() * varints.size());
+}
+BENCHMARK_TEMPLATE2(BM_ReadPacked, uint64, WireFormatLite::TYPE_UINT64)
+    ->DenseRange(SMALL, ZIGZAG);
+BENCHMARK_TEMPLATE2(BM_ReadPacked, int32, WireFormatLite::TYPE_INT32)
+    ->DenseRange(SMALL, ZIGZAG);
+BENCHMARK_TEMPLATE2(BM_ReadPacked, int64, WireFormatLite::TYPE_SINT64)
+    ->Arg(ZIGZAG);
+
+// kValues values drawn from |distribution|.  For zigzag fields the values are
+// decoded first, so that ZIGZAG yields small signed values.
+template <typename CType>
+RepeatedField<CType> MakeValues(Distribution distribution, bool zigzag) {
+  srand(301);
+  RepeatedField<CType> values;
+  for (int i = 0; i < kValues; i++) {
+    uint64 value = NextValue(distribution);
+    if (zigzag) value = WireFormatLite::ZigZagDecode64(value);
+    values.Add(static_cast<CType>(value));
+  }
+  return values;
+}
+
+template <typename CType>
+void WritePacked(benchmark::State& state,
+                 uint8* (*writer)(const RepeatedField<CType>&, uint8*),
+                 size_t (*sizer)(const RepeatedField<CType>&), bool zigzag) {
+  const RepeatedField<CType> values =
+      MakeValues<CType>(static_cast<Distribution>(state.range_x()), zigzag);
+  const size_t size = sizer(values);
+  std::vector<uint8> buffer(size);
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(writer(values, &buffer[0]));
+  }
+  state.SetItemsProcessed(state.iterations() * kValues);
+  state.SetBytesProcessed(state.iterations() * size);
+}
+
+template <typename CType>
+void PackedSize(benchmark::State& state,
+                size_t (*sizer)(const RepeatedField<CType>&), bool zigzag) {
+  const RepeatedField<CType> values =
+      MakeValues<CType>(static_cast<Distribution>(state.range_x()), zigzag);
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(sizer(values));
+  }
+  state.SetItemsProcessed(state.iterations() * kValues);
+}
+
+void BM_WritePackedInt32(benchmark::State& state) {
+  WritePacked<int32>(state, WireFormatLite::WriteInt32NoTagToArray,
+                     WireFormatLite::Int32Size, false);
+}
+BENCHMARK(BM_WritePackedInt32)->DenseRange(SMALL, NEGATIVE_INT32);
+
+void BM_WritePackedSInt32(benchmark::State& state) {
+  WritePacked<int32>(state, WireFormatLite::WriteSInt32NoTagToArray,
+                     WireFormatLite::SInt32Size, true);
+}
+BENCHMARK(BM_WritePackedSInt32)->Arg(ZIGZAG);
+
+void BM_WritePackedUInt64(benchmark::State& state) {
+  WritePacked<uint64>(state, WireFormatLite::WriteUInt64NoTagToArray,
+                      WireFormatLite::UInt64Size, false);
+}
+BENCHMARK(BM_WritePackedUInt64)->DenseRange(SMALL, HASHES);
+
+void BM_WritePackedSInt64(benchmark::State& state) {
+  WritePacked<int64>(state, WireFormatLite::WriteSInt64NoTagToArray,
+                     WireFormatLite::SInt64Size, true);
+}
+BENCHMARK(BM_WritePackedSInt64)->Arg(ZIGZAG);
+
+void BM_PackedSizeInt32(benchmark::State& state) {
+  PackedSize<int32>(state, WireFormatLite::Int32Size, false);
+}
+BENCHMARK(BM_PackedSizeInt32)->DenseRange(SMALL, NEGATIVE_INT32);
+
+void BM_PackedSizeSInt32(benchmark::State& state) {
+  PackedSize<int32>(state, WireFormatLite::SInt32Size, true);
+}
+BENCHMARK(BM_PackedSizeSInt32)->Arg(ZIGZAG);
+
+void BM_PackedSizeUInt64(benchmark::State& state) {
+  PackedSize<uint64>(state, WireFormatLite::UInt64Size, false);
+}
+BENCHMARK(BM_PackedSizeUInt64)->DenseRange(SMALL, HASHES);
+
+}  // namespace
+
+BENCHMARK_MAIN();
@@ -44,6 +44,8 @@ set(libprotobuf_files
   ${protobuf_source_dir}/src/google/protobuf/util/internal/proto_writer.cc
   ${protobuf_source_dir}/src/google/protobuf/util/internal/protostream_objectsource.cc
   ${protobuf_source_dir}/src/google/protobuf/util/internal/protostream_objectwriter.cc
+  ${protobuf_source_dir}/src/google/protobuf/util/internal/reflection_objectsource.cc
+  ${protobuf_source_dir}/src/google/protobuf/util/internal/reflection_objectwriter.cc
   ${protobuf_source_dir}/src/google/protobuf/util/internal/type_info.cc
   ${protobuf_source_dir}/src/google/protobuf/util/internal/type_info_test_helper.cc
   ${protobuf_source_dir}/src/google/protobuf/util/internal/utility.cc
@@ -62,6 +64,9 @@ if(protobuf_WITH_ZLIB)
     target_link_libraries(libprotobuf ${ZLIB_LIBRARIES})
 endif()
 target_include_directories(libprotobuf PUBLIC ${protobuf_source_dir}/src)
+if(protobuf_MAP_FLAT_TABLE)
+  target_compile_definitions(libprotobuf PUBLIC GOOGLE_PROTOBUF_MAP_FLAT_TABLE)
+endif()
 if(MSVC AND protobuf_BUILD_SHARED_LIBS)
   target_compile_definitions(libprotobuf
     PUBLIC  PROTOBUF_USE_DLLS
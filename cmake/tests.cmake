@@ -25,10 +25,17 @@ set(lite_test_protos
   google/protobuf/map_lite_unittest.proto
   google/protobuf/unittest_import_lite.proto
   google/protobuf/unittest_import_public_lite.proto
+  google/protobuf/unittest_lazy_lite.proto
   google/protobuf/unittest_lite.proto
   google/protobuf/unittest_no_arena_lite.proto
 )
 
+# Protos compiled with the table-driven generator options; see
+# compile_table_driven_proto_file below.
+set(table_driven_lite_test_protos
+  google/protobuf/unittest_table_driven_lite.proto
+)
+
 set(tests_protos
   google/protobuf/any_test.proto
   google/protobuf/compiler/cpp/cpp_test_bad_identifiers.proto
@@ -87,6 +94,18 @@ macro(compile_proto_file filename)
   )
 endmacro(compile_proto_file)
 
+macro(compile_table_driven_proto_file filename)
+  get_filename_component(dirname ${filename} PATH)
+  get_filename_component(basename ${filename} NAME_WE)
+  add_custom_command(
+    OUTPUT ${protobuf_source_dir}/src/${dirname}/${basename}.pb.cc
+    DEPENDS protoc ${protobuf_source_dir}/src/${dirname}/${basename}.proto
+    COMMAND protoc ${protobuf_source_dir}/src/${dirname}/${basename}.proto
+        --proto_path=${protobuf_source_dir}/src
+        --cpp_out=table_driven_parsing,table_driven_serialization:${protobuf_source_dir}/src
+  )
+endmacro(compile_table_driven_proto_file)
+
 set(lite_test_proto_files)
 foreach(proto_file ${lite_test_protos})
   compile_proto_file(${proto_file})
@@ -95,6 +114,13 @@ foreach(proto_file ${lite_test_protos})
       ${protobuf_source_dir}/src/${pb_file})
 endforeach(proto_file)
 
+foreach(proto_file ${table_driven_lite_test_protos})
+  compile_table_driven_proto_file(${proto_file})
+  string(REPLACE .proto .pb.cc pb_file ${proto_file})
+  set(lite_test_proto_files ${lite_test_proto_files}
+      ${protobuf_source_dir}/src/${pb_file})
+endforeach(proto_file)
+
 set(tests_proto_files)
 foreach(proto_file ${tests_protos})
   compile_proto_file(${proto_file})
@@ -120,6 +146,7 @@ set(common_lite_test_files
 set(tests_files
   ${protobuf_source_dir}/src/google/protobuf/any_test.cc
   ${protobuf_source_dir}/src/google/protobuf/arena_unittest.cc
+  ${protobuf_source_dir}/src/google/protobuf/arena_metrics_unittest.cc
   ${protobuf_source_dir}/src/google/protobuf/arenastring_unittest.cc
   ${protobuf_source_dir}/src/google/protobuf/compiler/command_line_interface_unittest.cc
   ${protobuf_source_dir}/src/google/protobuf/compiler/cpp/cpp_bootstrap_unittest.cc
@@ -180,6 +207,8 @@ set(tests_files
   ${protobuf_source_dir}/src/google/protobuf/util/internal/json_stream_parser_test.cc
   ${protobuf_source_dir}/src/google/protobuf/util/internal/protostream_objectsource_test.cc
   ${protobuf_source_dir}/src/google/protobuf/util/internal/protostream_objectwriter_test.cc
+  ${protobuf_source_dir}/src/google/protobuf/util/internal/reflection_objectsource_test.cc
+  ${protobuf_source_dir}/src/google/protobuf/util/internal/reflection_objectwriter_test.cc
   ${protobuf_source_dir}/src/google/protobuf/util/internal/type_info_test_helper.cc
   ${protobuf_source_dir}/src/google/protobuf/util/json_util_test.cc
   ${protobuf_source_dir}/src/google/protobuf/util/message_differencer_unittest.cc
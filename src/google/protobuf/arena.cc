@@ -34,10 +34,6 @@
 #include <limits>
 
 
-#ifdef ADDRESS_SANITIZER
-#include <sanitizer/asan_interface.h>
-#endif  // ADDRESS_SANITIZER
-
 namespace google {
 namespace protobuf {
 
@@ -60,28 +56,16 @@ GOOGLE_THREAD_LOCAL Arena::ThreadCache Arena::thread_cache_ = { -1, NULL };
 
 void Arena::Init() {
   lifecycle_id_ = lifecycle_id_generator_.GetNext();
-  blocks_ = 0;
-  hint_ = 0;
-  space_allocated_ = 0;
-  owns_first_block_ = true;
-  cleanup_list_ = 0;
+  google::protobuf::internal::NoBarrier_Store(&threads_, 0);
+  google::protobuf::internal::NoBarrier_Store(&hint_, 0);
+  google::protobuf::internal::NoBarrier_Store(&space_allocated_, 0);
+  initial_block_ = NULL;
 
   if (options_.initial_block != NULL && options_.initial_block_size > 0) {
-    GOOGLE_CHECK_GE(options_.initial_block_size, sizeof(Block))
+    GOOGLE_CHECK_GE(options_.initial_block_size, kHeaderSize + kSerialArenaSize)
         << ": Initial block size too small for header.";
-
-    // Add first unowned block to list.
-    Block* first_block = reinterpret_cast<Block*>(options_.initial_block);
-    first_block->size = options_.initial_block_size;
-    first_block->pos = kHeaderSize;
-    first_block->next = NULL;
-    // Thread which calls Init() owns the first block. This allows the
-    // single-threaded case to allocate on the first block without taking any
-    // locks.
-    first_block->owner = &thread_cache();
-    SetThreadCacheBlock(first_block);
-    AddBlockInternal(first_block);
-    owns_first_block_ = false;
+    initial_block_ = reinterpret_cast<Block*>(options_.initial_block);
+    InitInitialBlock();
   }
 
   // Call the initialization hook
@@ -92,6 +76,22 @@ void Arena::Init() {
   }
 }
 
+void Arena::InitInitialBlock() {
+  initial_block_->next = NULL;
+  initial_block_->pos = kHeaderSize;
+  initial_block_->size = options_.initial_block_size;
+  // Thread which calls Init() or Reset() owns the first block. This allows the
+  // single-threaded case to allocate on the first block without performing
+  // any atomic operations.
+  SerialArena* serial =
+      SerialArena::New(initial_block_, &thread_cache(), this);
+  google::protobuf::internal::NoBarrier_Store(
+      &threads_, reinterpret_cast<google::protobuf::internal::AtomicWord>(serial));
+  google::protobuf::internal::NoBarrier_Store(&space_allocated_,
+                                    options_.initial_block_size);
+  CacheSerialArena(serial);
+}
+
 Arena::~Arena() {
   uint64 space_allocated = ResetInternal();
 
@@ -108,6 +108,8 @@ uint64 Arena::Reset() {
 }
 
 uint64 Arena::ResetInternal() {
+  // Have to do this in a first pass, because some of the destructors might
+  // refer to memory in other blocks.
   CleanupList();
   uint64 space_allocated = FreeBlocks();
 
@@ -119,55 +121,175 @@ uint64 Arena::ResetInternal() {
   return space_allocated;
 }
 
-Arena::Block* Arena::NewBlock(void* me, Block* my_last_block, size_t n,
-                              size_t start_block_size, size_t max_block_size) {
+Arena::Block* Arena::NewBlock(Block* last_block, size_t min_bytes) {
   size_t size;
-  if (my_last_block != NULL) {
+  if (last_block != NULL) {
     // Double the current block size, up to a limit.
-    size = 2 * (my_last_block->size);
-    if (size > max_block_size) size = max_block_size;
+    size = 2 * (last_block->size);
+    if (size > options_.max_block_size) size = options_.max_block_size;
   } else {
-    size = start_block_size;
+    size = options_.start_block_size;
   }
-  // Verify that n + kHeaderSize won't overflow.
-  GOOGLE_CHECK_LE(n, std::numeric_limits<size_t>::max() - kHeaderSize);
-  size = std::max(size, kHeaderSize + n);
-
-  Block* b = reinterpret_cast<Block*>(options_.block_alloc(size));
-  b->pos = kHeaderSize + n;
+  // Verify that min_bytes + kHeaderSize won't overflow.
+  GOOGLE_CHECK_LE(min_bytes, std::numeric_limits<size_t>::max() - kHeaderSize);
+  size = std::max(size, kHeaderSize + min_bytes);
+
+  Block* b;
+  if (options_.block_allocator != NULL) {
+    // The allocator may hand out a larger block than requested; use all of it.
+    b = reinterpret_cast<Block*>(options_.block_allocator->AllocateBlock(&size));
+  } else {
+    b = reinterpret_cast<Block*>(options_.block_alloc(size));
+  }
+  b->next = last_block;
+  b->pos = kHeaderSize;
   b->size = size;
-  b->owner = me;
 #ifdef ADDRESS_SANITIZER
   // Poison the rest of the block for ASAN. It was unpoisoned by the underlying
   // malloc but it's not yet usable until we return it as part of an allocation.
   ASAN_POISON_MEMORY_REGION(
       reinterpret_cast<char*>(b) + b->pos, b->size - b->pos);
 #endif  // ADDRESS_SANITIZER
+  google::protobuf::internal::NoBarrier_AtomicIncrement(&space_allocated_, size);
+
+  // Monitor block allocation if needed.
+  if (GOOGLE_PREDICT_FALSE(hooks_cookie_ != NULL) &&
+      options_.on_arena_block_allocation != NULL) {
+    options_.on_arena_block_allocation(
+        size, last_block != NULL ? last_block->avail() : 0, hooks_cookie_);
+  }
   return b;
 }
 
-void Arena::AddBlock(Block* b) {
-  MutexLock l(&blocks_lock_);
-  AddBlockInternal(b);
+Arena::SerialArena* Arena::SerialArena::New(Block* b, void* owner,
+                                            Arena* arena) {
+  GOOGLE_DCHECK_EQ(kHeaderSize, b->pos);  // Should be a fresh block
+  GOOGLE_DCHECK_LE(kHeaderSize + kSerialArenaSize, b->size);
+  char* base = reinterpret_cast<char*>(b);
+#ifdef ADDRESS_SANITIZER
+  ASAN_UNPOISON_MEMORY_REGION(base + kHeaderSize, kSerialArenaSize);
+#endif  // ADDRESS_SANITIZER
+  SerialArena* serial = reinterpret_cast<SerialArena*>(base + kHeaderSize);
+  b->pos = kHeaderSize + kSerialArenaSize;
+  serial->arena_ = arena;
+  serial->owner_ = owner;
+  serial->head_ = b;
+  serial->cleanup_ = NULL;
+  serial->cleanup_ptr_ = NULL;
+  serial->cleanup_limit_ = NULL;
+  serial->next_ = NULL;
+  serial->ptr_ = base + b->pos;
+  serial->limit_ = base + b->size;
+  return serial;
+}
+
+void Arena::FreeBlock(Block* b) {
+#ifdef ADDRESS_SANITIZER
+  // This memory was provided by the underlying allocator as unpoisoned, so
+  // return it in an unpoisoned state.
+  ASAN_UNPOISON_MEMORY_REGION(reinterpret_cast<char*>(b), b->size);
+#endif  // ADDRESS_SANITIZER
+  if (options_.block_allocator != NULL) {
+    options_.block_allocator->FreeBlock(b, b->size);
+  } else {
+    options_.block_dealloc(b, b->size);
+  }
+}
+
+uint64 Arena::SerialArena::Free(SerialArena* serial, Arena* arena) {
+  uint64 space_allocated = 0;
+
+  // We have to be careful in this function, since we will be freeing the Block
+  // that contains this SerialArena. Be careful about accessing |serial|.
+  // Cleanup blocks first, as the head of their list lives in |serial|.
+  Block* b = serial->cleanup_;
+  while (b != NULL) {
+    Block* next = b->next;
+    space_allocated += (b->size);
+    arena->FreeBlock(b);
+    b = next;
+  }
+  b = serial->head_;
+  while (b != NULL) {
+    // This is inside the block we are freeing, so we need to read it now.
+    Block* next = b->next;
+    space_allocated += (b->size);
+    if (b != arena->initial_block_) {
+      arena->FreeBlock(b);
+    }
+    b = next;
+  }
+  return space_allocated;
+}
+
+void* Arena::SerialArena::AllocateAlignedFallback(size_t n) {
+  // Sync back the position of the block we are retiring.
+  head_->pos = static_cast<size_t>(ptr_ - reinterpret_cast<char*>(head_));
+  head_ = arena_->NewBlock(head_, n);
+  ptr_ = reinterpret_cast<char*>(head_) + head_->pos;
+  limit_ = reinterpret_cast<char*>(head_) + head_->size;
+  return AllocateAligned(n);
+}
+
+void Arena::SerialArena::AddCleanupFallback(void* elem,
+                                            void (*cleanup)(void*)) {
+  if (cleanup_ != NULL) {
+    // Sync back the position of the cleanup block we are retiring.
+    cleanup_->pos = static_cast<size_t>(
+        reinterpret_cast<char*>(cleanup_ptr_) -
+        reinterpret_cast<char*>(cleanup_));
+  }
+  // Cleanup blocks grow just like payload blocks do, and are sized so that
+  // they hold a whole number of CleanupNodes.
+  cleanup_ = arena_->NewBlock(cleanup_, sizeof(CleanupNode));
+#ifdef ADDRESS_SANITIZER
+  ASAN_UNPOISON_MEMORY_REGION(reinterpret_cast<char*>(cleanup_) + kHeaderSize,
+                              cleanup_->size - kHeaderSize);
+#endif  // ADDRESS_SANITIZER
+  cleanup_ptr_ = reinterpret_cast<CleanupNode*>(
+      reinterpret_cast<char*>(cleanup_) + kHeaderSize);
+  cleanup_limit_ =
+      cleanup_ptr_ + (cleanup_->size - kHeaderSize) / sizeof(CleanupNode);
+  AddCleanup(elem, cleanup);
+}
+
+void Arena::SerialArena::CleanupList() {
+  if (cleanup_ == NULL) return;
+  cleanup_->pos = static_cast<size_t>(reinterpret_cast<char*>(cleanup_ptr_) -
+                                      reinterpret_cast<char*>(cleanup_));
+  for (Block* b = cleanup_; b != NULL; b = b->next) {
+    CleanupNode* begin = reinterpret_cast<CleanupNode*>(
+        reinterpret_cast<char*>(b) + kHeaderSize);
+    CleanupNode* node = reinterpret_cast<CleanupNode*>(
+        reinterpret_cast<char*>(b) + b->pos);
+    while (node != begin) {
+      --node;
+      node->cleanup(node->elem);
+    }
+  }
 }
 
-void Arena::AddBlockInternal(Block* b) {
-  b->next = reinterpret_cast<Block*>(google::protobuf::internal::NoBarrier_Load(&blocks_));
-  google::protobuf::internal::Release_Store(&blocks_, reinterpret_cast<google::protobuf::internal::AtomicWord>(b));
-  if (b->avail() != 0) {
-    // Direct future allocations to this block.
-    google::protobuf::internal::Release_Store(&hint_, reinterpret_cast<google::protobuf::internal::AtomicWord>(b));
+uint64 Arena::SerialArena::SpaceUsed() const {
+  // The head block's pos is stale; ptr_ is authoritative for it.
+  uint64 space_used = ptr_ - reinterpret_cast<char*>(head_) - kHeaderSize;
+  for (Block* b = head_->next; b != NULL; b = b->next) {
+    space_used += (b->pos - kHeaderSize);
   }
-  space_allocated_ += b->size;
+  // Remove the overhead of the SerialArena itself.
+  space_used -= kSerialArenaSize;
+  if (cleanup_ != NULL) {
+    // Same for the cleanup blocks; cleanup_ptr_ is authoritative for the head.
+    space_used += reinterpret_cast<char*>(cleanup_ptr_) -
+                  reinterpret_cast<char*>(cleanup_) - kHeaderSize;
+    for (Block* b = cleanup_->next; b != NULL; b = b->next) {
+      space_used += (b->pos - kHeaderSize);
+    }
+  }
+  return space_used;
 }
 
 void Arena::AddListNode(void* elem, void (*cleanup)(void*)) {
-  Node* node = reinterpret_cast<Node*>(AllocateAligned(sizeof(Node)));
-  node->elem = elem;
-  node->cleanup = cleanup;
-  node->next = reinterpret_cast<Node*>(
-      google::protobuf::internal::NoBarrier_AtomicExchange(&cleanup_list_,
-            reinterpret_cast<google::protobuf::internal::AtomicWord>(node)));
+  GetSerialArena()->AddCleanup(elem, cleanup);
 }
 
 void* Arena::AllocateAligned(const std::type_info* allocated, size_t n) {
@@ -180,63 +302,47 @@ void* Arena::AllocateAligned(const std::type_info* allocated, size_t n) {
     options_.on_arena_allocation(allocated, n, hooks_cookie_);
   }
 
-  // If this thread already owns a block in this arena then try to use that.
-  // This fast path optimizes the case where multiple threads allocate from the
-  // same arena.
-  if (thread_cache().last_lifecycle_id_seen == lifecycle_id_ &&
-      thread_cache().last_block_used_ != NULL) {
-    if (thread_cache().last_block_used_->avail() < n) {
-      return SlowAlloc(n);
-    }
-    return AllocFromBlock(thread_cache().last_block_used_, n);
-  }
-
-  // Check whether we own the last accessed block on this arena.
-  // This fast path optimizes the case where a single thread uses multiple
-  // arenas.
-  void* me = &thread_cache();
-  Block* b = reinterpret_cast<Block*>(google::protobuf::internal::Acquire_Load(&hint_));
-  if (!b || b->owner != me || b->avail() < n) {
-    return SlowAlloc(n);
-  }
-  return AllocFromBlock(b, n);
+  return GetSerialArena()->AllocateAligned(n);
 }
 
-void* Arena::AllocFromBlock(Block* b, size_t n) {
-  size_t p = b->pos;
-  b->pos = p + n;
-#ifdef ADDRESS_SANITIZER
-  ASAN_UNPOISON_MEMORY_REGION(reinterpret_cast<char*>(b) + p, n);
-#endif  // ADDRESS_SANITIZER
-  return reinterpret_cast<char*>(b) + p;
-}
+Arena::SerialArena* Arena::GetSerialArenaFallback(void* me) {
+  // Look for this thread's SerialArena in our linked list.
+  SerialArena* serial = reinterpret_cast<SerialArena*>(
+      google::protobuf::internal::Acquire_Load(&threads_));
+  while (serial != NULL && serial->owner() != me) {
+    serial = serial->next();
+  }
 
-void* Arena::SlowAlloc(size_t n) {
-  void* me = &thread_cache();
-  Block* b = FindBlock(me);  // Find block owned by me.
-  // See if allocation fits in my latest block.
-  if (b != NULL && b->avail() >= n) {
-    SetThreadCacheBlock(b);
-    google::protobuf::internal::NoBarrier_Store(&hint_, reinterpret_cast<google::protobuf::internal::AtomicWord>(b));
-    return AllocFromBlock(b, n);
+  if (serial == NULL) {
+    // This thread doesn't have any SerialArena, which also means it doesn't
+    // have any blocks yet. So we'll allocate its first block now and publish
+    // the SerialArena living in it with a CAS on the list head.
+    Block* b = NewBlock(NULL, kSerialArenaSize);
+    serial = SerialArena::New(b, me, this);
+
+    google::protobuf::internal::AtomicWord head;
+    do {
+      head = google::protobuf::internal::NoBarrier_Load(&threads_);
+      serial->set_next(reinterpret_cast<SerialArena*>(head));
+    } while (google::protobuf::internal::Release_CompareAndSwap(
+                 &threads_, head,
+                 reinterpret_cast<google::protobuf::internal::AtomicWord>(serial)) != head);
   }
-  b = NewBlock(me, b, n, options_.start_block_size, options_.max_block_size);
-  AddBlock(b);
-  SetThreadCacheBlock(b);
-  return reinterpret_cast<char*>(b) + kHeaderSize;
+
+  CacheSerialArena(serial);
+  return serial;
 }
 
 uint64 Arena::SpaceAllocated() const {
-  MutexLock l(&blocks_lock_);
-  return space_allocated_;
+  return google::protobuf::internal::NoBarrier_Load(&space_allocated_);
 }
 
 uint64 Arena::SpaceUsed() const {
   uint64 space_used = 0;
-  Block* b = reinterpret_cast<Block*>(google::protobuf::internal::NoBarrier_Load(&blocks_));
-  while (b != NULL) {
-    space_used += (b->pos - kHeaderSize);
-    b = b->next;
+  SerialArena* serial = reinterpret_cast<SerialArena*>(
+      google::protobuf::internal::Acquire_Load(&threads_));
+  for (; serial != NULL; serial = serial->next()) {
+    space_used += serial->SpaceUsed();
   }
   return space_used;
 }
@@ -247,68 +353,129 @@ std::pair<uint64, uint64> Arena::SpaceAllocatedAndUsed() const {
 
 uint64 Arena::FreeBlocks() {
   uint64 space_allocated = 0;
-  Block* b = reinterpret_cast<Block*>(google::protobuf::internal::NoBarrier_Load(&blocks_));
-  Block* first_block = NULL;
-  while (b != NULL) {
-    space_allocated += (b->size);
-    Block* next = b->next;
-    if (next != NULL) {
-#ifdef ADDRESS_SANITIZER
-      // This memory was provided by the underlying allocator as unpoisoned, so
-      // return it in an unpoisoned state.
-      ASAN_UNPOISON_MEMORY_REGION(reinterpret_cast<char*>(b), b->size);
-#endif  // ADDRESS_SANITIZER
-      options_.block_dealloc(b, b->size);
-    } else {
-      if (owns_first_block_) {
-#ifdef ADDRESS_SANITIZER
-        // This memory was provided by the underlying allocator as unpoisoned,
-        // so return it in an unpoisoned state.
-        ASAN_UNPOISON_MEMORY_REGION(reinterpret_cast<char*>(b), b->size);
-#endif  // ADDRESS_SANITIZER
-        options_.block_dealloc(b, b->size);
-      } else {
-        // User passed in the first block, skip free'ing the memory.
-        first_block = b;
-      }
-    }
-    b = next;
+  // By omitting an Acquire barrier we ensure that any user code that doesn't
+  // properly synchronize Reset() or the destructor will throw a TSAN warning.
+  SerialArena* serial = reinterpret_cast<SerialArena*>(
+      google::protobuf::internal::NoBarrier_Load(&threads_));
+  while (serial != NULL) {
+    // This is inside a block we are freeing, so we need to read it now.
+    SerialArena* next = serial->next();
+    space_allocated += SerialArena::Free(serial, this);
+    // serial is dead now.
+    serial = next;
   }
-  blocks_ = 0;
-  hint_ = 0;
-  space_allocated_ = 0;
-  if (!owns_first_block_) {
+
+  google::protobuf::internal::NoBarrier_Store(&threads_, 0);
+  google::protobuf::internal::NoBarrier_Store(&hint_, 0);
+  google::protobuf::internal::NoBarrier_Store(&space_allocated_, 0);
+  if (initial_block_ != NULL) {
     // Make the first block that was passed in through ArenaOptions
     // available for reuse.
-    first_block->pos = kHeaderSize;
-    // Thread which calls Reset() owns the first block. This allows the
-    // single-threaded case to allocate on the first block without taking any
-    // locks.
-    first_block->owner = &thread_cache();
-    SetThreadCacheBlock(first_block);
-    AddBlockInternal(first_block);
+    InitInitialBlock();
   }
   return space_allocated;
 }
 
 void Arena::CleanupList() {
-  Node* head =
-      reinterpret_cast<Node*>(google::protobuf::internal::NoBarrier_Load(&cleanup_list_));
-  while (head != NULL) {
-    head->cleanup(head->elem);
-    head = head->next;
+  // By omitting an Acquire barrier we ensure that any user code that doesn't
+  // properly synchronize Reset() or the destructor will throw a TSAN warning.
+  SerialArena* serial = reinterpret_cast<SerialArena*>(
+      google::protobuf::internal::NoBarrier_Load(&threads_));
+  for (; serial != NULL; serial = serial->next()) {
+    serial->CleanupList();
   }
-  cleanup_list_ = 0;
 }
 
-Arena::Block* Arena::FindBlock(void* me) {
-  // TODO(sanjay): We might want to keep a separate list with one
-  // entry per thread.
-  Block* b = reinterpret_cast<Block*>(google::protobuf::internal::Acquire_Load(&blocks_));
-  while (b != NULL && b->owner != me) {
-    b = b->next;
+ArenaBlockAllocator::~ArenaBlockAllocator() {}
+
+const size_t ArenaBlockPool::kMinBlockSize;
+const size_t ArenaBlockPool::kMaxPooledBlockSize;
+const size_t ArenaBlockPool::kDefaultMaxCachedBytes;
+const int ArenaBlockPool::kNumSizeClasses;
+
+ArenaBlockPool::ArenaBlockPool(size_t max_cached_bytes)
+    : block_alloc_(&::operator new),
+      block_dealloc_(&internal::arena_free),
+      max_cached_bytes_(max_cached_bytes),
+      cached_bytes_(0) {
+  std::fill(free_lists_, free_lists_ + kNumSizeClasses,
+            static_cast<FreeListNode*>(NULL));
+}
+
+ArenaBlockPool::ArenaBlockPool(size_t max_cached_bytes,
+                               void* (*block_alloc)(size_t),
+                               void (*block_dealloc)(void*, size_t))
+    : block_alloc_(block_alloc),
+      block_dealloc_(block_dealloc),
+      max_cached_bytes_(max_cached_bytes),
+      cached_bytes_(0) {
+  std::fill(free_lists_, free_lists_ + kNumSizeClasses,
+            static_cast<FreeListNode*>(NULL));
+}
+
+ArenaBlockPool::~ArenaBlockPool() {
+  Clear();
+}
+
+int ArenaBlockPool::SizeClass(size_t size) {
+  size_t class_size = kMinBlockSize;
+  for (int i = 0; i < kNumSizeClasses; i++) {
+    if (size <= class_size) return i;
+    class_size <<= 1;
   }
-  return b;
+  return -1;
+}
+
+void* ArenaBlockPool::AllocateBlock(size_t* size) {
+  int size_class = SizeClass(*size);
+  if (size_class < 0) {
+    return block_alloc_(*size);
+  }
+  *size = kMinBlockSize << size_class;
+  {
+    MutexLock lock(&mutex_);
+    FreeListNode* block = free_lists_[size_class];
+    if (block != NULL) {
+      free_lists_[size_class] = block->next;
+      cached_bytes_ -= *size;
+      return block;
+    }
+  }
+  return block_alloc_(*size);
+}
+
+void ArenaBlockPool::FreeBlock(void* block, size_t size) {
+  int size_class = SizeClass(size);
+  // Only blocks we rounded to a class size may be put on a free list.
+  if (size_class >= 0 && size == (kMinBlockSize << size_class)) {
+    MutexLock lock(&mutex_);
+    if (cached_bytes_ + size <= max_cached_bytes_) {
+      FreeListNode* node = static_cast<FreeListNode*>(block);
+      node->next = free_lists_[size_class];
+      free_lists_[size_class] = node;
+      cached_bytes_ += size;
+      return;
+    }
+  }
+  block_dealloc_(block, size);
+}
+
+size_t ArenaBlockPool::cached_bytes() const {
+  MutexLock lock(&mutex_);
+  return cached_bytes_;
+}
+
+void ArenaBlockPool::Clear() {
+  MutexLock lock(&mutex_);
+  for (int i = 0; i < kNumSizeClasses; i++) {
+    size_t size = kMinBlockSize << i;
+    while (free_lists_[i] != NULL) {
+      FreeListNode* next = free_lists_[i]->next;
+      block_dealloc_(free_lists_[i], size);
+      free_lists_[i] = next;
+    }
+  }
+  cached_bytes_ = 0;
 }
 
 }  // namespace protobuf
@@ -51,6 +51,10 @@ using type_info = ::type_info;
 #include <typeinfo>
 #endif
 
+#ifdef ADDRESS_SANITIZER
+#include <sanitizer/asan_interface.h>
+#endif  // ADDRESS_SANITIZER
+
 #include <google/protobuf/stubs/atomic_sequence_num.h>
 #include <google/protobuf/stubs/atomicops.h>
 #include <google/protobuf/stubs/common.h>
@@ -90,6 +94,88 @@ inline void arena_free(void* object, size_t size) {
 
 }  // namespace internal
 
+// Interface for supplying the memory blocks an Arena carves its allocations
+// out of. Setting ArenaOptions::block_allocator replaces the block_alloc and
+// block_dealloc function pointers, and lets the provider round block sizes up
+// (e.g. to reuse blocks of a few fixed sizes) since the arena asks for the
+// block size it actually got. Implementations must be thread-safe if arenas
+// using them are allocated from by more than one thread, and must outlive
+// every arena using them.
+class LIBPROTOBUF_EXPORT ArenaBlockAllocator {
+ public:
+  virtual ~ArenaBlockAllocator();
+
+  // Returns a block of at least |*size| bytes, aligned to at least 8 bytes,
+  // and stores the usable size of the returned block in |*size|.
+  virtual void* AllocateBlock(size_t* size) = 0;
+
+  // Takes back a block obtained from AllocateBlock(). |size| is the size that
+  // AllocateBlock() reported for it.
+  virtual void FreeBlock(void* block, size_t size) = 0;
+};
+
+// An ArenaBlockAllocator that keeps freed blocks for reuse instead of
+// returning them to the system, so that arenas which are repeatedly created
+// and destroyed (or Reset()) -- e.g. one arena per RPC -- stop paying for
+// malloc/free on every request once the pool is warm. Block sizes are rounded
+// up to powers of two between kMinBlockSize and kMaxPooledBlockSize; larger
+// blocks bypass the pool.
+//
+// The pool is thread-safe. It only takes its mutex when an arena needs a new
+// block or releases its blocks, but giving each worker thread its own pool
+// keeps even that uncontended.
+//
+// Fresh blocks are obtained from, and surplus blocks returned to, the
+// block_alloc/block_dealloc pair passed to the constructor (::operator new and
+// delete by default), which can be used to back the pool with e.g. huge-page
+// slabs.
+class LIBPROTOBUF_EXPORT ArenaBlockPool : public ArenaBlockAllocator {
+ public:
+  static const size_t kMinBlockSize = 256;
+  static const size_t kMaxPooledBlockSize = 1 << 20;
+  static const size_t kDefaultMaxCachedBytes = 16 << 20;
+
+  // |max_cached_bytes| bounds the total size of the blocks kept for reuse;
+  // blocks freed while the pool is full are released immediately.
+  explicit ArenaBlockPool(size_t max_cached_bytes = kDefaultMaxCachedBytes);
+  ArenaBlockPool(size_t max_cached_bytes, void* (*block_alloc)(size_t),
+                 void (*block_dealloc)(void*, size_t));
+  // Releases all cached blocks. Arenas using the pool must be gone by now.
+  virtual ~ArenaBlockPool();
+
+  virtual void* AllocateBlock(size_t* size);
+  virtual void FreeBlock(void* block, size_t size);
+
+  // Returns the total size of the blocks currently cached for reuse.
+  size_t cached_bytes() const;
+
+  // Releases all cached blocks.
+  void Clear();
+
+ private:
+  // One free list per power-of-two size from kMinBlockSize up to and
+  // including kMaxPooledBlockSize.
+  static const int kNumSizeClasses = 13;
+
+  struct FreeListNode {
+    FreeListNode* next;
+  };
+
+  // Returns the size class holding blocks of at least |size| bytes, or -1 if
+  // such blocks are not pooled.
+  static int SizeClass(size_t size);
+
+  void* (*block_alloc_)(size_t);
+  void (*block_dealloc_)(void*, size_t);
+  const size_t max_cached_bytes_;
+
+  mutable Mutex mutex_;
+  size_t cached_bytes_;                        // GUARDED_BY(mutex_)
+  FreeListNode* free_lists_[kNumSizeClasses];  // GUARDED_BY(mutex_)
+
+  GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(ArenaBlockPool);
+};
+
 // ArenaOptions provides optional additional parameters to arena construction
 // that control its block-allocation behavior.
 struct ArenaOptions {
@@ -123,6 +209,12 @@ struct ArenaOptions {
   // calls free.
   void (*block_dealloc)(void*, size_t);
 
+  // If non-NULL, blocks are obtained from and returned to this allocator
+  // instead of block_alloc/block_dealloc; see ArenaBlockAllocator above. It
+  // must outlive the arena. The initial block, if any, is still owned by the
+  // creator of the arena and never passed to the allocator.
+  ArenaBlockAllocator* block_allocator;
+
   // Hooks for adding external functionality such as user-specific metrics
   // collection, specific debugging abilities, etc.
   // Init hook may return a pointer to a cookie to be stored in the arena.
@@ -144,6 +236,13 @@ struct ArenaOptions {
   void (*on_arena_allocation)(const std::type_info* allocated_type,
       uint64 alloc_size, void* cookie);
 
+  // Called whenever the arena obtains a new block, with the size of the block
+  // and the number of bytes left unused at the end of the block it replaces
+  // (0 if this is the first block of the allocating thread). Like the other
+  // hooks, it is only called if on_arena_init returned a non-NULL cookie.
+  void (*on_arena_block_allocation)(uint64 block_size,
+      uint64 wasted_tail_bytes, void* cookie);
+
   ArenaOptions()
       : start_block_size(kDefaultStartBlockSize),
         max_block_size(kDefaultMaxBlockSize),
@@ -151,10 +250,12 @@ struct ArenaOptions {
         initial_block_size(0),
         block_alloc(&::operator new),
         block_dealloc(&internal::arena_free),
+        block_allocator(NULL),
         on_arena_init(NULL),
         on_arena_reset(NULL),
         on_arena_destruction(NULL),
-        on_arena_allocation(NULL) {}
+        on_arena_allocation(NULL),
+        on_arena_block_allocation(NULL) {}
 
  private:
   // Constants define default starting block size and max block size for
@@ -547,9 +648,7 @@ class LIBPROTOBUF_EXPORT Arena {
   // Blocks are variable length malloc-ed objects.  The following structure
   // describes the common header for all blocks.
   struct Block {
-    void* owner;   // &ThreadCache of thread that owns this block, or
-                   // &this->owner if not yet owned by a thread.
-    Block* next;   // Next block in arena (may have different owner)
+    Block* next;   // Next block owned by the same SerialArena.
     // ((char*) &block) + pos is next available byte. It is always
     // aligned at a multiple of 8 bytes.
     size_t pos;
@@ -558,19 +657,108 @@ class LIBPROTOBUF_EXPORT Arena {
     // data follows
   };
 
+  // CleanupNode contains the ptr of the object to be cleaned up and the
+  // associated cleanup function ptr. CleanupNodes are not allocated among the
+  // payload: each SerialArena keeps them in dedicated cleanup blocks, which
+  // are Blocks holding a packed array of CleanupNodes and are obtained like
+  // any other block, so that running the cleanups is a linear scan.
+  struct CleanupNode {
+    void* elem;              // Pointer to the object to be cleaned up.
+    void (*cleanup)(void*);  // Function pointer to the destructor or deleter.
+  };
+
+  // A thread-unsafe arena that is only ever used by the thread that owns it.
+  // Every thread allocating from an Arena gets its own SerialArena, so the
+  // allocation fast path needs neither locks nor atomic read-modify-writes.
+  // The SerialArena itself lives at the start of its first block, and all
+  // SerialArenas of an Arena are chained into a singly linked list rooted at
+  // Arena::threads_ which only ever grows (until Reset()).
+  class SerialArena {
+   public:
+    // Creates a new SerialArena inside the (fresh) block |b| and returns it.
+    static SerialArena* New(Block* b, void* owner, Arena* arena);
+
+    // Destroys |serial|, returning all of its blocks except the initial block
+    // to |arena|'s block allocator. Returns the total size of the blocks. The
+    // SerialArena itself is dead after this call.
+    static uint64 Free(SerialArena* serial, Arena* arena);
+
+    // Calls the cleanup functions registered with AddCleanup(), most recent
+    // first.
+    void CleanupList();
+    uint64 SpaceUsed() const;
+
+    GOOGLE_ATTRIBUTE_ALWAYS_INLINE void* AllocateAligned(size_t n) {
+      if (GOOGLE_PREDICT_FALSE(static_cast<size_t>(limit_ - ptr_) < n)) {
+        return AllocateAlignedFallback(n);
+      }
+      void* ret = ptr_;
+      ptr_ += n;
+#ifdef ADDRESS_SANITIZER
+      ASAN_UNPOISON_MEMORY_REGION(ret, n);
+#endif  // ADDRESS_SANITIZER
+      return ret;
+    }
+
+    GOOGLE_ATTRIBUTE_ALWAYS_INLINE void AddCleanup(void* elem,
+                                            void (*cleanup)(void*)) {
+      if (GOOGLE_PREDICT_FALSE(cleanup_ptr_ == cleanup_limit_)) {
+        AddCleanupFallback(elem, cleanup);
+        return;
+      }
+      cleanup_ptr_->elem = elem;
+      cleanup_ptr_->cleanup = cleanup;
+      cleanup_ptr_++;
+    }
+
+    void* owner() const { return owner_; }
+    SerialArena* next() const { return next_; }
+    void set_next(SerialArena* next) { next_ = next; }
+
+   private:
+    void* AllocateAlignedFallback(size_t n);
+    void AddCleanupFallback(void* elem, void (*cleanup)(void*));
+
+    Arena* arena_;        // Containing arena.
+    void* owner_;         // &ThreadCache of the owning thread.
+    Block* head_;         // Most recent block; older ones via Block::next.
+    Block* cleanup_;      // Most recent cleanup block, or NULL.
+    SerialArena* next_;   // Next SerialArena of the same Arena.
+
+    // Next byte to allocate from and end of the available space in head_.
+    // head_->pos is only brought up to date when head_ is retired, to keep
+    // the fast path down to a compare and an add.
+    char* ptr_;
+    char* limit_;
+
+    // Same as above for the CleanupNodes of cleanup_.
+    CleanupNode* cleanup_ptr_;
+    CleanupNode* cleanup_limit_;
+  };
+
   template<typename Type> friend class ::google::protobuf::internal::GenericTypeHandler;
   friend class MockArena;              // For unit-testing.
   friend class internal::ArenaString;  // For AllocateAligned.
   friend class internal::LazyField;    // For CreateMaybeMessage.
 
   struct ThreadCache {
+#if defined(GOOGLE_PROTOBUF_NO_THREADLOCAL)
+    // If we are using the ThreadLocalStorage class to store the ThreadCache,
+    // then the ThreadCache's default constructor has to be responsible for
+    // initializing it.
+    ThreadCache() : last_lifecycle_id_seen(-1), last_serial_arena(NULL) {}
+#endif
+
     // The ThreadCache is considered valid as long as this matches the
     // lifecycle_id of the arena being used.
     int64 last_lifecycle_id_seen;
-    Block* last_block_used_;
+    SerialArena* last_serial_arena;
   };
 
-  static const size_t kHeaderSize = sizeof(Block);
+  // Both sizes are rounded up to a multiple of 8 to preserve the invariant
+  // that allocation positions are always 8-byte aligned.
+  static const size_t kHeaderSize = (sizeof(Block) + 7) & -8;
+  static const size_t kSerialArenaSize = (sizeof(SerialArena) + 7) & -8;
   static google::protobuf::internal::SequenceNumber lifecycle_id_generator_;
 #if defined(GOOGLE_PROTOBUF_NO_THREADLOCAL)
   // Android ndk does not support GOOGLE_THREAD_LOCAL keyword so we use a custom thread
@@ -885,55 +1073,76 @@ class LIBPROTOBUF_EXPORT Arena {
   }
 
   void Init();
+  // Turns the user-provided initial block into the first block of a
+  // SerialArena owned by the calling thread.
+  void InitInitialBlock();
 
   // Free all blocks and return the total space used which is the sums of sizes
   // of the all the allocated blocks.
   uint64 FreeBlocks();
 
-  // Add object pointer and cleanup function pointer to the list.
-  // TODO(rohananil, cfallin): We could pass in a sub-arena into this method
-  // to avoid polluting blocks of this arena with list nodes. This would help in
-  // mixed mode (where many protobufs have cc_enable_arenas=false), and is an
-  // alternative to a chunked linked-list, but with extra overhead of *next.
+  // Add object pointer and cleanup function pointer to the list of the calling
+  // thread's SerialArena.
   void AddListNode(void* elem, void (*cleanup)(void*));
   // Delete or Destruct all objects owned by the arena.
   void CleanupList();
   uint64 ResetInternal();
 
-  inline void SetThreadCacheBlock(Block* block) {
-    thread_cache().last_block_used_ = block;
+  // Returns the calling thread's SerialArena, creating it if needed.
+  GOOGLE_ATTRIBUTE_ALWAYS_INLINE SerialArena* GetSerialArena() {
+    SerialArena* serial;
+    if (GOOGLE_PREDICT_TRUE(GetSerialArenaFast(&serial))) {
+      return serial;
+    }
+    return GetSerialArenaFallback(&thread_cache());
+  }
+
+  GOOGLE_ATTRIBUTE_ALWAYS_INLINE bool GetSerialArenaFast(SerialArena** serial) {
+    // If this thread already owns a SerialArena in this arena then try to use
+    // that. This fast path optimizes the case where multiple threads allocate
+    // from the same arena.
+    ThreadCache* tc = &thread_cache();
+    if (GOOGLE_PREDICT_TRUE(tc->last_lifecycle_id_seen == lifecycle_id_)) {
+      *serial = tc->last_serial_arena;
+      return true;
+    }
+
+    // Check whether we own the last accessed SerialArena on this arena. This
+    // fast path optimizes the case where a single thread uses multiple arenas.
+    SerialArena* hint = reinterpret_cast<SerialArena*>(
+        google::protobuf::internal::Acquire_Load(&hint_));
+    if (GOOGLE_PREDICT_TRUE(hint != NULL && hint->owner() == tc)) {
+      *serial = hint;
+      return true;
+    }
+    return false;
+  }
+
+  SerialArena* GetSerialArenaFallback(void* me);
+
+  inline void CacheSerialArena(SerialArena* serial) {
+    thread_cache().last_serial_arena = serial;
     thread_cache().last_lifecycle_id_seen = lifecycle_id_;
+    google::protobuf::internal::Release_Store(
+        &hint_, reinterpret_cast<google::protobuf::internal::AtomicWord>(serial));
   }
 
+  // Allocates a new block for a SerialArena whose current head is
+  // |last_block| (NULL for its first block) with room for at least |min_bytes|
+  // after the header.
+  Block* NewBlock(Block* last_block, size_t min_bytes);
+  // Gives a block allocated by NewBlock() back to where it came from.
+  void FreeBlock(Block* b);
+
   int64 lifecycle_id_;  // Unique for each arena. Changes on Reset().
 
-  google::protobuf::internal::AtomicWord blocks_;       // Head of linked list of all allocated blocks
-  google::protobuf::internal::AtomicWord hint_;         // Fast thread-local block access
-  uint64 space_allocated_;  // Sum of sizes of all allocated blocks.
+  google::protobuf::internal::AtomicWord threads_;          // Head of linked list of SerialArenas
+  google::protobuf::internal::AtomicWord hint_;             // Fast thread-local SerialArena access
+  google::protobuf::internal::AtomicWord space_allocated_;  // Sum of sizes of all allocated blocks.
 
-  // Node contains the ptr of the object to be cleaned up and the associated
-  // cleanup function ptr.
-  struct Node {
-    void* elem;              // Pointer to the object to be cleaned up.
-    void (*cleanup)(void*);  // Function pointer to the destructor or deleter.
-    Node* next;              // Next node in the list.
-  };
+  Block* initial_block_;     // If non-NULL, the block passed in through
+                             // ArenaOptions, which the arena does not own.
 
-  google::protobuf::internal::AtomicWord cleanup_list_;  // Head of a linked list of nodes containing object
-                             // ptrs and cleanup methods.
-
-  bool owns_first_block_;    // Indicates that arena owns the first block
-  mutable Mutex blocks_lock_;
-
-  void AddBlock(Block* b);
-  // Access must be synchronized, either by blocks_lock_ or by being called from
-  // Init()/Reset().
-  void AddBlockInternal(Block* b);
-  void* SlowAlloc(size_t n);
-  Block* FindBlock(void* me);
-  Block* NewBlock(void* me, Block* my_last_block, size_t n,
-                  size_t start_block_size, size_t max_block_size);
-  static void* AllocFromBlock(Block* b, size_t n);
   template <typename Key, typename T>
   friend class Map;
 
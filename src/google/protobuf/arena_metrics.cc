@@ -0,0 +1,210 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// https://developers.google.com/protocol-buffers/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <google/protobuf/arena_metrics.h>
+
+#include <algorithm>
+#include <map>
+
+#include <google/protobuf/stubs/atomicops.h>
+#include <google/protobuf/stubs/mutex.h>
+#include <google/protobuf/stubs/once.h>
+
+namespace google {
+namespace protobuf {
+
+namespace {
+
+// Everything recorded by ArenaMetrics. A pointer to it doubles as the hooks
+// cookie, which must be non-NULL for the arena to call the hooks at all.
+struct MetricsState {
+  Mutex mutex;
+  ArenaMetrics::Stats stats;  // Without |types|, which lives below.
+  std::map<const std::type_info*, ArenaMetrics::TypeStats> types;
+  uint64 lifetimes;  // Number of on_arena_reset calls.
+
+  MetricsState() : lifetimes(0) {}
+};
+
+MetricsState* metrics_state = NULL;
+GOOGLE_PROTOBUF_DECLARE_ONCE(metrics_state_once);
+
+void DeleteMetricsState() {
+  delete metrics_state;
+  metrics_state = NULL;
+}
+
+void InitMetricsState() {
+  metrics_state = new MetricsState;
+  internal::OnShutdown(&DeleteMetricsState);
+}
+
+MetricsState* GetMetricsState() {
+  ::google::protobuf::GoogleOnceInit(&metrics_state_once, &InitMetricsState);
+  return metrics_state;
+}
+
+// The sampling period is global, but every thread counts down to its next
+// sample on its own so that the allocation hook never touches shared memory
+// unless it records a sample.
+internal::Atomic32 sampling_period = 1;
+
+#if defined(GOOGLE_PROTOBUF_NO_THREADLOCAL)
+int& SampleCountdown() {
+  static internal::ThreadLocalStorage<int>* countdown =
+      new internal::ThreadLocalStorage<int>();
+  return *countdown->Get();
+}
+#else
+GOOGLE_THREAD_LOCAL int sample_countdown = 0;
+int& SampleCountdown() { return sample_countdown; }
+#endif
+
+int LifetimeBucket(uint64 space_allocated) {
+  int bucket = 0;
+  uint64 limit = ArenaMetrics::kHistogramBase;
+  while (bucket < ArenaMetrics::kNumBuckets - 1 && space_allocated >= limit) {
+    bucket++;
+    limit <<= 1;
+  }
+  return bucket;
+}
+
+bool ByDecreasingBytes(const ArenaMetrics::TypeStats& a,
+                       const ArenaMetrics::TypeStats& b) {
+  return a.bytes > b.bytes;
+}
+
+}  // namespace
+
+const int ArenaMetrics::kNumBuckets;
+const uint64 ArenaMetrics::kHistogramBase;
+
+ArenaMetrics::Stats::Stats()
+    : arenas_created(0),
+      arenas_destroyed(0),
+      resets(0),
+      blocks_allocated(0),
+      block_bytes(0),
+      wasted_tail_bytes(0),
+      allocations(0),
+      allocated_bytes(0) {
+  std::fill(lifetime_space_histogram, lifetime_space_histogram + kNumBuckets,
+            0);
+}
+
+void ArenaMetrics::InstallHooks(ArenaOptions* options) {
+  options->on_arena_init = &OnArenaInit;
+  options->on_arena_allocation = &OnArenaAllocation;
+  options->on_arena_block_allocation = &OnArenaBlockAllocation;
+  options->on_arena_reset = &OnArenaReset;
+  options->on_arena_destruction = &OnArenaDestruction;
+}
+
+void ArenaMetrics::SetSamplingPeriod(int period) {
+  GOOGLE_CHECK_GE(period, 1);
+  internal::NoBarrier_Store(&sampling_period, period);
+}
+
+ArenaMetrics::Stats ArenaMetrics::GetStats() {
+  MetricsState* state = GetMetricsState();
+  MutexLock lock(&state->mutex);
+  Stats stats = state->stats;
+  stats.resets = state->lifetimes - stats.arenas_destroyed;
+  for (std::map<const std::type_info*, TypeStats>::const_iterator it =
+           state->types.begin();
+       it != state->types.end(); ++it) {
+    stats.types.push_back(it->second);
+  }
+  std::stable_sort(stats.types.begin(), stats.types.end(), ByDecreasingBytes);
+  return stats;
+}
+
+void ArenaMetrics::ResetStats() {
+  MetricsState* state = GetMetricsState();
+  MutexLock lock(&state->mutex);
+  state->stats = Stats();
+  state->types.clear();
+  state->lifetimes = 0;
+}
+
+void* ArenaMetrics::OnArenaInit(Arena* arena) {
+  MetricsState* state = GetMetricsState();
+  MutexLock lock(&state->mutex);
+  state->stats.arenas_created++;
+  return state;
+}
+
+void ArenaMetrics::OnArenaAllocation(const std::type_info* allocated_type,
+                                     uint64 alloc_size, void* cookie) {
+  int& countdown = SampleCountdown();
+  if (GOOGLE_PREDICT_TRUE(--countdown > 0)) return;
+  int period = internal::NoBarrier_Load(&sampling_period);
+  countdown = period;
+
+  MetricsState* state = static_cast<MetricsState*>(cookie);
+  MutexLock lock(&state->mutex);
+  TypeStats& type_stats = state->types[allocated_type];
+  type_stats.type = allocated_type;
+  type_stats.allocations += period;
+  type_stats.bytes += alloc_size * period;
+  state->stats.allocations += period;
+  state->stats.allocated_bytes += alloc_size * period;
+}
+
+void ArenaMetrics::OnArenaBlockAllocation(uint64 block_size,
+                                          uint64 wasted_tail_bytes,
+                                          void* cookie) {
+  MetricsState* state = static_cast<MetricsState*>(cookie);
+  MutexLock lock(&state->mutex);
+  state->stats.blocks_allocated++;
+  state->stats.block_bytes += block_size;
+  state->stats.wasted_tail_bytes += wasted_tail_bytes;
+}
+
+void ArenaMetrics::OnArenaReset(Arena* arena, void* cookie,
+                                uint64 space_allocated) {
+  // Also called right before OnArenaDestruction(), so this is where every
+  // arena lifetime ends.
+  MetricsState* state = static_cast<MetricsState*>(cookie);
+  MutexLock lock(&state->mutex);
+  state->lifetimes++;
+  state->stats.lifetime_space_histogram[LifetimeBucket(space_allocated)]++;
+}
+
+void ArenaMetrics::OnArenaDestruction(Arena* arena, void* cookie,
+                                      uint64 space_allocated) {
+  MetricsState* state = static_cast<MetricsState*>(cookie);
+  MutexLock lock(&state->mutex);
+  state->stats.arenas_destroyed++;
+}
+
+}  // namespace protobuf
+}  // namespace google
@@ -0,0 +1,132 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// https://developers.google.com/protocol-buffers/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+// ArenaMetrics is a ready-made, process-wide collector of arena allocation
+// statistics built on the ArenaOptions hooks. It is meant to answer questions
+// like "which types dominate our arenas", "how large do our per-request arenas
+// get" and "how much do we lose to block tails" with data, e.g. to choose
+// start_block_size and max_block_size per workload:
+//
+//   ArenaOptions options;
+//   ArenaMetrics::InstallHooks(&options);
+//   ...  // create arenas with |options| and use them
+//   ArenaMetrics::Stats stats = ArenaMetrics::GetStats();
+//
+// Per-type accounting is sampled per thread (see SetSamplingPeriod()) so that
+// the cost on the allocation path is a thread-local countdown; everything else
+// is recorded on block allocation, Reset() and destruction only.
+
+#ifndef GOOGLE_PROTOBUF_ARENA_METRICS_H__
+#define GOOGLE_PROTOBUF_ARENA_METRICS_H__
+
+#include <typeinfo>
+#include <vector>
+
+#include <google/protobuf/arena.h>
+#include <google/protobuf/stubs/common.h>
+
+namespace google {
+namespace protobuf {
+
+class LIBPROTOBUF_EXPORT ArenaMetrics {
+ public:
+  // The lifetime histogram has one bucket per power of two of the space an
+  // arena had allocated when it was reset or destroyed: bucket 0 counts
+  // lifetimes below kHistogramBase bytes, bucket i (for 0 < i < kNumBuckets-1)
+  // those in [kHistogramBase << (i-1), kHistogramBase << i), and the last
+  // bucket everything above.
+  static const int kNumBuckets = 16;
+  static const uint64 kHistogramBase = 256;
+
+  // Allocations of one type. |type| is NULL for untyped allocations (strings,
+  // repeated field storage, ...) and when RTTI is disabled. Counts are
+  // estimates scaled by the sampling period.
+  struct TypeStats {
+    const std::type_info* type;
+    uint64 allocations;
+    uint64 bytes;
+  };
+
+  struct Stats {
+    Stats();
+
+    uint64 arenas_created;
+    uint64 arenas_destroyed;
+    uint64 resets;
+
+    // Blocks obtained by arenas, their total size, and the bytes left unused
+    // at the end of a block when an arena moved on to a new one.
+    uint64 blocks_allocated;
+    uint64 block_bytes;
+    uint64 wasted_tail_bytes;
+
+    // Estimated totals over all types.
+    uint64 allocations;
+    uint64 allocated_bytes;
+
+    // Space allocated per arena lifetime (construction or Reset() until the
+    // next Reset() or destruction); see kNumBuckets.
+    uint64 lifetime_space_histogram[kNumBuckets];
+
+    // Sorted by decreasing |bytes|.
+    std::vector<TypeStats> types;
+  };
+
+  // Points the hooks of |options| at the collector, replacing any hooks that
+  // were set. Arenas created with |options| afterwards report to it.
+  static void InstallHooks(ArenaOptions* options);
+
+  // Record one out of every |period| allocations on each thread (1 records
+  // all of them). Defaults to 1.
+  static void SetSamplingPeriod(int period);
+
+  // Returns a snapshot of everything recorded so far.
+  static Stats GetStats();
+
+  // Discards everything recorded so far.
+  static void ResetStats();
+
+ private:
+  static void* OnArenaInit(Arena* arena);
+  static void OnArenaAllocation(const std::type_info* allocated_type,
+                                uint64 alloc_size, void* cookie);
+  static void OnArenaBlockAllocation(uint64 block_size,
+                                     uint64 wasted_tail_bytes, void* cookie);
+  static void OnArenaReset(Arena* arena, void* cookie, uint64 space_allocated);
+  static void OnArenaDestruction(Arena* arena, void* cookie,
+                                 uint64 space_allocated);
+
+  GOOGLE_DISALLOW_IMPLICIT_CONSTRUCTORS(ArenaMetrics);
+};
+
+}  // namespace protobuf
+
+}  // namespace google
+#endif  // GOOGLE_PROTOBUF_ARENA_METRICS_H__
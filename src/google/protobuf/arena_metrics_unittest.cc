@@ -0,0 +1,162 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// https://developers.google.com/protocol-buffers/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <google/protobuf/arena_metrics.h>
+
+#include <string>
+#include <vector>
+
+#include <google/protobuf/arena.h>
+#include <google/protobuf/test_util.h>
+#include <google/protobuf/unittest.pb.h>
+#include <gtest/gtest.h>
+
+namespace google {
+namespace protobuf {
+namespace {
+
+using protobuf_unittest::TestAllTypes;
+
+class ArenaMetricsTest : public testing::Test {
+ protected:
+  virtual void SetUp() {
+    ArenaMetrics::SetSamplingPeriod(1);
+    ArenaMetrics::ResetStats();
+    ArenaMetrics::InstallHooks(&options_);
+  }
+  virtual void TearDown() {
+    ArenaMetrics::SetSamplingPeriod(1);
+  }
+
+  const ArenaMetrics::TypeStats* FindType(const ArenaMetrics::Stats& stats,
+                                          const std::type_info* type) {
+    for (int i = 0; i < stats.types.size(); i++) {
+      if (stats.types[i].type == type) return &stats.types[i];
+    }
+    return NULL;
+  }
+
+  ArenaOptions options_;
+};
+
+TEST_F(ArenaMetricsTest, CountsArenaLifetimes) {
+  {
+    Arena arena(options_);
+    Arena::CreateArray<char>(&arena, 100);
+    arena.Reset();
+    arena.Reset();
+  }
+  Arena other(options_);
+
+  ArenaMetrics::Stats stats = ArenaMetrics::GetStats();
+  EXPECT_EQ(2, stats.arenas_created);
+  EXPECT_EQ(1, stats.arenas_destroyed);
+  EXPECT_EQ(2, stats.resets);
+
+  // Three lifetimes ended: one with a block of 256 bytes, and two without any
+  // blocks.
+  EXPECT_EQ(2, stats.lifetime_space_histogram[0]);
+  EXPECT_EQ(1, stats.lifetime_space_histogram[1]);
+}
+
+TEST_F(ArenaMetricsTest, CountsAllocationsByType) {
+  Arena arena(options_);
+  for (int i = 0; i < 10; i++) {
+    Arena::Create<int64>(&arena);
+  }
+  Arena::CreateMessage<TestAllTypes>(&arena);
+
+  ArenaMetrics::Stats stats = ArenaMetrics::GetStats();
+#ifndef GOOGLE_PROTOBUF_NO_RTTI
+  const ArenaMetrics::TypeStats* int64_stats = FindType(stats, &typeid(int64));
+  ASSERT_TRUE(int64_stats != NULL);
+  EXPECT_EQ(10, int64_stats->allocations);
+  EXPECT_EQ(80, int64_stats->bytes);
+
+  const ArenaMetrics::TypeStats* message_stats =
+      FindType(stats, &typeid(TestAllTypes));
+  ASSERT_TRUE(message_stats != NULL);
+  EXPECT_EQ(1, message_stats->allocations);
+  EXPECT_LE(sizeof(TestAllTypes), message_stats->bytes);
+  // The message is the largest type allocated.
+  EXPECT_EQ(&typeid(TestAllTypes), stats.types[0].type);
+#endif  // !GOOGLE_PROTOBUF_NO_RTTI
+  EXPECT_LE(11, stats.allocations);
+  EXPECT_LE(80 + sizeof(TestAllTypes), stats.allocated_bytes);
+}
+
+TEST_F(ArenaMetricsTest, SamplesAllocations) {
+  ArenaMetrics::SetSamplingPeriod(10);
+  Arena arena(options_);
+  for (int i = 0; i < 1000; i++) {
+    Arena::Create<int64>(&arena);
+  }
+
+  // Sampled counts are scaled back up, so they are only off by up to one
+  // sampling period.
+  ArenaMetrics::Stats stats = ArenaMetrics::GetStats();
+  EXPECT_LE(990, stats.allocations);
+  EXPECT_GE(1010, stats.allocations);
+  EXPECT_LE(990 * 8, stats.allocated_bytes);
+  EXPECT_GE(1010 * 8, stats.allocated_bytes);
+}
+
+TEST_F(ArenaMetricsTest, CountsBlocksAndWastedTails) {
+  options_.start_block_size = 256;
+  options_.max_block_size = 256;
+  Arena arena(options_);
+  // The first allocation creates the thread's first block, which also holds
+  // arena bookkeeping; the second does not fit in what is left of it.
+  Arena::CreateArray<char>(&arena, 128);
+  uint64 used_of_first_block = arena.SpaceUsed();
+  Arena::CreateArray<char>(&arena, 200);
+
+  ArenaMetrics::Stats stats = ArenaMetrics::GetStats();
+  EXPECT_EQ(2, stats.blocks_allocated);
+  EXPECT_EQ(arena.SpaceAllocated(), stats.block_bytes);
+  EXPECT_LT(0, stats.wasted_tail_bytes);
+  EXPECT_GT(256 - used_of_first_block, stats.wasted_tail_bytes);
+}
+
+TEST_F(ArenaMetricsTest, InstallHooksMakesArenasReport) {
+  ArenaOptions plain;
+  {
+    Arena arena(plain);
+    Arena::CreateMessage<TestAllTypes>(&arena);
+  }
+  ArenaMetrics::Stats stats = ArenaMetrics::GetStats();
+  EXPECT_EQ(0, stats.arenas_created);
+  EXPECT_EQ(0, stats.allocations);
+  EXPECT_TRUE(stats.types.empty());
+}
+
+}  // namespace
+}  // namespace protobuf
+}  // namespace google
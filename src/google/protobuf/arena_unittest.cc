@@ -37,6 +37,9 @@
 #include <google/protobuf/stubs/shared_ptr.h>
 #endif
 #include <string>
+#if LANG_CXX11
+#include <thread>
+#endif
 #include <typeinfo>
 #include <vector>
 
@@ -267,10 +270,10 @@ TEST(ArenaTest, CreateWithMoveArguments) {
 #endif
 
 TEST(ArenaTest, InitialBlockTooSmall) {
-  // Construct a small (64 byte) initial block of memory to be used by the
+  // Construct a small (96 byte) initial block of memory to be used by the
   // arena allocator; then, allocate an object which will not fit in the
   // initial block.
-  std::vector<char> arena_block(64);
+  std::vector<char> arena_block(96);
   ArenaOptions options;
   options.initial_block = &arena_block[0];
   options.initial_block_size = arena_block.size();
@@ -1299,12 +1302,12 @@ TEST(ArenaTest, SpaceAllocated_and_Used) {
   options.initial_block_size = 0;
   Arena arena_3(options);
   EXPECT_EQ(0, arena_3.SpaceUsed());
-  ::google::protobuf::Arena::CreateArray<char>(&arena_3, 190);
+  ::google::protobuf::Arena::CreateArray<char>(&arena_3, 160);
   EXPECT_EQ(256, arena_3.SpaceAllocated());
-  EXPECT_EQ(Align8(190), arena_3.SpaceUsed());
+  EXPECT_EQ(Align8(160), arena_3.SpaceUsed());
   ::google::protobuf::Arena::CreateArray<char>(&arena_3, 70);
   EXPECT_EQ(256 + 512, arena_3.SpaceAllocated());
-  EXPECT_EQ(Align8(190) + Align8(70), arena_3.SpaceUsed());
+  EXPECT_EQ(Align8(160) + Align8(70), arena_3.SpaceUsed());
   EXPECT_EQ(256 + 512, arena_3.Reset());
 }
 
@@ -1332,6 +1335,201 @@ TEST(ArenaTest, BlockSizeSmallerThanAllocation) {
   }
 }
 
+// Appends the int pointed to by |object| to cleanup_order.
+std::vector<int> cleanup_order;
+void RecordCleanup(void* object) {
+  cleanup_order.push_back(*static_cast<int*>(object));
+}
+
+TEST(ArenaTest, CleanupSpansManyBlocks) {
+  // Enough cleanups to need several cleanup blocks; they must all run, most
+  // recent first, and must not eat into the space of the payload blocks.
+  const int kCleanups = 1000;
+  ArenaOptions options;
+  options.start_block_size = 256;
+  options.max_block_size = 1024;
+  Arena arena(options);
+  std::vector<int> values(kCleanups);
+  for (int round = 0; round < 2; round++) {
+    cleanup_order.clear();
+    for (int i = 0; i < kCleanups; i++) {
+      values[i] = i;
+      arena.OwnCustomDestructor(&values[i], &RecordCleanup);
+    }
+    Arena::CreateArray<char>(&arena, 16);
+    EXPECT_EQ(16 + kCleanups * 2 * sizeof(void*), arena.SpaceUsed());
+    arena.Reset();
+    ASSERT_EQ(kCleanups, cleanup_order.size());
+    for (int i = 0; i < kCleanups; i++) {
+      EXPECT_EQ(kCleanups - 1 - i, cleanup_order[i]);
+    }
+  }
+}
+
+#if LANG_CXX11
+TEST(ArenaTest, MultipleThreadsAllocate) {
+  // Every thread allocates from its own SerialArena; make sure concurrent
+  // allocations never overlap and that all of them are accounted for and
+  // cleaned up.
+  const int kThreads = 8;
+  const int kAllocationsPerThread = 1000;
+  ::google::protobuf::Arena arena;
+  std::vector<std::vector<int64*> > results(kThreads);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; t++) {
+    threads.push_back(std::thread([&arena, &results, t]() {
+      for (int i = 0; i < kAllocationsPerThread; i++) {
+        int64* p = ::google::protobuf::Arena::Create<int64>(&arena);
+        *p = t * kAllocationsPerThread + i;
+        results[t].push_back(p);
+        ::google::protobuf::Arena::Create<string>(&arena, "non-trivial");
+      }
+    }));
+  }
+  for (int t = 0; t < kThreads; t++) {
+    threads[t].join();
+  }
+
+  for (int t = 0; t < kThreads; t++) {
+    for (int i = 0; i < kAllocationsPerThread; i++) {
+      EXPECT_EQ(t * kAllocationsPerThread + i, *results[t][i]);
+    }
+  }
+  EXPECT_LE(kThreads * kAllocationsPerThread * (8 + sizeof(string)),
+            arena.SpaceUsed());
+  EXPECT_LE(arena.SpaceUsed(), arena.SpaceAllocated());
+  EXPECT_LE(arena.SpaceAllocated(), arena.Reset());
+  EXPECT_EQ(0, arena.SpaceAllocated());
+}
+#endif  // LANG_CXX11
+
+// An ArenaBlockAllocator that counts calls and hands out twice the requested
+// size.
+class CountingBlockAllocator : public ArenaBlockAllocator {
+ public:
+  CountingBlockAllocator() : allocated_(0), freed_(0), outstanding_bytes_(0) {}
+
+  virtual void* AllocateBlock(size_t* size) {
+    ++allocated_;
+    *size *= 2;
+    outstanding_bytes_ += *size;
+    return ::operator new(*size);
+  }
+  virtual void FreeBlock(void* block, size_t size) {
+    ++freed_;
+    outstanding_bytes_ -= size;
+    ::operator delete(block);
+  }
+
+  int allocated_;
+  int freed_;
+  size_t outstanding_bytes_;
+};
+
+TEST(ArenaTest, CustomBlockAllocator) {
+  CountingBlockAllocator allocator;
+  {
+    ArenaOptions options;
+    options.start_block_size = 256;
+    options.block_allocator = &allocator;
+    Arena arena(options);
+    TestAllTypes* message = Arena::CreateMessage<TestAllTypes>(&arena);
+    TestUtil::SetAllFields(message);
+    EXPECT_LT(0, allocator.allocated_);
+    EXPECT_EQ(0, allocator.freed_);
+    // The arena makes use of the whole block it was given.
+    EXPECT_EQ(allocator.outstanding_bytes_, arena.SpaceAllocated());
+    arena.Reset();
+    EXPECT_EQ(allocator.allocated_, allocator.freed_);
+    TestUtil::SetAllFields(Arena::CreateMessage<TestAllTypes>(&arena));
+  }
+  EXPECT_EQ(allocator.allocated_, allocator.freed_);
+  EXPECT_EQ(0, allocator.outstanding_bytes_);
+}
+
+TEST(ArenaTest, CustomBlockAllocatorKeepsInitialBlock) {
+  CountingBlockAllocator allocator;
+  std::vector<char> arena_block(1024);
+  ArenaOptions options;
+  options.initial_block = &arena_block[0];
+  options.initial_block_size = arena_block.size();
+  options.block_allocator = &allocator;
+  {
+    Arena arena(options);
+    Arena::CreateArray<char>(&arena, 100);
+    EXPECT_EQ(0, allocator.allocated_);
+    Arena::CreateArray<char>(&arena, 2000);
+    EXPECT_EQ(1, allocator.allocated_);
+  }
+  EXPECT_EQ(1, allocator.freed_);
+}
+
+TEST(ArenaTest, BlockPoolRecyclesBlocksAcrossResets) {
+  static int upstream_allocations;
+  struct Upstream {
+    static void* Alloc(size_t size) {
+      ++upstream_allocations;
+      return ::operator new(size);
+    }
+  };
+  upstream_allocations = 0;
+  ArenaBlockPool pool(ArenaBlockPool::kDefaultMaxCachedBytes, &Upstream::Alloc,
+                      &internal::arena_free);
+  ArenaOptions options;
+  options.block_allocator = &pool;
+
+  uint64 space_allocated;
+  {
+    Arena arena(options);
+    TestUtil::SetAllFields(Arena::CreateMessage<TestAllTypes>(&arena));
+    space_allocated = arena.SpaceAllocated();
+  }
+  int warm_allocations = upstream_allocations;
+  EXPECT_LT(0, warm_allocations);
+  EXPECT_EQ(space_allocated, pool.cached_bytes());
+
+  // A second, identically used arena is served entirely from the pool, both
+  // after construction and after Reset().
+  Arena arena(options);
+  for (int i = 0; i < 3; i++) {
+    TestUtil::SetAllFields(Arena::CreateMessage<TestAllTypes>(&arena));
+    EXPECT_EQ(space_allocated, arena.SpaceAllocated());
+    EXPECT_EQ(0, pool.cached_bytes());
+    EXPECT_EQ(space_allocated, arena.Reset());
+    EXPECT_EQ(space_allocated, pool.cached_bytes());
+  }
+  EXPECT_EQ(warm_allocations, upstream_allocations);
+}
+
+TEST(ArenaTest, BlockPoolRespectsCacheLimit) {
+  ArenaBlockPool pool(1024);
+  size_t size = 300;
+  void* small = pool.AllocateBlock(&size);
+  EXPECT_EQ(512, size);
+  size = 1000;
+  void* medium = pool.AllocateBlock(&size);
+  EXPECT_EQ(1024, size);
+  size = ArenaBlockPool::kMaxPooledBlockSize + 1;
+  void* huge = pool.AllocateBlock(&size);
+  EXPECT_EQ(ArenaBlockPool::kMaxPooledBlockSize + 1, size);
+
+  pool.FreeBlock(medium, 1024);
+  EXPECT_EQ(1024, pool.cached_bytes());
+  // The pool is full, so this one is released right away.
+  pool.FreeBlock(small, 512);
+  EXPECT_EQ(1024, pool.cached_bytes());
+  // Unpooled sizes are never cached.
+  pool.FreeBlock(huge, ArenaBlockPool::kMaxPooledBlockSize + 1);
+  EXPECT_EQ(1024, pool.cached_bytes());
+
+  size = 700;
+  EXPECT_EQ(medium, pool.AllocateBlock(&size));
+  EXPECT_EQ(0, pool.cached_bytes());
+  pool.FreeBlock(medium, size);
+  pool.Clear();
+  EXPECT_EQ(0, pool.cached_bytes());
+}
+
 TEST(ArenaTest, GetArenaShouldReturnTheArenaForArenaAllocatedMessages) {
   ::google::protobuf::Arena arena;
   ArenaMessage* message = Arena::CreateMessage<ArenaMessage>(&arena);
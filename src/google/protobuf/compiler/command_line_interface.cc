@@ -75,6 +75,7 @@
 #include <google/protobuf/compiler/subprocess.h>
 #include <google/protobuf/compiler/zip_writer.h>
 #include <google/protobuf/descriptor.h>
+#include <google/protobuf/descriptor_database.h>
 #include <google/protobuf/text_format.h>
 #include <google/protobuf/dynamic_message.h>
 #include <google/protobuf/io/coded_stream.h>
@@ -893,6 +894,12 @@ int CommandLineInterface::Run(int argc, const char* const argv[]) {
     }
   }
 
+  if (!descriptor_pool_image_name_.empty()) {
+    if (!WriteDescriptorPoolImage(parsed_files)) {
+      return 1;
+    }
+  }
+
   if (mode_ == MODE_ENCODE || mode_ == MODE_DECODE) {
     if (codec_type_.empty()) {
       // HACK:  Define an EmptyMessage type to use for decoding.
@@ -949,6 +956,7 @@ void CommandLineInterface::Clear() {
   output_directives_.clear();
   codec_type_.clear();
   descriptor_set_name_.clear();
+  descriptor_pool_image_name_.clear();
   dependency_out_name_.clear();
 
   mode_ = MODE_COMPILE;
@@ -1091,7 +1099,7 @@ CommandLineInterface::ParseArguments(int argc, const char* const argv[]) {
     return PARSE_ARGUMENT_FAIL;
   }
   if (mode_ == MODE_COMPILE && output_directives_.empty() &&
-      descriptor_set_name_.empty()) {
+      descriptor_set_name_.empty() && descriptor_pool_image_name_.empty()) {
     std::cerr << "Missing output directives." << std::endl;
     return PARSE_ARGUMENT_FAIL;
   }
@@ -1276,6 +1284,23 @@ CommandLineInterface::InterpretArgument(const string& name,
     }
     descriptor_set_name_ = value;
 
+  } else if (name == "--descriptor_pool_image_out") {
+    if (!descriptor_pool_image_name_.empty()) {
+      std::cerr << name << " may only be passed once." << std::endl;
+      return PARSE_ARGUMENT_FAIL;
+    }
+    if (value.empty()) {
+      std::cerr << name << " requires a non-empty value." << std::endl;
+      return PARSE_ARGUMENT_FAIL;
+    }
+    if (mode_ != MODE_COMPILE) {
+      std::cerr
+          << "Cannot use --encode or --decode and generate descriptors at the "
+             "same time." << std::endl;
+      return PARSE_ARGUMENT_FAIL;
+    }
+    descriptor_pool_image_name_ = value;
+
   } else if (name == "--dependency_out") {
     if (!dependency_out_name_.empty()) {
       std::cerr << name << " may only be passed once." << std::endl;
@@ -1324,7 +1349,8 @@ CommandLineInterface::InterpretArgument(const string& name,
                 << std::endl;
       return PARSE_ARGUMENT_FAIL;
     }
-    if (!output_directives_.empty() || !descriptor_set_name_.empty()) {
+    if (!output_directives_.empty() || !descriptor_set_name_.empty() ||
+        !descriptor_pool_image_name_.empty()) {
       std::cerr << "Cannot use " << name
                 << " and generate code or descriptors at the same time."
                 << std::endl;
@@ -1390,7 +1416,8 @@ CommandLineInterface::InterpretArgument(const string& name,
                 << "other info at the same time." << std::endl;
       return PARSE_ARGUMENT_FAIL;
     }
-    if (!output_directives_.empty() || !descriptor_set_name_.empty()) {
+    if (!output_directives_.empty() || !descriptor_set_name_.empty() ||
+        !descriptor_pool_image_name_.empty()) {
       std::cerr << "Cannot use " << name
                 << " and generate code or descriptors at the same time."
                 << std::endl;
@@ -1494,6 +1521,11 @@ void CommandLineInterface::PrintHelpText() {
 "                              include information about the original\n"
 "                              location of each decl in the source file as\n"
 "                              well as surrounding comments.\n"
+"  --descriptor_pool_image_out=FILE  Writes the input files and all of their\n"
+"                              imports to FILE as a descriptor pool image,\n"
+"                              which DescriptorPoolImageDatabase can map\n"
+"                              into memory and look up files in without\n"
+"                              parsing the whole set first.\n"
 "  --dependency_out=FILE       Write a dependency output file in the format\n"
 "                              expected by make. This writes the transitive\n"
 "                              set of input file paths to FILE\n"
@@ -1892,6 +1924,53 @@ bool CommandLineInterface::WriteDescriptorSet(
   return true;
 }
 
+bool CommandLineInterface::WriteDescriptorPoolImage(
+    const std::vector<const FileDescriptor*>& parsed_files) {
+  // An image must be self-contained, so imports are always included.
+  RepeatedPtrField<FileDescriptorProto> files;
+  std::set<const FileDescriptor*> already_seen;
+  for (int i = 0; i < parsed_files.size(); i++) {
+    GetTransitiveDependencies(parsed_files[i],
+                              true,  // Include json_name
+                              false,  // Strip SourceCodeInfo
+                              &already_seen, &files);
+  }
+  std::vector<const FileDescriptorProto*> file_pointers;
+  for (int i = 0; i < files.size(); i++) {
+    file_pointers.push_back(&files.Get(i));
+  }
+  string image;
+  if (!DescriptorPoolImageDatabase::BuildImage(file_pointers, &image)) {
+    std::cerr << descriptor_pool_image_name_
+              << ": Could not build descriptor pool image." << std::endl;
+    return false;
+  }
+
+  int fd;
+  do {
+    fd = open(descriptor_pool_image_name_.c_str(),
+              O_WRONLY | O_CREAT | O_TRUNC | O_BINARY, 0666);
+  } while (fd < 0 && errno == EINTR);
+
+  if (fd < 0) {
+    perror(descriptor_pool_image_name_.c_str());
+    return false;
+  }
+
+  io::FileOutputStream out(fd);
+  {
+    io::CodedOutputStream coded_out(&out);
+    coded_out.WriteString(image);
+  }
+  if (!out.Close()) {
+    std::cerr << descriptor_pool_image_name_ << ": "
+              << strerror(out.GetErrno()) << std::endl;
+    return false;
+  }
+
+  return true;
+}
+
 void CommandLineInterface::GetTransitiveDependencies(
     const FileDescriptor* file,
     bool include_json_name,
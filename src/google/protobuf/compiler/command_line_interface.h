@@ -97,7 +97,7 @@ class LIBPROTOC_EXPORT CommandLineInterface {
   //
   // 命令行接口的参数:
   // @param flag_name 指定输出文件类型的命令，例如--cpp_out，参数名字必须以“-”开头，
-                      如果名字大于两个字符，则必须以“--”开头。
+  //                    如果名字大于两个字符，则必须以“--”开头。
   // @param generator 与flag_name对应的CodeGenerator接口实现
   // @param help_text 执行protoc --help的时候对这里的flag_name的说明性信息
   //
@@ -251,6 +251,10 @@ class LIBPROTOC_EXPORT CommandLineInterface {
   // 实现命令行中的--descriptor_set_out选项
   bool WriteDescriptorSet(const std::vector<const FileDescriptor*>& parsed_files);
 
+  // Implements the --descriptor_pool_image_out option
+  bool WriteDescriptorPoolImage(
+      const std::vector<const FileDescriptor*>& parsed_files);
+
   // Implements the --dependency_out option
   bool GenerateDependencyManifestFile(
       const std::vector<const FileDescriptor*>& parsed_files,
@@ -378,6 +382,11 @@ class LIBPROTOC_EXPORT CommandLineInterface {
   // 如果指定了--descriptor_set_out选项，FileDescriptorSet将被输出到指定的文件
   string descriptor_set_name_;
 
+  // If --descriptor_pool_image_out was given, this is the filename to which
+  // a DescriptorPoolImageDatabase image of the input files and all of their
+  // imports should be written.  Otherwise, empty.
+  string descriptor_pool_image_name_;
+
   // If --dependency_out was given, this is the path to the file where the
   // dependency file will be written. Otherwise, empty.
   string dependency_out_name_;
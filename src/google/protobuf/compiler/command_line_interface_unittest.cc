@@ -58,6 +58,7 @@
 #include <google/protobuf/io/zero_copy_stream.h>
 #include <google/protobuf/descriptor.pb.h>
 #include <google/protobuf/descriptor.h>
+#include <google/protobuf/descriptor_database.h>
 #include <google/protobuf/stubs/substitute.h>
 
 #include <google/protobuf/testing/file.h>
@@ -198,6 +199,8 @@ class CommandLineInterfaceTest : public testing::Test {
   void ReadDescriptorSet(const string& filename,
                          FileDescriptorSet* descriptor_set);
 
+  void ReadFile(const string& filename, string* contents);
+
   void ExpectFileContent(const string& filename,
                          const string& content);
 
@@ -488,6 +491,12 @@ void CommandLineInterfaceTest::ReadDescriptorSet(
   }
 }
 
+void CommandLineInterfaceTest::ReadFile(const string& filename,
+                                        string* contents) {
+  GOOGLE_CHECK_OK(
+      File::GetContents(temp_directory_ + "/" + filename, contents, true));
+}
+
 void CommandLineInterfaceTest::ExpectCapturedStdout(
     const string& expected_text) {
   EXPECT_EQ(expected_text, captured_stdout_);
@@ -1196,6 +1205,43 @@ TEST_F(CommandLineInterfaceTest, WriteTransitiveDescriptorSet) {
   EXPECT_FALSE(descriptor_set.file(1).has_source_code_info());
 }
 
+TEST_F(CommandLineInterfaceTest, WriteDescriptorPoolImage) {
+  CreateTempFile("foo.proto",
+    "syntax = \"proto2\";\n"
+    "package foo;\n"
+    "message Foo {}\n");
+  CreateTempFile("bar.proto",
+    "syntax = \"proto2\";\n"
+    "import \"foo.proto\";\n"
+    "message Bar {\n"
+    "  optional foo.Foo foo = 1;\n"
+    "}\n");
+
+  Run("protocol_compiler --descriptor_pool_image_out=$tmpdir/image "
+      "--proto_path=$tmpdir bar.proto");
+
+  ExpectNoErrors();
+
+  // The image includes imports even without --include_imports.
+  string image;
+  ReadFile("image", &image);
+  google::protobuf::scoped_ptr<DescriptorPoolImageDatabase> database(
+      new DescriptorPoolImageDatabase(image.data(), image.size()));
+  ASSERT_TRUE(database->is_valid());
+  std::vector<string> names;
+  EXPECT_TRUE(database->FindAllFileNames(&names));
+  ASSERT_EQ(2, names.size());
+  EXPECT_EQ("bar.proto", names[0]);
+  EXPECT_EQ("foo.proto", names[1]);
+
+  FileDescriptorProto file;
+  ASSERT_TRUE(database->FindFileContainingSymbol("foo.Foo", &file));
+  EXPECT_EQ("foo.proto", file.name());
+  EXPECT_FALSE(file.has_source_code_info());
+  ASSERT_TRUE(database->FindFileByName("bar.proto", &file));
+  EXPECT_EQ("foo", file.message_type(0).field(0).json_name());
+}
+
 TEST_F(CommandLineInterfaceTest, WriteTransitiveDescriptorSetWithSourceInfo) {
   CreateTempFile("foo.proto",
     "syntax = \"proto2\";\n"
@@ -523,6 +523,55 @@ class FileGenerator::ForwardDeclarations {
   std::map<string, const EnumDescriptor*> enums_;
 };
 
+void FileGenerator::GenerateSerializationTables(io::Printer* printer) {
+  // The field tables of all messages in the file are laid out back to back;
+  // each SerializationTable points at the run belonging to its message.
+  // Messages whose layout the table-driven serializer cannot handle get an
+  // empty entry and keep their generated serialization code.
+  printer->Print(
+      "PROTOBUF_CONSTEXPR_VAR "
+      "::google::protobuf::internal::SerializationTableField\n"
+      "    const TableStruct::serialization_fields[] = {\n");
+  printer->Indent();
+
+  std::vector<size_t> entries;
+  size_t count = 0;
+  for (int i = 0; i < message_generators_.size(); i++) {
+    size_t value =
+        message_generators_[i]->GenerateSerializationTableFields(printer);
+    entries.push_back(value);
+    count += value;
+  }
+
+  // We need these arrays to exist, and MSVC does not like empty arrays.
+  if (count == 0) {
+    printer->Print("{0, 0, 0, 0, 0, NULL},\n");
+  }
+
+  printer->Outdent();
+  printer->Print(
+      "};\n"
+      "\n"
+      "PROTOBUF_CONSTEXPR_VAR ::google::protobuf::internal::SerializationTable const\n"
+      "    TableStruct::serialization_table[] = {\n");
+  printer->Indent();
+
+  size_t offset = 0;
+  for (int i = 0; i < message_generators_.size(); i++) {
+    message_generators_[i]->GenerateSerializationTable(printer, offset);
+    offset += entries[i];
+  }
+
+  if (message_generators_.empty()) {
+    printer->Print("{ NULL, 0, -1, -1, -1 },\n");
+  }
+
+  printer->Outdent();
+  printer->Print(
+      "};\n"
+      "\n");
+}
+
 void FileGenerator::GenerateBuildDescriptors(io::Printer* printer) {
   // AddDescriptors() is a file-level procedure which adds the encoded
   // FileDescriptorProto for this .proto file to the global DescriptorPool for
@@ -606,6 +655,10 @@ void FileGenerator::GenerateBuildDescriptors(io::Printer* printer) {
       "};\n"
       "\n");
 
+  if (options_.table_driven_serialization) {
+    GenerateSerializationTables(printer);
+  }
+
   if (HasDescriptorMethods(file_, options_)) {
     if (!message_generators_.empty()) {
       printer->Print("const ::google::protobuf::uint32 TableStruct::offsets[] = {\n");
@@ -1040,6 +1093,10 @@ void FileGenerator::GenerateLibraryIncludes(io::Printer* printer) {
           "#include <google/protobuf/map_field_lite.h>\n");
     }
   }
+  if (HasLazyFields(file_, options_)) {
+    printer->Print(
+        "#include <google/protobuf/lazy_field.h>\n");
+  }
 
   if (HasEnumDefinitions(file_)) {
     if (HasDescriptorMethods(file_, options_)) {
@@ -1113,7 +1170,17 @@ void FileGenerator::GenerateGlobalStateFunctionDeclarations(
       "struct $dllexport_decl$TableStruct {\n"
       "  static const ::google::protobuf::internal::ParseTableField entries[];\n"
       "  static const ::google::protobuf::internal::AuxillaryParseTableField aux[];\n"
-      "  static const ::google::protobuf::internal::ParseTable schema[];\n"
+      "  static const ::google::protobuf::internal::ParseTable schema[];\n",
+      "file_namespace", FileLevelNamespace(file_->name()), "dllexport_decl",
+      options_.dllexport_decl.empty() ? "" : options_.dllexport_decl + " ");
+  if (options_.table_driven_serialization) {
+    printer->Print(
+        "  static const ::google::protobuf::internal::SerializationTableField\n"
+        "      serialization_fields[];\n"
+        "  static const ::google::protobuf::internal::SerializationTable\n"
+        "      serialization_table[];\n");
+  }
+  printer->Print(
       "  static const ::google::protobuf::uint32 offsets[];\n"
       // The following function(s) need to be able to access private members of
       // the messages defined in the file. So we make them static members.
@@ -90,6 +90,9 @@ class FileGenerator {
   // for types defined in the file.
   void GenerateBuildDescriptors(io::Printer* printer);
 
+  // Generate the tables used by table-driven serialization.
+  void GenerateSerializationTables(io::Printer* printer);
+
   void GenerateNamespaceOpeners(io::Printer* printer);
   void GenerateNamespaceClosers(io::Printer* printer);
 
@@ -100,6 +100,8 @@ bool CppGenerator::Generate(const FileDescriptor* file,
       file_options.enforce_lite = true;
     } else if (options[i].first == "table_driven_parsing") {
       file_options.table_driven_parsing = true;
+    } else if (options[i].first == "table_driven_serialization") {
+      file_options.table_driven_serialization = true;
     } else {
       *error = "Unknown generator option: " + options[i].first;
       return false;
@@ -34,6 +34,7 @@
 
 #include <limits>
 #include <map>
+#include <set>
 #include <vector>
 #include <google/protobuf/stubs/hash.h>
 
@@ -662,6 +663,56 @@ bool HasWeakFields(const FileDescriptor* file) {
   return false;
 }
 
+static bool MayBeUninitialized(const Descriptor* descriptor,
+                               std::set<const Descriptor*>* already_seen) {
+  if (!already_seen->insert(descriptor).second) return false;
+  // Extensions may have required fields of their own.
+  if (descriptor->extension_range_count() > 0) return true;
+  for (int i = 0; i < descriptor->field_count(); i++) {
+    const FieldDescriptor* field = descriptor->field(i);
+    if (field->is_required()) return true;
+    if (field->cpp_type() == FieldDescriptor::CPPTYPE_MESSAGE &&
+        MayBeUninitialized(field->message_type(), already_seen)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+bool IsLazy(const FieldDescriptor* field, const Options& options) {
+  if (!field->options().lazy() || field->is_repeated() ||
+      field->type() != FieldDescriptor::TYPE_MESSAGE ||
+      field->containing_oneof() != NULL || field->options().weak()) {
+    return false;
+  }
+  if (HasDescriptorMethods(field->file(), options) ||
+      !HasFieldPresence(field->file()) || options.proto_h) {
+    return false;
+  }
+  std::set<const Descriptor*> already_seen;
+  return !MayBeUninitialized(field->message_type(), &already_seen);
+}
+
+static bool HasLazyFields(const Descriptor* descriptor,
+                          const Options& options) {
+  for (int i = 0; i < descriptor->field_count(); ++i) {
+    if (IsLazy(descriptor->field(i), options)) {
+      return true;
+    }
+  }
+  for (int i = 0; i < descriptor->nested_type_count(); ++i) {
+    if (HasLazyFields(descriptor->nested_type(i), options)) return true;
+  }
+  return false;
+}
+
+bool HasLazyFields(const FileDescriptor* file, const Options& options) {
+  for (int i = 0; i < file->message_type_count(); ++i) {
+    if (HasLazyFields(file->message_type(i), options)) return true;
+  }
+  return false;
+}
+
 SCCAnalyzer::NodeData SCCAnalyzer::DFS(const Descriptor* descriptor) {
   // Must not have visited already.
   GOOGLE_DCHECK_EQ(cache_.count(descriptor), 0);
@@ -280,6 +280,17 @@ inline ::google::protobuf::FileOptions_OptimizeMode GetOptimizeFor(
 bool HasWeakFields(const Descriptor* desc);
 bool HasWeakFields(const FileDescriptor* desc);
 
+// Is the given [lazy=true] field held in an internal::LazyField, which keeps
+// the serialized sub-message until it is first accessed?  This is only done
+// for singular message fields of lite messages with has-bits, and only when
+// the sub-message can never be uninitialized, since IsInitialized() would
+// otherwise have to parse it.
+bool IsLazy(const FieldDescriptor* field, const Options& options);
+
+// Does the file have any lazy fields, necessitating the file to include
+// lazy_field.h?
+bool HasLazyFields(const FileDescriptor* file, const Options& options);
+
 // Returns true if the "required" restriction check should be ignored for the
 // given field.
 inline static bool ShouldIgnoreRequiredFieldCheck(const FieldDescriptor* field,
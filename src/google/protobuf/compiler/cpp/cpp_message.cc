@@ -236,7 +236,8 @@ bool CanConstructByZeroing(const FieldDescriptor* field,
   // Clear, as we need to potentially delete the existing value.
   ret = ret ||
       (!field->is_repeated() &&
-       field->cpp_type() == FieldDescriptor::CPPTYPE_MESSAGE);
+       field->cpp_type() == FieldDescriptor::CPPTYPE_MESSAGE &&
+       !IsLazy(field, options));
   return ret;
 }
 
@@ -298,7 +299,8 @@ void OptimizePadding(std::vector<const FieldDescriptor*>* fields,
       f = REPEATED;
     } else if (field->cpp_type() == FieldDescriptor::CPPTYPE_STRING) {
       f = STRING;
-    } else if (field->cpp_type() == FieldDescriptor::CPPTYPE_MESSAGE) {
+    } else if (field->cpp_type() == FieldDescriptor::CPPTYPE_MESSAGE &&
+               !IsLazy(field, options)) {
       f = MESSAGE;
 
     } else if (CanInitializeByZeroing(field)) {
@@ -452,12 +454,11 @@ bool HasPrivateHasMethod(const FieldDescriptor* field) {
 }
 
 
-bool TableDrivenEnabled(const Descriptor* descriptor, const Options& options) {
-  if (!options.table_driven_parsing) {
-    return false;
-  }
-
-  // Consider table-driven parsing.  We only do this if:
+// Returns whether the fields of the message can be handled by the shared
+// table-driven routines, which reach fields only through their offsets and
+// has-bits.  This is required by both table-driven parsing and serialization.
+bool TableDrivenLayoutSupported(const Descriptor* descriptor,
+                                const Options& options) {
   // - There are no extensions
   if (descriptor->extension_range_count() != 0) {
     return false;
@@ -474,13 +475,8 @@ bool TableDrivenEnabled(const Descriptor* descriptor, const Options& options) {
     return false;
   }
 
-  const double table_sparseness = 0.5;
-  int max_field_number = 0;
   for (int i = 0; i < descriptor->field_count(); i++) {
     const FieldDescriptor* field = descriptor->field(i);
-    if (max_field_number < field->number()) {
-      max_field_number = field->number();
-    }
 
     // - There are no map fields.
     if (field->is_map()) {
@@ -496,6 +492,39 @@ bool TableDrivenEnabled(const Descriptor* descriptor, const Options& options) {
     if (field->options().weak()) {
       return false;
     }
+
+    // - There are no lazy fields, which are not raw message pointers.
+    if (IsLazy(field, options)) {
+      return false;
+    }
+  }
+
+  // - This is not a MapEntryMessage.
+  if (IsMapEntryMessage(descriptor)) {
+    return false;
+  }
+
+  return true;
+}
+
+bool TableDrivenEnabled(const Descriptor* descriptor, const Options& options) {
+  if (!options.table_driven_parsing) {
+    return false;
+  }
+
+  // Consider table-driven parsing.  We only do this if the layout is supported
+  // (see above) and:
+  if (!TableDrivenLayoutSupported(descriptor, options)) {
+    return false;
+  }
+
+  const double table_sparseness = 0.5;
+  int max_field_number = 0;
+  for (int i = 0; i < descriptor->field_count(); i++) {
+    const FieldDescriptor* field = descriptor->field(i);
+    if (max_field_number < field->number()) {
+      max_field_number = field->number();
+    }
   }
 
   // - There range of field numbers is "small"
@@ -508,12 +537,18 @@ bool TableDrivenEnabled(const Descriptor* descriptor, const Options& options) {
     return false;
   }
 
-  // - This is not a MapEntryMessage.
-  if (IsMapEntryMessage(descriptor)) {
+  return true;
+}
+
+// Table-driven serialization is indexed by the position of the field rather
+// than its number, so unlike parsing it places no limits on field numbers.
+bool TableDrivenSerializationEnabled(const Descriptor* descriptor,
+                                     const Options& options) {
+  if (!options.table_driven_serialization) {
     return false;
   }
 
-  return true;
+  return TableDrivenLayoutSupported(descriptor, options);
 }
 
 }  // anonymous namespace
@@ -593,6 +628,8 @@ MessageGenerator::MessageGenerator(const Descriptor* descriptor,
   }
 
   table_driven_ = TableDrivenEnabled(descriptor_, options_);
+  table_driven_serialization_ =
+      TableDrivenSerializationEnabled(descriptor_, options_);
 }
 
 MessageGenerator::~MessageGenerator() {}
@@ -1260,7 +1297,8 @@ GenerateClassDefinition(io::Printer* printer) {
         "void DiscardUnknownFields()$final$;\n",
         "final", use_final);
     }
-    if (HasFastArraySerialization(descriptor_->file(), options_)) {
+    if (HasFastArraySerialization(descriptor_->file(), options_) ||
+        table_driven_serialization_) {
       printer->Print(
         "::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(\n"
         "    bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;\n");
@@ -1400,7 +1438,7 @@ GenerateClassDefinition(io::Printer* printer) {
 
   if (HasGeneratedMethods(descriptor_->file(), options_) &&
       !descriptor_->options().message_set_wire_format() &&
-      num_required_fields_ > 1) {
+      !table_driven_serialization_ && num_required_fields_ > 1) {
     printer->Print(
         "// helper for ByteSizeLong()\n"
         "size_t RequiredFieldsByteSizeFallback() const;\n\n");
@@ -1709,6 +1747,7 @@ GenerateDefaultInstanceInitializer(io::Printer* printer) {
 
     if (!field->is_repeated() &&
         field->cpp_type() == FieldDescriptor::CPPTYPE_MESSAGE &&
+        !IsLazy(field, options_) &&
         (field->containing_oneof() == NULL ||
          HasDescriptorMethods(descriptor_->file(), options_))) {
       string name;
@@ -1833,7 +1872,8 @@ GenerateClassMethods(io::Printer* printer) {
     GenerateSerializeWithCachedSizes(printer);
     printer->Print("\n");
 
-    if (HasFastArraySerialization(descriptor_->file(), options_)) {
+    if (HasFastArraySerialization(descriptor_->file(), options_) ||
+        table_driven_serialization_) {
       GenerateSerializeWithCachedSizesToArray(printer);
       printer->Print("\n");
     }
@@ -2004,7 +2044,10 @@ size_t MessageGenerator::GenerateParseAuxTable(io::Printer* printer) {
             "{::google::protobuf::internal::AuxillaryParseTableField::message_aux{\n"
             "  &::$ns$_$classname$_default_instance_,\n");
 
+        // As for serialization, only the parse tables of this file are known
+        // to have been generated with table-driven parsing.
         bool dont_emit_table =
+            field->message_type()->file() != descriptor_->file() ||
             !TableDrivenEnabled(field->message_type(), options_);
 
         if (dont_emit_table) {
@@ -2055,6 +2098,108 @@ size_t MessageGenerator::GenerateParseAuxTable(io::Printer* printer) {
   return last_field_number;
 }
 
+size_t MessageGenerator::GenerateSerializationTableFields(
+    io::Printer* printer) {
+  if (!table_driven_serialization_) {
+    return 0;
+  }
+
+  // Fields are serialized in field number order.
+  std::vector<const FieldDescriptor*> ordered_fields =
+      SortFieldsByNumber(descriptor_);
+
+  for (int i = 0; i < descriptor_->field_count(); i++) {
+    const FieldDescriptor* field = ordered_fields[i];
+
+    unsigned char processing_type = static_cast<unsigned>(field->type());
+    if (field->is_repeated()) {
+      processing_type |= internal::kRepeatedMask;
+    }
+    if (field->is_packed()) {
+      processing_type |= internal::kPackedMask;
+    }
+
+    std::map<string, string> vars;
+    vars["classname"] = classname_;
+    vars["name"] = FieldName(field);
+    vars["tag"] = SimpleItoa(WireFormat::MakeTag(field));
+    vars["ptype"] = SimpleItoa(processing_type);
+    vars["tag_size"] =
+        SimpleItoa(WireFormat::TagSize(field->number(), field->type()));
+
+    printer->Print(vars,
+        "{\n"
+        "  static_cast< ::google::protobuf::uint32>(\n"
+        "    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(\n"
+        "      $classname$, $name$_)),\n");
+
+    // Packed fields keep the size of their data next to them; other repeated
+    // fields have no presence information at all.
+    if (field->is_packed()) {
+      printer->Print(vars,
+          "  static_cast< ::google::protobuf::uint32>(\n"
+          "    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(\n"
+          "      $classname$, _$name$_cached_byte_size_)),\n");
+    } else if (field->is_repeated()) {
+      printer->Print("  0,\n");
+    } else {
+      printer->Print("  $has$,\n",
+                     "has", SimpleItoa(has_bit_indices_[field->index()]));
+    }
+
+    printer->Print(vars, "  $tag$u, $ptype$, $tag_size$,\n");
+
+    // Sub-messages defined in this file can be serialized through their own
+    // table.  The tables of other files are only present if those files were
+    // generated with the same options, so we call through their methods.
+    const Descriptor* message_type = field->message_type();
+    if (message_type != NULL &&
+        message_type->file() == descriptor_->file() &&
+        TableDrivenSerializationEnabled(message_type, options_)) {
+      printer->Print(
+          "  TableStruct::serialization_table +\n"
+          "    $type$::kIndexInFileMessages\n",
+          "type", ClassName(message_type, true));
+    } else {
+      printer->Print("  NULL\n");
+    }
+
+    printer->Print("},\n");
+  }
+
+  return descriptor_->field_count();
+}
+
+bool MessageGenerator::GenerateSerializationTable(io::Printer* printer,
+                                                  size_t offset) {
+  if (!table_driven_serialization_) {
+    printer->Print("{ NULL, 0, -1, -1, -1 },\n");
+    return false;
+  }
+
+  std::map<string, string> vars;
+  vars["classname"] = classname_;
+  vars["offset"] = SimpleItoa(offset);
+  vars["num_fields"] = SimpleItoa(descriptor_->field_count());
+
+  printer->Print("{\n");
+  printer->Indent();
+
+  printer->Print(vars,
+      "TableStruct::serialization_fields + $offset$,\n"
+      "$num_fields$,\n"
+      "GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(\n"
+      "  $classname$, _has_bits_),\n"
+      "GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(\n"
+      "  $classname$, _internal_metadata_),\n"
+      "GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(\n"
+      "  $classname$, _cached_size_),\n");
+
+  printer->Outdent();
+  printer->Print("},\n");
+  return true;
+}
+
 std::pair<size_t, size_t> MessageGenerator::GenerateOffsets(
     io::Printer* printer) {
   if (IsMapEntryMessage(descriptor_)) return std::make_pair(0, 0);
@@ -3676,7 +3821,18 @@ GenerateSerializeWithCachedSizes(io::Printer* printer) {
     "// @@protoc_insertion_point(serialize_start:$full_name$)\n",
     "full_name", descriptor_->full_name());
 
-  GenerateSerializeWithCachedSizesBody(printer, false);
+  if (table_driven_serialization_) {
+    printer->Print(
+        "::google::protobuf::internal::TableSerialize(\n"
+        "    this,\n"
+        "    $file_namespace$::TableStruct::serialization_table[\n"
+        "      $classname$::kIndexInFileMessages],\n"
+        "    output);\n",
+        "classname", classname_,
+        "file_namespace", FileLevelNamespace(descriptor_->file()->name()));
+  } else {
+    GenerateSerializeWithCachedSizesBody(printer, false);
+  }
 
   printer->Print(
     "// @@protoc_insertion_point(serialize_end:$full_name$)\n",
@@ -3719,7 +3875,18 @@ GenerateSerializeWithCachedSizesToArray(io::Printer* printer) {
     "// @@protoc_insertion_point(serialize_to_array_start:$full_name$)\n",
     "full_name", descriptor_->full_name());
 
-  GenerateSerializeWithCachedSizesBody(printer, true);
+  if (table_driven_serialization_) {
+    printer->Print(
+        "target = ::google::protobuf::internal::TableSerializeToArray(\n"
+        "    this,\n"
+        "    $file_namespace$::TableStruct::serialization_table[\n"
+        "      $classname$::kIndexInFileMessages],\n"
+        "    deterministic, target);\n",
+        "classname", classname_,
+        "file_namespace", FileLevelNamespace(descriptor_->file()->name()));
+  } else {
+    GenerateSerializeWithCachedSizesBody(printer, true);
+  }
 
   printer->Print(
     "// @@protoc_insertion_point(serialize_to_array_end:$full_name$)\n",
@@ -3953,6 +4120,20 @@ GenerateByteSize(io::Printer* printer) {
     return;
   }
 
+  if (table_driven_serialization_) {
+    printer->Print(
+        "size_t $classname$::ByteSizeLong() const {\n"
+        "// @@protoc_insertion_point(message_byte_size_start:$full_name$)\n"
+        "  return ::google::protobuf::internal::TableByteSize(\n"
+        "      this,\n"
+        "      $file_namespace$::TableStruct::serialization_table[\n"
+        "        $classname$::kIndexInFileMessages]);\n"
+        "}\n",
+        "classname", classname_, "full_name", descriptor_->full_name(),
+        "file_namespace", FileLevelNamespace(descriptor_->file()->name()));
+    return;
+  }
+
   if (num_required_fields_ > 1 && HasFieldPresence(descriptor_->file())) {
     // Emit a function (rarely used, we hope) that handles the required fields
     // by checking for each one individually.
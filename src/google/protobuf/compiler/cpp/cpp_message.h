@@ -128,6 +128,13 @@ class MessageGenerator {
   bool GenerateParseTable(io::Printer* printer, size_t offset,
                           size_t aux_offset);
 
+  // Generate the table-driven serialization array.  Returns the number of
+  // entries generated.
+  size_t GenerateSerializationTableFields(io::Printer* printer);
+  // Generates a SerializationTable entry.  Returns whether the proto uses
+  // table-driven serialization.
+  bool GenerateSerializationTable(io::Printer* printer, size_t offset);
+
   // Generate the field offsets array.  Returns the a pair of the total numer
   // of entries generated and the index of the first has_bit entry.
   std::pair<size_t, size_t> GenerateOffsets(io::Printer* printer);
@@ -221,6 +228,9 @@ class MessageGenerator {
   int num_weak_fields_;
   // table_driven_ indicates the generated message uses table-driven parsing.
   bool table_driven_;
+  // table_driven_serialization_ indicates the generated message uses
+  // table-driven serialization.
+  bool table_driven_serialization_;
 
   int index_in_file_messages_;
 
@@ -879,6 +879,185 @@ GenerateConstructorCode(io::Printer* printer) const {
 
 // ===================================================================
 
+LazyMessageFieldGenerator::LazyMessageFieldGenerator(
+    const FieldDescriptor* descriptor, const Options& options)
+    : MessageFieldGenerator(descriptor, options) {
+  variables_["prototype"] =
+      "*" + variables_["type"] + "::internal_default_instance()";
+}
+
+LazyMessageFieldGenerator::~LazyMessageFieldGenerator() {}
+
+void LazyMessageFieldGenerator::
+GeneratePrivateMembers(io::Printer* printer) const {
+  printer->Print(variables_,
+    "::google::protobuf::internal::LazyField $name$_;\n");
+}
+
+void LazyMessageFieldGenerator::
+GenerateAccessorDeclarations(io::Printer* printer) const {
+  GenerateGetterDeclaration(printer);
+  printer->Print(variables_,
+    "$deprecated_attr$$type$* mutable_$name$();\n"
+    "$deprecated_attr$$type$* $release_name$();\n"
+    "$deprecated_attr$void set_allocated_$name$($type$* $name$);\n");
+  if (SupportsArenas(descriptor_)) {
+    printer->Print(variables_,
+      "$deprecated_attr$$type$* unsafe_arena_release_$name$();\n"
+      "$deprecated_attr$void unsafe_arena_set_allocated_$name$(\n"
+      "    $type$* $name$);\n");
+  }
+}
+
+void LazyMessageFieldGenerator::
+GenerateInlineAccessorDefinitions(io::Printer* printer,
+                                  bool is_inline) const {
+  std::map<string, string> variables(variables_);
+  variables["inline"] = is_inline ? "inline " : "";
+  printer->Print(variables,
+    "$inline$const $type$& $classname$::$name$() const {\n"
+    "  // @@protoc_insertion_point(field_get:$full_name$)\n"
+    "  return static_cast<const $type$&>(\n"
+    "      $name$_.Get($prototype$, GetArenaNoVirtual()));\n"
+    "}\n"
+    "$inline$"
+    "$type$* $classname$::mutable_$name$() {\n"
+    "  $set_hasbit$\n"
+    "  // @@protoc_insertion_point(field_mutable:$full_name$)\n"
+    "  return static_cast<$type$*>(\n"
+    "      $name$_.Mutable($prototype$, GetArenaNoVirtual()));\n"
+    "}\n"
+    "$inline$"
+    "$type$* $classname$::$release_name$() {\n"
+    "  // @@protoc_insertion_point(field_release:$full_name$)\n"
+    "  $clear_hasbit$\n"
+    "  return static_cast<$type$*>(\n"
+    "      $name$_.Release($prototype$, GetArenaNoVirtual()));\n"
+    "}\n"
+    "$inline$"
+    "void $classname$::set_allocated_$name$($type$* $name$) {\n"
+    "  $name$_.SetAllocated($name$, GetArenaNoVirtual());\n"
+    "  if ($name$) {\n"
+    "    $set_hasbit$\n"
+    "  } else {\n"
+    "    $clear_hasbit$\n"
+    "  }\n"
+    "  // @@protoc_insertion_point(field_set_allocated:$full_name$)\n"
+    "}\n");
+  if (SupportsArenas(descriptor_)) {
+    printer->Print(variables,
+      "$inline$"
+      "$type$* $classname$::unsafe_arena_release_$name$() {\n"
+      "  // @@protoc_insertion_point(field_unsafe_arena_release:$full_name$)\n"
+      "  $clear_hasbit$\n"
+      "  return static_cast<$type$*>(\n"
+      "      $name$_.UnsafeArenaRelease($prototype$, GetArenaNoVirtual()));\n"
+      "}\n"
+      "$inline$"
+      "void $classname$::unsafe_arena_set_allocated_$name$(\n"
+      "    $type$* $name$) {\n"
+      "  $name$_.UnsafeArenaSetAllocated($name$, GetArenaNoVirtual());\n"
+      "  if ($name$) {\n"
+      "    $set_hasbit$\n"
+      "  } else {\n"
+      "    $clear_hasbit$\n"
+      "  }\n"
+      "  // @@protoc_insertion_point(field_unsafe_arena_set_allocated"
+      ":$full_name$)\n"
+      "}\n");
+  }
+}
+
+void LazyMessageFieldGenerator::
+GenerateClearingCode(io::Printer* printer) const {
+  printer->Print(variables_, "$name$_.Clear();\n");
+}
+
+void LazyMessageFieldGenerator::
+GenerateMessageClearingCode(io::Printer* printer) const {
+  printer->Print(variables_, "$name$_.Clear();\n");
+}
+
+void LazyMessageFieldGenerator::
+GenerateMergingCode(io::Printer* printer) const {
+  // Unlike mutable_$name$()->MergeFrom(), this does not parse either side if
+  // neither has been parsed yet.
+  printer->Print(variables_,
+    "$set_hasbit$\n"
+    "$name$_.MergeFrom(from.$name$_, $prototype$, GetArenaNoVirtual());\n");
+}
+
+void LazyMessageFieldGenerator::
+GenerateSwappingCode(io::Printer* printer) const {
+  printer->Print(variables_, "$name$_.Swap(&other->$name$_);\n");
+}
+
+void LazyMessageFieldGenerator::
+GenerateDestructorCode(io::Printer* printer) const {
+  // The default instance never holds a message, so unlike for eagerly parsed
+  // fields there is no need to special-case it.
+  printer->Print(variables_, "$name$_.Destroy();\n");
+}
+
+void LazyMessageFieldGenerator::
+GenerateConstructorCode(io::Printer* printer) const {
+  printer->Print(variables_, "$name$_.Init();\n");
+}
+
+void LazyMessageFieldGenerator::
+GenerateCopyConstructorCode(io::Printer* printer) const {
+  // As for eagerly parsed fields, the copy is always on the heap.  A field
+  // that has not been parsed is copied without parsing it.
+  printer->Print(variables_,
+    "$name$_.Init();\n"
+    "if (from.has_$name$()) {\n"
+    "  $name$_.MergeFrom(from.$name$_, $prototype$, NULL);\n"
+    "}\n");
+}
+
+void LazyMessageFieldGenerator::
+GenerateMergeFromCodedStream(io::Printer* printer) const {
+  printer->Print(variables_,
+    "$set_hasbit$\n"
+    "DO_($name$_.MergeFromCodedStream(\n"
+    "    input, $prototype$, GetArenaNoVirtual()));\n");
+}
+
+void LazyMessageFieldGenerator::
+GenerateSerializeWithCachedSizes(io::Printer* printer) const {
+  printer->Print(variables_,
+    "::google::protobuf::internal::WireFormatLite::WriteTag(\n"
+    "  $number$,\n"
+    "  ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,\n"
+    "  output);\n"
+    "output->WriteVarint32(\n"
+    "  static_cast< ::google::protobuf::uint32>($name$_.GetCachedSize()));\n"
+    "$name$_.SerializeWithCachedSizes(output);\n");
+}
+
+void LazyMessageFieldGenerator::
+GenerateSerializeWithCachedSizesToArray(io::Printer* printer) const {
+  printer->Print(variables_,
+    "target = ::google::protobuf::internal::WireFormatLite::WriteTagToArray(\n"
+    "  $number$,\n"
+    "  ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,\n"
+    "  target);\n"
+    "target = ::google::protobuf::io::CodedOutputStream::WriteVarint32ToArray(\n"
+    "  static_cast< ::google::protobuf::uint32>($name$_.GetCachedSize()), target);\n"
+    "target = $name$_.InternalSerializeWithCachedSizesToArray(\n"
+    "  deterministic, target);\n");
+}
+
+void LazyMessageFieldGenerator::
+GenerateByteSize(io::Printer* printer) const {
+  printer->Print(variables_,
+    "total_size += $tag_size$ +\n"
+    "  ::google::protobuf::internal::WireFormatLite::LengthDelimitedSize(\n"
+    "    $name$_.ByteSizeLong());\n");
+}
+
+// ===================================================================
+
 RepeatedMessageFieldGenerator::RepeatedMessageFieldGenerator(
     const FieldDescriptor* descriptor, const Options& options)
     : FieldGenerator(options),
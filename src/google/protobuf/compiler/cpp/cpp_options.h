@@ -49,7 +49,8 @@ struct Options {
         transitive_pb_h(true),
         annotate_headers(false),
         enforce_lite(false),
-        table_driven_parsing(false) {}
+        table_driven_parsing(false),
+        table_driven_serialization(false) {}
 
   string dllexport_decl;
   bool safe_boundary_check;
@@ -58,6 +59,7 @@ struct Options {
   bool annotate_headers;
   bool enforce_lite;
   bool table_driven_parsing;
+  bool table_driven_serialization;
   string annotation_pragma_name;
   string annotation_guard_name;
 };
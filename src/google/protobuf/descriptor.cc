@@ -56,6 +56,7 @@
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/io/tokenizer.h>
 #include <google/protobuf/io/zero_copy_stream_impl.h>
+#include <google/protobuf/stubs/atomicops.h>
 #include <google/protobuf/stubs/common.h>
 #include <google/protobuf/stubs/logging.h>
 #include <google/protobuf/stubs/mutex.h>
@@ -66,6 +67,10 @@
 #include <google/protobuf/stubs/map_util.h>
 #include <google/protobuf/stubs/stl_util.h>
 
+#if LANG_CXX11
+#include <thread>
+#endif
+
 #undef PACKAGE  // autoheader #defines this.  :(
 
 namespace google {
@@ -374,13 +379,13 @@ class PrefixRemover {
   string prefix_;
 };
 
-// A DescriptorPool contains a bunch of hash_maps to implement the
+// A DescriptorPool contains a bunch of hash tables to implement the
 // various Find*By*() methods.  Since hashtable lookups are O(1), it's
-// most efficient to construct a fixed set of large hash_maps used by
+// most efficient to construct a fixed set of large hash tables used by
 // all objects in the pool rather than construct one or more small
-// hash_maps for each object.
+// hash tables for each object.
 //
-// The keys to these hash_maps are (parent, name) or (parent, number)
+// The keys to these hash tables are (parent, name) or (parent, number)
 // pairs.  Unfortunately STL doesn't provide hash functions for pair<>,
 // so we must invent our own.
 //
@@ -397,6 +402,18 @@ struct PointerStringPairEqual {
   }
 };
 
+// hash<const char*> is not usable as a hash function on every platform (see
+// stubs/hash.h), so the tables below get their own.
+struct CStringHash {
+  size_t operator()(const char* str) const {
+    size_t result = 0;
+    for (; *str != '\0'; str++) {
+      result = 5 * result + *str;
+    }
+    return result;
+  }
+};
+
 template<typename PairType>
 struct PointerIntegerPairHash {
   size_t operator()(const PairType& p) const {
@@ -404,15 +421,12 @@ struct PointerIntegerPairHash {
     // no idea!  This seems a bit better than an XOR.
     return reinterpret_cast<intptr_t>(p.first) * ((1 << 16) - 1) + p.second;
   }
+};
 
-#ifdef _MSC_VER
-  // Used only by MSVC and platforms where hash_map is not available.
-  static const size_t bucket_size = 4;
-  static const size_t min_buckets = 8;
-#endif
-  inline bool operator()(const PairType& a, const PairType& b) const {
-    return a.first < b.first ||
-          (a.first == b.first && a.second < b.second);
+template<typename PairType>
+struct PointerIntegerPairEqual {
+  bool operator()(const PairType& a, const PairType& b) const {
+    return a.first == b.first && a.second == b.second;
   }
 };
 
@@ -423,46 +437,154 @@ struct PointerStringPairHash {
   size_t operator()(const PointerStringPair& p) const {
     // FIXME(kenton):  What is the best way to compute this hash?  I have
     // no idea!  This seems a bit better than an XOR.
-    hash<const char*> cstring_hash;
+    CStringHash cstring_hash;
     return reinterpret_cast<intptr_t>(p.first) * ((1 << 16) - 1) +
            cstring_hash(p.second);
   }
+};
 
-#ifdef _MSC_VER
-  // Used only by MSVC and platforms where hash_map is not available.
-  static const size_t bucket_size = 4;
-  static const size_t min_buckets = 8;
-#endif
-  inline bool operator()(const PointerStringPair& a,
-                         const PointerStringPair& b) const {
-    if (a.first < b.first) return true;
-    if (a.first > b.first) return false;
-    return strcmp(a.second, b.second) < 0;
+// The hash functions above leave some bits of their results poorly mixed
+// (the low bits of a pointer are always zero, for example), which matters
+// to tables that pick a slot from the low bits.  Multiplying by 2^64 / phi
+// and keeping the high half spreads every input bit over the result.
+inline uint32 MixHash(size_t hash) {
+  return static_cast<uint32>(
+      (static_cast<uint64>(hash) * GOOGLE_ULONGLONG(0x9E3779B97F4A7C15)) >> 32);
+}
+
+// An open-addressing hash map with linear probing, which keeps its entries
+// inline in a single array along with their (mixed) hashes.  Unlike
+// hash_map, this costs no heap node per entry and no pointer chasing per
+// lookup, and comparing the stored hash first means keys are only compared
+// when they are very likely to be equal.  Only as much of the hash_map
+// interface as the map_util.h helpers need is provided:  iterators are plain
+// pointers to entries, end() is NULL, and inserting may move every entry.
+template <typename Key, typename Value, typename Hash, typename Equal>
+class FlatHashMap {
+ public:
+  typedef std::pair<const Key, Value> value_type;
+  typedef std::pair<Key, Value>* iterator;
+  typedef const std::pair<Key, Value>* const_iterator;
+
+  FlatHashMap() : size_(0) {}
+
+  int size() const { return size_; }
+  iterator end() { return NULL; }
+  const_iterator end() const { return NULL; }
+
+  iterator find(const Key& key) {
+    int i = FindIndex(key, HashOf(key));
+    return i < 0 ? NULL : &slots_[i].entry;
+  }
+  const_iterator find(const Key& key) const {
+    int i = FindIndex(key, HashOf(key));
+    return i < 0 ? NULL : &slots_[i].entry;
+  }
+
+  std::pair<iterator, bool> insert(const value_type& value) {
+    const uint32 hash = HashOf(value.first);
+    int i = FindIndex(value.first, hash);
+    if (i >= 0) return std::make_pair(&slots_[i].entry, false);
+    // Keep the table at most 3/4 full so that probe sequences stay short.
+    if ((size_ + 1) * 4 > slots_.size() * 3) Grow();
+    i = FindEmptyIndex(hash);
+    slots_[i].hash = hash;
+    slots_[i].entry.first = value.first;
+    slots_[i].entry.second = value.second;
+    size_++;
+    return std::make_pair(&slots_[i].entry, true);
+  }
+
+  void erase(const Key& key) {
+    int i = FindIndex(key, HashOf(key));
+    if (i < 0) return;
+    // Rather than leaving a tombstone, move later entries of the probe
+    // sequence back into the hole whenever the hole lies between their home
+    // slot and their current one.
+    const int mask = slots_.size() - 1;
+    for (int j = (i + 1) & mask; slots_[j].hash != kEmpty;
+         j = (j + 1) & mask) {
+      const int home = slots_[j].hash & mask;
+      if (((j - home) & mask) >= ((j - i) & mask)) {
+        slots_[i] = slots_[j];
+        i = j;
+      }
+    }
+    slots_[i] = Slot();
+    size_--;
+  }
+
+ private:
+  static const uint32 kEmpty = 0;
+
+  struct Slot {
+    Slot() : hash(kEmpty), entry() {}
+    uint32 hash;
+    std::pair<Key, Value> entry;
+  };
+
+  static uint32 HashOf(const Key& key) {
+    const uint32 hash = MixHash(Hash()(key));
+    return hash == kEmpty ? 1 : hash;
+  }
+
+  // Returns -1 if the key is not present.
+  int FindIndex(const Key& key, uint32 hash) const {
+    if (slots_.empty()) return -1;
+    const int mask = slots_.size() - 1;
+    for (int i = hash & mask; slots_[i].hash != kEmpty; i = (i + 1) & mask) {
+      if (slots_[i].hash == hash && Equal()(slots_[i].entry.first, key)) {
+        return i;
+      }
+    }
+    return -1;
+  }
+
+  int FindEmptyIndex(uint32 hash) const {
+    const int mask = slots_.size() - 1;
+    int i = hash & mask;
+    while (slots_[i].hash != kEmpty) i = (i + 1) & mask;
+    return i;
+  }
+
+  void Grow() {
+    std::vector<Slot> old_slots;
+    old_slots.swap(slots_);
+    // The size is always a power of two.
+    slots_.resize(old_slots.empty() ? 8 : old_slots.size() * 2);
+    for (int i = 0; i < old_slots.size(); i++) {
+      if (old_slots[i].hash != kEmpty) {
+        slots_[FindEmptyIndex(old_slots[i].hash)] = old_slots[i];
+      }
+    }
   }
+
+  std::vector<Slot> slots_;
+  int size_;
 };
 
 
 const Symbol kNullSymbol;
 
-typedef hash_map<const char*, Symbol,
-                 hash<const char*>, streq>
+typedef FlatHashMap<const char*, Symbol, CStringHash, streq>
   SymbolsByNameMap;
-typedef hash_map<PointerStringPair, Symbol,
-                 PointerStringPairHash, PointerStringPairEqual>
+typedef FlatHashMap<PointerStringPair, Symbol,
+                    PointerStringPairHash, PointerStringPairEqual>
   SymbolsByParentMap;
-typedef hash_map<const char*, const FileDescriptor*,
-                 hash<const char*>, streq>
+typedef FlatHashMap<const char*, const FileDescriptor*, CStringHash, streq>
   FilesByNameMap;
-typedef hash_map<PointerStringPair, const FieldDescriptor*,
-                 PointerStringPairHash, PointerStringPairEqual>
+typedef FlatHashMap<PointerStringPair, const FieldDescriptor*,
+                    PointerStringPairHash, PointerStringPairEqual>
   FieldsByNameMap;
-typedef hash_map<DescriptorIntPair, const FieldDescriptor*,
-                 PointerIntegerPairHash<DescriptorIntPair> >
+typedef FlatHashMap<DescriptorIntPair, const FieldDescriptor*,
+                    PointerIntegerPairHash<DescriptorIntPair>,
+                    PointerIntegerPairEqual<DescriptorIntPair> >
   FieldsByNumberMap;
-typedef hash_map<EnumIntPair, const EnumValueDescriptor*,
-                 PointerIntegerPairHash<EnumIntPair> >
+typedef FlatHashMap<EnumIntPair, const EnumValueDescriptor*,
+                    PointerIntegerPairHash<EnumIntPair>,
+                    PointerIntegerPairEqual<EnumIntPair> >
   EnumValuesByNumberMap;
-// This is a map rather than a hash_map, since we use it to iterate
+// This is a map rather than a hash table, since we use it to iterate
 // through all the extensions that extend a given Descriptor, and an
 // ordered data structure that implements lower_bound is convenient
 // for that.
@@ -470,6 +592,105 @@ typedef std::map<DescriptorIntPair, const FieldDescriptor*>
   ExtensionsGroupedByDescriptorMap;
 typedef hash_map<string, const SourceCodeInfo_Location*> LocationsByPathMap;
 
+// An insert-only hash table whose lookups never block.  Insertions must be
+// serialized by the caller (DescriptorPool::Tables does so under the pool's
+// mutex), but Find() may run concurrently with them.  A slot's key and value
+// are written before its hash is stored with a release store, which marks the
+// slot as used, and a grown table is fully populated before it is published,
+// so readers see either a complete entry or an empty slot.  Replaced tables
+// are kept until the map is destroyed since readers may still be probing
+// them; because each table is twice the size of the last, this at most
+// doubles the memory used.
+template <typename Key, typename Value, typename Hash, typename Equal>
+class ConcurrentReadMap {
+ public:
+  ConcurrentReadMap() : table_(0) {}
+  ~ConcurrentReadMap() { STLDeleteElements(&tables_); }
+
+  // Returns false if the key is not present.
+  bool Find(const Key& key, Value* value) const {
+    const Table* table =
+        reinterpret_cast<const Table*>(internal::Acquire_Load(&table_));
+    if (table == NULL) return false;
+    const uint32 hash = HashOf(key);
+    const uint32 mask = table->slots.size() - 1;
+    for (uint32 i = hash & mask; ; i = (i + 1) & mask) {
+      const Slot& slot = table->slots[i];
+      const uint32 slot_hash = internal::Acquire_Load(&slot.hash);
+      if (slot_hash == kEmpty) return false;
+      if (slot_hash == hash && Equal()(slot.key, key)) {
+        *value = slot.value;
+        return true;
+      }
+    }
+  }
+
+  // The key must not already be present.
+  void Insert(const Key& key, const Value& value) {
+    Table* table = reinterpret_cast<Table*>(table_);
+    if (table == NULL || (table->size + 1) * 4 > table->slots.size() * 3) {
+      Table* grown = new Table(table == NULL ? 16 : table->slots.size() * 2);
+      if (table != NULL) {
+        for (int i = 0; i < table->slots.size(); i++) {
+          const Slot& slot = table->slots[i];
+          if (slot.hash != kEmpty) {
+            InsertInto(grown, slot.hash, slot.key, slot.value);
+          }
+        }
+      }
+      tables_.push_back(grown);
+      internal::Release_Store(&table_,
+                              reinterpret_cast<internal::AtomicWord>(grown));
+      table = grown;
+    }
+    InsertInto(table, HashOf(key), key, value);
+  }
+
+ private:
+  static const uint32 kEmpty = 0;
+
+  struct Slot {
+    Slot() : hash(kEmpty), key(), value() {}
+    internal::Atomic32 hash;
+    Key key;
+    Value value;
+  };
+  struct Table {
+    explicit Table(int capacity) : slots(capacity), size(0) {}
+    std::vector<Slot> slots;  // The size is always a power of two.
+    int size;
+  };
+
+  static uint32 HashOf(const Key& key) {
+    const uint32 hash = MixHash(Hash()(key));
+    return hash == kEmpty ? 1 : hash;
+  }
+
+  static void InsertInto(Table* table, uint32 hash, const Key& key,
+                         const Value& value) {
+    const uint32 mask = table->slots.size() - 1;
+    uint32 i = hash & mask;
+    while (table->slots[i].hash != kEmpty) i = (i + 1) & mask;
+    table->slots[i].key = key;
+    table->slots[i].value = value;
+    internal::Release_Store(&table->slots[i].hash, hash);
+    table->size++;
+  }
+
+  internal::AtomicWord table_;   // The current Table.
+  std::vector<Table*> tables_;   // All tables ever allocated.
+};
+
+typedef ConcurrentReadMap<const char*, Symbol, CStringHash, streq>
+  PublishedSymbolsMap;
+typedef ConcurrentReadMap<const char*, const FileDescriptor*, CStringHash,
+                          streq>
+  PublishedFilesMap;
+typedef ConcurrentReadMap<DescriptorIntPair, const FieldDescriptor*,
+                          PointerIntegerPairHash<DescriptorIntPair>,
+                          PointerIntegerPairEqual<DescriptorIntPair> >
+  PublishedExtensionsMap;
+
 std::set<string>* allowed_proto3_extendees_ = NULL;
 GOOGLE_PROTOBUF_DECLARE_ONCE(allowed_proto3_extendees_init_);
 
@@ -553,6 +774,12 @@ class DescriptorPool::Tables {
   // stack, removing everything that was added after that point.
   void RollbackToLastCheckpoint();
 
+  // Makes each symbol, file and extension visible to the Find*Published()
+  // methods once the checkpoint that added it has been cleared.  Only pools
+  // that lock their mutex for lookups (those with a fallback database) need
+  // this.
+  void EnableLockFreeLookups() { publish_committed_ = true; }
+
   // The stack of files which are currently being built.  Used to detect
   // cyclic dependencies when loading files from a DescriptorDatabase.  Not
   // used when fallback_database_ == NULL.
@@ -575,6 +802,12 @@ class DescriptorPool::Tables {
   // set of extensions numbers from fallback_database_.
   hash_set<const Descriptor*> extensions_loaded_from_db_;
 
+  // Clears known_bad_files_ and known_bad_symbols_ at the beginning of a
+  // public API call.  Only a fallback database fills them, so without one
+  // this writes nothing and lookups remain safe to make from several threads
+  // at once, as BuildFiles() does.
+  inline void ClearKnownBad();
+
   // -----------------------------------------------------------------
   // Finding items.
 
@@ -593,6 +826,17 @@ class DescriptorPool::Tables {
   inline const FileDescriptor* FindFile(const string& key) const;
   inline const FieldDescriptor* FindExtension(const Descriptor* extendee,
                                               int number);
+
+  // Like FindSymbol(), FindFile() and FindExtension(), but only see items
+  // which have been committed, and may be called without holding the pool's
+  // mutex.  The pool's underlay and fallback database are not consulted.
+  // Everything these can find will stay in the tables until they are
+  // destroyed, so the Find*() methods of a pool with a fallback database try
+  // these first and take the mutex only when they miss.
+  inline Symbol FindPublishedSymbol(const string& key) const;
+  inline const FileDescriptor* FindPublishedFile(const string& key) const;
+  inline const FieldDescriptor* FindPublishedExtension(
+      const Descriptor* extendee, int number) const;
   inline void FindAllExtensions(const Descriptor* extendee,
                                 std::vector<const FieldDescriptor*>* out) const;
 
@@ -607,6 +851,11 @@ class DescriptorPool::Tables {
   bool AddFile(const FileDescriptor* file);
   bool AddExtension(const FieldDescriptor* field);
 
+  // Moves everything added to "other" since its only checkpoint into this
+  // table, clearing the checkpoint.  Returns false, changing nothing, if any
+  // file, extension or non-package symbol is already defined here.
+  bool AdoptFrom(Tables* other);
+
   // -----------------------------------------------------------------
   // Allocating memory.
 
@@ -650,6 +899,13 @@ class DescriptorPool::Tables {
   FilesByNameMap        files_by_name_;
   ExtensionsGroupedByDescriptorMap extensions_;
 
+  // Committed contents of the three maps above, readable without the mutex.
+  // Only populated if EnableLockFreeLookups() has been called.
+  bool publish_committed_;
+  PublishedSymbolsMap    published_symbols_;
+  PublishedFilesMap      published_files_;
+  PublishedExtensionsMap published_extensions_;
+
   struct CheckPoint {
     explicit CheckPoint(const Tables* tables)
         : strings_before_checkpoint(tables->strings_.size()),
@@ -774,8 +1030,7 @@ DescriptorPool::Tables::Tables()
     : known_bad_files_(3),
       known_bad_symbols_(3),
       extensions_loaded_from_db_(3),
-      symbols_by_name_(3),
-      files_by_name_(3) {}
+      publish_committed_(false) {}
 
 
 DescriptorPool::Tables::~Tables() {
@@ -791,15 +1046,7 @@ DescriptorPool::Tables::~Tables() {
   STLDeleteElements(&once_dynamics_);
 }
 
-FileDescriptorTables::FileDescriptorTables()
-    // Initialize all the hash tables to start out with a small # of buckets
-    : symbols_by_parent_(3),
-      fields_by_lowercase_name_(3),
-      fields_by_camelcase_name_(3),
-      fields_by_number_(3),
-      enum_values_by_number_(3),
-      unknown_enum_values_by_number_(3) {
-}
+FileDescriptorTables::FileDescriptorTables() {}
 
 FileDescriptorTables::~FileDescriptorTables() {}
 
@@ -830,6 +1077,11 @@ inline const FileDescriptorTables& FileDescriptorTables::GetEmptyInstance() {
   return *file_descriptor_tables_;
 }
 
+inline void DescriptorPool::Tables::ClearKnownBad() {
+  if (!known_bad_files_.empty()) known_bad_files_.clear();
+  if (!known_bad_symbols_.empty()) known_bad_symbols_.clear();
+}
+
 void DescriptorPool::Tables::AddCheckpoint() {
   checkpoints_.push_back(CheckPoint(this));
 }
@@ -840,6 +1092,20 @@ void DescriptorPool::Tables::ClearLastCheckpoint() {
   if (checkpoints_.empty()) {
     // All checkpoints have been cleared: we can now commit all of the pending
     // data.
+    if (publish_committed_) {
+      for (int i = 0; i < symbols_after_checkpoint_.size(); i++) {
+        const char* name = symbols_after_checkpoint_[i];
+        published_symbols_.Insert(name, FindOrDie(symbols_by_name_, name));
+      }
+      for (int i = 0; i < files_after_checkpoint_.size(); i++) {
+        const char* name = files_after_checkpoint_[i];
+        published_files_.Insert(name, FindOrDie(files_by_name_, name));
+      }
+      for (int i = 0; i < extensions_after_checkpoint_.size(); i++) {
+        const DescriptorIntPair& key = extensions_after_checkpoint_[i];
+        published_extensions_.Insert(key, FindOrDieNoPrint(extensions_, key));
+      }
+    }
     symbols_after_checkpoint_.clear();
     files_after_checkpoint_.clear();
     extensions_after_checkpoint_.clear();
@@ -926,11 +1192,22 @@ inline Symbol FileDescriptorTables::FindNestedSymbolOfType(
   return result;
 }
 
+inline Symbol DescriptorPool::Tables::FindPublishedSymbol(
+    const string& key) const {
+  Symbol result;
+  return published_symbols_.Find(key.c_str(), &result) ? result : kNullSymbol;
+}
+
 Symbol DescriptorPool::Tables::FindByNameHelper(
     const DescriptorPool* pool, const string& name) {
+  if (pool->mutex_ != NULL) {
+    // Fast path:  the symbol has already been built.
+    Symbol result = FindPublishedSymbol(name);
+    if (!result.IsNull()) return result;
+  }
+
   MutexLockMaybe lock(pool->mutex_);
-  known_bad_symbols_.clear();
-  known_bad_files_.clear();
+  ClearKnownBad();
   Symbol result = FindSymbol(name);
 
   if (result.IsNull() && pool->underlay_ != NULL) {
@@ -1034,6 +1311,20 @@ inline const FieldDescriptor* DescriptorPool::Tables::FindExtension(
   return FindPtrOrNull(extensions_, std::make_pair(extendee, number));
 }
 
+inline const FileDescriptor* DescriptorPool::Tables::FindPublishedFile(
+    const string& key) const {
+  const FileDescriptor* result = NULL;
+  published_files_.Find(key.c_str(), &result);
+  return result;
+}
+
+inline const FieldDescriptor* DescriptorPool::Tables::FindPublishedExtension(
+    const Descriptor* extendee, int number) const {
+  const FieldDescriptor* result = NULL;
+  published_extensions_.Find(std::make_pair(extendee, number), &result);
+  return result;
+}
+
 inline void DescriptorPool::Tables::FindAllExtensions(
     const Descriptor* extendee,
     std::vector<const FieldDescriptor*>* out) const {
@@ -1112,6 +1403,70 @@ bool DescriptorPool::Tables::AddExtension(const FieldDescriptor* field) {
   }
 }
 
+bool DescriptorPool::Tables::AdoptFrom(Tables* other) {
+  GOOGLE_DCHECK_EQ(1, other->checkpoints_.size());
+  const std::vector<const char*>& symbols = other->symbols_after_checkpoint_;
+  const std::vector<const char*>& files = other->files_after_checkpoint_;
+  const std::vector<DescriptorIntPair>& extensions =
+      other->extensions_after_checkpoint_;
+
+  // Look for conflicts before changing anything.
+  for (int i = 0; i < symbols.size(); i++) {
+    const Symbol* existing = FindOrNull(symbols_by_name_, symbols[i]);
+    // It's OK to redefine a package.
+    if (existing != NULL &&
+        (existing->type != Symbol::PACKAGE ||
+         FindOrDie(other->symbols_by_name_, symbols[i]).type !=
+             Symbol::PACKAGE)) {
+      return false;
+    }
+  }
+  for (int i = 0; i < files.size(); i++) {
+    if (FindOrNull(files_by_name_, files[i]) != NULL) return false;
+  }
+  for (int i = 0; i < extensions.size(); i++) {
+    if (FindOrNull(extensions_, extensions[i]) != NULL) return false;
+  }
+
+  AddCheckpoint();
+  for (int i = 0; i < symbols.size(); i++) {
+    if (InsertIfNotPresent(&symbols_by_name_, symbols[i],
+                           FindOrDie(other->symbols_by_name_, symbols[i]))) {
+      symbols_after_checkpoint_.push_back(symbols[i]);
+    }
+  }
+  for (int i = 0; i < files.size(); i++) {
+    AddFile(FindOrDie(other->files_by_name_, files[i]));
+  }
+  for (int i = 0; i < extensions.size(); i++) {
+    AddExtension(FindOrDieNoPrint(other->extensions_, extensions[i]));
+  }
+  ClearLastCheckpoint();
+
+  strings_.insert(strings_.end(),
+                  other->strings_.begin(), other->strings_.end());
+  messages_.insert(messages_.end(),
+                   other->messages_.begin(), other->messages_.end());
+  once_dynamics_.insert(once_dynamics_.end(),
+                        other->once_dynamics_.begin(),
+                        other->once_dynamics_.end());
+  file_tables_.insert(file_tables_.end(),
+                      other->file_tables_.begin(), other->file_tables_.end());
+  allocations_.insert(allocations_.end(),
+                      other->allocations_.begin(), other->allocations_.end());
+  other->strings_.clear();
+  other->messages_.clear();
+  other->once_dynamics_.clear();
+  other->file_tables_.clear();
+  other->allocations_.clear();
+
+  other->checkpoints_.clear();
+  other->symbols_after_checkpoint_.clear();
+  other->files_after_checkpoint_.clear();
+  other->extensions_after_checkpoint_.clear();
+  return true;
+}
+
 // -------------------------------------------------------------------
 
 template<typename Type>
@@ -1180,6 +1535,19 @@ const SourceCodeInfo_Location* FileDescriptorTables::GetSourceLocation(
 // ===================================================================
 // DescriptorPool
 
+namespace {
+
+// Source of DescriptorPool::InternalUniqueId().  This is a plain word rather
+// than an internal::SequenceNumber so that it is already zero for pools built
+// during static initialization, like the generated pool.
+internal::AtomicWord next_descriptor_pool_id_ = 0;
+
+int64 NextDescriptorPoolId() {
+  return internal::NoBarrier_AtomicIncrement(&next_descriptor_pool_id_, 1);
+}
+
+}  // namespace
+
 DescriptorPool::ErrorCollector::~ErrorCollector() {}
 
 DescriptorPool::DescriptorPool()
@@ -1192,7 +1560,8 @@ DescriptorPool::DescriptorPool()
     lazily_build_dependencies_(false),
     allow_unknown_(false),
     enforce_weak_(false),
-    disallow_enforce_utf8_(false) {}
+    disallow_enforce_utf8_(false),
+    unique_id_(NextDescriptorPoolId()) {}
 
 DescriptorPool::DescriptorPool(DescriptorDatabase* fallback_database,
                                ErrorCollector* error_collector)
@@ -1205,7 +1574,9 @@ DescriptorPool::DescriptorPool(DescriptorDatabase* fallback_database,
     lazily_build_dependencies_(false),
     allow_unknown_(false),
     enforce_weak_(false),
-    disallow_enforce_utf8_(false) {
+    disallow_enforce_utf8_(false),
+    unique_id_(NextDescriptorPoolId()) {
+  tables_->EnableLockFreeLookups();
 }
 
 DescriptorPool::DescriptorPool(const DescriptorPool* underlay)
@@ -1218,7 +1589,8 @@ DescriptorPool::DescriptorPool(const DescriptorPool* underlay)
     lazily_build_dependencies_(false),
     allow_unknown_(false),
     enforce_weak_(false),
-    disallow_enforce_utf8_(false) {}
+    disallow_enforce_utf8_(false),
+    unique_id_(NextDescriptorPoolId()) {}
 
 DescriptorPool::~DescriptorPool() {
   if (mutex_ != NULL) delete mutex_;
@@ -1304,14 +1676,20 @@ void DescriptorPool::InternalAddGeneratedFile(
   //
   // Once one of these happens, the DescriptorPool actually parses the
   // FileDescriptorProto and generates a FileDescriptor (and all its children)
-  // based on it.
+  // based on it.  Since the generated pool builds dependencies lazily, only
+  // the file containing the requested type is built.
+  //
+  // We do not even index the file here: a binary may link thousands of
+  // .proto files, most of which it never reflects on.  The generated database
+  // indexes all registered files at once, reading only their symbol names,
+  // the first time it is queried.
   //
   // Note that FileDescriptorProto is itself a generated protocol message.
   // Therefore, when we parse one, we have to be very careful to avoid using
   // any descriptor-based operations, since this might cause infinite recursion
   // or deadlock.
   InitGeneratedPoolOnce();
-  GOOGLE_CHECK(generated_database_->Add(encoded_file_descriptor, size));
+  generated_database_->AddLazily(encoded_file_descriptor, size);
 }
 
 
@@ -1322,9 +1700,12 @@ void DescriptorPool::InternalAddGeneratedFile(
 //   there's nothing more important to do (read: never).
 
 const FileDescriptor* DescriptorPool::FindFileByName(const string& name) const {
+  if (mutex_ != NULL) {
+    const FileDescriptor* result = tables_->FindPublishedFile(name);
+    if (result != NULL) return result;
+  }
   MutexLockMaybe lock(mutex_);
-  tables_->known_bad_symbols_.clear();
-  tables_->known_bad_files_.clear();
+  tables_->ClearKnownBad();
   const FileDescriptor* result = tables_->FindFile(name);
   if (result != NULL) return result;
   if (underlay_ != NULL) {
@@ -1340,9 +1721,12 @@ const FileDescriptor* DescriptorPool::FindFileByName(const string& name) const {
 
 const FileDescriptor* DescriptorPool::FindFileContainingSymbol(
     const string& symbol_name) const {
+  if (mutex_ != NULL) {
+    Symbol result = tables_->FindPublishedSymbol(symbol_name);
+    if (!result.IsNull()) return result.GetFile();
+  }
   MutexLockMaybe lock(mutex_);
-  tables_->known_bad_symbols_.clear();
-  tables_->known_bad_files_.clear();
+  tables_->ClearKnownBad();
   Symbol result = tables_->FindSymbol(symbol_name);
   if (!result.IsNull()) return result.GetFile();
   if (underlay_ != NULL) {
@@ -1418,9 +1802,13 @@ const MethodDescriptor* DescriptorPool::FindMethodByName(
 
 const FieldDescriptor* DescriptorPool::FindExtensionByNumber(
     const Descriptor* extendee, int number) const {
+  if (mutex_ != NULL) {
+    const FieldDescriptor* result =
+        tables_->FindPublishedExtension(extendee, number);
+    if (result != NULL) return result;
+  }
   MutexLockMaybe lock(mutex_);
-  tables_->known_bad_symbols_.clear();
-  tables_->known_bad_files_.clear();
+  tables_->ClearKnownBad();
   const FieldDescriptor* result = tables_->FindExtension(extendee, number);
   if (result != NULL) {
     return result;
@@ -1442,8 +1830,7 @@ void DescriptorPool::FindAllExtensions(
     const Descriptor* extendee,
     std::vector<const FieldDescriptor*>* out) const {
   MutexLockMaybe lock(mutex_);
-  tables_->known_bad_symbols_.clear();
-  tables_->known_bad_files_.clear();
+  tables_->ClearKnownBad();
 
   // Initialize tables_->extensions_ from the fallback database first
   // (but do this only once per descriptor).
@@ -3391,8 +3778,7 @@ const FileDescriptor* DescriptorPool::BuildFile(
        "DescriptorDatabase.  You must instead find a way to get your file "
        "into the underlying database.";
   GOOGLE_CHECK(mutex_ == NULL);   // Implied by the above GOOGLE_CHECK.
-  tables_->known_bad_symbols_.clear();
-  tables_->known_bad_files_.clear();
+  tables_->ClearKnownBad();
   return DescriptorBuilder(this, tables_.get(), NULL).BuildFile(proto);
 }
 
@@ -3404,8 +3790,7 @@ const FileDescriptor* DescriptorPool::BuildFileCollectingErrors(
        "DescriptorDatabase.  You must instead find a way to get your file "
        "into the underlying database.";
   GOOGLE_CHECK(mutex_ == NULL);   // Implied by the above GOOGLE_CHECK.
-  tables_->known_bad_symbols_.clear();
-  tables_->known_bad_files_.clear();
+  tables_->ClearKnownBad();
   return DescriptorBuilder(this, tables_.get(),
                            error_collector).BuildFile(proto);
 }
@@ -3425,6 +3810,255 @@ const FileDescriptor* DescriptorPool::BuildFileFromDatabase(
   return result;
 }
 
+// -------------------------------------------------------------------
+// BuildFiles()
+
+namespace {
+
+// Notes whether a DescriptorBuilder reported anything at all.
+class ReportedAnythingCollector : public DescriptorPool::ErrorCollector {
+ public:
+  ReportedAnythingCollector() : reported_anything_(false) {}
+  virtual ~ReportedAnythingCollector() {}
+
+  virtual void AddError(const string& filename, const string& element_name,
+                        const Message* descriptor, ErrorLocation location,
+                        const string& message) {
+    reported_anything_ = true;
+  }
+  virtual void AddWarning(const string& filename, const string& element_name,
+                          const Message* descriptor, ErrorLocation location,
+                          const string& message) {
+    reported_anything_ = true;
+  }
+
+  bool reported_anything() const { return reported_anything_; }
+
+ private:
+  bool reported_anything_;
+};
+
+}  // namespace
+
+// Builds the files of a batch in waves, each wave holding the files whose
+// imports from the batch have all been built.  Files of the same wave cannot
+// refer to each other, so each of them is built on whichever thread is free,
+// into a scratch pool which lies over the target pool; the target pool then
+// adopts the results in batch order.  Any file which is out of the ordinary
+// -- it had errors or warnings, needed placeholders, or conflicts with a file
+// adopted before it -- is built again directly in the target pool instead,
+// so that the outcome and the errors reported match BuildFile()'s exactly.
+class DescriptorPool::FileBatch {
+ public:
+  FileBatch(DescriptorPool* pool, const FileDescriptorSet& files,
+            ErrorCollector* error_collector)
+      : pool_(pool),
+        files_(files),
+        error_collector_(error_collector),
+        results_(files.file_size(), NULL),
+        next_scratch_file_(0) {}
+
+  bool Build(int num_threads, std::vector<const FileDescriptor*>* output);
+
+ private:
+  struct ScratchFile {
+    int index;  // In files_.
+    DescriptorPool* pool;
+    const FileDescriptor* result;
+    bool reported_anything;
+  };
+
+  // Builds files_.file(index) directly in pool_.
+  const FileDescriptor* BuildInPool(int index);
+
+  void BuildWave(const std::vector<int>& wave, int num_threads);
+
+  // Builds scratch_files_ until there are none left.  Runs on every thread.
+  void BuildScratchFiles();
+
+  // Moves the scratch file into pool_, or if it cannot, builds it again there.
+  const FileDescriptor* AdoptScratchFile(const ScratchFile& scratch_file);
+
+  DescriptorPool* pool_;
+  const FileDescriptorSet& files_;
+  ErrorCollector* error_collector_;
+  std::vector<const FileDescriptor*> results_;
+
+  std::vector<ScratchFile> scratch_files_;
+  volatile internal::Atomic32 next_scratch_file_;
+
+  GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(FileBatch);
+};
+
+bool DescriptorPool::FileBatch::Build(
+    int num_threads, std::vector<const FileDescriptor*>* output) {
+#if !LANG_CXX11
+  // Without threads, scratch pools would only add work.
+  num_threads = 1;
+#endif
+
+  // Find which files of the batch each file waits for.  A file repeating the
+  // name of an earlier one waits for that one, so that it is then compared to
+  // it as BuildFile() would.
+  const int file_count = files_.file_size();
+  std::map<string, int> index_by_name;
+  std::vector<std::vector<int> > waiting_files(file_count);
+  std::vector<int> wait_counts(file_count, 0);
+  for (int i = 0; i < file_count; i++) {
+    std::pair<std::map<string, int>::iterator, bool> inserted =
+        index_by_name.insert(std::make_pair(files_.file(i).name(), i));
+    if (!inserted.second) {
+      waiting_files[inserted.first->second].push_back(i);
+      wait_counts[i]++;
+    }
+  }
+  for (int i = 0; i < file_count; i++) {
+    const FileDescriptorProto& file = files_.file(i);
+    for (int j = 0; j < file.dependency_size(); j++) {
+      const int* dependency = FindOrNull(index_by_name, file.dependency(j));
+      if (dependency != NULL && *dependency != i) {
+        waiting_files[*dependency].push_back(i);
+        wait_counts[i]++;
+      }
+    }
+  }
+
+  std::vector<int> wave;
+  for (int i = 0; i < file_count; i++) {
+    if (wait_counts[i] == 0) wave.push_back(i);
+  }
+  while (!wave.empty()) {
+    BuildWave(wave, num_threads);
+    std::vector<int> next_wave;
+    for (int i = 0; i < wave.size(); i++) {
+      const std::vector<int>& waiting = waiting_files[wave[i]];
+      for (int j = 0; j < waiting.size(); j++) {
+        if (--wait_counts[waiting[j]] == 0) next_wave.push_back(waiting[j]);
+      }
+    }
+    std::sort(next_wave.begin(), next_wave.end());
+    wave.swap(next_wave);
+  }
+
+  // Files still waiting import each other in a cycle.  Building them reports
+  // the imports which could not be found.
+  for (int i = 0; i < file_count; i++) {
+    if (wait_counts[i] > 0) results_[i] = BuildInPool(i);
+  }
+
+  if (output != NULL) *output = results_;
+  return std::find(results_.begin(), results_.end(),
+                   static_cast<const FileDescriptor*>(NULL)) == results_.end();
+}
+
+const FileDescriptor* DescriptorPool::FileBatch::BuildInPool(int index) {
+  return DescriptorBuilder(pool_, pool_->tables_.get(), error_collector_)
+      .BuildFile(files_.file(index));
+}
+
+void DescriptorPool::FileBatch::BuildWave(const std::vector<int>& wave,
+                                          int num_threads) {
+  // Placeholders would be created in the scratch pools, and lazily built
+  // dependencies in the target pool while it is being read, so such pools
+  // build one file at a time.  So do files which are already in the pool,
+  // which BuildFile() checks for being identical.
+  scratch_files_.clear();
+  if (num_threads > 1 && wave.size() > 1 && !pool_->allow_unknown_ &&
+      !pool_->lazily_build_dependencies_) {
+    for (int i = 0; i < wave.size(); i++) {
+      if (pool_->tables_->FindFile(files_.file(wave[i]).name()) == NULL) {
+        ScratchFile scratch_file = { wave[i], NULL, NULL, false };
+        scratch_files_.push_back(scratch_file);
+      }
+    }
+  }
+
+  if (scratch_files_.size() > 1) {
+    next_scratch_file_ = 0;
+#if LANG_CXX11
+    std::vector<std::thread> threads;
+    const int thread_count =
+        std::min(num_threads, static_cast<int>(scratch_files_.size()));
+    for (int i = 1; i < thread_count; i++) {
+      threads.push_back(std::thread(&FileBatch::BuildScratchFiles, this));
+    }
+#endif
+    BuildScratchFiles();
+#if LANG_CXX11
+    for (int i = 0; i < threads.size(); i++) {
+      threads[i].join();
+    }
+#endif
+  } else {
+    scratch_files_.clear();
+  }
+
+  std::vector<ScratchFile>::const_iterator scratch_file =
+      scratch_files_.begin();
+  for (int i = 0; i < wave.size(); i++) {
+    if (scratch_file != scratch_files_.end() &&
+        scratch_file->index == wave[i]) {
+      results_[wave[i]] = AdoptScratchFile(*scratch_file++);
+    } else {
+      results_[wave[i]] = BuildInPool(wave[i]);
+    }
+  }
+}
+
+void DescriptorPool::FileBatch::BuildScratchFiles() {
+  for (;;) {
+    const int next =
+        internal::NoBarrier_AtomicIncrement(&next_scratch_file_, 1) - 1;
+    if (next >= scratch_files_.size()) return;
+    ScratchFile* scratch_file = &scratch_files_[next];
+
+    DescriptorPool* pool = new DescriptorPool(pool_);
+    pool->enforce_dependencies_ = pool_->enforce_dependencies_;
+    pool->enforce_weak_ = pool_->enforce_weak_;
+    pool->unused_import_track_files_ = pool_->unused_import_track_files_;
+    pool->disallow_enforce_utf8_ = pool_->disallow_enforce_utf8_;
+    // Keep what the file adds listed after a checkpoint, for AdoptFrom().
+    pool->tables_->AddCheckpoint();
+
+    ReportedAnythingCollector collector;
+    scratch_file->pool = pool;
+    scratch_file->result =
+        DescriptorBuilder(pool, pool->tables_.get(), &collector)
+            .BuildFile(files_.file(scratch_file->index));
+    scratch_file->reported_anything = collector.reported_anything();
+  }
+}
+
+const FileDescriptor* DescriptorPool::FileBatch::AdoptScratchFile(
+    const ScratchFile& scratch_file) {
+  google::protobuf::scoped_ptr<DescriptorPool> pool(scratch_file.pool);
+  FileDescriptor* result = const_cast<FileDescriptor*>(scratch_file.result);
+  bool can_adopt = result != NULL && !scratch_file.reported_anything;
+  for (int i = 0; can_adopt && i < result->dependency_count(); i++) {
+    // A missing weak import was replaced by a placeholder in the scratch pool.
+    can_adopt = !result->dependency(i)->is_placeholder();
+  }
+  if (can_adopt && pool_->tables_->AdoptFrom(pool->tables_.get())) {
+    result->pool_ = pool_;
+    return result;
+  }
+  pool->tables_->ClearLastCheckpoint();
+  return BuildInPool(scratch_file.index);
+}
+
+bool DescriptorPool::BuildFiles(const FileDescriptorSet& files,
+                                int num_threads,
+                                ErrorCollector* error_collector,
+                                std::vector<const FileDescriptor*>* output) {
+  GOOGLE_CHECK(fallback_database_ == NULL)
+    << "Cannot call BuildFiles on a DescriptorPool that uses a "
+       "DescriptorDatabase.  You must instead find a way to get your files "
+       "into the underlying database.";
+  GOOGLE_CHECK(mutex_ == NULL);   // Implied by the above GOOGLE_CHECK.
+  tables_->ClearKnownBad();
+  return FileBatch(this, files, error_collector).Build(num_threads, output);
+}
+
 DescriptorBuilder::DescriptorBuilder(
     const DescriptorPool* pool,
     DescriptorPool::Tables* tables,
@@ -4319,8 +4953,10 @@ const FileDescriptor* DescriptorBuilder::BuildFileImpl(
     tables_->RollbackToLastCheckpoint();
     return NULL;
   } else {
-    tables_->ClearLastCheckpoint();
+    // Set this first:  clearing the checkpoint may make the file visible to
+    // lookups which do not take the pool's mutex.
     result->finished_building_ = true;
+    tables_->ClearLastCheckpoint();
     return result;
   }
 }
@@ -94,6 +94,7 @@ class EnumValueDescriptorProto;
 class ServiceDescriptorProto;
 class MethodDescriptorProto;
 class FileDescriptorProto;
+class FileDescriptorSet;
 class MessageOptions;
 class FieldOptions;
 class OneofOptions;
@@ -1574,6 +1575,20 @@ class LIBPROTOBUF_EXPORT DescriptorPool {
     const FileDescriptorProto& proto,
     ErrorCollector* error_collector);
 
+  // Builds a whole batch of files, such as the contents of a
+  // FileDescriptorSet.  Unlike with BuildFile(), the files may come in any
+  // order:  each may import files from anywhere in the batch as well as files
+  // already in the pool.  Files which do not depend on each other are built
+  // concurrently, on up to num_threads threads, and then added to the pool one
+  // at a time, so nothing else may use the pool until this returns.  Returns
+  // true if every file was built.  If output is not NULL, it is filled with
+  // the FileDescriptor for each file in the batch, in order, or NULL for files
+  // which had problems.  Errors go to error_collector as with
+  // BuildFileCollectingErrors(), or to GOOGLE_LOG(ERROR) if it is NULL.
+  bool BuildFiles(const FileDescriptorSet& files, int num_threads,
+                  ErrorCollector* error_collector,
+                  std::vector<const FileDescriptor*>* output);
+
   // By default, it is an error if a FileDescriptorProto contains references
   // to types or other files that are not found in the DescriptorPool (or its
   // backing DescriptorDatabase, if any).  If you call
@@ -1670,6 +1685,11 @@ class LIBPROTOBUF_EXPORT DescriptorPool {
   // lazy descriptor initialization behavior.
   bool InternalIsFileLoaded(const string& filename) const;
 
+  // For internal use only:  Returns an id that no other DescriptorPool in
+  // this process has, including pools later allocated at the same address.
+  // Lets caches keyed by pool tell a destroyed pool from its successor.
+  int64 InternalUniqueId() const { return unique_id_; }
+
 
   // Add a file to unused_import_track_files_. DescriptorBuilder will log
   // warnings for those files if there is any unused import.
@@ -1744,12 +1764,16 @@ class LIBPROTOBUF_EXPORT DescriptorPool {
   class Tables;
   google::protobuf::scoped_ptr<Tables> tables_;
 
+  // Does the work of BuildFiles().
+  class FileBatch;
+
   bool enforce_dependencies_;
   bool lazily_build_dependencies_;
   bool allow_unknown_;
   bool enforce_weak_;
   std::set<string> unused_import_track_files_;
   bool disallow_enforce_utf8_;
+  int64 unique_id_;
 
   GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(DescriptorPool);
 };
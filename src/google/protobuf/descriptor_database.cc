@@ -34,13 +34,36 @@
 
 #include <google/protobuf/descriptor_database.h>
 
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+#include <algorithm>
 #include <set>
 
 #include <google/protobuf/descriptor.pb.h>
+#include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/wire_format_lite_inl.h>
 #include <google/protobuf/stubs/strutil.h>
 #include <google/protobuf/stubs/stl_util.h>
 #include <google/protobuf/stubs/map_util.h>
+#include <google/protobuf/stubs/stringpiece.h>
+
+#ifndef O_BINARY
+#ifdef _O_BINARY
+#define O_BINARY _O_BINARY
+#else
+#define O_BINARY 0     // If this isn't defined, the platform doesn't need it.
+#endif
+#endif
 
 namespace google {
 namespace protobuf {
@@ -301,6 +324,164 @@ bool SimpleDescriptorDatabase::MaybeCopy(const FileDescriptorProto* file,
 
 // -------------------------------------------------------------------
 
+namespace {
+
+typedef internal::WireFormatLite WireFormatLite;
+
+#define LENGTH_DELIMITED_TAG(FIELD_NUMBER)                                  \
+  GOOGLE_PROTOBUF_WIRE_FORMAT_MAKE_TAG(FIELD_NUMBER,                        \
+                                       WireFormatLite::WIRETYPE_LENGTH_DELIMITED)
+
+// The Read*Symbols() functions below read the parts of an encoded
+// FileDescriptorProto which DescriptorIndex::AddFile() looks at -- the names
+// of the file, its package, its top-level symbols and its extensions -- and
+// skip everything else.  Fields, options and source code info make up most of
+// a file, so this is much cheaper than parsing it.
+
+template <typename Proto>
+bool ReadSymbolsFromSubMessage(io::CodedInputStream* input, Proto* proto,
+                               bool (*read)(io::CodedInputStream*, Proto*)) {
+  int length;
+  if (!input->ReadVarintSizeAsInt(&length)) return false;
+  std::pair<io::CodedInputStream::Limit, int> p =
+      input->IncrementRecursionDepthAndPushLimit(length);
+  if (p.second < 0 || !read(input, proto)) return false;
+  return input->DecrementRecursionDepthAndPopLimit(p.first);
+}
+
+// For enums and services, only the name is needed.
+template <typename Proto>
+bool ReadNameSymbol(io::CodedInputStream* input, Proto* proto) {
+  while (uint32 tag = input->ReadTag()) {
+    if (tag == LENGTH_DELIMITED_TAG(Proto::kNameFieldNumber)) {
+      if (!WireFormatLite::ReadString(input, proto->mutable_name())) {
+        return false;
+      }
+    } else if (!WireFormatLite::SkipField(input, tag)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool ReadExtensionSymbols(io::CodedInputStream* input,
+                          FieldDescriptorProto* extension) {
+  while (uint32 tag = input->ReadTag()) {
+    switch (tag) {
+      case LENGTH_DELIMITED_TAG(FieldDescriptorProto::kNameFieldNumber):
+        if (!WireFormatLite::ReadString(input, extension->mutable_name())) {
+          return false;
+        }
+        break;
+      case LENGTH_DELIMITED_TAG(FieldDescriptorProto::kExtendeeFieldNumber):
+        if (!WireFormatLite::ReadString(input,
+                                        extension->mutable_extendee())) {
+          return false;
+        }
+        break;
+      case GOOGLE_PROTOBUF_WIRE_FORMAT_MAKE_TAG(
+          FieldDescriptorProto::kNumberFieldNumber,
+          WireFormatLite::WIRETYPE_VARINT): {
+        int32 number;
+        if (!WireFormatLite::ReadPrimitive<int32, WireFormatLite::TYPE_INT32>(
+                input, &number)) {
+          return false;
+        }
+        extension->set_number(number);
+        break;
+      }
+      default:
+        if (!WireFormatLite::SkipField(input, tag)) return false;
+        break;
+    }
+  }
+  return true;
+}
+
+bool ReadMessageSymbols(io::CodedInputStream* input,
+                        DescriptorProto* message_type) {
+  while (uint32 tag = input->ReadTag()) {
+    switch (tag) {
+      case LENGTH_DELIMITED_TAG(DescriptorProto::kNameFieldNumber):
+        if (!WireFormatLite::ReadString(input,
+                                        message_type->mutable_name())) {
+          return false;
+        }
+        break;
+      // Nested types are only visited for their extensions.
+      case LENGTH_DELIMITED_TAG(DescriptorProto::kNestedTypeFieldNumber):
+        if (!ReadSymbolsFromSubMessage(input, message_type->add_nested_type(),
+                                       &ReadMessageSymbols)) {
+          return false;
+        }
+        break;
+      case LENGTH_DELIMITED_TAG(DescriptorProto::kExtensionFieldNumber):
+        if (!ReadSymbolsFromSubMessage(input, message_type->add_extension(),
+                                       &ReadExtensionSymbols)) {
+          return false;
+        }
+        break;
+      default:
+        if (!WireFormatLite::SkipField(input, tag)) return false;
+        break;
+    }
+  }
+  return true;
+}
+
+bool ReadFileSymbols(const std::pair<const void*, int>& encoded_file,
+                     FileDescriptorProto* file) {
+  io::CodedInputStream input(
+      reinterpret_cast<const uint8*>(encoded_file.first), encoded_file.second);
+  while (uint32 tag = input.ReadTag()) {
+    switch (tag) {
+      case LENGTH_DELIMITED_TAG(FileDescriptorProto::kNameFieldNumber):
+        if (!WireFormatLite::ReadString(&input, file->mutable_name())) {
+          return false;
+        }
+        break;
+      case LENGTH_DELIMITED_TAG(FileDescriptorProto::kPackageFieldNumber):
+        if (!WireFormatLite::ReadString(&input, file->mutable_package())) {
+          return false;
+        }
+        break;
+      case LENGTH_DELIMITED_TAG(FileDescriptorProto::kMessageTypeFieldNumber):
+        if (!ReadSymbolsFromSubMessage(&input, file->add_message_type(),
+                                       &ReadMessageSymbols)) {
+          return false;
+        }
+        break;
+      case LENGTH_DELIMITED_TAG(FileDescriptorProto::kEnumTypeFieldNumber):
+        if (!ReadSymbolsFromSubMessage(&input, file->add_enum_type(),
+                                       &ReadNameSymbol<EnumDescriptorProto>)) {
+          return false;
+        }
+        break;
+      case LENGTH_DELIMITED_TAG(FileDescriptorProto::kServiceFieldNumber):
+        if (!ReadSymbolsFromSubMessage(
+                &input, file->add_service(),
+                &ReadNameSymbol<ServiceDescriptorProto>)) {
+          return false;
+        }
+        break;
+      case LENGTH_DELIMITED_TAG(FileDescriptorProto::kExtensionFieldNumber):
+        if (!ReadSymbolsFromSubMessage(&input, file->add_extension(),
+                                       &ReadExtensionSymbols)) {
+          return false;
+        }
+        break;
+      default:
+        if (!WireFormatLite::SkipField(&input, tag)) return false;
+        break;
+    }
+  }
+  return input.ConsumedEntireMessage();
+}
+
+#undef LENGTH_DELIMITED_TAG
+
+}  // namespace
+
 EncodedDescriptorDatabase::EncodedDescriptorDatabase() {}
 EncodedDescriptorDatabase::~EncodedDescriptorDatabase() {
   for (int i = 0; i < files_to_delete_.size(); i++) {
@@ -328,21 +509,47 @@ bool EncodedDescriptorDatabase::AddCopy(
   return Add(copy, size);
 }
 
+void EncodedDescriptorDatabase::AddLazily(
+    const void* encoded_file_descriptor, int size) {
+  unindexed_files_.push_back(std::make_pair(encoded_file_descriptor, size));
+}
+
+void EncodedDescriptorDatabase::IndexUnindexedFilesSlow() {
+  // Index the files in the order they were added, so that conflicts are
+  // resolved as they would have been by Add().
+  std::vector<std::pair<const void*, int> > files;
+  files.swap(unindexed_files_);
+  FileDescriptorProto file;
+  for (int i = 0; i < files.size(); i++) {
+    file.Clear();
+    if (!ReadFileSymbols(files[i], &file)) {
+      GOOGLE_LOG(ERROR) << "Invalid file descriptor data passed to "
+                    "EncodedDescriptorDatabase::AddLazily().";
+      continue;
+    }
+    // AddFile() logs the conflict, if any.
+    index_.AddFile(file, files[i]);
+  }
+}
+
 bool EncodedDescriptorDatabase::FindFileByName(
     const string& filename,
     FileDescriptorProto* output) {
+  IndexUnindexedFiles();
   return MaybeParse(index_.FindFile(filename), output);
 }
 
 bool EncodedDescriptorDatabase::FindFileContainingSymbol(
     const string& symbol_name,
     FileDescriptorProto* output) {
+  IndexUnindexedFiles();
   return MaybeParse(index_.FindSymbol(symbol_name), output);
 }
 
 bool EncodedDescriptorDatabase::FindNameOfFileContainingSymbol(
     const string& symbol_name,
     string* output) {
+  IndexUnindexedFiles();
   std::pair<const void*, int> encoded_file = index_.FindSymbol(symbol_name);
   if (encoded_file.first == NULL) return false;
 
@@ -373,6 +580,7 @@ bool EncodedDescriptorDatabase::FindFileContainingExtension(
     const string& containing_type,
     int field_number,
     FileDescriptorProto* output) {
+  IndexUnindexedFiles();
   return MaybeParse(index_.FindExtension(containing_type, field_number),
                     output);
 }
@@ -380,6 +588,7 @@ bool EncodedDescriptorDatabase::FindFileContainingExtension(
 bool EncodedDescriptorDatabase::FindAllExtensionNumbers(
     const string& extendee_type,
     std::vector<int>* output) {
+  IndexUnindexedFiles();
   return index_.FindAllExtensionNumbers(extendee_type, output);
 }
 
@@ -392,6 +601,365 @@ bool EncodedDescriptorDatabase::MaybeParse(
 
 // ===================================================================
 
+namespace {
+
+// Layout of a descriptor pool image.  All integers are little-endian and
+// 32 bits wide, and all offsets are from the start of the image.
+//
+//   header:      magic, num_files, num_symbols, num_extensions, reserved (0)
+//   files:       num_files * (name offset, name size, data offset, data size),
+//                sorted by name
+//   symbols:     num_symbols * (name offset, name size, file index), sorted
+//                by name
+//   extensions:  num_extensions * (extendee offset, extendee size, number,
+//                file index), sorted by extendee and then number
+//   strings and encoded FileDescriptorProtos, in no particular order
+//
+// A file index is the position of the file in the files table.  As with
+// DescriptorIndex, the symbols table only lists top-level symbols.
+const char kImageMagic[] = "PBIMAGE1";
+const int kImageMagicSize = 8;
+const int kImageHeaderSize = kImageMagicSize + 4 * 4;
+const int kFileEntrySize = 4 * 4;
+const int kSymbolEntrySize = 3 * 4;
+const int kExtensionEntrySize = 4 * 4;
+
+inline uint32 ReadUInt32(const uint8* field) {
+  uint32 value;
+  io::CodedInputStream::ReadLittleEndian32FromArray(field, &value);
+  return value;
+}
+
+void AppendUInt32(uint32 value, string* output) {
+  uint8 bytes[4];
+  io::CodedOutputStream::WriteLittleEndian32ToArray(value, bytes);
+  output->append(reinterpret_cast<const char*>(bytes), 4);
+}
+
+// The string referred to by the (offset, size) pair at the start of entry.
+inline StringPiece GetImageString(const uint8* data, const uint8* entry) {
+  return StringPiece(reinterpret_cast<const char*>(data) + ReadUInt32(entry),
+                     ReadUInt32(entry + 4));
+}
+
+// True if [offset, offset + size) is within an image of the given size.
+inline bool InImage(uint32 offset, uint32 size, int image_size) {
+  return static_cast<uint64>(offset) + size <= image_size;
+}
+
+// Returns the first of the num_entries entries, which are sorted by the
+// string at their start, whose string is not less than key (if upper is
+// false) or greater than key (if upper is true), as a position in [0,
+// num_entries].
+int BinarySearch(const uint8* data, const uint8* entries, int num_entries,
+                 int entry_size, StringPiece key, bool upper) {
+  int low = 0;
+  int high = num_entries;
+  while (low < high) {
+    int middle = low + (high - low) / 2;
+    int comparison =
+        GetImageString(data, entries + middle * entry_size).compare(key);
+    if (comparison < 0 || (upper && comparison == 0)) {
+      low = middle + 1;
+    } else {
+      high = middle;
+    }
+  }
+  return low;
+}
+
+}  // namespace
+
+DescriptorPoolImageDatabase::DescriptorPoolImageDatabase(const void* data,
+                                                         int size)
+    : data_(reinterpret_cast<const uint8*>(data)),
+      size_(size),
+      valid_(false),
+      num_files_(0),
+      num_symbols_(0),
+      num_extensions_(0),
+      files_(NULL),
+      symbols_(NULL),
+      extensions_(NULL),
+      mapped_data_(NULL),
+      read_data_(NULL) {
+  if (size_ < kImageHeaderSize ||
+      memcmp(data_, kImageMagic, kImageMagicSize) != 0) {
+    GOOGLE_LOG(ERROR) << "Invalid descriptor pool image: bad header.";
+    return;
+  }
+  const uint32 num_files = ReadUInt32(data_ + kImageMagicSize);
+  const uint32 num_symbols = ReadUInt32(data_ + kImageMagicSize + 4);
+  const uint32 num_extensions = ReadUInt32(data_ + kImageMagicSize + 8);
+  const uint64 tables_end = kImageHeaderSize +
+                            static_cast<uint64>(num_files) * kFileEntrySize +
+                            static_cast<uint64>(num_symbols) * kSymbolEntrySize +
+                            static_cast<uint64>(num_extensions) *
+                                kExtensionEntrySize;
+  if (tables_end > size_) {
+    GOOGLE_LOG(ERROR) << "Invalid descriptor pool image: truncated tables.";
+    return;
+  }
+  const uint8* files = data_ + kImageHeaderSize;
+  const uint8* symbols = files + num_files * kFileEntrySize;
+  const uint8* extensions = symbols + num_symbols * kSymbolEntrySize;
+
+  // Check every entry now so that lookups need not.
+  for (uint32 i = 0; i < num_files; i++) {
+    const uint8* entry = files + i * kFileEntrySize;
+    if (!InImage(ReadUInt32(entry), ReadUInt32(entry + 4), size_) ||
+        !InImage(ReadUInt32(entry + 8), ReadUInt32(entry + 12), size_)) {
+      GOOGLE_LOG(ERROR) << "Invalid descriptor pool image: bad file entry.";
+      return;
+    }
+  }
+  for (uint32 i = 0; i < num_symbols; i++) {
+    const uint8* entry = symbols + i * kSymbolEntrySize;
+    if (!InImage(ReadUInt32(entry), ReadUInt32(entry + 4), size_) ||
+        ReadUInt32(entry + 8) >= num_files) {
+      GOOGLE_LOG(ERROR) << "Invalid descriptor pool image: bad symbol entry.";
+      return;
+    }
+  }
+  for (uint32 i = 0; i < num_extensions; i++) {
+    const uint8* entry = extensions + i * kExtensionEntrySize;
+    if (!InImage(ReadUInt32(entry), ReadUInt32(entry + 4), size_) ||
+        ReadUInt32(entry + 12) >= num_files) {
+      GOOGLE_LOG(ERROR)
+          << "Invalid descriptor pool image: bad extension entry.";
+      return;
+    }
+  }
+
+  // Only a valid image answers lookups; the counts stay zero otherwise.
+  num_files_ = num_files;
+  num_symbols_ = num_symbols;
+  num_extensions_ = num_extensions;
+  files_ = files;
+  symbols_ = symbols;
+  extensions_ = extensions;
+  valid_ = true;
+}
+
+DescriptorPoolImageDatabase::~DescriptorPoolImageDatabase() {
+#ifndef _WIN32
+  if (mapped_data_ != NULL) munmap(mapped_data_, size_);
+#endif
+  delete [] read_data_;
+}
+
+DescriptorPoolImageDatabase* DescriptorPoolImageDatabase::OpenFile(
+    const string& filename) {
+  int fd;
+  do {
+    fd = open(filename.c_str(), O_RDONLY | O_BINARY);
+  } while (fd < 0 && errno == EINTR);
+  if (fd < 0) {
+    GOOGLE_LOG(ERROR) << filename << ": " << strerror(errno);
+    return NULL;
+  }
+
+  struct stat info;
+  if (fstat(fd, &info) < 0 || info.st_size > INT_MAX) {
+    GOOGLE_LOG(ERROR) << filename << ": Cannot map a file of this size.";
+    close(fd);
+    return NULL;
+  }
+  const int size = info.st_size;
+
+  void* mapped_data = NULL;
+  char* read_data = NULL;
+#ifndef _WIN32
+  if (size > 0) {
+    mapped_data = mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (mapped_data == MAP_FAILED) mapped_data = NULL;
+  }
+#endif
+  if (mapped_data == NULL) {
+    read_data = new char[size];
+    int total = 0;
+    while (total < size) {
+      int bytes = read(fd, read_data + total, size - total);
+      if (bytes < 0 && errno == EINTR) continue;
+      if (bytes <= 0) break;
+      total += bytes;
+    }
+    if (total < size) {
+      GOOGLE_LOG(ERROR) << filename << ": " << strerror(errno);
+      delete [] read_data;
+      close(fd);
+      return NULL;
+    }
+  }
+  close(fd);
+
+  DescriptorPoolImageDatabase* database = new DescriptorPoolImageDatabase(
+      mapped_data != NULL ? mapped_data : read_data, size);
+  database->mapped_data_ = mapped_data;
+  database->read_data_ = read_data;
+  if (!database->is_valid()) {
+    delete database;
+    return NULL;
+  }
+  return database;
+}
+
+bool DescriptorPoolImageDatabase::BuildImage(
+    const std::vector<const FileDescriptorProto*>& files, string* output) {
+  // Let DescriptorIndex check for conflicts and sort everything.
+  SimpleDescriptorDatabase::DescriptorIndex<int> index;
+  for (int i = 0; i < files.size(); i++) {
+    if (!index.AddFile(*files[i], i)) return false;
+  }
+  const std::map<string, int>& by_name = index.by_name();
+  const std::map<string, int>& by_symbol = index.by_symbol();
+  const std::map<std::pair<string, int>, int>& by_extension =
+      index.by_extension();
+
+  const uint64 tables_size =
+      kImageHeaderSize + by_name.size() * kFileEntrySize +
+      by_symbol.size() * kSymbolEntrySize +
+      by_extension.size() * kExtensionEntrySize;
+  string tables;
+  string data;
+
+  // Positions in the files table, indexed by position in files.
+  std::vector<uint32> file_indices(files.size());
+  tables.append(kImageMagic, kImageMagicSize);
+  AppendUInt32(by_name.size(), &tables);
+  AppendUInt32(by_symbol.size(), &tables);
+  AppendUInt32(by_extension.size(), &tables);
+  AppendUInt32(0, &tables);
+
+  for (std::map<string, int>::const_iterator it = by_name.begin();
+       it != by_name.end(); ++it) {
+    file_indices[it->second] = (tables.size() - kImageHeaderSize) /
+                               kFileEntrySize;
+    AppendUInt32(tables_size + data.size(), &tables);
+    AppendUInt32(it->first.size(), &tables);
+    data.append(it->first);
+    AppendUInt32(tables_size + data.size(), &tables);
+    const int data_size = data.size();
+    files[it->second]->AppendToString(&data);
+    AppendUInt32(data.size() - data_size, &tables);
+  }
+
+  for (std::map<string, int>::const_iterator it = by_symbol.begin();
+       it != by_symbol.end(); ++it) {
+    AppendUInt32(tables_size + data.size(), &tables);
+    AppendUInt32(it->first.size(), &tables);
+    data.append(it->first);
+    AppendUInt32(file_indices[it->second], &tables);
+  }
+
+  // Extensions of the same type are adjacent, so share the extendee name.
+  const string* last_extendee = NULL;
+  uint32 last_extendee_offset = 0;
+  for (std::map<std::pair<string, int>, int>::const_iterator it =
+           by_extension.begin();
+       it != by_extension.end(); ++it) {
+    if (last_extendee == NULL || *last_extendee != it->first.first) {
+      last_extendee = &it->first.first;
+      last_extendee_offset = tables_size + data.size();
+      data.append(it->first.first);
+    }
+    AppendUInt32(last_extendee_offset, &tables);
+    AppendUInt32(it->first.first.size(), &tables);
+    AppendUInt32(it->first.second, &tables);
+    AppendUInt32(file_indices[it->second], &tables);
+  }
+
+  GOOGLE_DCHECK_EQ(tables_size, tables.size());
+  if (tables_size + data.size() > INT_MAX) {
+    GOOGLE_LOG(ERROR) << "Descriptor pool image would be too large.";
+    return false;
+  }
+  output->append(tables);
+  output->append(data);
+  return true;
+}
+
+bool DescriptorPoolImageDatabase::FindFileByName(
+    const string& filename,
+    FileDescriptorProto* output) {
+  int i = BinarySearch(data_, files_, num_files_, kFileEntrySize, filename,
+                       false);
+  if (i == num_files_ ||
+      GetImageString(data_, files_ + i * kFileEntrySize) != filename) {
+    return false;
+  }
+  return ParseFile(i, output);
+}
+
+bool DescriptorPoolImageDatabase::FindFileContainingSymbol(
+    const string& symbol_name,
+    FileDescriptorProto* output) {
+  // As in DescriptorIndex::FindSymbol(), the only symbol which can contain
+  // symbol_name is the last one less than or equal to it.
+  int i = BinarySearch(data_, symbols_, num_symbols_, kSymbolEntrySize,
+                       symbol_name, true);
+  if (i == 0) return false;
+  const uint8* entry = symbols_ + (i - 1) * kSymbolEntrySize;
+  StringPiece symbol = GetImageString(data_, entry);
+  if (symbol != symbol_name &&
+      !(StringPiece(symbol_name).starts_with(symbol) &&
+        symbol_name[symbol.size()] == '.')) {
+    return false;
+  }
+  return ParseFile(ReadUInt32(entry + 8), output);
+}
+
+bool DescriptorPoolImageDatabase::FindFileContainingExtension(
+    const string& containing_type,
+    int field_number,
+    FileDescriptorProto* output) {
+  int i = BinarySearch(data_, extensions_, num_extensions_,
+                       kExtensionEntrySize, containing_type, false);
+  for (; i < num_extensions_; i++) {
+    const uint8* entry = extensions_ + i * kExtensionEntrySize;
+    if (GetImageString(data_, entry) != containing_type) break;
+    const int number = static_cast<int32>(ReadUInt32(entry + 8));
+    if (number == field_number) {
+      return ParseFile(ReadUInt32(entry + 12), output);
+    }
+    if (number > field_number) break;
+  }
+  return false;
+}
+
+bool DescriptorPoolImageDatabase::FindAllExtensionNumbers(
+    const string& extendee_type,
+    std::vector<int>* output) {
+  int i = BinarySearch(data_, extensions_, num_extensions_,
+                       kExtensionEntrySize, extendee_type, false);
+  bool success = false;
+  for (; i < num_extensions_; i++) {
+    const uint8* entry = extensions_ + i * kExtensionEntrySize;
+    if (GetImageString(data_, entry) != extendee_type) break;
+    output->push_back(static_cast<int32>(ReadUInt32(entry + 8)));
+    success = true;
+  }
+  return success;
+}
+
+bool DescriptorPoolImageDatabase::FindAllFileNames(
+    std::vector<string>* output) {
+  for (int i = 0; i < num_files_; i++) {
+    output->push_back(
+        GetImageString(data_, files_ + i * kFileEntrySize).ToString());
+  }
+  return true;
+}
+
+bool DescriptorPoolImageDatabase::ParseFile(int file_index,
+                                            FileDescriptorProto* output) {
+  const uint8* entry = files_ + file_index * kFileEntrySize;
+  return output->ParseFromArray(data_ + ReadUInt32(entry + 8),
+                                ReadUInt32(entry + 12));
+}
+
+// ===================================================================
+
 DescriptorPoolDatabase::DescriptorPoolDatabase(const DescriptorPool& pool)
   : pool_(pool) {}
 DescriptorPoolDatabase::~DescriptorPoolDatabase() {}
@@ -51,6 +51,7 @@ namespace protobuf {
 class DescriptorDatabase;
 class SimpleDescriptorDatabase;
 class EncodedDescriptorDatabase;
+class DescriptorPoolImageDatabase;
 class DescriptorPoolDatabase;
 class MergedDescriptorDatabase;
 
@@ -165,8 +166,9 @@ class LIBPROTOBUF_EXPORT SimpleDescriptorDatabase : public DescriptorDatabase {
                                std::vector<int>* output);
 
  private:
-  // So that it can use DescriptorIndex.
+  // So that they can use DescriptorIndex.
   friend class EncodedDescriptorDatabase;
+  friend class DescriptorPoolImageDatabase;
 
   // An index mapping file names, symbol names, and extension numbers to
   // some sort of values.
@@ -189,6 +191,13 @@ class LIBPROTOBUF_EXPORT SimpleDescriptorDatabase : public DescriptorDatabase {
     bool FindAllExtensionNumbers(const string& containing_type,
                                  std::vector<int>* output);
 
+    // The contents of the index, in sorted order.
+    const std::map<string, Value>& by_name() const { return by_name_; }
+    const std::map<string, Value>& by_symbol() const { return by_symbol_; }
+    const std::map<std::pair<string, int>, Value>& by_extension() const {
+      return by_extension_;
+    }
+
    private:
     std::map<string, Value> by_name_;
     std::map<string, Value> by_symbol_;
@@ -294,6 +303,14 @@ class LIBPROTOBUF_EXPORT EncodedDescriptorDatabase : public DescriptorDatabase {
   // need to keep it around.
   bool AddCopy(const void* encoded_file_descriptor, int size);
 
+  // Like Add(), but does not look at the bytes until the database is first
+  // queried.  All files added this way are then indexed at once, reading only
+  // the names of the file and of its symbols and extensions, which is much
+  // cheaper than parsing them.  Since indexing happens long after the call,
+  // invalid or conflicting files are only logged and then ignored.  This is
+  // what the generated pool uses to keep program startup cheap.
+  void AddLazily(const void* encoded_file_descriptor, int size);
+
   // Like FindFileContainingSymbol but returns only the name of the file.
   bool FindNameOfFileContainingSymbol(const string& symbol_name,
                                       string* output);
@@ -313,6 +330,14 @@ class LIBPROTOBUF_EXPORT EncodedDescriptorDatabase : public DescriptorDatabase {
   SimpleDescriptorDatabase::DescriptorIndex<std::pair<const void*, int> >
       index_;
   std::vector<void*> files_to_delete_;
+  // Files passed to AddLazily() which have not been indexed yet.
+  std::vector<std::pair<const void*, int> > unindexed_files_;
+
+  // Adds the files in unindexed_files_ to index_.
+  void IndexUnindexedFiles() {
+    if (!unindexed_files_.empty()) IndexUnindexedFilesSlow();
+  }
+  void IndexUnindexedFilesSlow();
 
   // If encoded_file.first is non-NULL, parse the data into *output and return
   // true, otherwise return false.
@@ -322,6 +347,77 @@ class LIBPROTOBUF_EXPORT EncodedDescriptorDatabase : public DescriptorDatabase {
   GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(EncodedDescriptorDatabase);
 };
 
+// A DescriptorDatabase which reads a "descriptor pool image":  a set of
+// encoded FileDescriptorProtos stored together with sorted tables of their
+// names, top-level symbols and extensions, as written by BuildImage() or by
+// protoc's --descriptor_pool_image_out.  All offsets in an image are relative
+// to its start, so it is used in place wherever it has been mapped.  Opening
+// an image reads nothing but its header, and each lookup is a binary search
+// followed by parsing the one file found; opening one only checks that the
+// entries of its tables are in bounds.  A DescriptorPool using this database
+// as its fallback therefore starts up without parsing or cross-linking the
+// whole set, and only ever builds the files it is asked for along with their
+// imports.
+//
+// The same caveats regarding FindFileContainingExtension() apply as with
+// SimpleDescriptorDatabase.
+class LIBPROTOBUF_EXPORT DescriptorPoolImageDatabase
+    : public DescriptorDatabase {
+ public:
+  // Uses the image in the given bytes, which are not copied and must remain
+  // valid for the life of the database.  If they are not a valid image, an
+  // error is logged and every lookup fails.
+  DescriptorPoolImageDatabase(const void* data, int size);
+  ~DescriptorPoolImageDatabase();
+
+  // Maps the image in the given file into memory (or, on platforms without
+  // mmap(), reads it).  Returns NULL and logs an error if the file cannot be
+  // read or is not a valid image.
+  static DescriptorPoolImageDatabase* OpenFile(const string& filename);
+
+  // Appends an image of the given files to *output.  The image should include
+  // the dependencies of every file so that a pool can build any of them.
+  // Returns false and logs an error if the files conflict with each other.
+  static bool BuildImage(const std::vector<const FileDescriptorProto*>& files,
+                         string* output);
+
+  // False if the constructor found the image to be invalid.
+  bool is_valid() const { return valid_; }
+
+  // implements DescriptorDatabase -----------------------------------
+  bool FindFileByName(const string& filename,
+                      FileDescriptorProto* output);
+  bool FindFileContainingSymbol(const string& symbol_name,
+                                FileDescriptorProto* output);
+  bool FindFileContainingExtension(const string& containing_type,
+                                   int field_number,
+                                   FileDescriptorProto* output);
+  bool FindAllExtensionNumbers(const string& extendee_type,
+                               std::vector<int>* output);
+  bool FindAllFileNames(std::vector<string>* output);
+
+ private:
+  // Parses the file at the given position of the files table into *output.
+  bool ParseFile(int file_index, FileDescriptorProto* output);
+
+  const uint8* data_;
+  int size_;
+  bool valid_;
+  int num_files_;
+  int num_symbols_;
+  int num_extensions_;
+  const uint8* files_;
+  const uint8* symbols_;
+  const uint8* extensions_;
+
+  // Set when OpenFile() mapped or read the image, and freed by the
+  // destructor.
+  void* mapped_data_;
+  char* read_data_;
+
+  GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(DescriptorPoolImageDatabase);
+};
+
 // A DescriptorDatabase that fetches files from a given pool.
 class LIBPROTOBUF_EXPORT DescriptorPoolDatabase : public DescriptorDatabase {
  public:
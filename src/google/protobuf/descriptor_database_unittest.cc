@@ -47,6 +47,8 @@
 
 #include <google/protobuf/stubs/logging.h>
 #include <google/protobuf/stubs/common.h>
+#include <google/protobuf/stubs/stl_util.h>
+#include <google/protobuf/testing/file.h>
 #include <google/protobuf/testing/googletest.h>
 #include <gtest/gtest.h>
 
@@ -157,6 +159,74 @@ class DescriptorPoolDatabaseTestCase : public DescriptorDatabaseTestCase {
   DescriptorPoolDatabase database_;
 };
 
+// Specialization for DescriptorPoolImageDatabase.  Since an image cannot be
+// added to, every call to AddToDatabase() builds a new one, so GetDatabase()
+// returns this object, which forwards to the latest image.
+class DescriptorPoolImageDatabaseTestCase : public DescriptorDatabaseTestCase,
+                                            public DescriptorDatabase {
+ public:
+  static DescriptorDatabaseTestCase* New() {
+    return new DescriptorPoolImageDatabaseTestCase;
+  }
+
+  DescriptorPoolImageDatabaseTestCase() { Rebuild(); }
+  virtual ~DescriptorPoolImageDatabaseTestCase() {
+    STLDeleteElements(&files_);
+  }
+
+  virtual DescriptorDatabase* GetDatabase() {
+    return this;
+  }
+  virtual bool AddToDatabase(const FileDescriptorProto& file) {
+    files_.push_back(new FileDescriptorProto(file));
+    if (!Rebuild()) {
+      delete files_.back();
+      files_.pop_back();
+      return false;
+    }
+    return true;
+  }
+
+  // implements DescriptorDatabase ---------------------------------
+  bool FindFileByName(const string& filename,
+                      FileDescriptorProto* output) {
+    return database_->FindFileByName(filename, output);
+  }
+  bool FindFileContainingSymbol(const string& symbol_name,
+                                FileDescriptorProto* output) {
+    return database_->FindFileContainingSymbol(symbol_name, output);
+  }
+  bool FindFileContainingExtension(const string& containing_type,
+                                   int field_number,
+                                   FileDescriptorProto* output) {
+    return database_->FindFileContainingExtension(containing_type,
+                                                  field_number, output);
+  }
+  bool FindAllExtensionNumbers(const string& extendee_type,
+                               std::vector<int>* output) {
+    return database_->FindAllExtensionNumbers(extendee_type, output);
+  }
+
+ private:
+  bool Rebuild() {
+    string image;
+    if (!DescriptorPoolImageDatabase::BuildImage(
+            std::vector<const FileDescriptorProto*>(files_.begin(),
+                                                    files_.end()),
+            &image)) {
+      return false;
+    }
+    image_.swap(image);
+    database_.reset(
+        new DescriptorPoolImageDatabase(image_.data(), image_.size()));
+    return database_->is_valid();
+  }
+
+  std::vector<FileDescriptorProto*> files_;
+  string image_;
+  google::protobuf::scoped_ptr<DescriptorPoolImageDatabase> database_;
+};
+
 // -------------------------------------------------------------------
 
 class DescriptorDatabaseTest
@@ -481,6 +551,8 @@ INSTANTIATE_TEST_CASE_P(MemoryConserving, DescriptorDatabaseTest,
     testing::Values(&EncodedDescriptorDatabaseTestCase::New));
 INSTANTIATE_TEST_CASE_P(Pool, DescriptorDatabaseTest,
     testing::Values(&DescriptorPoolDatabaseTestCase::New));
+INSTANTIATE_TEST_CASE_P(Image, DescriptorDatabaseTest,
+    testing::Values(&DescriptorPoolImageDatabaseTestCase::New));
 
 #endif  // GTEST_HAS_PARAM_TEST
 
@@ -518,6 +590,175 @@ TEST(EncodedDescriptorDatabaseExtraTest, FindNameOfFileContainingSymbol) {
   EXPECT_FALSE(db.FindNameOfFileContainingSymbol("baz.Baz", &filename));
 }
 
+TEST(EncodedDescriptorDatabaseExtraTest, AddLazily) {
+  FileDescriptorProto foo, bar, conflict;
+  EXPECT_TRUE(TextFormat::ParseFromString(
+      "name: \"foo.proto\" "
+      "package: \"foo\" "
+      "message_type { "
+      "  name: \"Foo\" "
+      "  field { name: \"qux\" number: 1 type: TYPE_INT32 } "
+      "  extension_range { start: 1000 end: 2000 } "
+      "  nested_type { "
+      "    name: \"Nested\" "
+      "    extension { name: \"nested_ext\" number: 1001 extendee: \".foo.Foo\" } "
+      "  } "
+      "} "
+      "enum_type { name: \"FooEnum\" value { name: \"FOO_VALUE\" number: 1 } } "
+      "service { name: \"FooService\" } "
+      "extension { name: \"foo_ext\" number: 1000 extendee: \".foo.Foo\" }",
+      &foo));
+  EXPECT_TRUE(TextFormat::ParseFromString(
+      "name: \"bar.proto\" "
+      "package: \"bar\" "
+      "dependency: \"foo.proto\" "
+      "message_type { name: \"Bar\" } "
+      "extension { name: \"bar_ext\" number: 1002 extendee: \".foo.Foo\" }",
+      &bar));
+  EXPECT_TRUE(TextFormat::ParseFromString(
+      "name: \"conflict.proto\" "
+      "package: \"foo\" "
+      "message_type { name: \"Foo\" }",
+      &conflict));
+  string foo_data = foo.SerializeAsString();
+  // Out-of-order fields are handled too.
+  string bar_data = bar.SerializeAsString();
+  bar_data = bar_data.substr(bar.name().size() + 2) +
+             bar_data.substr(0, bar.name().size() + 2);
+  string conflict_data = conflict.SerializeAsString();
+
+  EncodedDescriptorDatabase db;
+  db.AddLazily(foo_data.data(), foo_data.size());
+  db.AddLazily(bar_data.data(), bar_data.size());
+
+  FileDescriptorProto file;
+  EXPECT_TRUE(db.FindFileByName("foo.proto", &file));
+  EXPECT_EQ(foo.DebugString(), file.DebugString());
+  EXPECT_TRUE(db.FindFileContainingSymbol("foo.FooEnum", &file));
+  EXPECT_EQ("foo.proto", file.name());
+  EXPECT_TRUE(db.FindFileContainingSymbol("foo.FooService", &file));
+  EXPECT_EQ("foo.proto", file.name());
+  EXPECT_TRUE(db.FindFileContainingSymbol("foo.Foo.Nested", &file));
+  EXPECT_EQ("foo.proto", file.name());
+  EXPECT_TRUE(db.FindFileContainingExtension("foo.Foo", 1001, &file));
+  EXPECT_EQ("foo.proto", file.name());
+  EXPECT_TRUE(db.FindFileContainingExtension("foo.Foo", 1002, &file));
+  EXPECT_EQ("bar.proto", file.name());
+
+  // Files added after the first query are indexed by the next one.
+  db.AddLazily(conflict_data.data(), conflict_data.size());
+  std::vector<int> numbers;
+  {
+    ScopedMemoryLog log;
+    EXPECT_TRUE(db.FindAllExtensionNumbers("foo.Foo", &numbers));
+    // The conflicting file is logged and ignored.
+    EXPECT_EQ(1, log.GetMessages(ERROR).size());
+  }
+  std::sort(numbers.begin(), numbers.end());
+  ASSERT_EQ(3, numbers.size());
+  EXPECT_EQ(1000, numbers[0]);
+  EXPECT_EQ(1001, numbers[1]);
+  EXPECT_EQ(1002, numbers[2]);
+  EXPECT_TRUE(db.FindFileContainingSymbol("foo.Foo", &file));
+  EXPECT_EQ("foo.proto", file.name());
+}
+
+TEST(DescriptorPoolImageDatabaseTest, OpenFile) {
+  FileDescriptorProto foo, bar;
+  EXPECT_TRUE(TextFormat::ParseFromString(
+      "name: \"foo.proto\" "
+      "package: \"foo\" "
+      "message_type { "
+      "  name: \"Foo\" "
+      "  extension_range { start: 1000 end: 2000 } "
+      "}", &foo));
+  EXPECT_TRUE(TextFormat::ParseFromString(
+      "name: \"bar.proto\" "
+      "package: \"bar\" "
+      "dependency: \"foo.proto\" "
+      "message_type { "
+      "  name: \"Bar\" "
+      "  field { name: \"foo\" number: 1 label: LABEL_OPTIONAL "
+      "          type: TYPE_MESSAGE type_name: \".foo.Foo\" } "
+      "} "
+      "extension { name: \"ext\" number: 1000 label: LABEL_OPTIONAL "
+      "            type: TYPE_INT32 extendee: \".foo.Foo\" }", &bar));
+
+  std::vector<const FileDescriptorProto*> files;
+  files.push_back(&bar);
+  files.push_back(&foo);
+  string image;
+  ASSERT_TRUE(DescriptorPoolImageDatabase::BuildImage(files, &image));
+  const string filename = TestTempDir() + "/descriptors.pbimage";
+  File::WriteStringToFileOrDie(image, filename);
+
+  google::protobuf::scoped_ptr<DescriptorPoolImageDatabase> database(
+      DescriptorPoolImageDatabase::OpenFile(filename));
+  ASSERT_TRUE(database != NULL);
+
+  std::vector<string> names;
+  EXPECT_TRUE(database->FindAllFileNames(&names));
+  ASSERT_EQ(2, names.size());
+  EXPECT_EQ("bar.proto", names[0]);
+  EXPECT_EQ("foo.proto", names[1]);
+
+  // A pool using the image builds files, and their imports, on demand.
+  DescriptorPool pool(database.get());
+  const Descriptor* bar_type = pool.FindMessageTypeByName("bar.Bar");
+  ASSERT_TRUE(bar_type != NULL);
+  const Descriptor* foo_type = bar_type->field(0)->message_type();
+  EXPECT_EQ("foo.Foo", foo_type->full_name());
+  const FieldDescriptor* ext = pool.FindExtensionByNumber(foo_type, 1000);
+  ASSERT_TRUE(ext != NULL);
+  EXPECT_EQ("bar.ext", ext->full_name());
+  EXPECT_TRUE(pool.FindMessageTypeByName("baz.Baz") == NULL);
+}
+
+TEST(DescriptorPoolImageDatabaseTest, InvalidImage) {
+  FileDescriptorProto foo;
+  foo.set_name("foo.proto");
+  foo.add_message_type()->set_name("Foo");
+  std::vector<const FileDescriptorProto*> files(1, &foo);
+  string image;
+  ASSERT_TRUE(DescriptorPoolImageDatabase::BuildImage(files, &image));
+  {
+    DescriptorPoolImageDatabase database(image.data(), image.size());
+    EXPECT_TRUE(database.is_valid());
+  }
+
+  FileDescriptorProto output;
+  {
+    // Cut off in the middle of the files table.
+    ScopedMemoryLog log;
+    DescriptorPoolImageDatabase database(image.data(), 30);
+    EXPECT_FALSE(database.is_valid());
+    EXPECT_FALSE(database.FindFileByName("foo.proto", &output));
+    EXPECT_EQ(1, log.GetMessages(ERROR).size());
+  }
+  {
+    // Cut off before the end of the strings the tables refer to.
+    ScopedMemoryLog log;
+    DescriptorPoolImageDatabase database(image.data(), image.size() - 1);
+    EXPECT_FALSE(database.is_valid());
+    EXPECT_FALSE(database.FindFileContainingSymbol("Foo", &output));
+    EXPECT_EQ(1, log.GetMessages(ERROR).size());
+  }
+  {
+    ScopedMemoryLog log;
+    const string not_an_image = foo.SerializeAsString();
+    DescriptorPoolImageDatabase database(not_an_image.data(),
+                                         not_an_image.size());
+    EXPECT_FALSE(database.is_valid());
+    EXPECT_EQ(1, log.GetMessages(ERROR).size());
+  }
+  {
+    ScopedMemoryLog log;
+    EXPECT_TRUE(DescriptorPoolImageDatabase::OpenFile(
+                    TestTempDir() + "/no_such_file.pbimage") == NULL);
+    EXPECT_EQ(1, log.GetMessages(ERROR).size());
+  }
+}
+
 // ===================================================================
 
 class MergedDescriptorDatabaseTest : public testing::Test {
@@ -62,6 +62,10 @@
 #include <google/protobuf/testing/googletest.h>
 #include <gtest/gtest.h>
 
+#if LANG_CXX11
+#include <thread>
+#endif
+
 namespace google {
 namespace protobuf {
 
@@ -6067,6 +6071,129 @@ TEST_F(ValidationErrorTest, ValidateProto3JsonName) {
 }
 
 
+// ===================================================================
+// BuildFiles
+
+static void AddToFileSet(FileDescriptorSet* files, const char* file_text) {
+  EXPECT_TRUE(TextFormat::ParseFromString(file_text, files->add_file()));
+}
+
+TEST(BuildFilesTest, BuildsFilesInAnyOrder) {
+  FileDescriptorSet files;
+  AddToFileSet(&files,
+    "name: 'baz.proto' package: 'pkg' "
+    "dependency: 'bar.proto' dependency: 'foo.proto' "
+    "message_type { name: 'Baz' "
+    "  field { name: 'bar' number: 1 label: LABEL_OPTIONAL type_name: 'Bar' }"
+    "  field { name: 'foo' number: 2 label: LABEL_OPTIONAL type_name: 'Foo' }"
+    "}");
+  AddToFileSet(&files,
+    "name: 'bar.proto' package: 'pkg' dependency: 'foo.proto' "
+    "message_type { name: 'Bar' "
+    "  field { name: 'foo' number: 1 label: LABEL_OPTIONAL type_name: 'Foo' }"
+    "}");
+  AddToFileSet(&files,
+    "name: 'foo.proto' package: 'pkg' "
+    "message_type { name: 'Foo' extension_range { start: 1000 end: 2000 } }");
+  AddToFileSet(&files,
+    "name: 'qux.proto' package: 'pkg.sub' "
+    "message_type { name: 'Qux' }");
+  AddToFileSet(&files,
+    "name: 'ext.proto' package: 'pkg.sub' dependency: 'foo.proto' "
+    "extension { name: 'ext' number: 1000 label: LABEL_OPTIONAL "
+    "            type: TYPE_INT32 extendee: 'Foo' }");
+  // The same file twice is fine, as with BuildFile().
+  files.add_file()->CopyFrom(files.file(2));
+
+  DescriptorPool pool;
+  MockErrorCollector error_collector;
+  std::vector<const FileDescriptor*> output;
+  EXPECT_TRUE(pool.BuildFiles(files, 4, &error_collector, &output));
+  EXPECT_EQ("", error_collector.text_);
+  ASSERT_EQ(files.file_size(), output.size());
+  for (int i = 0; i < files.file_size(); i++) {
+    ASSERT_TRUE(output[i] != NULL);
+    EXPECT_EQ(files.file(i).name(), output[i]->name());
+    EXPECT_EQ(&pool, output[i]->pool());
+    EXPECT_EQ(output[i], pool.FindFileByName(output[i]->name()));
+  }
+
+  const Descriptor* foo = pool.FindMessageTypeByName("pkg.Foo");
+  const Descriptor* bar = pool.FindMessageTypeByName("pkg.Bar");
+  const Descriptor* baz = pool.FindMessageTypeByName("pkg.Baz");
+  ASSERT_TRUE(foo != NULL);
+  ASSERT_TRUE(bar != NULL);
+  ASSERT_TRUE(baz != NULL);
+  EXPECT_EQ(foo, bar->field(0)->message_type());
+  EXPECT_EQ(bar, baz->field(0)->message_type());
+  EXPECT_EQ(foo, baz->field(1)->message_type());
+  EXPECT_EQ(output[3], pool.FindFileContainingSymbol("pkg.sub.Qux"));
+  const FieldDescriptor* ext = pool.FindExtensionByNumber(foo, 1000);
+  ASSERT_TRUE(ext != NULL);
+  EXPECT_EQ("pkg.sub.ext", ext->full_name());
+  EXPECT_EQ(output[2], output[5]);
+}
+
+TEST(BuildFilesTest, ReportsErrorsLikeBuildFile) {
+  FileDescriptorSet files;
+  AddToFileSet(&files, "name: 'a.proto' message_type { name: 'Dup' }");
+  AddToFileSet(&files, "name: 'b.proto' message_type { name: 'Dup' }");
+  AddToFileSet(&files,
+    "name: 'c.proto' message_type { name: 'C' "
+    "  field { name: 'd' number: 1 label: LABEL_OPTIONAL type_name: 'D' }"
+    "}");
+  AddToFileSet(&files,
+    "name: 'd.proto' dependency: 'b.proto' message_type { name: 'D' }");
+  AddToFileSet(&files, "name: 'a.proto' message_type { name: 'Other' }");
+
+  // Building the files one at a time must give the same results and errors.
+  DescriptorPool serial_pool;
+  MockErrorCollector serial_errors;
+  std::vector<const FileDescriptor*> serial_output;
+  for (int i = 0; i < files.file_size(); i++) {
+    serial_output.push_back(serial_pool.BuildFileCollectingErrors(
+        files.file(i), &serial_errors));
+  }
+
+  DescriptorPool pool;
+  MockErrorCollector error_collector;
+  std::vector<const FileDescriptor*> output;
+  EXPECT_FALSE(pool.BuildFiles(files, 4, &error_collector, &output));
+  EXPECT_EQ(serial_errors.text_, error_collector.text_);
+  EXPECT_EQ(
+    "b.proto: Dup: NAME: \"Dup\" is already defined in file \"a.proto\".\n"
+    "c.proto: C.d: TYPE: \"D\" is not defined.\n"
+    "d.proto: d.proto: OTHER: Import \"b.proto\" has not been loaded.\n"
+    "a.proto: a.proto: OTHER: A file with this name is already in the pool.\n",
+    error_collector.text_);
+
+  ASSERT_EQ(serial_output.size(), output.size());
+  for (int i = 0; i < output.size(); i++) {
+    EXPECT_EQ(serial_output[i] == NULL, output[i] == NULL);
+  }
+  EXPECT_TRUE(output[0] != NULL);
+}
+
+TEST(BuildFilesTest, ImportCycle) {
+  FileDescriptorSet files;
+  AddToFileSet(&files, "name: 'a.proto' dependency: 'b.proto'");
+  AddToFileSet(&files, "name: 'b.proto' dependency: 'a.proto'");
+  AddToFileSet(&files, "name: 'c.proto'");
+
+  DescriptorPool pool;
+  MockErrorCollector error_collector;
+  std::vector<const FileDescriptor*> output;
+  EXPECT_FALSE(pool.BuildFiles(files, 4, &error_collector, &output));
+  EXPECT_EQ(
+    "a.proto: a.proto: OTHER: Import \"b.proto\" has not been loaded.\n"
+    "b.proto: b.proto: OTHER: Import \"a.proto\" has not been loaded.\n",
+    error_collector.text_);
+  ASSERT_EQ(3, output.size());
+  EXPECT_TRUE(output[0] == NULL);
+  EXPECT_TRUE(output[1] == NULL);
+  EXPECT_TRUE(output[2] != NULL);
+}
+
 // ===================================================================
 // DescriptorDatabase
 
@@ -6440,6 +6567,66 @@ TEST_F(DatabaseBackedPoolTest, DoesntRetryDbUnnecessarily) {
   EXPECT_EQ(0, call_counter.call_count_);
 }
 
+TEST_F(DatabaseBackedPoolTest, BuiltItemsFoundWithoutDatabase) {
+  // Once built, files, symbols and extensions are found without going back to
+  // the database, including by FindFileContainingSymbol().
+  CallCountingDatabase call_counter(&database_);
+  DescriptorPool pool(&call_counter);
+
+  const FileDescriptor* bar = pool.FindFileByName("bar.proto");
+  ASSERT_TRUE(bar != NULL);
+  const Descriptor* foo = pool.FindMessageTypeByName("Foo");
+  ASSERT_TRUE(foo != NULL);
+  call_counter.Clear();
+
+  EXPECT_EQ(bar, pool.FindFileByName("bar.proto"));
+  EXPECT_EQ(foo->file(), pool.FindFileByName("foo.proto"));
+  EXPECT_EQ(bar, pool.FindFileContainingSymbol("Bar"));
+  EXPECT_EQ(foo->file(), pool.FindFileContainingSymbol("TestEnum"));
+  EXPECT_EQ(bar->extension(0), pool.FindExtensionByNumber(foo, 5));
+  EXPECT_EQ(bar->extension(0), pool.FindExtensionByName("foo_ext"));
+  EXPECT_EQ(foo, pool.FindMessageTypeByName("Foo"));
+  EXPECT_TRUE(pool.FindFieldByName("foo_ext") == NULL);
+  EXPECT_TRUE(pool.FindEnumTypeByName("Foo") == NULL);
+
+  EXPECT_EQ(0, call_counter.call_count_);
+}
+
+#if LANG_CXX11
+TEST_F(DatabaseBackedPoolTest, ConcurrentLookups) {
+  // Threads race to build the files from the database while others are
+  // already finding the results; everybody must agree on the descriptors.
+  DescriptorPool pool(&database_);
+  const int kThreads = 8;
+  const int kIterations = 1000;
+  std::vector<const FieldDescriptor*> results(kThreads);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; t++) {
+    threads.push_back(std::thread([&pool, &results, t]() {
+      for (int i = 0; i < kIterations; i++) {
+        const Descriptor* foo = pool.FindMessageTypeByName("Foo");
+        if (foo == NULL || pool.FindFileByName("bar.proto") == NULL) return;
+        const FieldDescriptor* extension = pool.FindExtensionByNumber(foo, 5);
+        if (extension == NULL ||
+            pool.FindExtensionByName("foo_ext") != extension) {
+          return;
+        }
+        results[t] = extension;
+      }
+    }));
+  }
+  for (int t = 0; t < kThreads; t++) {
+    threads[t].join();
+  }
+
+  const FieldDescriptor* extension = pool.FindExtensionByName("foo_ext");
+  ASSERT_TRUE(extension != NULL);
+  for (int t = 0; t < kThreads; t++) {
+    EXPECT_EQ(extension, results[t]);
+  }
+}
+#endif  // LANG_CXX11
+
 TEST_F(DatabaseBackedPoolTest, DoesntReloadFilesUncesessarily) {
   // If FindFileContainingSymbol() or FindFileContainingExtension() return a
   // file that is already in the DescriptorPool, it should not attempt to
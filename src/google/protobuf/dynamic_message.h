@@ -215,8 +215,13 @@ class LIBPROTOBUF_EXPORT DynamicMapSorter {
           return first < second;
         }
         case FieldDescriptor::CPPTYPE_STRING: {
-          string first = reflection->GetString(*a, field_);
-          string second = reflection->GetString(*b, field_);
+          // Compare the keys in place rather than copying both of them for
+          // every comparison of the sort.
+          string first_scratch, second_scratch;
+          const string& first =
+              reflection->GetStringReference(*a, field_, &first_scratch);
+          const string& second =
+              reflection->GetStringReference(*b, field_, &second_scratch);
           return first < second;
         }
         default:
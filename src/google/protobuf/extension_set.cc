@@ -32,6 +32,7 @@
 //  Based on original Protocol Buffers design by
 //  Sanjay Ghemawat, Jeff Dean, and others.
 
+#include <algorithm>
 #include <google/protobuf/stubs/hash.h>
 #include <google/protobuf/stubs/common.h>
 #include <google/protobuf/stubs/once.h>
@@ -178,13 +179,9 @@ void ExtensionSet::RegisterMessageExtension(const MessageLite* containing_type,
 // Constructors and basic methods.
 
 ExtensionSet::ExtensionSet(::google::protobuf::Arena* arena)
-    : arena_(arena) {
-  if (arena_ != NULL) {
-    arena_->OwnDestructor(&extensions_);
-  }
-}
+    : extensions_(arena), arena_(arena) {}
 
-ExtensionSet::ExtensionSet() : arena_(NULL) {}
+ExtensionSet::ExtensionSet() : extensions_(NULL), arena_(NULL) {}
 
 ExtensionSet::~ExtensionSet() {
   // Deletes all allocated extensions.
@@ -868,6 +865,7 @@ void ExtensionSet::Clear() {
 }
 
 void ExtensionSet::MergeFrom(const ExtensionSet& other) {
+  extensions_.reserve(extensions_.SizeOfUnion(other.extensions_));
   for (ExtensionMap::const_iterator iter = other.extensions_.begin();
        iter != other.extensions_.end(); ++iter) {
     const Extension& other_extension = iter->second;
@@ -1378,6 +1376,154 @@ bool ExtensionSet::MaybeNewExtension(int number,
   return insert_result.second;
 }
 
+// ===================================================================
+// Methods of ExtensionSet::ExtensionMap
+
+struct ExtensionSet::ExtensionMap::KeyLess {
+  bool operator()(const KeyValue& kv, int key) const { return kv.first < key; }
+};
+
+ExtensionSet::ExtensionMap::~ExtensionMap() {
+  if (arena_ == NULL) {
+    delete large_;
+    ::operator delete[](flat_);
+  }
+}
+
+ExtensionSet::KeyValue* ExtensionSet::ExtensionMap::FlatLowerBound(
+    int key) const {
+  // Parsing usually inserts extensions in field number order, so check the
+  // end of the array first.
+  if (flat_size_ == 0 || flat_[flat_size_ - 1].first < key) {
+    return flat_end();
+  }
+  return std::lower_bound(flat_, flat_end(), key, KeyLess());
+}
+
+ExtensionSet::ExtensionMap::iterator ExtensionSet::ExtensionMap::find(
+    int key) {
+  if (GOOGLE_PREDICT_FALSE(is_large())) return iterator(large_->find(key));
+  KeyValue* it = FlatLowerBound(key);
+  return it != flat_end() && it->first == key ? iterator(it) : end();
+}
+
+ExtensionSet::ExtensionMap::const_iterator ExtensionSet::ExtensionMap::find(
+    int key) const {
+  if (GOOGLE_PREDICT_FALSE(is_large())) {
+    return const_iterator(
+        static_cast<const LargeMap*>(large_)->find(key));
+  }
+  const KeyValue* it = FlatLowerBound(key);
+  return it != flat_end() && it->first == key ? const_iterator(it) : end();
+}
+
+ExtensionSet::ExtensionMap::const_iterator
+ExtensionSet::ExtensionMap::lower_bound(int key) const {
+  if (GOOGLE_PREDICT_FALSE(is_large())) {
+    return const_iterator(
+        static_cast<const LargeMap*>(large_)->lower_bound(key));
+  }
+  return const_iterator(FlatLowerBound(key));
+}
+
+std::pair<ExtensionSet::ExtensionMap::iterator, bool>
+ExtensionSet::ExtensionMap::insert(const std::pair<int, Extension>& kv) {
+  if (!is_large()) {
+    KeyValue* it = FlatLowerBound(kv.first);
+    if (it != flat_end() && it->first == kv.first) {
+      return std::make_pair(iterator(it), false);
+    }
+    if (flat_size_ == flat_capacity_) {
+      const size_t index = it - flat_;
+      reserve(flat_size_ + 1);
+      it = flat_ + index;
+    }
+    if (!is_large()) {
+      std::copy_backward(it, flat_end(), flat_end() + 1);
+      it->first = kv.first;
+      it->second = kv.second;
+      ++flat_size_;
+      return std::make_pair(iterator(it), true);
+    }
+  }
+  KeyValue value;
+  value.first = kv.first;
+  value.second = kv.second;
+  std::pair<LargeMap::iterator, bool> result =
+      large_->insert(std::make_pair(kv.first, value));
+  return std::make_pair(iterator(result.first), result.second);
+}
+
+void ExtensionSet::ExtensionMap::erase(int key) {
+  if (GOOGLE_PREDICT_FALSE(is_large())) {
+    large_->erase(key);
+    return;
+  }
+  KeyValue* it = FlatLowerBound(key);
+  if (it != flat_end() && it->first == key) {
+    std::copy(it + 1, flat_end(), it);
+    --flat_size_;
+  }
+}
+
+void ExtensionSet::ExtensionMap::reserve(size_t n) {
+  if (is_large() || n <= flat_capacity_) return;
+  size_t new_capacity = flat_capacity_;
+  do {
+    new_capacity = new_capacity == 0 ? 1 : new_capacity * 4;
+  } while (new_capacity < n);
+
+  KeyValue* const old_flat = flat_;
+  if (new_capacity > static_cast<size_t>(kMaximumFlatCapacity)) {
+    large_ = Arena::Create<LargeMap>(arena_);
+    for (const KeyValue* it = flat_; it != flat_end(); ++it) {
+      large_->insert(large_->end(), std::make_pair(it->first, *it));
+    }
+    flat_ = NULL;
+    flat_capacity_ = flat_size_ = 0;
+  } else {
+    flat_ = Arena::CreateArray<KeyValue>(arena_, new_capacity);
+    std::copy(old_flat, old_flat + flat_size_, flat_);
+    flat_capacity_ = static_cast<uint16>(new_capacity);
+  }
+  if (arena_ == NULL) ::operator delete[](old_flat);
+}
+
+size_t ExtensionSet::ExtensionMap::SizeOfUnion(
+    const ExtensionMap& other) const {
+  size_t result = 0;
+  const_iterator a = begin(), a_end = end();
+  const_iterator b = other.begin(), b_end = other.end();
+  while (a != a_end && b != b_end) {
+    if (a->first < b->first) {
+      ++a;
+    } else if (b->first < a->first) {
+      ++b;
+    } else {
+      ++a;
+      ++b;
+    }
+    ++result;
+  }
+  for (; a != a_end; ++a) ++result;
+  for (; b != b_end; ++b) ++result;
+  return result;
+}
+
+void ExtensionSet::ExtensionMap::swap(ExtensionMap& other) {
+  using std::swap;
+  swap(arena_, other.arena_);
+  swap(flat_, other.flat_);
+  swap(flat_capacity_, other.flat_capacity_);
+  swap(flat_size_, other.flat_size_);
+  swap(large_, other.large_);
+}
+
+size_t ExtensionSet::ExtensionMap::SpaceUsedExcludingSelfLong() const {
+  return is_large() ? large_->size() * sizeof(LargeMap::value_type)
+                    : flat_capacity_ * sizeof(KeyValue);
+}
+
 // ===================================================================
 // Methods of ExtensionSet::Extension
 
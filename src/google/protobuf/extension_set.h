@@ -561,7 +561,145 @@ class LIBPROTOBUF_EXPORT ExtensionSet {
     void Free();
     size_t SpaceUsedExcludingSelfLong() const;
   };
-  typedef std::map<int, Extension> ExtensionMap;
+
+  // An Extension with its field number.
+  struct KeyValue {
+    int first;
+    Extension second;
+  };
+
+  // ExtensionMap holds the extensions of the set sorted by field number.  It
+  // implements the part of the std::map<int, Extension> interface that
+  // ExtensionSet uses, with KeyValue as its value_type.
+  //
+  // Most sets hold a handful of extensions, so up to kMaximumFlatCapacity of
+  // them are kept in a sorted array, which is binary searched and walked
+  // without chasing pointers.  The array is allocated on the set's arena if it
+  // has one, and grows geometrically.  A set that outgrows it moves to a
+  // std::map for good.
+  //
+  // Inserting into or erasing from the array moves the extensions after the
+  // position, so iterators and pointers into an ExtensionMap are only valid
+  // until the next insert() or erase().
+  class LIBPROTOBUF_EXPORT ExtensionMap {
+    typedef std::map<int, KeyValue> LargeMap;
+
+   public:
+    // iterator and const_iterator are instantiations of iterator_base.
+    template <typename KV, typename LargeIterator>
+    class iterator_base {
+     public:
+      iterator_base() : flat_(NULL), is_large_(false) {}
+      explicit iterator_base(KV* flat) : flat_(flat), is_large_(false) {}
+      explicit iterator_base(LargeIterator large)
+          : flat_(NULL), large_(large), is_large_(true) {}
+
+      // Lets an iterator convert to a const_iterator.
+      template <typename OtherKV, typename OtherLargeIterator>
+      iterator_base(const iterator_base<OtherKV, OtherLargeIterator>& other)
+          : flat_(other.flat_),
+            large_(other.large_),
+            is_large_(other.is_large_) {}
+
+      KV& operator*() const { return is_large_ ? large_->second : *flat_; }
+      KV* operator->() const { return &operator*(); }
+
+      iterator_base& operator++() {
+        if (is_large_) {
+          ++large_;
+        } else {
+          ++flat_;
+        }
+        return *this;
+      }
+
+      bool operator==(const iterator_base& other) const {
+        return is_large_ ? large_ == other.large_ : flat_ == other.flat_;
+      }
+      bool operator!=(const iterator_base& other) const {
+        return !(*this == other);
+      }
+
+     private:
+      template <typename OtherKV, typename OtherLargeIterator>
+      friend class iterator_base;
+
+      KV* flat_;
+      LargeIterator large_;
+      bool is_large_;
+    };
+
+    typedef KeyValue value_type;
+    typedef iterator_base<KeyValue, LargeMap::iterator> iterator;
+    typedef iterator_base<const KeyValue, LargeMap::const_iterator>
+        const_iterator;
+
+    explicit ExtensionMap(::google::protobuf::Arena* arena)
+        : arena_(arena),
+          flat_(NULL),
+          flat_capacity_(0),
+          flat_size_(0),
+          large_(NULL) {}
+    ~ExtensionMap();
+
+    iterator begin() {
+      return is_large() ? iterator(large_->begin()) : iterator(flat_);
+    }
+    iterator end() {
+      return is_large() ? iterator(large_->end()) : iterator(flat_end());
+    }
+    const_iterator begin() const {
+      return is_large() ? const_iterator(large_->begin())
+                        : const_iterator(flat_);
+    }
+    const_iterator end() const {
+      return is_large() ? const_iterator(large_->end())
+                        : const_iterator(flat_end());
+    }
+
+    size_t size() const { return is_large() ? large_->size() : flat_size_; }
+    bool empty() const { return size() == 0; }
+
+    iterator find(int key);
+    const_iterator find(int key) const;
+    const_iterator lower_bound(int key) const;
+
+    // Inserts kv unless there is an extension with its number already.
+    // Returns the extension with the number, and whether it was inserted.
+    std::pair<iterator, bool> insert(const std::pair<int, Extension>& kv);
+    void erase(int key);
+
+    // Makes room for n extensions, so that inserting up to that many does
+    // not move the array again.
+    void reserve(size_t n);
+
+    // Returns how many distinct field numbers this and other hold together.
+    size_t SizeOfUnion(const ExtensionMap& other) const;
+
+    void swap(ExtensionMap& other);
+
+    // The memory used by the array or the map, not counting what the
+    // extensions point to.
+    size_t SpaceUsedExcludingSelfLong() const;
+
+   private:
+    struct KeyLess;
+
+    enum { kMaximumFlatCapacity = 256 };
+
+    bool is_large() const { return large_ != NULL; }
+    KeyValue* flat_end() const { return flat_ + flat_size_; }
+    KeyValue* FlatLowerBound(int key) const;
+
+    ::google::protobuf::Arena* arena_;
+    KeyValue* flat_;
+    uint16 flat_capacity_;
+    uint16 flat_size_;
+    // Non-NULL once the extensions have moved out of the array.
+    LargeMap* large_;
+
+    GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(ExtensionMap);
+  };
 
 
   // Merges existing Extension from other_extension
@@ -628,10 +766,10 @@ class LIBPROTOBUF_EXPORT ExtensionSet {
 
   // The Extension struct is small enough to be passed by value, so we use it
   // directly as the value type in the map rather than use pointers.  We use
-  // a map rather than hash_map here because we expect most ExtensionSets will
-  // only contain a small number of extensions whereas hash_map is optimized
-  // for 100 elements or more.  Also, we want AppendToList() to order fields
-  // by field number.
+  // a sorted map rather than hash_map here because we expect most
+  // ExtensionSets will only contain a small number of extensions whereas
+  // hash_map is optimized for 100 elements or more.  Also, we want
+  // AppendToList() to order fields by field number.
   ExtensionMap extensions_;
   ::google::protobuf::Arena* arena_;
   GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(ExtensionSet);
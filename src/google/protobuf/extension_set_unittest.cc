@@ -667,6 +667,66 @@ TEST(ExtensionSetTest, UnpackedToPackedParsing) {
                            protobuf_unittest::FOREIGN_BAR);
 }
 
+TEST(ExtensionSetTest, ManyExtensions) {
+  // More extensions than ExtensionSet keeps in its flat array, set in a
+  // scrambled order.
+  const int kNumExtensions = 300;
+  for (int use_arena = 0; use_arena < 2; use_arena++) {
+    Arena arena;
+    Arena* arena_ptr = use_arena ? &arena : NULL;
+    ExtensionSet set(arena_ptr);
+    ExtensionSet other(arena_ptr);
+    for (int i = 0; i < kNumExtensions; i++) {
+      const int number = (i * 7) % kNumExtensions + 1;
+      set.SetInt32(number, WireFormatLite::TYPE_INT32, number * 10, NULL);
+      EXPECT_EQ(i + 1, set.NumExtensions());
+    }
+    for (int number = 1; number <= kNumExtensions; number++) {
+      EXPECT_EQ(number * 10, set.GetInt32(number, 0));
+    }
+
+    // Extensions are serialized in field number order.
+    string data(set.ByteSize(), '\0');
+    uint8* start = reinterpret_cast<uint8*>(string_as_array(&data));
+    EXPECT_EQ(start + data.size(), set.SerializeWithCachedSizesToArray(
+                                       1, kNumExtensions + 1, start));
+    io::CodedInputStream input(start, data.size());
+    for (int number = 1; number <= kNumExtensions; number++) {
+      EXPECT_EQ(WireFormatLite::MakeTag(number,
+                                        WireFormatLite::WIRETYPE_VARINT),
+                input.ReadTag());
+      uint32 value;
+      ASSERT_TRUE(input.ReadVarint32(&value));
+      EXPECT_EQ(number * 10, value);
+    }
+
+    // Swapping an extension into a set that lacks it erases it from the
+    // other set, from the map and from the flat array.
+    for (int number = 2; number <= kNumExtensions; number += 2) {
+      set.SwapExtension(&other, number);
+    }
+    for (int number = 2; number <= 10; number += 4) {
+      other.SwapExtension(&set, number);
+    }
+    for (int number = 1; number <= kNumExtensions; number++) {
+      const bool in_set = number % 2 == 1 || (number <= 10 && number % 4 == 2);
+      EXPECT_EQ(in_set, set.Has(number)) << number;
+      EXPECT_EQ(!in_set, other.Has(number)) << number;
+      EXPECT_EQ(number * 10, (in_set ? set : other).GetInt32(number, 0));
+    }
+    EXPECT_EQ(kNumExtensions, set.NumExtensions() + other.NumExtensions());
+
+    // Merging sizes the flat array for both sets at once.
+    ExtensionSet merged(arena_ptr);
+    merged.MergeFrom(other);
+    merged.MergeFrom(set);
+    EXPECT_EQ(kNumExtensions, merged.NumExtensions());
+    for (int number = 1; number <= kNumExtensions; number++) {
+      EXPECT_EQ(number * 10, merged.GetInt32(number, 0));
+    }
+  }
+}
+
 TEST(ExtensionSetTest, IsInitialized) {
   // Test that IsInitialized() returns false if required fields in nested
   // extensions are missing.
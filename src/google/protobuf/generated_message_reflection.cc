@@ -756,7 +756,7 @@ int GeneratedMessageReflection::FieldSize(const Message& message,
       case FieldDescriptor::CPPTYPE_STRING:
       case FieldDescriptor::CPPTYPE_MESSAGE:
         if (IsMapFieldInApi(field)) {
-          return GetRaw<MapFieldBase>(message, field).GetRepeatedField().size();
+          return GetRaw<MapFieldBase>(message, field).RepeatedFieldSize();
         } else {
           return GetRaw<RepeatedPtrFieldBase>(message, field).size();
         }
@@ -32,7 +32,10 @@
 
 #include <google/protobuf/stubs/type_traits.h>
 
+#include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/io/zero_copy_stream_impl_lite.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_util.h>
 #include <google/protobuf/metadata_lite.h>
 #include <google/protobuf/repeated_field.h>
 #include <google/protobuf/wire_format_lite.h>
@@ -236,6 +239,31 @@ inline bool ReadMessage(io::CodedInputStream* input, MessageLite* value,
   return input->DecrementRecursionDepthAndPopLimit(p.first);
 }
 
+
+// Copies the field with the given tag, which the table does not know about,
+// from input to the unknown fields.
+bool SkipUnknownField(MessageLite* msg, const ParseTable& table, uint32 tag,
+                      io::CodedInputStream* input) {
+  GOOGLE_DCHECK(!table.unknown_field_set);
+  ::google::protobuf::io::StringOutputStream unknown_fields_string(
+      MutableUnknownFields(msg, table.arena_offset));
+  ::google::protobuf::io::CodedOutputStream unknown_fields_stream(
+      &unknown_fields_string, false);
+
+  return ::google::protobuf::internal::WireFormatLite::SkipField(
+      input, tag, &unknown_fields_stream);
+}
+
+// Records an enum value the validator rejected as an unknown varint field.
+void StoreUnknownEnum(string* unknown_fields, uint32 tag, int value) {
+  ::google::protobuf::io::StringOutputStream unknown_fields_string(
+      unknown_fields);
+  ::google::protobuf::io::CodedOutputStream unknown_fields_stream(
+      &unknown_fields_string, false);
+  unknown_fields_stream.WriteVarint32(tag);
+  unknown_fields_stream.WriteVarint32(value);
+}
+
 }  // namespace
 
 class MergePartialFromCodedStreamHelper {
@@ -247,6 +275,282 @@ class MergePartialFromCodedStreamHelper {
   }
 };
 
+namespace {
+
+// Each field is parsed by a handler specialized for its processing type,
+// looked up in kFieldHandlers (or kPackedFieldHandlers, for packed data) from
+// the tag's entry in the table.  Handlers for repeated fields keep reading
+// for as long as the next tag is the same, so runs of elements are parsed
+// without going back through the dispatch loop.
+typedef bool (*FieldHandler)(MessageLite* msg, uint32* has_bits,
+                             const ParseTable& table, int field_number,
+                             uint32 tag, io::CodedInputStream* input);
+
+template <bool repeated, typename CType, WireFormatLite::FieldType type>
+bool ParsePrimitiveField(MessageLite* msg, uint32* has_bits,
+                         const ParseTable& table, int field_number, uint32 tag,
+                         io::CodedInputStream* input) {
+  const ParseTableField& data = table.fields[field_number];
+
+  if (!repeated) {
+    CType value;
+    if (GOOGLE_PREDICT_FALSE(
+            (!WireFormatLite::ReadPrimitive<CType, type>(input, &value)))) {
+      return false;
+    }
+    SetField(msg, has_bits, data.has_bit_index, data.offset, value);
+    return true;
+  }
+
+  google::protobuf::RepeatedField<CType>* values =
+      Raw<google::protobuf::RepeatedField<CType> >(msg, data.offset);
+  // ReadRepeatedPrimitive only reads ahead into the space already reserved
+  // in values, so check for more elements once it runs out.
+  do {
+    if (GOOGLE_PREDICT_FALSE((!WireFormatLite::ReadRepeatedPrimitive<CType, type>(
+            data.tag_size, tag, input, values)))) {
+      return false;
+    }
+  } while (input->ExpectTag(tag));
+  return true;
+}
+
+template <typename CType, WireFormatLite::FieldType type>
+bool ParsePackedField(MessageLite* msg, uint32* has_bits,
+                      const ParseTable& table, int field_number, uint32 tag,
+                      io::CodedInputStream* input) {
+  google::protobuf::RepeatedField<CType>* values =
+      Raw<google::protobuf::RepeatedField<CType> >(
+          msg, table.fields[field_number].offset);
+  do {
+    if (GOOGLE_PREDICT_FALSE(
+            (!WireFormatLite::ReadPackedPrimitive<CType, type>(input, values)))) {
+      return false;
+    }
+  } while (input->ExpectTag(tag));
+  return true;
+}
+
+template <bool repeated, bool validate>
+bool ParseStringField(MessageLite* msg, uint32* has_bits,
+                      const ParseTable& table, int field_number, uint32 tag,
+                      io::CodedInputStream* input) {
+  GOOGLE_DCHECK(!table.unknown_field_set);
+  const ParseTableField& data = table.fields[field_number];
+  const AuxillaryParseTableField::string_aux& aux =
+      table.aux[field_number].strings;
+  Arena* const arena = GetArena(msg, table.arena_offset);
+
+  do {
+    if (GOOGLE_PREDICT_FALSE((!HandleString<repeated, validate, StringType_STRING>(
+            input, msg, arena, has_bits, data.has_bit_index, data.offset,
+            aux.default_ptr, aux.strict_utf8, aux.field_name)))) {
+      return false;
+    }
+  } while (repeated && input->ExpectTag(tag));
+  return true;
+}
+
+template <bool repeated>
+bool ParseEnumField(MessageLite* msg, uint32* has_bits,
+                    const ParseTable& table, int field_number, uint32 tag,
+                    io::CodedInputStream* input) {
+  const ParseTableField& data = table.fields[field_number];
+  AuxillaryParseTableField::EnumValidator validator =
+      table.aux[field_number].enums.validator;
+
+  do {
+    int value;
+    if (GOOGLE_PREDICT_FALSE((!WireFormatLite::ReadPrimitive<
+                       int, WireFormatLite::TYPE_ENUM>(input, &value)))) {
+      return false;
+    }
+
+    if (!validator(value)) {
+      GOOGLE_DCHECK(!table.unknown_field_set);
+      StoreUnknownEnum(MutableUnknownFields(msg, table.arena_offset), tag,
+                       value);
+    } else if (repeated) {
+      AddField(msg, data.offset, value);
+    } else {
+      SetField(msg, has_bits, data.has_bit_index, data.offset, value);
+    }
+  } while (repeated && input->ExpectTag(tag));
+  return true;
+}
+
+bool ParsePackedEnumField(MessageLite* msg, uint32* has_bits,
+                          const ParseTable& table, int field_number,
+                          uint32 tag, io::CodedInputStream* input) {
+  // To avoid unnecessarily calling MutableUnknownFields (which mutates
+  // InternalMetadataWithArena) when all inputs in the repeated series are
+  // valid, we implement our own parser rather than call
+  // WireFormat::ReadPackedEnumPreserveUnknowns.
+  AuxillaryParseTableField::EnumValidator validator =
+      table.aux[field_number].enums.validator;
+  google::protobuf::RepeatedField<int>* values =
+      Raw<google::protobuf::RepeatedField<int> >(
+          msg, table.fields[field_number].offset);
+  string* unknown_fields = NULL;
+
+  do {
+    uint32 length;
+    if (GOOGLE_PREDICT_FALSE(!input->ReadVarint32(&length))) {
+      return false;
+    }
+
+    io::CodedInputStream::Limit limit = input->PushLimit(length);
+    while (input->BytesUntilLimit() > 0) {
+      int value;
+      if (GOOGLE_PREDICT_FALSE(
+              (!google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                  int, WireFormatLite::TYPE_ENUM>(input, &value)))) {
+        return false;
+      }
+
+      if (validator(value)) {
+        values->Add(value);
+      } else {
+        if (GOOGLE_PREDICT_FALSE(unknown_fields == NULL)) {
+          GOOGLE_DCHECK(!table.unknown_field_set);
+          unknown_fields = MutableUnknownFields(msg, table.arena_offset);
+        }
+        // Recorded unpacked, with the tag of the unpacked field.
+        StoreUnknownEnum(unknown_fields,
+                         WireFormatLite::MakeTag(
+                             field_number, WireFormatLite::WIRETYPE_VARINT),
+                         value);
+      }
+    }
+    input->PopLimit(limit);
+  } while (input->ExpectTag(tag));
+  return true;
+}
+
+template <bool repeated, bool group>
+bool ParseMessageField(MessageLite* msg, uint32* has_bits,
+                       const ParseTable& table, int field_number, uint32 tag,
+                       io::CodedInputStream* input) {
+  const ParseTableField& data = table.fields[field_number];
+  const AuxillaryParseTableField::message_aux& aux =
+      table.aux[field_number].messages;
+  const ParseTable* ptable = aux.parse_table;
+
+  do {
+    MessageLite* submsg;
+    if (repeated) {
+      const MessageLite* prototype = aux.default_message();
+      GOOGLE_DCHECK(prototype != NULL);
+      submsg = MergePartialFromCodedStreamHelper::Add(
+          Raw<RepeatedPtrFieldBase>(msg, data.offset), prototype);
+    } else {
+      MessageLite** submsg_holder = MutableField<MessageLite*>(
+          msg, has_bits, data.has_bit_index, data.offset);
+      submsg = *submsg_holder;
+
+      if (submsg == NULL) {
+        GOOGLE_DCHECK(!table.unknown_field_set);
+        Arena* const arena = GetArena(msg, table.arena_offset);
+        submsg = aux.default_message()->New(arena);
+        *submsg_holder = submsg;
+      }
+    }
+
+    if (ptable) {
+      if (GOOGLE_PREDICT_FALSE(
+              group ? !ReadGroup(field_number, input, submsg, *ptable)
+                    : !ReadMessage(input, submsg, *ptable))) {
+        return false;
+      }
+    } else if (GOOGLE_PREDICT_FALSE(
+                   group ? !WireFormatLite::ReadGroup(field_number, input,
+                                                      submsg)
+                         : !WireFormatLite::ReadMessage(input, submsg))) {
+      return false;
+    }
+  } while (repeated && input->ExpectTag(tag));
+  return true;
+}
+
+// Handlers for processing types the generator never emits.
+bool ParseInvalidField(MessageLite* msg, uint32* has_bits,
+                       const ParseTable& table, int field_number, uint32 tag,
+                       io::CodedInputStream* input) {
+  GOOGLE_DCHECK(false);
+  return false;
+}
+
+#ifdef GOOGLE_PROTOBUF_UTF8_VALIDATION_ENABLED
+static const bool kValidateUtf8 = true;
+#else
+static const bool kValidateUtf8 = false;
+#endif
+
+// The handlers of the singular or repeated fields of each type, in the order
+// of WireFormatLite::FieldType.
+#define PRIMITIVE_HANDLER(REPEATED, TYPE, CPPTYPE) \
+  &ParsePrimitiveField<REPEATED, CPPTYPE, WireFormatLite::TYPE_##TYPE>
+#define FIELD_HANDLERS(REPEATED)                      \
+  &ParseInvalidField,                                 \
+  PRIMITIVE_HANDLER(REPEATED, DOUBLE, double),        \
+  PRIMITIVE_HANDLER(REPEATED, FLOAT, float),          \
+  PRIMITIVE_HANDLER(REPEATED, INT64, int64),          \
+  PRIMITIVE_HANDLER(REPEATED, UINT64, uint64),        \
+  PRIMITIVE_HANDLER(REPEATED, INT32, int32),          \
+  PRIMITIVE_HANDLER(REPEATED, FIXED64, uint64),       \
+  PRIMITIVE_HANDLER(REPEATED, FIXED32, uint32),       \
+  PRIMITIVE_HANDLER(REPEATED, BOOL, bool),            \
+  &ParseStringField<REPEATED, kValidateUtf8>,         \
+  &ParseMessageField<REPEATED, true>,                 \
+  &ParseMessageField<REPEATED, false>,                \
+  &ParseStringField<REPEATED, false>,                 \
+  PRIMITIVE_HANDLER(REPEATED, UINT32, uint32),        \
+  &ParseEnumField<REPEATED>,                          \
+  PRIMITIVE_HANDLER(REPEATED, SFIXED32, int32),       \
+  PRIMITIVE_HANDLER(REPEATED, SFIXED64, int64),       \
+  PRIMITIVE_HANDLER(REPEATED, SINT32, int32),         \
+  PRIMITIVE_HANDLER(REPEATED, SINT64, int64)
+
+// Indexed by processing_type.  The entries past MAX_FIELD_TYPE in each half
+// are left NULL.
+const FieldHandler kFieldHandlers[2][kRepeatedMask] = {
+  { FIELD_HANDLERS(false) },
+  { FIELD_HANDLERS(true) },
+};
+
+#undef FIELD_HANDLERS
+#undef PRIMITIVE_HANDLER
+
+#define PACKED_HANDLER(TYPE, CPPTYPE) \
+  &ParsePackedField<CPPTYPE, WireFormatLite::TYPE_##TYPE>
+
+// Indexed by processing_type ^ kRepeatedMask, for packed data.
+const FieldHandler kPackedFieldHandlers[WireFormatLite::MAX_FIELD_TYPE + 1] = {
+  &ParseInvalidField,
+  PACKED_HANDLER(DOUBLE, double),
+  PACKED_HANDLER(FLOAT, float),
+  PACKED_HANDLER(INT64, int64),
+  PACKED_HANDLER(UINT64, uint64),
+  PACKED_HANDLER(INT32, int32),
+  PACKED_HANDLER(FIXED64, uint64),
+  PACKED_HANDLER(FIXED32, uint32),
+  PACKED_HANDLER(BOOL, bool),
+  &ParseInvalidField,  // TYPE_STRING
+  &ParseInvalidField,  // TYPE_GROUP
+  &ParseInvalidField,  // TYPE_MESSAGE
+  &ParseInvalidField,  // TYPE_BYTES
+  PACKED_HANDLER(UINT32, uint32),
+  &ParsePackedEnumField,
+  PACKED_HANDLER(SFIXED32, int32),
+  PACKED_HANDLER(SFIXED64, int64),
+  PACKED_HANDLER(SINT32, int32),
+  PACKED_HANDLER(SINT64, int64),
+};
+
+#undef PACKED_HANDLER
+
+}  // namespace
+
 bool MergePartialFromCodedStream(MessageLite* msg, const ParseTable& table,
                                  io::CodedInputStream* input) {
   // We require that has_bits are present, as to avoid having to check for them
@@ -265,17 +569,9 @@ bool MergePartialFromCodedStream(MessageLite* msg, const ParseTable& table,
     const int field_number = WireFormatLite::GetTagFieldNumber(tag);
 
     if (GOOGLE_PREDICT_FALSE(field_number > table.max_field_number)) {
-      GOOGLE_DCHECK(!table.unknown_field_set);
-      ::google::protobuf::io::StringOutputStream unknown_fields_string(
-          MutableUnknownFields(msg, table.arena_offset));
-      ::google::protobuf::io::CodedOutputStream unknown_fields_stream(
-          &unknown_fields_string, false);
-
-      if (!::google::protobuf::internal::WireFormatLite::SkipField(
-          input, tag, &unknown_fields_stream)) {
+      if (!SkipUnknownField(msg, table, tag, input)) {
         return false;
       }
-
       continue;
     }
 
@@ -285,390 +581,546 @@ bool MergePartialFromCodedStream(MessageLite* msg, const ParseTable& table,
     // with the kInvalidMask value.  As wire_type cannot take on that value, we
     // will never match.
     const ParseTableField* data = table.fields + field_number;
-
-    // TODO(ckennelly): Avoid sign extension
-    const int64 has_bit_index = data->has_bit_index;
-    const int64 offset = data->offset;
     const unsigned char processing_type = data->processing_type;
 
     if (data->normal_wiretype == static_cast<unsigned char>(wire_type)) {
-      // TODO(ckennelly): Use a computed goto on GCC/LLVM or otherwise eliminate
-      // the bounds check on processing_type.
-
-      switch (processing_type) {
-#define STR(S) #S
-#define HANDLE_TYPE(TYPE, CPPTYPE)                                        \
-  case (WireFormatLite::TYPE_##TYPE): {                                   \
-    CPPTYPE value;                                                        \
-    if (GOOGLE_PREDICT_FALSE(                                                    \
-            (!WireFormatLite::ReadPrimitive<                              \
-                CPPTYPE, WireFormatLite::TYPE_##TYPE>(input, &value)))) { \
-      return false;                                                       \
-    }                                                                     \
-    SetField(msg, has_bits, has_bit_index, offset, value);                \
-    break;                                                                \
+      // Field "0" matches only the zero tag, which marks the end of input.
+      if (GOOGLE_PREDICT_FALSE(field_number == 0)) {
+        return true;
+      }
+
+      const FieldHandler handler =
+          kFieldHandlers[processing_type / kRepeatedMask]
+                        [processing_type % kRepeatedMask];
+      GOOGLE_DCHECK(handler != NULL);
+      if (GOOGLE_PREDICT_FALSE(
+              !handler(msg, has_bits, table, field_number, tag, input))) {
+        return false;
+      }
+    } else if (data->packed_wiretype == static_cast<unsigned char>(wire_type)) {
+      // Non-packable fields have their packed_wiretype masked with
+      // kNotPackedMask, which is impossible to match here.
+      GOOGLE_DCHECK(processing_type & kRepeatedMask);
+      GOOGLE_DCHECK_NE(processing_type, kRepeatedMask);
+
+      if (GOOGLE_PREDICT_FALSE(!kPackedFieldHandlers[processing_type ^
+                                              kRepeatedMask](
+              msg, has_bits, table, field_number, tag, input))) {
+        return false;
+      }
+    } else {
+      if (wire_type == WireFormatLite::WIRETYPE_END_GROUP) {
+        // Must be the end of the message.
+        return true;
+      }
+
+      // process unknown field.
+      if (!SkipUnknownField(msg, table, tag, input)) {
+        return false;
+      }
+    }
+  }
+}
+
+namespace {
+
+// PrimitiveTypeHelper maps a declared field type to its C++ type and to the
+// WireFormatLite routines that size and encode it.
+template <int type>
+struct PrimitiveTypeHelper;
+
+#define PRIMITIVE_TYPE_WRITERS(CPPTYPE, CAMEL)                            \
+  typedef CPPTYPE Type;                                                   \
+  static void Write(Type value, io::CodedOutputStream* output) {          \
+    WireFormatLite::Write##CAMEL##NoTag(value, output);                   \
   }                                                                       \
-  case (WireFormatLite::TYPE_##TYPE) | kRepeatedMask: {                   \
-    google::protobuf::RepeatedField<CPPTYPE>* values =                              \
-        Raw<google::protobuf::RepeatedField<CPPTYPE> >(msg, offset);                \
-    if (GOOGLE_PREDICT_FALSE((!WireFormatLite::ReadRepeatedPrimitive<            \
-                       CPPTYPE, WireFormatLite::TYPE_##TYPE>(             \
-            data->tag_size, tag, input, values)))) {                      \
-      return false;                                                       \
-    }                                                                     \
-    break;                                                                \
+  static uint8* Write(Type value, uint8* target) {                        \
+    return WireFormatLite::Write##CAMEL##NoTagToArray(value, target);     \
+  }                                                                       \
+  static uint8* Write(const RepeatedField<Type>& values, uint8* target) { \
+    return WireFormatLite::Write##CAMEL##NoTagToArray(values, target);    \
   }
 
-        HANDLE_TYPE(INT32, int32)
-        HANDLE_TYPE(INT64, int64)
-        HANDLE_TYPE(SINT32, int32)
-        HANDLE_TYPE(SINT64, int64)
-        HANDLE_TYPE(UINT32, uint32)
-        HANDLE_TYPE(UINT64, uint64)
+#define VARINT_TYPE_HELPER(TYPE, CPPTYPE, CAMEL)                        \
+  template <>                                                           \
+  struct PrimitiveTypeHelper<WireFormatLite::TYPE_##TYPE> {             \
+    PRIMITIVE_TYPE_WRITERS(CPPTYPE, CAMEL)                              \
+    static size_t Size(Type value) {                                    \
+      return WireFormatLite::CAMEL##Size(value);                        \
+    }                                                                   \
+    static size_t Size(const RepeatedField<Type>& values) {             \
+      return WireFormatLite::CAMEL##Size(values);                       \
+    }                                                                   \
+  };
+
+#define FIXED_TYPE_HELPER(TYPE, CPPTYPE, CAMEL)                         \
+  template <>                                                           \
+  struct PrimitiveTypeHelper<WireFormatLite::TYPE_##TYPE> {             \
+    PRIMITIVE_TYPE_WRITERS(CPPTYPE, CAMEL)                              \
+    static size_t Size(Type) { return WireFormatLite::k##CAMEL##Size; } \
+    static size_t Size(const RepeatedField<Type>& values) {             \
+      return WireFormatLite::k##CAMEL##Size *                           \
+             FromIntSize(values.size());                                \
+    }                                                                   \
+  };
+
+VARINT_TYPE_HELPER(INT32, int32, Int32)
+VARINT_TYPE_HELPER(INT64, int64, Int64)
+VARINT_TYPE_HELPER(UINT32, uint32, UInt32)
+VARINT_TYPE_HELPER(UINT64, uint64, UInt64)
+VARINT_TYPE_HELPER(SINT32, int32, SInt32)
+VARINT_TYPE_HELPER(SINT64, int64, SInt64)
+VARINT_TYPE_HELPER(ENUM, int, Enum)
+
+FIXED_TYPE_HELPER(FIXED32, uint32, Fixed32)
+FIXED_TYPE_HELPER(FIXED64, uint64, Fixed64)
+FIXED_TYPE_HELPER(SFIXED32, int32, SFixed32)
+FIXED_TYPE_HELPER(SFIXED64, int64, SFixed64)
+FIXED_TYPE_HELPER(FLOAT, float, Float)
+FIXED_TYPE_HELPER(DOUBLE, double, Double)
+FIXED_TYPE_HELPER(BOOL, bool, Bool)
+
+#undef FIXED_TYPE_HELPER
+#undef VARINT_TYPE_HELPER
+#undef PRIMITIVE_TYPE_WRITERS
+
+// The serializer is written once against the overloads below, which either
+// append to a flat buffer or write to a CodedOutputStream.
+struct ArrayOutput {
+  uint8* ptr;
+  bool is_deterministic;
+};
 
-        HANDLE_TYPE(FIXED32, uint32)
-        HANDLE_TYPE(FIXED64, uint64)
-        HANDLE_TYPE(SFIXED32, int32)
-        HANDLE_TYPE(SFIXED64, int64)
+inline void WriteTagTo(uint32 tag, io::CodedOutputStream* output) {
+  output->WriteTag(tag);
+}
 
-        HANDLE_TYPE(FLOAT, float)
-        HANDLE_TYPE(DOUBLE, double)
+inline void WriteTagTo(uint32 tag, ArrayOutput* output) {
+  output->ptr = io::CodedOutputStream::WriteTagToArray(tag, output->ptr);
+}
 
-        HANDLE_TYPE(BOOL, bool)
+inline void WriteLengthTo(uint32 length, io::CodedOutputStream* output) {
+  output->WriteVarint32(length);
+}
+
+inline void WriteLengthTo(uint32 length, ArrayOutput* output) {
+  output->ptr = io::CodedOutputStream::WriteVarint32ToArray(length, output->ptr);
+}
+
+inline void WriteRawTo(const string& data, io::CodedOutputStream* output) {
+  output->WriteRaw(data.data(), static_cast<int>(data.size()));
+}
+
+inline void WriteRawTo(const string& data, ArrayOutput* output) {
+  output->ptr = io::CodedOutputStream::WriteRawToArray(
+      data.data(), static_cast<int>(data.size()), output->ptr);
+}
+
+template <int type>
+inline void WritePrimitiveTo(typename PrimitiveTypeHelper<type>::Type value,
+                             io::CodedOutputStream* output) {
+  PrimitiveTypeHelper<type>::Write(value, output);
+}
+
+template <int type>
+inline void WritePrimitiveTo(typename PrimitiveTypeHelper<type>::Type value,
+                             ArrayOutput* output) {
+  output->ptr = PrimitiveTypeHelper<type>::Write(value, output->ptr);
+}
+
+template <int type>
+void WritePackedTo(
+    const RepeatedField<typename PrimitiveTypeHelper<type>::Type>& values,
+    int byte_size, io::CodedOutputStream* output) {
+  // Use the bulk array encoders whenever the stream has room for the data.
+  uint8* target = output->GetDirectBufferForNBytesAndAdvance(byte_size);
+  if (target != NULL) {
+    PrimitiveTypeHelper<type>::Write(values, target);
+    return;
+  }
+
+  for (int i = 0; i < values.size(); i++) {
+    PrimitiveTypeHelper<type>::Write(values.Get(i), output);
+  }
+}
+
+template <int type>
+inline void WritePackedTo(
+    const RepeatedField<typename PrimitiveTypeHelper<type>::Type>& values,
+    int byte_size, ArrayOutput* output) {
+  output->ptr = PrimitiveTypeHelper<type>::Write(values, output->ptr);
+}
+
+template <typename O>
+void SerializeFields(const MessageLite* msg, const SerializationTable& table,
+                     O* output);
+
+inline void SerializeMessageTo(const MessageLite* msg,
+                               const SerializationTable* table,
+                               io::CodedOutputStream* output) {
+  if (table == NULL) {
+    msg->SerializeWithCachedSizes(output);
+    return;
+  }
+
+  SerializeFields(msg, *table, output);
+}
+
+inline void SerializeMessageTo(const MessageLite* msg,
+                               const SerializationTable* table,
+                               ArrayOutput* output) {
+  if (table == NULL) {
+    output->ptr = msg->InternalSerializeWithCachedSizesToArray(
+        output->is_deterministic, output->ptr);
+    return;
+  }
+
+  SerializeFields(msg, *table, output);
+}
+
+inline int CachedSize(const MessageLite* msg,
+                      const SerializationTable* table) {
+  if (table == NULL) {
+    return msg->GetCachedSize();
+  }
+
+  return *Raw<int>(msg, table->cached_size_offset);
+}
+
+inline bool HasBit(const uint32* has_bits, uint32 has_bit_index) {
+  return (has_bits[has_bit_index / 32u] &
+          (static_cast<uint32>(1u) << (has_bit_index % 32))) != 0;
+}
+
+template <int type, typename O>
+inline void SerializeSingular(const MessageLite* msg,
+                              const SerializationTableField& field,
+                              O* output) {
+  typedef typename PrimitiveTypeHelper<type>::Type Type;
+  WriteTagTo(field.tag, output);
+  WritePrimitiveTo<type>(*Raw<Type>(msg, field.offset), output);
+}
+
+template <int type, typename O>
+inline void SerializeRepeated(const MessageLite* msg,
+                              const SerializationTableField& field,
+                              O* output) {
+  typedef typename PrimitiveTypeHelper<type>::Type Type;
+  const RepeatedField<Type>& values =
+      *Raw<RepeatedField<Type> >(msg, field.offset);
+  for (int i = 0; i < values.size(); i++) {
+    WriteTagTo(field.tag, output);
+    WritePrimitiveTo<type>(values.Get(i), output);
+  }
+}
+
+template <int type, typename O>
+inline void SerializePacked(const MessageLite* msg,
+                            const SerializationTableField& field, O* output) {
+  typedef typename PrimitiveTypeHelper<type>::Type Type;
+  const RepeatedField<Type>& values =
+      *Raw<RepeatedField<Type> >(msg, field.offset);
+  if (values.empty()) {
+    return;
+  }
+
+  const int byte_size = *Raw<int>(msg, field.has_offset);
+  WriteTagTo(field.tag, output);
+  WriteLengthTo(byte_size, output);
+  WritePackedTo<type>(values, byte_size, output);
+}
+
+template <typename O>
+inline void SerializeString(const string& value,
+                            const SerializationTableField& field, O* output) {
+  WriteTagTo(field.tag, output);
+  WriteLengthTo(static_cast<uint32>(value.size()), output);
+  WriteRawTo(value, output);
+}
+
+template <typename O>
+inline void SerializeGroup(const MessageLite* value,
+                           const SerializationTableField& field, O* output) {
+  WriteTagTo(field.tag, output);
+  SerializeMessageTo(value, field.table, output);
+  WriteTagTo(WireFormatLite::MakeTag(WireFormatLite::GetTagFieldNumber(field.tag),
+                                     WireFormatLite::WIRETYPE_END_GROUP),
+             output);
+}
+
+template <typename O>
+inline void SerializeMessage(const MessageLite* value,
+                             const SerializationTableField& field, O* output) {
+  WriteTagTo(field.tag, output);
+  WriteLengthTo(CachedSize(value, field.table), output);
+  SerializeMessageTo(value, field.table, output);
+}
+
+template <typename O>
+void SerializeFields(const MessageLite* msg, const SerializationTable& table,
+                     O* output) {
+  const uint32* has_bits = Raw<uint32>(msg, table.has_bits_offset);
+
+  for (int i = 0; i < table.num_fields; i++) {
+    const SerializationTableField& field = table.fields[i];
+    const unsigned char processing_type = field.processing_type;
+
+    // Repeated fields are written when they are non-empty; for the others, the
+    // has-bit decides.
+    if (!(processing_type & kRepeatedMask) &&
+        !HasBit(has_bits, field.has_offset)) {
+      continue;
+    }
+
+    switch (processing_type) {
+#define HANDLE_TYPE(TYPE)                                                     \
+  case WireFormatLite::TYPE_##TYPE:                                           \
+    SerializeSingular<WireFormatLite::TYPE_##TYPE>(msg, field, output);       \
+    break;                                                                    \
+  case WireFormatLite::TYPE_##TYPE | kRepeatedMask:                           \
+    SerializeRepeated<WireFormatLite::TYPE_##TYPE>(msg, field, output);       \
+    break;                                                                    \
+  case WireFormatLite::TYPE_##TYPE | kRepeatedMask | kPackedMask:             \
+    SerializePacked<WireFormatLite::TYPE_##TYPE>(msg, field, output);         \
+    break;
+
+      HANDLE_TYPE(INT32)
+      HANDLE_TYPE(INT64)
+      HANDLE_TYPE(SINT32)
+      HANDLE_TYPE(SINT64)
+      HANDLE_TYPE(UINT32)
+      HANDLE_TYPE(UINT64)
+
+      HANDLE_TYPE(FIXED32)
+      HANDLE_TYPE(FIXED64)
+      HANDLE_TYPE(SFIXED32)
+      HANDLE_TYPE(SFIXED64)
+
+      HANDLE_TYPE(FLOAT)
+      HANDLE_TYPE(DOUBLE)
+
+      HANDLE_TYPE(BOOL)
+      HANDLE_TYPE(ENUM)
 #undef HANDLE_TYPE
-#undef STR
-        case WireFormatLite::TYPE_BYTES:
-#ifndef GOOGLE_PROTOBUF_UTF8_VALIDATION_ENABLED
-        case WireFormatLite::TYPE_STRING:
-#endif
-        {
-          GOOGLE_DCHECK(!table.unknown_field_set);
-          Arena* const arena = GetArena(msg, table.arena_offset);
-          const void* default_ptr = table.aux[field_number].strings.default_ptr;
-
-          if (GOOGLE_PREDICT_FALSE((!HandleString<false, false, StringType_STRING>(
-                  input, msg, arena, has_bits, has_bit_index, offset,
-                  default_ptr, false, NULL)))) {
-            return false;
-          }
-          break;
-        }
-        case (WireFormatLite::TYPE_BYTES) | kRepeatedMask:
-#ifndef GOOGLE_PROTOBUF_UTF8_VALIDATION_ENABLED
-        case (WireFormatLite::TYPE_STRING) | kRepeatedMask:
-#endif
-        {
-          GOOGLE_DCHECK(!table.unknown_field_set);
-          Arena* const arena = GetArena(msg, table.arena_offset);
-          const void* default_ptr =
-              table.aux[field_number].strings.default_ptr;
-
-          if (GOOGLE_PREDICT_FALSE((!HandleString<true, false, StringType_STRING>(
-                  input, msg, arena, has_bits, has_bit_index, offset,
-                  default_ptr, false, NULL)))) {
-            return false;
-          }
-          break;
+      case WireFormatLite::TYPE_STRING:
+      case WireFormatLite::TYPE_BYTES:
+        SerializeString(Raw<ArenaStringPtr>(msg, field.offset)->Get(), field,
+                        output);
+        break;
+      case WireFormatLite::TYPE_STRING | kRepeatedMask:
+      case WireFormatLite::TYPE_BYTES | kRepeatedMask: {
+        const RepeatedPtrField<string>& values =
+            *Raw<RepeatedPtrField<string> >(msg, field.offset);
+        for (int j = 0; j < values.size(); j++) {
+          SerializeString(values.Get(j), field, output);
         }
-#ifdef GOOGLE_PROTOBUF_UTF8_VALIDATION_ENABLED
-        case (WireFormatLite::TYPE_STRING): {
-          GOOGLE_DCHECK(!table.unknown_field_set);
-          Arena* const arena = GetArena(msg, table.arena_offset);
-          const void* default_ptr = table.aux[field_number].strings.default_ptr;
-          const char* field_name = table.aux[field_number].strings.field_name;
-          const bool strict_utf8 = table.aux[field_number].strings.strict_utf8;
-
-          if (GOOGLE_PREDICT_FALSE((!HandleString<false, true, StringType_STRING>(
-                  input, msg, arena, has_bits, has_bit_index, offset,
-                  default_ptr, strict_utf8, field_name)))) {
-            return false;
-          }
-          break;
-        }
-        case (WireFormatLite::TYPE_STRING) | kRepeatedMask: {
-          GOOGLE_DCHECK(!table.unknown_field_set);
-          Arena* const arena = GetArena(msg, table.arena_offset);
-          const void* default_ptr = table.aux[field_number].strings.default_ptr;
-          const char* field_name = table.aux[field_number].strings.field_name;
-          const bool strict_utf8 = table.aux[field_number].strings.strict_utf8;
-
-          if (GOOGLE_PREDICT_FALSE((!HandleString<true, true, StringType_STRING>(
-                  input, msg, arena, has_bits, has_bit_index, offset,
-                  default_ptr, strict_utf8, field_name)))) {
-            return false;
-          }
-          break;
-        }
-#endif
-        case WireFormatLite::TYPE_ENUM: {
-          int value;
-          if (GOOGLE_PREDICT_FALSE((!WireFormatLite::ReadPrimitive<
-                             int, WireFormatLite::TYPE_ENUM>(input, &value)))) {
-            return false;
-          }
-
-          AuxillaryParseTableField::EnumValidator validator =
-              table.aux[field_number].enums.validator;
-          if (validator(value)) {
-            SetField(msg, has_bits, has_bit_index, offset, value);
-          } else {
-            GOOGLE_DCHECK(!table.unknown_field_set);
-
-            ::google::protobuf::io::StringOutputStream unknown_fields_string(
-                MutableUnknownFields(msg, table.arena_offset));
-            ::google::protobuf::io::CodedOutputStream unknown_fields_stream(
-                &unknown_fields_string, false);
-            unknown_fields_stream.WriteVarint32(tag);
-            unknown_fields_stream.WriteVarint32(value);
-          }
-          break;
-        }
-        case WireFormatLite::TYPE_ENUM | kRepeatedMask: {
-          int value;
-          if (GOOGLE_PREDICT_FALSE((!WireFormatLite::ReadPrimitive<
-                             int, WireFormatLite::TYPE_ENUM>(input, &value)))) {
-            return false;
-          }
-
-          AuxillaryParseTableField::EnumValidator validator =
-              table.aux[field_number].enums.validator;
-          if (validator(value)) {
-            AddField(msg, offset, value);
-          } else {
-            GOOGLE_DCHECK(!table.unknown_field_set);
-
-            ::google::protobuf::io::StringOutputStream unknown_fields_string(
-                MutableUnknownFields(msg, table.arena_offset));
-            ::google::protobuf::io::CodedOutputStream unknown_fields_stream(
-                &unknown_fields_string, false);
-            unknown_fields_stream.WriteVarint32(tag);
-            unknown_fields_stream.WriteVarint32(value);
-          }
-
-          break;
-        }
-        case WireFormatLite::TYPE_GROUP: {
-          MessageLite** submsg_holder =
-              MutableField<MessageLite*>(msg, has_bits, has_bit_index, offset);
-          MessageLite* submsg = *submsg_holder;
-
-          if (submsg == NULL) {
-            GOOGLE_DCHECK(!table.unknown_field_set);
-            Arena* const arena = GetArena(msg, table.arena_offset);
-            const MessageLite* prototype =
-                table.aux[field_number].messages.default_message();
-            submsg = prototype->New(arena);
-            *submsg_holder = submsg;
-          }
-
-          const ParseTable* ptable =
-              table.aux[field_number].messages.parse_table;
-
-          if (ptable) {
-            if (GOOGLE_PREDICT_FALSE(
-                    !ReadGroup(field_number, input, submsg, *ptable))) {
-              return false;
-            }
-          } else if (!WireFormatLite::ReadGroup(field_number, input, submsg)) {
-            return false;
-          }
-
-          break;
-        }
-        case WireFormatLite::TYPE_GROUP | kRepeatedMask: {
-          RepeatedPtrFieldBase* field = Raw<RepeatedPtrFieldBase>(msg, offset);
-          const MessageLite* prototype =
-              table.aux[field_number].messages.default_message();
-          GOOGLE_DCHECK(prototype != NULL);
-
-          MessageLite* submsg =
-              MergePartialFromCodedStreamHelper::Add(field, prototype);
-          const ParseTable* ptable =
-              table.aux[field_number].messages.parse_table;
-
-          if (ptable) {
-            if (GOOGLE_PREDICT_FALSE(
-                    !ReadGroup(field_number, input, submsg, *ptable))) {
-              return false;
-            }
-          } else if (!WireFormatLite::ReadGroup(field_number, input, submsg)) {
-            return false;
-          }
-
-          break;
-        }
-        case WireFormatLite::TYPE_MESSAGE: {
-          MessageLite** submsg_holder =
-              MutableField<MessageLite*>(msg, has_bits, has_bit_index, offset);
-          MessageLite* submsg = *submsg_holder;
-
-          if (submsg == NULL) {
-            GOOGLE_DCHECK(!table.unknown_field_set);
-            Arena* const arena = GetArena(msg, table.arena_offset);
-            const MessageLite* prototype =
-                table.aux[field_number].messages.default_message();
-            submsg = prototype->New(arena);
-            *submsg_holder = submsg;
-          }
-
-          const ParseTable* ptable =
-              table.aux[field_number].messages.parse_table;
-
-          if (ptable) {
-            if (GOOGLE_PREDICT_FALSE(!ReadMessage(input, submsg, *ptable))) {
-              return false;
-            }
-          } else if (!WireFormatLite::ReadMessage(input, submsg)) {
-            return false;
-          }
-
-          break;
-        }
-        // TODO(ckennelly):  Adapt ReadMessageNoVirtualNoRecursionDepth and
-        // manage input->IncrementRecursionDepth() here.
-        case WireFormatLite::TYPE_MESSAGE | kRepeatedMask: {
-          RepeatedPtrFieldBase* field = Raw<RepeatedPtrFieldBase>(msg, offset);
-          const MessageLite* prototype =
-              table.aux[field_number].messages.default_message();
-          GOOGLE_DCHECK(prototype != NULL);
-
-          MessageLite* submsg =
-              MergePartialFromCodedStreamHelper::Add(field, prototype);
-          const ParseTable* ptable =
-              table.aux[field_number].messages.parse_table;
-
-          if (ptable) {
-            if (GOOGLE_PREDICT_FALSE(!ReadMessage(input, submsg, *ptable))) {
-              return false;
-            }
-          } else if (!WireFormatLite::ReadMessage(input, submsg)) {
-            return false;
-          }
-
-          break;
+        break;
+      }
+      case WireFormatLite::TYPE_GROUP:
+        SerializeGroup(*Raw<const MessageLite*>(msg, field.offset), field,
+                       output);
+        break;
+      case WireFormatLite::TYPE_GROUP | kRepeatedMask: {
+        const RepeatedPtrField<MessageLite>& values =
+            *Raw<RepeatedPtrField<MessageLite> >(msg, field.offset);
+        for (int j = 0; j < values.size(); j++) {
+          SerializeGroup(&values.Get(j), field, output);
         }
-        case 0: {
-          // Done.
-          return true;
+        break;
+      }
+      case WireFormatLite::TYPE_MESSAGE:
+        SerializeMessage(*Raw<const MessageLite*>(msg, field.offset), field,
+                         output);
+        break;
+      case WireFormatLite::TYPE_MESSAGE | kRepeatedMask: {
+        const RepeatedPtrField<MessageLite>& values =
+            *Raw<RepeatedPtrField<MessageLite> >(msg, field.offset);
+        for (int j = 0; j < values.size(); j++) {
+          SerializeMessage(&values.Get(j), field, output);
         }
-        default:
-          break;
+        break;
       }
-    } else if (data->packed_wiretype == static_cast<unsigned char>(wire_type)) {
-      // Non-packable fields have their packed_wiretype masked with
-      // kNotPackedMask, which is impossible to match here.
-      GOOGLE_DCHECK(processing_type & kRepeatedMask);
-      GOOGLE_DCHECK_NE(processing_type, kRepeatedMask);
+      default:
+        GOOGLE_LOG(DFATAL) << "Unexpected processing type "
+                    << static_cast<int>(processing_type);
+        break;
+    }
+  }
+
+  WriteRawTo(Raw<InternalMetadataWithArenaLite>(msg, table.arena_offset)
+                 ->unknown_fields(),
+             output);
+}
+
+inline size_t MessageByteSize(const MessageLite* msg,
+                              const SerializationTable* table) {
+  if (table == NULL) {
+    return msg->ByteSizeLong();
+  }
 
+  return TableByteSize(msg, *table);
+}
 
+template <int type>
+inline size_t SingularByteSize(const MessageLite* msg,
+                               const SerializationTableField& field) {
+  typedef typename PrimitiveTypeHelper<type>::Type Type;
+  return field.tag_size +
+         PrimitiveTypeHelper<type>::Size(*Raw<Type>(msg, field.offset));
+}
+
+template <int type>
+inline size_t RepeatedByteSize(const MessageLite* msg,
+                               const SerializationTableField& field) {
+  typedef typename PrimitiveTypeHelper<type>::Type Type;
+  const RepeatedField<Type>& values =
+      *Raw<RepeatedField<Type> >(msg, field.offset);
+  return field.tag_size * FromIntSize(values.size()) +
+         PrimitiveTypeHelper<type>::Size(values);
+}
 
-      // TODO(ckennelly): Use a computed goto on GCC/LLVM.
-      //
-      // Mask out kRepeatedMask bit, allowing the jump table to be smaller.
-      switch (static_cast<WireFormatLite::FieldType>(
-          processing_type ^ kRepeatedMask)) {
-#define HANDLE_PACKED_TYPE(TYPE, CPPTYPE, CPPTYPE_METHOD)                 \
-  case WireFormatLite::TYPE_##TYPE: {                                     \
-    google::protobuf::RepeatedField<CPPTYPE>* values =                              \
-        Raw<google::protobuf::RepeatedField<CPPTYPE> >(msg, offset);                \
-    if (GOOGLE_PREDICT_FALSE(                                                    \
-            (!WireFormatLite::ReadPackedPrimitive<                        \
-                CPPTYPE, WireFormatLite::TYPE_##TYPE>(input, values)))) { \
-      return false;                                                       \
-    }                                                                     \
-    break;                                                                \
+template <int type>
+inline size_t PackedByteSize(const MessageLite* msg,
+                             const SerializationTableField& field) {
+  typedef typename PrimitiveTypeHelper<type>::Type Type;
+  const RepeatedField<Type>& values =
+      *Raw<RepeatedField<Type> >(msg, field.offset);
+  const size_t data_size = PrimitiveTypeHelper<type>::Size(values);
+
+  // The serializer writes the length of the packed data from this cached copy.
+  int cached_size = ToCachedSize(data_size);
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  *Raw<int>(const_cast<MessageLite*>(msg), field.has_offset) = cached_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+
+  if (data_size == 0) {
+    return 0;
   }
+  return field.tag_size + WireFormatLite::Int32Size(cached_size) + data_size;
+}
 
-        HANDLE_PACKED_TYPE(INT32, int32, Int32)
-        HANDLE_PACKED_TYPE(INT64, int64, Int64)
-        HANDLE_PACKED_TYPE(SINT32, int32, Int32)
-        HANDLE_PACKED_TYPE(SINT64, int64, Int64)
-        HANDLE_PACKED_TYPE(UINT32, uint32, UInt32)
-        HANDLE_PACKED_TYPE(UINT64, uint64, UInt64)
-
-        HANDLE_PACKED_TYPE(FIXED32, uint32, UInt32)
-        HANDLE_PACKED_TYPE(FIXED64, uint64, UInt64)
-        HANDLE_PACKED_TYPE(SFIXED32, int32, Int32)
-        HANDLE_PACKED_TYPE(SFIXED64, int64, Int64)
-
-        HANDLE_PACKED_TYPE(FLOAT, float, Float)
-        HANDLE_PACKED_TYPE(DOUBLE, double, Double)
-
-        HANDLE_PACKED_TYPE(BOOL, bool, Bool)
-#undef HANDLE_PACKED_TYPE
-        case WireFormatLite::TYPE_ENUM: {
-          // To avoid unnecessarily calling MutableUnknownFields (which mutates
-          // InternalMetadataWithArena) when all inputs in the repeated series
-          // are valid, we implement our own parser rather than call
-          // WireFormat::ReadPackedEnumPreserveUnknowns.
-          uint32 length;
-          if (GOOGLE_PREDICT_FALSE(!input->ReadVarint32(&length))) {
-            return false;
-          }
-
-          AuxillaryParseTableField::EnumValidator validator =
-              table.aux[field_number].enums.validator;
-          google::protobuf::RepeatedField<int>* values =
-              Raw<google::protobuf::RepeatedField<int> >(msg, offset);
-          string* unknown_fields = NULL;
-
-          io::CodedInputStream::Limit limit = input->PushLimit(length);
-          while (input->BytesUntilLimit() > 0) {
-            int value;
-            if (GOOGLE_PREDICT_FALSE(
-                    (!google::protobuf::internal::WireFormatLite::ReadPrimitive<
-                        int, WireFormatLite::TYPE_ENUM>(input, &value)))) {
-              return false;
-            }
-
-            if (validator(value)) {
-              values->Add(value);
-            } else {
-              if (GOOGLE_PREDICT_FALSE(unknown_fields == NULL)) {
-                GOOGLE_DCHECK(!table.unknown_field_set);
-                unknown_fields = MutableUnknownFields(msg, table.arena_offset);
-              }
-
-              ::google::protobuf::io::StringOutputStream unknown_fields_string(
-                  unknown_fields);
-              ::google::protobuf::io::CodedOutputStream unknown_fields_stream(
-                  &unknown_fields_string, false);
-              unknown_fields_stream.WriteVarint32(tag);
-              unknown_fields_stream.WriteVarint32(value);
-            }
-          }
-          input->PopLimit(limit);
-
-          break;
-        }
-        case WireFormatLite::TYPE_STRING:
-        case WireFormatLite::TYPE_GROUP:
-        case WireFormatLite::TYPE_MESSAGE:
-        case WireFormatLite::TYPE_BYTES:
-          GOOGLE_DCHECK(false);
-          return false;
-        default:
-          break;
+size_t FieldByteSize(const MessageLite* msg,
+                     const SerializationTableField& field) {
+  switch (field.processing_type) {
+#define HANDLE_TYPE(TYPE)                                                  \
+  case WireFormatLite::TYPE_##TYPE:                                        \
+    return SingularByteSize<WireFormatLite::TYPE_##TYPE>(msg, field);      \
+  case WireFormatLite::TYPE_##TYPE | kRepeatedMask:                        \
+    return RepeatedByteSize<WireFormatLite::TYPE_##TYPE>(msg, field);      \
+  case WireFormatLite::TYPE_##TYPE | kRepeatedMask | kPackedMask:          \
+    return PackedByteSize<WireFormatLite::TYPE_##TYPE>(msg, field);
+
+    HANDLE_TYPE(INT32)
+    HANDLE_TYPE(INT64)
+    HANDLE_TYPE(SINT32)
+    HANDLE_TYPE(SINT64)
+    HANDLE_TYPE(UINT32)
+    HANDLE_TYPE(UINT64)
+
+    HANDLE_TYPE(FIXED32)
+    HANDLE_TYPE(FIXED64)
+    HANDLE_TYPE(SFIXED32)
+    HANDLE_TYPE(SFIXED64)
+
+    HANDLE_TYPE(FLOAT)
+    HANDLE_TYPE(DOUBLE)
+
+    HANDLE_TYPE(BOOL)
+    HANDLE_TYPE(ENUM)
+#undef HANDLE_TYPE
+    case WireFormatLite::TYPE_STRING:
+    case WireFormatLite::TYPE_BYTES:
+      return field.tag_size + WireFormatLite::StringSize(
+          Raw<ArenaStringPtr>(msg, field.offset)->Get());
+    case WireFormatLite::TYPE_STRING | kRepeatedMask:
+    case WireFormatLite::TYPE_BYTES | kRepeatedMask: {
+      const RepeatedPtrField<string>& values =
+          *Raw<RepeatedPtrField<string> >(msg, field.offset);
+      size_t size = field.tag_size * FromIntSize(values.size());
+      for (int i = 0; i < values.size(); i++) {
+        size += WireFormatLite::StringSize(values.Get(i));
       }
-    } else {
-      if (wire_type == WireFormatLite::WIRETYPE_END_GROUP) {
-        // Must be the end of the message.
-        return true;
+      return size;
+    }
+    case WireFormatLite::TYPE_GROUP:
+      return field.tag_size +
+             MessageByteSize(*Raw<const MessageLite*>(msg, field.offset),
+                             field.table);
+    case WireFormatLite::TYPE_GROUP | kRepeatedMask: {
+      const RepeatedPtrField<MessageLite>& values =
+          *Raw<RepeatedPtrField<MessageLite> >(msg, field.offset);
+      size_t size = field.tag_size * FromIntSize(values.size());
+      for (int i = 0; i < values.size(); i++) {
+        size += MessageByteSize(&values.Get(i), field.table);
+      }
+      return size;
+    }
+    case WireFormatLite::TYPE_MESSAGE:
+      return field.tag_size +
+             WireFormatLite::LengthDelimitedSize(MessageByteSize(
+                 *Raw<const MessageLite*>(msg, field.offset), field.table));
+    case WireFormatLite::TYPE_MESSAGE | kRepeatedMask: {
+      const RepeatedPtrField<MessageLite>& values =
+          *Raw<RepeatedPtrField<MessageLite> >(msg, field.offset);
+      size_t size = field.tag_size * FromIntSize(values.size());
+      for (int i = 0; i < values.size(); i++) {
+        size += WireFormatLite::LengthDelimitedSize(
+            MessageByteSize(&values.Get(i), field.table));
       }
+      return size;
+    }
+    default:
+      GOOGLE_LOG(DFATAL) << "Unexpected processing type "
+                  << static_cast<int>(field.processing_type);
+      return 0;
+  }
+}
 
-      // process unknown field.
-      GOOGLE_DCHECK(!table.unknown_field_set);
-      ::google::protobuf::io::StringOutputStream unknown_fields_string(
-          MutableUnknownFields(msg, table.arena_offset));
-      ::google::protobuf::io::CodedOutputStream unknown_fields_stream(
-          &unknown_fields_string, false);
+}  // namespace
 
-      if (!::google::protobuf::internal::WireFormatLite::SkipField(
-          input, tag, &unknown_fields_stream)) {
-        return false;
-      }
+size_t TableByteSize(const MessageLite* msg, const SerializationTable& table) {
+  const uint32* has_bits = Raw<uint32>(msg, table.has_bits_offset);
+  size_t total_size =
+      Raw<InternalMetadataWithArenaLite>(msg, table.arena_offset)
+          ->unknown_fields().size();
+
+  for (int i = 0; i < table.num_fields; i++) {
+    const SerializationTableField& field = table.fields[i];
+    if (!(field.processing_type & kRepeatedMask) &&
+        !HasBit(has_bits, field.has_offset)) {
+      continue;
     }
+
+    total_size += FieldByteSize(msg, field);
   }
+
+  int cached_size = ToCachedSize(total_size);
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  *Raw<int>(const_cast<MessageLite*>(msg), table.cached_size_offset) =
+      cached_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void TableSerialize(const MessageLite* msg, const SerializationTable& table,
+                    io::CodedOutputStream* output) {
+  const int size = *Raw<int>(msg, table.cached_size_offset);
+  uint8* target = output->GetDirectBufferForNBytesAndAdvance(size);
+  if (target != NULL) {
+    TableSerializeToArray(msg, table, output->IsSerializationDeterministic(),
+                          target);
+    return;
+  }
+
+  SerializeFields(msg, table, output);
+}
+
+uint8* TableSerializeToArray(const MessageLite* msg,
+                             const SerializationTable& table,
+                             bool deterministic, uint8* target) {
+  ArrayOutput output = {target, deterministic};
+  SerializeFields(msg, table, &output);
+  return output.ptr;
 }
 
 }  // namespace internal
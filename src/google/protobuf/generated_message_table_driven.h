@@ -60,6 +60,8 @@ static PROTOBUF_CONSTEXPR const unsigned char kRepeatedMask = 0x20;
 
 static PROTOBUF_CONSTEXPR const unsigned char kNotPackedMask = 0x10;
 static PROTOBUF_CONSTEXPR const unsigned char kInvalidMask = 0x20;
+// Marks packed fields in SerializationTableField::processing_type.
+static PROTOBUF_CONSTEXPR const unsigned char kPackedMask = 0x80;
 
 enum ProcessingTypes {
   TYPE_STRING_CORD = 19,
@@ -149,6 +151,40 @@ struct ParseTable {
   int  unknown_field_set;
 };
 
+struct SerializationTable;
+
+// SerializationTableField describes a field to the table-driven serializer.
+// Unlike the parse tables, which are indexed by field number, the fields of a
+// message are listed in field number order, which is the order in which they
+// are written.
+struct SerializationTableField {
+  uint32 offset;
+  // For singular fields, the index of the has-bit.  For packed fields, the
+  // offset of the cached byte size of the packed data.
+  uint32 has_offset;
+  // The complete tag, including the wire type.
+  uint32 tag;
+
+  // processing_type is given by:
+  //   FieldDescriptor->type() | kRepeatedMask | kPackedMask
+  unsigned char processing_type;
+
+  // For groups, this includes the size of the end tag.
+  unsigned char tag_size;
+
+  // For message and group fields, the table of the sub-message, or NULL if the
+  // sub-message is serialized through its virtual methods.
+  const SerializationTable* table;
+};
+
+struct SerializationTable {
+  const SerializationTableField* fields;
+  int num_fields;
+  int64 has_bits_offset;
+  int64 arena_offset;
+  int64 cached_size_offset;
+};
+
 // TODO(jhen): Remove the __NVCC__ check when we get a version of nvcc that
 // supports these checks.
 #if LANG_CXX11 && !defined(__NVCC__)
@@ -161,11 +197,24 @@ static_assert(std::is_pod<AuxillaryParseTableField::enum_aux>::value, "");
 static_assert(std::is_pod<AuxillaryParseTableField::message_aux>::value, "");
 static_assert(std::is_pod<AuxillaryParseTableField::string_aux>::value, "");
 static_assert(std::is_pod<ParseTable>::value, "");
+static_assert(std::is_pod<SerializationTableField>::value, "");
+static_assert(std::is_pod<SerializationTable>::value, "");
 #endif
 
 bool MergePartialFromCodedStream(MessageLite* msg, const ParseTable& table,
                                  io::CodedInputStream* input);
 
+// Shared implementations of ByteSizeLong(), SerializeWithCachedSizes() and
+// InternalSerializeWithCachedSizesToArray() for messages generated with the
+// table_driven_serialization option.  As with the generated methods,
+// TableByteSize() updates the cached sizes the serializers rely on.
+size_t TableByteSize(const MessageLite* msg, const SerializationTable& table);
+void TableSerialize(const MessageLite* msg, const SerializationTable& table,
+                    io::CodedOutputStream* output);
+uint8* TableSerializeToArray(const MessageLite* msg,
+                             const SerializationTable& table,
+                             bool deterministic, uint8* target);
+
 }  // namespace internal
 }  // namespace protobuf
 
@@ -88,6 +88,15 @@ void CodedOutputStream::EnableAliasing(bool enabled) {
 
 void CodedInputStream::BackUpInputToCurrentPosition() {
   int backup_bytes = BufferSize() + buffer_size_after_limit_ + overflow_bytes_;
+  if (pending_ != NULL) {
+    // We are reading from the patch buffer.  Only the bytes of the last buffer
+    // returned by input_ can be backed up over, the earlier ones are lost.
+    const uint8* chunk_start = std::max(buffer_, patch_chunk_start_);
+    backup_bytes =
+        static_cast<int>(buffer_end_ + buffer_size_after_limit_ - chunk_start) +
+        static_cast<int>(pending_end_ - pending_);
+    pending_ = pending_end_ = NULL;
+  }
   if (backup_bytes > 0) {
     input_->BackUp(backup_bytes);
 
@@ -214,6 +223,12 @@ bool CodedInputStream::Skip(int count) {
     return false;
   }
 
+  if (pending_ != NULL) {
+    // Move on to the rest of the buffer the patch buffer was filled from.
+    Advance(original_buffer_size);
+    return Refresh() && Skip(count - original_buffer_size);
+  }
+
   count -= original_buffer_size;
   buffer_ = NULL;
   buffer_end_ = buffer_;
@@ -288,6 +303,11 @@ bool CodedInputStream::ReadStringFallback(string* buffer, int size) {
 bool CodedInputStream::ReadLittleEndian32Fallback(uint32* value) {
   uint8 bytes[sizeof(*value)];
 
+  if (patch_buffer_enabled_ && BufferSize() > 0 &&
+      BufferSize() < sizeof(*value)) {
+    FillPatchBuffer();
+  }
+
   const uint8* ptr;
   if (BufferSize() >= sizeof(*value)) {
     // Fast path:  Enough bytes in the buffer to read directly.
@@ -305,6 +325,11 @@ bool CodedInputStream::ReadLittleEndian32Fallback(uint32* value) {
 bool CodedInputStream::ReadLittleEndian64Fallback(uint64* value) {
   uint8 bytes[sizeof(*value)];
 
+  if (patch_buffer_enabled_ && BufferSize() > 0 &&
+      BufferSize() < sizeof(*value)) {
+    FillPatchBuffer();
+  }
+
   const uint8* ptr;
   if (BufferSize() >= sizeof(*value)) {
     // Fast path:  Enough bytes in the buffer to read directly.
@@ -362,6 +387,9 @@ inline ::std::pair<bool, const uint8*> ReadVarint32FromArray(
   return std::make_pair(true, ptr);
 }
 
+// Unlike CodedInputStream::InternalReadVarint64FromArray(), this never reads
+// past the last byte of the varint, so it is safe to use on any buffer that
+// ends with a byte terminating a varint.
 GOOGLE_ATTRIBUTE_ALWAYS_INLINE::std::pair<bool, const uint8*> ReadVarint64FromArray(
     const uint8* buffer, uint64* value);
 inline ::std::pair<bool, const uint8*> ReadVarint64FromArray(
@@ -407,6 +435,13 @@ inline ::std::pair<bool, const uint8*> ReadVarint64FromArray(
 
 }  // namespace
 
+inline void CodedInputStream::EnsureVarintContiguous() {
+  if (patch_buffer_enabled_ && BufferSize() < kMaxVarintBytes &&
+      buffer_end_ > buffer_ && (buffer_end_[-1] & 0x80)) {
+    FillPatchBuffer();
+  }
+}
+
 bool CodedInputStream::ReadVarint32Slow(uint32* value) {
   // Directly invoke ReadVarint64Fallback, since we already tried to optimize
   // for one-byte varints.
@@ -416,6 +451,7 @@ bool CodedInputStream::ReadVarint32Slow(uint32* value) {
 }
 
 int64 CodedInputStream::ReadVarint32Fallback(uint32 first_byte_or_zero) {
+  EnsureVarintContiguous();
   if (BufferSize() >= kMaxVarintBytes ||
       // Optimization:  We're also safe if the buffer is non-empty and it ends
       // with a byte that would terminate a varint.
@@ -446,10 +482,16 @@ int CodedInputStream::ReadVarintSizeAsIntSlow() {
 }
 
 int CodedInputStream::ReadVarintSizeAsIntFallback() {
-  if (BufferSize() >= kMaxVarintBytes ||
-      // Optimization:  We're also safe if the buffer is non-empty and it ends
-      // with a byte that would terminate a varint.
-      (buffer_end_ > buffer_ && !(buffer_end_[-1] & 0x80))) {
+  EnsureVarintContiguous();
+  if (BufferSize() >= kMaxVarintBytes) {
+    uint64 temp;
+    const uint8* end = InternalReadVarint64FromArray(buffer_, &temp);
+    if (end == NULL || temp > static_cast<uint64>(INT_MAX)) return -1;
+    buffer_ = end;
+    return temp;
+  } else if (buffer_end_ > buffer_ && !(buffer_end_[-1] & 0x80)) {
+    // We're also safe if the buffer is non-empty and it ends with a byte that
+    // would terminate a varint, as long as we stop at that byte.
     uint64 temp;
     ::std::pair<bool, const uint8*> p = ReadVarint64FromArray(buffer_, &temp);
     if (!p.first || temp > static_cast<uint64>(INT_MAX)) return -1;
@@ -490,6 +532,7 @@ uint32 CodedInputStream::ReadTagSlow() {
 }
 
 uint32 CodedInputStream::ReadTagFallback(uint32 first_byte_or_zero) {
+  EnsureVarintContiguous();
   const int buf_size = BufferSize();
   if (buf_size >= kMaxVarintBytes ||
       // Optimization:  We're also safe if the buffer is non-empty and it ends
@@ -556,10 +599,18 @@ bool CodedInputStream::ReadVarint64Slow(uint64* value) {
 }
 
 std::pair<uint64, bool> CodedInputStream::ReadVarint64Fallback() {
-  if (BufferSize() >= kMaxVarintBytes ||
-      // Optimization:  We're also safe if the buffer is non-empty and it ends
-      // with a byte that would terminate a varint.
-      (buffer_end_ > buffer_ && !(buffer_end_[-1] & 0x80))) {
+  EnsureVarintContiguous();
+  if (BufferSize() >= kMaxVarintBytes) {
+    uint64 temp;
+    const uint8* end = InternalReadVarint64FromArray(buffer_, &temp);
+    if (end == NULL) {
+      return std::make_pair(0, false);
+    }
+    buffer_ = end;
+    return std::make_pair(temp, true);
+  } else if (buffer_end_ > buffer_ && !(buffer_end_[-1] & 0x80)) {
+    // We're also safe if the buffer is non-empty and it ends with a byte that
+    // would terminate a varint, as long as we stop at that byte.
     uint64 temp;
     ::std::pair<bool, const uint8*> p = ReadVarint64FromArray(buffer_, &temp);
     if (!p.first) {
@@ -593,7 +644,7 @@ bool CodedInputStream::Refresh() {
 
   const void* void_buffer;
   int buffer_size;
-  if (NextNonEmpty(input_, &void_buffer, &buffer_size)) {
+  if (NextBuffer(&void_buffer, &buffer_size)) {
     buffer_ = reinterpret_cast<const uint8*>(void_buffer);
     buffer_end_ = buffer_ + buffer_size;
     GOOGLE_CHECK_GE(buffer_size, 0);
@@ -625,6 +676,64 @@ bool CodedInputStream::Refresh() {
   }
 }
 
+bool CodedInputStream::NextBuffer(const void** data, int* size) {
+  if (pending_ != NULL) {
+    *data = pending_;
+    *size = static_cast<int>(pending_end_ - pending_);
+    pending_ = pending_end_ = NULL;
+    if (*size > 0) return true;
+  }
+  return NextNonEmpty(input_, data, size);
+}
+
+bool CodedInputStream::FillPatchBuffer() {
+  GOOGLE_DCHECK(patch_buffer_enabled_);
+  const int buffer_size = BufferSize();
+  GOOGLE_DCHECK_GT(buffer_size, 0);
+  GOOGLE_DCHECK_LT(buffer_size, kPatchBufferSize / 2);
+
+  if (buffer_size_after_limit_ > 0 || overflow_bytes_ > 0 ||
+      total_bytes_read_ >= std::min(current_limit_, total_bytes_limit_) ||
+      total_bytes_read_ > INT_MAX - kPatchBufferSize) {
+    // The current buffer ends at a limit, so appending to it is pointless.
+    return false;
+  }
+
+  // Move the unread bytes first: once we call input_->Next(), the current
+  // buffer may no longer be valid.
+  const uint8* chunk_start = patch_buffer_;
+  if (pending_ != NULL && patch_chunk_start_ > buffer_) {
+    chunk_start += patch_chunk_start_ - buffer_;
+  }
+  memmove(patch_buffer_, buffer_, buffer_size);
+  buffer_ = patch_buffer_;
+  buffer_end_ = patch_buffer_ + buffer_size;
+
+  if (pending_ == NULL || pending_ == pending_end_) {
+    const void* void_buffer;
+    int size;
+    if (!NextNonEmpty(input_, &void_buffer, &size)) {
+      // EOF.  The unread bytes stay in the patch buffer, and none of them can
+      // be backed up over.
+      pending_ = pending_end_ = patch_chunk_start_ = buffer_end_;
+      return false;
+    }
+    pending_ = reinterpret_cast<const uint8*>(void_buffer);
+    pending_end_ = pending_ + size;
+    chunk_start = buffer_end_;
+  }
+  patch_chunk_start_ = chunk_start;
+
+  const int count = std::min(kPatchBufferSize - buffer_size,
+                             static_cast<int>(pending_end_ - pending_));
+  memcpy(patch_buffer_ + buffer_size, pending_, count);
+  pending_ += count;
+  buffer_end_ += count;
+  total_bytes_read_ += count;
+  RecomputeBufferLimits();
+  return true;
+}
+
 // CodedOutputStream =================================================
 
 google::protobuf::internal::AtomicWord CodedOutputStream::default_serialization_deterministic_ = 0;
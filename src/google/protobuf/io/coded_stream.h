@@ -182,6 +182,20 @@ class LIBPROTOBUF_EXPORT CodedInputStream {
   // a ZeroCopyInputStream.
   inline bool IsFlat() const;
 
+  // Enables or disables patch buffering, which is off by default.  When it is
+  // on and a varint or fixed-width value may straddle the end of the current
+  // buffer, the unread bytes of that buffer are copied into a small patch
+  // buffer along with the first bytes of the next one, so that the value is
+  // decoded from contiguous memory rather than byte by byte across buffers.
+  //
+  // The underlying ZeroCopyInputStream can only be backed up into the last
+  // buffer it returned.  If the CodedInputStream is destroyed while bytes
+  // copied from an earlier buffer are still unread, the stream is left
+  // positioned past them.  Hence this should only be enabled when the input
+  // is read up to EOF or up to a limit, as when parsing a whole message from
+  // a ZeroCopyInputStream.  Has no effect when reading from a flat array.
+  void EnablePatchBuffer(bool enabled);
+
   // Skips a number of bytes.  Returns false if an underlying read error
   // occurs.
   bool Skip(int count);
@@ -234,6 +248,12 @@ class LIBPROTOBUF_EXPORT CodedInputStream {
   // Read a 64-bit little-endian integer.
   static const uint8* ReadLittleEndian64FromArray(const uint8* buffer,
                                                    uint64* value);
+  // Read an unsigned integer with Varint encoding and return a pointer past
+  // it, or NULL if it is longer than the 10 bytes a varint may take.  At
+  // least 10 bytes must be readable at |buffer|, however short the varint.
+  // This should only be used by the protobuf implementation.
+  GOOGLE_ATTRIBUTE_ALWAYS_INLINE static const uint8* InternalReadVarint64FromArray(
+      const uint8* buffer, uint64* value);
 
   // Read an unsigned integer with Varint encoding, truncating to 32 bits.
   // Reading a 32-bit value is equivalent to reading a 64-bit one and casting
@@ -582,6 +602,18 @@ class LIBPROTOBUF_EXPORT CodedInputStream {
   const DescriptorPool* extension_pool_;
   MessageFactory* extension_factory_;
 
+  // See EnablePatchBuffer().  While buffer_ points into patch_buffer_,
+  // [pending_, pending_end_) is the unread rest of the last buffer returned
+  // by input_, which Refresh() moves on to once the patch buffer is used up.
+  // Bytes in it are not counted in total_bytes_read_ yet.  The bytes of that
+  // last buffer start at patch_chunk_start_ in patch_buffer_.
+  static const int kPatchBufferSize = 32;
+  bool patch_buffer_enabled_;
+  const uint8* pending_;
+  const uint8* pending_end_;
+  const uint8* patch_chunk_start_;
+  uint8 patch_buffer_[kPatchBufferSize];
+
   // Private member functions.
 
   // Advance the buffer by a given number of bytes.
@@ -601,6 +633,21 @@ class LIBPROTOBUF_EXPORT CodedInputStream {
   // Advance(BufferSize()).
   bool Refresh();
 
+  // Gets the next buffer to read from: the rest of the buffer the patch
+  // buffer was filled from, if any, or else the next non-empty buffer from
+  // input_.
+  bool NextBuffer(const void** data, int* size);
+
+  // Moves the unread bytes of the current buffer into patch_buffer_ and
+  // appends as many bytes of the next buffer as fit, without crossing a
+  // limit.  Returns false if no bytes could be appended.  Only called with
+  // patch buffering enabled and a non-empty buffer smaller than
+  // kPatchBufferSize / 2.
+  bool FillPatchBuffer();
+  // Calls FillPatchBuffer() if patch buffering is enabled and a varint
+  // starting at buffer_ may cross the end of the current buffer.
+  void EnsureVarintContiguous();
+
   // When parsing varints, we optimize for the common case of small values, and
   // then optimize for the case when the varint fits within the current buffer
   // piece. The Fallback method is used when we can't use the one-byte
@@ -1400,7 +1447,11 @@ inline CodedInputStream::CodedInputStream(ZeroCopyInputStream* input)
     recursion_limit_(default_recursion_limit_),
     disable_strict_correctness_enforcement_(true),
     extension_pool_(NULL),
-    extension_factory_(NULL) {
+    extension_factory_(NULL),
+    patch_buffer_enabled_(false),
+    pending_(NULL),
+    pending_end_(NULL),
+    patch_chunk_start_(NULL) {
   // Eagerly Refresh() so buffer space is immediately available.
   Refresh();
 }
@@ -1421,7 +1472,11 @@ inline CodedInputStream::CodedInputStream(const uint8* buffer, int size)
     recursion_limit_(default_recursion_limit_),
     disable_strict_correctness_enforcement_(true),
     extension_pool_(NULL),
-    extension_factory_(NULL) {
+    extension_factory_(NULL),
+    patch_buffer_enabled_(false),
+    pending_(NULL),
+    pending_end_(NULL),
+    patch_chunk_start_(NULL) {
   // Note that setting current_limit_ == size is important to prevent some
   // code paths from trying to access input_ and segfaulting.
 }
@@ -1430,6 +1485,10 @@ inline bool CodedInputStream::IsFlat() const {
   return input_ == NULL;
 }
 
+inline void CodedInputStream::EnablePatchBuffer(bool enabled) {
+  patch_buffer_enabled_ = enabled && input_ != NULL;
+}
+
 }  // namespace io
 }  // namespace protobuf
 
@@ -43,6 +43,12 @@
 #include <string>
 #include <google/protobuf/stubs/stl_util.h>
 
+#if defined(__BMI2__) && defined(__x86_64__) && \
+    defined(PROTOBUF_LITTLE_ENDIAN)
+#include <immintrin.h>
+#define GOOGLE_PROTOBUF_USE_PEXT_VARINTS
+#endif
+
 namespace google {
 namespace protobuf {
 namespace io {
@@ -84,6 +90,86 @@ inline bool CodedInputStream::InternalReadRawInline(void* buffer, int size) {
   return true;
 }
 
+#ifdef GOOGLE_PROTOBUF_USE_PEXT_VARINTS
+// Loads the first eight bytes at once and finds the end of the varint from
+// their continuation bits; pext then gathers the 7-bit payloads of all of its
+// bytes in a single instruction.
+inline const uint8* CodedInputStream::InternalReadVarint64FromArray(
+    const uint8* buffer, uint64* value) {
+  static const uint64 kPayloadBits = GOOGLE_ULONGLONG(0x7f7f7f7f7f7f7f7f);
+  uint64 word;
+  memcpy(&word, buffer, sizeof(word));
+  // The high bit of each byte that does not have its continuation bit set.
+  const uint64 stops = ~word & GOOGLE_ULONGLONG(0x8080808080808080);
+  if (GOOGLE_PREDICT_TRUE(stops != 0)) {
+    // Number of bits in the bytes of the varint, a multiple of 8 up to 64.
+    const int bits = __builtin_ctzll(stops) + 1;
+    if (bits < 64) word &= (GOOGLE_ULONGLONG(1) << bits) - 1;
+    *value = _pext_u64(word, kPayloadBits);
+    return buffer + bits / 8;
+  }
+
+  // Nine or ten bytes.
+  uint64 result = _pext_u64(word, kPayloadBits);
+  uint32 b = buffer[8];
+  result |= static_cast<uint64>(b & 0x7F) << 56;
+  if (!(b & 0x80)) {
+    *value = result;
+    return buffer + 9;
+  }
+  b = buffer[9];
+  result |= static_cast<uint64>(b) << 63;
+  if (!(b & 0x80)) {
+    *value = result;
+    return buffer + 10;
+  }
+  // We have overrun the maximum size of a varint (10 bytes).  Assume
+  // the data is corrupt.
+  return NULL;
+}
+#else   // GOOGLE_PROTOBUF_USE_PEXT_VARINTS
+inline const uint8* CodedInputStream::InternalReadVarint64FromArray(
+    const uint8* buffer, uint64* value) {
+  const uint8* ptr = buffer;
+  uint32 b;
+
+  // Splitting into 32-bit pieces gives better performance on 32-bit
+  // processors.
+  uint32 part0 = 0, part1 = 0, part2 = 0;
+
+  b = *(ptr++); part0  = b      ; if (!(b & 0x80)) goto done;
+  part0 -= 0x80;
+  b = *(ptr++); part0 += b <<  7; if (!(b & 0x80)) goto done;
+  part0 -= 0x80 << 7;
+  b = *(ptr++); part0 += b << 14; if (!(b & 0x80)) goto done;
+  part0 -= 0x80 << 14;
+  b = *(ptr++); part0 += b << 21; if (!(b & 0x80)) goto done;
+  part0 -= 0x80 << 21;
+  b = *(ptr++); part1  = b      ; if (!(b & 0x80)) goto done;
+  part1 -= 0x80;
+  b = *(ptr++); part1 += b <<  7; if (!(b & 0x80)) goto done;
+  part1 -= 0x80 << 7;
+  b = *(ptr++); part1 += b << 14; if (!(b & 0x80)) goto done;
+  part1 -= 0x80 << 14;
+  b = *(ptr++); part1 += b << 21; if (!(b & 0x80)) goto done;
+  part1 -= 0x80 << 21;
+  b = *(ptr++); part2  = b      ; if (!(b & 0x80)) goto done;
+  part2 -= 0x80;
+  b = *(ptr++); part2 += b <<  7; if (!(b & 0x80)) goto done;
+  // "part2 -= 0x80 << 7" is irrelevant because (0x80 << 7) << 56 is 0.
+
+  // We have overrun the maximum size of a varint (10 bytes).  Assume
+  // the data is corrupt.
+  return NULL;
+
+ done:
+  *value = (static_cast<uint64>(part0)) |
+           (static_cast<uint64>(part1) << 28) |
+           (static_cast<uint64>(part2) << 56);
+  return ptr;
+}
+#endif  // !GOOGLE_PROTOBUF_USE_PEXT_VARINTS
+
 }  // namespace io
 }  // namespace protobuf
 }  // namespace google
@@ -223,6 +223,44 @@ TEST_2D(CodedStreamTest, ReadTag, kVarintCases, kBlockSizes) {
   EXPECT_EQ(kVarintCases_case.size, input.ByteCount());
 }
 
+TEST_2D(CodedStreamTest, ReadVarintWithPatchBuffer, kVarintCases, kBlockSizes) {
+  // Enough copies of the varint that many of them straddle two blocks.
+  const int kCount = 20;
+  const int size = kVarintCases_case.size;
+  for (int i = 0; i < kCount; i++) {
+    memcpy(buffer_ + i * size, kVarintCases_case.bytes, size);
+  }
+  ArrayInputStream input(buffer_, sizeof(buffer_), kBlockSizes_case);
+
+  {
+    CodedInputStream coded_input(&input);
+    coded_input.EnablePatchBuffer(true);
+    coded_input.PushLimit(kCount * size);
+
+    for (int i = 0; i < kCount; i++) {
+      uint32 value32;
+      uint64 value64;
+      switch (i % 3) {
+        case 0:
+          EXPECT_TRUE(coded_input.ReadVarint32(&value32));
+          EXPECT_EQ(static_cast<uint32>(kVarintCases_case.value), value32);
+          break;
+        case 1:
+          EXPECT_TRUE(coded_input.ReadVarint64(&value64));
+          EXPECT_EQ(kVarintCases_case.value, value64);
+          break;
+        case 2:
+          EXPECT_EQ(static_cast<uint32>(kVarintCases_case.value),
+                    coded_input.ReadTag());
+          break;
+      }
+    }
+    EXPECT_EQ(0, coded_input.BytesUntilLimit());
+  }
+
+  EXPECT_EQ(kCount * size, input.ByteCount());
+}
+
 // This is the regression test that verifies that there is no issues
 // with the empty input buffers handling.
 TEST_F(CodedStreamTest, EmptyInputBeforeEos) {
@@ -609,6 +647,40 @@ TEST_2D(CodedStreamTest, ReadLittleEndian64, kFixed64Cases, kBlockSizes) {
   EXPECT_EQ(sizeof(uint64), input.ByteCount());
 }
 
+TEST_2D(CodedStreamTest, ReadLittleEndianWithPatchBuffer,
+        kFixed64Cases, kBlockSizes) {
+  const int kCount = 20;
+  for (int i = 0; i < kCount; i++) {
+    memcpy(buffer_ + i * sizeof(uint64), kFixed64Cases_case.bytes,
+           sizeof(uint64));
+  }
+  ArrayInputStream input(buffer_, sizeof(buffer_), kBlockSizes_case);
+
+  {
+    CodedInputStream coded_input(&input);
+    coded_input.EnablePatchBuffer(true);
+    coded_input.PushLimit(kCount * sizeof(uint64));
+
+    for (int i = 0; i < kCount; i++) {
+      if (i % 2 == 0) {
+        uint64 value;
+        EXPECT_TRUE(coded_input.ReadLittleEndian64(&value));
+        EXPECT_EQ(kFixed64Cases_case.value, value);
+      } else {
+        uint32 low, high;
+        EXPECT_TRUE(coded_input.ReadLittleEndian32(&low));
+        EXPECT_TRUE(coded_input.ReadLittleEndian32(&high));
+        EXPECT_EQ(kFixed64Cases_case.value,
+                  (static_cast<uint64>(high) << 32) | low);
+      }
+    }
+    uint32 value;
+    EXPECT_FALSE(coded_input.ReadLittleEndian32(&value));
+  }
+
+  EXPECT_EQ(kCount * sizeof(uint64), input.ByteCount());
+}
+
 TEST_2D(CodedStreamTest, WriteLittleEndian32, kFixed32Cases, kBlockSizes) {
   ArrayOutputStream output(buffer_, sizeof(buffer_), kBlockSizes_case);
 
@@ -953,6 +1025,33 @@ TEST_1D(CodedStreamTest, SkipInput, kBlockSizes) {
   EXPECT_EQ(strlen(kSkipTestBytes), input.ByteCount());
 }
 
+TEST_1D(CodedStreamTest, SkipInputWithPatchBuffer, kBlockSizes) {
+  // Alternate two-byte varints with bytes to skip, so that both the reads and
+  // the skips start inside the patch buffer.
+  const int kCount = 20;
+  for (int i = 0; i < kCount; i++) {
+    buffer_[i * 5 + 0] = 0xa2;
+    buffer_[i * 5 + 1] = 0x74;
+  }
+  ArrayInputStream input(buffer_, sizeof(buffer_), kBlockSizes_case);
+
+  {
+    CodedInputStream coded_input(&input);
+    coded_input.EnablePatchBuffer(true);
+    coded_input.PushLimit(kCount * 5);
+
+    for (int i = 0; i < kCount; i++) {
+      uint32 value;
+      EXPECT_TRUE(coded_input.ReadVarint32(&value));
+      EXPECT_EQ(14882, value);
+      EXPECT_TRUE(coded_input.Skip(3));
+    }
+    EXPECT_FALSE(coded_input.Skip(1));
+  }
+
+  EXPECT_EQ(kCount * 5, input.ByteCount());
+}
+
 // -------------------------------------------------------------------
 // GetDirectBufferPointer
 
@@ -0,0 +1,256 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// https://developers.google.com/protocol-buffers/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+#include <google/protobuf/lazy_field.h>
+
+#include <google/protobuf/stubs/mutex.h>
+#include <google/protobuf/stubs/once.h>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/wire_format_lite.h>
+#include <google/protobuf/wire_format_lite_inl.h>
+
+namespace google {
+namespace protobuf {
+namespace internal {
+
+namespace {
+
+// Lazy fields are rarely parsed concurrently, so they share one mutex rather
+// than paying for one each.
+Mutex* lazy_field_mutex = NULL;
+GOOGLE_PROTOBUF_DECLARE_ONCE(lazy_field_mutex_init);
+
+void DeleteLazyFieldMutex() {
+  delete lazy_field_mutex;
+  lazy_field_mutex = NULL;
+}
+
+void InitLazyFieldMutex() {
+  lazy_field_mutex = new Mutex;
+  OnShutdown(&DeleteLazyFieldMutex);
+}
+
+// The unparsed bytes were accepted as a length-delimited field when they were
+// read.  If they turn out to be malformed, the message keeps whatever could be
+// parsed, as there is no longer a caller to report the error to.
+void ParseUnparsed(const string& unparsed, MessageLite* message) {
+  io::CodedInputStream input(
+      reinterpret_cast<const uint8*>(unparsed.data()),
+      static_cast<int>(unparsed.size()));
+  message->MergePartialFromCodedStream(&input);
+}
+
+}  // namespace
+
+void LazyField::Destroy() {
+  delete GetMessage();
+  delete unparsed_;
+}
+
+const MessageLite* LazyField::ParseSlow(const MessageLite& prototype,
+                                        ::google::protobuf::Arena* arena) const {
+  GoogleOnceInit(&lazy_field_mutex_init, &InitLazyFieldMutex);
+  MutexLock lock(lazy_field_mutex);
+  const MessageLite* message = GetMessage();
+  if (message == NULL) {
+    // unparsed_ is left in place: other threads may be serializing from it.
+    MessageLite* parsed = prototype.New(arena);
+    ParseUnparsed(*unparsed_, parsed);
+    const_cast<LazyField*>(this)->SetMessage(parsed);
+    message = parsed;
+  }
+  return message;
+}
+
+void LazyField::ClearUnparsed(::google::protobuf::Arena* arena) {
+  if (arena == NULL) {
+    delete unparsed_;
+  }
+  unparsed_ = NULL;
+}
+
+MessageLite* LazyField::Mutable(const MessageLite& prototype,
+                                ::google::protobuf::Arena* arena) {
+  MessageLite* message = GetMessage();
+  if (message == NULL) {
+    message = prototype.New(arena);
+    if (unparsed_ != NULL) {
+      ParseUnparsed(*unparsed_, message);
+    }
+    SetMessage(message);
+  }
+  ClearUnparsed(arena);
+  return message;
+}
+
+MessageLite* LazyField::Release(const MessageLite& prototype,
+                                ::google::protobuf::Arena* arena) {
+  MessageLite* message = UnsafeArenaRelease(prototype, arena);
+  if (arena != NULL && message != NULL) {
+    // message is owned by the arena -- we need to return a copy.
+    MessageLite* copy = prototype.New();
+    copy->CheckTypeAndMergeFrom(*message);
+    message = copy;
+  }
+  return message;
+}
+
+MessageLite* LazyField::UnsafeArenaRelease(const MessageLite& prototype,
+                                           ::google::protobuf::Arena* arena) {
+  if (GetMessage() == NULL && unparsed_ == NULL) {
+    return NULL;
+  }
+  MessageLite* message = Mutable(prototype, arena);
+  SetMessage(NULL);
+  return message;
+}
+
+void LazyField::SetAllocated(MessageLite* message,
+                             ::google::protobuf::Arena* arena) {
+  if (message != NULL) {
+    ::google::protobuf::Arena* message_arena = message->GetArena();
+    if (arena != NULL && message_arena == NULL) {
+      arena->Own(message);
+    } else if (arena != message_arena) {
+      MessageLite* copy = message->New(arena);
+      copy->CheckTypeAndMergeFrom(*message);
+      message = copy;
+    }
+  }
+  UnsafeArenaSetAllocated(message, arena);
+}
+
+void LazyField::UnsafeArenaSetAllocated(MessageLite* message,
+                                        ::google::protobuf::Arena* arena) {
+  // If we're not on an arena, free whatever we were holding before.  (If we
+  // are on an arena, we can just forget the earlier pointers.)
+  if (arena == NULL) {
+    Destroy();
+  }
+  unparsed_ = NULL;
+  SetMessage(message);
+}
+
+void LazyField::Clear() {
+  MessageLite* message = GetMessage();
+  if (message != NULL) {
+    message->Clear();
+  }
+  // An empty string is the serialized form of the cleared message, so the
+  // buffer can be kept for the next parse.
+  if (unparsed_ != NULL) {
+    unparsed_->clear();
+  }
+}
+
+void LazyField::MergeFrom(const LazyField& other, const MessageLite& prototype,
+                          ::google::protobuf::Arena* arena) {
+  if (other.unparsed_ != NULL) {
+    if (GetMessage() == NULL) {
+      // Concatenating serialized messages merges them.
+      if (unparsed_ == NULL) {
+        unparsed_ = ::google::protobuf::Arena::Create< ::std::string>(arena);
+      }
+      unparsed_->append(*other.unparsed_);
+    } else {
+      ParseUnparsed(*other.unparsed_, Mutable(prototype, arena));
+    }
+    return;
+  }
+  const MessageLite* other_message = other.GetMessage();
+  if (other_message != NULL) {
+    Mutable(prototype, arena)->CheckTypeAndMergeFrom(*other_message);
+  }
+}
+
+bool LazyField::MergeFromCodedStream(io::CodedInputStream* input,
+                                     const MessageLite& prototype,
+                                     ::google::protobuf::Arena* arena) {
+  MessageLite* message = GetMessage();
+  if (message != NULL) {
+    ClearUnparsed(arena);
+    return WireFormatLite::ReadMessage(input, message);
+  }
+
+  uint32 length;
+  if (!input->ReadVarint32(&length)) return false;
+  if (unparsed_ == NULL) {
+    unparsed_ = ::google::protobuf::Arena::Create< ::std::string>(arena);
+  }
+  if (unparsed_->empty()) {
+    return input->ReadString(unparsed_, static_cast<int>(length));
+  }
+  ::std::string bytes;
+  if (!input->ReadString(&bytes, static_cast<int>(length))) return false;
+  unparsed_->append(bytes);
+  return true;
+}
+
+size_t LazyField::ByteSizeLong() const {
+  if (unparsed_ != NULL) return unparsed_->size();
+  const MessageLite* message = GetMessage();
+  return message != NULL ? message->ByteSizeLong() : 0;
+}
+
+int LazyField::GetCachedSize() const {
+  if (unparsed_ != NULL) return static_cast<int>(unparsed_->size());
+  const MessageLite* message = GetMessage();
+  return message != NULL ? message->GetCachedSize() : 0;
+}
+
+void LazyField::SerializeWithCachedSizes(io::CodedOutputStream* output) const {
+  if (unparsed_ != NULL) {
+    output->WriteRawMaybeAliased(unparsed_->data(),
+                                 static_cast<int>(unparsed_->size()));
+    return;
+  }
+  const MessageLite* message = GetMessage();
+  if (message != NULL) {
+    message->SerializeWithCachedSizes(output);
+  }
+}
+
+uint8* LazyField::InternalSerializeWithCachedSizesToArray(
+    bool deterministic, uint8* target) const {
+  if (unparsed_ != NULL) {
+    return io::CodedOutputStream::WriteStringToArray(*unparsed_, target);
+  }
+  const MessageLite* message = GetMessage();
+  if (message != NULL) {
+    target = message->InternalSerializeWithCachedSizesToArray(deterministic,
+                                                              target);
+  }
+  return target;
+}
+
+}  // namespace internal
+}  // namespace protobuf
+}  // namespace google
@@ -0,0 +1,170 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// https://developers.google.com/protocol-buffers/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+
+#ifndef GOOGLE_PROTOBUF_LAZY_FIELD_H__
+#define GOOGLE_PROTOBUF_LAZY_FIELD_H__
+
+#include <string>
+
+#include <google/protobuf/stubs/atomicops.h>
+#include <google/protobuf/stubs/common.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/message_lite.h>
+
+// This is the implementation of lazily parsed sub-message fields, i.e.
+// singular message fields declared with [lazy=true] in lite files.  The
+// LazyField class below is an internal implementation class and *should not be
+// used* by user code.
+//
+// A LazyField keeps the serialized bytes of the sub-message as they were read
+// from the wire and only parses them the first time the message is accessed.
+// Until the message is modified, the original bytes are also what gets
+// serialized, so a message that is parsed and re-serialized without touching
+// the field never parses it at all.
+
+namespace google {
+namespace protobuf {
+namespace internal {
+
+class LIBPROTOBUF_EXPORT LazyField {
+ public:
+  // Like ArenaStringPtr, LazyField has no constructor or destructor so that it
+  // can live in the generated message classes; the generated SharedCtor() and
+  // SharedDtor() call Init() and Destroy() instead.
+  void Init() {
+    message_ = 0;
+    unparsed_ = NULL;
+  }
+
+  // Frees the message and the unparsed bytes.  Only called when the owning
+  // message is not on an arena.
+  void Destroy();
+
+  // Returns the parsed message, parsing the unparsed bytes first if needed.
+  // Returns the prototype when the field holds neither.  Like the other const
+  // methods of generated messages, this is safe to call from multiple threads
+  // at once.
+  const MessageLite& Get(const MessageLite& prototype,
+                         ::google::protobuf::Arena* arena) const {
+    const MessageLite* message = GetMessage();
+    if (message != NULL) return *message;
+    if (unparsed_ == NULL) return prototype;
+    return *ParseSlow(prototype, arena);
+  }
+
+  // Returns a mutable message, parsing it first if needed.  The unparsed bytes
+  // no longer describe the message after this and are dropped.
+  MessageLite* Mutable(const MessageLite& prototype,
+                       ::google::protobuf::Arena* arena);
+
+  // Release returns a heap-allocated message that is not Own()'d by any arena,
+  // or NULL if the field holds no message.  Used to implement
+  // release_<field>() methods on generated classes.
+  MessageLite* Release(const MessageLite& prototype,
+                       ::google::protobuf::Arena* arena);
+
+  // As Release(), but the returned message may be owned by the arena.
+  MessageLite* UnsafeArenaRelease(const MessageLite& prototype,
+                                  ::google::protobuf::Arena* arena);
+
+  // Takes ownership of a heap-allocated message, copying it if it lives on a
+  // different arena.  Used to implement set_allocated_<field>().
+  void SetAllocated(MessageLite* message, ::google::protobuf::Arena* arena);
+
+  // As SetAllocated(), but the message must already be owned by the arena.
+  void UnsafeArenaSetAllocated(MessageLite* message,
+                               ::google::protobuf::Arena* arena);
+
+  // Clears the message, keeping the message object around for reuse.
+  void Clear();
+
+  // Merges other into this field.  If neither side has been parsed yet this
+  // only concatenates the unparsed bytes.
+  void MergeFrom(const LazyField& other, const MessageLite& prototype,
+                 ::google::protobuf::Arena* arena);
+
+  // Swaps two fields that are on the same arena.
+  void Swap(LazyField* other) {
+    std::swap(message_, other->message_);
+    std::swap(unparsed_, other->unparsed_);
+  }
+
+  // Reads a length-delimited sub-message from input.  If the field has not
+  // been parsed yet the bytes are appended to the unparsed bytes without
+  // looking at them, otherwise they are merged into the parsed message.
+  bool MergeFromCodedStream(io::CodedInputStream* input,
+                            const MessageLite& prototype,
+                            ::google::protobuf::Arena* arena);
+
+  // Serialization mirrors MessageLite: ByteSizeLong() must be called before
+  // GetCachedSize() and the serializers.  Unparsed bytes are written as they
+  // are.
+  size_t ByteSizeLong() const;
+  int GetCachedSize() const;
+  void SerializeWithCachedSizes(io::CodedOutputStream* output) const;
+  uint8* InternalSerializeWithCachedSizesToArray(bool deterministic,
+                                                 uint8* target) const;
+
+ private:
+  const MessageLite* GetMessage() const {
+    return reinterpret_cast<const MessageLite*>(
+        google::protobuf::internal::Acquire_Load(&message_));
+  }
+  MessageLite* GetMessage() {
+    return reinterpret_cast<MessageLite*>(
+        google::protobuf::internal::Acquire_Load(&message_));
+  }
+  void SetMessage(MessageLite* message) {
+    google::protobuf::internal::Release_Store(
+        &message_, reinterpret_cast<google::protobuf::internal::AtomicWord>(message));
+  }
+
+  // Parses unparsed_ into a new message.  Concurrent callers are serialized
+  // on a global mutex, and the first one publishes the message.
+  const MessageLite* ParseSlow(const MessageLite& prototype,
+                               ::google::protobuf::Arena* arena) const;
+  // Drops the unparsed bytes once they no longer describe the message.
+  void ClearUnparsed(::google::protobuf::Arena* arena);
+
+  // The parsed message, or NULL if the field has not been parsed.  Written by
+  // the const Get(), so it is published with release/acquire semantics.
+  mutable google::protobuf::internal::AtomicWord message_;
+  // The serialized message as read from the wire, or NULL.  Once the message
+  // is parsed the bytes are kept as long as they describe it, so that the
+  // field can still be serialized without re-encoding the message.
+  ::std::string* unparsed_;
+};
+
+}  // namespace internal
+}  // namespace protobuf
+
+}  // namespace google
+#endif  // GOOGLE_PROTOBUF_LAZY_FIELD_H__
@@ -30,6 +30,7 @@
 
 #include <google/protobuf/arena_test_util.h>
 #include <google/protobuf/map_lite_test_util.h>
+#include <google/protobuf/unittest_lazy_lite.pb.h>
 #include <google/protobuf/testing/googletest.h>
 #include <gtest/gtest.h>
 
@@ -78,6 +79,43 @@ TEST(LiteArenaTest, UnknownFieldMemLeak) {
   message->ParseFromString(data);
 }
 
+TEST(LiteArenaTest, LazyField) {
+  protobuf_unittest::TestLazyLite source;
+  source.mutable_lazy_message()->set_bb(5);
+  source.mutable_lazy_message()->add_names("name");
+  source.mutable_lazy_child()->set_id(6);
+  string data = source.SerializeAsString();
+
+  google::protobuf::Arena arena;
+  protobuf_unittest::TestLazyLite* message =
+      google::protobuf::Arena::CreateMessage<protobuf_unittest::TestLazyLite>(&arena);
+  ASSERT_TRUE(message->ParseFromString(data));
+  EXPECT_EQ(data, message->SerializeAsString());
+  EXPECT_EQ(6, message->lazy_child().id());
+  EXPECT_EQ(&arena, message->lazy_child().GetArena());
+
+  // Released messages are heap copies.
+  protobuf_unittest::TestLazyLite::NestedMessage* released =
+      message->release_lazy_message();
+  ASSERT_TRUE(released != NULL);
+  EXPECT_TRUE(released->GetArena() == NULL);
+  EXPECT_EQ(5, released->bb());
+  EXPECT_EQ("name", released->names(0));
+
+  // Heap messages are owned by the arena once set.
+  message->set_allocated_lazy_message(released);
+  EXPECT_EQ(released, &message->lazy_message());
+  EXPECT_EQ(data, message->SerializeAsString());
+
+  protobuf_unittest::TestLazyLite* other =
+      google::protobuf::Arena::CreateMessage<protobuf_unittest::TestLazyLite>(&arena);
+  ASSERT_TRUE(other->ParseFromString(data));
+  other->mutable_lazy_child()->set_id(7);
+  message->MergeFrom(*other);
+  EXPECT_EQ(7, message->lazy_child().id());
+  ASSERT_EQ(2, message->lazy_message().names_size());
+}
+
 }  // namespace
 }  // namespace protobuf
 }  // namespace google
@@ -39,7 +39,9 @@
 #include <google/protobuf/map_lite_test_util.h>
 #include <google/protobuf/map_lite_unittest.pb.h>
 #include <google/protobuf/test_util_lite.h>
+#include <google/protobuf/unittest_lazy_lite.pb.h>
 #include <google/protobuf/unittest_lite.pb.h>
+#include <google/protobuf/unittest_table_driven_lite.pb.h>
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/io/zero_copy_stream_impl_lite.h>
 #include <google/protobuf/wire_format_lite.h>
@@ -861,3 +863,314 @@ TEST(Lite, AllLite42) {
 
   std::cout << "PASS" << std::endl;
 }
+
+// unittest_table_driven_lite.proto is generated with the table_driven_parsing
+// and table_driven_serialization options.  Its messages must produce exactly
+// the bytes the generated serializers produce for the same fields.
+TEST(Lite, TableDrivenSerialization) {
+  protobuf_unittest::TestAllTypesLite message;
+  google::protobuf::TestUtilLite::SetAllFields(&message);
+
+  protobuf_unittest::TestTableDrivenLite table_message;
+  ASSERT_TRUE(table_message.ParseFromString(message.SerializeAsString()));
+  table_message.mutable_unknown_fields()->clear();
+
+  // Clear what TestTableDrivenLite does not define.
+  message.clear_optional_import_message();
+  message.clear_optional_import_enum();
+  message.clear_optional_public_import_message();
+  message.clear_optional_lazy_message();
+  message.clear_repeated_import_message();
+  message.clear_repeated_import_enum();
+  message.clear_repeated_lazy_message();
+  message.clear_default_int32();
+  message.clear_default_int64();
+  message.clear_default_uint32();
+  message.clear_default_uint64();
+  message.clear_default_sint32();
+  message.clear_default_sint64();
+  message.clear_default_fixed32();
+  message.clear_default_fixed64();
+  message.clear_default_sfixed32();
+  message.clear_default_sfixed64();
+  message.clear_default_float();
+  message.clear_default_double();
+  message.clear_default_bool();
+  message.clear_default_string();
+  message.clear_default_bytes();
+  message.clear_default_nested_enum();
+  message.clear_default_foreign_enum();
+  message.clear_default_import_enum();
+  message.clear_oneof_uint32();
+  message.clear_oneof_nested_message();
+  message.clear_oneof_string();
+  message.clear_oneof_bytes();
+  message.clear_oneof_lazy_nested_message();
+
+  const std::string expected = message.SerializeAsString();
+  EXPECT_EQ(expected.size(), table_message.ByteSize());
+  EXPECT_EQ(expected, table_message.SerializeAsString());
+
+  protobuf_unittest::TestPackedTypesLite packed_message;
+  google::protobuf::TestUtilLite::SetPackedFields(&packed_message);
+  const std::string packed_expected = packed_message.SerializeAsString();
+
+  protobuf_unittest::TestPackedTableDrivenLite packed_table_message;
+  ASSERT_TRUE(packed_table_message.ParseFromString(packed_expected));
+  EXPECT_EQ(packed_expected.size(), packed_table_message.ByteSize());
+  EXPECT_EQ(packed_expected, packed_table_message.SerializeAsString());
+}
+
+TEST(Lite, TableDrivenSerializationToStream) {
+  protobuf_unittest::TestAllTypesLite message;
+  google::protobuf::TestUtilLite::SetAllFields(&message);
+
+  protobuf_unittest::TestTableDrivenLite table_message;
+  ASSERT_TRUE(table_message.ParseFromString(message.SerializeAsString()));
+  table_message.mutable_unknown_fields()->clear();
+  const std::string expected = table_message.SerializeAsString();
+
+  // Small blocks keep the stream from handing out a flat buffer, so the fields
+  // are written to the CodedOutputStream one at a time.
+  std::string data(expected.size(), '\0');
+  {
+    google::protobuf::io::ArrayOutputStream array_stream(
+        &data[0], data.size(), 3);
+    google::protobuf::io::CodedOutputStream output(&array_stream);
+    EXPECT_TRUE(table_message.SerializeToCodedStream(&output));
+    EXPECT_FALSE(output.HadError());
+  }
+  EXPECT_EQ(expected, data);
+
+  protobuf_unittest::TestPackedTypesLite packed_message;
+  google::protobuf::TestUtilLite::SetPackedFields(&packed_message);
+  protobuf_unittest::TestPackedTableDrivenLite packed_table_message;
+  ASSERT_TRUE(
+      packed_table_message.ParseFromString(packed_message.SerializeAsString()));
+  const std::string packed_expected = packed_table_message.SerializeAsString();
+
+  std::string packed_data(packed_expected.size(), '\0');
+  {
+    google::protobuf::io::ArrayOutputStream array_stream(
+        &packed_data[0], packed_data.size(), 3);
+    google::protobuf::io::CodedOutputStream output(&array_stream);
+    EXPECT_TRUE(packed_table_message.SerializeToCodedStream(&output));
+    EXPECT_FALSE(output.HadError());
+  }
+  EXPECT_EQ(packed_expected, packed_data);
+}
+
+TEST(Lite, TableDrivenSerializationPreservesUnknownFields) {
+  protobuf_unittest::TestAllTypesLite message;
+  google::protobuf::TestUtilLite::SetAllFields(&message);
+
+  // Fields TestTableDrivenLite does not define are kept as unknown fields and
+  // written after the known ones.
+  protobuf_unittest::TestTableDrivenLite table_message;
+  ASSERT_TRUE(table_message.ParseFromString(message.SerializeAsString()));
+  const std::string data = table_message.SerializeAsString();
+  EXPECT_EQ(data.size(), table_message.ByteSize());
+
+  protobuf_unittest::TestAllTypesLite parsed;
+  ASSERT_TRUE(parsed.ParseFromString(data));
+  google::protobuf::TestUtilLite::ExpectAllFieldsSet(parsed);
+}
+
+namespace {
+
+void SetRepeatedTableDrivenFields(
+    protobuf_unittest::TestRepeatedTableDrivenLite* message) {
+  for (int i = 0; i < 100; i++) {
+    message->add_int32_values(i * 1000 - 50000);
+    message->add_packed_int32_values(i);
+    message->add_packed_sint64_values(-i * GOOGLE_LONGLONG(1000000));
+    message->add_fixed32_values(i * 7);
+    message->add_packed_double_values(i / 4.0);
+    message->add_enum_values(i % 2 ? protobuf_unittest::FOREIGN_LITE_FOO
+                                   : protobuf_unittest::FOREIGN_LITE_BAZ);
+    message->add_packed_enum_values(protobuf_unittest::FOREIGN_LITE_BAR);
+    message->add_string_values(google::protobuf::SimpleItoa(i));
+    message->add_message_values()->set_bb(i);
+  }
+}
+
+}  // namespace
+
+TEST(Lite, TableDrivenParsingRepeatedFields) {
+  protobuf_unittest::TestRepeatedTableDrivenLite message;
+  SetRepeatedTableDrivenFields(&message);
+  const std::string data = message.SerializeAsString();
+
+  protobuf_unittest::TestRepeatedTableDrivenLite parsed;
+  ASSERT_TRUE(parsed.ParseFromString(data));
+  EXPECT_EQ(data, parsed.SerializeAsString());
+  EXPECT_EQ(100, parsed.message_values_size());
+  EXPECT_EQ(99, parsed.message_values(99).bb());
+  EXPECT_EQ("42", parsed.string_values(42));
+
+  // Small blocks make runs of repeated elements straddle buffer boundaries.
+  google::protobuf::io::ArrayInputStream array_stream(data.data(), data.size(),
+                                                      3);
+  protobuf_unittest::TestRepeatedTableDrivenLite streamed;
+  ASSERT_TRUE(streamed.ParseFromZeroCopyStream(&array_stream));
+  EXPECT_EQ(data, streamed.SerializeAsString());
+}
+
+TEST(Lite, TableDrivenParsingPackedAndUnpacked) {
+  typedef google::protobuf::internal::WireFormatLite WireFormatLite;
+
+  // Repeated fields accept both the packed and the unpacked encoding, and
+  // enum values the enum does not define go to the unknown fields.
+  std::string data;
+  {
+    google::protobuf::io::StringOutputStream raw_output(&data);
+    google::protobuf::io::CodedOutputStream output(&raw_output);
+    // int32_values, packed.
+    WireFormatLite::WriteTag(1, WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
+                             &output);
+    output.WriteVarint32(2);
+    output.WriteVarint32(3);
+    output.WriteVarint32(4);
+    // packed_int32_values, unpacked.
+    WireFormatLite::WriteInt32(2, 5, &output);
+    WireFormatLite::WriteInt32(2, 6, &output);
+    // packed_enum_values, with an unknown value in the middle.
+    WireFormatLite::WriteTag(7, WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
+                             &output);
+    output.WriteVarint32(4);
+    output.WriteVarint32(protobuf_unittest::FOREIGN_LITE_FOO);
+    output.WriteVarint32(1000);
+    output.WriteVarint32(protobuf_unittest::FOREIGN_LITE_BAZ);
+  }
+
+  protobuf_unittest::TestRepeatedTableDrivenLite parsed;
+  ASSERT_TRUE(parsed.ParseFromString(data));
+  ASSERT_EQ(2, parsed.int32_values_size());
+  EXPECT_EQ(3, parsed.int32_values(0));
+  EXPECT_EQ(4, parsed.int32_values(1));
+  ASSERT_EQ(2, parsed.packed_int32_values_size());
+  EXPECT_EQ(5, parsed.packed_int32_values(0));
+  EXPECT_EQ(6, parsed.packed_int32_values(1));
+  ASSERT_EQ(2, parsed.packed_enum_values_size());
+  EXPECT_EQ(protobuf_unittest::FOREIGN_LITE_FOO, parsed.packed_enum_values(0));
+  EXPECT_EQ(protobuf_unittest::FOREIGN_LITE_BAZ, parsed.packed_enum_values(1));
+
+  std::string expected_unknown;
+  {
+    google::protobuf::io::StringOutputStream raw_output(&expected_unknown);
+    google::protobuf::io::CodedOutputStream output(&raw_output);
+    WireFormatLite::WriteInt32(7, 1000, &output);
+  }
+  EXPECT_EQ(expected_unknown, parsed.unknown_fields());
+}
+
+TEST(Lite, LazyFieldKeepsUnparsedBytes) {
+  typedef google::protobuf::internal::WireFormatLite WireFormatLite;
+
+  // lazy_message with bb = 1 in a non-canonical, two byte varint.  Bytes that
+  // were never re-encoded are serialized exactly as they were read.
+  std::string data;
+  {
+    google::protobuf::io::StringOutputStream raw_output(&data);
+    google::protobuf::io::CodedOutputStream output(&raw_output);
+    WireFormatLite::WriteInt32(1, 7, &output);
+    WireFormatLite::WriteTag(2, WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
+                             &output);
+    output.WriteVarint32(3);
+    output.WriteTag(WireFormatLite::MakeTag(
+        1, WireFormatLite::WIRETYPE_VARINT));
+    output.WriteRaw("\x81\x00", 2);
+  }
+
+  protobuf_unittest::TestLazyLite message;
+  ASSERT_TRUE(message.ParseFromString(data));
+  EXPECT_TRUE(message.has_lazy_message());
+  EXPECT_EQ(data, message.SerializeAsString());
+  EXPECT_EQ(data.size(), message.ByteSizeLong());
+
+  // Reading the field parses it, but does not invalidate the bytes.
+  EXPECT_EQ(1, message.lazy_message().bb());
+  EXPECT_EQ(data, message.SerializeAsString());
+
+  // Modifying it does.
+  message.mutable_lazy_message()->set_bb(2);
+  protobuf_unittest::TestLazyLite expected;
+  expected.set_id(7);
+  expected.mutable_lazy_message()->set_bb(2);
+  EXPECT_EQ(expected.SerializeAsString(), message.SerializeAsString());
+}
+
+TEST(Lite, LazyFieldMerge) {
+  protobuf_unittest::TestLazyLite first;
+  first.mutable_lazy_message()->set_bb(1);
+  first.mutable_lazy_message()->add_names("a");
+  first.mutable_lazy_child()->mutable_lazy_message()->set_bb(10);
+  protobuf_unittest::TestLazyLite second;
+  second.mutable_lazy_message()->set_bb(2);
+  second.mutable_lazy_message()->add_names("b");
+
+  // Merging unparsed fields concatenates their bytes.
+  protobuf_unittest::TestLazyLite parsed_first, parsed_second;
+  ASSERT_TRUE(parsed_first.ParseFromString(first.SerializeAsString()));
+  ASSERT_TRUE(parsed_second.ParseFromString(second.SerializeAsString()));
+  protobuf_unittest::TestLazyLite merged(parsed_first);
+  merged.MergeFrom(parsed_second);
+  EXPECT_EQ(2, merged.lazy_message().bb());
+  ASSERT_EQ(2, merged.lazy_message().names_size());
+  EXPECT_EQ("a", merged.lazy_message().names(0));
+  EXPECT_EQ("b", merged.lazy_message().names(1));
+  EXPECT_EQ(10, merged.lazy_child().lazy_message().bb());
+
+  // So does parsing the field twice.
+  protobuf_unittest::TestLazyLite concatenated;
+  ASSERT_TRUE(concatenated.ParseFromString(first.SerializeAsString() +
+                                           second.SerializeAsString()));
+  EXPECT_EQ(merged.SerializeAsString(), concatenated.SerializeAsString());
+
+  // Merging into a field that has been parsed already parses the bytes.
+  protobuf_unittest::TestLazyLite eager(first);
+  EXPECT_EQ(1, eager.lazy_message().bb());
+  eager.MergeFrom(parsed_second);
+  EXPECT_EQ(2, eager.lazy_message().bb());
+  EXPECT_EQ(2, eager.lazy_message().names_size());
+  std::string second_data = second.SerializeAsString();
+  google::protobuf::io::CodedInputStream input(
+      reinterpret_cast<const google::protobuf::uint8*>(second_data.data()),
+      second_data.size());
+  ASSERT_TRUE(eager.MergeFromCodedStream(&input));
+  EXPECT_EQ(3, eager.lazy_message().names_size());
+
+  // Clearing works whether or not the field has been parsed.
+  merged.Clear();
+  EXPECT_FALSE(merged.has_lazy_message());
+  EXPECT_EQ(0, merged.lazy_message().bb());
+  EXPECT_EQ(0, merged.ByteSizeLong());
+  ASSERT_TRUE(merged.ParseFromString(second.SerializeAsString()));
+  EXPECT_EQ(second.SerializeAsString(), merged.SerializeAsString());
+}
+
+TEST(Lite, LazyFieldOwnership) {
+  protobuf_unittest::TestLazyLite source;
+  source.mutable_lazy_message()->set_bb(5);
+  protobuf_unittest::TestLazyLite message;
+  ASSERT_TRUE(message.ParseFromString(source.SerializeAsString()));
+
+  protobuf_unittest::TestLazyLite::NestedMessage* released =
+      message.release_lazy_message();
+  ASSERT_TRUE(released != NULL);
+  EXPECT_EQ(5, released->bb());
+  EXPECT_FALSE(message.has_lazy_message());
+  EXPECT_EQ(0, message.lazy_message().bb());
+
+  message.set_allocated_lazy_message(released);
+  EXPECT_TRUE(message.has_lazy_message());
+  EXPECT_EQ(released, &message.lazy_message());
+  message.set_allocated_lazy_message(NULL);
+  EXPECT_FALSE(message.has_lazy_message());
+
+  protobuf_unittest::TestLazyLite other;
+  ASSERT_TRUE(other.ParseFromString(source.SerializeAsString()));
+  message.Swap(&other);
+  EXPECT_EQ(5, message.lazy_message().bb());
+  EXPECT_FALSE(other.has_lazy_message());
+}
@@ -47,9 +47,16 @@
 #include <google/protobuf/generated_enum_util.h>
 #include <google/protobuf/map_type_handler.h>
 #include <google/protobuf/stubs/hash.h>
+#include <google/protobuf/stubs/stringpiece.h>
 #if __cpp_exceptions && LANG_CXX11
 #include <random>
 #endif
+#if defined(GOOGLE_PROTOBUF_MAP_FLAT_TABLE) &&                  \
+    (defined(__SSE2__) || defined(_M_X64) ||                     \
+     (defined(_M_IX86_FP) && _M_IX86_FP >= 2))
+#define GOOGLE_PROTOBUF_MAP_SSE2
+#include <emmintrin.h>
+#endif
 
 namespace google {
 namespace protobuf {
@@ -78,6 +85,151 @@ class TypeDefinedMapFieldBase;
 class DynamicMapField;
 
 class GeneratedMessageReflection;
+
+// MapStringLookup<Key, K, R>::type is R if a Map<Key, T> can look up keys of
+// type K without converting them to Key first: a Map<string, T> can take a
+// StringPiece or a C string.  Otherwise it is not defined, which removes the
+// heterogeneous overloads of Map's lookup functions.
+template <typename Key, typename K, typename R>
+struct MapStringLookup {};
+template <typename R>
+struct MapStringLookup<string, StringPiece, R> { typedef R type; };
+template <typename R>
+struct MapStringLookup<string, const char*, R> { typedef R type; };
+template <typename R>
+struct MapStringLookup<string, char*, R> { typedef R type; };
+template <size_t N, typename R>
+struct MapStringLookup<string, char[N], R> { typedef R type; };
+
+// The InnerMaps hash and compare what they are asked to look up with these,
+// so that a StringPiece finds the same keys as the string it holds would.
+template <typename Key>
+inline size_t MapKeyHash(hash<Key>& h, const Key& k) {
+  return h(k);
+}
+// Same as hash<string>, which hashes the string up to its first NUL.
+inline size_t MapKeyHash(hash<string>&, StringPiece k) {
+  size_t result = 0;
+  for (const char *str = k.data(), *end = str + k.size();
+       str < end && *str != '\0'; str++) {
+    result = 5 * result + *str;
+  }
+  return result;
+}
+
+template <typename Key>
+inline bool MapKeyEquals(const Key& k0, const Key& k1) {
+  return std::equal_to<Key>()(k0, k1);
+}
+inline bool MapKeyEquals(const string& k0, StringPiece k1) {
+  return StringPiece(k0) == k1;
+}
+
+// Returns k as a Key, converting it into *storage if it is not one.
+template <typename Key>
+inline const Key& MapKeyAsKey(const Key& k, Key* /* storage */) {
+  return k;
+}
+inline const string& MapKeyAsKey(StringPiece k, string* storage) {
+  k.CopyToString(storage);
+  return *storage;
+}
+
+#ifdef GOOGLE_PROTOBUF_MAP_FLAT_TABLE
+// Control bytes of the open-addressing table behind google::protobuf::Map.  A full
+// slot holds the low 7 bits of its key's hash.  Empty and deleted slots are
+// negative, so a single signed comparison tells them from full ones.
+typedef int8 MapCtrl;
+static const MapCtrl kMapCtrlEmpty = -128;
+static const MapCtrl kMapCtrlDeleted = -2;
+
+// MapGroup compares a group of kWidth control bytes at once.  The Match
+// functions return a mask with bit i set iff control byte i matches.
+class MapGroup {
+ public:
+  enum { kWidth = 16 };
+
+#ifdef GOOGLE_PROTOBUF_MAP_SSE2
+  explicit MapGroup(const MapCtrl* ctrl)
+      : ctrl_(_mm_loadu_si128(reinterpret_cast<const __m128i*>(ctrl))) {}
+
+  uint32 Match(MapCtrl h2) const {
+    return _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), ctrl_));
+  }
+  uint32 MatchEmpty() const { return Match(kMapCtrlEmpty); }
+  uint32 MatchEmptyOrDeleted() const {
+    return _mm_movemask_epi8(_mm_cmpgt_epi8(_mm_set1_epi8(-1), ctrl_));
+  }
+
+ private:
+  __m128i ctrl_;
+#elif defined(PROTOBUF_LITTLE_ENDIAN)
+  // Portable version: each half of the group is matched as one 64-bit word,
+  // and the high bit of every matching byte is then packed into the mask.
+  explicit MapGroup(const MapCtrl* ctrl) {
+    memcpy(words_, ctrl, sizeof(words_));
+  }
+
+  uint32 Match(MapCtrl h2) const {
+    const uint64 pattern =
+        kLsbs * static_cast<uint64>(static_cast<uint8>(h2));
+    // May report a byte above a real match as matching too.  That is harmless
+    // since callers compare the keys of the slots they are given.
+    return ToMask(ZeroBytes(words_[0] ^ pattern),
+                  ZeroBytes(words_[1] ^ pattern));
+  }
+  uint32 MatchEmpty() const {
+    // kMapCtrlEmpty is the only control byte with bit 7 set and bit 1 clear.
+    return ToMask(words_[0] & ~(words_[0] << 6) & kMsbs,
+                  words_[1] & ~(words_[1] << 6) & kMsbs);
+  }
+  uint32 MatchEmptyOrDeleted() const {
+    return ToMask(words_[0] & kMsbs, words_[1] & kMsbs);
+  }
+
+ private:
+  static const uint64 kLsbs = GOOGLE_ULONGLONG(0x0101010101010101);
+  static const uint64 kMsbs = GOOGLE_ULONGLONG(0x8080808080808080);
+
+  static uint64 ZeroBytes(uint64 x) { return (x - kLsbs) & ~x & kMsbs; }
+  // Gathers the high bit of each byte of lo and hi into a 16-bit mask.
+  static uint32 ToMask(uint64 lo, uint64 hi) {
+    const uint64 kGather = GOOGLE_ULONGLONG(0x0102040810204080);
+    return static_cast<uint32>(((lo >> 7) * kGather) >> 56) |
+           (static_cast<uint32>(((hi >> 7) * kGather) >> 56) << 8);
+  }
+
+  uint64 words_[2];
+#else
+  explicit MapGroup(const MapCtrl* ctrl) : ctrl_(ctrl) {}
+
+  uint32 Match(MapCtrl h2) const {
+    uint32 mask = 0;
+    for (int i = 0; i < kWidth; i++) {
+      if (ctrl_[i] == h2) mask |= 1u << i;
+    }
+    return mask;
+  }
+  uint32 MatchEmpty() const { return Match(kMapCtrlEmpty); }
+  uint32 MatchEmptyOrDeleted() const {
+    uint32 mask = 0;
+    for (int i = 0; i < kWidth; i++) {
+      if (ctrl_[i] < 0) mask |= 1u << i;
+    }
+    return mask;
+  }
+
+ private:
+  const MapCtrl* ctrl_;
+#endif
+
+ public:
+  // Index of the lowest bit set in a non-zero mask.
+  static int LowestBit(uint32 mask) {
+    return Bits::Log2FloorNonZero(mask & (~mask + 1));
+  }
+};
+#endif  // GOOGLE_PROTOBUF_MAP_FLAT_TABLE
 }  // namespace internal
 
 // This is the class for google::protobuf::Map's internal value_type. Instead of using
@@ -121,6 +273,12 @@ class MapPair {
 //
 // Map's interface is similar to std::unordered_map, except that Map is not
 // designed to play well with exceptions.
+//
+// Map is a chaining hash table by default.  Defining
+// GOOGLE_PROTOBUF_MAP_FLAT_TABLE (the protobuf_MAP_FLAT_TABLE CMake option)
+// selects an open-addressing table instead, which does not allocate a node per
+// element.  The choice changes Map's layout, so the protobuf libraries and all
+// code using them must be built with the same setting.
 template <typename Key, typename T>
 class Map {
  public:
@@ -280,6 +438,460 @@ class Map {
 
   typedef MapAllocator<KeyValuePair> Allocator;
 
+#ifdef GOOGLE_PROTOBUF_MAP_FLAT_TABLE
+  // InnerMap is a generic hash-based map.  It doesn't contain any
+  // protocol-buffer-specific logic.  This version, used when
+  // GOOGLE_PROTOBUF_MAP_FLAT_TABLE is defined, is an open-addressing table in
+  // the style of SwissTable.
+  //
+  // Some implementation details:
+  // 1. The hash function has type hasher and the equality function
+  //    equal_to<Key>.  We inherit from hasher to save space
+  //    (empty-base-class optimization).
+  // 2. KeyValuePairs are stored in slots_, a flat array, so inserting does not
+  //    allocate a node.  ctrl_ holds one control byte per slot: empty, deleted,
+  //    or the low 7 bits of the hash of the slot's key ("H2").
+  // 3. The number of slots is a power of two and a multiple of the group
+  //    width.  A lookup starts at the group picked by the rest of the hash
+  //    ("H1") and probes one group at a time, comparing H2 with the whole
+  //    group's control bytes at once (with SSE2 where available), so keys are
+  //    compared only on a likely hit.  It stops at the first group that has an
+  //    empty slot.  Steps grow by one group each time, which visits every
+  //    group.
+  // 4. Erasing leaves a deleted marker, unless the slot's group has an empty
+  //    slot, and never moves other elements.  Deleted markers count toward the
+  //    load and are dropped when the table is rehashed.
+  // 5. Slots move when the table is resized, but the values (pointers to
+  //    Map's value_type) do not.  Iterators remember their value and look it
+  //    up again by key when their slot no longer holds it.
+  // 6. The code requires no C++ features from C++11 or later.
+  // 7. Mutations to a map do not invalidate the map's iterators, pointers to
+  //    elements, or references to elements.
+  // 8. Except for erase(iterator), any non-const method can reorder iterators.
+  class InnerMap : private hasher {
+   public:
+    typedef value_type* Value;
+
+    InnerMap(size_type n, hasher h, Allocator alloc)
+        : hasher(h),
+          num_elements_(0),
+          num_deleted_(0),
+          seed_(Seed()),
+          ctrl_(NULL),
+          slots_(NULL),
+          alloc_(alloc) {
+      CreateEmptyTable(TableSize(n));
+    }
+
+    ~InnerMap() {
+      if (ctrl_ != NULL) {
+        clear();
+        DestroyTable(ctrl_, slots_, capacity_);
+      }
+    }
+
+   private:
+    enum { kGroupWidth = internal::MapGroup::kWidth };
+    enum { kMinTableSize = kGroupWidth };
+
+    // iterator and const_iterator are instantiations of iterator_base.
+    template <typename KeyValueType>
+    struct iterator_base {
+      typedef KeyValueType& reference;
+      typedef KeyValueType* pointer;
+
+      // Invariants:
+      // value_ identifies the element, and is NULL only for end() and for the
+      // result of insert(const Key&) until the caller fills the value in.
+      // Copying an iterator picks up a value filled in since.  index_ is the
+      // element's slot when the iterator was last used; it can become stale
+      // if the table is resized, so it is rechecked before use.
+      iterator_base() : m_(NULL), index_(0), value_(NULL) {}
+
+      explicit iterator_base(const InnerMap* m) : m_(m) {
+        SearchFrom(m->index_of_first_full_);
+      }
+
+      iterator_base(const iterator_base& it)
+          : m_(it.m_), index_(it.index_), value_(it.CurrentValue()) {}
+
+      // Any iterator_base can convert to any other.  This is overkill, and we
+      // rely on the enclosing class to use it wisely.  The standard "iterator
+      // can convert to const_iterator" is OK but the reverse direction is not.
+      template <typename U>
+      explicit iterator_base(const iterator_base<U>& it)
+          : m_(it.m_), index_(it.index_), value_(it.CurrentValue()) {}
+
+      iterator_base(const InnerMap* m, size_type index)
+          : m_(m), index_(index), value_(m->slots_[index].value()) {}
+
+      iterator_base& operator=(const iterator_base& it) {
+        m_ = it.m_;
+        index_ = it.index_;
+        value_ = it.CurrentValue();
+        return *this;
+      }
+
+      // Advance through slots, looking for the first full one.  If there is
+      // none, become end().
+      void SearchFrom(size_type start_index) {
+        for (index_ = start_index; index_ < m_->capacity_; index_++) {
+          if (m_->IsFull(index_)) {
+            value_ = m_->slots_[index_].value();
+            return;
+          }
+        }
+        m_ = NULL;
+        index_ = 0;
+        value_ = NULL;
+      }
+
+      reference operator*() const { return m_->slots_[Revalidate()]; }
+      pointer operator->() const { return &(operator*()); }
+
+      friend bool operator==(const iterator_base& a, const iterator_base& b) {
+        return a.CurrentValue() == b.CurrentValue();
+      }
+      friend bool operator!=(const iterator_base& a, const iterator_base& b) {
+        return a.CurrentValue() != b.CurrentValue();
+      }
+
+      iterator_base& operator++() {
+        SearchFrom(Revalidate() + 1);
+        return *this;
+      }
+
+      iterator_base operator++(int /* unused */) {
+        iterator_base tmp = *this;
+        ++*this;
+        return tmp;
+      }
+
+      Value CurrentValue() const {
+        return value_ == NULL && m_ != NULL ? m_->slots_[index_].value()
+                                            : value_;
+      }
+
+      // Assumes m_ is correct and non-NULL, but index_ may be stale.  Fix it
+      // if needed, and return it.
+      size_type Revalidate() const {
+        GOOGLE_DCHECK(m_ != NULL);
+        if (value_ != NULL &&
+            (index_ >= m_->capacity_ || !m_->IsFull(index_) ||
+             m_->slots_[index_].value() != value_)) {
+          index_ = m_->FindIndex(value_->first);
+          GOOGLE_DCHECK_LT(index_, m_->capacity_);
+        }
+        return index_;
+      }
+
+      const InnerMap* m_;
+      mutable size_type index_;
+      Value value_;
+    };
+
+   public:
+    typedef iterator_base<KeyValuePair> iterator;
+    typedef iterator_base<const KeyValuePair> const_iterator;
+
+    iterator begin() { return iterator(this); }
+    iterator end() { return iterator(); }
+    const_iterator begin() const { return const_iterator(this); }
+    const_iterator end() const { return const_iterator(); }
+
+    void clear() {
+      for (size_type i = index_of_first_full_; i < capacity_; i++) {
+        if (IsFull(i)) alloc_.destroy(&slots_[i]);
+      }
+      memset(ctrl_, internal::kMapCtrlEmpty, capacity_);
+      num_elements_ = 0;
+      num_deleted_ = 0;
+      index_of_first_full_ = capacity_;
+    }
+
+    const hasher& hash_function() const { return *this; }
+
+    static size_type max_size() {
+      return static_cast<size_type>(1) << (sizeof(void**) >= 8 ? 60 : 28);
+    }
+    size_type size() const { return num_elements_; }
+    bool empty() const { return size() == 0; }
+
+    // K is Key, or a type that MapStringLookup allows looking Keys up by.
+    template <typename K>
+    iterator find(const K& k) {
+      const size_type index = FindIndex(k);
+      return index == capacity_ ? end() : iterator(this, index);
+    }
+    template <typename K>
+    const_iterator find(const K& k) const {
+      const size_type index = FindIndex(k);
+      return index == capacity_ ? end() : const_iterator(this, index);
+    }
+
+    // In traditional C++ style, this performs "insert if not present."
+    std::pair<iterator, bool> insert(const KeyValuePair& kv) {
+      std::pair<size_type, bool> p = FindOrPrepareInsert(kv.key());
+      if (p.second) {
+        alloc_.construct(&slots_[p.first], kv);
+      }
+      return std::make_pair(iterator(this, p.first), p.second);
+    }
+
+    // The same, but if an insertion is necessary then the value portion of the
+    // inserted key-value pair is left NULL.
+    std::pair<iterator, bool> insert(const Key& k) {
+      std::pair<size_type, bool> p = FindOrPrepareInsert(k);
+      if (p.second) {
+        typedef typename Allocator::template rebind<Key>::other KeyAllocator;
+        KeyAllocator(alloc_).construct(&slots_[p.first].key(), k);
+        slots_[p.first].value() = NULL;
+      }
+      return std::make_pair(iterator(this, p.first), p.second);
+    }
+
+    Value& operator[](const Key& k) {
+      KeyValuePair kv(k, Value());
+      return insert(kv).first->value();
+    }
+
+    void erase(iterator it) {
+      GOOGLE_DCHECK_EQ(it.m_, this);
+      const size_type index = it.Revalidate();
+      alloc_.destroy(&slots_[index]);
+      // If the group has an empty slot, it has never been full since the last
+      // rehash, so no lookup probes past it and the slot can become empty.
+      const size_type group_start =
+          index & ~static_cast<size_type>(kGroupWidth - 1);
+      if (internal::MapGroup(ctrl_ + group_start).MatchEmpty() != 0) {
+        ctrl_[index] = internal::kMapCtrlEmpty;
+      } else {
+        ctrl_[index] = internal::kMapCtrlDeleted;
+        ++num_deleted_;
+      }
+      --num_elements_;
+      if (GOOGLE_PREDICT_FALSE(index == index_of_first_full_)) {
+        while (index_of_first_full_ < capacity_ &&
+               !IsFull(index_of_first_full_)) {
+          ++index_of_first_full_;
+        }
+      }
+    }
+
+   private:
+    // Returns the slot holding k, or capacity_ if there is none.
+    template <typename K>
+    size_type FindIndex(const K& k) const {
+      return FindIndex(k, HashOf(k));
+    }
+    template <typename K>
+    size_type FindIndex(const K& k, size_type hash) const {
+      const internal::MapCtrl h2 = H2(hash);
+      const size_type mask = capacity_ / kGroupWidth - 1;
+      size_type group = H1(hash) & mask;
+      for (size_type step = 1;; ++step) {
+        const size_type group_start = group * kGroupWidth;
+        internal::MapGroup g(ctrl_ + group_start);
+        for (uint32 match = g.Match(h2); match != 0; match &= match - 1) {
+          const size_type index =
+              group_start + internal::MapGroup::LowestBit(match);
+          if (internal::MapKeyEquals(slots_[index].key(), k)) return index;
+        }
+        if (g.MatchEmpty() != 0) return capacity_;
+        group = (group + step) & mask;
+      }
+    }
+
+    // Returns the first slot on the probe sequence of hash that is empty or
+    // deleted.
+    size_type FindFirstNonFull(size_type hash) const {
+      const size_type mask = capacity_ / kGroupWidth - 1;
+      size_type group = H1(hash) & mask;
+      for (size_type step = 1;; ++step) {
+        const size_type group_start = group * kGroupWidth;
+        const uint32 match =
+            internal::MapGroup(ctrl_ + group_start).MatchEmptyOrDeleted();
+        if (match != 0) {
+          return group_start + internal::MapGroup::LowestBit(match);
+        }
+        group = (group + step) & mask;
+      }
+    }
+
+    // Returns the slot holding k and false if there is one.  Otherwise
+    // reserves a slot for k, resizing the table first if necessary, and
+    // returns it and true; the caller must construct the slot's KeyValuePair.
+    std::pair<size_type, bool> FindOrPrepareInsert(const Key& k) {
+      const size_type hash = HashOf(k);
+      size_type index = FindIndex(k, hash);
+      if (index != capacity_) return std::make_pair(index, false);
+      ResizeIfLoadIsOutOfRange(num_elements_ + 1);
+      index = FindFirstNonFull(hash);
+      if (ctrl_[index] == internal::kMapCtrlDeleted) --num_deleted_;
+      ctrl_[index] = H2(hash);
+      ++num_elements_;
+      // parentheses around (std::min) prevents macro expansion of min(...)
+      index_of_first_full_ = (std::min)(index_of_first_full_, index);
+      return std::make_pair(index, true);
+    }
+
+    // Returns whether it did resize.  Currently this is only used when
+    // num_elements_ increases, though it could be used in other situations.
+    // It checks for load too low as well as load too high: because any number
+    // of erases can occur between inserts, the load could be as low as 0 here.
+    // Deleted slots count toward the high load, as they lengthen probes; when
+    // they make up most of it, the table is rehashed at the same size.
+    bool ResizeIfLoadIsOutOfRange(size_type new_size) {
+      const size_type kMaxMapLoadTimes16 = 14;  // controls RAM vs CPU tradeoff
+      const size_type hi_cutoff = capacity_ * kMaxMapLoadTimes16 / 16;
+      const size_type lo_cutoff = hi_cutoff / 4;
+      if (GOOGLE_PREDICT_FALSE(new_size + num_deleted_ > hi_cutoff)) {
+        if (new_size <= hi_cutoff / 2) {
+          Resize(capacity_);
+          return true;
+        } else if (capacity_ <= max_size() / 2) {
+          Resize(capacity_ * 2);
+          return true;
+        }
+      } else if (GOOGLE_PREDICT_FALSE(new_size <= lo_cutoff &&
+                                      capacity_ > kMinTableSize)) {
+        size_type lg2_of_size_reduction_factor = 1;
+        // It's possible we want to shrink a lot here... size() could even be 0.
+        // So, estimate how much to shrink by making sure we don't shrink so
+        // much that we would need to grow the table after a few inserts.
+        const size_type hypothetical_size = new_size * 5 / 4 + 1;
+        while ((hypothetical_size << lg2_of_size_reduction_factor) <
+               hi_cutoff) {
+          ++lg2_of_size_reduction_factor;
+        }
+        size_type new_capacity = std::max<size_type>(
+            kMinTableSize, capacity_ >> lg2_of_size_reduction_factor);
+        if (new_capacity != capacity_) {
+          Resize(new_capacity);
+          return true;
+        }
+      }
+      return false;
+    }
+
+    // Rehash into a table with the given number of slots.
+    void Resize(size_type new_capacity) {
+      GOOGLE_DCHECK_GE(new_capacity, kMinTableSize);
+      internal::MapCtrl* const old_ctrl = ctrl_;
+      KeyValuePair* const old_slots = slots_;
+      const size_type old_capacity = capacity_;
+      const size_type start = index_of_first_full_;
+      CreateEmptyTable(new_capacity);
+      for (size_type i = start; i < old_capacity; i++) {
+        if (old_ctrl[i] >= 0) {
+          const size_type hash = HashOf(old_slots[i].key());
+          const size_type index = FindFirstNonFull(hash);
+          ctrl_[index] = H2(hash);
+          TransferSlot(&old_slots[i], &slots_[index]);
+          index_of_first_full_ = (std::min)(index_of_first_full_, index);
+        }
+      }
+      num_deleted_ = 0;
+      DestroyTable(old_ctrl, old_slots, old_capacity);
+    }
+
+    void TransferSlot(KeyValuePair* from, KeyValuePair* to) {
+#if LANG_CXX11
+      alloc_.construct(to, std::move(*from));
+#else
+      alloc_.construct(to, *from);
+#endif
+      alloc_.destroy(from);
+    }
+
+    bool IsFull(size_type index) const { return ctrl_[index] >= 0; }
+
+    template <typename K>
+    size_type HashOf(const K& k) const {
+      // We inherit from hasher, so one-arg operator() provides a hash function.
+      uint64 h = internal::MapKeyHash(
+          static_cast<hasher&>(*const_cast<InnerMap*>(this)), k);
+      // hash<> is the identity for integers, so mix in the seed and spread
+      // the bits over the ones that H2 and H1 use.  As with the chaining map,
+      // the seed also varies the iteration order from map to map.
+      h = (h ^ seed_) * GOOGLE_ULONGLONG(0x9e3779b97f4a7c15);
+      return static_cast<size_type>(h ^ (h >> 32));
+    }
+    static internal::MapCtrl H2(size_type hash) {
+      return static_cast<internal::MapCtrl>(hash & 0x7f);
+    }
+    static size_type H1(size_type hash) { return hash >> 7; }
+
+    // Return a power of two no less than max(kMinTableSize, n).
+    // Assumes either n < kMinTableSize or n is a power of two.
+    size_type TableSize(size_type n) {
+      return n < static_cast<size_type>(kMinTableSize)
+                 ? static_cast<size_type>(kMinTableSize)
+                 : n;
+    }
+
+    // Use alloc_ to allocate an array of n objects of type U.
+    template <typename U>
+    U* Alloc(size_type n) {
+      typedef typename Allocator::template rebind<U>::other alloc_type;
+      return alloc_type(alloc_).allocate(n);
+    }
+
+    // Use alloc_ to deallocate an array of n objects of type U.
+    template <typename U>
+    void Dealloc(U* t, size_type n) {
+      typedef typename Allocator::template rebind<U>::other alloc_type;
+      alloc_type(alloc_).deallocate(t, n);
+    }
+
+    void CreateEmptyTable(size_type n) {
+      GOOGLE_DCHECK(n >= kMinTableSize);
+      GOOGLE_DCHECK_EQ(n & (n - 1), 0);
+      ctrl_ = Alloc<internal::MapCtrl>(n);
+      memset(ctrl_, internal::kMapCtrlEmpty, n);
+      slots_ = Alloc<KeyValuePair>(n);
+      capacity_ = index_of_first_full_ = n;
+    }
+
+    // Frees the arrays of a table whose slots have all been destroyed.
+    void DestroyTable(internal::MapCtrl* ctrl, KeyValuePair* slots,
+                      size_type n) {
+      Dealloc<internal::MapCtrl>(ctrl, n);
+      Dealloc<KeyValuePair>(slots, n);
+    }
+
+    // Return a randomish value.
+    size_type Seed() const {
+      // random_device can throw, so avoid it unless we are compiling with
+      // exceptions enabled.
+#if __cpp_exceptions && LANG_CXX11
+      try {
+        std::random_device rd;
+        std::knuth_b knuth(rd());
+        std::uniform_int_distribution<size_type> u;
+        return u(knuth);
+      } catch (...) { }
+#endif
+      size_type s = static_cast<size_type>(reinterpret_cast<uintptr_t>(this));
+#if defined(__x86_64__) && defined(__GNUC__)
+      uint32 hi, lo;
+      asm("rdtsc" : "=a" (lo), "=d" (hi));
+      s += ((static_cast<uint64>(hi) << 32) | lo);
+#endif
+      return s;
+    }
+
+    size_type num_elements_;
+    size_type num_deleted_;
+    size_type capacity_;
+    size_type seed_;
+    size_type index_of_first_full_;
+    internal::MapCtrl* ctrl_;  // an array with capacity_ control bytes
+    KeyValuePair* slots_;      // constructed only where ctrl_ is full
+    Allocator alloc_;
+    GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(InnerMap);
+  };  // end of class InnerMap
+#else  // GOOGLE_PROTOBUF_MAP_FLAT_TABLE
   // InnerMap is a generic hash-based map.  It doesn't contain any
   // protocol-buffer-specific logic.  It is a chaining hash map with the
   // additional feature that some buckets can be converted to use an ordered
@@ -534,8 +1146,15 @@ class Map {
     size_type size() const { return num_elements_; }
     bool empty() const { return size() == 0; }
 
-    iterator find(const Key& k) { return iterator(FindHelper(k).first); }
-    const_iterator find(const Key& k) const { return find(k, NULL); }
+    // K is Key, or a type that MapStringLookup allows looking Keys up by.
+    template <typename K>
+    iterator find(const K& k) {
+      return iterator(FindHelper(k).first);
+    }
+    template <typename K>
+    const_iterator find(const K& k) const {
+      return find(k, NULL);
+    }
 
     // In traditional C++ style, this performs "insert if not present."
     std::pair<iterator, bool> insert(const KeyValuePair& kv) {
@@ -614,19 +1233,22 @@ class Map {
     }
 
    private:
-    const_iterator find(const Key& k, TreeIterator* it) const {
+    template <typename K>
+    const_iterator find(const K& k, TreeIterator* it) const {
       return FindHelper(k, it).first;
     }
-    std::pair<const_iterator, size_type> FindHelper(const Key& k) const {
+    template <typename K>
+    std::pair<const_iterator, size_type> FindHelper(const K& k) const {
       return FindHelper(k, NULL);
     }
-    std::pair<const_iterator, size_type> FindHelper(const Key& k,
+    template <typename K>
+    std::pair<const_iterator, size_type> FindHelper(const K& k,
                                                     TreeIterator* it) const {
       size_type b = BucketNumber(k);
       if (TableEntryIsNonEmptyList(b)) {
         Node* node = static_cast<Node*>(table_[b]);
         do {
-          if (IsMatch(*KeyPtrFromNodePtr(node), k)) {
+          if (internal::MapKeyEquals(*KeyPtrFromNodePtr(node), k)) {
             return std::make_pair(const_iterator(node, this, b), b);
           } else {
             node = node->next;
@@ -636,7 +1258,10 @@ class Map {
         GOOGLE_DCHECK_EQ(table_[b], table_[b ^ 1]);
         b &= ~static_cast<size_t>(1);
         Tree* tree = static_cast<Tree*>(table_[b]);
-        Key* key = const_cast<Key*>(&k);
+        // The tree can only look up Keys.  Trees are rare enough that
+        // converting a StringPiece here is not worth avoiding.
+        Key storage;
+        Key* key = const_cast<Key*>(&internal::MapKeyAsKey(k, &storage));
         typename Tree::iterator tree_it = tree->find(key);
         if (tree_it != tree->end()) {
           if (it != NULL) *it = tree_it;
@@ -862,9 +1487,11 @@ class Map {
       return count >= kMaxLength;
     }
 
-    size_type BucketNumber(const Key& k) const {
+    template <typename K>
+    size_type BucketNumber(const K& k) const {
       // We inherit from hasher, so one-arg operator() provides a hash function.
-      size_type h = (*const_cast<InnerMap*>(this))(k);
+      size_type h = internal::MapKeyHash(
+          static_cast<hasher&>(*const_cast<InnerMap*>(this)), k);
       // To help prevent people from making assumptions about the hash function,
       // we use the seed differently depending on NDEBUG.  The default hash
       // function, the seeding, etc., are all likely to change in the future.
@@ -875,10 +1502,6 @@ class Map {
 #endif
     }
 
-    bool IsMatch(const Key& k0, const Key& k1) const {
-      return std::equal_to<Key>()(k0, k1);
-    }
-
     // Return a power of two no less than max(kMinTableSize, n).
     // Assumes either n < kMinTableSize or n is a power of two.
     size_type TableSize(size_type n) {
@@ -949,6 +1572,7 @@ class Map {
     Allocator alloc_;
     GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(InnerMap);
   };  // end of class InnerMap
+#endif  // GOOGLE_PROTOBUF_MAP_FLAT_TABLE
 
  public:
   // Iterators
@@ -1043,6 +1667,13 @@ class Map {
     }
     return (*value)->second;
   }
+  template <typename K>
+  typename internal::MapStringLookup<Key, K, T&>::type operator[](
+      const K& key) {
+    iterator it = find(key);
+    if (it != end()) return it->second;
+    return operator[](StringPiece(key).ToString());
+  }
   const T& at(const key_type& key) const {
     const_iterator it = find(key);
     GOOGLE_CHECK(it != end());
@@ -1053,6 +1684,19 @@ class Map {
     GOOGLE_CHECK(it != end());
     return it->second;
   }
+  template <typename K>
+  typename internal::MapStringLookup<Key, K, const T&>::type at(
+      const K& key) const {
+    const_iterator it = find(key);
+    GOOGLE_CHECK(it != end());
+    return it->second;
+  }
+  template <typename K>
+  typename internal::MapStringLookup<Key, K, T&>::type at(const K& key) {
+    iterator it = find(key);
+    GOOGLE_CHECK(it != end());
+    return it->second;
+  }
 
   // Lookup
   size_type count(const key_type& key) const {
@@ -1064,6 +1708,25 @@ class Map {
     return const_iterator(iterator(elements_->find(key)));
   }
   iterator find(const key_type& key) { return iterator(elements_->find(key)); }
+
+  // A Map<string, T> can also look keys up by StringPiece or C string
+  // without building a string from them.  The overloads above take
+  // precedence for a string argument.
+  template <typename K>
+  typename internal::MapStringLookup<Key, K, size_type>::type count(
+      const K& key) const {
+    return find(key) == end() ? 0 : 1;
+  }
+  template <typename K>
+  typename internal::MapStringLookup<Key, K, const_iterator>::type find(
+      const K& key) const {
+    return const_iterator(iterator(elements_->find(StringPiece(key))));
+  }
+  template <typename K>
+  typename internal::MapStringLookup<Key, K, iterator>::type find(
+      const K& key) {
+    return iterator(elements_->find(StringPiece(key)));
+  }
   std::pair<const_iterator, const_iterator> equal_range(
       const key_type& key) const {
     const_iterator it = find(key);
@@ -1114,9 +1777,12 @@ class Map {
     }
   }
   iterator erase(iterator pos) {
-    if (arena_ == NULL) delete pos.operator->();
+    // Delete the value only after the InnerMap is done with it: the flat
+    // InnerMap finds stale iterators again by the value's key.
+    value_type* value = pos.operator->();
     iterator i = pos++;
     elements_->erase(i.it_);
+    if (arena_ == NULL) delete value;
     return pos;
   }
   void erase(iterator first, iterator last) {
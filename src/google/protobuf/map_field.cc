@@ -33,10 +33,28 @@
 
 #include <vector>
 
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <sched.h>
+#endif
+
 namespace google {
 namespace protobuf {
 namespace internal {
 
+namespace {
+
+void SchedYield() {
+#ifdef _WIN32
+  Sleep(0);
+#else  // POSIX
+  sched_yield();
+#endif
+}
+
+}  // namespace
+
 MapFieldBase::~MapFieldBase() {
   if (repeated_field_ != NULL && arena_ == NULL) delete repeated_field_;
 }
@@ -46,6 +64,14 @@ const RepeatedPtrFieldBase& MapFieldBase::GetRepeatedField() const {
   return *repeated_field_;
 }
 
+int MapFieldBase::RepeatedFieldSize() const {
+  if (google::protobuf::internal::Acquire_Load(&state_) == STATE_MODIFIED_MAP) {
+    // The repeated field would be built with one entry per map element.
+    return size();
+  }
+  return GetRepeatedField().size();
+}
+
 RepeatedPtrFieldBase* MapFieldBase::MutableRepeatedField() {
   SyncRepeatedFieldWithMap();
   SetRepeatedDirty();
@@ -53,9 +79,9 @@ RepeatedPtrFieldBase* MapFieldBase::MutableRepeatedField() {
 }
 
 size_t MapFieldBase::SpaceUsedExcludingSelfLong() const {
-  mutex_.Lock();
+  const Atomic32 state = LockState();
   size_t size = SpaceUsedExcludingSelfNoLock();
-  mutex_.Unlock();
+  UnlockState(state);
   return size;
 }
 
@@ -71,7 +97,7 @@ bool MapFieldBase::IsMapValid() const {
   // "Acquire" insures the operation after SyncRepeatedFieldWithMap won't get
   // executed before state_ is checked.
   Atomic32 state = google::protobuf::internal::Acquire_Load(&state_);
-  return state != STATE_MODIFIED_REPEATED;
+  return state == STATE_MODIFIED_MAP || state == CLEAN;
 }
 
 void MapFieldBase::SetMapDirty() { state_ = STATE_MODIFIED_MAP; }
@@ -80,21 +106,38 @@ void MapFieldBase::SetRepeatedDirty() { state_ = STATE_MODIFIED_REPEATED; }
 
 void* MapFieldBase::MutableRepeatedPtrField() const { return repeated_field_; }
 
+Atomic32 MapFieldBase::LockState() const {
+  for (;;) {
+    Atomic32 state = google::protobuf::internal::Acquire_Load(&state_);
+    if (state != STATE_SYNCING &&
+        google::protobuf::internal::Acquire_CompareAndSwap(
+            &state_, state, STATE_SYNCING) == state) {
+      return state;
+    }
+    // Another thread is synchronizing; it will not take long.
+    SchedYield();
+  }
+}
+
+void MapFieldBase::UnlockState(Atomic32 state) const {
+  google::protobuf::internal::Release_Store(&state_, state);
+}
+
 void MapFieldBase::SyncRepeatedFieldWithMap() const {
   // "Acquire" insures the operation after SyncRepeatedFieldWithMap won't get
   // executed before state_ is checked.
   Atomic32 state = google::protobuf::internal::Acquire_Load(&state_);
-  if (state == STATE_MODIFIED_MAP) {
-    mutex_.Lock();
-    // Double check state, because another thread may have seen the same state
-    // and done the synchronization before the current thread.
-    if (state_ == STATE_MODIFIED_MAP) {
+  if (state == STATE_MODIFIED_MAP || state == STATE_SYNCING) {
+    state = LockState();
+    // Check the state again, because another thread may have done the
+    // synchronization while this one waited.
+    if (state == STATE_MODIFIED_MAP) {
       SyncRepeatedFieldWithMapNoLock();
-      // "Release" insures state_ can only be changed "after"
-      // SyncRepeatedFieldWithMapNoLock is finished.
-      google::protobuf::internal::Release_Store(&state_, CLEAN);
+      state = CLEAN;
     }
-    mutex_.Unlock();
+    // "Release" insures state_ can only be changed "after"
+    // SyncRepeatedFieldWithMapNoLock is finished.
+    UnlockState(state);
   }
 }
 
@@ -108,17 +151,17 @@ void MapFieldBase::SyncMapWithRepeatedField() const {
   // "Acquire" insures the operation after SyncMapWithRepeatedField won't get
   // executed before state_ is checked.
   Atomic32 state = google::protobuf::internal::Acquire_Load(&state_);
-  if (state == STATE_MODIFIED_REPEATED) {
-    mutex_.Lock();
-    // Double check state, because another thread may have seen the same state
-    // and done the synchronization before the current thread.
-    if (state_ == STATE_MODIFIED_REPEATED) {
+  if (state == STATE_MODIFIED_REPEATED || state == STATE_SYNCING) {
+    state = LockState();
+    // Check the state again, because another thread may have done the
+    // synchronization while this one waited.
+    if (state == STATE_MODIFIED_REPEATED) {
       SyncMapWithRepeatedFieldNoLock();
-      // "Release" insures state_ can only be changed "after"
-      // SyncRepeatedFieldWithMapNoLock is finished.
-      google::protobuf::internal::Release_Store(&state_, CLEAN);
+      state = CLEAN;
     }
-    mutex_.Unlock();
+    // "Release" insures state_ can only be changed "after"
+    // SyncMapWithRepeatedFieldNoLock is finished.
+    UnlockState(state);
   }
 }
 
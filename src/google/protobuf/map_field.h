@@ -32,7 +32,6 @@
 #define GOOGLE_PROTOBUF_MAP_FIELD_H__
 
 #include <google/protobuf/stubs/atomicops.h>
-#include <google/protobuf/stubs/mutex.h>
 #include <google/protobuf/stubs/common.h>
 #include <google/protobuf/generated_message_reflection.h>
 #include <google/protobuf/arena.h>
@@ -67,11 +66,7 @@ class LIBPROTOBUF_EXPORT MapFieldBase {
   explicit MapFieldBase(Arena* arena)
       : arena_(arena),
         repeated_field_(NULL),
-        state_(STATE_MODIFIED_MAP) {
-    // Mutex's destructor needs to be called explicitly to release resources
-    // acquired in its constructor.
-    arena->OwnDestructor(&mutex_);
-  }
+        state_(STATE_MODIFIED_MAP) {}
   virtual ~MapFieldBase();
 
   // Returns reference to internal repeated field. Data written using
@@ -79,6 +74,10 @@ class LIBPROTOBUF_EXPORT MapFieldBase {
   // included in repeated field.
   const RepeatedPtrFieldBase& GetRepeatedField() const;
 
+  // Returns GetRepeatedField().size(), but without building the repeated
+  // field when it would be built from the map.
+  int RepeatedFieldSize() const;
+
   // Like above. Returns mutable pointer to the internal repeated field.
   RepeatedPtrFieldBase* MutableRepeatedField();
 
@@ -133,16 +132,23 @@ class LIBPROTOBUF_EXPORT MapFieldBase {
     STATE_MODIFIED_REPEATED = 1,  // repeated field has newly added data that
                                   // has not been synchronized to map
     CLEAN = 2,  // data in map and repeated field are same
+    STATE_SYNCING = 3,  // a thread holds state_ (see LockState())
   };
 
+  // Waits until no other thread holds state_ and takes it, so that the caller
+  // alone may synchronize the map and repeated field.  Returns the state to
+  // give UnlockState() if the caller changes nothing.
+  Atomic32 LockState() const;
+  // Stores the new state, publishing everything written while state_ was
+  // held.
+  void UnlockState(Atomic32 state) const;
+
   Arena* arena_;
   mutable RepeatedPtrField<Message>* repeated_field_;
 
-  mutable Mutex mutex_;  // The thread to synchronize map and repeated field
-                         // needs to get lock first;
-  mutable volatile Atomic32 state_;  // 0: STATE_MODIFIED_MAP
-                                     // 1: STATE_MODIFIED_REPEATED
-                                     // 2: CLEAN
+  // One of the States above.  Holding STATE_SYNCING makes state_ the lock for
+  // synchronizing map and repeated field, in place of a Mutex per field.
+  mutable volatile Atomic32 state_;
 
  private:
   friend class ContendedMapCleanTest;
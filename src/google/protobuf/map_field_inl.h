@@ -43,9 +43,18 @@
 namespace google {
 namespace protobuf {
 namespace internal {
-// UnwrapMapKey template
+// UnwrapMapKey template.  String keys are returned by reference, so that
+// looking one up in the map does not copy it.
 template<typename T>
-T UnwrapMapKey(const MapKey& map_key);
+struct UnwrapMapKeyResult {
+  typedef T type;
+};
+template<>
+struct UnwrapMapKeyResult<string> {
+  typedef const string& type;
+};
+template<typename T>
+typename UnwrapMapKeyResult<T>::type UnwrapMapKey(const MapKey& map_key);
 template<>
 inline int32 UnwrapMapKey<int32>(const MapKey& map_key) {
   return map_key.GetInt32Value();
@@ -67,7 +76,7 @@ inline bool UnwrapMapKey<bool>(const MapKey& map_key) {
   return map_key.GetBoolValue();
 }
 template<>
-inline string UnwrapMapKey<string>(const MapKey& map_key) {
+inline const string& UnwrapMapKey<string>(const MapKey& map_key) {
   return map_key.GetStringValue();
 }
 
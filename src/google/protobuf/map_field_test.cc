@@ -163,6 +163,23 @@ TEST_F(MapFieldBasePrimitiveTest, MutableRepeatedField) {
   }
 }
 
+TEST_F(MapFieldBasePrimitiveTest, RepeatedFieldSize) {
+  size_t space_used = map_field_base_->SpaceUsedExcludingSelfLong();
+  EXPECT_EQ(2, map_field_base_->RepeatedFieldSize());
+  // The repeated field is not built just to count its entries.
+  EXPECT_EQ(space_used, map_field_base_->SpaceUsedExcludingSelfLong());
+  EXPECT_TRUE(map_field_base_->IsMapValid());
+
+  map_field_base_->GetRepeatedField();
+  EXPECT_LT(space_used, map_field_base_->SpaceUsedExcludingSelfLong());
+  EXPECT_EQ(2, map_field_base_->RepeatedFieldSize());
+
+  reinterpret_cast<RepeatedPtrField<Message>*>(
+      map_field_base_->MutableRepeatedField())->RemoveLast();
+  EXPECT_FALSE(map_field_base_->IsMapValid());
+  EXPECT_EQ(1, map_field_base_->RepeatedFieldSize());
+}
+
 TEST_F(MapFieldBasePrimitiveTest, Arena) {
   // Allocate a large initial block to avoid mallocs during hooked test.
   std::vector<char> arena_block(128 * 1024);
@@ -903,6 +903,42 @@ TEST_F(MapImplTest, EqualRange) {
   EXPECT_TRUE(const_map_.end() == const_range.second);
 }
 
+TEST_F(MapImplTest, HeterogeneousStringLookup) {
+  Map<string, int32> map;
+  const Map<string, int32>& const_map = map;
+  map["header"] = 1;
+
+  // A piece that is not NUL-terminated.
+  string prefixed = "x-header-value";
+  StringPiece piece(prefixed.data() + 2, 6);
+  EXPECT_EQ(1, map.count(piece));
+  EXPECT_TRUE(map.find(piece) == map.find(string("header")));
+  EXPECT_TRUE(const_map.find(piece) == const_map.find("header"));
+  EXPECT_EQ(1, map.at(piece));
+  EXPECT_EQ(1, const_map.at("header"));
+  EXPECT_EQ(0, map.count(StringPiece("head")));
+  EXPECT_TRUE(map.find("header-value") == map.end());
+
+  map[piece] = 2;
+  map[StringPiece("other")] = 3;
+  EXPECT_EQ(2, map.size());
+  EXPECT_EQ(2, map[string("header")]);
+  EXPECT_EQ(3, map[string("other")]);
+
+  // hash<string> stops at the first NUL, so these keys all hash the same,
+  // and in the chaining table their bucket turns into a tree.
+  const string kPrefix("nul\0", 4);
+  for (int i = 0; i < 32; i++) {
+    map[kPrefix + SimpleItoa(i)] = i;
+  }
+  for (int i = 0; i < 32; i++) {
+    string key = kPrefix + SimpleItoa(i);
+    EXPECT_EQ(i, map.at(StringPiece(key)));
+  }
+  EXPECT_EQ(0, map.count(StringPiece(kPrefix)));
+  EXPECT_EQ(0, map.count("nul"));
+}
+
 TEST_F(MapImplTest, ConvertToStdMap) {
   map_[100] = 101;
   std::map<int32, int32> std_map(map_.begin(), map_.end());
@@ -160,6 +160,11 @@ class MapKeySorter;      // wire_format.cc
 class WireFormat;        // wire_format.h
 class MapFieldReflectionTest;  // map_test.cc
 }
+namespace util {
+namespace converter {
+class ReflectionObjectSource;  // reflection_objectsource.h
+}
+}
 
 template<typename T>
 class RepeatedField;     // repeated_field.h
@@ -947,6 +952,7 @@ class LIBPROTOBUF_EXPORT Reflection {
   friend class internal::MapKeySorter;
   friend class internal::WireFormat;
   friend class internal::ReflectionOps;
+  friend class util::converter::ReflectionObjectSource;
 
   // Special version for specialized implementations of string.  We can't call
   // MutableRawRepeatedField directly here because we don't have access to
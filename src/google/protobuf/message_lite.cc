@@ -175,12 +175,14 @@ bool MessageLite::ParsePartialFromCodedStream(io::CodedInputStream* input) {
 
 bool MessageLite::ParseFromZeroCopyStream(io::ZeroCopyInputStream* input) {
   io::CodedInputStream decoder(input);
+  decoder.EnablePatchBuffer(true);
   return ParseFromCodedStream(&decoder) && decoder.ConsumedEntireMessage();
 }
 
 bool MessageLite::ParsePartialFromZeroCopyStream(
     io::ZeroCopyInputStream* input) {
   io::CodedInputStream decoder(input);
+  decoder.EnablePatchBuffer(true);
   return ParsePartialFromCodedStream(&decoder) &&
          decoder.ConsumedEntireMessage();
 }
@@ -188,6 +190,7 @@ bool MessageLite::ParsePartialFromZeroCopyStream(
 bool MessageLite::ParseFromBoundedZeroCopyStream(
     io::ZeroCopyInputStream* input, int size) {
   io::CodedInputStream decoder(input);
+  decoder.EnablePatchBuffer(true);
   decoder.PushLimit(size);
   return ParseFromCodedStream(&decoder) &&
          decoder.ConsumedEntireMessage() &&
@@ -197,6 +200,7 @@ bool MessageLite::ParseFromBoundedZeroCopyStream(
 bool MessageLite::ParsePartialFromBoundedZeroCopyStream(
     io::ZeroCopyInputStream* input, int size) {
   io::CodedInputStream decoder(input);
+  decoder.EnablePatchBuffer(true);
   decoder.PushLimit(size);
   return ParsePartialFromCodedStream(&decoder) &&
          decoder.ConsumedEntireMessage() &&
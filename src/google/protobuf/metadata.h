@@ -66,6 +66,10 @@ class InternalMetadataWithArena
     mutable_unknown_fields()->Clear();
   }
 
+  void DoInitUnknownFields(UnknownFieldSet* unknown_fields, Arena* arena) {
+    unknown_fields->InternalSetArena(arena);
+  }
+
   static const UnknownFieldSet& default_instance() {
     return *UnknownFieldSet::default_instance();
   }
@@ -153,6 +153,8 @@ class InternalMetadataWithArenaBase {
     ptr_ = reinterpret_cast<void*>(
         reinterpret_cast<intptr_t>(container) | kTagContainer);
     container->arena = my_arena;
+    static_cast<Derived*>(this)->DoInitUnknownFields(
+        &container->unknown_fields, my_arena);
     return &(container->unknown_fields);
   }
 };
@@ -182,6 +184,8 @@ class InternalMetadataWithArenaLite
     mutable_unknown_fields()->clear();
   }
 
+  void DoInitUnknownFields(string* unknown_fields, Arena* arena) {}
+
   static const string& default_instance() {
     return GetEmptyStringAlreadyInited();
   }
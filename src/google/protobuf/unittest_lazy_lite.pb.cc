@@ -0,0 +1,1055 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: google/protobuf/unittest_lazy_lite.proto
+
+#define INTERNAL_SUPPRESS_PROTOBUF_FIELD_DEPRECATION
+#include <google/protobuf/unittest_lazy_lite.pb.h>
+
+#include <algorithm>
+
+#include <google/protobuf/stubs/common.h>
+#include <google/protobuf/stubs/port.h>
+#include <google/protobuf/stubs/once.h>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/wire_format_lite_inl.h>
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
+// @@protoc_insertion_point(includes)
+
+namespace protobuf_unittest {
+class TestLazyLite_NestedMessageDefaultTypeInternal : public ::google::protobuf::internal::ExplicitlyConstructed<TestLazyLite_NestedMessage> {
+} _TestLazyLite_NestedMessage_default_instance_;
+class TestLazyLiteDefaultTypeInternal : public ::google::protobuf::internal::ExplicitlyConstructed<TestLazyLite> {
+} _TestLazyLite_default_instance_;
+
+namespace protobuf_google_2fprotobuf_2funittest_5flazy_5flite_2eproto {
+
+PROTOBUF_CONSTEXPR_VAR ::google::protobuf::internal::ParseTableField
+    const TableStruct::entries[] = {
+  {0, 0, 0, ::google::protobuf::internal::kInvalidMask, 0, 0},
+};
+
+PROTOBUF_CONSTEXPR_VAR ::google::protobuf::internal::AuxillaryParseTableField
+    const TableStruct::aux[] = {
+  ::google::protobuf::internal::AuxillaryParseTableField(),
+};
+PROTOBUF_CONSTEXPR_VAR ::google::protobuf::internal::ParseTable const
+    TableStruct::schema[] = {
+  { NULL, NULL, 0, -1, -1, false },
+  { NULL, NULL, 0, -1, -1, false },
+};
+
+
+void TableStruct::Shutdown() {
+  _TestLazyLite_NestedMessage_default_instance_.Shutdown();
+  _TestLazyLite_default_instance_.Shutdown();
+}
+
+void TableStruct::InitDefaultsImpl() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  ::google::protobuf::internal::InitProtobufDefaults();
+  _TestLazyLite_NestedMessage_default_instance_.DefaultConstruct();
+  _TestLazyLite_default_instance_.DefaultConstruct();
+  _TestLazyLite_default_instance_.get_mutable()->eager_message_ = const_cast< ::protobuf_unittest::TestLazyLite_NestedMessage*>(
+      ::protobuf_unittest::TestLazyLite_NestedMessage::internal_default_instance());
+}
+
+void InitDefaults() {
+  static GOOGLE_PROTOBUF_DECLARE_ONCE(once);
+  ::google::protobuf::GoogleOnceInit(&once, &TableStruct::InitDefaultsImpl);
+}
+void AddDescriptorsImpl() {
+  InitDefaults();
+  ::google::protobuf::internal::OnShutdown(&TableStruct::Shutdown);
+}
+
+void AddDescriptors() {
+  static GOOGLE_PROTOBUF_DECLARE_ONCE(once);
+  ::google::protobuf::GoogleOnceInit(&once, &AddDescriptorsImpl);
+}
+#ifdef GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+// Force AddDescriptors() to be called at static initialization time.
+struct StaticDescriptorInitializer {
+  StaticDescriptorInitializer() {
+    AddDescriptors();
+  }
+} static_descriptor_initializer;
+#endif  // GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+
+}  // namespace protobuf_google_2fprotobuf_2funittest_5flazy_5flite_2eproto
+
+
+// ===================================================================
+
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int TestLazyLite_NestedMessage::kBbFieldNumber;
+const int TestLazyLite_NestedMessage::kNamesFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+TestLazyLite_NestedMessage::TestLazyLite_NestedMessage()
+  : ::google::protobuf::MessageLite(), _internal_metadata_(NULL) {
+  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
+    protobuf_google_2fprotobuf_2funittest_5flazy_5flite_2eproto::InitDefaults();
+  }
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:protobuf_unittest.TestLazyLite.NestedMessage)
+}
+TestLazyLite_NestedMessage::TestLazyLite_NestedMessage(::google::protobuf::Arena* arena)
+  : ::google::protobuf::MessageLite(),
+  _internal_metadata_(arena),
+  names_(arena) {
+#ifdef GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  protobuf_google_2fprotobuf_2funittest_5flazy_5flite_2eproto::InitDefaults();
+#endif  // GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.TestLazyLite.NestedMessage)
+}
+TestLazyLite_NestedMessage::TestLazyLite_NestedMessage(const TestLazyLite_NestedMessage& from)
+  : ::google::protobuf::MessageLite(),
+      _internal_metadata_(NULL),
+      _has_bits_(from._has_bits_),
+      _cached_size_(0),
+      names_(from.names_) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  bb_ = from.bb_;
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.TestLazyLite.NestedMessage)
+}
+
+void TestLazyLite_NestedMessage::SharedCtor() {
+  _cached_size_ = 0;
+  bb_ = 0;
+}
+
+TestLazyLite_NestedMessage::~TestLazyLite_NestedMessage() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.TestLazyLite.NestedMessage)
+  SharedDtor();
+}
+
+void TestLazyLite_NestedMessage::SharedDtor() {
+  ::google::protobuf::Arena* arena = GetArenaNoVirtual();
+  if (arena != NULL) {
+    return;
+  }
+
+}
+
+void TestLazyLite_NestedMessage::ArenaDtor(void* object) {
+  TestLazyLite_NestedMessage* _this = reinterpret_cast< TestLazyLite_NestedMessage* >(object);
+  (void)_this;
+}
+void TestLazyLite_NestedMessage::RegisterArenaDtor(::google::protobuf::Arena* arena) {
+}
+void TestLazyLite_NestedMessage::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const TestLazyLite_NestedMessage& TestLazyLite_NestedMessage::default_instance() {
+  protobuf_google_2fprotobuf_2funittest_5flazy_5flite_2eproto::InitDefaults();
+  return *internal_default_instance();
+}
+
+TestLazyLite_NestedMessage* TestLazyLite_NestedMessage::New(::google::protobuf::Arena* arena) const {
+  return ::google::protobuf::Arena::CreateMessage<TestLazyLite_NestedMessage>(arena);
+}
+
+void TestLazyLite_NestedMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.TestLazyLite.NestedMessage)
+  names_.Clear();
+  bb_ = 0;
+  _has_bits_.Clear();
+  _internal_metadata_.Clear();
+}
+
+bool TestLazyLite_NestedMessage::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  ::google::protobuf::io::LazyStringOutputStream unknown_fields_string(
+      ::google::protobuf::NewPermanentCallback(&_internal_metadata_,
+          &::google::protobuf::internal::InternalMetadataWithArenaLite::
+              mutable_unknown_fields));
+  ::google::protobuf::io::CodedOutputStream unknown_fields_stream(
+      &unknown_fields_string, false);
+  // @@protoc_insertion_point(parse_start:protobuf_unittest.TestLazyLite.NestedMessage)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // optional int32 bb = 1;
+      case 1: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(8u)) {
+          set_has_bb();
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, &bb_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated string names = 2;
+      case 2: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(18u)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadString(
+                input, this->add_names()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0 ||
+            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormatLite::SkipField(
+            input, tag, &unknown_fields_stream));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:protobuf_unittest.TestLazyLite.NestedMessage)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:protobuf_unittest.TestLazyLite.NestedMessage)
+  return false;
+#undef DO_
+}
+
+void TestLazyLite_NestedMessage::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:protobuf_unittest.TestLazyLite.NestedMessage)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  // optional int32 bb = 1;
+  if (cached_has_bits & 0x00000001u) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(1, this->bb(), output);
+  }
+
+  // repeated string names = 2;
+  for (int i = 0, n = this->names_size(); i < n; i++) {
+    ::google::protobuf::internal::WireFormatLite::WriteString(
+      2, this->names(i), output);
+  }
+
+  output->WriteRaw(unknown_fields().data(),
+                   static_cast<int>(unknown_fields().size()));
+  // @@protoc_insertion_point(serialize_end:protobuf_unittest.TestLazyLite.NestedMessage)
+}
+
+size_t TestLazyLite_NestedMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.TestLazyLite.NestedMessage)
+  size_t total_size = 0;
+
+  total_size += unknown_fields().size();
+
+  // repeated string names = 2;
+  total_size += 1 *
+      ::google::protobuf::internal::FromIntSize(this->names_size());
+  for (int i = 0, n = this->names_size(); i < n; i++) {
+    total_size += ::google::protobuf::internal::WireFormatLite::StringSize(
+      this->names(i));
+  }
+
+  // optional int32 bb = 1;
+  if (has_bb()) {
+    total_size += 1 +
+      ::google::protobuf::internal::WireFormatLite::Int32Size(
+        this->bb());
+  }
+
+  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = cached_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void TestLazyLite_NestedMessage::CheckTypeAndMergeFrom(
+    const ::google::protobuf::MessageLite& from) {
+  MergeFrom(*::google::protobuf::down_cast<const TestLazyLite_NestedMessage*>(&from));
+}
+
+void TestLazyLite_NestedMessage::MergeFrom(const TestLazyLite_NestedMessage& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.TestLazyLite.NestedMessage)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  names_.MergeFrom(from.names_);
+  if (from.has_bb()) {
+    set_bb(from.bb());
+  }
+}
+
+void TestLazyLite_NestedMessage::CopyFrom(const TestLazyLite_NestedMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.TestLazyLite.NestedMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TestLazyLite_NestedMessage::IsInitialized() const {
+  return true;
+}
+
+void TestLazyLite_NestedMessage::Swap(TestLazyLite_NestedMessage* other) {
+  if (other == this) return;
+  if (GetArenaNoVirtual() == other->GetArenaNoVirtual()) {
+    InternalSwap(other);
+  } else {
+    TestLazyLite_NestedMessage* temp = New(GetArenaNoVirtual());
+    temp->MergeFrom(*other);
+    other->CopyFrom(*this);
+    InternalSwap(temp);
+    if (GetArenaNoVirtual() == NULL) {
+      delete temp;
+    }
+  }
+}
+void TestLazyLite_NestedMessage::UnsafeArenaSwap(TestLazyLite_NestedMessage* other) {
+  if (other == this) return;
+  GOOGLE_DCHECK(GetArenaNoVirtual() == other->GetArenaNoVirtual());
+  InternalSwap(other);
+}
+void TestLazyLite_NestedMessage::InternalSwap(TestLazyLite_NestedMessage* other) {
+  names_.InternalSwap(&other->names_);
+  std::swap(bb_, other->bb_);
+  std::swap(_has_bits_[0], other->_has_bits_[0]);
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  std::swap(_cached_size_, other->_cached_size_);
+}
+
+::std::string TestLazyLite_NestedMessage::GetTypeName() const {
+  return "protobuf_unittest.TestLazyLite.NestedMessage";
+}
+
+#if PROTOBUF_INLINE_NOT_IN_HEADERS
+// TestLazyLite_NestedMessage
+
+// optional int32 bb = 1;
+bool TestLazyLite_NestedMessage::has_bb() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+void TestLazyLite_NestedMessage::set_has_bb() {
+  _has_bits_[0] |= 0x00000001u;
+}
+void TestLazyLite_NestedMessage::clear_has_bb() {
+  _has_bits_[0] &= ~0x00000001u;
+}
+void TestLazyLite_NestedMessage::clear_bb() {
+  bb_ = 0;
+  clear_has_bb();
+}
+::google::protobuf::int32 TestLazyLite_NestedMessage::bb() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestLazyLite.NestedMessage.bb)
+  return bb_;
+}
+void TestLazyLite_NestedMessage::set_bb(::google::protobuf::int32 value) {
+  set_has_bb();
+  bb_ = value;
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestLazyLite.NestedMessage.bb)
+}
+
+// repeated string names = 2;
+int TestLazyLite_NestedMessage::names_size() const {
+  return names_.size();
+}
+void TestLazyLite_NestedMessage::clear_names() {
+  names_.Clear();
+}
+const ::std::string& TestLazyLite_NestedMessage::names(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestLazyLite.NestedMessage.names)
+  return names_.Get(index);
+}
+::std::string* TestLazyLite_NestedMessage::mutable_names(int index) {
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestLazyLite.NestedMessage.names)
+  return names_.Mutable(index);
+}
+void TestLazyLite_NestedMessage::set_names(int index, const ::std::string& value) {
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestLazyLite.NestedMessage.names)
+  names_.Mutable(index)->assign(value);
+}
+#if LANG_CXX11
+void TestLazyLite_NestedMessage::set_names(int index, ::std::string&& value) {
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestLazyLite.NestedMessage.names)
+  names_.Mutable(index)->assign(std::move(value));
+}
+#endif
+void TestLazyLite_NestedMessage::set_names(int index, const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  names_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:protobuf_unittest.TestLazyLite.NestedMessage.names)
+}
+void TestLazyLite_NestedMessage::set_names(int index, const char* value, size_t size) {
+  names_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:protobuf_unittest.TestLazyLite.NestedMessage.names)
+}
+::std::string* TestLazyLite_NestedMessage::add_names() {
+  // @@protoc_insertion_point(field_add_mutable:protobuf_unittest.TestLazyLite.NestedMessage.names)
+  return names_.Add();
+}
+void TestLazyLite_NestedMessage::add_names(const ::std::string& value) {
+  names_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestLazyLite.NestedMessage.names)
+}
+#if LANG_CXX11
+void TestLazyLite_NestedMessage::add_names(::std::string&& value) {
+  names_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestLazyLite.NestedMessage.names)
+}
+#endif
+void TestLazyLite_NestedMessage::add_names(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  names_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:protobuf_unittest.TestLazyLite.NestedMessage.names)
+}
+void TestLazyLite_NestedMessage::add_names(const char* value, size_t size) {
+  names_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:protobuf_unittest.TestLazyLite.NestedMessage.names)
+}
+const ::google::protobuf::RepeatedPtrField< ::std::string>&
+TestLazyLite_NestedMessage::names() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestLazyLite.NestedMessage.names)
+  return names_;
+}
+::google::protobuf::RepeatedPtrField< ::std::string>*
+TestLazyLite_NestedMessage::mutable_names() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestLazyLite.NestedMessage.names)
+  return &names_;
+}
+
+#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
+
+// ===================================================================
+
+void TestLazyLite::_slow_mutable_eager_message() {
+  eager_message_ = ::google::protobuf::Arena::CreateMessage< ::protobuf_unittest::TestLazyLite_NestedMessage >(
+      GetArenaNoVirtual());
+}
+::protobuf_unittest::TestLazyLite_NestedMessage* TestLazyLite::_slow_release_eager_message() {
+  if (eager_message_ == NULL) {
+    return NULL;
+  } else {
+    ::protobuf_unittest::TestLazyLite_NestedMessage* temp = new ::protobuf_unittest::TestLazyLite_NestedMessage(*eager_message_);
+    eager_message_ = NULL;
+    return temp;
+  }
+}
+::protobuf_unittest::TestLazyLite_NestedMessage* TestLazyLite::unsafe_arena_release_eager_message() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:protobuf_unittest.TestLazyLite.eager_message)
+  clear_has_eager_message();
+  ::protobuf_unittest::TestLazyLite_NestedMessage* temp = eager_message_;
+  eager_message_ = NULL;
+  return temp;
+}
+void TestLazyLite::_slow_set_allocated_eager_message(
+    ::google::protobuf::Arena* message_arena, ::protobuf_unittest::TestLazyLite_NestedMessage** eager_message) {
+    if (message_arena != NULL && 
+        ::google::protobuf::Arena::GetArena(*eager_message) == NULL) {
+      message_arena->Own(*eager_message);
+    } else if (message_arena !=
+               ::google::protobuf::Arena::GetArena(*eager_message)) {
+      ::protobuf_unittest::TestLazyLite_NestedMessage* new_eager_message = 
+            ::google::protobuf::Arena::CreateMessage< ::protobuf_unittest::TestLazyLite_NestedMessage >(
+            message_arena);
+      new_eager_message->CopyFrom(**eager_message);
+      *eager_message = new_eager_message;
+    }
+}
+void TestLazyLite::unsafe_arena_set_allocated_eager_message(
+    ::protobuf_unittest::TestLazyLite_NestedMessage* eager_message) {
+  if (GetArenaNoVirtual() == NULL) {
+    delete eager_message_;
+  }
+  eager_message_ = eager_message;
+  if (eager_message) {
+    set_has_eager_message();
+  } else {
+    clear_has_eager_message();
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protobuf_unittest.TestLazyLite.eager_message)
+}
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int TestLazyLite::kIdFieldNumber;
+const int TestLazyLite::kLazyMessageFieldNumber;
+const int TestLazyLite::kEagerMessageFieldNumber;
+const int TestLazyLite::kLazyChildFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+TestLazyLite::TestLazyLite()
+  : ::google::protobuf::MessageLite(), _internal_metadata_(NULL) {
+  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
+    protobuf_google_2fprotobuf_2funittest_5flazy_5flite_2eproto::InitDefaults();
+  }
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:protobuf_unittest.TestLazyLite)
+}
+TestLazyLite::TestLazyLite(::google::protobuf::Arena* arena)
+  : ::google::protobuf::MessageLite(),
+  _internal_metadata_(arena) {
+#ifdef GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  protobuf_google_2fprotobuf_2funittest_5flazy_5flite_2eproto::InitDefaults();
+#endif  // GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:protobuf_unittest.TestLazyLite)
+}
+TestLazyLite::TestLazyLite(const TestLazyLite& from)
+  : ::google::protobuf::MessageLite(),
+      _internal_metadata_(NULL),
+      _has_bits_(from._has_bits_),
+      _cached_size_(0) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  if (from.has_eager_message()) {
+    eager_message_ = new ::protobuf_unittest::TestLazyLite_NestedMessage(*from.eager_message_);
+  } else {
+    eager_message_ = NULL;
+  }
+  id_ = from.id_;
+  lazy_message_.Init();
+  if (from.has_lazy_message()) {
+    lazy_message_.MergeFrom(from.lazy_message_, *::protobuf_unittest::TestLazyLite_NestedMessage::internal_default_instance(), NULL);
+  }
+  lazy_child_.Init();
+  if (from.has_lazy_child()) {
+    lazy_child_.MergeFrom(from.lazy_child_, *::protobuf_unittest::TestLazyLite::internal_default_instance(), NULL);
+  }
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.TestLazyLite)
+}
+
+void TestLazyLite::SharedCtor() {
+  _cached_size_ = 0;
+  ::memset(&eager_message_, 0, reinterpret_cast<char*>(&id_) -
+    reinterpret_cast<char*>(&eager_message_) + sizeof(id_));
+  lazy_message_.Init();
+  lazy_child_.Init();
+}
+
+TestLazyLite::~TestLazyLite() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.TestLazyLite)
+  SharedDtor();
+}
+
+void TestLazyLite::SharedDtor() {
+  ::google::protobuf::Arena* arena = GetArenaNoVirtual();
+  if (arena != NULL) {
+    return;
+  }
+
+  if (this != internal_default_instance()) {
+    delete eager_message_;
+  }
+  lazy_message_.Destroy();
+  lazy_child_.Destroy();
+}
+
+void TestLazyLite::ArenaDtor(void* object) {
+  TestLazyLite* _this = reinterpret_cast< TestLazyLite* >(object);
+  (void)_this;
+}
+void TestLazyLite::RegisterArenaDtor(::google::protobuf::Arena* arena) {
+}
+void TestLazyLite::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const TestLazyLite& TestLazyLite::default_instance() {
+  protobuf_google_2fprotobuf_2funittest_5flazy_5flite_2eproto::InitDefaults();
+  return *internal_default_instance();
+}
+
+TestLazyLite* TestLazyLite::New(::google::protobuf::Arena* arena) const {
+  return ::google::protobuf::Arena::CreateMessage<TestLazyLite>(arena);
+}
+
+void TestLazyLite::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.TestLazyLite)
+  if (has_eager_message()) {
+    GOOGLE_DCHECK(eager_message_ != NULL);
+    eager_message_->::protobuf_unittest::TestLazyLite_NestedMessage::Clear();
+  }
+  if (_has_bits_[0 / 32] & 14u) {
+    id_ = 0;
+    if (has_lazy_message()) {
+      lazy_message_.Clear();
+    }
+    if (has_lazy_child()) {
+      lazy_child_.Clear();
+    }
+  }
+  _has_bits_.Clear();
+  _internal_metadata_.Clear();
+}
+
+bool TestLazyLite::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  ::google::protobuf::io::LazyStringOutputStream unknown_fields_string(
+      ::google::protobuf::NewPermanentCallback(&_internal_metadata_,
+          &::google::protobuf::internal::InternalMetadataWithArenaLite::
+              mutable_unknown_fields));
+  ::google::protobuf::io::CodedOutputStream unknown_fields_stream(
+      &unknown_fields_string, false);
+  // @@protoc_insertion_point(parse_start:protobuf_unittest.TestLazyLite)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(127u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // optional int32 id = 1;
+      case 1: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(8u)) {
+          set_has_id();
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, &id_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional .protobuf_unittest.TestLazyLite.NestedMessage lazy_message = 2 [lazy = true];
+      case 2: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(18u)) {
+          set_has_lazy_message();
+          DO_(lazy_message_.MergeFromCodedStream(
+              input, *::protobuf_unittest::TestLazyLite_NestedMessage::internal_default_instance(), GetArenaNoVirtual()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional .protobuf_unittest.TestLazyLite.NestedMessage eager_message = 3;
+      case 3: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(26u)) {
+          DO_(::google::protobuf::internal::WireFormatLite::ReadMessageNoVirtual(
+               input, mutable_eager_message()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // optional .protobuf_unittest.TestLazyLite lazy_child = 4 [lazy = true];
+      case 4: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(34u)) {
+          set_has_lazy_child();
+          DO_(lazy_child_.MergeFromCodedStream(
+              input, *::protobuf_unittest::TestLazyLite::internal_default_instance(), GetArenaNoVirtual()));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0 ||
+            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormatLite::SkipField(
+            input, tag, &unknown_fields_stream));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:protobuf_unittest.TestLazyLite)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:protobuf_unittest.TestLazyLite)
+  return false;
+#undef DO_
+}
+
+void TestLazyLite::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:protobuf_unittest.TestLazyLite)
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = _has_bits_[0];
+  // optional int32 id = 1;
+  if (cached_has_bits & 0x00000002u) {
+    ::google::protobuf::internal::WireFormatLite::WriteInt32(1, this->id(), output);
+  }
+
+  // optional .protobuf_unittest.TestLazyLite.NestedMessage lazy_message = 2 [lazy = true];
+  if (cached_has_bits & 0x00000004u) {
+    ::google::protobuf::internal::WireFormatLite::WriteTag(
+      2,
+      ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
+      output);
+    output->WriteVarint32(
+      static_cast< ::google::protobuf::uint32>(lazy_message_.GetCachedSize()));
+    lazy_message_.SerializeWithCachedSizes(output);
+  }
+
+  // optional .protobuf_unittest.TestLazyLite.NestedMessage eager_message = 3;
+  if (cached_has_bits & 0x00000001u) {
+    ::google::protobuf::internal::WireFormatLite::WriteMessage(
+      3, *this->eager_message_, output);
+  }
+
+  // optional .protobuf_unittest.TestLazyLite lazy_child = 4 [lazy = true];
+  if (cached_has_bits & 0x00000008u) {
+    ::google::protobuf::internal::WireFormatLite::WriteTag(
+      4,
+      ::google::protobuf::internal::WireFormatLite::WIRETYPE_LENGTH_DELIMITED,
+      output);
+    output->WriteVarint32(
+      static_cast< ::google::protobuf::uint32>(lazy_child_.GetCachedSize()));
+    lazy_child_.SerializeWithCachedSizes(output);
+  }
+
+  output->WriteRaw(unknown_fields().data(),
+                   static_cast<int>(unknown_fields().size()));
+  // @@protoc_insertion_point(serialize_end:protobuf_unittest.TestLazyLite)
+}
+
+size_t TestLazyLite::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.TestLazyLite)
+  size_t total_size = 0;
+
+  total_size += unknown_fields().size();
+
+  if (_has_bits_[0 / 32] & 15u) {
+    // optional .protobuf_unittest.TestLazyLite.NestedMessage eager_message = 3;
+    if (has_eager_message()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::MessageSizeNoVirtual(
+          *this->eager_message_);
+    }
+
+    // optional int32 id = 1;
+    if (has_id()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::Int32Size(
+          this->id());
+    }
+
+    // optional .protobuf_unittest.TestLazyLite.NestedMessage lazy_message = 2 [lazy = true];
+    if (has_lazy_message()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::LengthDelimitedSize(
+          lazy_message_.ByteSizeLong());
+    }
+
+    // optional .protobuf_unittest.TestLazyLite lazy_child = 4 [lazy = true];
+    if (has_lazy_child()) {
+      total_size += 1 +
+        ::google::protobuf::internal::WireFormatLite::LengthDelimitedSize(
+          lazy_child_.ByteSizeLong());
+    }
+
+  }
+  int cached_size = ::google::protobuf::internal::ToCachedSize(total_size);
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = cached_size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+  return total_size;
+}
+
+void TestLazyLite::CheckTypeAndMergeFrom(
+    const ::google::protobuf::MessageLite& from) {
+  MergeFrom(*::google::protobuf::down_cast<const TestLazyLite*>(&from));
+}
+
+void TestLazyLite::MergeFrom(const TestLazyLite& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.TestLazyLite)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._has_bits_[0];
+  if (cached_has_bits & 15u) {
+    if (cached_has_bits & 0x00000001u) {
+      mutable_eager_message()->::protobuf_unittest::TestLazyLite_NestedMessage::MergeFrom(from.eager_message());
+    }
+    if (cached_has_bits & 0x00000002u) {
+      id_ = from.id_;
+    }
+    if (cached_has_bits & 0x00000004u) {
+      set_has_lazy_message();
+      lazy_message_.MergeFrom(from.lazy_message_, *::protobuf_unittest::TestLazyLite_NestedMessage::internal_default_instance(), GetArenaNoVirtual());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      set_has_lazy_child();
+      lazy_child_.MergeFrom(from.lazy_child_, *::protobuf_unittest::TestLazyLite::internal_default_instance(), GetArenaNoVirtual());
+    }
+    _has_bits_[0] |= cached_has_bits;
+  }
+}
+
+void TestLazyLite::CopyFrom(const TestLazyLite& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.TestLazyLite)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TestLazyLite::IsInitialized() const {
+  return true;
+}
+
+void TestLazyLite::Swap(TestLazyLite* other) {
+  if (other == this) return;
+  if (GetArenaNoVirtual() == other->GetArenaNoVirtual()) {
+    InternalSwap(other);
+  } else {
+    TestLazyLite* temp = New(GetArenaNoVirtual());
+    temp->MergeFrom(*other);
+    other->CopyFrom(*this);
+    InternalSwap(temp);
+    if (GetArenaNoVirtual() == NULL) {
+      delete temp;
+    }
+  }
+}
+void TestLazyLite::UnsafeArenaSwap(TestLazyLite* other) {
+  if (other == this) return;
+  GOOGLE_DCHECK(GetArenaNoVirtual() == other->GetArenaNoVirtual());
+  InternalSwap(other);
+}
+void TestLazyLite::InternalSwap(TestLazyLite* other) {
+  std::swap(eager_message_, other->eager_message_);
+  std::swap(id_, other->id_);
+  lazy_message_.Swap(&other->lazy_message_);
+  lazy_child_.Swap(&other->lazy_child_);
+  std::swap(_has_bits_[0], other->_has_bits_[0]);
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  std::swap(_cached_size_, other->_cached_size_);
+}
+
+::std::string TestLazyLite::GetTypeName() const {
+  return "protobuf_unittest.TestLazyLite";
+}
+
+#if PROTOBUF_INLINE_NOT_IN_HEADERS
+// TestLazyLite
+
+// optional int32 id = 1;
+bool TestLazyLite::has_id() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
+}
+void TestLazyLite::set_has_id() {
+  _has_bits_[0] |= 0x00000002u;
+}
+void TestLazyLite::clear_has_id() {
+  _has_bits_[0] &= ~0x00000002u;
+}
+void TestLazyLite::clear_id() {
+  id_ = 0;
+  clear_has_id();
+}
+::google::protobuf::int32 TestLazyLite::id() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestLazyLite.id)
+  return id_;
+}
+void TestLazyLite::set_id(::google::protobuf::int32 value) {
+  set_has_id();
+  id_ = value;
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestLazyLite.id)
+}
+
+// optional .protobuf_unittest.TestLazyLite.NestedMessage lazy_message = 2 [lazy = true];
+bool TestLazyLite::has_lazy_message() const {
+  return (_has_bits_[0] & 0x00000004u) != 0;
+}
+void TestLazyLite::set_has_lazy_message() {
+  _has_bits_[0] |= 0x00000004u;
+}
+void TestLazyLite::clear_has_lazy_message() {
+  _has_bits_[0] &= ~0x00000004u;
+}
+void TestLazyLite::clear_lazy_message() {
+  lazy_message_.Clear();
+  clear_has_lazy_message();
+}
+const ::protobuf_unittest::TestLazyLite_NestedMessage& TestLazyLite::lazy_message() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestLazyLite.lazy_message)
+  return static_cast<const ::protobuf_unittest::TestLazyLite_NestedMessage&>(
+      lazy_message_.Get(*::protobuf_unittest::TestLazyLite_NestedMessage::internal_default_instance(), GetArenaNoVirtual()));
+}
+::protobuf_unittest::TestLazyLite_NestedMessage* TestLazyLite::mutable_lazy_message() {
+  set_has_lazy_message();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestLazyLite.lazy_message)
+  return static_cast<::protobuf_unittest::TestLazyLite_NestedMessage*>(
+      lazy_message_.Mutable(*::protobuf_unittest::TestLazyLite_NestedMessage::internal_default_instance(), GetArenaNoVirtual()));
+}
+::protobuf_unittest::TestLazyLite_NestedMessage* TestLazyLite::release_lazy_message() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestLazyLite.lazy_message)
+  clear_has_lazy_message();
+  return static_cast<::protobuf_unittest::TestLazyLite_NestedMessage*>(
+      lazy_message_.Release(*::protobuf_unittest::TestLazyLite_NestedMessage::internal_default_instance(), GetArenaNoVirtual()));
+}
+void TestLazyLite::set_allocated_lazy_message(::protobuf_unittest::TestLazyLite_NestedMessage* lazy_message) {
+  lazy_message_.SetAllocated(lazy_message, GetArenaNoVirtual());
+  if (lazy_message) {
+    set_has_lazy_message();
+  } else {
+    clear_has_lazy_message();
+  }
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestLazyLite.lazy_message)
+}
+::protobuf_unittest::TestLazyLite_NestedMessage* TestLazyLite::unsafe_arena_release_lazy_message() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:protobuf_unittest.TestLazyLite.lazy_message)
+  clear_has_lazy_message();
+  return static_cast<::protobuf_unittest::TestLazyLite_NestedMessage*>(
+      lazy_message_.UnsafeArenaRelease(*::protobuf_unittest::TestLazyLite_NestedMessage::internal_default_instance(), GetArenaNoVirtual()));
+}
+void TestLazyLite::unsafe_arena_set_allocated_lazy_message(
+    ::protobuf_unittest::TestLazyLite_NestedMessage* lazy_message) {
+  lazy_message_.UnsafeArenaSetAllocated(lazy_message, GetArenaNoVirtual());
+  if (lazy_message) {
+    set_has_lazy_message();
+  } else {
+    clear_has_lazy_message();
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protobuf_unittest.TestLazyLite.lazy_message)
+}
+
+// optional .protobuf_unittest.TestLazyLite.NestedMessage eager_message = 3;
+bool TestLazyLite::has_eager_message() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+void TestLazyLite::set_has_eager_message() {
+  _has_bits_[0] |= 0x00000001u;
+}
+void TestLazyLite::clear_has_eager_message() {
+  _has_bits_[0] &= ~0x00000001u;
+}
+void TestLazyLite::clear_eager_message() {
+  if (eager_message_ != NULL) eager_message_->::protobuf_unittest::TestLazyLite_NestedMessage::Clear();
+  clear_has_eager_message();
+}
+const ::protobuf_unittest::TestLazyLite_NestedMessage& TestLazyLite::eager_message() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestLazyLite.eager_message)
+  return eager_message_ != NULL ? *eager_message_
+                         : *::protobuf_unittest::TestLazyLite_NestedMessage::internal_default_instance();
+}
+::protobuf_unittest::TestLazyLite_NestedMessage* TestLazyLite::mutable_eager_message() {
+  set_has_eager_message();
+  if (eager_message_ == NULL) {
+    _slow_mutable_eager_message();
+  }
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestLazyLite.eager_message)
+  return eager_message_;
+}
+::protobuf_unittest::TestLazyLite_NestedMessage* TestLazyLite::release_eager_message() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestLazyLite.eager_message)
+  clear_has_eager_message();
+  if (GetArenaNoVirtual() != NULL) {
+    return _slow_release_eager_message();
+  } else {
+    ::protobuf_unittest::TestLazyLite_NestedMessage* temp = eager_message_;
+    eager_message_ = NULL;
+    return temp;
+  }
+}
+ void TestLazyLite::set_allocated_eager_message(::protobuf_unittest::TestLazyLite_NestedMessage* eager_message) {
+  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == NULL) {
+    delete eager_message_;
+  }
+  if (eager_message != NULL) {
+    _slow_set_allocated_eager_message(message_arena, &eager_message);
+  }
+  eager_message_ = eager_message;
+  if (eager_message) {
+    set_has_eager_message();
+  } else {
+    clear_has_eager_message();
+  }
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestLazyLite.eager_message)
+}
+
+// optional .protobuf_unittest.TestLazyLite lazy_child = 4 [lazy = true];
+bool TestLazyLite::has_lazy_child() const {
+  return (_has_bits_[0] & 0x00000008u) != 0;
+}
+void TestLazyLite::set_has_lazy_child() {
+  _has_bits_[0] |= 0x00000008u;
+}
+void TestLazyLite::clear_has_lazy_child() {
+  _has_bits_[0] &= ~0x00000008u;
+}
+void TestLazyLite::clear_lazy_child() {
+  lazy_child_.Clear();
+  clear_has_lazy_child();
+}
+const ::protobuf_unittest::TestLazyLite& TestLazyLite::lazy_child() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestLazyLite.lazy_child)
+  return static_cast<const ::protobuf_unittest::TestLazyLite&>(
+      lazy_child_.Get(*::protobuf_unittest::TestLazyLite::internal_default_instance(), GetArenaNoVirtual()));
+}
+::protobuf_unittest::TestLazyLite* TestLazyLite::mutable_lazy_child() {
+  set_has_lazy_child();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestLazyLite.lazy_child)
+  return static_cast<::protobuf_unittest::TestLazyLite*>(
+      lazy_child_.Mutable(*::protobuf_unittest::TestLazyLite::internal_default_instance(), GetArenaNoVirtual()));
+}
+::protobuf_unittest::TestLazyLite* TestLazyLite::release_lazy_child() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestLazyLite.lazy_child)
+  clear_has_lazy_child();
+  return static_cast<::protobuf_unittest::TestLazyLite*>(
+      lazy_child_.Release(*::protobuf_unittest::TestLazyLite::internal_default_instance(), GetArenaNoVirtual()));
+}
+void TestLazyLite::set_allocated_lazy_child(::protobuf_unittest::TestLazyLite* lazy_child) {
+  lazy_child_.SetAllocated(lazy_child, GetArenaNoVirtual());
+  if (lazy_child) {
+    set_has_lazy_child();
+  } else {
+    clear_has_lazy_child();
+  }
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestLazyLite.lazy_child)
+}
+::protobuf_unittest::TestLazyLite* TestLazyLite::unsafe_arena_release_lazy_child() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:protobuf_unittest.TestLazyLite.lazy_child)
+  clear_has_lazy_child();
+  return static_cast<::protobuf_unittest::TestLazyLite*>(
+      lazy_child_.UnsafeArenaRelease(*::protobuf_unittest::TestLazyLite::internal_default_instance(), GetArenaNoVirtual()));
+}
+void TestLazyLite::unsafe_arena_set_allocated_lazy_child(
+    ::protobuf_unittest::TestLazyLite* lazy_child) {
+  lazy_child_.UnsafeArenaSetAllocated(lazy_child, GetArenaNoVirtual());
+  if (lazy_child) {
+    set_has_lazy_child();
+  } else {
+    clear_has_lazy_child();
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protobuf_unittest.TestLazyLite.lazy_child)
+}
+
+#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace protobuf_unittest
+
+// @@protoc_insertion_point(global_scope)
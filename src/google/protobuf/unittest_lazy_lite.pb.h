@@ -0,0 +1,653 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: google/protobuf/unittest_lazy_lite.proto
+
+#ifndef PROTOBUF_google_2fprotobuf_2funittest_5flazy_5flite_2eproto__INCLUDED
+#define PROTOBUF_google_2fprotobuf_2funittest_5flazy_5flite_2eproto__INCLUDED
+
+#include <string>
+
+#include <google/protobuf/stubs/common.h>
+
+#if GOOGLE_PROTOBUF_VERSION < 3003000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers.  Please update
+#error your headers.
+#endif
+#if 3003000 < GOOGLE_PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers.  Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_table_driven.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/message_lite.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/lazy_field.h>
+// @@protoc_insertion_point(includes)
+namespace protobuf_unittest {
+class TestLazyLite;
+class TestLazyLiteDefaultTypeInternal;
+extern TestLazyLiteDefaultTypeInternal _TestLazyLite_default_instance_;
+class TestLazyLite_NestedMessage;
+class TestLazyLite_NestedMessageDefaultTypeInternal;
+extern TestLazyLite_NestedMessageDefaultTypeInternal _TestLazyLite_NestedMessage_default_instance_;
+}  // namespace protobuf_unittest
+
+namespace protobuf_unittest {
+
+namespace protobuf_google_2fprotobuf_2funittest_5flazy_5flite_2eproto {
+// Internal implementation detail -- do not call these.
+struct TableStruct {
+  static const ::google::protobuf::internal::ParseTableField entries[];
+  static const ::google::protobuf::internal::AuxillaryParseTableField aux[];
+  static const ::google::protobuf::internal::ParseTable schema[];
+  static const ::google::protobuf::uint32 offsets[];
+  static void InitDefaultsImpl();
+  static void Shutdown();
+};
+void AddDescriptors();
+void InitDefaults();
+}  // namespace protobuf_google_2fprotobuf_2funittest_5flazy_5flite_2eproto
+
+// ===================================================================
+
+class TestLazyLite_NestedMessage : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:protobuf_unittest.TestLazyLite.NestedMessage) */ {
+ public:
+  TestLazyLite_NestedMessage();
+  virtual ~TestLazyLite_NestedMessage();
+
+  TestLazyLite_NestedMessage(const TestLazyLite_NestedMessage& from);
+
+  inline TestLazyLite_NestedMessage& operator=(const TestLazyLite_NestedMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+
+  inline const ::std::string& unknown_fields() const {
+    return _internal_metadata_.unknown_fields();
+  }
+
+  inline ::std::string* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields();
+  }
+
+  inline ::google::protobuf::Arena* GetArena() const PROTOBUF_FINAL {
+    return GetArenaNoVirtual();
+  }
+  inline void* GetMaybeArenaPointer() const PROTOBUF_FINAL {
+    return MaybeArenaPtr();
+  }
+  static const TestLazyLite_NestedMessage& default_instance();
+
+  static inline const TestLazyLite_NestedMessage* internal_default_instance() {
+    return reinterpret_cast<const TestLazyLite_NestedMessage*>(
+               &_TestLazyLite_NestedMessage_default_instance_);
+  }
+  static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
+    0;
+
+  void UnsafeArenaSwap(TestLazyLite_NestedMessage* other);
+  void Swap(TestLazyLite_NestedMessage* other);
+
+  // implements Message ----------------------------------------------
+
+  inline TestLazyLite_NestedMessage* New() const PROTOBUF_FINAL { return New(NULL); }
+
+  TestLazyLite_NestedMessage* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
+  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)
+    PROTOBUF_FINAL;
+  void CopyFrom(const TestLazyLite_NestedMessage& from);
+  void MergeFrom(const TestLazyLite_NestedMessage& from);
+  void Clear() PROTOBUF_FINAL;
+  bool IsInitialized() const PROTOBUF_FINAL;
+
+  size_t ByteSizeLong() const PROTOBUF_FINAL;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
+  void DiscardUnknownFields();
+  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(TestLazyLite_NestedMessage* other);
+  protected:
+  explicit TestLazyLite_NestedMessage(::google::protobuf::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::google::protobuf::Arena* arena);
+  private:
+  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
+    return _internal_metadata_.arena();
+  }
+  inline void* MaybeArenaPtr() const {
+    return _internal_metadata_.raw_arena_ptr();
+  }
+  public:
+
+  ::std::string GetTypeName() const PROTOBUF_FINAL;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // repeated string names = 2;
+  int names_size() const;
+  void clear_names();
+  static const int kNamesFieldNumber = 2;
+  const ::std::string& names(int index) const;
+  ::std::string* mutable_names(int index);
+  void set_names(int index, const ::std::string& value);
+  #if LANG_CXX11
+  void set_names(int index, ::std::string&& value);
+  #endif
+  void set_names(int index, const char* value);
+  void set_names(int index, const char* value, size_t size);
+  ::std::string* add_names();
+  void add_names(const ::std::string& value);
+  #if LANG_CXX11
+  void add_names(::std::string&& value);
+  #endif
+  void add_names(const char* value);
+  void add_names(const char* value, size_t size);
+  const ::google::protobuf::RepeatedPtrField< ::std::string>& names() const;
+  ::google::protobuf::RepeatedPtrField< ::std::string>* mutable_names();
+
+  // optional int32 bb = 1;
+  bool has_bb() const;
+  void clear_bb();
+  static const int kBbFieldNumber = 1;
+  ::google::protobuf::int32 bb() const;
+  void set_bb(::google::protobuf::int32 value);
+
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TestLazyLite.NestedMessage)
+ private:
+  void set_has_bb();
+  void clear_has_bb();
+
+  ::google::protobuf::internal::InternalMetadataWithArenaLite _internal_metadata_;
+  friend class ::google::protobuf::Arena;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::google::protobuf::internal::HasBits<1> _has_bits_;
+  mutable int _cached_size_;
+  ::google::protobuf::RepeatedPtrField< ::std::string> names_;
+  ::google::protobuf::int32 bb_;
+  friend struct protobuf_google_2fprotobuf_2funittest_5flazy_5flite_2eproto::TableStruct;
+};
+// -------------------------------------------------------------------
+
+class TestLazyLite : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:protobuf_unittest.TestLazyLite) */ {
+ public:
+  TestLazyLite();
+  virtual ~TestLazyLite();
+
+  TestLazyLite(const TestLazyLite& from);
+
+  inline TestLazyLite& operator=(const TestLazyLite& from) {
+    CopyFrom(from);
+    return *this;
+  }
+
+  inline const ::std::string& unknown_fields() const {
+    return _internal_metadata_.unknown_fields();
+  }
+
+  inline ::std::string* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields();
+  }
+
+  inline ::google::protobuf::Arena* GetArena() const PROTOBUF_FINAL {
+    return GetArenaNoVirtual();
+  }
+  inline void* GetMaybeArenaPointer() const PROTOBUF_FINAL {
+    return MaybeArenaPtr();
+  }
+  static const TestLazyLite& default_instance();
+
+  static inline const TestLazyLite* internal_default_instance() {
+    return reinterpret_cast<const TestLazyLite*>(
+               &_TestLazyLite_default_instance_);
+  }
+  static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
+    1;
+
+  void UnsafeArenaSwap(TestLazyLite* other);
+  void Swap(TestLazyLite* other);
+
+  // implements Message ----------------------------------------------
+
+  inline TestLazyLite* New() const PROTOBUF_FINAL { return New(NULL); }
+
+  TestLazyLite* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
+  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)
+    PROTOBUF_FINAL;
+  void CopyFrom(const TestLazyLite& from);
+  void MergeFrom(const TestLazyLite& from);
+  void Clear() PROTOBUF_FINAL;
+  bool IsInitialized() const PROTOBUF_FINAL;
+
+  size_t ByteSizeLong() const PROTOBUF_FINAL;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
+  void DiscardUnknownFields();
+  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(TestLazyLite* other);
+  protected:
+  explicit TestLazyLite(::google::protobuf::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::google::protobuf::Arena* arena);
+  private:
+  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
+    return _internal_metadata_.arena();
+  }
+  inline void* MaybeArenaPtr() const {
+    return _internal_metadata_.raw_arena_ptr();
+  }
+  public:
+
+  ::std::string GetTypeName() const PROTOBUF_FINAL;
+
+  // nested types ----------------------------------------------------
+
+  typedef TestLazyLite_NestedMessage NestedMessage;
+
+  // accessors -------------------------------------------------------
+
+  // optional .protobuf_unittest.TestLazyLite.NestedMessage eager_message = 3;
+  bool has_eager_message() const;
+  void clear_eager_message();
+  static const int kEagerMessageFieldNumber = 3;
+  private:
+  void _slow_mutable_eager_message();
+  void _slow_set_allocated_eager_message(
+      ::google::protobuf::Arena* message_arena, ::protobuf_unittest::TestLazyLite_NestedMessage** eager_message);
+  ::protobuf_unittest::TestLazyLite_NestedMessage* _slow_release_eager_message();
+  public:
+  const ::protobuf_unittest::TestLazyLite_NestedMessage& eager_message() const;
+  ::protobuf_unittest::TestLazyLite_NestedMessage* mutable_eager_message();
+  ::protobuf_unittest::TestLazyLite_NestedMessage* release_eager_message();
+  void set_allocated_eager_message(::protobuf_unittest::TestLazyLite_NestedMessage* eager_message);
+  ::protobuf_unittest::TestLazyLite_NestedMessage* unsafe_arena_release_eager_message();
+  void unsafe_arena_set_allocated_eager_message(
+      ::protobuf_unittest::TestLazyLite_NestedMessage* eager_message);
+
+  // optional int32 id = 1;
+  bool has_id() const;
+  void clear_id();
+  static const int kIdFieldNumber = 1;
+  ::google::protobuf::int32 id() const;
+  void set_id(::google::protobuf::int32 value);
+
+  // optional .protobuf_unittest.TestLazyLite.NestedMessage lazy_message = 2 [lazy = true];
+  bool has_lazy_message() const;
+  void clear_lazy_message();
+  static const int kLazyMessageFieldNumber = 2;
+  const ::protobuf_unittest::TestLazyLite_NestedMessage& lazy_message() const;
+  ::protobuf_unittest::TestLazyLite_NestedMessage* mutable_lazy_message();
+  ::protobuf_unittest::TestLazyLite_NestedMessage* release_lazy_message();
+  void set_allocated_lazy_message(::protobuf_unittest::TestLazyLite_NestedMessage* lazy_message);
+  ::protobuf_unittest::TestLazyLite_NestedMessage* unsafe_arena_release_lazy_message();
+  void unsafe_arena_set_allocated_lazy_message(
+      ::protobuf_unittest::TestLazyLite_NestedMessage* lazy_message);
+
+  // optional .protobuf_unittest.TestLazyLite lazy_child = 4 [lazy = true];
+  bool has_lazy_child() const;
+  void clear_lazy_child();
+  static const int kLazyChildFieldNumber = 4;
+  const ::protobuf_unittest::TestLazyLite& lazy_child() const;
+  ::protobuf_unittest::TestLazyLite* mutable_lazy_child();
+  ::protobuf_unittest::TestLazyLite* release_lazy_child();
+  void set_allocated_lazy_child(::protobuf_unittest::TestLazyLite* lazy_child);
+  ::protobuf_unittest::TestLazyLite* unsafe_arena_release_lazy_child();
+  void unsafe_arena_set_allocated_lazy_child(
+      ::protobuf_unittest::TestLazyLite* lazy_child);
+
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TestLazyLite)
+ private:
+  void set_has_id();
+  void clear_has_id();
+  void set_has_lazy_message();
+  void clear_has_lazy_message();
+  void set_has_eager_message();
+  void clear_has_eager_message();
+  void set_has_lazy_child();
+  void clear_has_lazy_child();
+
+  ::google::protobuf::internal::InternalMetadataWithArenaLite _internal_metadata_;
+  friend class ::google::protobuf::Arena;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::google::protobuf::internal::HasBits<1> _has_bits_;
+  mutable int _cached_size_;
+  ::protobuf_unittest::TestLazyLite_NestedMessage* eager_message_;
+  ::google::protobuf::int32 id_;
+  ::google::protobuf::internal::LazyField lazy_message_;
+  ::google::protobuf::internal::LazyField lazy_child_;
+  friend struct protobuf_google_2fprotobuf_2funittest_5flazy_5flite_2eproto::TableStruct;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#if !PROTOBUF_INLINE_NOT_IN_HEADERS
+// TestLazyLite_NestedMessage
+
+// optional int32 bb = 1;
+inline bool TestLazyLite_NestedMessage::has_bb() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void TestLazyLite_NestedMessage::set_has_bb() {
+  _has_bits_[0] |= 0x00000001u;
+}
+inline void TestLazyLite_NestedMessage::clear_has_bb() {
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline void TestLazyLite_NestedMessage::clear_bb() {
+  bb_ = 0;
+  clear_has_bb();
+}
+inline ::google::protobuf::int32 TestLazyLite_NestedMessage::bb() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestLazyLite.NestedMessage.bb)
+  return bb_;
+}
+inline void TestLazyLite_NestedMessage::set_bb(::google::protobuf::int32 value) {
+  set_has_bb();
+  bb_ = value;
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestLazyLite.NestedMessage.bb)
+}
+
+// repeated string names = 2;
+inline int TestLazyLite_NestedMessage::names_size() const {
+  return names_.size();
+}
+inline void TestLazyLite_NestedMessage::clear_names() {
+  names_.Clear();
+}
+inline const ::std::string& TestLazyLite_NestedMessage::names(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestLazyLite.NestedMessage.names)
+  return names_.Get(index);
+}
+inline ::std::string* TestLazyLite_NestedMessage::mutable_names(int index) {
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestLazyLite.NestedMessage.names)
+  return names_.Mutable(index);
+}
+inline void TestLazyLite_NestedMessage::set_names(int index, const ::std::string& value) {
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestLazyLite.NestedMessage.names)
+  names_.Mutable(index)->assign(value);
+}
+#if LANG_CXX11
+inline void TestLazyLite_NestedMessage::set_names(int index, ::std::string&& value) {
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestLazyLite.NestedMessage.names)
+  names_.Mutable(index)->assign(std::move(value));
+}
+#endif
+inline void TestLazyLite_NestedMessage::set_names(int index, const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  names_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:protobuf_unittest.TestLazyLite.NestedMessage.names)
+}
+inline void TestLazyLite_NestedMessage::set_names(int index, const char* value, size_t size) {
+  names_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:protobuf_unittest.TestLazyLite.NestedMessage.names)
+}
+inline ::std::string* TestLazyLite_NestedMessage::add_names() {
+  // @@protoc_insertion_point(field_add_mutable:protobuf_unittest.TestLazyLite.NestedMessage.names)
+  return names_.Add();
+}
+inline void TestLazyLite_NestedMessage::add_names(const ::std::string& value) {
+  names_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestLazyLite.NestedMessage.names)
+}
+#if LANG_CXX11
+inline void TestLazyLite_NestedMessage::add_names(::std::string&& value) {
+  names_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestLazyLite.NestedMessage.names)
+}
+#endif
+inline void TestLazyLite_NestedMessage::add_names(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  names_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:protobuf_unittest.TestLazyLite.NestedMessage.names)
+}
+inline void TestLazyLite_NestedMessage::add_names(const char* value, size_t size) {
+  names_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:protobuf_unittest.TestLazyLite.NestedMessage.names)
+}
+inline const ::google::protobuf::RepeatedPtrField< ::std::string>&
+TestLazyLite_NestedMessage::names() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestLazyLite.NestedMessage.names)
+  return names_;
+}
+inline ::google::protobuf::RepeatedPtrField< ::std::string>*
+TestLazyLite_NestedMessage::mutable_names() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestLazyLite.NestedMessage.names)
+  return &names_;
+}
+
+// -------------------------------------------------------------------
+
+// TestLazyLite
+
+// optional int32 id = 1;
+inline bool TestLazyLite::has_id() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
+}
+inline void TestLazyLite::set_has_id() {
+  _has_bits_[0] |= 0x00000002u;
+}
+inline void TestLazyLite::clear_has_id() {
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline void TestLazyLite::clear_id() {
+  id_ = 0;
+  clear_has_id();
+}
+inline ::google::protobuf::int32 TestLazyLite::id() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestLazyLite.id)
+  return id_;
+}
+inline void TestLazyLite::set_id(::google::protobuf::int32 value) {
+  set_has_id();
+  id_ = value;
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestLazyLite.id)
+}
+
+// optional .protobuf_unittest.TestLazyLite.NestedMessage lazy_message = 2 [lazy = true];
+inline bool TestLazyLite::has_lazy_message() const {
+  return (_has_bits_[0] & 0x00000004u) != 0;
+}
+inline void TestLazyLite::set_has_lazy_message() {
+  _has_bits_[0] |= 0x00000004u;
+}
+inline void TestLazyLite::clear_has_lazy_message() {
+  _has_bits_[0] &= ~0x00000004u;
+}
+inline void TestLazyLite::clear_lazy_message() {
+  lazy_message_.Clear();
+  clear_has_lazy_message();
+}
+inline const ::protobuf_unittest::TestLazyLite_NestedMessage& TestLazyLite::lazy_message() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestLazyLite.lazy_message)
+  return static_cast<const ::protobuf_unittest::TestLazyLite_NestedMessage&>(
+      lazy_message_.Get(*::protobuf_unittest::TestLazyLite_NestedMessage::internal_default_instance(), GetArenaNoVirtual()));
+}
+inline ::protobuf_unittest::TestLazyLite_NestedMessage* TestLazyLite::mutable_lazy_message() {
+  set_has_lazy_message();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestLazyLite.lazy_message)
+  return static_cast<::protobuf_unittest::TestLazyLite_NestedMessage*>(
+      lazy_message_.Mutable(*::protobuf_unittest::TestLazyLite_NestedMessage::internal_default_instance(), GetArenaNoVirtual()));
+}
+inline ::protobuf_unittest::TestLazyLite_NestedMessage* TestLazyLite::release_lazy_message() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestLazyLite.lazy_message)
+  clear_has_lazy_message();
+  return static_cast<::protobuf_unittest::TestLazyLite_NestedMessage*>(
+      lazy_message_.Release(*::protobuf_unittest::TestLazyLite_NestedMessage::internal_default_instance(), GetArenaNoVirtual()));
+}
+inline void TestLazyLite::set_allocated_lazy_message(::protobuf_unittest::TestLazyLite_NestedMessage* lazy_message) {
+  lazy_message_.SetAllocated(lazy_message, GetArenaNoVirtual());
+  if (lazy_message) {
+    set_has_lazy_message();
+  } else {
+    clear_has_lazy_message();
+  }
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestLazyLite.lazy_message)
+}
+inline ::protobuf_unittest::TestLazyLite_NestedMessage* TestLazyLite::unsafe_arena_release_lazy_message() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:protobuf_unittest.TestLazyLite.lazy_message)
+  clear_has_lazy_message();
+  return static_cast<::protobuf_unittest::TestLazyLite_NestedMessage*>(
+      lazy_message_.UnsafeArenaRelease(*::protobuf_unittest::TestLazyLite_NestedMessage::internal_default_instance(), GetArenaNoVirtual()));
+}
+inline void TestLazyLite::unsafe_arena_set_allocated_lazy_message(
+    ::protobuf_unittest::TestLazyLite_NestedMessage* lazy_message) {
+  lazy_message_.UnsafeArenaSetAllocated(lazy_message, GetArenaNoVirtual());
+  if (lazy_message) {
+    set_has_lazy_message();
+  } else {
+    clear_has_lazy_message();
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protobuf_unittest.TestLazyLite.lazy_message)
+}
+
+// optional .protobuf_unittest.TestLazyLite.NestedMessage eager_message = 3;
+inline bool TestLazyLite::has_eager_message() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void TestLazyLite::set_has_eager_message() {
+  _has_bits_[0] |= 0x00000001u;
+}
+inline void TestLazyLite::clear_has_eager_message() {
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline void TestLazyLite::clear_eager_message() {
+  if (eager_message_ != NULL) eager_message_->::protobuf_unittest::TestLazyLite_NestedMessage::Clear();
+  clear_has_eager_message();
+}
+inline const ::protobuf_unittest::TestLazyLite_NestedMessage& TestLazyLite::eager_message() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestLazyLite.eager_message)
+  return eager_message_ != NULL ? *eager_message_
+                         : *::protobuf_unittest::TestLazyLite_NestedMessage::internal_default_instance();
+}
+inline ::protobuf_unittest::TestLazyLite_NestedMessage* TestLazyLite::mutable_eager_message() {
+  set_has_eager_message();
+  if (eager_message_ == NULL) {
+    _slow_mutable_eager_message();
+  }
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestLazyLite.eager_message)
+  return eager_message_;
+}
+inline ::protobuf_unittest::TestLazyLite_NestedMessage* TestLazyLite::release_eager_message() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestLazyLite.eager_message)
+  clear_has_eager_message();
+  if (GetArenaNoVirtual() != NULL) {
+    return _slow_release_eager_message();
+  } else {
+    ::protobuf_unittest::TestLazyLite_NestedMessage* temp = eager_message_;
+    eager_message_ = NULL;
+    return temp;
+  }
+}
+inline  void TestLazyLite::set_allocated_eager_message(::protobuf_unittest::TestLazyLite_NestedMessage* eager_message) {
+  ::google::protobuf::Arena* message_arena = GetArenaNoVirtual();
+  if (message_arena == NULL) {
+    delete eager_message_;
+  }
+  if (eager_message != NULL) {
+    _slow_set_allocated_eager_message(message_arena, &eager_message);
+  }
+  eager_message_ = eager_message;
+  if (eager_message) {
+    set_has_eager_message();
+  } else {
+    clear_has_eager_message();
+  }
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestLazyLite.eager_message)
+}
+
+// optional .protobuf_unittest.TestLazyLite lazy_child = 4 [lazy = true];
+inline bool TestLazyLite::has_lazy_child() const {
+  return (_has_bits_[0] & 0x00000008u) != 0;
+}
+inline void TestLazyLite::set_has_lazy_child() {
+  _has_bits_[0] |= 0x00000008u;
+}
+inline void TestLazyLite::clear_has_lazy_child() {
+  _has_bits_[0] &= ~0x00000008u;
+}
+inline void TestLazyLite::clear_lazy_child() {
+  lazy_child_.Clear();
+  clear_has_lazy_child();
+}
+inline const ::protobuf_unittest::TestLazyLite& TestLazyLite::lazy_child() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestLazyLite.lazy_child)
+  return static_cast<const ::protobuf_unittest::TestLazyLite&>(
+      lazy_child_.Get(*::protobuf_unittest::TestLazyLite::internal_default_instance(), GetArenaNoVirtual()));
+}
+inline ::protobuf_unittest::TestLazyLite* TestLazyLite::mutable_lazy_child() {
+  set_has_lazy_child();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestLazyLite.lazy_child)
+  return static_cast<::protobuf_unittest::TestLazyLite*>(
+      lazy_child_.Mutable(*::protobuf_unittest::TestLazyLite::internal_default_instance(), GetArenaNoVirtual()));
+}
+inline ::protobuf_unittest::TestLazyLite* TestLazyLite::release_lazy_child() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestLazyLite.lazy_child)
+  clear_has_lazy_child();
+  return static_cast<::protobuf_unittest::TestLazyLite*>(
+      lazy_child_.Release(*::protobuf_unittest::TestLazyLite::internal_default_instance(), GetArenaNoVirtual()));
+}
+inline void TestLazyLite::set_allocated_lazy_child(::protobuf_unittest::TestLazyLite* lazy_child) {
+  lazy_child_.SetAllocated(lazy_child, GetArenaNoVirtual());
+  if (lazy_child) {
+    set_has_lazy_child();
+  } else {
+    clear_has_lazy_child();
+  }
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestLazyLite.lazy_child)
+}
+inline ::protobuf_unittest::TestLazyLite* TestLazyLite::unsafe_arena_release_lazy_child() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:protobuf_unittest.TestLazyLite.lazy_child)
+  clear_has_lazy_child();
+  return static_cast<::protobuf_unittest::TestLazyLite*>(
+      lazy_child_.UnsafeArenaRelease(*::protobuf_unittest::TestLazyLite::internal_default_instance(), GetArenaNoVirtual()));
+}
+inline void TestLazyLite::unsafe_arena_set_allocated_lazy_child(
+    ::protobuf_unittest::TestLazyLite* lazy_child) {
+  lazy_child_.UnsafeArenaSetAllocated(lazy_child, GetArenaNoVirtual());
+  if (lazy_child) {
+    set_has_lazy_child();
+  } else {
+    clear_has_lazy_child();
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:protobuf_unittest.TestLazyLite.lazy_child)
+}
+
+#endif  // !PROTOBUF_INLINE_NOT_IN_HEADERS
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+
+}  // namespace protobuf_unittest
+
+// @@protoc_insertion_point(global_scope)
+
+#endif  // PROTOBUF_google_2fprotobuf_2funittest_5flazy_5flite_2eproto__INCLUDED
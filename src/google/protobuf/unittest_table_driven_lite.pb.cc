@@ -0,0 +1,5067 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: google/protobuf/unittest_table_driven_lite.proto
+
+#define INTERNAL_SUPPRESS_PROTOBUF_FIELD_DEPRECATION
+#include <google/protobuf/unittest_table_driven_lite.pb.h>
+
+#include <algorithm>
+
+#include <google/protobuf/stubs/common.h>
+#include <google/protobuf/stubs/port.h>
+#include <google/protobuf/stubs/once.h>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/wire_format_lite_inl.h>
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
+// @@protoc_insertion_point(includes)
+
+namespace protobuf_unittest {
+class TestTableDrivenLite_NestedMessageDefaultTypeInternal : public ::google::protobuf::internal::ExplicitlyConstructed<TestTableDrivenLite_NestedMessage> {
+} _TestTableDrivenLite_NestedMessage_default_instance_;
+class TestTableDrivenLite_OptionalGroupDefaultTypeInternal : public ::google::protobuf::internal::ExplicitlyConstructed<TestTableDrivenLite_OptionalGroup> {
+} _TestTableDrivenLite_OptionalGroup_default_instance_;
+class TestTableDrivenLite_RepeatedGroupDefaultTypeInternal : public ::google::protobuf::internal::ExplicitlyConstructed<TestTableDrivenLite_RepeatedGroup> {
+} _TestTableDrivenLite_RepeatedGroup_default_instance_;
+class TestTableDrivenLiteDefaultTypeInternal : public ::google::protobuf::internal::ExplicitlyConstructed<TestTableDrivenLite> {
+} _TestTableDrivenLite_default_instance_;
+class TestPackedTableDrivenLiteDefaultTypeInternal : public ::google::protobuf::internal::ExplicitlyConstructed<TestPackedTableDrivenLite> {
+} _TestPackedTableDrivenLite_default_instance_;
+class TestRepeatedTableDrivenLiteDefaultTypeInternal : public ::google::protobuf::internal::ExplicitlyConstructed<TestRepeatedTableDrivenLite> {
+} _TestRepeatedTableDrivenLite_default_instance_;
+
+namespace protobuf_google_2fprotobuf_2funittest_5ftable_5fdriven_5flite_2eproto {
+
+PROTOBUF_CONSTEXPR_VAR ::google::protobuf::internal::ParseTableField
+    const TableStruct::entries[] = {
+  {0, 0, 0, ::google::protobuf::internal::kInvalidMask, 0, 0},
+  {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+      TestTableDrivenLite_NestedMessage, bb_),
+    static_cast< ::google::protobuf::uint32>(1),
+    0, 16, 5, 1
+  },
+  {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+      TestTableDrivenLite_NestedMessage, cc_),
+    static_cast< ::google::protobuf::uint32>(0),
+    0, 16, 3, 1
+  },
+  {0, 0, 0, ::google::protobuf::internal::kInvalidMask, 0, 0},
+  {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+      TestTableDrivenLite, optional_int32_),
+    static_cast< ::google::protobuf::uint32>(6),
+    0, 16, 5, 1
+  },
+  {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+      TestTableDrivenLite, optional_int64_),
+    static_cast< ::google::protobuf::uint32>(5),
+    0, 16, 3, 1
+  },
+  {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+      TestTableDrivenLite, optional_uint32_),
+    static_cast< ::google::protobuf::uint32>(7),
+    0, 16, 13, 1
+  },
+  {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+      TestTableDrivenLite, optional_uint64_),
+    static_cast< ::google::protobuf::uint32>(8),
+    0, 16, 4, 1
+  },
+  {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+      TestTableDrivenLite, optional_sint32_),
+    static_cast< ::google::protobuf::uint32>(10),
+    0, 16, 17, 1
+  },
+  {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+      TestTableDrivenLite, optional_sint64_),
+    static_cast< ::google::protobuf::uint32>(9),
+    0, 16, 18, 1
+  },
+  {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+      TestTableDrivenLite, optional_fixed32_),
+    static_cast< ::google::protobuf::uint32>(11),
+    5, 16, 7, 1
+  },
+  {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+      TestTableDrivenLite, optional_fixed64_),
+    static_cast< ::google::protobuf::uint32>(12),
+    1, 16, 6, 1
+  },
+  {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+      TestTableDrivenLite, optional_sfixed32_),
+    static_cast< ::google::protobuf::uint32>(14),
+    5, 16, 15, 1
+  },
+  {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+      TestTableDrivenLite, optional_sfixed64_),
+    static_cast< ::google::protobuf::uint32>(13),
+    1, 16, 16, 1
+  },
+  {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+      TestTableDrivenLite, optional_float_),
+    static_cast< ::google::protobuf::uint32>(15),
+    5, 16, 2, 1
+  },
+  {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+      TestTableDrivenLite, optional_double_),
+    static_cast< ::google::protobuf::uint32>(16),
+    1, 16, 1, 1
+  },
+  {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+      TestTableDrivenLite, optional_bool_),
+    static_cast< ::google::protobuf::uint32>(17),
+    0, 16, 8, 1
+  },
+  {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+      TestTableDrivenLite, optional_string_),
+    static_cast< ::google::protobuf::uint32>(0),
+    2, 16, 9, 1
+  },
+  {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+      TestTableDrivenLite, optional_bytes_),
+    static_cast< ::google::protobuf::uint32>(1),
+    2, 16, 12, 1
+  },
+  {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+      TestTableDrivenLite, optionalgroup_),
+    static_cast< ::google::protobuf::uint32>(2),
+    3, 16, 10, 4
+  },
+  { 0, 0, ::google::protobuf::internal::kInvalidMask,
+    ::google::protobuf::internal::kInvalidMask, 0, 0 },
+  {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+      TestTableDrivenLite, optional_nested_message_),
+    static_cast< ::google::protobuf::uint32>(3),
+    2, 16, 11, 2
+  },
+  {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+      TestTableDrivenLite, optional_foreign_message_),
+    static_cast< ::google::protobuf::uint32>(4),
+    2, 16, 11, 2
+  },
+  { 0, 0, ::google::protobuf::internal::kInvalidMask,
+    ::google::protobuf::internal::kInvalidMask, 0, 0 },
+  {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+      TestTableDrivenLite, optional_nested_enum_),
+    static_cast< ::google::protobuf::uint32>(18),
+    0, 16, 14, 2
+  },
+  {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+      TestTableDrivenLite, optional_foreign_enum_),
+    static_cast< ::google::protobuf::uint32>(19),
+    0, 16, 14, 2
+  },
+  { 0, 0, ::google::protobuf::internal::kInvalidMask,
+    ::google::protobuf::internal::kInvalidMask, 0, 0 },
+  { 0, 0, ::google::protobuf::internal::kInvalidMask,
+    ::google::protobuf::internal::kInvalidMask, 0, 0 },
+  { 0, 0, ::google::protobuf::internal::kInvalidMask,
+    ::google::protobuf::internal::kInvalidMask, 0, 0 },
+  { 0, 0, ::google::protobuf::internal::kInvalidMask,
+    ::google::protobuf::internal::kInvalidMask, 0, 0 },
+  { 0, 0, ::google::protobuf::internal::kInvalidMask,
+    ::google::protobuf::internal::kInvalidMask, 0, 0 },
+  { 0, 0, ::google::protobuf::internal::kInvalidMask,
+    ::google::protobuf::internal::kInvalidMask, 0, 0 },
+  { 0, 0, ::google::protobuf::internal::kInvalidMask,
+    ::google::protobuf::internal::kInvalidMask, 0, 0 },
+  { 0, 0, ::google::protobuf::internal::kInvalidMask,
+    ::google::protobuf::internal::kInvalidMask, 0, 0 },
+  {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+      TestTableDrivenLite, repeated_int32_),
+    static_cast< ::google::protobuf::uint32>(-1),
+    0, 2, 37, 2
+  },
+  {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+      TestTableDrivenLite, repeated_int64_),
+    static_cast< ::google::protobuf::uint32>(-1),
+    0, 2, 35, 2
+  },
+  {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+      TestTableDrivenLite, repeated_uint32_),
+    static_cast< ::google::protobuf::uint32>(-1),
+    0, 2, 45, 2
+  },
+  {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+      TestTableDrivenLite, repeated_uint64_),
+    static_cast< ::google::protobuf::uint32>(-1),
+    0, 2, 36, 2
+  },
+  {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+      TestTableDrivenLite, repeated_sint32_),
+    static_cast< ::google::protobuf::uint32>(-1),
+    0, 2, 49, 2
+  },
+  {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+      TestTableDrivenLite, repeated_sint64_),
+    static_cast< ::google::protobuf::uint32>(-1),
+    0, 2, 50, 2
+  },
+  {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+      TestTableDrivenLite, repeated_fixed32_),
+    static_cast< ::google::protobuf::uint32>(-1),
+    5, 2, 39, 2
+  },
+  {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+      TestTableDrivenLite, repeated_fixed64_),
+    static_cast< ::google::protobuf::uint32>(-1),
+    1, 2, 38, 2
+  },
+  {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+      TestTableDrivenLite, repeated_sfixed32_),
+    static_cast< ::google::protobuf::uint32>(-1),
+    5, 2, 47, 2
+  },
+  {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+      TestTableDrivenLite, repeated_sfixed64_),
+    static_cast< ::google::protobuf::uint32>(-1),
+    1, 2, 48, 2
+  },
+  {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+      TestTableDrivenLite, repeated_float_),
+    static_cast< ::google::protobuf::uint32>(-1),
+    5, 2, 34, 2
+  },
+  {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+      TestTableDrivenLite, repeated_double_),
+    static_cast< ::google::protobuf::uint32>(-1),
+    1, 2, 33, 2
+  },
+  {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+      TestTableDrivenLite, repeated_bool_),
+    static_cast< ::google::protobuf::uint32>(-1),
+    0, 2, 40, 2
+  },
+  {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+      TestTableDrivenLite, repeated_string_),
+    static_cast< ::google::protobuf::uint32>(-1),
+    2, 16, 41, 2
+  },
+  {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+      TestTableDrivenLite, repeated_bytes_),
+    static_cast< ::google::protobuf::uint32>(-1),
+    2, 16, 44, 2
+  },
+  {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+      TestTableDrivenLite, repeatedgroup_),
+    static_cast< ::google::protobuf::uint32>(-1),
+    3, 16, 42, 4
+  },
+  { 0, 0, ::google::protobuf::internal::kInvalidMask,
+    ::google::protobuf::internal::kInvalidMask, 0, 0 },
+  {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+      TestTableDrivenLite, repeated_nested_message_),
+    static_cast< ::google::protobuf::uint32>(-1),
+    2, 16, 43, 2
+  },
+  {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+      TestTableDrivenLite, repeated_foreign_message_),
+    static_cast< ::google::protobuf::uint32>(-1),
+    2, 16, 43, 2
+  },
+  { 0, 0, ::google::protobuf::internal::kInvalidMask,
+    ::google::protobuf::internal::kInvalidMask, 0, 0 },
+  {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+      TestTableDrivenLite, repeated_nested_enum_),
+    static_cast< ::google::protobuf::uint32>(-1),
+    0, 2, 46, 2
+  },
+  {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+      TestTableDrivenLite, repeated_foreign_enum_),
+    static_cast< ::google::protobuf::uint32>(-1),
+    0, 2, 46, 2
+  },
+  {0, 0, 0, ::google::protobuf::internal::kInvalidMask, 0, 0},
+  {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+      TestRepeatedTableDrivenLite, int32_values_),
+    static_cast< ::google::protobuf::uint32>(-1),
+    0, 2, 37, 1
+  },
+  {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+      TestRepeatedTableDrivenLite, packed_int32_values_),
+    static_cast< ::google::protobuf::uint32>(-1),
+    0, 2, 37, 1
+  },
+  {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+      TestRepeatedTableDrivenLite, packed_sint64_values_),
+    static_cast< ::google::protobuf::uint32>(-1),
+    0, 2, 50, 1
+  },
+  {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+      TestRepeatedTableDrivenLite, fixed32_values_),
+    static_cast< ::google::protobuf::uint32>(-1),
+    5, 2, 39, 1
+  },
+  {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+      TestRepeatedTableDrivenLite, packed_double_values_),
+    static_cast< ::google::protobuf::uint32>(-1),
+    1, 2, 33, 1
+  },
+  {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+      TestRepeatedTableDrivenLite, enum_values_),
+    static_cast< ::google::protobuf::uint32>(-1),
+    0, 2, 46, 1
+  },
+  {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+      TestRepeatedTableDrivenLite, packed_enum_values_),
+    static_cast< ::google::protobuf::uint32>(-1),
+    0, 2, 46, 1
+  },
+  {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+      TestRepeatedTableDrivenLite, string_values_),
+    static_cast< ::google::protobuf::uint32>(-1),
+    2, 16, 41, 1
+  },
+  {
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+      TestRepeatedTableDrivenLite, message_values_),
+    static_cast< ::google::protobuf::uint32>(-1),
+    2, 16, 43, 1
+  },
+};
+
+PROTOBUF_CONSTEXPR_VAR ::google::protobuf::internal::AuxillaryParseTableField
+    const TableStruct::aux[] = {
+  ::google::protobuf::internal::AuxillaryParseTableField(),
+  ::google::protobuf::internal::AuxillaryParseTableField(),
+  ::google::protobuf::internal::AuxillaryParseTableField(),
+  ::google::protobuf::internal::AuxillaryParseTableField(),
+  ::google::protobuf::internal::AuxillaryParseTableField(),
+  ::google::protobuf::internal::AuxillaryParseTableField(),
+  ::google::protobuf::internal::AuxillaryParseTableField(),
+  ::google::protobuf::internal::AuxillaryParseTableField(),
+  ::google::protobuf::internal::AuxillaryParseTableField(),
+  ::google::protobuf::internal::AuxillaryParseTableField(),
+  ::google::protobuf::internal::AuxillaryParseTableField(),
+  ::google::protobuf::internal::AuxillaryParseTableField(),
+  ::google::protobuf::internal::AuxillaryParseTableField(),
+  ::google::protobuf::internal::AuxillaryParseTableField(),
+  ::google::protobuf::internal::AuxillaryParseTableField(),
+  ::google::protobuf::internal::AuxillaryParseTableField(),
+  {::google::protobuf::internal::AuxillaryParseTableField::string_aux{
+    &::google::protobuf::internal::fixed_address_empty_string,
+    "protobuf_unittest.TestTableDrivenLite.optional_string",
+    false,
+    "protobuf_unittest.TestTableDrivenLite.optional_string"
+  }},
+  {::google::protobuf::internal::AuxillaryParseTableField::string_aux{
+    &::google::protobuf::internal::fixed_address_empty_string,
+    "protobuf_unittest.TestTableDrivenLite.optional_bytes",
+    false,
+    "protobuf_unittest.TestTableDrivenLite.optional_bytes"
+  }},
+  {::google::protobuf::internal::AuxillaryParseTableField::message_aux{
+    &::protobuf_unittest::_TestTableDrivenLite_OptionalGroup_default_instance_,
+    NULL,
+  }},
+  ::google::protobuf::internal::AuxillaryParseTableField(),
+  {::google::protobuf::internal::AuxillaryParseTableField::message_aux{
+    &::protobuf_unittest::_TestTableDrivenLite_NestedMessage_default_instance_,
+    ::protobuf_unittest::protobuf_google_2fprotobuf_2funittest_5ftable_5fdriven_5flite_2eproto::TableStruct::schema +
+      ::protobuf_unittest::TestTableDrivenLite_NestedMessage::kIndexInFileMessages,
+  }},
+  {::google::protobuf::internal::AuxillaryParseTableField::message_aux{
+    &::protobuf_unittest::_ForeignMessageLite_default_instance_,
+    NULL,
+  }},
+  ::google::protobuf::internal::AuxillaryParseTableField(),
+  {::google::protobuf::internal::AuxillaryParseTableField::enum_aux{::protobuf_unittest::TestTableDrivenLite_NestedEnum_IsValid, "::protobuf_unittest::TestTableDrivenLite_NestedEnum" }},
+  {::google::protobuf::internal::AuxillaryParseTableField::enum_aux{::protobuf_unittest::ForeignEnumLite_IsValid, "::protobuf_unittest::ForeignEnumLite" }},
+  ::google::protobuf::internal::AuxillaryParseTableField(),
+  ::google::protobuf::internal::AuxillaryParseTableField(),
+  ::google::protobuf::internal::AuxillaryParseTableField(),
+  ::google::protobuf::internal::AuxillaryParseTableField(),
+  ::google::protobuf::internal::AuxillaryParseTableField(),
+  ::google::protobuf::internal::AuxillaryParseTableField(),
+  ::google::protobuf::internal::AuxillaryParseTableField(),
+  ::google::protobuf::internal::AuxillaryParseTableField(),
+  ::google::protobuf::internal::AuxillaryParseTableField(),
+  ::google::protobuf::internal::AuxillaryParseTableField(),
+  ::google::protobuf::internal::AuxillaryParseTableField(),
+  ::google::protobuf::internal::AuxillaryParseTableField(),
+  ::google::protobuf::internal::AuxillaryParseTableField(),
+  ::google::protobuf::internal::AuxillaryParseTableField(),
+  ::google::protobuf::internal::AuxillaryParseTableField(),
+  ::google::protobuf::internal::AuxillaryParseTableField(),
+  ::google::protobuf::internal::AuxillaryParseTableField(),
+  ::google::protobuf::internal::AuxillaryParseTableField(),
+  ::google::protobuf::internal::AuxillaryParseTableField(),
+  ::google::protobuf::internal::AuxillaryParseTableField(),
+  ::google::protobuf::internal::AuxillaryParseTableField(),
+  {::google::protobuf::internal::AuxillaryParseTableField::string_aux{
+    &::google::protobuf::internal::fixed_address_empty_string,
+    "protobuf_unittest.TestTableDrivenLite.repeated_string",
+    false,
+    "protobuf_unittest.TestTableDrivenLite.repeated_string"
+  }},
+  {::google::protobuf::internal::AuxillaryParseTableField::string_aux{
+    &::google::protobuf::internal::fixed_address_empty_string,
+    "protobuf_unittest.TestTableDrivenLite.repeated_bytes",
+    false,
+    "protobuf_unittest.TestTableDrivenLite.repeated_bytes"
+  }},
+  {::google::protobuf::internal::AuxillaryParseTableField::message_aux{
+    &::protobuf_unittest::_TestTableDrivenLite_RepeatedGroup_default_instance_,
+    NULL,
+  }},
+  ::google::protobuf::internal::AuxillaryParseTableField(),
+  {::google::protobuf::internal::AuxillaryParseTableField::message_aux{
+    &::protobuf_unittest::_TestTableDrivenLite_NestedMessage_default_instance_,
+    ::protobuf_unittest::protobuf_google_2fprotobuf_2funittest_5ftable_5fdriven_5flite_2eproto::TableStruct::schema +
+      ::protobuf_unittest::TestTableDrivenLite_NestedMessage::kIndexInFileMessages,
+  }},
+  {::google::protobuf::internal::AuxillaryParseTableField::message_aux{
+    &::protobuf_unittest::_ForeignMessageLite_default_instance_,
+    NULL,
+  }},
+  ::google::protobuf::internal::AuxillaryParseTableField(),
+  {::google::protobuf::internal::AuxillaryParseTableField::enum_aux{::protobuf_unittest::TestTableDrivenLite_NestedEnum_IsValid, "::protobuf_unittest::TestTableDrivenLite_NestedEnum" }},
+  {::google::protobuf::internal::AuxillaryParseTableField::enum_aux{::protobuf_unittest::ForeignEnumLite_IsValid, "::protobuf_unittest::ForeignEnumLite" }},
+  ::google::protobuf::internal::AuxillaryParseTableField(),
+  ::google::protobuf::internal::AuxillaryParseTableField(),
+  ::google::protobuf::internal::AuxillaryParseTableField(),
+  ::google::protobuf::internal::AuxillaryParseTableField(),
+  ::google::protobuf::internal::AuxillaryParseTableField(),
+  ::google::protobuf::internal::AuxillaryParseTableField(),
+  {::google::protobuf::internal::AuxillaryParseTableField::enum_aux{::protobuf_unittest::ForeignEnumLite_IsValid, "::protobuf_unittest::ForeignEnumLite" }},
+  {::google::protobuf::internal::AuxillaryParseTableField::enum_aux{::protobuf_unittest::ForeignEnumLite_IsValid, "::protobuf_unittest::ForeignEnumLite" }},
+  {::google::protobuf::internal::AuxillaryParseTableField::string_aux{
+    &::google::protobuf::internal::fixed_address_empty_string,
+    "protobuf_unittest.TestRepeatedTableDrivenLite.string_values",
+    false,
+    "protobuf_unittest.TestRepeatedTableDrivenLite.string_values"
+  }},
+  {::google::protobuf::internal::AuxillaryParseTableField::message_aux{
+    &::protobuf_unittest::_TestTableDrivenLite_NestedMessage_default_instance_,
+    ::protobuf_unittest::protobuf_google_2fprotobuf_2funittest_5ftable_5fdriven_5flite_2eproto::TableStruct::schema +
+      ::protobuf_unittest::TestTableDrivenLite_NestedMessage::kIndexInFileMessages,
+  }},
+};
+PROTOBUF_CONSTEXPR_VAR ::google::protobuf::internal::ParseTable const
+    TableStruct::schema[] = {
+  {
+    TableStruct::entries + 0,
+    TableStruct::aux + 0,
+    2,
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+      TestTableDrivenLite_NestedMessage, _has_bits_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+      TestTableDrivenLite_NestedMessage, _internal_metadata_),
+    false,
+  },
+  { NULL, NULL, 0, -1, -1, false },
+  { NULL, NULL, 0, -1, -1, false },
+  {
+    TableStruct::entries + 3,
+    TableStruct::aux + 2,
+    52,
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+      TestTableDrivenLite, _has_bits_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+      TestTableDrivenLite, _internal_metadata_),
+    false,
+  },
+  { NULL, NULL, 0, -1, -1, false },
+  {
+    TableStruct::entries + 56,
+    TableStruct::aux + 55,
+    9,
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+      TestRepeatedTableDrivenLite, _has_bits_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+      TestRepeatedTableDrivenLite, _internal_metadata_),
+    false,
+  },
+};
+
+PROTOBUF_CONSTEXPR_VAR ::google::protobuf::internal::SerializationTableField
+    const TableStruct::serialization_fields[] = {
+  {
+    static_cast< ::google::protobuf::uint32>(
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+        TestTableDrivenLite_NestedMessage, bb_)),
+    1,
+    8u, 5, 1,
+    NULL
+  },
+  {
+    static_cast< ::google::protobuf::uint32>(
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+        TestTableDrivenLite_NestedMessage, cc_)),
+    0,
+    16u, 3, 1,
+    NULL
+  },
+  {
+    static_cast< ::google::protobuf::uint32>(
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+        TestTableDrivenLite_OptionalGroup, a_)),
+    0,
+    136u, 5, 2,
+    NULL
+  },
+  {
+    static_cast< ::google::protobuf::uint32>(
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+        TestTableDrivenLite_RepeatedGroup, a_)),
+    0,
+    376u, 5, 2,
+    NULL
+  },
+  {
+    static_cast< ::google::protobuf::uint32>(
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+        TestTableDrivenLite, optional_int32_)),
+    6,
+    8u, 5, 1,
+    NULL
+  },
+  {
+    static_cast< ::google::protobuf::uint32>(
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+        TestTableDrivenLite, optional_int64_)),
+    5,
+    16u, 3, 1,
+    NULL
+  },
+  {
+    static_cast< ::google::protobuf::uint32>(
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+        TestTableDrivenLite, optional_uint32_)),
+    7,
+    24u, 13, 1,
+    NULL
+  },
+  {
+    static_cast< ::google::protobuf::uint32>(
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+        TestTableDrivenLite, optional_uint64_)),
+    8,
+    32u, 4, 1,
+    NULL
+  },
+  {
+    static_cast< ::google::protobuf::uint32>(
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+        TestTableDrivenLite, optional_sint32_)),
+    10,
+    40u, 17, 1,
+    NULL
+  },
+  {
+    static_cast< ::google::protobuf::uint32>(
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+        TestTableDrivenLite, optional_sint64_)),
+    9,
+    48u, 18, 1,
+    NULL
+  },
+  {
+    static_cast< ::google::protobuf::uint32>(
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+        TestTableDrivenLite, optional_fixed32_)),
+    11,
+    61u, 7, 1,
+    NULL
+  },
+  {
+    static_cast< ::google::protobuf::uint32>(
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+        TestTableDrivenLite, optional_fixed64_)),
+    12,
+    65u, 6, 1,
+    NULL
+  },
+  {
+    static_cast< ::google::protobuf::uint32>(
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+        TestTableDrivenLite, optional_sfixed32_)),
+    14,
+    77u, 15, 1,
+    NULL
+  },
+  {
+    static_cast< ::google::protobuf::uint32>(
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+        TestTableDrivenLite, optional_sfixed64_)),
+    13,
+    81u, 16, 1,
+    NULL
+  },
+  {
+    static_cast< ::google::protobuf::uint32>(
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+        TestTableDrivenLite, optional_float_)),
+    15,
+    93u, 2, 1,
+    NULL
+  },
+  {
+    static_cast< ::google::protobuf::uint32>(
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+        TestTableDrivenLite, optional_double_)),
+    16,
+    97u, 1, 1,
+    NULL
+  },
+  {
+    static_cast< ::google::protobuf::uint32>(
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+        TestTableDrivenLite, optional_bool_)),
+    17,
+    104u, 8, 1,
+    NULL
+  },
+  {
+    static_cast< ::google::protobuf::uint32>(
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+        TestTableDrivenLite, optional_string_)),
+    0,
+    114u, 9, 1,
+    NULL
+  },
+  {
+    static_cast< ::google::protobuf::uint32>(
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+        TestTableDrivenLite, optional_bytes_)),
+    1,
+    122u, 12, 1,
+    NULL
+  },
+  {
+    static_cast< ::google::protobuf::uint32>(
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+        TestTableDrivenLite, optionalgroup_)),
+    2,
+    131u, 10, 4,
+    TableStruct::serialization_table +
+      ::protobuf_unittest::TestTableDrivenLite_OptionalGroup::kIndexInFileMessages
+  },
+  {
+    static_cast< ::google::protobuf::uint32>(
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+        TestTableDrivenLite, optional_nested_message_)),
+    3,
+    146u, 11, 2,
+    TableStruct::serialization_table +
+      ::protobuf_unittest::TestTableDrivenLite_NestedMessage::kIndexInFileMessages
+  },
+  {
+    static_cast< ::google::protobuf::uint32>(
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+        TestTableDrivenLite, optional_foreign_message_)),
+    4,
+    154u, 11, 2,
+    NULL
+  },
+  {
+    static_cast< ::google::protobuf::uint32>(
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+        TestTableDrivenLite, optional_nested_enum_)),
+    18,
+    168u, 14, 2,
+    NULL
+  },
+  {
+    static_cast< ::google::protobuf::uint32>(
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+        TestTableDrivenLite, optional_foreign_enum_)),
+    19,
+    176u, 14, 2,
+    NULL
+  },
+  {
+    static_cast< ::google::protobuf::uint32>(
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+        TestTableDrivenLite, repeated_int32_)),
+    0,
+    248u, 37, 2,
+    NULL
+  },
+  {
+    static_cast< ::google::protobuf::uint32>(
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+        TestTableDrivenLite, repeated_int64_)),
+    0,
+    256u, 35, 2,
+    NULL
+  },
+  {
+    static_cast< ::google::protobuf::uint32>(
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+        TestTableDrivenLite, repeated_uint32_)),
+    0,
+    264u, 45, 2,
+    NULL
+  },
+  {
+    static_cast< ::google::protobuf::uint32>(
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+        TestTableDrivenLite, repeated_uint64_)),
+    0,
+    272u, 36, 2,
+    NULL
+  },
+  {
+    static_cast< ::google::protobuf::uint32>(
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+        TestTableDrivenLite, repeated_sint32_)),
+    0,
+    280u, 49, 2,
+    NULL
+  },
+  {
+    static_cast< ::google::protobuf::uint32>(
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+        TestTableDrivenLite, repeated_sint64_)),
+    0,
+    288u, 50, 2,
+    NULL
+  },
+  {
+    static_cast< ::google::protobuf::uint32>(
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+        TestTableDrivenLite, repeated_fixed32_)),
+    0,
+    301u, 39, 2,
+    NULL
+  },
+  {
+    static_cast< ::google::protobuf::uint32>(
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+        TestTableDrivenLite, repeated_fixed64_)),
+    0,
+    305u, 38, 2,
+    NULL
+  },
+  {
+    static_cast< ::google::protobuf::uint32>(
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+        TestTableDrivenLite, repeated_sfixed32_)),
+    0,
+    317u, 47, 2,
+    NULL
+  },
+  {
+    static_cast< ::google::protobuf::uint32>(
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+        TestTableDrivenLite, repeated_sfixed64_)),
+    0,
+    321u, 48, 2,
+    NULL
+  },
+  {
+    static_cast< ::google::protobuf::uint32>(
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+        TestTableDrivenLite, repeated_float_)),
+    0,
+    333u, 34, 2,
+    NULL
+  },
+  {
+    static_cast< ::google::protobuf::uint32>(
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+        TestTableDrivenLite, repeated_double_)),
+    0,
+    337u, 33, 2,
+    NULL
+  },
+  {
+    static_cast< ::google::protobuf::uint32>(
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+        TestTableDrivenLite, repeated_bool_)),
+    0,
+    344u, 40, 2,
+    NULL
+  },
+  {
+    static_cast< ::google::protobuf::uint32>(
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+        TestTableDrivenLite, repeated_string_)),
+    0,
+    354u, 41, 2,
+    NULL
+  },
+  {
+    static_cast< ::google::protobuf::uint32>(
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+        TestTableDrivenLite, repeated_bytes_)),
+    0,
+    362u, 44, 2,
+    NULL
+  },
+  {
+    static_cast< ::google::protobuf::uint32>(
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+        TestTableDrivenLite, repeatedgroup_)),
+    0,
+    371u, 42, 4,
+    TableStruct::serialization_table +
+      ::protobuf_unittest::TestTableDrivenLite_RepeatedGroup::kIndexInFileMessages
+  },
+  {
+    static_cast< ::google::protobuf::uint32>(
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+        TestTableDrivenLite, repeated_nested_message_)),
+    0,
+    386u, 43, 2,
+    TableStruct::serialization_table +
+      ::protobuf_unittest::TestTableDrivenLite_NestedMessage::kIndexInFileMessages
+  },
+  {
+    static_cast< ::google::protobuf::uint32>(
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+        TestTableDrivenLite, repeated_foreign_message_)),
+    0,
+    394u, 43, 2,
+    NULL
+  },
+  {
+    static_cast< ::google::protobuf::uint32>(
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+        TestTableDrivenLite, repeated_nested_enum_)),
+    0,
+    408u, 46, 2,
+    NULL
+  },
+  {
+    static_cast< ::google::protobuf::uint32>(
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+        TestTableDrivenLite, repeated_foreign_enum_)),
+    0,
+    416u, 46, 2,
+    NULL
+  },
+  {
+    static_cast< ::google::protobuf::uint32>(
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+        TestPackedTableDrivenLite, packed_int32_)),
+    static_cast< ::google::protobuf::uint32>(
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+        TestPackedTableDrivenLite, _packed_int32_cached_byte_size_)),
+    722u, 165, 2,
+    NULL
+  },
+  {
+    static_cast< ::google::protobuf::uint32>(
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+        TestPackedTableDrivenLite, packed_int64_)),
+    static_cast< ::google::protobuf::uint32>(
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+        TestPackedTableDrivenLite, _packed_int64_cached_byte_size_)),
+    730u, 163, 2,
+    NULL
+  },
+  {
+    static_cast< ::google::protobuf::uint32>(
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+        TestPackedTableDrivenLite, packed_uint32_)),
+    static_cast< ::google::protobuf::uint32>(
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+        TestPackedTableDrivenLite, _packed_uint32_cached_byte_size_)),
+    738u, 173, 2,
+    NULL
+  },
+  {
+    static_cast< ::google::protobuf::uint32>(
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+        TestPackedTableDrivenLite, packed_uint64_)),
+    static_cast< ::google::protobuf::uint32>(
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+        TestPackedTableDrivenLite, _packed_uint64_cached_byte_size_)),
+    746u, 164, 2,
+    NULL
+  },
+  {
+    static_cast< ::google::protobuf::uint32>(
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+        TestPackedTableDrivenLite, packed_sint32_)),
+    static_cast< ::google::protobuf::uint32>(
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+        TestPackedTableDrivenLite, _packed_sint32_cached_byte_size_)),
+    754u, 177, 2,
+    NULL
+  },
+  {
+    static_cast< ::google::protobuf::uint32>(
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+        TestPackedTableDrivenLite, packed_sint64_)),
+    static_cast< ::google::protobuf::uint32>(
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+        TestPackedTableDrivenLite, _packed_sint64_cached_byte_size_)),
+    762u, 178, 2,
+    NULL
+  },
+  {
+    static_cast< ::google::protobuf::uint32>(
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+        TestPackedTableDrivenLite, packed_fixed32_)),
+    static_cast< ::google::protobuf::uint32>(
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+        TestPackedTableDrivenLite, _packed_fixed32_cached_byte_size_)),
+    770u, 167, 2,
+    NULL
+  },
+  {
+    static_cast< ::google::protobuf::uint32>(
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+        TestPackedTableDrivenLite, packed_fixed64_)),
+    static_cast< ::google::protobuf::uint32>(
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+        TestPackedTableDrivenLite, _packed_fixed64_cached_byte_size_)),
+    778u, 166, 2,
+    NULL
+  },
+  {
+    static_cast< ::google::protobuf::uint32>(
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+        TestPackedTableDrivenLite, packed_sfixed32_)),
+    static_cast< ::google::protobuf::uint32>(
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+        TestPackedTableDrivenLite, _packed_sfixed32_cached_byte_size_)),
+    786u, 175, 2,
+    NULL
+  },
+  {
+    static_cast< ::google::protobuf::uint32>(
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+        TestPackedTableDrivenLite, packed_sfixed64_)),
+    static_cast< ::google::protobuf::uint32>(
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+        TestPackedTableDrivenLite, _packed_sfixed64_cached_byte_size_)),
+    794u, 176, 2,
+    NULL
+  },
+  {
+    static_cast< ::google::protobuf::uint32>(
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+        TestPackedTableDrivenLite, packed_float_)),
+    static_cast< ::google::protobuf::uint32>(
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+        TestPackedTableDrivenLite, _packed_float_cached_byte_size_)),
+    802u, 162, 2,
+    NULL
+  },
+  {
+    static_cast< ::google::protobuf::uint32>(
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+        TestPackedTableDrivenLite, packed_double_)),
+    static_cast< ::google::protobuf::uint32>(
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+        TestPackedTableDrivenLite, _packed_double_cached_byte_size_)),
+    810u, 161, 2,
+    NULL
+  },
+  {
+    static_cast< ::google::protobuf::uint32>(
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+        TestPackedTableDrivenLite, packed_bool_)),
+    static_cast< ::google::protobuf::uint32>(
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+        TestPackedTableDrivenLite, _packed_bool_cached_byte_size_)),
+    818u, 168, 2,
+    NULL
+  },
+  {
+    static_cast< ::google::protobuf::uint32>(
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+        TestPackedTableDrivenLite, packed_enum_)),
+    static_cast< ::google::protobuf::uint32>(
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+        TestPackedTableDrivenLite, _packed_enum_cached_byte_size_)),
+    826u, 174, 2,
+    NULL
+  },
+  {
+    static_cast< ::google::protobuf::uint32>(
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+        TestRepeatedTableDrivenLite, int32_values_)),
+    0,
+    8u, 37, 1,
+    NULL
+  },
+  {
+    static_cast< ::google::protobuf::uint32>(
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+        TestRepeatedTableDrivenLite, packed_int32_values_)),
+    static_cast< ::google::protobuf::uint32>(
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+        TestRepeatedTableDrivenLite, _packed_int32_values_cached_byte_size_)),
+    18u, 165, 1,
+    NULL
+  },
+  {
+    static_cast< ::google::protobuf::uint32>(
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+        TestRepeatedTableDrivenLite, packed_sint64_values_)),
+    static_cast< ::google::protobuf::uint32>(
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+        TestRepeatedTableDrivenLite, _packed_sint64_values_cached_byte_size_)),
+    26u, 178, 1,
+    NULL
+  },
+  {
+    static_cast< ::google::protobuf::uint32>(
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+        TestRepeatedTableDrivenLite, fixed32_values_)),
+    0,
+    37u, 39, 1,
+    NULL
+  },
+  {
+    static_cast< ::google::protobuf::uint32>(
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+        TestRepeatedTableDrivenLite, packed_double_values_)),
+    static_cast< ::google::protobuf::uint32>(
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+        TestRepeatedTableDrivenLite, _packed_double_values_cached_byte_size_)),
+    42u, 161, 1,
+    NULL
+  },
+  {
+    static_cast< ::google::protobuf::uint32>(
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+        TestRepeatedTableDrivenLite, enum_values_)),
+    0,
+    48u, 46, 1,
+    NULL
+  },
+  {
+    static_cast< ::google::protobuf::uint32>(
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+        TestRepeatedTableDrivenLite, packed_enum_values_)),
+    static_cast< ::google::protobuf::uint32>(
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+        TestRepeatedTableDrivenLite, _packed_enum_values_cached_byte_size_)),
+    58u, 174, 1,
+    NULL
+  },
+  {
+    static_cast< ::google::protobuf::uint32>(
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+        TestRepeatedTableDrivenLite, string_values_)),
+    0,
+    66u, 41, 1,
+    NULL
+  },
+  {
+    static_cast< ::google::protobuf::uint32>(
+      GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+        TestRepeatedTableDrivenLite, message_values_)),
+    0,
+    74u, 43, 1,
+    TableStruct::serialization_table +
+      ::protobuf_unittest::TestTableDrivenLite_NestedMessage::kIndexInFileMessages
+  },
+};
+
+PROTOBUF_CONSTEXPR_VAR ::google::protobuf::internal::SerializationTable const
+    TableStruct::serialization_table[] = {
+  {
+    TableStruct::serialization_fields + 0,
+    2,
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+      TestTableDrivenLite_NestedMessage, _has_bits_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+      TestTableDrivenLite_NestedMessage, _internal_metadata_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+      TestTableDrivenLite_NestedMessage, _cached_size_),
+  },
+  {
+    TableStruct::serialization_fields + 2,
+    1,
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+      TestTableDrivenLite_OptionalGroup, _has_bits_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+      TestTableDrivenLite_OptionalGroup, _internal_metadata_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+      TestTableDrivenLite_OptionalGroup, _cached_size_),
+  },
+  {
+    TableStruct::serialization_fields + 3,
+    1,
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+      TestTableDrivenLite_RepeatedGroup, _has_bits_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+      TestTableDrivenLite_RepeatedGroup, _internal_metadata_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+      TestTableDrivenLite_RepeatedGroup, _cached_size_),
+  },
+  {
+    TableStruct::serialization_fields + 4,
+    40,
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+      TestTableDrivenLite, _has_bits_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+      TestTableDrivenLite, _internal_metadata_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+      TestTableDrivenLite, _cached_size_),
+  },
+  {
+    TableStruct::serialization_fields + 44,
+    14,
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+      TestPackedTableDrivenLite, _has_bits_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+      TestPackedTableDrivenLite, _internal_metadata_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+      TestPackedTableDrivenLite, _cached_size_),
+  },
+  {
+    TableStruct::serialization_fields + 58,
+    9,
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+      TestRepeatedTableDrivenLite, _has_bits_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+      TestRepeatedTableDrivenLite, _internal_metadata_),
+    GOOGLE_PROTOBUF_GENERATED_MESSAGE_FIELD_OFFSET(
+      TestRepeatedTableDrivenLite, _cached_size_),
+  },
+};
+
+
+void TableStruct::Shutdown() {
+  _TestTableDrivenLite_NestedMessage_default_instance_.Shutdown();
+  _TestTableDrivenLite_OptionalGroup_default_instance_.Shutdown();
+  _TestTableDrivenLite_RepeatedGroup_default_instance_.Shutdown();
+  _TestTableDrivenLite_default_instance_.Shutdown();
+  _TestPackedTableDrivenLite_default_instance_.Shutdown();
+  _TestRepeatedTableDrivenLite_default_instance_.Shutdown();
+}
+
+void TableStruct::InitDefaultsImpl() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  ::google::protobuf::internal::InitProtobufDefaults();
+  ::protobuf_unittest::protobuf_google_2fprotobuf_2funittest_5flite_2eproto::InitDefaults();
+  _TestTableDrivenLite_NestedMessage_default_instance_.DefaultConstruct();
+  _TestTableDrivenLite_OptionalGroup_default_instance_.DefaultConstruct();
+  _TestTableDrivenLite_RepeatedGroup_default_instance_.DefaultConstruct();
+  _TestTableDrivenLite_default_instance_.DefaultConstruct();
+  _TestPackedTableDrivenLite_default_instance_.DefaultConstruct();
+  _TestRepeatedTableDrivenLite_default_instance_.DefaultConstruct();
+  _TestTableDrivenLite_default_instance_.get_mutable()->optionalgroup_ = const_cast< ::protobuf_unittest::TestTableDrivenLite_OptionalGroup*>(
+      ::protobuf_unittest::TestTableDrivenLite_OptionalGroup::internal_default_instance());
+  _TestTableDrivenLite_default_instance_.get_mutable()->optional_nested_message_ = const_cast< ::protobuf_unittest::TestTableDrivenLite_NestedMessage*>(
+      ::protobuf_unittest::TestTableDrivenLite_NestedMessage::internal_default_instance());
+  _TestTableDrivenLite_default_instance_.get_mutable()->optional_foreign_message_ = const_cast< ::protobuf_unittest::ForeignMessageLite*>(
+      ::protobuf_unittest::ForeignMessageLite::internal_default_instance());
+}
+
+void InitDefaults() {
+  static GOOGLE_PROTOBUF_DECLARE_ONCE(once);
+  ::google::protobuf::GoogleOnceInit(&once, &TableStruct::InitDefaultsImpl);
+}
+void AddDescriptorsImpl() {
+  InitDefaults();
+  ::protobuf_unittest::protobuf_google_2fprotobuf_2funittest_5flite_2eproto::AddDescriptors();
+  ::google::protobuf::internal::OnShutdown(&TableStruct::Shutdown);
+}
+
+void AddDescriptors() {
+  static GOOGLE_PROTOBUF_DECLARE_ONCE(once);
+  ::google::protobuf::GoogleOnceInit(&once, &AddDescriptorsImpl);
+}
+#ifdef GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+// Force AddDescriptors() to be called at static initialization time.
+struct StaticDescriptorInitializer {
+  StaticDescriptorInitializer() {
+    AddDescriptors();
+  }
+} static_descriptor_initializer;
+#endif  // GOOGLE_PROTOBUF_NO_STATIC_INITIALIZER
+
+}  // namespace protobuf_google_2fprotobuf_2funittest_5ftable_5fdriven_5flite_2eproto
+
+bool TestTableDrivenLite_NestedEnum_IsValid(int value) {
+  switch (value) {
+    case 1:
+    case 2:
+    case 3:
+      return true;
+    default:
+      return false;
+  }
+}
+
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const TestTableDrivenLite_NestedEnum TestTableDrivenLite::FOO;
+const TestTableDrivenLite_NestedEnum TestTableDrivenLite::BAR;
+const TestTableDrivenLite_NestedEnum TestTableDrivenLite::BAZ;
+const TestTableDrivenLite_NestedEnum TestTableDrivenLite::NestedEnum_MIN;
+const TestTableDrivenLite_NestedEnum TestTableDrivenLite::NestedEnum_MAX;
+const int TestTableDrivenLite::NestedEnum_ARRAYSIZE;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+// ===================================================================
+
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int TestTableDrivenLite_NestedMessage::kBbFieldNumber;
+const int TestTableDrivenLite_NestedMessage::kCcFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+TestTableDrivenLite_NestedMessage::TestTableDrivenLite_NestedMessage()
+  : ::google::protobuf::MessageLite(), _internal_metadata_(NULL) {
+  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
+    protobuf_google_2fprotobuf_2funittest_5ftable_5fdriven_5flite_2eproto::InitDefaults();
+  }
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:protobuf_unittest.TestTableDrivenLite.NestedMessage)
+}
+TestTableDrivenLite_NestedMessage::TestTableDrivenLite_NestedMessage(const TestTableDrivenLite_NestedMessage& from)
+  : ::google::protobuf::MessageLite(),
+      _internal_metadata_(NULL),
+      _has_bits_(from._has_bits_),
+      _cached_size_(0) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::memcpy(&cc_, &from.cc_,
+    reinterpret_cast<char*>(&bb_) -
+    reinterpret_cast<char*>(&cc_) + sizeof(bb_));
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.TestTableDrivenLite.NestedMessage)
+}
+
+void TestTableDrivenLite_NestedMessage::SharedCtor() {
+  _cached_size_ = 0;
+  ::memset(&cc_, 0, reinterpret_cast<char*>(&bb_) -
+    reinterpret_cast<char*>(&cc_) + sizeof(bb_));
+}
+
+TestTableDrivenLite_NestedMessage::~TestTableDrivenLite_NestedMessage() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.TestTableDrivenLite.NestedMessage)
+  SharedDtor();
+}
+
+void TestTableDrivenLite_NestedMessage::SharedDtor() {
+}
+
+void TestTableDrivenLite_NestedMessage::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const TestTableDrivenLite_NestedMessage& TestTableDrivenLite_NestedMessage::default_instance() {
+  protobuf_google_2fprotobuf_2funittest_5ftable_5fdriven_5flite_2eproto::InitDefaults();
+  return *internal_default_instance();
+}
+
+TestTableDrivenLite_NestedMessage* TestTableDrivenLite_NestedMessage::New(::google::protobuf::Arena* arena) const {
+  TestTableDrivenLite_NestedMessage* n = new TestTableDrivenLite_NestedMessage;
+  if (arena != NULL) {
+    arena->Own(n);
+  }
+  return n;
+}
+
+void TestTableDrivenLite_NestedMessage::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.TestTableDrivenLite.NestedMessage)
+  if (_has_bits_[0 / 32] & 3u) {
+    ::memset(&cc_, 0, reinterpret_cast<char*>(&bb_) -
+      reinterpret_cast<char*>(&cc_) + sizeof(bb_));
+  }
+  _has_bits_.Clear();
+  _internal_metadata_.Clear();
+}
+
+bool TestTableDrivenLite_NestedMessage::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+  return ::google::protobuf::internal::MergePartialFromCodedStream(
+      this,
+      protobuf_google_2fprotobuf_2funittest_5ftable_5fdriven_5flite_2eproto::TableStruct::schema[
+        TestTableDrivenLite_NestedMessage::kIndexInFileMessages],
+      input);
+}
+
+void TestTableDrivenLite_NestedMessage::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:protobuf_unittest.TestTableDrivenLite.NestedMessage)
+  ::google::protobuf::internal::TableSerialize(
+      this,
+      protobuf_google_2fprotobuf_2funittest_5ftable_5fdriven_5flite_2eproto::TableStruct::serialization_table[
+        TestTableDrivenLite_NestedMessage::kIndexInFileMessages],
+      output);
+  // @@protoc_insertion_point(serialize_end:protobuf_unittest.TestTableDrivenLite.NestedMessage)
+}
+
+::google::protobuf::uint8* TestTableDrivenLite_NestedMessage::InternalSerializeWithCachedSizesToArray(
+    bool deterministic, ::google::protobuf::uint8* target) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.TestTableDrivenLite.NestedMessage)
+  target = ::google::protobuf::internal::TableSerializeToArray(
+      this,
+      protobuf_google_2fprotobuf_2funittest_5ftable_5fdriven_5flite_2eproto::TableStruct::serialization_table[
+        TestTableDrivenLite_NestedMessage::kIndexInFileMessages],
+      deterministic, target);
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.TestTableDrivenLite.NestedMessage)
+  return target;
+}
+
+size_t TestTableDrivenLite_NestedMessage::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.TestTableDrivenLite.NestedMessage)
+  return ::google::protobuf::internal::TableByteSize(
+      this,
+      protobuf_google_2fprotobuf_2funittest_5ftable_5fdriven_5flite_2eproto::TableStruct::serialization_table[
+        TestTableDrivenLite_NestedMessage::kIndexInFileMessages]);
+}
+
+void TestTableDrivenLite_NestedMessage::CheckTypeAndMergeFrom(
+    const ::google::protobuf::MessageLite& from) {
+  MergeFrom(*::google::protobuf::down_cast<const TestTableDrivenLite_NestedMessage*>(&from));
+}
+
+void TestTableDrivenLite_NestedMessage::MergeFrom(const TestTableDrivenLite_NestedMessage& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.TestTableDrivenLite.NestedMessage)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  cached_has_bits = from._has_bits_[0];
+  if (cached_has_bits & 3u) {
+    if (cached_has_bits & 0x00000001u) {
+      cc_ = from.cc_;
+    }
+    if (cached_has_bits & 0x00000002u) {
+      bb_ = from.bb_;
+    }
+    _has_bits_[0] |= cached_has_bits;
+  }
+}
+
+void TestTableDrivenLite_NestedMessage::CopyFrom(const TestTableDrivenLite_NestedMessage& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.TestTableDrivenLite.NestedMessage)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TestTableDrivenLite_NestedMessage::IsInitialized() const {
+  return true;
+}
+
+void TestTableDrivenLite_NestedMessage::Swap(TestTableDrivenLite_NestedMessage* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void TestTableDrivenLite_NestedMessage::InternalSwap(TestTableDrivenLite_NestedMessage* other) {
+  std::swap(cc_, other->cc_);
+  std::swap(bb_, other->bb_);
+  std::swap(_has_bits_[0], other->_has_bits_[0]);
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  std::swap(_cached_size_, other->_cached_size_);
+}
+
+::std::string TestTableDrivenLite_NestedMessage::GetTypeName() const {
+  return "protobuf_unittest.TestTableDrivenLite.NestedMessage";
+}
+
+#if PROTOBUF_INLINE_NOT_IN_HEADERS
+// TestTableDrivenLite_NestedMessage
+
+// optional int32 bb = 1;
+bool TestTableDrivenLite_NestedMessage::has_bb() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
+}
+void TestTableDrivenLite_NestedMessage::set_has_bb() {
+  _has_bits_[0] |= 0x00000002u;
+}
+void TestTableDrivenLite_NestedMessage::clear_has_bb() {
+  _has_bits_[0] &= ~0x00000002u;
+}
+void TestTableDrivenLite_NestedMessage::clear_bb() {
+  bb_ = 0;
+  clear_has_bb();
+}
+::google::protobuf::int32 TestTableDrivenLite_NestedMessage::bb() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestTableDrivenLite.NestedMessage.bb)
+  return bb_;
+}
+void TestTableDrivenLite_NestedMessage::set_bb(::google::protobuf::int32 value) {
+  set_has_bb();
+  bb_ = value;
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestTableDrivenLite.NestedMessage.bb)
+}
+
+// optional int64 cc = 2;
+bool TestTableDrivenLite_NestedMessage::has_cc() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+void TestTableDrivenLite_NestedMessage::set_has_cc() {
+  _has_bits_[0] |= 0x00000001u;
+}
+void TestTableDrivenLite_NestedMessage::clear_has_cc() {
+  _has_bits_[0] &= ~0x00000001u;
+}
+void TestTableDrivenLite_NestedMessage::clear_cc() {
+  cc_ = GOOGLE_LONGLONG(0);
+  clear_has_cc();
+}
+::google::protobuf::int64 TestTableDrivenLite_NestedMessage::cc() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestTableDrivenLite.NestedMessage.cc)
+  return cc_;
+}
+void TestTableDrivenLite_NestedMessage::set_cc(::google::protobuf::int64 value) {
+  set_has_cc();
+  cc_ = value;
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestTableDrivenLite.NestedMessage.cc)
+}
+
+#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
+
+// ===================================================================
+
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int TestTableDrivenLite_OptionalGroup::kAFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+TestTableDrivenLite_OptionalGroup::TestTableDrivenLite_OptionalGroup()
+  : ::google::protobuf::MessageLite(), _internal_metadata_(NULL) {
+  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
+    protobuf_google_2fprotobuf_2funittest_5ftable_5fdriven_5flite_2eproto::InitDefaults();
+  }
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:protobuf_unittest.TestTableDrivenLite.OptionalGroup)
+}
+TestTableDrivenLite_OptionalGroup::TestTableDrivenLite_OptionalGroup(const TestTableDrivenLite_OptionalGroup& from)
+  : ::google::protobuf::MessageLite(),
+      _internal_metadata_(NULL),
+      _has_bits_(from._has_bits_),
+      _cached_size_(0) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  a_ = from.a_;
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.TestTableDrivenLite.OptionalGroup)
+}
+
+void TestTableDrivenLite_OptionalGroup::SharedCtor() {
+  _cached_size_ = 0;
+  a_ = 0;
+}
+
+TestTableDrivenLite_OptionalGroup::~TestTableDrivenLite_OptionalGroup() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.TestTableDrivenLite.OptionalGroup)
+  SharedDtor();
+}
+
+void TestTableDrivenLite_OptionalGroup::SharedDtor() {
+}
+
+void TestTableDrivenLite_OptionalGroup::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const TestTableDrivenLite_OptionalGroup& TestTableDrivenLite_OptionalGroup::default_instance() {
+  protobuf_google_2fprotobuf_2funittest_5ftable_5fdriven_5flite_2eproto::InitDefaults();
+  return *internal_default_instance();
+}
+
+TestTableDrivenLite_OptionalGroup* TestTableDrivenLite_OptionalGroup::New(::google::protobuf::Arena* arena) const {
+  TestTableDrivenLite_OptionalGroup* n = new TestTableDrivenLite_OptionalGroup;
+  if (arena != NULL) {
+    arena->Own(n);
+  }
+  return n;
+}
+
+void TestTableDrivenLite_OptionalGroup::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.TestTableDrivenLite.OptionalGroup)
+  a_ = 0;
+  _has_bits_.Clear();
+  _internal_metadata_.Clear();
+}
+
+bool TestTableDrivenLite_OptionalGroup::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  ::google::protobuf::io::LazyStringOutputStream unknown_fields_string(
+      ::google::protobuf::NewPermanentCallback(&_internal_metadata_,
+          &::google::protobuf::internal::InternalMetadataWithArenaLite::
+              mutable_unknown_fields));
+  ::google::protobuf::io::CodedOutputStream unknown_fields_stream(
+      &unknown_fields_string, false);
+  // @@protoc_insertion_point(parse_start:protobuf_unittest.TestTableDrivenLite.OptionalGroup)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(16383u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // optional int32 a = 17;
+      case 17: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(136u)) {
+          set_has_a();
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, &a_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0 ||
+            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormatLite::SkipField(
+            input, tag, &unknown_fields_stream));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:protobuf_unittest.TestTableDrivenLite.OptionalGroup)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:protobuf_unittest.TestTableDrivenLite.OptionalGroup)
+  return false;
+#undef DO_
+}
+
+void TestTableDrivenLite_OptionalGroup::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:protobuf_unittest.TestTableDrivenLite.OptionalGroup)
+  ::google::protobuf::internal::TableSerialize(
+      this,
+      protobuf_google_2fprotobuf_2funittest_5ftable_5fdriven_5flite_2eproto::TableStruct::serialization_table[
+        TestTableDrivenLite_OptionalGroup::kIndexInFileMessages],
+      output);
+  // @@protoc_insertion_point(serialize_end:protobuf_unittest.TestTableDrivenLite.OptionalGroup)
+}
+
+::google::protobuf::uint8* TestTableDrivenLite_OptionalGroup::InternalSerializeWithCachedSizesToArray(
+    bool deterministic, ::google::protobuf::uint8* target) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.TestTableDrivenLite.OptionalGroup)
+  target = ::google::protobuf::internal::TableSerializeToArray(
+      this,
+      protobuf_google_2fprotobuf_2funittest_5ftable_5fdriven_5flite_2eproto::TableStruct::serialization_table[
+        TestTableDrivenLite_OptionalGroup::kIndexInFileMessages],
+      deterministic, target);
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.TestTableDrivenLite.OptionalGroup)
+  return target;
+}
+
+size_t TestTableDrivenLite_OptionalGroup::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.TestTableDrivenLite.OptionalGroup)
+  return ::google::protobuf::internal::TableByteSize(
+      this,
+      protobuf_google_2fprotobuf_2funittest_5ftable_5fdriven_5flite_2eproto::TableStruct::serialization_table[
+        TestTableDrivenLite_OptionalGroup::kIndexInFileMessages]);
+}
+
+void TestTableDrivenLite_OptionalGroup::CheckTypeAndMergeFrom(
+    const ::google::protobuf::MessageLite& from) {
+  MergeFrom(*::google::protobuf::down_cast<const TestTableDrivenLite_OptionalGroup*>(&from));
+}
+
+void TestTableDrivenLite_OptionalGroup::MergeFrom(const TestTableDrivenLite_OptionalGroup& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.TestTableDrivenLite.OptionalGroup)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.has_a()) {
+    set_a(from.a());
+  }
+}
+
+void TestTableDrivenLite_OptionalGroup::CopyFrom(const TestTableDrivenLite_OptionalGroup& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.TestTableDrivenLite.OptionalGroup)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TestTableDrivenLite_OptionalGroup::IsInitialized() const {
+  return true;
+}
+
+void TestTableDrivenLite_OptionalGroup::Swap(TestTableDrivenLite_OptionalGroup* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void TestTableDrivenLite_OptionalGroup::InternalSwap(TestTableDrivenLite_OptionalGroup* other) {
+  std::swap(a_, other->a_);
+  std::swap(_has_bits_[0], other->_has_bits_[0]);
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  std::swap(_cached_size_, other->_cached_size_);
+}
+
+::std::string TestTableDrivenLite_OptionalGroup::GetTypeName() const {
+  return "protobuf_unittest.TestTableDrivenLite.OptionalGroup";
+}
+
+#if PROTOBUF_INLINE_NOT_IN_HEADERS
+// TestTableDrivenLite_OptionalGroup
+
+// optional int32 a = 17;
+bool TestTableDrivenLite_OptionalGroup::has_a() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+void TestTableDrivenLite_OptionalGroup::set_has_a() {
+  _has_bits_[0] |= 0x00000001u;
+}
+void TestTableDrivenLite_OptionalGroup::clear_has_a() {
+  _has_bits_[0] &= ~0x00000001u;
+}
+void TestTableDrivenLite_OptionalGroup::clear_a() {
+  a_ = 0;
+  clear_has_a();
+}
+::google::protobuf::int32 TestTableDrivenLite_OptionalGroup::a() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestTableDrivenLite.OptionalGroup.a)
+  return a_;
+}
+void TestTableDrivenLite_OptionalGroup::set_a(::google::protobuf::int32 value) {
+  set_has_a();
+  a_ = value;
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestTableDrivenLite.OptionalGroup.a)
+}
+
+#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
+
+// ===================================================================
+
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int TestTableDrivenLite_RepeatedGroup::kAFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+TestTableDrivenLite_RepeatedGroup::TestTableDrivenLite_RepeatedGroup()
+  : ::google::protobuf::MessageLite(), _internal_metadata_(NULL) {
+  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
+    protobuf_google_2fprotobuf_2funittest_5ftable_5fdriven_5flite_2eproto::InitDefaults();
+  }
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:protobuf_unittest.TestTableDrivenLite.RepeatedGroup)
+}
+TestTableDrivenLite_RepeatedGroup::TestTableDrivenLite_RepeatedGroup(const TestTableDrivenLite_RepeatedGroup& from)
+  : ::google::protobuf::MessageLite(),
+      _internal_metadata_(NULL),
+      _has_bits_(from._has_bits_),
+      _cached_size_(0) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  a_ = from.a_;
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.TestTableDrivenLite.RepeatedGroup)
+}
+
+void TestTableDrivenLite_RepeatedGroup::SharedCtor() {
+  _cached_size_ = 0;
+  a_ = 0;
+}
+
+TestTableDrivenLite_RepeatedGroup::~TestTableDrivenLite_RepeatedGroup() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.TestTableDrivenLite.RepeatedGroup)
+  SharedDtor();
+}
+
+void TestTableDrivenLite_RepeatedGroup::SharedDtor() {
+}
+
+void TestTableDrivenLite_RepeatedGroup::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const TestTableDrivenLite_RepeatedGroup& TestTableDrivenLite_RepeatedGroup::default_instance() {
+  protobuf_google_2fprotobuf_2funittest_5ftable_5fdriven_5flite_2eproto::InitDefaults();
+  return *internal_default_instance();
+}
+
+TestTableDrivenLite_RepeatedGroup* TestTableDrivenLite_RepeatedGroup::New(::google::protobuf::Arena* arena) const {
+  TestTableDrivenLite_RepeatedGroup* n = new TestTableDrivenLite_RepeatedGroup;
+  if (arena != NULL) {
+    arena->Own(n);
+  }
+  return n;
+}
+
+void TestTableDrivenLite_RepeatedGroup::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.TestTableDrivenLite.RepeatedGroup)
+  a_ = 0;
+  _has_bits_.Clear();
+  _internal_metadata_.Clear();
+}
+
+bool TestTableDrivenLite_RepeatedGroup::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  ::google::protobuf::io::LazyStringOutputStream unknown_fields_string(
+      ::google::protobuf::NewPermanentCallback(&_internal_metadata_,
+          &::google::protobuf::internal::InternalMetadataWithArenaLite::
+              mutable_unknown_fields));
+  ::google::protobuf::io::CodedOutputStream unknown_fields_stream(
+      &unknown_fields_string, false);
+  // @@protoc_insertion_point(parse_start:protobuf_unittest.TestTableDrivenLite.RepeatedGroup)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoff(16383u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // optional int32 a = 47;
+      case 47: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(376u)) {
+          set_has_a();
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, &a_)));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0 ||
+            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormatLite::SkipField(
+            input, tag, &unknown_fields_stream));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:protobuf_unittest.TestTableDrivenLite.RepeatedGroup)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:protobuf_unittest.TestTableDrivenLite.RepeatedGroup)
+  return false;
+#undef DO_
+}
+
+void TestTableDrivenLite_RepeatedGroup::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:protobuf_unittest.TestTableDrivenLite.RepeatedGroup)
+  ::google::protobuf::internal::TableSerialize(
+      this,
+      protobuf_google_2fprotobuf_2funittest_5ftable_5fdriven_5flite_2eproto::TableStruct::serialization_table[
+        TestTableDrivenLite_RepeatedGroup::kIndexInFileMessages],
+      output);
+  // @@protoc_insertion_point(serialize_end:protobuf_unittest.TestTableDrivenLite.RepeatedGroup)
+}
+
+::google::protobuf::uint8* TestTableDrivenLite_RepeatedGroup::InternalSerializeWithCachedSizesToArray(
+    bool deterministic, ::google::protobuf::uint8* target) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.TestTableDrivenLite.RepeatedGroup)
+  target = ::google::protobuf::internal::TableSerializeToArray(
+      this,
+      protobuf_google_2fprotobuf_2funittest_5ftable_5fdriven_5flite_2eproto::TableStruct::serialization_table[
+        TestTableDrivenLite_RepeatedGroup::kIndexInFileMessages],
+      deterministic, target);
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.TestTableDrivenLite.RepeatedGroup)
+  return target;
+}
+
+size_t TestTableDrivenLite_RepeatedGroup::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.TestTableDrivenLite.RepeatedGroup)
+  return ::google::protobuf::internal::TableByteSize(
+      this,
+      protobuf_google_2fprotobuf_2funittest_5ftable_5fdriven_5flite_2eproto::TableStruct::serialization_table[
+        TestTableDrivenLite_RepeatedGroup::kIndexInFileMessages]);
+}
+
+void TestTableDrivenLite_RepeatedGroup::CheckTypeAndMergeFrom(
+    const ::google::protobuf::MessageLite& from) {
+  MergeFrom(*::google::protobuf::down_cast<const TestTableDrivenLite_RepeatedGroup*>(&from));
+}
+
+void TestTableDrivenLite_RepeatedGroup::MergeFrom(const TestTableDrivenLite_RepeatedGroup& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.TestTableDrivenLite.RepeatedGroup)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  if (from.has_a()) {
+    set_a(from.a());
+  }
+}
+
+void TestTableDrivenLite_RepeatedGroup::CopyFrom(const TestTableDrivenLite_RepeatedGroup& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.TestTableDrivenLite.RepeatedGroup)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TestTableDrivenLite_RepeatedGroup::IsInitialized() const {
+  return true;
+}
+
+void TestTableDrivenLite_RepeatedGroup::Swap(TestTableDrivenLite_RepeatedGroup* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void TestTableDrivenLite_RepeatedGroup::InternalSwap(TestTableDrivenLite_RepeatedGroup* other) {
+  std::swap(a_, other->a_);
+  std::swap(_has_bits_[0], other->_has_bits_[0]);
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  std::swap(_cached_size_, other->_cached_size_);
+}
+
+::std::string TestTableDrivenLite_RepeatedGroup::GetTypeName() const {
+  return "protobuf_unittest.TestTableDrivenLite.RepeatedGroup";
+}
+
+#if PROTOBUF_INLINE_NOT_IN_HEADERS
+// TestTableDrivenLite_RepeatedGroup
+
+// optional int32 a = 47;
+bool TestTableDrivenLite_RepeatedGroup::has_a() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+void TestTableDrivenLite_RepeatedGroup::set_has_a() {
+  _has_bits_[0] |= 0x00000001u;
+}
+void TestTableDrivenLite_RepeatedGroup::clear_has_a() {
+  _has_bits_[0] &= ~0x00000001u;
+}
+void TestTableDrivenLite_RepeatedGroup::clear_a() {
+  a_ = 0;
+  clear_has_a();
+}
+::google::protobuf::int32 TestTableDrivenLite_RepeatedGroup::a() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestTableDrivenLite.RepeatedGroup.a)
+  return a_;
+}
+void TestTableDrivenLite_RepeatedGroup::set_a(::google::protobuf::int32 value) {
+  set_has_a();
+  a_ = value;
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestTableDrivenLite.RepeatedGroup.a)
+}
+
+#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
+
+// ===================================================================
+
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int TestTableDrivenLite::kOptionalInt32FieldNumber;
+const int TestTableDrivenLite::kOptionalInt64FieldNumber;
+const int TestTableDrivenLite::kOptionalUint32FieldNumber;
+const int TestTableDrivenLite::kOptionalUint64FieldNumber;
+const int TestTableDrivenLite::kOptionalSint32FieldNumber;
+const int TestTableDrivenLite::kOptionalSint64FieldNumber;
+const int TestTableDrivenLite::kOptionalFixed32FieldNumber;
+const int TestTableDrivenLite::kOptionalFixed64FieldNumber;
+const int TestTableDrivenLite::kOptionalSfixed32FieldNumber;
+const int TestTableDrivenLite::kOptionalSfixed64FieldNumber;
+const int TestTableDrivenLite::kOptionalFloatFieldNumber;
+const int TestTableDrivenLite::kOptionalDoubleFieldNumber;
+const int TestTableDrivenLite::kOptionalBoolFieldNumber;
+const int TestTableDrivenLite::kOptionalStringFieldNumber;
+const int TestTableDrivenLite::kOptionalBytesFieldNumber;
+const int TestTableDrivenLite::kOptionalgroupFieldNumber;
+const int TestTableDrivenLite::kOptionalNestedMessageFieldNumber;
+const int TestTableDrivenLite::kOptionalForeignMessageFieldNumber;
+const int TestTableDrivenLite::kOptionalNestedEnumFieldNumber;
+const int TestTableDrivenLite::kOptionalForeignEnumFieldNumber;
+const int TestTableDrivenLite::kRepeatedInt32FieldNumber;
+const int TestTableDrivenLite::kRepeatedInt64FieldNumber;
+const int TestTableDrivenLite::kRepeatedUint32FieldNumber;
+const int TestTableDrivenLite::kRepeatedUint64FieldNumber;
+const int TestTableDrivenLite::kRepeatedSint32FieldNumber;
+const int TestTableDrivenLite::kRepeatedSint64FieldNumber;
+const int TestTableDrivenLite::kRepeatedFixed32FieldNumber;
+const int TestTableDrivenLite::kRepeatedFixed64FieldNumber;
+const int TestTableDrivenLite::kRepeatedSfixed32FieldNumber;
+const int TestTableDrivenLite::kRepeatedSfixed64FieldNumber;
+const int TestTableDrivenLite::kRepeatedFloatFieldNumber;
+const int TestTableDrivenLite::kRepeatedDoubleFieldNumber;
+const int TestTableDrivenLite::kRepeatedBoolFieldNumber;
+const int TestTableDrivenLite::kRepeatedStringFieldNumber;
+const int TestTableDrivenLite::kRepeatedBytesFieldNumber;
+const int TestTableDrivenLite::kRepeatedgroupFieldNumber;
+const int TestTableDrivenLite::kRepeatedNestedMessageFieldNumber;
+const int TestTableDrivenLite::kRepeatedForeignMessageFieldNumber;
+const int TestTableDrivenLite::kRepeatedNestedEnumFieldNumber;
+const int TestTableDrivenLite::kRepeatedForeignEnumFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+TestTableDrivenLite::TestTableDrivenLite()
+  : ::google::protobuf::MessageLite(), _internal_metadata_(NULL) {
+  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
+    protobuf_google_2fprotobuf_2funittest_5ftable_5fdriven_5flite_2eproto::InitDefaults();
+  }
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:protobuf_unittest.TestTableDrivenLite)
+}
+TestTableDrivenLite::TestTableDrivenLite(const TestTableDrivenLite& from)
+  : ::google::protobuf::MessageLite(),
+      _internal_metadata_(NULL),
+      _has_bits_(from._has_bits_),
+      _cached_size_(0),
+      repeated_int32_(from.repeated_int32_),
+      repeated_int64_(from.repeated_int64_),
+      repeated_uint32_(from.repeated_uint32_),
+      repeated_uint64_(from.repeated_uint64_),
+      repeated_sint32_(from.repeated_sint32_),
+      repeated_sint64_(from.repeated_sint64_),
+      repeated_fixed32_(from.repeated_fixed32_),
+      repeated_fixed64_(from.repeated_fixed64_),
+      repeated_sfixed32_(from.repeated_sfixed32_),
+      repeated_sfixed64_(from.repeated_sfixed64_),
+      repeated_float_(from.repeated_float_),
+      repeated_double_(from.repeated_double_),
+      repeated_bool_(from.repeated_bool_),
+      repeated_string_(from.repeated_string_),
+      repeated_bytes_(from.repeated_bytes_),
+      repeatedgroup_(from.repeatedgroup_),
+      repeated_nested_message_(from.repeated_nested_message_),
+      repeated_foreign_message_(from.repeated_foreign_message_),
+      repeated_nested_enum_(from.repeated_nested_enum_),
+      repeated_foreign_enum_(from.repeated_foreign_enum_) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  optional_string_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (from.has_optional_string()) {
+    optional_string_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.optional_string_);
+  }
+  optional_bytes_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (from.has_optional_bytes()) {
+    optional_bytes_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.optional_bytes_);
+  }
+  if (from.has_optionalgroup()) {
+    optionalgroup_ = new ::protobuf_unittest::TestTableDrivenLite_OptionalGroup(*from.optionalgroup_);
+  } else {
+    optionalgroup_ = NULL;
+  }
+  if (from.has_optional_nested_message()) {
+    optional_nested_message_ = new ::protobuf_unittest::TestTableDrivenLite_NestedMessage(*from.optional_nested_message_);
+  } else {
+    optional_nested_message_ = NULL;
+  }
+  if (from.has_optional_foreign_message()) {
+    optional_foreign_message_ = new ::protobuf_unittest::ForeignMessageLite(*from.optional_foreign_message_);
+  } else {
+    optional_foreign_message_ = NULL;
+  }
+  ::memcpy(&optional_int64_, &from.optional_int64_,
+    reinterpret_cast<char*>(&optional_foreign_enum_) -
+    reinterpret_cast<char*>(&optional_int64_) + sizeof(optional_foreign_enum_));
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.TestTableDrivenLite)
+}
+
+void TestTableDrivenLite::SharedCtor() {
+  _cached_size_ = 0;
+  optional_string_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  optional_bytes_.UnsafeSetDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  ::memset(&optionalgroup_, 0, reinterpret_cast<char*>(&optional_bool_) -
+    reinterpret_cast<char*>(&optionalgroup_) + sizeof(optional_bool_));
+  optional_nested_enum_ = 1;
+  optional_foreign_enum_ = 4;
+}
+
+TestTableDrivenLite::~TestTableDrivenLite() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.TestTableDrivenLite)
+  SharedDtor();
+}
+
+void TestTableDrivenLite::SharedDtor() {
+  optional_string_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  optional_bytes_.DestroyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  if (this != internal_default_instance()) {
+    delete optionalgroup_;
+  }
+  if (this != internal_default_instance()) {
+    delete optional_nested_message_;
+  }
+  if (this != internal_default_instance()) {
+    delete optional_foreign_message_;
+  }
+}
+
+void TestTableDrivenLite::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const TestTableDrivenLite& TestTableDrivenLite::default_instance() {
+  protobuf_google_2fprotobuf_2funittest_5ftable_5fdriven_5flite_2eproto::InitDefaults();
+  return *internal_default_instance();
+}
+
+TestTableDrivenLite* TestTableDrivenLite::New(::google::protobuf::Arena* arena) const {
+  TestTableDrivenLite* n = new TestTableDrivenLite;
+  if (arena != NULL) {
+    arena->Own(n);
+  }
+  return n;
+}
+
+void TestTableDrivenLite::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.TestTableDrivenLite)
+  repeated_int32_.Clear();
+  repeated_int64_.Clear();
+  repeated_uint32_.Clear();
+  repeated_uint64_.Clear();
+  repeated_sint32_.Clear();
+  repeated_sint64_.Clear();
+  repeated_fixed32_.Clear();
+  repeated_fixed64_.Clear();
+  repeated_sfixed32_.Clear();
+  repeated_sfixed64_.Clear();
+  repeated_float_.Clear();
+  repeated_double_.Clear();
+  repeated_bool_.Clear();
+  repeated_string_.Clear();
+  repeated_bytes_.Clear();
+  repeatedgroup_.Clear();
+  repeated_nested_message_.Clear();
+  repeated_foreign_message_.Clear();
+  repeated_nested_enum_.Clear();
+  repeated_foreign_enum_.Clear();
+  if (_has_bits_[0 / 32] & 31u) {
+    if (has_optional_string()) {
+      GOOGLE_DCHECK(!optional_string_.IsDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited()));
+      (*optional_string_.UnsafeRawStringPointer())->clear();
+    }
+    if (has_optional_bytes()) {
+      GOOGLE_DCHECK(!optional_bytes_.IsDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited()));
+      (*optional_bytes_.UnsafeRawStringPointer())->clear();
+    }
+    if (has_optionalgroup()) {
+      GOOGLE_DCHECK(optionalgroup_ != NULL);
+      optionalgroup_->::protobuf_unittest::TestTableDrivenLite_OptionalGroup::Clear();
+    }
+    if (has_optional_nested_message()) {
+      GOOGLE_DCHECK(optional_nested_message_ != NULL);
+      optional_nested_message_->::protobuf_unittest::TestTableDrivenLite_NestedMessage::Clear();
+    }
+    if (has_optional_foreign_message()) {
+      GOOGLE_DCHECK(optional_foreign_message_ != NULL);
+      optional_foreign_message_->::protobuf_unittest::ForeignMessageLite::Clear();
+    }
+  }
+  if (_has_bits_[0 / 32] & 224u) {
+    ::memset(&optional_int64_, 0, reinterpret_cast<char*>(&optional_uint32_) -
+      reinterpret_cast<char*>(&optional_int64_) + sizeof(optional_uint32_));
+  }
+  if (_has_bits_[8 / 32] & 65280u) {
+    ::memset(&optional_uint64_, 0, reinterpret_cast<char*>(&optional_float_) -
+      reinterpret_cast<char*>(&optional_uint64_) + sizeof(optional_float_));
+  }
+  if (_has_bits_[16 / 32] & 983040u) {
+    ::memset(&optional_double_, 0, reinterpret_cast<char*>(&optional_bool_) -
+      reinterpret_cast<char*>(&optional_double_) + sizeof(optional_bool_));
+    optional_nested_enum_ = 1;
+    optional_foreign_enum_ = 4;
+  }
+  _has_bits_.Clear();
+  _internal_metadata_.Clear();
+}
+
+bool TestTableDrivenLite::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+  return ::google::protobuf::internal::MergePartialFromCodedStream(
+      this,
+      protobuf_google_2fprotobuf_2funittest_5ftable_5fdriven_5flite_2eproto::TableStruct::schema[
+        TestTableDrivenLite::kIndexInFileMessages],
+      input);
+}
+
+void TestTableDrivenLite::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:protobuf_unittest.TestTableDrivenLite)
+  ::google::protobuf::internal::TableSerialize(
+      this,
+      protobuf_google_2fprotobuf_2funittest_5ftable_5fdriven_5flite_2eproto::TableStruct::serialization_table[
+        TestTableDrivenLite::kIndexInFileMessages],
+      output);
+  // @@protoc_insertion_point(serialize_end:protobuf_unittest.TestTableDrivenLite)
+}
+
+::google::protobuf::uint8* TestTableDrivenLite::InternalSerializeWithCachedSizesToArray(
+    bool deterministic, ::google::protobuf::uint8* target) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.TestTableDrivenLite)
+  target = ::google::protobuf::internal::TableSerializeToArray(
+      this,
+      protobuf_google_2fprotobuf_2funittest_5ftable_5fdriven_5flite_2eproto::TableStruct::serialization_table[
+        TestTableDrivenLite::kIndexInFileMessages],
+      deterministic, target);
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.TestTableDrivenLite)
+  return target;
+}
+
+size_t TestTableDrivenLite::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.TestTableDrivenLite)
+  return ::google::protobuf::internal::TableByteSize(
+      this,
+      protobuf_google_2fprotobuf_2funittest_5ftable_5fdriven_5flite_2eproto::TableStruct::serialization_table[
+        TestTableDrivenLite::kIndexInFileMessages]);
+}
+
+void TestTableDrivenLite::CheckTypeAndMergeFrom(
+    const ::google::protobuf::MessageLite& from) {
+  MergeFrom(*::google::protobuf::down_cast<const TestTableDrivenLite*>(&from));
+}
+
+void TestTableDrivenLite::MergeFrom(const TestTableDrivenLite& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.TestTableDrivenLite)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  repeated_int32_.MergeFrom(from.repeated_int32_);
+  repeated_int64_.MergeFrom(from.repeated_int64_);
+  repeated_uint32_.MergeFrom(from.repeated_uint32_);
+  repeated_uint64_.MergeFrom(from.repeated_uint64_);
+  repeated_sint32_.MergeFrom(from.repeated_sint32_);
+  repeated_sint64_.MergeFrom(from.repeated_sint64_);
+  repeated_fixed32_.MergeFrom(from.repeated_fixed32_);
+  repeated_fixed64_.MergeFrom(from.repeated_fixed64_);
+  repeated_sfixed32_.MergeFrom(from.repeated_sfixed32_);
+  repeated_sfixed64_.MergeFrom(from.repeated_sfixed64_);
+  repeated_float_.MergeFrom(from.repeated_float_);
+  repeated_double_.MergeFrom(from.repeated_double_);
+  repeated_bool_.MergeFrom(from.repeated_bool_);
+  repeated_string_.MergeFrom(from.repeated_string_);
+  repeated_bytes_.MergeFrom(from.repeated_bytes_);
+  repeatedgroup_.MergeFrom(from.repeatedgroup_);
+  repeated_nested_message_.MergeFrom(from.repeated_nested_message_);
+  repeated_foreign_message_.MergeFrom(from.repeated_foreign_message_);
+  repeated_nested_enum_.MergeFrom(from.repeated_nested_enum_);
+  repeated_foreign_enum_.MergeFrom(from.repeated_foreign_enum_);
+  cached_has_bits = from._has_bits_[0];
+  if (cached_has_bits & 255u) {
+    if (cached_has_bits & 0x00000001u) {
+      set_has_optional_string();
+      optional_string_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.optional_string_);
+    }
+    if (cached_has_bits & 0x00000002u) {
+      set_has_optional_bytes();
+      optional_bytes_.AssignWithDefault(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), from.optional_bytes_);
+    }
+    if (cached_has_bits & 0x00000004u) {
+      mutable_optionalgroup()->::protobuf_unittest::TestTableDrivenLite_OptionalGroup::MergeFrom(from.optionalgroup());
+    }
+    if (cached_has_bits & 0x00000008u) {
+      mutable_optional_nested_message()->::protobuf_unittest::TestTableDrivenLite_NestedMessage::MergeFrom(from.optional_nested_message());
+    }
+    if (cached_has_bits & 0x00000010u) {
+      mutable_optional_foreign_message()->::protobuf_unittest::ForeignMessageLite::MergeFrom(from.optional_foreign_message());
+    }
+    if (cached_has_bits & 0x00000020u) {
+      optional_int64_ = from.optional_int64_;
+    }
+    if (cached_has_bits & 0x00000040u) {
+      optional_int32_ = from.optional_int32_;
+    }
+    if (cached_has_bits & 0x00000080u) {
+      optional_uint32_ = from.optional_uint32_;
+    }
+    _has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 65280u) {
+    if (cached_has_bits & 0x00000100u) {
+      optional_uint64_ = from.optional_uint64_;
+    }
+    if (cached_has_bits & 0x00000200u) {
+      optional_sint64_ = from.optional_sint64_;
+    }
+    if (cached_has_bits & 0x00000400u) {
+      optional_sint32_ = from.optional_sint32_;
+    }
+    if (cached_has_bits & 0x00000800u) {
+      optional_fixed32_ = from.optional_fixed32_;
+    }
+    if (cached_has_bits & 0x00001000u) {
+      optional_fixed64_ = from.optional_fixed64_;
+    }
+    if (cached_has_bits & 0x00002000u) {
+      optional_sfixed64_ = from.optional_sfixed64_;
+    }
+    if (cached_has_bits & 0x00004000u) {
+      optional_sfixed32_ = from.optional_sfixed32_;
+    }
+    if (cached_has_bits & 0x00008000u) {
+      optional_float_ = from.optional_float_;
+    }
+    _has_bits_[0] |= cached_has_bits;
+  }
+  if (cached_has_bits & 983040u) {
+    if (cached_has_bits & 0x00010000u) {
+      optional_double_ = from.optional_double_;
+    }
+    if (cached_has_bits & 0x00020000u) {
+      optional_bool_ = from.optional_bool_;
+    }
+    if (cached_has_bits & 0x00040000u) {
+      optional_nested_enum_ = from.optional_nested_enum_;
+    }
+    if (cached_has_bits & 0x00080000u) {
+      optional_foreign_enum_ = from.optional_foreign_enum_;
+    }
+    _has_bits_[0] |= cached_has_bits;
+  }
+}
+
+void TestTableDrivenLite::CopyFrom(const TestTableDrivenLite& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.TestTableDrivenLite)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TestTableDrivenLite::IsInitialized() const {
+  return true;
+}
+
+void TestTableDrivenLite::Swap(TestTableDrivenLite* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void TestTableDrivenLite::InternalSwap(TestTableDrivenLite* other) {
+  repeated_int32_.InternalSwap(&other->repeated_int32_);
+  repeated_int64_.InternalSwap(&other->repeated_int64_);
+  repeated_uint32_.InternalSwap(&other->repeated_uint32_);
+  repeated_uint64_.InternalSwap(&other->repeated_uint64_);
+  repeated_sint32_.InternalSwap(&other->repeated_sint32_);
+  repeated_sint64_.InternalSwap(&other->repeated_sint64_);
+  repeated_fixed32_.InternalSwap(&other->repeated_fixed32_);
+  repeated_fixed64_.InternalSwap(&other->repeated_fixed64_);
+  repeated_sfixed32_.InternalSwap(&other->repeated_sfixed32_);
+  repeated_sfixed64_.InternalSwap(&other->repeated_sfixed64_);
+  repeated_float_.InternalSwap(&other->repeated_float_);
+  repeated_double_.InternalSwap(&other->repeated_double_);
+  repeated_bool_.InternalSwap(&other->repeated_bool_);
+  repeated_string_.InternalSwap(&other->repeated_string_);
+  repeated_bytes_.InternalSwap(&other->repeated_bytes_);
+  repeatedgroup_.InternalSwap(&other->repeatedgroup_);
+  repeated_nested_message_.InternalSwap(&other->repeated_nested_message_);
+  repeated_foreign_message_.InternalSwap(&other->repeated_foreign_message_);
+  repeated_nested_enum_.InternalSwap(&other->repeated_nested_enum_);
+  repeated_foreign_enum_.InternalSwap(&other->repeated_foreign_enum_);
+  optional_string_.Swap(&other->optional_string_);
+  optional_bytes_.Swap(&other->optional_bytes_);
+  std::swap(optionalgroup_, other->optionalgroup_);
+  std::swap(optional_nested_message_, other->optional_nested_message_);
+  std::swap(optional_foreign_message_, other->optional_foreign_message_);
+  std::swap(optional_int64_, other->optional_int64_);
+  std::swap(optional_int32_, other->optional_int32_);
+  std::swap(optional_uint32_, other->optional_uint32_);
+  std::swap(optional_uint64_, other->optional_uint64_);
+  std::swap(optional_sint64_, other->optional_sint64_);
+  std::swap(optional_sint32_, other->optional_sint32_);
+  std::swap(optional_fixed32_, other->optional_fixed32_);
+  std::swap(optional_fixed64_, other->optional_fixed64_);
+  std::swap(optional_sfixed64_, other->optional_sfixed64_);
+  std::swap(optional_sfixed32_, other->optional_sfixed32_);
+  std::swap(optional_float_, other->optional_float_);
+  std::swap(optional_double_, other->optional_double_);
+  std::swap(optional_bool_, other->optional_bool_);
+  std::swap(optional_nested_enum_, other->optional_nested_enum_);
+  std::swap(optional_foreign_enum_, other->optional_foreign_enum_);
+  std::swap(_has_bits_[0], other->_has_bits_[0]);
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  std::swap(_cached_size_, other->_cached_size_);
+}
+
+::std::string TestTableDrivenLite::GetTypeName() const {
+  return "protobuf_unittest.TestTableDrivenLite";
+}
+
+#if PROTOBUF_INLINE_NOT_IN_HEADERS
+// TestTableDrivenLite
+
+// optional int32 optional_int32 = 1;
+bool TestTableDrivenLite::has_optional_int32() const {
+  return (_has_bits_[0] & 0x00000040u) != 0;
+}
+void TestTableDrivenLite::set_has_optional_int32() {
+  _has_bits_[0] |= 0x00000040u;
+}
+void TestTableDrivenLite::clear_has_optional_int32() {
+  _has_bits_[0] &= ~0x00000040u;
+}
+void TestTableDrivenLite::clear_optional_int32() {
+  optional_int32_ = 0;
+  clear_has_optional_int32();
+}
+::google::protobuf::int32 TestTableDrivenLite::optional_int32() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestTableDrivenLite.optional_int32)
+  return optional_int32_;
+}
+void TestTableDrivenLite::set_optional_int32(::google::protobuf::int32 value) {
+  set_has_optional_int32();
+  optional_int32_ = value;
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestTableDrivenLite.optional_int32)
+}
+
+// optional int64 optional_int64 = 2;
+bool TestTableDrivenLite::has_optional_int64() const {
+  return (_has_bits_[0] & 0x00000020u) != 0;
+}
+void TestTableDrivenLite::set_has_optional_int64() {
+  _has_bits_[0] |= 0x00000020u;
+}
+void TestTableDrivenLite::clear_has_optional_int64() {
+  _has_bits_[0] &= ~0x00000020u;
+}
+void TestTableDrivenLite::clear_optional_int64() {
+  optional_int64_ = GOOGLE_LONGLONG(0);
+  clear_has_optional_int64();
+}
+::google::protobuf::int64 TestTableDrivenLite::optional_int64() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestTableDrivenLite.optional_int64)
+  return optional_int64_;
+}
+void TestTableDrivenLite::set_optional_int64(::google::protobuf::int64 value) {
+  set_has_optional_int64();
+  optional_int64_ = value;
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestTableDrivenLite.optional_int64)
+}
+
+// optional uint32 optional_uint32 = 3;
+bool TestTableDrivenLite::has_optional_uint32() const {
+  return (_has_bits_[0] & 0x00000080u) != 0;
+}
+void TestTableDrivenLite::set_has_optional_uint32() {
+  _has_bits_[0] |= 0x00000080u;
+}
+void TestTableDrivenLite::clear_has_optional_uint32() {
+  _has_bits_[0] &= ~0x00000080u;
+}
+void TestTableDrivenLite::clear_optional_uint32() {
+  optional_uint32_ = 0u;
+  clear_has_optional_uint32();
+}
+::google::protobuf::uint32 TestTableDrivenLite::optional_uint32() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestTableDrivenLite.optional_uint32)
+  return optional_uint32_;
+}
+void TestTableDrivenLite::set_optional_uint32(::google::protobuf::uint32 value) {
+  set_has_optional_uint32();
+  optional_uint32_ = value;
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestTableDrivenLite.optional_uint32)
+}
+
+// optional uint64 optional_uint64 = 4;
+bool TestTableDrivenLite::has_optional_uint64() const {
+  return (_has_bits_[0] & 0x00000100u) != 0;
+}
+void TestTableDrivenLite::set_has_optional_uint64() {
+  _has_bits_[0] |= 0x00000100u;
+}
+void TestTableDrivenLite::clear_has_optional_uint64() {
+  _has_bits_[0] &= ~0x00000100u;
+}
+void TestTableDrivenLite::clear_optional_uint64() {
+  optional_uint64_ = GOOGLE_ULONGLONG(0);
+  clear_has_optional_uint64();
+}
+::google::protobuf::uint64 TestTableDrivenLite::optional_uint64() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestTableDrivenLite.optional_uint64)
+  return optional_uint64_;
+}
+void TestTableDrivenLite::set_optional_uint64(::google::protobuf::uint64 value) {
+  set_has_optional_uint64();
+  optional_uint64_ = value;
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestTableDrivenLite.optional_uint64)
+}
+
+// optional sint32 optional_sint32 = 5;
+bool TestTableDrivenLite::has_optional_sint32() const {
+  return (_has_bits_[0] & 0x00000400u) != 0;
+}
+void TestTableDrivenLite::set_has_optional_sint32() {
+  _has_bits_[0] |= 0x00000400u;
+}
+void TestTableDrivenLite::clear_has_optional_sint32() {
+  _has_bits_[0] &= ~0x00000400u;
+}
+void TestTableDrivenLite::clear_optional_sint32() {
+  optional_sint32_ = 0;
+  clear_has_optional_sint32();
+}
+::google::protobuf::int32 TestTableDrivenLite::optional_sint32() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestTableDrivenLite.optional_sint32)
+  return optional_sint32_;
+}
+void TestTableDrivenLite::set_optional_sint32(::google::protobuf::int32 value) {
+  set_has_optional_sint32();
+  optional_sint32_ = value;
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestTableDrivenLite.optional_sint32)
+}
+
+// optional sint64 optional_sint64 = 6;
+bool TestTableDrivenLite::has_optional_sint64() const {
+  return (_has_bits_[0] & 0x00000200u) != 0;
+}
+void TestTableDrivenLite::set_has_optional_sint64() {
+  _has_bits_[0] |= 0x00000200u;
+}
+void TestTableDrivenLite::clear_has_optional_sint64() {
+  _has_bits_[0] &= ~0x00000200u;
+}
+void TestTableDrivenLite::clear_optional_sint64() {
+  optional_sint64_ = GOOGLE_LONGLONG(0);
+  clear_has_optional_sint64();
+}
+::google::protobuf::int64 TestTableDrivenLite::optional_sint64() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestTableDrivenLite.optional_sint64)
+  return optional_sint64_;
+}
+void TestTableDrivenLite::set_optional_sint64(::google::protobuf::int64 value) {
+  set_has_optional_sint64();
+  optional_sint64_ = value;
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestTableDrivenLite.optional_sint64)
+}
+
+// optional fixed32 optional_fixed32 = 7;
+bool TestTableDrivenLite::has_optional_fixed32() const {
+  return (_has_bits_[0] & 0x00000800u) != 0;
+}
+void TestTableDrivenLite::set_has_optional_fixed32() {
+  _has_bits_[0] |= 0x00000800u;
+}
+void TestTableDrivenLite::clear_has_optional_fixed32() {
+  _has_bits_[0] &= ~0x00000800u;
+}
+void TestTableDrivenLite::clear_optional_fixed32() {
+  optional_fixed32_ = 0u;
+  clear_has_optional_fixed32();
+}
+::google::protobuf::uint32 TestTableDrivenLite::optional_fixed32() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestTableDrivenLite.optional_fixed32)
+  return optional_fixed32_;
+}
+void TestTableDrivenLite::set_optional_fixed32(::google::protobuf::uint32 value) {
+  set_has_optional_fixed32();
+  optional_fixed32_ = value;
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestTableDrivenLite.optional_fixed32)
+}
+
+// optional fixed64 optional_fixed64 = 8;
+bool TestTableDrivenLite::has_optional_fixed64() const {
+  return (_has_bits_[0] & 0x00001000u) != 0;
+}
+void TestTableDrivenLite::set_has_optional_fixed64() {
+  _has_bits_[0] |= 0x00001000u;
+}
+void TestTableDrivenLite::clear_has_optional_fixed64() {
+  _has_bits_[0] &= ~0x00001000u;
+}
+void TestTableDrivenLite::clear_optional_fixed64() {
+  optional_fixed64_ = GOOGLE_ULONGLONG(0);
+  clear_has_optional_fixed64();
+}
+::google::protobuf::uint64 TestTableDrivenLite::optional_fixed64() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestTableDrivenLite.optional_fixed64)
+  return optional_fixed64_;
+}
+void TestTableDrivenLite::set_optional_fixed64(::google::protobuf::uint64 value) {
+  set_has_optional_fixed64();
+  optional_fixed64_ = value;
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestTableDrivenLite.optional_fixed64)
+}
+
+// optional sfixed32 optional_sfixed32 = 9;
+bool TestTableDrivenLite::has_optional_sfixed32() const {
+  return (_has_bits_[0] & 0x00004000u) != 0;
+}
+void TestTableDrivenLite::set_has_optional_sfixed32() {
+  _has_bits_[0] |= 0x00004000u;
+}
+void TestTableDrivenLite::clear_has_optional_sfixed32() {
+  _has_bits_[0] &= ~0x00004000u;
+}
+void TestTableDrivenLite::clear_optional_sfixed32() {
+  optional_sfixed32_ = 0;
+  clear_has_optional_sfixed32();
+}
+::google::protobuf::int32 TestTableDrivenLite::optional_sfixed32() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestTableDrivenLite.optional_sfixed32)
+  return optional_sfixed32_;
+}
+void TestTableDrivenLite::set_optional_sfixed32(::google::protobuf::int32 value) {
+  set_has_optional_sfixed32();
+  optional_sfixed32_ = value;
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestTableDrivenLite.optional_sfixed32)
+}
+
+// optional sfixed64 optional_sfixed64 = 10;
+bool TestTableDrivenLite::has_optional_sfixed64() const {
+  return (_has_bits_[0] & 0x00002000u) != 0;
+}
+void TestTableDrivenLite::set_has_optional_sfixed64() {
+  _has_bits_[0] |= 0x00002000u;
+}
+void TestTableDrivenLite::clear_has_optional_sfixed64() {
+  _has_bits_[0] &= ~0x00002000u;
+}
+void TestTableDrivenLite::clear_optional_sfixed64() {
+  optional_sfixed64_ = GOOGLE_LONGLONG(0);
+  clear_has_optional_sfixed64();
+}
+::google::protobuf::int64 TestTableDrivenLite::optional_sfixed64() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestTableDrivenLite.optional_sfixed64)
+  return optional_sfixed64_;
+}
+void TestTableDrivenLite::set_optional_sfixed64(::google::protobuf::int64 value) {
+  set_has_optional_sfixed64();
+  optional_sfixed64_ = value;
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestTableDrivenLite.optional_sfixed64)
+}
+
+// optional float optional_float = 11;
+bool TestTableDrivenLite::has_optional_float() const {
+  return (_has_bits_[0] & 0x00008000u) != 0;
+}
+void TestTableDrivenLite::set_has_optional_float() {
+  _has_bits_[0] |= 0x00008000u;
+}
+void TestTableDrivenLite::clear_has_optional_float() {
+  _has_bits_[0] &= ~0x00008000u;
+}
+void TestTableDrivenLite::clear_optional_float() {
+  optional_float_ = 0;
+  clear_has_optional_float();
+}
+float TestTableDrivenLite::optional_float() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestTableDrivenLite.optional_float)
+  return optional_float_;
+}
+void TestTableDrivenLite::set_optional_float(float value) {
+  set_has_optional_float();
+  optional_float_ = value;
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestTableDrivenLite.optional_float)
+}
+
+// optional double optional_double = 12;
+bool TestTableDrivenLite::has_optional_double() const {
+  return (_has_bits_[0] & 0x00010000u) != 0;
+}
+void TestTableDrivenLite::set_has_optional_double() {
+  _has_bits_[0] |= 0x00010000u;
+}
+void TestTableDrivenLite::clear_has_optional_double() {
+  _has_bits_[0] &= ~0x00010000u;
+}
+void TestTableDrivenLite::clear_optional_double() {
+  optional_double_ = 0;
+  clear_has_optional_double();
+}
+double TestTableDrivenLite::optional_double() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestTableDrivenLite.optional_double)
+  return optional_double_;
+}
+void TestTableDrivenLite::set_optional_double(double value) {
+  set_has_optional_double();
+  optional_double_ = value;
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestTableDrivenLite.optional_double)
+}
+
+// optional bool optional_bool = 13;
+bool TestTableDrivenLite::has_optional_bool() const {
+  return (_has_bits_[0] & 0x00020000u) != 0;
+}
+void TestTableDrivenLite::set_has_optional_bool() {
+  _has_bits_[0] |= 0x00020000u;
+}
+void TestTableDrivenLite::clear_has_optional_bool() {
+  _has_bits_[0] &= ~0x00020000u;
+}
+void TestTableDrivenLite::clear_optional_bool() {
+  optional_bool_ = false;
+  clear_has_optional_bool();
+}
+bool TestTableDrivenLite::optional_bool() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestTableDrivenLite.optional_bool)
+  return optional_bool_;
+}
+void TestTableDrivenLite::set_optional_bool(bool value) {
+  set_has_optional_bool();
+  optional_bool_ = value;
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestTableDrivenLite.optional_bool)
+}
+
+// optional string optional_string = 14;
+bool TestTableDrivenLite::has_optional_string() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+void TestTableDrivenLite::set_has_optional_string() {
+  _has_bits_[0] |= 0x00000001u;
+}
+void TestTableDrivenLite::clear_has_optional_string() {
+  _has_bits_[0] &= ~0x00000001u;
+}
+void TestTableDrivenLite::clear_optional_string() {
+  optional_string_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  clear_has_optional_string();
+}
+const ::std::string& TestTableDrivenLite::optional_string() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestTableDrivenLite.optional_string)
+  return optional_string_.GetNoArena();
+}
+void TestTableDrivenLite::set_optional_string(const ::std::string& value) {
+  set_has_optional_string();
+  optional_string_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestTableDrivenLite.optional_string)
+}
+#if LANG_CXX11
+void TestTableDrivenLite::set_optional_string(::std::string&& value) {
+  set_has_optional_string();
+  optional_string_.SetNoArena(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:protobuf_unittest.TestTableDrivenLite.optional_string)
+}
+#endif
+void TestTableDrivenLite::set_optional_string(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  set_has_optional_string();
+  optional_string_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:protobuf_unittest.TestTableDrivenLite.optional_string)
+}
+void TestTableDrivenLite::set_optional_string(const char* value, size_t size) {
+  set_has_optional_string();
+  optional_string_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:protobuf_unittest.TestTableDrivenLite.optional_string)
+}
+::std::string* TestTableDrivenLite::mutable_optional_string() {
+  set_has_optional_string();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestTableDrivenLite.optional_string)
+  return optional_string_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+::std::string* TestTableDrivenLite::release_optional_string() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestTableDrivenLite.optional_string)
+  clear_has_optional_string();
+  return optional_string_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+void TestTableDrivenLite::set_allocated_optional_string(::std::string* optional_string) {
+  if (optional_string != NULL) {
+    set_has_optional_string();
+  } else {
+    clear_has_optional_string();
+  }
+  optional_string_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), optional_string);
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestTableDrivenLite.optional_string)
+}
+
+// optional bytes optional_bytes = 15;
+bool TestTableDrivenLite::has_optional_bytes() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
+}
+void TestTableDrivenLite::set_has_optional_bytes() {
+  _has_bits_[0] |= 0x00000002u;
+}
+void TestTableDrivenLite::clear_has_optional_bytes() {
+  _has_bits_[0] &= ~0x00000002u;
+}
+void TestTableDrivenLite::clear_optional_bytes() {
+  optional_bytes_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  clear_has_optional_bytes();
+}
+const ::std::string& TestTableDrivenLite::optional_bytes() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestTableDrivenLite.optional_bytes)
+  return optional_bytes_.GetNoArena();
+}
+void TestTableDrivenLite::set_optional_bytes(const ::std::string& value) {
+  set_has_optional_bytes();
+  optional_bytes_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestTableDrivenLite.optional_bytes)
+}
+#if LANG_CXX11
+void TestTableDrivenLite::set_optional_bytes(::std::string&& value) {
+  set_has_optional_bytes();
+  optional_bytes_.SetNoArena(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:protobuf_unittest.TestTableDrivenLite.optional_bytes)
+}
+#endif
+void TestTableDrivenLite::set_optional_bytes(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  set_has_optional_bytes();
+  optional_bytes_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:protobuf_unittest.TestTableDrivenLite.optional_bytes)
+}
+void TestTableDrivenLite::set_optional_bytes(const void* value, size_t size) {
+  set_has_optional_bytes();
+  optional_bytes_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:protobuf_unittest.TestTableDrivenLite.optional_bytes)
+}
+::std::string* TestTableDrivenLite::mutable_optional_bytes() {
+  set_has_optional_bytes();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestTableDrivenLite.optional_bytes)
+  return optional_bytes_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+::std::string* TestTableDrivenLite::release_optional_bytes() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestTableDrivenLite.optional_bytes)
+  clear_has_optional_bytes();
+  return optional_bytes_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+void TestTableDrivenLite::set_allocated_optional_bytes(::std::string* optional_bytes) {
+  if (optional_bytes != NULL) {
+    set_has_optional_bytes();
+  } else {
+    clear_has_optional_bytes();
+  }
+  optional_bytes_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), optional_bytes);
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestTableDrivenLite.optional_bytes)
+}
+
+// optional group OptionalGroup = 16 { ... };
+bool TestTableDrivenLite::has_optionalgroup() const {
+  return (_has_bits_[0] & 0x00000004u) != 0;
+}
+void TestTableDrivenLite::set_has_optionalgroup() {
+  _has_bits_[0] |= 0x00000004u;
+}
+void TestTableDrivenLite::clear_has_optionalgroup() {
+  _has_bits_[0] &= ~0x00000004u;
+}
+void TestTableDrivenLite::clear_optionalgroup() {
+  if (optionalgroup_ != NULL) optionalgroup_->::protobuf_unittest::TestTableDrivenLite_OptionalGroup::Clear();
+  clear_has_optionalgroup();
+}
+const ::protobuf_unittest::TestTableDrivenLite_OptionalGroup& TestTableDrivenLite::optionalgroup() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestTableDrivenLite.optionalgroup)
+  return optionalgroup_ != NULL ? *optionalgroup_
+                         : *::protobuf_unittest::TestTableDrivenLite_OptionalGroup::internal_default_instance();
+}
+::protobuf_unittest::TestTableDrivenLite_OptionalGroup* TestTableDrivenLite::mutable_optionalgroup() {
+  set_has_optionalgroup();
+  if (optionalgroup_ == NULL) {
+    optionalgroup_ = new ::protobuf_unittest::TestTableDrivenLite_OptionalGroup;
+  }
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestTableDrivenLite.optionalgroup)
+  return optionalgroup_;
+}
+::protobuf_unittest::TestTableDrivenLite_OptionalGroup* TestTableDrivenLite::release_optionalgroup() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestTableDrivenLite.optionalgroup)
+  clear_has_optionalgroup();
+  ::protobuf_unittest::TestTableDrivenLite_OptionalGroup* temp = optionalgroup_;
+  optionalgroup_ = NULL;
+  return temp;
+}
+void TestTableDrivenLite::set_allocated_optionalgroup(::protobuf_unittest::TestTableDrivenLite_OptionalGroup* optionalgroup) {
+  delete optionalgroup_;
+  optionalgroup_ = optionalgroup;
+  if (optionalgroup) {
+    set_has_optionalgroup();
+  } else {
+    clear_has_optionalgroup();
+  }
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestTableDrivenLite.optionalgroup)
+}
+
+// optional .protobuf_unittest.TestTableDrivenLite.NestedMessage optional_nested_message = 18;
+bool TestTableDrivenLite::has_optional_nested_message() const {
+  return (_has_bits_[0] & 0x00000008u) != 0;
+}
+void TestTableDrivenLite::set_has_optional_nested_message() {
+  _has_bits_[0] |= 0x00000008u;
+}
+void TestTableDrivenLite::clear_has_optional_nested_message() {
+  _has_bits_[0] &= ~0x00000008u;
+}
+void TestTableDrivenLite::clear_optional_nested_message() {
+  if (optional_nested_message_ != NULL) optional_nested_message_->::protobuf_unittest::TestTableDrivenLite_NestedMessage::Clear();
+  clear_has_optional_nested_message();
+}
+const ::protobuf_unittest::TestTableDrivenLite_NestedMessage& TestTableDrivenLite::optional_nested_message() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestTableDrivenLite.optional_nested_message)
+  return optional_nested_message_ != NULL ? *optional_nested_message_
+                         : *::protobuf_unittest::TestTableDrivenLite_NestedMessage::internal_default_instance();
+}
+::protobuf_unittest::TestTableDrivenLite_NestedMessage* TestTableDrivenLite::mutable_optional_nested_message() {
+  set_has_optional_nested_message();
+  if (optional_nested_message_ == NULL) {
+    optional_nested_message_ = new ::protobuf_unittest::TestTableDrivenLite_NestedMessage;
+  }
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestTableDrivenLite.optional_nested_message)
+  return optional_nested_message_;
+}
+::protobuf_unittest::TestTableDrivenLite_NestedMessage* TestTableDrivenLite::release_optional_nested_message() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestTableDrivenLite.optional_nested_message)
+  clear_has_optional_nested_message();
+  ::protobuf_unittest::TestTableDrivenLite_NestedMessage* temp = optional_nested_message_;
+  optional_nested_message_ = NULL;
+  return temp;
+}
+void TestTableDrivenLite::set_allocated_optional_nested_message(::protobuf_unittest::TestTableDrivenLite_NestedMessage* optional_nested_message) {
+  delete optional_nested_message_;
+  optional_nested_message_ = optional_nested_message;
+  if (optional_nested_message) {
+    set_has_optional_nested_message();
+  } else {
+    clear_has_optional_nested_message();
+  }
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestTableDrivenLite.optional_nested_message)
+}
+
+// optional .protobuf_unittest.ForeignMessageLite optional_foreign_message = 19;
+bool TestTableDrivenLite::has_optional_foreign_message() const {
+  return (_has_bits_[0] & 0x00000010u) != 0;
+}
+void TestTableDrivenLite::set_has_optional_foreign_message() {
+  _has_bits_[0] |= 0x00000010u;
+}
+void TestTableDrivenLite::clear_has_optional_foreign_message() {
+  _has_bits_[0] &= ~0x00000010u;
+}
+void TestTableDrivenLite::clear_optional_foreign_message() {
+  if (optional_foreign_message_ != NULL) optional_foreign_message_->::protobuf_unittest::ForeignMessageLite::Clear();
+  clear_has_optional_foreign_message();
+}
+const ::protobuf_unittest::ForeignMessageLite& TestTableDrivenLite::optional_foreign_message() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestTableDrivenLite.optional_foreign_message)
+  return optional_foreign_message_ != NULL ? *optional_foreign_message_
+                         : *::protobuf_unittest::ForeignMessageLite::internal_default_instance();
+}
+::protobuf_unittest::ForeignMessageLite* TestTableDrivenLite::mutable_optional_foreign_message() {
+  set_has_optional_foreign_message();
+  if (optional_foreign_message_ == NULL) {
+    optional_foreign_message_ = new ::protobuf_unittest::ForeignMessageLite;
+  }
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestTableDrivenLite.optional_foreign_message)
+  return optional_foreign_message_;
+}
+::protobuf_unittest::ForeignMessageLite* TestTableDrivenLite::release_optional_foreign_message() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestTableDrivenLite.optional_foreign_message)
+  clear_has_optional_foreign_message();
+  ::protobuf_unittest::ForeignMessageLite* temp = optional_foreign_message_;
+  optional_foreign_message_ = NULL;
+  return temp;
+}
+void TestTableDrivenLite::set_allocated_optional_foreign_message(::protobuf_unittest::ForeignMessageLite* optional_foreign_message) {
+  delete optional_foreign_message_;
+  optional_foreign_message_ = optional_foreign_message;
+  if (optional_foreign_message) {
+    set_has_optional_foreign_message();
+  } else {
+    clear_has_optional_foreign_message();
+  }
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestTableDrivenLite.optional_foreign_message)
+}
+
+// optional .protobuf_unittest.TestTableDrivenLite.NestedEnum optional_nested_enum = 21;
+bool TestTableDrivenLite::has_optional_nested_enum() const {
+  return (_has_bits_[0] & 0x00040000u) != 0;
+}
+void TestTableDrivenLite::set_has_optional_nested_enum() {
+  _has_bits_[0] |= 0x00040000u;
+}
+void TestTableDrivenLite::clear_has_optional_nested_enum() {
+  _has_bits_[0] &= ~0x00040000u;
+}
+void TestTableDrivenLite::clear_optional_nested_enum() {
+  optional_nested_enum_ = 1;
+  clear_has_optional_nested_enum();
+}
+::protobuf_unittest::TestTableDrivenLite_NestedEnum TestTableDrivenLite::optional_nested_enum() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestTableDrivenLite.optional_nested_enum)
+  return static_cast< ::protobuf_unittest::TestTableDrivenLite_NestedEnum >(optional_nested_enum_);
+}
+void TestTableDrivenLite::set_optional_nested_enum(::protobuf_unittest::TestTableDrivenLite_NestedEnum value) {
+  assert(::protobuf_unittest::TestTableDrivenLite_NestedEnum_IsValid(value));
+  set_has_optional_nested_enum();
+  optional_nested_enum_ = value;
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestTableDrivenLite.optional_nested_enum)
+}
+
+// optional .protobuf_unittest.ForeignEnumLite optional_foreign_enum = 22;
+bool TestTableDrivenLite::has_optional_foreign_enum() const {
+  return (_has_bits_[0] & 0x00080000u) != 0;
+}
+void TestTableDrivenLite::set_has_optional_foreign_enum() {
+  _has_bits_[0] |= 0x00080000u;
+}
+void TestTableDrivenLite::clear_has_optional_foreign_enum() {
+  _has_bits_[0] &= ~0x00080000u;
+}
+void TestTableDrivenLite::clear_optional_foreign_enum() {
+  optional_foreign_enum_ = 4;
+  clear_has_optional_foreign_enum();
+}
+::protobuf_unittest::ForeignEnumLite TestTableDrivenLite::optional_foreign_enum() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestTableDrivenLite.optional_foreign_enum)
+  return static_cast< ::protobuf_unittest::ForeignEnumLite >(optional_foreign_enum_);
+}
+void TestTableDrivenLite::set_optional_foreign_enum(::protobuf_unittest::ForeignEnumLite value) {
+  assert(::protobuf_unittest::ForeignEnumLite_IsValid(value));
+  set_has_optional_foreign_enum();
+  optional_foreign_enum_ = value;
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestTableDrivenLite.optional_foreign_enum)
+}
+
+// repeated int32 repeated_int32 = 31;
+int TestTableDrivenLite::repeated_int32_size() const {
+  return repeated_int32_.size();
+}
+void TestTableDrivenLite::clear_repeated_int32() {
+  repeated_int32_.Clear();
+}
+::google::protobuf::int32 TestTableDrivenLite::repeated_int32(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestTableDrivenLite.repeated_int32)
+  return repeated_int32_.Get(index);
+}
+void TestTableDrivenLite::set_repeated_int32(int index, ::google::protobuf::int32 value) {
+  repeated_int32_.Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestTableDrivenLite.repeated_int32)
+}
+void TestTableDrivenLite::add_repeated_int32(::google::protobuf::int32 value) {
+  repeated_int32_.Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestTableDrivenLite.repeated_int32)
+}
+const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
+TestTableDrivenLite::repeated_int32() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestTableDrivenLite.repeated_int32)
+  return repeated_int32_;
+}
+::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
+TestTableDrivenLite::mutable_repeated_int32() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestTableDrivenLite.repeated_int32)
+  return &repeated_int32_;
+}
+
+// repeated int64 repeated_int64 = 32;
+int TestTableDrivenLite::repeated_int64_size() const {
+  return repeated_int64_.size();
+}
+void TestTableDrivenLite::clear_repeated_int64() {
+  repeated_int64_.Clear();
+}
+::google::protobuf::int64 TestTableDrivenLite::repeated_int64(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestTableDrivenLite.repeated_int64)
+  return repeated_int64_.Get(index);
+}
+void TestTableDrivenLite::set_repeated_int64(int index, ::google::protobuf::int64 value) {
+  repeated_int64_.Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestTableDrivenLite.repeated_int64)
+}
+void TestTableDrivenLite::add_repeated_int64(::google::protobuf::int64 value) {
+  repeated_int64_.Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestTableDrivenLite.repeated_int64)
+}
+const ::google::protobuf::RepeatedField< ::google::protobuf::int64 >&
+TestTableDrivenLite::repeated_int64() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestTableDrivenLite.repeated_int64)
+  return repeated_int64_;
+}
+::google::protobuf::RepeatedField< ::google::protobuf::int64 >*
+TestTableDrivenLite::mutable_repeated_int64() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestTableDrivenLite.repeated_int64)
+  return &repeated_int64_;
+}
+
+// repeated uint32 repeated_uint32 = 33;
+int TestTableDrivenLite::repeated_uint32_size() const {
+  return repeated_uint32_.size();
+}
+void TestTableDrivenLite::clear_repeated_uint32() {
+  repeated_uint32_.Clear();
+}
+::google::protobuf::uint32 TestTableDrivenLite::repeated_uint32(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestTableDrivenLite.repeated_uint32)
+  return repeated_uint32_.Get(index);
+}
+void TestTableDrivenLite::set_repeated_uint32(int index, ::google::protobuf::uint32 value) {
+  repeated_uint32_.Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestTableDrivenLite.repeated_uint32)
+}
+void TestTableDrivenLite::add_repeated_uint32(::google::protobuf::uint32 value) {
+  repeated_uint32_.Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestTableDrivenLite.repeated_uint32)
+}
+const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
+TestTableDrivenLite::repeated_uint32() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestTableDrivenLite.repeated_uint32)
+  return repeated_uint32_;
+}
+::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
+TestTableDrivenLite::mutable_repeated_uint32() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestTableDrivenLite.repeated_uint32)
+  return &repeated_uint32_;
+}
+
+// repeated uint64 repeated_uint64 = 34;
+int TestTableDrivenLite::repeated_uint64_size() const {
+  return repeated_uint64_.size();
+}
+void TestTableDrivenLite::clear_repeated_uint64() {
+  repeated_uint64_.Clear();
+}
+::google::protobuf::uint64 TestTableDrivenLite::repeated_uint64(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestTableDrivenLite.repeated_uint64)
+  return repeated_uint64_.Get(index);
+}
+void TestTableDrivenLite::set_repeated_uint64(int index, ::google::protobuf::uint64 value) {
+  repeated_uint64_.Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestTableDrivenLite.repeated_uint64)
+}
+void TestTableDrivenLite::add_repeated_uint64(::google::protobuf::uint64 value) {
+  repeated_uint64_.Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestTableDrivenLite.repeated_uint64)
+}
+const ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >&
+TestTableDrivenLite::repeated_uint64() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestTableDrivenLite.repeated_uint64)
+  return repeated_uint64_;
+}
+::google::protobuf::RepeatedField< ::google::protobuf::uint64 >*
+TestTableDrivenLite::mutable_repeated_uint64() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestTableDrivenLite.repeated_uint64)
+  return &repeated_uint64_;
+}
+
+// repeated sint32 repeated_sint32 = 35;
+int TestTableDrivenLite::repeated_sint32_size() const {
+  return repeated_sint32_.size();
+}
+void TestTableDrivenLite::clear_repeated_sint32() {
+  repeated_sint32_.Clear();
+}
+::google::protobuf::int32 TestTableDrivenLite::repeated_sint32(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestTableDrivenLite.repeated_sint32)
+  return repeated_sint32_.Get(index);
+}
+void TestTableDrivenLite::set_repeated_sint32(int index, ::google::protobuf::int32 value) {
+  repeated_sint32_.Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestTableDrivenLite.repeated_sint32)
+}
+void TestTableDrivenLite::add_repeated_sint32(::google::protobuf::int32 value) {
+  repeated_sint32_.Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestTableDrivenLite.repeated_sint32)
+}
+const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
+TestTableDrivenLite::repeated_sint32() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestTableDrivenLite.repeated_sint32)
+  return repeated_sint32_;
+}
+::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
+TestTableDrivenLite::mutable_repeated_sint32() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestTableDrivenLite.repeated_sint32)
+  return &repeated_sint32_;
+}
+
+// repeated sint64 repeated_sint64 = 36;
+int TestTableDrivenLite::repeated_sint64_size() const {
+  return repeated_sint64_.size();
+}
+void TestTableDrivenLite::clear_repeated_sint64() {
+  repeated_sint64_.Clear();
+}
+::google::protobuf::int64 TestTableDrivenLite::repeated_sint64(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestTableDrivenLite.repeated_sint64)
+  return repeated_sint64_.Get(index);
+}
+void TestTableDrivenLite::set_repeated_sint64(int index, ::google::protobuf::int64 value) {
+  repeated_sint64_.Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestTableDrivenLite.repeated_sint64)
+}
+void TestTableDrivenLite::add_repeated_sint64(::google::protobuf::int64 value) {
+  repeated_sint64_.Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestTableDrivenLite.repeated_sint64)
+}
+const ::google::protobuf::RepeatedField< ::google::protobuf::int64 >&
+TestTableDrivenLite::repeated_sint64() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestTableDrivenLite.repeated_sint64)
+  return repeated_sint64_;
+}
+::google::protobuf::RepeatedField< ::google::protobuf::int64 >*
+TestTableDrivenLite::mutable_repeated_sint64() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestTableDrivenLite.repeated_sint64)
+  return &repeated_sint64_;
+}
+
+// repeated fixed32 repeated_fixed32 = 37;
+int TestTableDrivenLite::repeated_fixed32_size() const {
+  return repeated_fixed32_.size();
+}
+void TestTableDrivenLite::clear_repeated_fixed32() {
+  repeated_fixed32_.Clear();
+}
+::google::protobuf::uint32 TestTableDrivenLite::repeated_fixed32(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestTableDrivenLite.repeated_fixed32)
+  return repeated_fixed32_.Get(index);
+}
+void TestTableDrivenLite::set_repeated_fixed32(int index, ::google::protobuf::uint32 value) {
+  repeated_fixed32_.Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestTableDrivenLite.repeated_fixed32)
+}
+void TestTableDrivenLite::add_repeated_fixed32(::google::protobuf::uint32 value) {
+  repeated_fixed32_.Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestTableDrivenLite.repeated_fixed32)
+}
+const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
+TestTableDrivenLite::repeated_fixed32() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestTableDrivenLite.repeated_fixed32)
+  return repeated_fixed32_;
+}
+::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
+TestTableDrivenLite::mutable_repeated_fixed32() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestTableDrivenLite.repeated_fixed32)
+  return &repeated_fixed32_;
+}
+
+// repeated fixed64 repeated_fixed64 = 38;
+int TestTableDrivenLite::repeated_fixed64_size() const {
+  return repeated_fixed64_.size();
+}
+void TestTableDrivenLite::clear_repeated_fixed64() {
+  repeated_fixed64_.Clear();
+}
+::google::protobuf::uint64 TestTableDrivenLite::repeated_fixed64(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestTableDrivenLite.repeated_fixed64)
+  return repeated_fixed64_.Get(index);
+}
+void TestTableDrivenLite::set_repeated_fixed64(int index, ::google::protobuf::uint64 value) {
+  repeated_fixed64_.Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestTableDrivenLite.repeated_fixed64)
+}
+void TestTableDrivenLite::add_repeated_fixed64(::google::protobuf::uint64 value) {
+  repeated_fixed64_.Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestTableDrivenLite.repeated_fixed64)
+}
+const ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >&
+TestTableDrivenLite::repeated_fixed64() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestTableDrivenLite.repeated_fixed64)
+  return repeated_fixed64_;
+}
+::google::protobuf::RepeatedField< ::google::protobuf::uint64 >*
+TestTableDrivenLite::mutable_repeated_fixed64() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestTableDrivenLite.repeated_fixed64)
+  return &repeated_fixed64_;
+}
+
+// repeated sfixed32 repeated_sfixed32 = 39;
+int TestTableDrivenLite::repeated_sfixed32_size() const {
+  return repeated_sfixed32_.size();
+}
+void TestTableDrivenLite::clear_repeated_sfixed32() {
+  repeated_sfixed32_.Clear();
+}
+::google::protobuf::int32 TestTableDrivenLite::repeated_sfixed32(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestTableDrivenLite.repeated_sfixed32)
+  return repeated_sfixed32_.Get(index);
+}
+void TestTableDrivenLite::set_repeated_sfixed32(int index, ::google::protobuf::int32 value) {
+  repeated_sfixed32_.Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestTableDrivenLite.repeated_sfixed32)
+}
+void TestTableDrivenLite::add_repeated_sfixed32(::google::protobuf::int32 value) {
+  repeated_sfixed32_.Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestTableDrivenLite.repeated_sfixed32)
+}
+const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
+TestTableDrivenLite::repeated_sfixed32() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestTableDrivenLite.repeated_sfixed32)
+  return repeated_sfixed32_;
+}
+::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
+TestTableDrivenLite::mutable_repeated_sfixed32() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestTableDrivenLite.repeated_sfixed32)
+  return &repeated_sfixed32_;
+}
+
+// repeated sfixed64 repeated_sfixed64 = 40;
+int TestTableDrivenLite::repeated_sfixed64_size() const {
+  return repeated_sfixed64_.size();
+}
+void TestTableDrivenLite::clear_repeated_sfixed64() {
+  repeated_sfixed64_.Clear();
+}
+::google::protobuf::int64 TestTableDrivenLite::repeated_sfixed64(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestTableDrivenLite.repeated_sfixed64)
+  return repeated_sfixed64_.Get(index);
+}
+void TestTableDrivenLite::set_repeated_sfixed64(int index, ::google::protobuf::int64 value) {
+  repeated_sfixed64_.Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestTableDrivenLite.repeated_sfixed64)
+}
+void TestTableDrivenLite::add_repeated_sfixed64(::google::protobuf::int64 value) {
+  repeated_sfixed64_.Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestTableDrivenLite.repeated_sfixed64)
+}
+const ::google::protobuf::RepeatedField< ::google::protobuf::int64 >&
+TestTableDrivenLite::repeated_sfixed64() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestTableDrivenLite.repeated_sfixed64)
+  return repeated_sfixed64_;
+}
+::google::protobuf::RepeatedField< ::google::protobuf::int64 >*
+TestTableDrivenLite::mutable_repeated_sfixed64() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestTableDrivenLite.repeated_sfixed64)
+  return &repeated_sfixed64_;
+}
+
+// repeated float repeated_float = 41;
+int TestTableDrivenLite::repeated_float_size() const {
+  return repeated_float_.size();
+}
+void TestTableDrivenLite::clear_repeated_float() {
+  repeated_float_.Clear();
+}
+float TestTableDrivenLite::repeated_float(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestTableDrivenLite.repeated_float)
+  return repeated_float_.Get(index);
+}
+void TestTableDrivenLite::set_repeated_float(int index, float value) {
+  repeated_float_.Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestTableDrivenLite.repeated_float)
+}
+void TestTableDrivenLite::add_repeated_float(float value) {
+  repeated_float_.Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestTableDrivenLite.repeated_float)
+}
+const ::google::protobuf::RepeatedField< float >&
+TestTableDrivenLite::repeated_float() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestTableDrivenLite.repeated_float)
+  return repeated_float_;
+}
+::google::protobuf::RepeatedField< float >*
+TestTableDrivenLite::mutable_repeated_float() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestTableDrivenLite.repeated_float)
+  return &repeated_float_;
+}
+
+// repeated double repeated_double = 42;
+int TestTableDrivenLite::repeated_double_size() const {
+  return repeated_double_.size();
+}
+void TestTableDrivenLite::clear_repeated_double() {
+  repeated_double_.Clear();
+}
+double TestTableDrivenLite::repeated_double(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestTableDrivenLite.repeated_double)
+  return repeated_double_.Get(index);
+}
+void TestTableDrivenLite::set_repeated_double(int index, double value) {
+  repeated_double_.Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestTableDrivenLite.repeated_double)
+}
+void TestTableDrivenLite::add_repeated_double(double value) {
+  repeated_double_.Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestTableDrivenLite.repeated_double)
+}
+const ::google::protobuf::RepeatedField< double >&
+TestTableDrivenLite::repeated_double() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestTableDrivenLite.repeated_double)
+  return repeated_double_;
+}
+::google::protobuf::RepeatedField< double >*
+TestTableDrivenLite::mutable_repeated_double() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestTableDrivenLite.repeated_double)
+  return &repeated_double_;
+}
+
+// repeated bool repeated_bool = 43;
+int TestTableDrivenLite::repeated_bool_size() const {
+  return repeated_bool_.size();
+}
+void TestTableDrivenLite::clear_repeated_bool() {
+  repeated_bool_.Clear();
+}
+bool TestTableDrivenLite::repeated_bool(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestTableDrivenLite.repeated_bool)
+  return repeated_bool_.Get(index);
+}
+void TestTableDrivenLite::set_repeated_bool(int index, bool value) {
+  repeated_bool_.Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestTableDrivenLite.repeated_bool)
+}
+void TestTableDrivenLite::add_repeated_bool(bool value) {
+  repeated_bool_.Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestTableDrivenLite.repeated_bool)
+}
+const ::google::protobuf::RepeatedField< bool >&
+TestTableDrivenLite::repeated_bool() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestTableDrivenLite.repeated_bool)
+  return repeated_bool_;
+}
+::google::protobuf::RepeatedField< bool >*
+TestTableDrivenLite::mutable_repeated_bool() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestTableDrivenLite.repeated_bool)
+  return &repeated_bool_;
+}
+
+// repeated string repeated_string = 44;
+int TestTableDrivenLite::repeated_string_size() const {
+  return repeated_string_.size();
+}
+void TestTableDrivenLite::clear_repeated_string() {
+  repeated_string_.Clear();
+}
+const ::std::string& TestTableDrivenLite::repeated_string(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestTableDrivenLite.repeated_string)
+  return repeated_string_.Get(index);
+}
+::std::string* TestTableDrivenLite::mutable_repeated_string(int index) {
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestTableDrivenLite.repeated_string)
+  return repeated_string_.Mutable(index);
+}
+void TestTableDrivenLite::set_repeated_string(int index, const ::std::string& value) {
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestTableDrivenLite.repeated_string)
+  repeated_string_.Mutable(index)->assign(value);
+}
+#if LANG_CXX11
+void TestTableDrivenLite::set_repeated_string(int index, ::std::string&& value) {
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestTableDrivenLite.repeated_string)
+  repeated_string_.Mutable(index)->assign(std::move(value));
+}
+#endif
+void TestTableDrivenLite::set_repeated_string(int index, const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  repeated_string_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:protobuf_unittest.TestTableDrivenLite.repeated_string)
+}
+void TestTableDrivenLite::set_repeated_string(int index, const char* value, size_t size) {
+  repeated_string_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:protobuf_unittest.TestTableDrivenLite.repeated_string)
+}
+::std::string* TestTableDrivenLite::add_repeated_string() {
+  // @@protoc_insertion_point(field_add_mutable:protobuf_unittest.TestTableDrivenLite.repeated_string)
+  return repeated_string_.Add();
+}
+void TestTableDrivenLite::add_repeated_string(const ::std::string& value) {
+  repeated_string_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestTableDrivenLite.repeated_string)
+}
+#if LANG_CXX11
+void TestTableDrivenLite::add_repeated_string(::std::string&& value) {
+  repeated_string_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestTableDrivenLite.repeated_string)
+}
+#endif
+void TestTableDrivenLite::add_repeated_string(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  repeated_string_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:protobuf_unittest.TestTableDrivenLite.repeated_string)
+}
+void TestTableDrivenLite::add_repeated_string(const char* value, size_t size) {
+  repeated_string_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:protobuf_unittest.TestTableDrivenLite.repeated_string)
+}
+const ::google::protobuf::RepeatedPtrField< ::std::string>&
+TestTableDrivenLite::repeated_string() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestTableDrivenLite.repeated_string)
+  return repeated_string_;
+}
+::google::protobuf::RepeatedPtrField< ::std::string>*
+TestTableDrivenLite::mutable_repeated_string() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestTableDrivenLite.repeated_string)
+  return &repeated_string_;
+}
+
+// repeated bytes repeated_bytes = 45;
+int TestTableDrivenLite::repeated_bytes_size() const {
+  return repeated_bytes_.size();
+}
+void TestTableDrivenLite::clear_repeated_bytes() {
+  repeated_bytes_.Clear();
+}
+const ::std::string& TestTableDrivenLite::repeated_bytes(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestTableDrivenLite.repeated_bytes)
+  return repeated_bytes_.Get(index);
+}
+::std::string* TestTableDrivenLite::mutable_repeated_bytes(int index) {
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestTableDrivenLite.repeated_bytes)
+  return repeated_bytes_.Mutable(index);
+}
+void TestTableDrivenLite::set_repeated_bytes(int index, const ::std::string& value) {
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestTableDrivenLite.repeated_bytes)
+  repeated_bytes_.Mutable(index)->assign(value);
+}
+#if LANG_CXX11
+void TestTableDrivenLite::set_repeated_bytes(int index, ::std::string&& value) {
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestTableDrivenLite.repeated_bytes)
+  repeated_bytes_.Mutable(index)->assign(std::move(value));
+}
+#endif
+void TestTableDrivenLite::set_repeated_bytes(int index, const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  repeated_bytes_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:protobuf_unittest.TestTableDrivenLite.repeated_bytes)
+}
+void TestTableDrivenLite::set_repeated_bytes(int index, const void* value, size_t size) {
+  repeated_bytes_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:protobuf_unittest.TestTableDrivenLite.repeated_bytes)
+}
+::std::string* TestTableDrivenLite::add_repeated_bytes() {
+  // @@protoc_insertion_point(field_add_mutable:protobuf_unittest.TestTableDrivenLite.repeated_bytes)
+  return repeated_bytes_.Add();
+}
+void TestTableDrivenLite::add_repeated_bytes(const ::std::string& value) {
+  repeated_bytes_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestTableDrivenLite.repeated_bytes)
+}
+#if LANG_CXX11
+void TestTableDrivenLite::add_repeated_bytes(::std::string&& value) {
+  repeated_bytes_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestTableDrivenLite.repeated_bytes)
+}
+#endif
+void TestTableDrivenLite::add_repeated_bytes(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  repeated_bytes_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:protobuf_unittest.TestTableDrivenLite.repeated_bytes)
+}
+void TestTableDrivenLite::add_repeated_bytes(const void* value, size_t size) {
+  repeated_bytes_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:protobuf_unittest.TestTableDrivenLite.repeated_bytes)
+}
+const ::google::protobuf::RepeatedPtrField< ::std::string>&
+TestTableDrivenLite::repeated_bytes() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestTableDrivenLite.repeated_bytes)
+  return repeated_bytes_;
+}
+::google::protobuf::RepeatedPtrField< ::std::string>*
+TestTableDrivenLite::mutable_repeated_bytes() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestTableDrivenLite.repeated_bytes)
+  return &repeated_bytes_;
+}
+
+// repeated group RepeatedGroup = 46 { ... };
+int TestTableDrivenLite::repeatedgroup_size() const {
+  return repeatedgroup_.size();
+}
+void TestTableDrivenLite::clear_repeatedgroup() {
+  repeatedgroup_.Clear();
+}
+const ::protobuf_unittest::TestTableDrivenLite_RepeatedGroup& TestTableDrivenLite::repeatedgroup(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestTableDrivenLite.repeatedgroup)
+  return repeatedgroup_.Get(index);
+}
+::protobuf_unittest::TestTableDrivenLite_RepeatedGroup* TestTableDrivenLite::mutable_repeatedgroup(int index) {
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestTableDrivenLite.repeatedgroup)
+  return repeatedgroup_.Mutable(index);
+}
+::protobuf_unittest::TestTableDrivenLite_RepeatedGroup* TestTableDrivenLite::add_repeatedgroup() {
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestTableDrivenLite.repeatedgroup)
+  return repeatedgroup_.Add();
+}
+::google::protobuf::RepeatedPtrField< ::protobuf_unittest::TestTableDrivenLite_RepeatedGroup >*
+TestTableDrivenLite::mutable_repeatedgroup() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestTableDrivenLite.repeatedgroup)
+  return &repeatedgroup_;
+}
+const ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::TestTableDrivenLite_RepeatedGroup >&
+TestTableDrivenLite::repeatedgroup() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestTableDrivenLite.repeatedgroup)
+  return repeatedgroup_;
+}
+
+// repeated .protobuf_unittest.TestTableDrivenLite.NestedMessage repeated_nested_message = 48;
+int TestTableDrivenLite::repeated_nested_message_size() const {
+  return repeated_nested_message_.size();
+}
+void TestTableDrivenLite::clear_repeated_nested_message() {
+  repeated_nested_message_.Clear();
+}
+const ::protobuf_unittest::TestTableDrivenLite_NestedMessage& TestTableDrivenLite::repeated_nested_message(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestTableDrivenLite.repeated_nested_message)
+  return repeated_nested_message_.Get(index);
+}
+::protobuf_unittest::TestTableDrivenLite_NestedMessage* TestTableDrivenLite::mutable_repeated_nested_message(int index) {
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestTableDrivenLite.repeated_nested_message)
+  return repeated_nested_message_.Mutable(index);
+}
+::protobuf_unittest::TestTableDrivenLite_NestedMessage* TestTableDrivenLite::add_repeated_nested_message() {
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestTableDrivenLite.repeated_nested_message)
+  return repeated_nested_message_.Add();
+}
+::google::protobuf::RepeatedPtrField< ::protobuf_unittest::TestTableDrivenLite_NestedMessage >*
+TestTableDrivenLite::mutable_repeated_nested_message() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestTableDrivenLite.repeated_nested_message)
+  return &repeated_nested_message_;
+}
+const ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::TestTableDrivenLite_NestedMessage >&
+TestTableDrivenLite::repeated_nested_message() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestTableDrivenLite.repeated_nested_message)
+  return repeated_nested_message_;
+}
+
+// repeated .protobuf_unittest.ForeignMessageLite repeated_foreign_message = 49;
+int TestTableDrivenLite::repeated_foreign_message_size() const {
+  return repeated_foreign_message_.size();
+}
+void TestTableDrivenLite::clear_repeated_foreign_message() {
+  repeated_foreign_message_.Clear();
+}
+const ::protobuf_unittest::ForeignMessageLite& TestTableDrivenLite::repeated_foreign_message(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestTableDrivenLite.repeated_foreign_message)
+  return repeated_foreign_message_.Get(index);
+}
+::protobuf_unittest::ForeignMessageLite* TestTableDrivenLite::mutable_repeated_foreign_message(int index) {
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestTableDrivenLite.repeated_foreign_message)
+  return repeated_foreign_message_.Mutable(index);
+}
+::protobuf_unittest::ForeignMessageLite* TestTableDrivenLite::add_repeated_foreign_message() {
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestTableDrivenLite.repeated_foreign_message)
+  return repeated_foreign_message_.Add();
+}
+::google::protobuf::RepeatedPtrField< ::protobuf_unittest::ForeignMessageLite >*
+TestTableDrivenLite::mutable_repeated_foreign_message() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestTableDrivenLite.repeated_foreign_message)
+  return &repeated_foreign_message_;
+}
+const ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::ForeignMessageLite >&
+TestTableDrivenLite::repeated_foreign_message() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestTableDrivenLite.repeated_foreign_message)
+  return repeated_foreign_message_;
+}
+
+// repeated .protobuf_unittest.TestTableDrivenLite.NestedEnum repeated_nested_enum = 51;
+int TestTableDrivenLite::repeated_nested_enum_size() const {
+  return repeated_nested_enum_.size();
+}
+void TestTableDrivenLite::clear_repeated_nested_enum() {
+  repeated_nested_enum_.Clear();
+}
+::protobuf_unittest::TestTableDrivenLite_NestedEnum TestTableDrivenLite::repeated_nested_enum(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestTableDrivenLite.repeated_nested_enum)
+  return static_cast< ::protobuf_unittest::TestTableDrivenLite_NestedEnum >(repeated_nested_enum_.Get(index));
+}
+void TestTableDrivenLite::set_repeated_nested_enum(int index, ::protobuf_unittest::TestTableDrivenLite_NestedEnum value) {
+  assert(::protobuf_unittest::TestTableDrivenLite_NestedEnum_IsValid(value));
+  repeated_nested_enum_.Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestTableDrivenLite.repeated_nested_enum)
+}
+void TestTableDrivenLite::add_repeated_nested_enum(::protobuf_unittest::TestTableDrivenLite_NestedEnum value) {
+  assert(::protobuf_unittest::TestTableDrivenLite_NestedEnum_IsValid(value));
+  repeated_nested_enum_.Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestTableDrivenLite.repeated_nested_enum)
+}
+const ::google::protobuf::RepeatedField<int>&
+TestTableDrivenLite::repeated_nested_enum() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestTableDrivenLite.repeated_nested_enum)
+  return repeated_nested_enum_;
+}
+::google::protobuf::RepeatedField<int>*
+TestTableDrivenLite::mutable_repeated_nested_enum() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestTableDrivenLite.repeated_nested_enum)
+  return &repeated_nested_enum_;
+}
+
+// repeated .protobuf_unittest.ForeignEnumLite repeated_foreign_enum = 52;
+int TestTableDrivenLite::repeated_foreign_enum_size() const {
+  return repeated_foreign_enum_.size();
+}
+void TestTableDrivenLite::clear_repeated_foreign_enum() {
+  repeated_foreign_enum_.Clear();
+}
+::protobuf_unittest::ForeignEnumLite TestTableDrivenLite::repeated_foreign_enum(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestTableDrivenLite.repeated_foreign_enum)
+  return static_cast< ::protobuf_unittest::ForeignEnumLite >(repeated_foreign_enum_.Get(index));
+}
+void TestTableDrivenLite::set_repeated_foreign_enum(int index, ::protobuf_unittest::ForeignEnumLite value) {
+  assert(::protobuf_unittest::ForeignEnumLite_IsValid(value));
+  repeated_foreign_enum_.Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestTableDrivenLite.repeated_foreign_enum)
+}
+void TestTableDrivenLite::add_repeated_foreign_enum(::protobuf_unittest::ForeignEnumLite value) {
+  assert(::protobuf_unittest::ForeignEnumLite_IsValid(value));
+  repeated_foreign_enum_.Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestTableDrivenLite.repeated_foreign_enum)
+}
+const ::google::protobuf::RepeatedField<int>&
+TestTableDrivenLite::repeated_foreign_enum() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestTableDrivenLite.repeated_foreign_enum)
+  return repeated_foreign_enum_;
+}
+::google::protobuf::RepeatedField<int>*
+TestTableDrivenLite::mutable_repeated_foreign_enum() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestTableDrivenLite.repeated_foreign_enum)
+  return &repeated_foreign_enum_;
+}
+
+#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
+
+// ===================================================================
+
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int TestPackedTableDrivenLite::kPackedInt32FieldNumber;
+const int TestPackedTableDrivenLite::kPackedInt64FieldNumber;
+const int TestPackedTableDrivenLite::kPackedUint32FieldNumber;
+const int TestPackedTableDrivenLite::kPackedUint64FieldNumber;
+const int TestPackedTableDrivenLite::kPackedSint32FieldNumber;
+const int TestPackedTableDrivenLite::kPackedSint64FieldNumber;
+const int TestPackedTableDrivenLite::kPackedFixed32FieldNumber;
+const int TestPackedTableDrivenLite::kPackedFixed64FieldNumber;
+const int TestPackedTableDrivenLite::kPackedSfixed32FieldNumber;
+const int TestPackedTableDrivenLite::kPackedSfixed64FieldNumber;
+const int TestPackedTableDrivenLite::kPackedFloatFieldNumber;
+const int TestPackedTableDrivenLite::kPackedDoubleFieldNumber;
+const int TestPackedTableDrivenLite::kPackedBoolFieldNumber;
+const int TestPackedTableDrivenLite::kPackedEnumFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+TestPackedTableDrivenLite::TestPackedTableDrivenLite()
+  : ::google::protobuf::MessageLite(), _internal_metadata_(NULL) {
+  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
+    protobuf_google_2fprotobuf_2funittest_5ftable_5fdriven_5flite_2eproto::InitDefaults();
+  }
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:protobuf_unittest.TestPackedTableDrivenLite)
+}
+TestPackedTableDrivenLite::TestPackedTableDrivenLite(const TestPackedTableDrivenLite& from)
+  : ::google::protobuf::MessageLite(),
+      _internal_metadata_(NULL),
+      _has_bits_(from._has_bits_),
+      _cached_size_(0),
+      packed_int32_(from.packed_int32_),
+      packed_int64_(from.packed_int64_),
+      packed_uint32_(from.packed_uint32_),
+      packed_uint64_(from.packed_uint64_),
+      packed_sint32_(from.packed_sint32_),
+      packed_sint64_(from.packed_sint64_),
+      packed_fixed32_(from.packed_fixed32_),
+      packed_fixed64_(from.packed_fixed64_),
+      packed_sfixed32_(from.packed_sfixed32_),
+      packed_sfixed64_(from.packed_sfixed64_),
+      packed_float_(from.packed_float_),
+      packed_double_(from.packed_double_),
+      packed_bool_(from.packed_bool_),
+      packed_enum_(from.packed_enum_) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.TestPackedTableDrivenLite)
+}
+
+void TestPackedTableDrivenLite::SharedCtor() {
+  _cached_size_ = 0;
+}
+
+TestPackedTableDrivenLite::~TestPackedTableDrivenLite() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.TestPackedTableDrivenLite)
+  SharedDtor();
+}
+
+void TestPackedTableDrivenLite::SharedDtor() {
+}
+
+void TestPackedTableDrivenLite::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const TestPackedTableDrivenLite& TestPackedTableDrivenLite::default_instance() {
+  protobuf_google_2fprotobuf_2funittest_5ftable_5fdriven_5flite_2eproto::InitDefaults();
+  return *internal_default_instance();
+}
+
+TestPackedTableDrivenLite* TestPackedTableDrivenLite::New(::google::protobuf::Arena* arena) const {
+  TestPackedTableDrivenLite* n = new TestPackedTableDrivenLite;
+  if (arena != NULL) {
+    arena->Own(n);
+  }
+  return n;
+}
+
+void TestPackedTableDrivenLite::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.TestPackedTableDrivenLite)
+  packed_int32_.Clear();
+  packed_int64_.Clear();
+  packed_uint32_.Clear();
+  packed_uint64_.Clear();
+  packed_sint32_.Clear();
+  packed_sint64_.Clear();
+  packed_fixed32_.Clear();
+  packed_fixed64_.Clear();
+  packed_sfixed32_.Clear();
+  packed_sfixed64_.Clear();
+  packed_float_.Clear();
+  packed_double_.Clear();
+  packed_bool_.Clear();
+  packed_enum_.Clear();
+  _has_bits_.Clear();
+  _internal_metadata_.Clear();
+}
+
+bool TestPackedTableDrivenLite::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+#define DO_(EXPRESSION) if (!GOOGLE_PREDICT_TRUE(EXPRESSION)) goto failure
+  ::google::protobuf::uint32 tag;
+  ::google::protobuf::io::LazyStringOutputStream unknown_fields_string(
+      ::google::protobuf::NewPermanentCallback(&_internal_metadata_,
+          &::google::protobuf::internal::InternalMetadataWithArenaLite::
+              mutable_unknown_fields));
+  ::google::protobuf::io::CodedOutputStream unknown_fields_stream(
+      &unknown_fields_string, false);
+  // @@protoc_insertion_point(parse_start:protobuf_unittest.TestPackedTableDrivenLite)
+  for (;;) {
+    ::std::pair< ::google::protobuf::uint32, bool> p = input->ReadTagWithCutoffNoLastTag(16383u);
+    tag = p.first;
+    if (!p.second) goto handle_unusual;
+    switch (::google::protobuf::internal::WireFormatLite::GetTagFieldNumber(tag)) {
+      // repeated int32 packed_int32 = 90 [packed = true];
+      case 90: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(722u)) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPackedPrimitive<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 input, this->mutable_packed_int32())));
+        } else if (static_cast< ::google::protobuf::uint8>(tag) ==
+                   static_cast< ::google::protobuf::uint8>(720u)) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadRepeatedPrimitiveNoInline<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_INT32>(
+                 2, 722u, input, this->mutable_packed_int32())));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated int64 packed_int64 = 91 [packed = true];
+      case 91: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(730u)) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPackedPrimitive<
+                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
+                 input, this->mutable_packed_int64())));
+        } else if (static_cast< ::google::protobuf::uint8>(tag) ==
+                   static_cast< ::google::protobuf::uint8>(728u)) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadRepeatedPrimitiveNoInline<
+                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_INT64>(
+                 2, 730u, input, this->mutable_packed_int64())));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated uint32 packed_uint32 = 92 [packed = true];
+      case 92: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(738u)) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPackedPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 input, this->mutable_packed_uint32())));
+        } else if (static_cast< ::google::protobuf::uint8>(tag) ==
+                   static_cast< ::google::protobuf::uint8>(736u)) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadRepeatedPrimitiveNoInline<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_UINT32>(
+                 2, 738u, input, this->mutable_packed_uint32())));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated uint64 packed_uint64 = 93 [packed = true];
+      case 93: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(746u)) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPackedPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 input, this->mutable_packed_uint64())));
+        } else if (static_cast< ::google::protobuf::uint8>(tag) ==
+                   static_cast< ::google::protobuf::uint8>(744u)) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadRepeatedPrimitiveNoInline<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_UINT64>(
+                 2, 746u, input, this->mutable_packed_uint64())));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated sint32 packed_sint32 = 94 [packed = true];
+      case 94: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(754u)) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPackedPrimitive<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_SINT32>(
+                 input, this->mutable_packed_sint32())));
+        } else if (static_cast< ::google::protobuf::uint8>(tag) ==
+                   static_cast< ::google::protobuf::uint8>(752u)) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadRepeatedPrimitiveNoInline<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_SINT32>(
+                 2, 754u, input, this->mutable_packed_sint32())));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated sint64 packed_sint64 = 95 [packed = true];
+      case 95: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(762u)) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPackedPrimitive<
+                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_SINT64>(
+                 input, this->mutable_packed_sint64())));
+        } else if (static_cast< ::google::protobuf::uint8>(tag) ==
+                   static_cast< ::google::protobuf::uint8>(760u)) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadRepeatedPrimitiveNoInline<
+                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_SINT64>(
+                 2, 762u, input, this->mutable_packed_sint64())));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated fixed32 packed_fixed32 = 96 [packed = true];
+      case 96: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(770u)) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPackedPrimitive<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_FIXED32>(
+                 input, this->mutable_packed_fixed32())));
+        } else if (static_cast< ::google::protobuf::uint8>(tag) ==
+                   static_cast< ::google::protobuf::uint8>(773u)) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadRepeatedPrimitiveNoInline<
+                   ::google::protobuf::uint32, ::google::protobuf::internal::WireFormatLite::TYPE_FIXED32>(
+                 2, 770u, input, this->mutable_packed_fixed32())));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated fixed64 packed_fixed64 = 97 [packed = true];
+      case 97: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(778u)) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPackedPrimitive<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_FIXED64>(
+                 input, this->mutable_packed_fixed64())));
+        } else if (static_cast< ::google::protobuf::uint8>(tag) ==
+                   static_cast< ::google::protobuf::uint8>(777u)) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadRepeatedPrimitiveNoInline<
+                   ::google::protobuf::uint64, ::google::protobuf::internal::WireFormatLite::TYPE_FIXED64>(
+                 2, 778u, input, this->mutable_packed_fixed64())));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated sfixed32 packed_sfixed32 = 98 [packed = true];
+      case 98: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(786u)) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPackedPrimitive<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_SFIXED32>(
+                 input, this->mutable_packed_sfixed32())));
+        } else if (static_cast< ::google::protobuf::uint8>(tag) ==
+                   static_cast< ::google::protobuf::uint8>(789u)) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadRepeatedPrimitiveNoInline<
+                   ::google::protobuf::int32, ::google::protobuf::internal::WireFormatLite::TYPE_SFIXED32>(
+                 2, 786u, input, this->mutable_packed_sfixed32())));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated sfixed64 packed_sfixed64 = 99 [packed = true];
+      case 99: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(794u)) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPackedPrimitive<
+                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_SFIXED64>(
+                 input, this->mutable_packed_sfixed64())));
+        } else if (static_cast< ::google::protobuf::uint8>(tag) ==
+                   static_cast< ::google::protobuf::uint8>(793u)) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadRepeatedPrimitiveNoInline<
+                   ::google::protobuf::int64, ::google::protobuf::internal::WireFormatLite::TYPE_SFIXED64>(
+                 2, 794u, input, this->mutable_packed_sfixed64())));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated float packed_float = 100 [packed = true];
+      case 100: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(802u)) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPackedPrimitive<
+                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
+                 input, this->mutable_packed_float())));
+        } else if (static_cast< ::google::protobuf::uint8>(tag) ==
+                   static_cast< ::google::protobuf::uint8>(805u)) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadRepeatedPrimitiveNoInline<
+                   float, ::google::protobuf::internal::WireFormatLite::TYPE_FLOAT>(
+                 2, 802u, input, this->mutable_packed_float())));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated double packed_double = 101 [packed = true];
+      case 101: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(810u)) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPackedPrimitive<
+                   double, ::google::protobuf::internal::WireFormatLite::TYPE_DOUBLE>(
+                 input, this->mutable_packed_double())));
+        } else if (static_cast< ::google::protobuf::uint8>(tag) ==
+                   static_cast< ::google::protobuf::uint8>(809u)) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadRepeatedPrimitiveNoInline<
+                   double, ::google::protobuf::internal::WireFormatLite::TYPE_DOUBLE>(
+                 2, 810u, input, this->mutable_packed_double())));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated bool packed_bool = 102 [packed = true];
+      case 102: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(818u)) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPackedPrimitive<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 input, this->mutable_packed_bool())));
+        } else if (static_cast< ::google::protobuf::uint8>(tag) ==
+                   static_cast< ::google::protobuf::uint8>(816u)) {
+          DO_((::google::protobuf::internal::WireFormatLite::ReadRepeatedPrimitiveNoInline<
+                   bool, ::google::protobuf::internal::WireFormatLite::TYPE_BOOL>(
+                 2, 818u, input, this->mutable_packed_bool())));
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      // repeated .protobuf_unittest.ForeignEnumLite packed_enum = 103 [packed = true];
+      case 103: {
+        if (static_cast< ::google::protobuf::uint8>(tag) ==
+            static_cast< ::google::protobuf::uint8>(826u)) {
+          ::google::protobuf::uint32 length;
+          DO_(input->ReadVarint32(&length));
+          ::google::protobuf::io::CodedInputStream::Limit limit = input->PushLimit(length);
+          while (input->BytesUntilLimit() > 0) {
+            int value;
+            DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
+                 input, &value)));
+            if (::protobuf_unittest::ForeignEnumLite_IsValid(value)) {
+              add_packed_enum(static_cast< ::protobuf_unittest::ForeignEnumLite >(value));
+            } else {
+              unknown_fields_stream.WriteVarint32(tag);
+              unknown_fields_stream.WriteVarint32(value);
+            }
+          }
+          input->PopLimit(limit);
+        } else if (static_cast< ::google::protobuf::uint8>(tag) ==
+                   static_cast< ::google::protobuf::uint8>(824u)) {
+          int value;
+          DO_((::google::protobuf::internal::WireFormatLite::ReadPrimitive<
+                   int, ::google::protobuf::internal::WireFormatLite::TYPE_ENUM>(
+                 input, &value)));
+          if (::protobuf_unittest::ForeignEnumLite_IsValid(value)) {
+            add_packed_enum(static_cast< ::protobuf_unittest::ForeignEnumLite >(value));
+          } else {
+            unknown_fields_stream.WriteVarint32(tag);
+            unknown_fields_stream.WriteVarint32(value);
+          }
+        } else {
+          goto handle_unusual;
+        }
+        break;
+      }
+
+      default: {
+      handle_unusual:
+        if (tag == 0 ||
+            ::google::protobuf::internal::WireFormatLite::GetTagWireType(tag) ==
+            ::google::protobuf::internal::WireFormatLite::WIRETYPE_END_GROUP) {
+          goto success;
+        }
+        DO_(::google::protobuf::internal::WireFormatLite::SkipField(
+            input, tag, &unknown_fields_stream));
+        break;
+      }
+    }
+  }
+success:
+  // @@protoc_insertion_point(parse_success:protobuf_unittest.TestPackedTableDrivenLite)
+  return true;
+failure:
+  // @@protoc_insertion_point(parse_failure:protobuf_unittest.TestPackedTableDrivenLite)
+  return false;
+#undef DO_
+}
+
+void TestPackedTableDrivenLite::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:protobuf_unittest.TestPackedTableDrivenLite)
+  ::google::protobuf::internal::TableSerialize(
+      this,
+      protobuf_google_2fprotobuf_2funittest_5ftable_5fdriven_5flite_2eproto::TableStruct::serialization_table[
+        TestPackedTableDrivenLite::kIndexInFileMessages],
+      output);
+  // @@protoc_insertion_point(serialize_end:protobuf_unittest.TestPackedTableDrivenLite)
+}
+
+::google::protobuf::uint8* TestPackedTableDrivenLite::InternalSerializeWithCachedSizesToArray(
+    bool deterministic, ::google::protobuf::uint8* target) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.TestPackedTableDrivenLite)
+  target = ::google::protobuf::internal::TableSerializeToArray(
+      this,
+      protobuf_google_2fprotobuf_2funittest_5ftable_5fdriven_5flite_2eproto::TableStruct::serialization_table[
+        TestPackedTableDrivenLite::kIndexInFileMessages],
+      deterministic, target);
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.TestPackedTableDrivenLite)
+  return target;
+}
+
+size_t TestPackedTableDrivenLite::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.TestPackedTableDrivenLite)
+  return ::google::protobuf::internal::TableByteSize(
+      this,
+      protobuf_google_2fprotobuf_2funittest_5ftable_5fdriven_5flite_2eproto::TableStruct::serialization_table[
+        TestPackedTableDrivenLite::kIndexInFileMessages]);
+}
+
+void TestPackedTableDrivenLite::CheckTypeAndMergeFrom(
+    const ::google::protobuf::MessageLite& from) {
+  MergeFrom(*::google::protobuf::down_cast<const TestPackedTableDrivenLite*>(&from));
+}
+
+void TestPackedTableDrivenLite::MergeFrom(const TestPackedTableDrivenLite& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.TestPackedTableDrivenLite)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  packed_int32_.MergeFrom(from.packed_int32_);
+  packed_int64_.MergeFrom(from.packed_int64_);
+  packed_uint32_.MergeFrom(from.packed_uint32_);
+  packed_uint64_.MergeFrom(from.packed_uint64_);
+  packed_sint32_.MergeFrom(from.packed_sint32_);
+  packed_sint64_.MergeFrom(from.packed_sint64_);
+  packed_fixed32_.MergeFrom(from.packed_fixed32_);
+  packed_fixed64_.MergeFrom(from.packed_fixed64_);
+  packed_sfixed32_.MergeFrom(from.packed_sfixed32_);
+  packed_sfixed64_.MergeFrom(from.packed_sfixed64_);
+  packed_float_.MergeFrom(from.packed_float_);
+  packed_double_.MergeFrom(from.packed_double_);
+  packed_bool_.MergeFrom(from.packed_bool_);
+  packed_enum_.MergeFrom(from.packed_enum_);
+}
+
+void TestPackedTableDrivenLite::CopyFrom(const TestPackedTableDrivenLite& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.TestPackedTableDrivenLite)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TestPackedTableDrivenLite::IsInitialized() const {
+  return true;
+}
+
+void TestPackedTableDrivenLite::Swap(TestPackedTableDrivenLite* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void TestPackedTableDrivenLite::InternalSwap(TestPackedTableDrivenLite* other) {
+  packed_int32_.InternalSwap(&other->packed_int32_);
+  packed_int64_.InternalSwap(&other->packed_int64_);
+  packed_uint32_.InternalSwap(&other->packed_uint32_);
+  packed_uint64_.InternalSwap(&other->packed_uint64_);
+  packed_sint32_.InternalSwap(&other->packed_sint32_);
+  packed_sint64_.InternalSwap(&other->packed_sint64_);
+  packed_fixed32_.InternalSwap(&other->packed_fixed32_);
+  packed_fixed64_.InternalSwap(&other->packed_fixed64_);
+  packed_sfixed32_.InternalSwap(&other->packed_sfixed32_);
+  packed_sfixed64_.InternalSwap(&other->packed_sfixed64_);
+  packed_float_.InternalSwap(&other->packed_float_);
+  packed_double_.InternalSwap(&other->packed_double_);
+  packed_bool_.InternalSwap(&other->packed_bool_);
+  packed_enum_.InternalSwap(&other->packed_enum_);
+  std::swap(_has_bits_[0], other->_has_bits_[0]);
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  std::swap(_cached_size_, other->_cached_size_);
+}
+
+::std::string TestPackedTableDrivenLite::GetTypeName() const {
+  return "protobuf_unittest.TestPackedTableDrivenLite";
+}
+
+#if PROTOBUF_INLINE_NOT_IN_HEADERS
+// TestPackedTableDrivenLite
+
+// repeated int32 packed_int32 = 90 [packed = true];
+int TestPackedTableDrivenLite::packed_int32_size() const {
+  return packed_int32_.size();
+}
+void TestPackedTableDrivenLite::clear_packed_int32() {
+  packed_int32_.Clear();
+}
+::google::protobuf::int32 TestPackedTableDrivenLite::packed_int32(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestPackedTableDrivenLite.packed_int32)
+  return packed_int32_.Get(index);
+}
+void TestPackedTableDrivenLite::set_packed_int32(int index, ::google::protobuf::int32 value) {
+  packed_int32_.Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestPackedTableDrivenLite.packed_int32)
+}
+void TestPackedTableDrivenLite::add_packed_int32(::google::protobuf::int32 value) {
+  packed_int32_.Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestPackedTableDrivenLite.packed_int32)
+}
+const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
+TestPackedTableDrivenLite::packed_int32() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestPackedTableDrivenLite.packed_int32)
+  return packed_int32_;
+}
+::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
+TestPackedTableDrivenLite::mutable_packed_int32() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestPackedTableDrivenLite.packed_int32)
+  return &packed_int32_;
+}
+
+// repeated int64 packed_int64 = 91 [packed = true];
+int TestPackedTableDrivenLite::packed_int64_size() const {
+  return packed_int64_.size();
+}
+void TestPackedTableDrivenLite::clear_packed_int64() {
+  packed_int64_.Clear();
+}
+::google::protobuf::int64 TestPackedTableDrivenLite::packed_int64(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestPackedTableDrivenLite.packed_int64)
+  return packed_int64_.Get(index);
+}
+void TestPackedTableDrivenLite::set_packed_int64(int index, ::google::protobuf::int64 value) {
+  packed_int64_.Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestPackedTableDrivenLite.packed_int64)
+}
+void TestPackedTableDrivenLite::add_packed_int64(::google::protobuf::int64 value) {
+  packed_int64_.Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestPackedTableDrivenLite.packed_int64)
+}
+const ::google::protobuf::RepeatedField< ::google::protobuf::int64 >&
+TestPackedTableDrivenLite::packed_int64() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestPackedTableDrivenLite.packed_int64)
+  return packed_int64_;
+}
+::google::protobuf::RepeatedField< ::google::protobuf::int64 >*
+TestPackedTableDrivenLite::mutable_packed_int64() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestPackedTableDrivenLite.packed_int64)
+  return &packed_int64_;
+}
+
+// repeated uint32 packed_uint32 = 92 [packed = true];
+int TestPackedTableDrivenLite::packed_uint32_size() const {
+  return packed_uint32_.size();
+}
+void TestPackedTableDrivenLite::clear_packed_uint32() {
+  packed_uint32_.Clear();
+}
+::google::protobuf::uint32 TestPackedTableDrivenLite::packed_uint32(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestPackedTableDrivenLite.packed_uint32)
+  return packed_uint32_.Get(index);
+}
+void TestPackedTableDrivenLite::set_packed_uint32(int index, ::google::protobuf::uint32 value) {
+  packed_uint32_.Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestPackedTableDrivenLite.packed_uint32)
+}
+void TestPackedTableDrivenLite::add_packed_uint32(::google::protobuf::uint32 value) {
+  packed_uint32_.Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestPackedTableDrivenLite.packed_uint32)
+}
+const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
+TestPackedTableDrivenLite::packed_uint32() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestPackedTableDrivenLite.packed_uint32)
+  return packed_uint32_;
+}
+::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
+TestPackedTableDrivenLite::mutable_packed_uint32() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestPackedTableDrivenLite.packed_uint32)
+  return &packed_uint32_;
+}
+
+// repeated uint64 packed_uint64 = 93 [packed = true];
+int TestPackedTableDrivenLite::packed_uint64_size() const {
+  return packed_uint64_.size();
+}
+void TestPackedTableDrivenLite::clear_packed_uint64() {
+  packed_uint64_.Clear();
+}
+::google::protobuf::uint64 TestPackedTableDrivenLite::packed_uint64(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestPackedTableDrivenLite.packed_uint64)
+  return packed_uint64_.Get(index);
+}
+void TestPackedTableDrivenLite::set_packed_uint64(int index, ::google::protobuf::uint64 value) {
+  packed_uint64_.Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestPackedTableDrivenLite.packed_uint64)
+}
+void TestPackedTableDrivenLite::add_packed_uint64(::google::protobuf::uint64 value) {
+  packed_uint64_.Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestPackedTableDrivenLite.packed_uint64)
+}
+const ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >&
+TestPackedTableDrivenLite::packed_uint64() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestPackedTableDrivenLite.packed_uint64)
+  return packed_uint64_;
+}
+::google::protobuf::RepeatedField< ::google::protobuf::uint64 >*
+TestPackedTableDrivenLite::mutable_packed_uint64() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestPackedTableDrivenLite.packed_uint64)
+  return &packed_uint64_;
+}
+
+// repeated sint32 packed_sint32 = 94 [packed = true];
+int TestPackedTableDrivenLite::packed_sint32_size() const {
+  return packed_sint32_.size();
+}
+void TestPackedTableDrivenLite::clear_packed_sint32() {
+  packed_sint32_.Clear();
+}
+::google::protobuf::int32 TestPackedTableDrivenLite::packed_sint32(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestPackedTableDrivenLite.packed_sint32)
+  return packed_sint32_.Get(index);
+}
+void TestPackedTableDrivenLite::set_packed_sint32(int index, ::google::protobuf::int32 value) {
+  packed_sint32_.Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestPackedTableDrivenLite.packed_sint32)
+}
+void TestPackedTableDrivenLite::add_packed_sint32(::google::protobuf::int32 value) {
+  packed_sint32_.Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestPackedTableDrivenLite.packed_sint32)
+}
+const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
+TestPackedTableDrivenLite::packed_sint32() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestPackedTableDrivenLite.packed_sint32)
+  return packed_sint32_;
+}
+::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
+TestPackedTableDrivenLite::mutable_packed_sint32() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestPackedTableDrivenLite.packed_sint32)
+  return &packed_sint32_;
+}
+
+// repeated sint64 packed_sint64 = 95 [packed = true];
+int TestPackedTableDrivenLite::packed_sint64_size() const {
+  return packed_sint64_.size();
+}
+void TestPackedTableDrivenLite::clear_packed_sint64() {
+  packed_sint64_.Clear();
+}
+::google::protobuf::int64 TestPackedTableDrivenLite::packed_sint64(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestPackedTableDrivenLite.packed_sint64)
+  return packed_sint64_.Get(index);
+}
+void TestPackedTableDrivenLite::set_packed_sint64(int index, ::google::protobuf::int64 value) {
+  packed_sint64_.Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestPackedTableDrivenLite.packed_sint64)
+}
+void TestPackedTableDrivenLite::add_packed_sint64(::google::protobuf::int64 value) {
+  packed_sint64_.Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestPackedTableDrivenLite.packed_sint64)
+}
+const ::google::protobuf::RepeatedField< ::google::protobuf::int64 >&
+TestPackedTableDrivenLite::packed_sint64() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestPackedTableDrivenLite.packed_sint64)
+  return packed_sint64_;
+}
+::google::protobuf::RepeatedField< ::google::protobuf::int64 >*
+TestPackedTableDrivenLite::mutable_packed_sint64() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestPackedTableDrivenLite.packed_sint64)
+  return &packed_sint64_;
+}
+
+// repeated fixed32 packed_fixed32 = 96 [packed = true];
+int TestPackedTableDrivenLite::packed_fixed32_size() const {
+  return packed_fixed32_.size();
+}
+void TestPackedTableDrivenLite::clear_packed_fixed32() {
+  packed_fixed32_.Clear();
+}
+::google::protobuf::uint32 TestPackedTableDrivenLite::packed_fixed32(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestPackedTableDrivenLite.packed_fixed32)
+  return packed_fixed32_.Get(index);
+}
+void TestPackedTableDrivenLite::set_packed_fixed32(int index, ::google::protobuf::uint32 value) {
+  packed_fixed32_.Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestPackedTableDrivenLite.packed_fixed32)
+}
+void TestPackedTableDrivenLite::add_packed_fixed32(::google::protobuf::uint32 value) {
+  packed_fixed32_.Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestPackedTableDrivenLite.packed_fixed32)
+}
+const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
+TestPackedTableDrivenLite::packed_fixed32() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestPackedTableDrivenLite.packed_fixed32)
+  return packed_fixed32_;
+}
+::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
+TestPackedTableDrivenLite::mutable_packed_fixed32() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestPackedTableDrivenLite.packed_fixed32)
+  return &packed_fixed32_;
+}
+
+// repeated fixed64 packed_fixed64 = 97 [packed = true];
+int TestPackedTableDrivenLite::packed_fixed64_size() const {
+  return packed_fixed64_.size();
+}
+void TestPackedTableDrivenLite::clear_packed_fixed64() {
+  packed_fixed64_.Clear();
+}
+::google::protobuf::uint64 TestPackedTableDrivenLite::packed_fixed64(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestPackedTableDrivenLite.packed_fixed64)
+  return packed_fixed64_.Get(index);
+}
+void TestPackedTableDrivenLite::set_packed_fixed64(int index, ::google::protobuf::uint64 value) {
+  packed_fixed64_.Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestPackedTableDrivenLite.packed_fixed64)
+}
+void TestPackedTableDrivenLite::add_packed_fixed64(::google::protobuf::uint64 value) {
+  packed_fixed64_.Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestPackedTableDrivenLite.packed_fixed64)
+}
+const ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >&
+TestPackedTableDrivenLite::packed_fixed64() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestPackedTableDrivenLite.packed_fixed64)
+  return packed_fixed64_;
+}
+::google::protobuf::RepeatedField< ::google::protobuf::uint64 >*
+TestPackedTableDrivenLite::mutable_packed_fixed64() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestPackedTableDrivenLite.packed_fixed64)
+  return &packed_fixed64_;
+}
+
+// repeated sfixed32 packed_sfixed32 = 98 [packed = true];
+int TestPackedTableDrivenLite::packed_sfixed32_size() const {
+  return packed_sfixed32_.size();
+}
+void TestPackedTableDrivenLite::clear_packed_sfixed32() {
+  packed_sfixed32_.Clear();
+}
+::google::protobuf::int32 TestPackedTableDrivenLite::packed_sfixed32(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestPackedTableDrivenLite.packed_sfixed32)
+  return packed_sfixed32_.Get(index);
+}
+void TestPackedTableDrivenLite::set_packed_sfixed32(int index, ::google::protobuf::int32 value) {
+  packed_sfixed32_.Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestPackedTableDrivenLite.packed_sfixed32)
+}
+void TestPackedTableDrivenLite::add_packed_sfixed32(::google::protobuf::int32 value) {
+  packed_sfixed32_.Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestPackedTableDrivenLite.packed_sfixed32)
+}
+const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
+TestPackedTableDrivenLite::packed_sfixed32() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestPackedTableDrivenLite.packed_sfixed32)
+  return packed_sfixed32_;
+}
+::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
+TestPackedTableDrivenLite::mutable_packed_sfixed32() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestPackedTableDrivenLite.packed_sfixed32)
+  return &packed_sfixed32_;
+}
+
+// repeated sfixed64 packed_sfixed64 = 99 [packed = true];
+int TestPackedTableDrivenLite::packed_sfixed64_size() const {
+  return packed_sfixed64_.size();
+}
+void TestPackedTableDrivenLite::clear_packed_sfixed64() {
+  packed_sfixed64_.Clear();
+}
+::google::protobuf::int64 TestPackedTableDrivenLite::packed_sfixed64(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestPackedTableDrivenLite.packed_sfixed64)
+  return packed_sfixed64_.Get(index);
+}
+void TestPackedTableDrivenLite::set_packed_sfixed64(int index, ::google::protobuf::int64 value) {
+  packed_sfixed64_.Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestPackedTableDrivenLite.packed_sfixed64)
+}
+void TestPackedTableDrivenLite::add_packed_sfixed64(::google::protobuf::int64 value) {
+  packed_sfixed64_.Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestPackedTableDrivenLite.packed_sfixed64)
+}
+const ::google::protobuf::RepeatedField< ::google::protobuf::int64 >&
+TestPackedTableDrivenLite::packed_sfixed64() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestPackedTableDrivenLite.packed_sfixed64)
+  return packed_sfixed64_;
+}
+::google::protobuf::RepeatedField< ::google::protobuf::int64 >*
+TestPackedTableDrivenLite::mutable_packed_sfixed64() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestPackedTableDrivenLite.packed_sfixed64)
+  return &packed_sfixed64_;
+}
+
+// repeated float packed_float = 100 [packed = true];
+int TestPackedTableDrivenLite::packed_float_size() const {
+  return packed_float_.size();
+}
+void TestPackedTableDrivenLite::clear_packed_float() {
+  packed_float_.Clear();
+}
+float TestPackedTableDrivenLite::packed_float(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestPackedTableDrivenLite.packed_float)
+  return packed_float_.Get(index);
+}
+void TestPackedTableDrivenLite::set_packed_float(int index, float value) {
+  packed_float_.Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestPackedTableDrivenLite.packed_float)
+}
+void TestPackedTableDrivenLite::add_packed_float(float value) {
+  packed_float_.Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestPackedTableDrivenLite.packed_float)
+}
+const ::google::protobuf::RepeatedField< float >&
+TestPackedTableDrivenLite::packed_float() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestPackedTableDrivenLite.packed_float)
+  return packed_float_;
+}
+::google::protobuf::RepeatedField< float >*
+TestPackedTableDrivenLite::mutable_packed_float() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestPackedTableDrivenLite.packed_float)
+  return &packed_float_;
+}
+
+// repeated double packed_double = 101 [packed = true];
+int TestPackedTableDrivenLite::packed_double_size() const {
+  return packed_double_.size();
+}
+void TestPackedTableDrivenLite::clear_packed_double() {
+  packed_double_.Clear();
+}
+double TestPackedTableDrivenLite::packed_double(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestPackedTableDrivenLite.packed_double)
+  return packed_double_.Get(index);
+}
+void TestPackedTableDrivenLite::set_packed_double(int index, double value) {
+  packed_double_.Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestPackedTableDrivenLite.packed_double)
+}
+void TestPackedTableDrivenLite::add_packed_double(double value) {
+  packed_double_.Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestPackedTableDrivenLite.packed_double)
+}
+const ::google::protobuf::RepeatedField< double >&
+TestPackedTableDrivenLite::packed_double() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestPackedTableDrivenLite.packed_double)
+  return packed_double_;
+}
+::google::protobuf::RepeatedField< double >*
+TestPackedTableDrivenLite::mutable_packed_double() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestPackedTableDrivenLite.packed_double)
+  return &packed_double_;
+}
+
+// repeated bool packed_bool = 102 [packed = true];
+int TestPackedTableDrivenLite::packed_bool_size() const {
+  return packed_bool_.size();
+}
+void TestPackedTableDrivenLite::clear_packed_bool() {
+  packed_bool_.Clear();
+}
+bool TestPackedTableDrivenLite::packed_bool(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestPackedTableDrivenLite.packed_bool)
+  return packed_bool_.Get(index);
+}
+void TestPackedTableDrivenLite::set_packed_bool(int index, bool value) {
+  packed_bool_.Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestPackedTableDrivenLite.packed_bool)
+}
+void TestPackedTableDrivenLite::add_packed_bool(bool value) {
+  packed_bool_.Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestPackedTableDrivenLite.packed_bool)
+}
+const ::google::protobuf::RepeatedField< bool >&
+TestPackedTableDrivenLite::packed_bool() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestPackedTableDrivenLite.packed_bool)
+  return packed_bool_;
+}
+::google::protobuf::RepeatedField< bool >*
+TestPackedTableDrivenLite::mutable_packed_bool() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestPackedTableDrivenLite.packed_bool)
+  return &packed_bool_;
+}
+
+// repeated .protobuf_unittest.ForeignEnumLite packed_enum = 103 [packed = true];
+int TestPackedTableDrivenLite::packed_enum_size() const {
+  return packed_enum_.size();
+}
+void TestPackedTableDrivenLite::clear_packed_enum() {
+  packed_enum_.Clear();
+}
+::protobuf_unittest::ForeignEnumLite TestPackedTableDrivenLite::packed_enum(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestPackedTableDrivenLite.packed_enum)
+  return static_cast< ::protobuf_unittest::ForeignEnumLite >(packed_enum_.Get(index));
+}
+void TestPackedTableDrivenLite::set_packed_enum(int index, ::protobuf_unittest::ForeignEnumLite value) {
+  assert(::protobuf_unittest::ForeignEnumLite_IsValid(value));
+  packed_enum_.Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestPackedTableDrivenLite.packed_enum)
+}
+void TestPackedTableDrivenLite::add_packed_enum(::protobuf_unittest::ForeignEnumLite value) {
+  assert(::protobuf_unittest::ForeignEnumLite_IsValid(value));
+  packed_enum_.Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestPackedTableDrivenLite.packed_enum)
+}
+const ::google::protobuf::RepeatedField<int>&
+TestPackedTableDrivenLite::packed_enum() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestPackedTableDrivenLite.packed_enum)
+  return packed_enum_;
+}
+::google::protobuf::RepeatedField<int>*
+TestPackedTableDrivenLite::mutable_packed_enum() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestPackedTableDrivenLite.packed_enum)
+  return &packed_enum_;
+}
+
+#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
+
+// ===================================================================
+
+#if !defined(_MSC_VER) || _MSC_VER >= 1900
+const int TestRepeatedTableDrivenLite::kInt32ValuesFieldNumber;
+const int TestRepeatedTableDrivenLite::kPackedInt32ValuesFieldNumber;
+const int TestRepeatedTableDrivenLite::kPackedSint64ValuesFieldNumber;
+const int TestRepeatedTableDrivenLite::kFixed32ValuesFieldNumber;
+const int TestRepeatedTableDrivenLite::kPackedDoubleValuesFieldNumber;
+const int TestRepeatedTableDrivenLite::kEnumValuesFieldNumber;
+const int TestRepeatedTableDrivenLite::kPackedEnumValuesFieldNumber;
+const int TestRepeatedTableDrivenLite::kStringValuesFieldNumber;
+const int TestRepeatedTableDrivenLite::kMessageValuesFieldNumber;
+#endif  // !defined(_MSC_VER) || _MSC_VER >= 1900
+
+TestRepeatedTableDrivenLite::TestRepeatedTableDrivenLite()
+  : ::google::protobuf::MessageLite(), _internal_metadata_(NULL) {
+  if (GOOGLE_PREDICT_TRUE(this != internal_default_instance())) {
+    protobuf_google_2fprotobuf_2funittest_5ftable_5fdriven_5flite_2eproto::InitDefaults();
+  }
+  SharedCtor();
+  // @@protoc_insertion_point(constructor:protobuf_unittest.TestRepeatedTableDrivenLite)
+}
+TestRepeatedTableDrivenLite::TestRepeatedTableDrivenLite(const TestRepeatedTableDrivenLite& from)
+  : ::google::protobuf::MessageLite(),
+      _internal_metadata_(NULL),
+      _has_bits_(from._has_bits_),
+      _cached_size_(0),
+      int32_values_(from.int32_values_),
+      packed_int32_values_(from.packed_int32_values_),
+      packed_sint64_values_(from.packed_sint64_values_),
+      fixed32_values_(from.fixed32_values_),
+      packed_double_values_(from.packed_double_values_),
+      enum_values_(from.enum_values_),
+      packed_enum_values_(from.packed_enum_values_),
+      string_values_(from.string_values_),
+      message_values_(from.message_values_) {
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  // @@protoc_insertion_point(copy_constructor:protobuf_unittest.TestRepeatedTableDrivenLite)
+}
+
+void TestRepeatedTableDrivenLite::SharedCtor() {
+  _cached_size_ = 0;
+}
+
+TestRepeatedTableDrivenLite::~TestRepeatedTableDrivenLite() {
+  // @@protoc_insertion_point(destructor:protobuf_unittest.TestRepeatedTableDrivenLite)
+  SharedDtor();
+}
+
+void TestRepeatedTableDrivenLite::SharedDtor() {
+}
+
+void TestRepeatedTableDrivenLite::SetCachedSize(int size) const {
+  GOOGLE_SAFE_CONCURRENT_WRITES_BEGIN();
+  _cached_size_ = size;
+  GOOGLE_SAFE_CONCURRENT_WRITES_END();
+}
+const TestRepeatedTableDrivenLite& TestRepeatedTableDrivenLite::default_instance() {
+  protobuf_google_2fprotobuf_2funittest_5ftable_5fdriven_5flite_2eproto::InitDefaults();
+  return *internal_default_instance();
+}
+
+TestRepeatedTableDrivenLite* TestRepeatedTableDrivenLite::New(::google::protobuf::Arena* arena) const {
+  TestRepeatedTableDrivenLite* n = new TestRepeatedTableDrivenLite;
+  if (arena != NULL) {
+    arena->Own(n);
+  }
+  return n;
+}
+
+void TestRepeatedTableDrivenLite::Clear() {
+// @@protoc_insertion_point(message_clear_start:protobuf_unittest.TestRepeatedTableDrivenLite)
+  int32_values_.Clear();
+  packed_int32_values_.Clear();
+  packed_sint64_values_.Clear();
+  fixed32_values_.Clear();
+  packed_double_values_.Clear();
+  enum_values_.Clear();
+  packed_enum_values_.Clear();
+  string_values_.Clear();
+  message_values_.Clear();
+  _has_bits_.Clear();
+  _internal_metadata_.Clear();
+}
+
+bool TestRepeatedTableDrivenLite::MergePartialFromCodedStream(
+    ::google::protobuf::io::CodedInputStream* input) {
+  return ::google::protobuf::internal::MergePartialFromCodedStream(
+      this,
+      protobuf_google_2fprotobuf_2funittest_5ftable_5fdriven_5flite_2eproto::TableStruct::schema[
+        TestRepeatedTableDrivenLite::kIndexInFileMessages],
+      input);
+}
+
+void TestRepeatedTableDrivenLite::SerializeWithCachedSizes(
+    ::google::protobuf::io::CodedOutputStream* output) const {
+  // @@protoc_insertion_point(serialize_start:protobuf_unittest.TestRepeatedTableDrivenLite)
+  ::google::protobuf::internal::TableSerialize(
+      this,
+      protobuf_google_2fprotobuf_2funittest_5ftable_5fdriven_5flite_2eproto::TableStruct::serialization_table[
+        TestRepeatedTableDrivenLite::kIndexInFileMessages],
+      output);
+  // @@protoc_insertion_point(serialize_end:protobuf_unittest.TestRepeatedTableDrivenLite)
+}
+
+::google::protobuf::uint8* TestRepeatedTableDrivenLite::InternalSerializeWithCachedSizesToArray(
+    bool deterministic, ::google::protobuf::uint8* target) const {
+  // @@protoc_insertion_point(serialize_to_array_start:protobuf_unittest.TestRepeatedTableDrivenLite)
+  target = ::google::protobuf::internal::TableSerializeToArray(
+      this,
+      protobuf_google_2fprotobuf_2funittest_5ftable_5fdriven_5flite_2eproto::TableStruct::serialization_table[
+        TestRepeatedTableDrivenLite::kIndexInFileMessages],
+      deterministic, target);
+  // @@protoc_insertion_point(serialize_to_array_end:protobuf_unittest.TestRepeatedTableDrivenLite)
+  return target;
+}
+
+size_t TestRepeatedTableDrivenLite::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:protobuf_unittest.TestRepeatedTableDrivenLite)
+  return ::google::protobuf::internal::TableByteSize(
+      this,
+      protobuf_google_2fprotobuf_2funittest_5ftable_5fdriven_5flite_2eproto::TableStruct::serialization_table[
+        TestRepeatedTableDrivenLite::kIndexInFileMessages]);
+}
+
+void TestRepeatedTableDrivenLite::CheckTypeAndMergeFrom(
+    const ::google::protobuf::MessageLite& from) {
+  MergeFrom(*::google::protobuf::down_cast<const TestRepeatedTableDrivenLite*>(&from));
+}
+
+void TestRepeatedTableDrivenLite::MergeFrom(const TestRepeatedTableDrivenLite& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:protobuf_unittest.TestRepeatedTableDrivenLite)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom(from._internal_metadata_);
+  ::google::protobuf::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  int32_values_.MergeFrom(from.int32_values_);
+  packed_int32_values_.MergeFrom(from.packed_int32_values_);
+  packed_sint64_values_.MergeFrom(from.packed_sint64_values_);
+  fixed32_values_.MergeFrom(from.fixed32_values_);
+  packed_double_values_.MergeFrom(from.packed_double_values_);
+  enum_values_.MergeFrom(from.enum_values_);
+  packed_enum_values_.MergeFrom(from.packed_enum_values_);
+  string_values_.MergeFrom(from.string_values_);
+  message_values_.MergeFrom(from.message_values_);
+}
+
+void TestRepeatedTableDrivenLite::CopyFrom(const TestRepeatedTableDrivenLite& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:protobuf_unittest.TestRepeatedTableDrivenLite)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool TestRepeatedTableDrivenLite::IsInitialized() const {
+  return true;
+}
+
+void TestRepeatedTableDrivenLite::Swap(TestRepeatedTableDrivenLite* other) {
+  if (other == this) return;
+  InternalSwap(other);
+}
+void TestRepeatedTableDrivenLite::InternalSwap(TestRepeatedTableDrivenLite* other) {
+  int32_values_.InternalSwap(&other->int32_values_);
+  packed_int32_values_.InternalSwap(&other->packed_int32_values_);
+  packed_sint64_values_.InternalSwap(&other->packed_sint64_values_);
+  fixed32_values_.InternalSwap(&other->fixed32_values_);
+  packed_double_values_.InternalSwap(&other->packed_double_values_);
+  enum_values_.InternalSwap(&other->enum_values_);
+  packed_enum_values_.InternalSwap(&other->packed_enum_values_);
+  string_values_.InternalSwap(&other->string_values_);
+  message_values_.InternalSwap(&other->message_values_);
+  std::swap(_has_bits_[0], other->_has_bits_[0]);
+  _internal_metadata_.Swap(&other->_internal_metadata_);
+  std::swap(_cached_size_, other->_cached_size_);
+}
+
+::std::string TestRepeatedTableDrivenLite::GetTypeName() const {
+  return "protobuf_unittest.TestRepeatedTableDrivenLite";
+}
+
+#if PROTOBUF_INLINE_NOT_IN_HEADERS
+// TestRepeatedTableDrivenLite
+
+// repeated int32 int32_values = 1;
+int TestRepeatedTableDrivenLite::int32_values_size() const {
+  return int32_values_.size();
+}
+void TestRepeatedTableDrivenLite::clear_int32_values() {
+  int32_values_.Clear();
+}
+::google::protobuf::int32 TestRepeatedTableDrivenLite::int32_values(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestRepeatedTableDrivenLite.int32_values)
+  return int32_values_.Get(index);
+}
+void TestRepeatedTableDrivenLite::set_int32_values(int index, ::google::protobuf::int32 value) {
+  int32_values_.Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestRepeatedTableDrivenLite.int32_values)
+}
+void TestRepeatedTableDrivenLite::add_int32_values(::google::protobuf::int32 value) {
+  int32_values_.Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestRepeatedTableDrivenLite.int32_values)
+}
+const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
+TestRepeatedTableDrivenLite::int32_values() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestRepeatedTableDrivenLite.int32_values)
+  return int32_values_;
+}
+::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
+TestRepeatedTableDrivenLite::mutable_int32_values() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestRepeatedTableDrivenLite.int32_values)
+  return &int32_values_;
+}
+
+// repeated int32 packed_int32_values = 2 [packed = true];
+int TestRepeatedTableDrivenLite::packed_int32_values_size() const {
+  return packed_int32_values_.size();
+}
+void TestRepeatedTableDrivenLite::clear_packed_int32_values() {
+  packed_int32_values_.Clear();
+}
+::google::protobuf::int32 TestRepeatedTableDrivenLite::packed_int32_values(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestRepeatedTableDrivenLite.packed_int32_values)
+  return packed_int32_values_.Get(index);
+}
+void TestRepeatedTableDrivenLite::set_packed_int32_values(int index, ::google::protobuf::int32 value) {
+  packed_int32_values_.Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestRepeatedTableDrivenLite.packed_int32_values)
+}
+void TestRepeatedTableDrivenLite::add_packed_int32_values(::google::protobuf::int32 value) {
+  packed_int32_values_.Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestRepeatedTableDrivenLite.packed_int32_values)
+}
+const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
+TestRepeatedTableDrivenLite::packed_int32_values() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestRepeatedTableDrivenLite.packed_int32_values)
+  return packed_int32_values_;
+}
+::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
+TestRepeatedTableDrivenLite::mutable_packed_int32_values() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestRepeatedTableDrivenLite.packed_int32_values)
+  return &packed_int32_values_;
+}
+
+// repeated sint64 packed_sint64_values = 3 [packed = true];
+int TestRepeatedTableDrivenLite::packed_sint64_values_size() const {
+  return packed_sint64_values_.size();
+}
+void TestRepeatedTableDrivenLite::clear_packed_sint64_values() {
+  packed_sint64_values_.Clear();
+}
+::google::protobuf::int64 TestRepeatedTableDrivenLite::packed_sint64_values(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestRepeatedTableDrivenLite.packed_sint64_values)
+  return packed_sint64_values_.Get(index);
+}
+void TestRepeatedTableDrivenLite::set_packed_sint64_values(int index, ::google::protobuf::int64 value) {
+  packed_sint64_values_.Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestRepeatedTableDrivenLite.packed_sint64_values)
+}
+void TestRepeatedTableDrivenLite::add_packed_sint64_values(::google::protobuf::int64 value) {
+  packed_sint64_values_.Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestRepeatedTableDrivenLite.packed_sint64_values)
+}
+const ::google::protobuf::RepeatedField< ::google::protobuf::int64 >&
+TestRepeatedTableDrivenLite::packed_sint64_values() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestRepeatedTableDrivenLite.packed_sint64_values)
+  return packed_sint64_values_;
+}
+::google::protobuf::RepeatedField< ::google::protobuf::int64 >*
+TestRepeatedTableDrivenLite::mutable_packed_sint64_values() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestRepeatedTableDrivenLite.packed_sint64_values)
+  return &packed_sint64_values_;
+}
+
+// repeated fixed32 fixed32_values = 4;
+int TestRepeatedTableDrivenLite::fixed32_values_size() const {
+  return fixed32_values_.size();
+}
+void TestRepeatedTableDrivenLite::clear_fixed32_values() {
+  fixed32_values_.Clear();
+}
+::google::protobuf::uint32 TestRepeatedTableDrivenLite::fixed32_values(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestRepeatedTableDrivenLite.fixed32_values)
+  return fixed32_values_.Get(index);
+}
+void TestRepeatedTableDrivenLite::set_fixed32_values(int index, ::google::protobuf::uint32 value) {
+  fixed32_values_.Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestRepeatedTableDrivenLite.fixed32_values)
+}
+void TestRepeatedTableDrivenLite::add_fixed32_values(::google::protobuf::uint32 value) {
+  fixed32_values_.Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestRepeatedTableDrivenLite.fixed32_values)
+}
+const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
+TestRepeatedTableDrivenLite::fixed32_values() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestRepeatedTableDrivenLite.fixed32_values)
+  return fixed32_values_;
+}
+::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
+TestRepeatedTableDrivenLite::mutable_fixed32_values() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestRepeatedTableDrivenLite.fixed32_values)
+  return &fixed32_values_;
+}
+
+// repeated double packed_double_values = 5 [packed = true];
+int TestRepeatedTableDrivenLite::packed_double_values_size() const {
+  return packed_double_values_.size();
+}
+void TestRepeatedTableDrivenLite::clear_packed_double_values() {
+  packed_double_values_.Clear();
+}
+double TestRepeatedTableDrivenLite::packed_double_values(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestRepeatedTableDrivenLite.packed_double_values)
+  return packed_double_values_.Get(index);
+}
+void TestRepeatedTableDrivenLite::set_packed_double_values(int index, double value) {
+  packed_double_values_.Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestRepeatedTableDrivenLite.packed_double_values)
+}
+void TestRepeatedTableDrivenLite::add_packed_double_values(double value) {
+  packed_double_values_.Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestRepeatedTableDrivenLite.packed_double_values)
+}
+const ::google::protobuf::RepeatedField< double >&
+TestRepeatedTableDrivenLite::packed_double_values() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestRepeatedTableDrivenLite.packed_double_values)
+  return packed_double_values_;
+}
+::google::protobuf::RepeatedField< double >*
+TestRepeatedTableDrivenLite::mutable_packed_double_values() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestRepeatedTableDrivenLite.packed_double_values)
+  return &packed_double_values_;
+}
+
+// repeated .protobuf_unittest.ForeignEnumLite enum_values = 6;
+int TestRepeatedTableDrivenLite::enum_values_size() const {
+  return enum_values_.size();
+}
+void TestRepeatedTableDrivenLite::clear_enum_values() {
+  enum_values_.Clear();
+}
+::protobuf_unittest::ForeignEnumLite TestRepeatedTableDrivenLite::enum_values(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestRepeatedTableDrivenLite.enum_values)
+  return static_cast< ::protobuf_unittest::ForeignEnumLite >(enum_values_.Get(index));
+}
+void TestRepeatedTableDrivenLite::set_enum_values(int index, ::protobuf_unittest::ForeignEnumLite value) {
+  assert(::protobuf_unittest::ForeignEnumLite_IsValid(value));
+  enum_values_.Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestRepeatedTableDrivenLite.enum_values)
+}
+void TestRepeatedTableDrivenLite::add_enum_values(::protobuf_unittest::ForeignEnumLite value) {
+  assert(::protobuf_unittest::ForeignEnumLite_IsValid(value));
+  enum_values_.Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestRepeatedTableDrivenLite.enum_values)
+}
+const ::google::protobuf::RepeatedField<int>&
+TestRepeatedTableDrivenLite::enum_values() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestRepeatedTableDrivenLite.enum_values)
+  return enum_values_;
+}
+::google::protobuf::RepeatedField<int>*
+TestRepeatedTableDrivenLite::mutable_enum_values() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestRepeatedTableDrivenLite.enum_values)
+  return &enum_values_;
+}
+
+// repeated .protobuf_unittest.ForeignEnumLite packed_enum_values = 7 [packed = true];
+int TestRepeatedTableDrivenLite::packed_enum_values_size() const {
+  return packed_enum_values_.size();
+}
+void TestRepeatedTableDrivenLite::clear_packed_enum_values() {
+  packed_enum_values_.Clear();
+}
+::protobuf_unittest::ForeignEnumLite TestRepeatedTableDrivenLite::packed_enum_values(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestRepeatedTableDrivenLite.packed_enum_values)
+  return static_cast< ::protobuf_unittest::ForeignEnumLite >(packed_enum_values_.Get(index));
+}
+void TestRepeatedTableDrivenLite::set_packed_enum_values(int index, ::protobuf_unittest::ForeignEnumLite value) {
+  assert(::protobuf_unittest::ForeignEnumLite_IsValid(value));
+  packed_enum_values_.Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestRepeatedTableDrivenLite.packed_enum_values)
+}
+void TestRepeatedTableDrivenLite::add_packed_enum_values(::protobuf_unittest::ForeignEnumLite value) {
+  assert(::protobuf_unittest::ForeignEnumLite_IsValid(value));
+  packed_enum_values_.Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestRepeatedTableDrivenLite.packed_enum_values)
+}
+const ::google::protobuf::RepeatedField<int>&
+TestRepeatedTableDrivenLite::packed_enum_values() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestRepeatedTableDrivenLite.packed_enum_values)
+  return packed_enum_values_;
+}
+::google::protobuf::RepeatedField<int>*
+TestRepeatedTableDrivenLite::mutable_packed_enum_values() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestRepeatedTableDrivenLite.packed_enum_values)
+  return &packed_enum_values_;
+}
+
+// repeated string string_values = 8;
+int TestRepeatedTableDrivenLite::string_values_size() const {
+  return string_values_.size();
+}
+void TestRepeatedTableDrivenLite::clear_string_values() {
+  string_values_.Clear();
+}
+const ::std::string& TestRepeatedTableDrivenLite::string_values(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestRepeatedTableDrivenLite.string_values)
+  return string_values_.Get(index);
+}
+::std::string* TestRepeatedTableDrivenLite::mutable_string_values(int index) {
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestRepeatedTableDrivenLite.string_values)
+  return string_values_.Mutable(index);
+}
+void TestRepeatedTableDrivenLite::set_string_values(int index, const ::std::string& value) {
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestRepeatedTableDrivenLite.string_values)
+  string_values_.Mutable(index)->assign(value);
+}
+#if LANG_CXX11
+void TestRepeatedTableDrivenLite::set_string_values(int index, ::std::string&& value) {
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestRepeatedTableDrivenLite.string_values)
+  string_values_.Mutable(index)->assign(std::move(value));
+}
+#endif
+void TestRepeatedTableDrivenLite::set_string_values(int index, const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  string_values_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:protobuf_unittest.TestRepeatedTableDrivenLite.string_values)
+}
+void TestRepeatedTableDrivenLite::set_string_values(int index, const char* value, size_t size) {
+  string_values_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:protobuf_unittest.TestRepeatedTableDrivenLite.string_values)
+}
+::std::string* TestRepeatedTableDrivenLite::add_string_values() {
+  // @@protoc_insertion_point(field_add_mutable:protobuf_unittest.TestRepeatedTableDrivenLite.string_values)
+  return string_values_.Add();
+}
+void TestRepeatedTableDrivenLite::add_string_values(const ::std::string& value) {
+  string_values_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestRepeatedTableDrivenLite.string_values)
+}
+#if LANG_CXX11
+void TestRepeatedTableDrivenLite::add_string_values(::std::string&& value) {
+  string_values_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestRepeatedTableDrivenLite.string_values)
+}
+#endif
+void TestRepeatedTableDrivenLite::add_string_values(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  string_values_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:protobuf_unittest.TestRepeatedTableDrivenLite.string_values)
+}
+void TestRepeatedTableDrivenLite::add_string_values(const char* value, size_t size) {
+  string_values_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:protobuf_unittest.TestRepeatedTableDrivenLite.string_values)
+}
+const ::google::protobuf::RepeatedPtrField< ::std::string>&
+TestRepeatedTableDrivenLite::string_values() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestRepeatedTableDrivenLite.string_values)
+  return string_values_;
+}
+::google::protobuf::RepeatedPtrField< ::std::string>*
+TestRepeatedTableDrivenLite::mutable_string_values() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestRepeatedTableDrivenLite.string_values)
+  return &string_values_;
+}
+
+// repeated .protobuf_unittest.TestTableDrivenLite.NestedMessage message_values = 9;
+int TestRepeatedTableDrivenLite::message_values_size() const {
+  return message_values_.size();
+}
+void TestRepeatedTableDrivenLite::clear_message_values() {
+  message_values_.Clear();
+}
+const ::protobuf_unittest::TestTableDrivenLite_NestedMessage& TestRepeatedTableDrivenLite::message_values(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestRepeatedTableDrivenLite.message_values)
+  return message_values_.Get(index);
+}
+::protobuf_unittest::TestTableDrivenLite_NestedMessage* TestRepeatedTableDrivenLite::mutable_message_values(int index) {
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestRepeatedTableDrivenLite.message_values)
+  return message_values_.Mutable(index);
+}
+::protobuf_unittest::TestTableDrivenLite_NestedMessage* TestRepeatedTableDrivenLite::add_message_values() {
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestRepeatedTableDrivenLite.message_values)
+  return message_values_.Add();
+}
+::google::protobuf::RepeatedPtrField< ::protobuf_unittest::TestTableDrivenLite_NestedMessage >*
+TestRepeatedTableDrivenLite::mutable_message_values() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestRepeatedTableDrivenLite.message_values)
+  return &message_values_;
+}
+const ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::TestTableDrivenLite_NestedMessage >&
+TestRepeatedTableDrivenLite::message_values() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestRepeatedTableDrivenLite.message_values)
+  return message_values_;
+}
+
+#endif  // PROTOBUF_INLINE_NOT_IN_HEADERS
+
+// @@protoc_insertion_point(namespace_scope)
+
+}  // namespace protobuf_unittest
+
+// @@protoc_insertion_point(global_scope)
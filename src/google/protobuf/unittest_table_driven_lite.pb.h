@@ -0,0 +1,3725 @@
+// Generated by the protocol buffer compiler.  DO NOT EDIT!
+// source: google/protobuf/unittest_table_driven_lite.proto
+
+#ifndef PROTOBUF_google_2fprotobuf_2funittest_5ftable_5fdriven_5flite_2eproto__INCLUDED
+#define PROTOBUF_google_2fprotobuf_2funittest_5ftable_5fdriven_5flite_2eproto__INCLUDED
+
+#include <string>
+
+#include <google/protobuf/stubs/common.h>
+
+#if GOOGLE_PROTOBUF_VERSION < 3003000
+#error This file was generated by a newer version of protoc which is
+#error incompatible with your Protocol Buffer headers.  Please update
+#error your headers.
+#endif
+#if 3003000 < GOOGLE_PROTOBUF_MIN_PROTOC_VERSION
+#error This file was generated by an older version of protoc which is
+#error incompatible with your Protocol Buffer headers.  Please
+#error regenerate this file with a newer version of protoc.
+#endif
+
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/arenastring.h>
+#include <google/protobuf/generated_message_table_driven.h>
+#include <google/protobuf/generated_message_util.h>
+#include <google/protobuf/metadata_lite.h>
+#include <google/protobuf/message_lite.h>
+#include <google/protobuf/repeated_field.h>  // IWYU pragma: export
+#include <google/protobuf/extension_set.h>  // IWYU pragma: export
+#include <google/protobuf/generated_enum_util.h>
+#include <google/protobuf/unittest_lite.pb.h>
+// @@protoc_insertion_point(includes)
+namespace protobuf_unittest {
+class ForeignMessageLite;
+class ForeignMessageLiteDefaultTypeInternal;
+extern ForeignMessageLiteDefaultTypeInternal _ForeignMessageLite_default_instance_;
+class OptionalGroup_extension_lite;
+class OptionalGroup_extension_liteDefaultTypeInternal;
+extern OptionalGroup_extension_liteDefaultTypeInternal _OptionalGroup_extension_lite_default_instance_;
+class RepeatedGroup_extension_lite;
+class RepeatedGroup_extension_liteDefaultTypeInternal;
+extern RepeatedGroup_extension_liteDefaultTypeInternal _RepeatedGroup_extension_lite_default_instance_;
+class TestAllExtensionsLite;
+class TestAllExtensionsLiteDefaultTypeInternal;
+extern TestAllExtensionsLiteDefaultTypeInternal _TestAllExtensionsLite_default_instance_;
+class TestAllTypesLite;
+class TestAllTypesLiteDefaultTypeInternal;
+extern TestAllTypesLiteDefaultTypeInternal _TestAllTypesLite_default_instance_;
+class TestAllTypesLite_NestedMessage;
+class TestAllTypesLite_NestedMessageDefaultTypeInternal;
+extern TestAllTypesLite_NestedMessageDefaultTypeInternal _TestAllTypesLite_NestedMessage_default_instance_;
+class TestAllTypesLite_OptionalGroup;
+class TestAllTypesLite_OptionalGroupDefaultTypeInternal;
+extern TestAllTypesLite_OptionalGroupDefaultTypeInternal _TestAllTypesLite_OptionalGroup_default_instance_;
+class TestAllTypesLite_RepeatedGroup;
+class TestAllTypesLite_RepeatedGroupDefaultTypeInternal;
+extern TestAllTypesLite_RepeatedGroupDefaultTypeInternal _TestAllTypesLite_RepeatedGroup_default_instance_;
+class TestDeprecatedLite;
+class TestDeprecatedLiteDefaultTypeInternal;
+extern TestDeprecatedLiteDefaultTypeInternal _TestDeprecatedLite_default_instance_;
+class TestEmptyMessageLite;
+class TestEmptyMessageLiteDefaultTypeInternal;
+extern TestEmptyMessageLiteDefaultTypeInternal _TestEmptyMessageLite_default_instance_;
+class TestEmptyMessageWithExtensionsLite;
+class TestEmptyMessageWithExtensionsLiteDefaultTypeInternal;
+extern TestEmptyMessageWithExtensionsLiteDefaultTypeInternal _TestEmptyMessageWithExtensionsLite_default_instance_;
+class TestHugeFieldNumbersLite;
+class TestHugeFieldNumbersLiteDefaultTypeInternal;
+extern TestHugeFieldNumbersLiteDefaultTypeInternal _TestHugeFieldNumbersLite_default_instance_;
+class TestHugeFieldNumbersLite_OptionalGroup;
+class TestHugeFieldNumbersLite_OptionalGroupDefaultTypeInternal;
+extern TestHugeFieldNumbersLite_OptionalGroupDefaultTypeInternal _TestHugeFieldNumbersLite_OptionalGroup_default_instance_;
+class TestHugeFieldNumbersLite_StringStringMapEntry;
+class TestHugeFieldNumbersLite_StringStringMapEntryDefaultTypeInternal;
+extern TestHugeFieldNumbersLite_StringStringMapEntryDefaultTypeInternal _TestHugeFieldNumbersLite_StringStringMapEntry_default_instance_;
+class TestNestedExtensionLite;
+class TestNestedExtensionLiteDefaultTypeInternal;
+extern TestNestedExtensionLiteDefaultTypeInternal _TestNestedExtensionLite_default_instance_;
+class TestPackedExtensionsLite;
+class TestPackedExtensionsLiteDefaultTypeInternal;
+extern TestPackedExtensionsLiteDefaultTypeInternal _TestPackedExtensionsLite_default_instance_;
+class TestPackedTableDrivenLite;
+class TestPackedTableDrivenLiteDefaultTypeInternal;
+extern TestPackedTableDrivenLiteDefaultTypeInternal _TestPackedTableDrivenLite_default_instance_;
+class TestPackedTypesLite;
+class TestPackedTypesLiteDefaultTypeInternal;
+extern TestPackedTypesLiteDefaultTypeInternal _TestPackedTypesLite_default_instance_;
+class TestParsingMergeLite;
+class TestParsingMergeLiteDefaultTypeInternal;
+extern TestParsingMergeLiteDefaultTypeInternal _TestParsingMergeLite_default_instance_;
+class TestParsingMergeLite_OptionalGroup;
+class TestParsingMergeLite_OptionalGroupDefaultTypeInternal;
+extern TestParsingMergeLite_OptionalGroupDefaultTypeInternal _TestParsingMergeLite_OptionalGroup_default_instance_;
+class TestParsingMergeLite_RepeatedFieldsGenerator;
+class TestParsingMergeLite_RepeatedFieldsGeneratorDefaultTypeInternal;
+extern TestParsingMergeLite_RepeatedFieldsGeneratorDefaultTypeInternal _TestParsingMergeLite_RepeatedFieldsGenerator_default_instance_;
+class TestParsingMergeLite_RepeatedFieldsGenerator_Group1;
+class TestParsingMergeLite_RepeatedFieldsGenerator_Group1DefaultTypeInternal;
+extern TestParsingMergeLite_RepeatedFieldsGenerator_Group1DefaultTypeInternal _TestParsingMergeLite_RepeatedFieldsGenerator_Group1_default_instance_;
+class TestParsingMergeLite_RepeatedFieldsGenerator_Group2;
+class TestParsingMergeLite_RepeatedFieldsGenerator_Group2DefaultTypeInternal;
+extern TestParsingMergeLite_RepeatedFieldsGenerator_Group2DefaultTypeInternal _TestParsingMergeLite_RepeatedFieldsGenerator_Group2_default_instance_;
+class TestParsingMergeLite_RepeatedGroup;
+class TestParsingMergeLite_RepeatedGroupDefaultTypeInternal;
+extern TestParsingMergeLite_RepeatedGroupDefaultTypeInternal _TestParsingMergeLite_RepeatedGroup_default_instance_;
+class TestRepeatedTableDrivenLite;
+class TestRepeatedTableDrivenLiteDefaultTypeInternal;
+extern TestRepeatedTableDrivenLiteDefaultTypeInternal _TestRepeatedTableDrivenLite_default_instance_;
+class TestTableDrivenLite;
+class TestTableDrivenLiteDefaultTypeInternal;
+extern TestTableDrivenLiteDefaultTypeInternal _TestTableDrivenLite_default_instance_;
+class TestTableDrivenLite_NestedMessage;
+class TestTableDrivenLite_NestedMessageDefaultTypeInternal;
+extern TestTableDrivenLite_NestedMessageDefaultTypeInternal _TestTableDrivenLite_NestedMessage_default_instance_;
+class TestTableDrivenLite_OptionalGroup;
+class TestTableDrivenLite_OptionalGroupDefaultTypeInternal;
+extern TestTableDrivenLite_OptionalGroupDefaultTypeInternal _TestTableDrivenLite_OptionalGroup_default_instance_;
+class TestTableDrivenLite_RepeatedGroup;
+class TestTableDrivenLite_RepeatedGroupDefaultTypeInternal;
+extern TestTableDrivenLite_RepeatedGroupDefaultTypeInternal _TestTableDrivenLite_RepeatedGroup_default_instance_;
+class V1MessageLite;
+class V1MessageLiteDefaultTypeInternal;
+extern V1MessageLiteDefaultTypeInternal _V1MessageLite_default_instance_;
+class V2MessageLite;
+class V2MessageLiteDefaultTypeInternal;
+extern V2MessageLiteDefaultTypeInternal _V2MessageLite_default_instance_;
+}  // namespace protobuf_unittest
+
+namespace protobuf_unittest {
+
+namespace protobuf_google_2fprotobuf_2funittest_5ftable_5fdriven_5flite_2eproto {
+// Internal implementation detail -- do not call these.
+struct TableStruct {
+  static const ::google::protobuf::internal::ParseTableField entries[];
+  static const ::google::protobuf::internal::AuxillaryParseTableField aux[];
+  static const ::google::protobuf::internal::ParseTable schema[];
+  static const ::google::protobuf::internal::SerializationTableField
+      serialization_fields[];
+  static const ::google::protobuf::internal::SerializationTable
+      serialization_table[];
+  static const ::google::protobuf::uint32 offsets[];
+  static void InitDefaultsImpl();
+  static void Shutdown();
+};
+void AddDescriptors();
+void InitDefaults();
+}  // namespace protobuf_google_2fprotobuf_2funittest_5ftable_5fdriven_5flite_2eproto
+
+enum TestTableDrivenLite_NestedEnum {
+  TestTableDrivenLite_NestedEnum_FOO = 1,
+  TestTableDrivenLite_NestedEnum_BAR = 2,
+  TestTableDrivenLite_NestedEnum_BAZ = 3
+};
+bool TestTableDrivenLite_NestedEnum_IsValid(int value);
+const TestTableDrivenLite_NestedEnum TestTableDrivenLite_NestedEnum_NestedEnum_MIN = TestTableDrivenLite_NestedEnum_FOO;
+const TestTableDrivenLite_NestedEnum TestTableDrivenLite_NestedEnum_NestedEnum_MAX = TestTableDrivenLite_NestedEnum_BAZ;
+const int TestTableDrivenLite_NestedEnum_NestedEnum_ARRAYSIZE = TestTableDrivenLite_NestedEnum_NestedEnum_MAX + 1;
+
+// ===================================================================
+
+class TestTableDrivenLite_NestedMessage : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:protobuf_unittest.TestTableDrivenLite.NestedMessage) */ {
+ public:
+  TestTableDrivenLite_NestedMessage();
+  virtual ~TestTableDrivenLite_NestedMessage();
+
+  TestTableDrivenLite_NestedMessage(const TestTableDrivenLite_NestedMessage& from);
+
+  inline TestTableDrivenLite_NestedMessage& operator=(const TestTableDrivenLite_NestedMessage& from) {
+    CopyFrom(from);
+    return *this;
+  }
+
+  inline const ::std::string& unknown_fields() const {
+    return _internal_metadata_.unknown_fields();
+  }
+
+  inline ::std::string* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields();
+  }
+
+  static const TestTableDrivenLite_NestedMessage& default_instance();
+
+  static inline const TestTableDrivenLite_NestedMessage* internal_default_instance() {
+    return reinterpret_cast<const TestTableDrivenLite_NestedMessage*>(
+               &_TestTableDrivenLite_NestedMessage_default_instance_);
+  }
+  static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
+    0;
+
+  void Swap(TestTableDrivenLite_NestedMessage* other);
+
+  // implements Message ----------------------------------------------
+
+  inline TestTableDrivenLite_NestedMessage* New() const PROTOBUF_FINAL { return New(NULL); }
+
+  TestTableDrivenLite_NestedMessage* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
+  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)
+    PROTOBUF_FINAL;
+  void CopyFrom(const TestTableDrivenLite_NestedMessage& from);
+  void MergeFrom(const TestTableDrivenLite_NestedMessage& from);
+  void Clear() PROTOBUF_FINAL;
+  bool IsInitialized() const PROTOBUF_FINAL;
+
+  size_t ByteSizeLong() const PROTOBUF_FINAL;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
+  void DiscardUnknownFields();
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
+  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(TestTableDrivenLite_NestedMessage* other);
+  private:
+  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
+    return NULL;
+  }
+  inline void* MaybeArenaPtr() const {
+    return NULL;
+  }
+  public:
+
+  ::std::string GetTypeName() const PROTOBUF_FINAL;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // optional int64 cc = 2;
+  bool has_cc() const;
+  void clear_cc();
+  static const int kCcFieldNumber = 2;
+  ::google::protobuf::int64 cc() const;
+  void set_cc(::google::protobuf::int64 value);
+
+  // optional int32 bb = 1;
+  bool has_bb() const;
+  void clear_bb();
+  static const int kBbFieldNumber = 1;
+  ::google::protobuf::int32 bb() const;
+  void set_bb(::google::protobuf::int32 value);
+
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TestTableDrivenLite.NestedMessage)
+ private:
+  void set_has_bb();
+  void clear_has_bb();
+  void set_has_cc();
+  void clear_has_cc();
+
+  ::google::protobuf::internal::InternalMetadataWithArenaLite _internal_metadata_;
+  ::google::protobuf::internal::HasBits<1> _has_bits_;
+  mutable int _cached_size_;
+  ::google::protobuf::int64 cc_;
+  ::google::protobuf::int32 bb_;
+  friend struct protobuf_google_2fprotobuf_2funittest_5ftable_5fdriven_5flite_2eproto::TableStruct;
+};
+// -------------------------------------------------------------------
+
+class TestTableDrivenLite_OptionalGroup : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:protobuf_unittest.TestTableDrivenLite.OptionalGroup) */ {
+ public:
+  TestTableDrivenLite_OptionalGroup();
+  virtual ~TestTableDrivenLite_OptionalGroup();
+
+  TestTableDrivenLite_OptionalGroup(const TestTableDrivenLite_OptionalGroup& from);
+
+  inline TestTableDrivenLite_OptionalGroup& operator=(const TestTableDrivenLite_OptionalGroup& from) {
+    CopyFrom(from);
+    return *this;
+  }
+
+  inline const ::std::string& unknown_fields() const {
+    return _internal_metadata_.unknown_fields();
+  }
+
+  inline ::std::string* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields();
+  }
+
+  static const TestTableDrivenLite_OptionalGroup& default_instance();
+
+  static inline const TestTableDrivenLite_OptionalGroup* internal_default_instance() {
+    return reinterpret_cast<const TestTableDrivenLite_OptionalGroup*>(
+               &_TestTableDrivenLite_OptionalGroup_default_instance_);
+  }
+  static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
+    1;
+
+  void Swap(TestTableDrivenLite_OptionalGroup* other);
+
+  // implements Message ----------------------------------------------
+
+  inline TestTableDrivenLite_OptionalGroup* New() const PROTOBUF_FINAL { return New(NULL); }
+
+  TestTableDrivenLite_OptionalGroup* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
+  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)
+    PROTOBUF_FINAL;
+  void CopyFrom(const TestTableDrivenLite_OptionalGroup& from);
+  void MergeFrom(const TestTableDrivenLite_OptionalGroup& from);
+  void Clear() PROTOBUF_FINAL;
+  bool IsInitialized() const PROTOBUF_FINAL;
+
+  size_t ByteSizeLong() const PROTOBUF_FINAL;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
+  void DiscardUnknownFields();
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
+  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(TestTableDrivenLite_OptionalGroup* other);
+  private:
+  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
+    return NULL;
+  }
+  inline void* MaybeArenaPtr() const {
+    return NULL;
+  }
+  public:
+
+  ::std::string GetTypeName() const PROTOBUF_FINAL;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // optional int32 a = 17;
+  bool has_a() const;
+  void clear_a();
+  static const int kAFieldNumber = 17;
+  ::google::protobuf::int32 a() const;
+  void set_a(::google::protobuf::int32 value);
+
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TestTableDrivenLite.OptionalGroup)
+ private:
+  void set_has_a();
+  void clear_has_a();
+
+  ::google::protobuf::internal::InternalMetadataWithArenaLite _internal_metadata_;
+  ::google::protobuf::internal::HasBits<1> _has_bits_;
+  mutable int _cached_size_;
+  ::google::protobuf::int32 a_;
+  friend struct protobuf_google_2fprotobuf_2funittest_5ftable_5fdriven_5flite_2eproto::TableStruct;
+};
+// -------------------------------------------------------------------
+
+class TestTableDrivenLite_RepeatedGroup : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:protobuf_unittest.TestTableDrivenLite.RepeatedGroup) */ {
+ public:
+  TestTableDrivenLite_RepeatedGroup();
+  virtual ~TestTableDrivenLite_RepeatedGroup();
+
+  TestTableDrivenLite_RepeatedGroup(const TestTableDrivenLite_RepeatedGroup& from);
+
+  inline TestTableDrivenLite_RepeatedGroup& operator=(const TestTableDrivenLite_RepeatedGroup& from) {
+    CopyFrom(from);
+    return *this;
+  }
+
+  inline const ::std::string& unknown_fields() const {
+    return _internal_metadata_.unknown_fields();
+  }
+
+  inline ::std::string* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields();
+  }
+
+  static const TestTableDrivenLite_RepeatedGroup& default_instance();
+
+  static inline const TestTableDrivenLite_RepeatedGroup* internal_default_instance() {
+    return reinterpret_cast<const TestTableDrivenLite_RepeatedGroup*>(
+               &_TestTableDrivenLite_RepeatedGroup_default_instance_);
+  }
+  static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
+    2;
+
+  void Swap(TestTableDrivenLite_RepeatedGroup* other);
+
+  // implements Message ----------------------------------------------
+
+  inline TestTableDrivenLite_RepeatedGroup* New() const PROTOBUF_FINAL { return New(NULL); }
+
+  TestTableDrivenLite_RepeatedGroup* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
+  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)
+    PROTOBUF_FINAL;
+  void CopyFrom(const TestTableDrivenLite_RepeatedGroup& from);
+  void MergeFrom(const TestTableDrivenLite_RepeatedGroup& from);
+  void Clear() PROTOBUF_FINAL;
+  bool IsInitialized() const PROTOBUF_FINAL;
+
+  size_t ByteSizeLong() const PROTOBUF_FINAL;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
+  void DiscardUnknownFields();
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
+  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(TestTableDrivenLite_RepeatedGroup* other);
+  private:
+  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
+    return NULL;
+  }
+  inline void* MaybeArenaPtr() const {
+    return NULL;
+  }
+  public:
+
+  ::std::string GetTypeName() const PROTOBUF_FINAL;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // optional int32 a = 47;
+  bool has_a() const;
+  void clear_a();
+  static const int kAFieldNumber = 47;
+  ::google::protobuf::int32 a() const;
+  void set_a(::google::protobuf::int32 value);
+
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TestTableDrivenLite.RepeatedGroup)
+ private:
+  void set_has_a();
+  void clear_has_a();
+
+  ::google::protobuf::internal::InternalMetadataWithArenaLite _internal_metadata_;
+  ::google::protobuf::internal::HasBits<1> _has_bits_;
+  mutable int _cached_size_;
+  ::google::protobuf::int32 a_;
+  friend struct protobuf_google_2fprotobuf_2funittest_5ftable_5fdriven_5flite_2eproto::TableStruct;
+};
+// -------------------------------------------------------------------
+
+class TestTableDrivenLite : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:protobuf_unittest.TestTableDrivenLite) */ {
+ public:
+  TestTableDrivenLite();
+  virtual ~TestTableDrivenLite();
+
+  TestTableDrivenLite(const TestTableDrivenLite& from);
+
+  inline TestTableDrivenLite& operator=(const TestTableDrivenLite& from) {
+    CopyFrom(from);
+    return *this;
+  }
+
+  inline const ::std::string& unknown_fields() const {
+    return _internal_metadata_.unknown_fields();
+  }
+
+  inline ::std::string* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields();
+  }
+
+  static const TestTableDrivenLite& default_instance();
+
+  static inline const TestTableDrivenLite* internal_default_instance() {
+    return reinterpret_cast<const TestTableDrivenLite*>(
+               &_TestTableDrivenLite_default_instance_);
+  }
+  static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
+    3;
+
+  void Swap(TestTableDrivenLite* other);
+
+  // implements Message ----------------------------------------------
+
+  inline TestTableDrivenLite* New() const PROTOBUF_FINAL { return New(NULL); }
+
+  TestTableDrivenLite* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
+  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)
+    PROTOBUF_FINAL;
+  void CopyFrom(const TestTableDrivenLite& from);
+  void MergeFrom(const TestTableDrivenLite& from);
+  void Clear() PROTOBUF_FINAL;
+  bool IsInitialized() const PROTOBUF_FINAL;
+
+  size_t ByteSizeLong() const PROTOBUF_FINAL;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
+  void DiscardUnknownFields();
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
+  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(TestTableDrivenLite* other);
+  private:
+  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
+    return NULL;
+  }
+  inline void* MaybeArenaPtr() const {
+    return NULL;
+  }
+  public:
+
+  ::std::string GetTypeName() const PROTOBUF_FINAL;
+
+  // nested types ----------------------------------------------------
+
+  typedef TestTableDrivenLite_NestedMessage NestedMessage;
+  typedef TestTableDrivenLite_OptionalGroup OptionalGroup;
+  typedef TestTableDrivenLite_RepeatedGroup RepeatedGroup;
+
+  typedef TestTableDrivenLite_NestedEnum NestedEnum;
+  static const NestedEnum FOO =
+    TestTableDrivenLite_NestedEnum_FOO;
+  static const NestedEnum BAR =
+    TestTableDrivenLite_NestedEnum_BAR;
+  static const NestedEnum BAZ =
+    TestTableDrivenLite_NestedEnum_BAZ;
+  static inline bool NestedEnum_IsValid(int value) {
+    return TestTableDrivenLite_NestedEnum_IsValid(value);
+  }
+  static const NestedEnum NestedEnum_MIN =
+    TestTableDrivenLite_NestedEnum_NestedEnum_MIN;
+  static const NestedEnum NestedEnum_MAX =
+    TestTableDrivenLite_NestedEnum_NestedEnum_MAX;
+  static const int NestedEnum_ARRAYSIZE =
+    TestTableDrivenLite_NestedEnum_NestedEnum_ARRAYSIZE;
+
+  // accessors -------------------------------------------------------
+
+  // repeated int32 repeated_int32 = 31;
+  int repeated_int32_size() const;
+  void clear_repeated_int32();
+  static const int kRepeatedInt32FieldNumber = 31;
+  ::google::protobuf::int32 repeated_int32(int index) const;
+  void set_repeated_int32(int index, ::google::protobuf::int32 value);
+  void add_repeated_int32(::google::protobuf::int32 value);
+  const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
+      repeated_int32() const;
+  ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
+      mutable_repeated_int32();
+
+  // repeated int64 repeated_int64 = 32;
+  int repeated_int64_size() const;
+  void clear_repeated_int64();
+  static const int kRepeatedInt64FieldNumber = 32;
+  ::google::protobuf::int64 repeated_int64(int index) const;
+  void set_repeated_int64(int index, ::google::protobuf::int64 value);
+  void add_repeated_int64(::google::protobuf::int64 value);
+  const ::google::protobuf::RepeatedField< ::google::protobuf::int64 >&
+      repeated_int64() const;
+  ::google::protobuf::RepeatedField< ::google::protobuf::int64 >*
+      mutable_repeated_int64();
+
+  // repeated uint32 repeated_uint32 = 33;
+  int repeated_uint32_size() const;
+  void clear_repeated_uint32();
+  static const int kRepeatedUint32FieldNumber = 33;
+  ::google::protobuf::uint32 repeated_uint32(int index) const;
+  void set_repeated_uint32(int index, ::google::protobuf::uint32 value);
+  void add_repeated_uint32(::google::protobuf::uint32 value);
+  const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
+      repeated_uint32() const;
+  ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
+      mutable_repeated_uint32();
+
+  // repeated uint64 repeated_uint64 = 34;
+  int repeated_uint64_size() const;
+  void clear_repeated_uint64();
+  static const int kRepeatedUint64FieldNumber = 34;
+  ::google::protobuf::uint64 repeated_uint64(int index) const;
+  void set_repeated_uint64(int index, ::google::protobuf::uint64 value);
+  void add_repeated_uint64(::google::protobuf::uint64 value);
+  const ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >&
+      repeated_uint64() const;
+  ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >*
+      mutable_repeated_uint64();
+
+  // repeated sint32 repeated_sint32 = 35;
+  int repeated_sint32_size() const;
+  void clear_repeated_sint32();
+  static const int kRepeatedSint32FieldNumber = 35;
+  ::google::protobuf::int32 repeated_sint32(int index) const;
+  void set_repeated_sint32(int index, ::google::protobuf::int32 value);
+  void add_repeated_sint32(::google::protobuf::int32 value);
+  const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
+      repeated_sint32() const;
+  ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
+      mutable_repeated_sint32();
+
+  // repeated sint64 repeated_sint64 = 36;
+  int repeated_sint64_size() const;
+  void clear_repeated_sint64();
+  static const int kRepeatedSint64FieldNumber = 36;
+  ::google::protobuf::int64 repeated_sint64(int index) const;
+  void set_repeated_sint64(int index, ::google::protobuf::int64 value);
+  void add_repeated_sint64(::google::protobuf::int64 value);
+  const ::google::protobuf::RepeatedField< ::google::protobuf::int64 >&
+      repeated_sint64() const;
+  ::google::protobuf::RepeatedField< ::google::protobuf::int64 >*
+      mutable_repeated_sint64();
+
+  // repeated fixed32 repeated_fixed32 = 37;
+  int repeated_fixed32_size() const;
+  void clear_repeated_fixed32();
+  static const int kRepeatedFixed32FieldNumber = 37;
+  ::google::protobuf::uint32 repeated_fixed32(int index) const;
+  void set_repeated_fixed32(int index, ::google::protobuf::uint32 value);
+  void add_repeated_fixed32(::google::protobuf::uint32 value);
+  const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
+      repeated_fixed32() const;
+  ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
+      mutable_repeated_fixed32();
+
+  // repeated fixed64 repeated_fixed64 = 38;
+  int repeated_fixed64_size() const;
+  void clear_repeated_fixed64();
+  static const int kRepeatedFixed64FieldNumber = 38;
+  ::google::protobuf::uint64 repeated_fixed64(int index) const;
+  void set_repeated_fixed64(int index, ::google::protobuf::uint64 value);
+  void add_repeated_fixed64(::google::protobuf::uint64 value);
+  const ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >&
+      repeated_fixed64() const;
+  ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >*
+      mutable_repeated_fixed64();
+
+  // repeated sfixed32 repeated_sfixed32 = 39;
+  int repeated_sfixed32_size() const;
+  void clear_repeated_sfixed32();
+  static const int kRepeatedSfixed32FieldNumber = 39;
+  ::google::protobuf::int32 repeated_sfixed32(int index) const;
+  void set_repeated_sfixed32(int index, ::google::protobuf::int32 value);
+  void add_repeated_sfixed32(::google::protobuf::int32 value);
+  const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
+      repeated_sfixed32() const;
+  ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
+      mutable_repeated_sfixed32();
+
+  // repeated sfixed64 repeated_sfixed64 = 40;
+  int repeated_sfixed64_size() const;
+  void clear_repeated_sfixed64();
+  static const int kRepeatedSfixed64FieldNumber = 40;
+  ::google::protobuf::int64 repeated_sfixed64(int index) const;
+  void set_repeated_sfixed64(int index, ::google::protobuf::int64 value);
+  void add_repeated_sfixed64(::google::protobuf::int64 value);
+  const ::google::protobuf::RepeatedField< ::google::protobuf::int64 >&
+      repeated_sfixed64() const;
+  ::google::protobuf::RepeatedField< ::google::protobuf::int64 >*
+      mutable_repeated_sfixed64();
+
+  // repeated float repeated_float = 41;
+  int repeated_float_size() const;
+  void clear_repeated_float();
+  static const int kRepeatedFloatFieldNumber = 41;
+  float repeated_float(int index) const;
+  void set_repeated_float(int index, float value);
+  void add_repeated_float(float value);
+  const ::google::protobuf::RepeatedField< float >&
+      repeated_float() const;
+  ::google::protobuf::RepeatedField< float >*
+      mutable_repeated_float();
+
+  // repeated double repeated_double = 42;
+  int repeated_double_size() const;
+  void clear_repeated_double();
+  static const int kRepeatedDoubleFieldNumber = 42;
+  double repeated_double(int index) const;
+  void set_repeated_double(int index, double value);
+  void add_repeated_double(double value);
+  const ::google::protobuf::RepeatedField< double >&
+      repeated_double() const;
+  ::google::protobuf::RepeatedField< double >*
+      mutable_repeated_double();
+
+  // repeated bool repeated_bool = 43;
+  int repeated_bool_size() const;
+  void clear_repeated_bool();
+  static const int kRepeatedBoolFieldNumber = 43;
+  bool repeated_bool(int index) const;
+  void set_repeated_bool(int index, bool value);
+  void add_repeated_bool(bool value);
+  const ::google::protobuf::RepeatedField< bool >&
+      repeated_bool() const;
+  ::google::protobuf::RepeatedField< bool >*
+      mutable_repeated_bool();
+
+  // repeated string repeated_string = 44;
+  int repeated_string_size() const;
+  void clear_repeated_string();
+  static const int kRepeatedStringFieldNumber = 44;
+  const ::std::string& repeated_string(int index) const;
+  ::std::string* mutable_repeated_string(int index);
+  void set_repeated_string(int index, const ::std::string& value);
+  #if LANG_CXX11
+  void set_repeated_string(int index, ::std::string&& value);
+  #endif
+  void set_repeated_string(int index, const char* value);
+  void set_repeated_string(int index, const char* value, size_t size);
+  ::std::string* add_repeated_string();
+  void add_repeated_string(const ::std::string& value);
+  #if LANG_CXX11
+  void add_repeated_string(::std::string&& value);
+  #endif
+  void add_repeated_string(const char* value);
+  void add_repeated_string(const char* value, size_t size);
+  const ::google::protobuf::RepeatedPtrField< ::std::string>& repeated_string() const;
+  ::google::protobuf::RepeatedPtrField< ::std::string>* mutable_repeated_string();
+
+  // repeated bytes repeated_bytes = 45;
+  int repeated_bytes_size() const;
+  void clear_repeated_bytes();
+  static const int kRepeatedBytesFieldNumber = 45;
+  const ::std::string& repeated_bytes(int index) const;
+  ::std::string* mutable_repeated_bytes(int index);
+  void set_repeated_bytes(int index, const ::std::string& value);
+  #if LANG_CXX11
+  void set_repeated_bytes(int index, ::std::string&& value);
+  #endif
+  void set_repeated_bytes(int index, const char* value);
+  void set_repeated_bytes(int index, const void* value, size_t size);
+  ::std::string* add_repeated_bytes();
+  void add_repeated_bytes(const ::std::string& value);
+  #if LANG_CXX11
+  void add_repeated_bytes(::std::string&& value);
+  #endif
+  void add_repeated_bytes(const char* value);
+  void add_repeated_bytes(const void* value, size_t size);
+  const ::google::protobuf::RepeatedPtrField< ::std::string>& repeated_bytes() const;
+  ::google::protobuf::RepeatedPtrField< ::std::string>* mutable_repeated_bytes();
+
+  // repeated group RepeatedGroup = 46 { ... };
+  int repeatedgroup_size() const;
+  void clear_repeatedgroup();
+  static const int kRepeatedgroupFieldNumber = 46;
+  const ::protobuf_unittest::TestTableDrivenLite_RepeatedGroup& repeatedgroup(int index) const;
+  ::protobuf_unittest::TestTableDrivenLite_RepeatedGroup* mutable_repeatedgroup(int index);
+  ::protobuf_unittest::TestTableDrivenLite_RepeatedGroup* add_repeatedgroup();
+  ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::TestTableDrivenLite_RepeatedGroup >*
+      mutable_repeatedgroup();
+  const ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::TestTableDrivenLite_RepeatedGroup >&
+      repeatedgroup() const;
+
+  // repeated .protobuf_unittest.TestTableDrivenLite.NestedMessage repeated_nested_message = 48;
+  int repeated_nested_message_size() const;
+  void clear_repeated_nested_message();
+  static const int kRepeatedNestedMessageFieldNumber = 48;
+  const ::protobuf_unittest::TestTableDrivenLite_NestedMessage& repeated_nested_message(int index) const;
+  ::protobuf_unittest::TestTableDrivenLite_NestedMessage* mutable_repeated_nested_message(int index);
+  ::protobuf_unittest::TestTableDrivenLite_NestedMessage* add_repeated_nested_message();
+  ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::TestTableDrivenLite_NestedMessage >*
+      mutable_repeated_nested_message();
+  const ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::TestTableDrivenLite_NestedMessage >&
+      repeated_nested_message() const;
+
+  // repeated .protobuf_unittest.ForeignMessageLite repeated_foreign_message = 49;
+  int repeated_foreign_message_size() const;
+  void clear_repeated_foreign_message();
+  static const int kRepeatedForeignMessageFieldNumber = 49;
+  const ::protobuf_unittest::ForeignMessageLite& repeated_foreign_message(int index) const;
+  ::protobuf_unittest::ForeignMessageLite* mutable_repeated_foreign_message(int index);
+  ::protobuf_unittest::ForeignMessageLite* add_repeated_foreign_message();
+  ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::ForeignMessageLite >*
+      mutable_repeated_foreign_message();
+  const ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::ForeignMessageLite >&
+      repeated_foreign_message() const;
+
+  // repeated .protobuf_unittest.TestTableDrivenLite.NestedEnum repeated_nested_enum = 51;
+  int repeated_nested_enum_size() const;
+  void clear_repeated_nested_enum();
+  static const int kRepeatedNestedEnumFieldNumber = 51;
+  ::protobuf_unittest::TestTableDrivenLite_NestedEnum repeated_nested_enum(int index) const;
+  void set_repeated_nested_enum(int index, ::protobuf_unittest::TestTableDrivenLite_NestedEnum value);
+  void add_repeated_nested_enum(::protobuf_unittest::TestTableDrivenLite_NestedEnum value);
+  const ::google::protobuf::RepeatedField<int>& repeated_nested_enum() const;
+  ::google::protobuf::RepeatedField<int>* mutable_repeated_nested_enum();
+
+  // repeated .protobuf_unittest.ForeignEnumLite repeated_foreign_enum = 52;
+  int repeated_foreign_enum_size() const;
+  void clear_repeated_foreign_enum();
+  static const int kRepeatedForeignEnumFieldNumber = 52;
+  ::protobuf_unittest::ForeignEnumLite repeated_foreign_enum(int index) const;
+  void set_repeated_foreign_enum(int index, ::protobuf_unittest::ForeignEnumLite value);
+  void add_repeated_foreign_enum(::protobuf_unittest::ForeignEnumLite value);
+  const ::google::protobuf::RepeatedField<int>& repeated_foreign_enum() const;
+  ::google::protobuf::RepeatedField<int>* mutable_repeated_foreign_enum();
+
+  // optional string optional_string = 14;
+  bool has_optional_string() const;
+  void clear_optional_string();
+  static const int kOptionalStringFieldNumber = 14;
+  const ::std::string& optional_string() const;
+  void set_optional_string(const ::std::string& value);
+  #if LANG_CXX11
+  void set_optional_string(::std::string&& value);
+  #endif
+  void set_optional_string(const char* value);
+  void set_optional_string(const char* value, size_t size);
+  ::std::string* mutable_optional_string();
+  ::std::string* release_optional_string();
+  void set_allocated_optional_string(::std::string* optional_string);
+
+  // optional bytes optional_bytes = 15;
+  bool has_optional_bytes() const;
+  void clear_optional_bytes();
+  static const int kOptionalBytesFieldNumber = 15;
+  const ::std::string& optional_bytes() const;
+  void set_optional_bytes(const ::std::string& value);
+  #if LANG_CXX11
+  void set_optional_bytes(::std::string&& value);
+  #endif
+  void set_optional_bytes(const char* value);
+  void set_optional_bytes(const void* value, size_t size);
+  ::std::string* mutable_optional_bytes();
+  ::std::string* release_optional_bytes();
+  void set_allocated_optional_bytes(::std::string* optional_bytes);
+
+  // optional group OptionalGroup = 16 { ... };
+  bool has_optionalgroup() const;
+  void clear_optionalgroup();
+  static const int kOptionalgroupFieldNumber = 16;
+  const ::protobuf_unittest::TestTableDrivenLite_OptionalGroup& optionalgroup() const;
+  ::protobuf_unittest::TestTableDrivenLite_OptionalGroup* mutable_optionalgroup();
+  ::protobuf_unittest::TestTableDrivenLite_OptionalGroup* release_optionalgroup();
+  void set_allocated_optionalgroup(::protobuf_unittest::TestTableDrivenLite_OptionalGroup* optionalgroup);
+
+  // optional .protobuf_unittest.TestTableDrivenLite.NestedMessage optional_nested_message = 18;
+  bool has_optional_nested_message() const;
+  void clear_optional_nested_message();
+  static const int kOptionalNestedMessageFieldNumber = 18;
+  const ::protobuf_unittest::TestTableDrivenLite_NestedMessage& optional_nested_message() const;
+  ::protobuf_unittest::TestTableDrivenLite_NestedMessage* mutable_optional_nested_message();
+  ::protobuf_unittest::TestTableDrivenLite_NestedMessage* release_optional_nested_message();
+  void set_allocated_optional_nested_message(::protobuf_unittest::TestTableDrivenLite_NestedMessage* optional_nested_message);
+
+  // optional .protobuf_unittest.ForeignMessageLite optional_foreign_message = 19;
+  bool has_optional_foreign_message() const;
+  void clear_optional_foreign_message();
+  static const int kOptionalForeignMessageFieldNumber = 19;
+  const ::protobuf_unittest::ForeignMessageLite& optional_foreign_message() const;
+  ::protobuf_unittest::ForeignMessageLite* mutable_optional_foreign_message();
+  ::protobuf_unittest::ForeignMessageLite* release_optional_foreign_message();
+  void set_allocated_optional_foreign_message(::protobuf_unittest::ForeignMessageLite* optional_foreign_message);
+
+  // optional int64 optional_int64 = 2;
+  bool has_optional_int64() const;
+  void clear_optional_int64();
+  static const int kOptionalInt64FieldNumber = 2;
+  ::google::protobuf::int64 optional_int64() const;
+  void set_optional_int64(::google::protobuf::int64 value);
+
+  // optional int32 optional_int32 = 1;
+  bool has_optional_int32() const;
+  void clear_optional_int32();
+  static const int kOptionalInt32FieldNumber = 1;
+  ::google::protobuf::int32 optional_int32() const;
+  void set_optional_int32(::google::protobuf::int32 value);
+
+  // optional uint32 optional_uint32 = 3;
+  bool has_optional_uint32() const;
+  void clear_optional_uint32();
+  static const int kOptionalUint32FieldNumber = 3;
+  ::google::protobuf::uint32 optional_uint32() const;
+  void set_optional_uint32(::google::protobuf::uint32 value);
+
+  // optional uint64 optional_uint64 = 4;
+  bool has_optional_uint64() const;
+  void clear_optional_uint64();
+  static const int kOptionalUint64FieldNumber = 4;
+  ::google::protobuf::uint64 optional_uint64() const;
+  void set_optional_uint64(::google::protobuf::uint64 value);
+
+  // optional sint64 optional_sint64 = 6;
+  bool has_optional_sint64() const;
+  void clear_optional_sint64();
+  static const int kOptionalSint64FieldNumber = 6;
+  ::google::protobuf::int64 optional_sint64() const;
+  void set_optional_sint64(::google::protobuf::int64 value);
+
+  // optional sint32 optional_sint32 = 5;
+  bool has_optional_sint32() const;
+  void clear_optional_sint32();
+  static const int kOptionalSint32FieldNumber = 5;
+  ::google::protobuf::int32 optional_sint32() const;
+  void set_optional_sint32(::google::protobuf::int32 value);
+
+  // optional fixed32 optional_fixed32 = 7;
+  bool has_optional_fixed32() const;
+  void clear_optional_fixed32();
+  static const int kOptionalFixed32FieldNumber = 7;
+  ::google::protobuf::uint32 optional_fixed32() const;
+  void set_optional_fixed32(::google::protobuf::uint32 value);
+
+  // optional fixed64 optional_fixed64 = 8;
+  bool has_optional_fixed64() const;
+  void clear_optional_fixed64();
+  static const int kOptionalFixed64FieldNumber = 8;
+  ::google::protobuf::uint64 optional_fixed64() const;
+  void set_optional_fixed64(::google::protobuf::uint64 value);
+
+  // optional sfixed64 optional_sfixed64 = 10;
+  bool has_optional_sfixed64() const;
+  void clear_optional_sfixed64();
+  static const int kOptionalSfixed64FieldNumber = 10;
+  ::google::protobuf::int64 optional_sfixed64() const;
+  void set_optional_sfixed64(::google::protobuf::int64 value);
+
+  // optional sfixed32 optional_sfixed32 = 9;
+  bool has_optional_sfixed32() const;
+  void clear_optional_sfixed32();
+  static const int kOptionalSfixed32FieldNumber = 9;
+  ::google::protobuf::int32 optional_sfixed32() const;
+  void set_optional_sfixed32(::google::protobuf::int32 value);
+
+  // optional float optional_float = 11;
+  bool has_optional_float() const;
+  void clear_optional_float();
+  static const int kOptionalFloatFieldNumber = 11;
+  float optional_float() const;
+  void set_optional_float(float value);
+
+  // optional double optional_double = 12;
+  bool has_optional_double() const;
+  void clear_optional_double();
+  static const int kOptionalDoubleFieldNumber = 12;
+  double optional_double() const;
+  void set_optional_double(double value);
+
+  // optional bool optional_bool = 13;
+  bool has_optional_bool() const;
+  void clear_optional_bool();
+  static const int kOptionalBoolFieldNumber = 13;
+  bool optional_bool() const;
+  void set_optional_bool(bool value);
+
+  // optional .protobuf_unittest.TestTableDrivenLite.NestedEnum optional_nested_enum = 21;
+  bool has_optional_nested_enum() const;
+  void clear_optional_nested_enum();
+  static const int kOptionalNestedEnumFieldNumber = 21;
+  ::protobuf_unittest::TestTableDrivenLite_NestedEnum optional_nested_enum() const;
+  void set_optional_nested_enum(::protobuf_unittest::TestTableDrivenLite_NestedEnum value);
+
+  // optional .protobuf_unittest.ForeignEnumLite optional_foreign_enum = 22;
+  bool has_optional_foreign_enum() const;
+  void clear_optional_foreign_enum();
+  static const int kOptionalForeignEnumFieldNumber = 22;
+  ::protobuf_unittest::ForeignEnumLite optional_foreign_enum() const;
+  void set_optional_foreign_enum(::protobuf_unittest::ForeignEnumLite value);
+
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TestTableDrivenLite)
+ private:
+  void set_has_optional_int32();
+  void clear_has_optional_int32();
+  void set_has_optional_int64();
+  void clear_has_optional_int64();
+  void set_has_optional_uint32();
+  void clear_has_optional_uint32();
+  void set_has_optional_uint64();
+  void clear_has_optional_uint64();
+  void set_has_optional_sint32();
+  void clear_has_optional_sint32();
+  void set_has_optional_sint64();
+  void clear_has_optional_sint64();
+  void set_has_optional_fixed32();
+  void clear_has_optional_fixed32();
+  void set_has_optional_fixed64();
+  void clear_has_optional_fixed64();
+  void set_has_optional_sfixed32();
+  void clear_has_optional_sfixed32();
+  void set_has_optional_sfixed64();
+  void clear_has_optional_sfixed64();
+  void set_has_optional_float();
+  void clear_has_optional_float();
+  void set_has_optional_double();
+  void clear_has_optional_double();
+  void set_has_optional_bool();
+  void clear_has_optional_bool();
+  void set_has_optional_string();
+  void clear_has_optional_string();
+  void set_has_optional_bytes();
+  void clear_has_optional_bytes();
+  void set_has_optionalgroup();
+  void clear_has_optionalgroup();
+  void set_has_optional_nested_message();
+  void clear_has_optional_nested_message();
+  void set_has_optional_foreign_message();
+  void clear_has_optional_foreign_message();
+  void set_has_optional_nested_enum();
+  void clear_has_optional_nested_enum();
+  void set_has_optional_foreign_enum();
+  void clear_has_optional_foreign_enum();
+
+  ::google::protobuf::internal::InternalMetadataWithArenaLite _internal_metadata_;
+  ::google::protobuf::internal::HasBits<1> _has_bits_;
+  mutable int _cached_size_;
+  ::google::protobuf::RepeatedField< ::google::protobuf::int32 > repeated_int32_;
+  ::google::protobuf::RepeatedField< ::google::protobuf::int64 > repeated_int64_;
+  ::google::protobuf::RepeatedField< ::google::protobuf::uint32 > repeated_uint32_;
+  ::google::protobuf::RepeatedField< ::google::protobuf::uint64 > repeated_uint64_;
+  ::google::protobuf::RepeatedField< ::google::protobuf::int32 > repeated_sint32_;
+  ::google::protobuf::RepeatedField< ::google::protobuf::int64 > repeated_sint64_;
+  ::google::protobuf::RepeatedField< ::google::protobuf::uint32 > repeated_fixed32_;
+  ::google::protobuf::RepeatedField< ::google::protobuf::uint64 > repeated_fixed64_;
+  ::google::protobuf::RepeatedField< ::google::protobuf::int32 > repeated_sfixed32_;
+  ::google::protobuf::RepeatedField< ::google::protobuf::int64 > repeated_sfixed64_;
+  ::google::protobuf::RepeatedField< float > repeated_float_;
+  ::google::protobuf::RepeatedField< double > repeated_double_;
+  ::google::protobuf::RepeatedField< bool > repeated_bool_;
+  ::google::protobuf::RepeatedPtrField< ::std::string> repeated_string_;
+  ::google::protobuf::RepeatedPtrField< ::std::string> repeated_bytes_;
+  ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::TestTableDrivenLite_RepeatedGroup > repeatedgroup_;
+  ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::TestTableDrivenLite_NestedMessage > repeated_nested_message_;
+  ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::ForeignMessageLite > repeated_foreign_message_;
+  ::google::protobuf::RepeatedField<int> repeated_nested_enum_;
+  ::google::protobuf::RepeatedField<int> repeated_foreign_enum_;
+  ::google::protobuf::internal::ArenaStringPtr optional_string_;
+  ::google::protobuf::internal::ArenaStringPtr optional_bytes_;
+  ::protobuf_unittest::TestTableDrivenLite_OptionalGroup* optionalgroup_;
+  ::protobuf_unittest::TestTableDrivenLite_NestedMessage* optional_nested_message_;
+  ::protobuf_unittest::ForeignMessageLite* optional_foreign_message_;
+  ::google::protobuf::int64 optional_int64_;
+  ::google::protobuf::int32 optional_int32_;
+  ::google::protobuf::uint32 optional_uint32_;
+  ::google::protobuf::uint64 optional_uint64_;
+  ::google::protobuf::int64 optional_sint64_;
+  ::google::protobuf::int32 optional_sint32_;
+  ::google::protobuf::uint32 optional_fixed32_;
+  ::google::protobuf::uint64 optional_fixed64_;
+  ::google::protobuf::int64 optional_sfixed64_;
+  ::google::protobuf::int32 optional_sfixed32_;
+  float optional_float_;
+  double optional_double_;
+  bool optional_bool_;
+  int optional_nested_enum_;
+  int optional_foreign_enum_;
+  friend struct protobuf_google_2fprotobuf_2funittest_5ftable_5fdriven_5flite_2eproto::TableStruct;
+};
+// -------------------------------------------------------------------
+
+class TestPackedTableDrivenLite : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:protobuf_unittest.TestPackedTableDrivenLite) */ {
+ public:
+  TestPackedTableDrivenLite();
+  virtual ~TestPackedTableDrivenLite();
+
+  TestPackedTableDrivenLite(const TestPackedTableDrivenLite& from);
+
+  inline TestPackedTableDrivenLite& operator=(const TestPackedTableDrivenLite& from) {
+    CopyFrom(from);
+    return *this;
+  }
+
+  inline const ::std::string& unknown_fields() const {
+    return _internal_metadata_.unknown_fields();
+  }
+
+  inline ::std::string* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields();
+  }
+
+  static const TestPackedTableDrivenLite& default_instance();
+
+  static inline const TestPackedTableDrivenLite* internal_default_instance() {
+    return reinterpret_cast<const TestPackedTableDrivenLite*>(
+               &_TestPackedTableDrivenLite_default_instance_);
+  }
+  static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
+    4;
+
+  void Swap(TestPackedTableDrivenLite* other);
+
+  // implements Message ----------------------------------------------
+
+  inline TestPackedTableDrivenLite* New() const PROTOBUF_FINAL { return New(NULL); }
+
+  TestPackedTableDrivenLite* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
+  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)
+    PROTOBUF_FINAL;
+  void CopyFrom(const TestPackedTableDrivenLite& from);
+  void MergeFrom(const TestPackedTableDrivenLite& from);
+  void Clear() PROTOBUF_FINAL;
+  bool IsInitialized() const PROTOBUF_FINAL;
+
+  size_t ByteSizeLong() const PROTOBUF_FINAL;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
+  void DiscardUnknownFields();
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
+  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(TestPackedTableDrivenLite* other);
+  private:
+  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
+    return NULL;
+  }
+  inline void* MaybeArenaPtr() const {
+    return NULL;
+  }
+  public:
+
+  ::std::string GetTypeName() const PROTOBUF_FINAL;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // repeated int32 packed_int32 = 90 [packed = true];
+  int packed_int32_size() const;
+  void clear_packed_int32();
+  static const int kPackedInt32FieldNumber = 90;
+  ::google::protobuf::int32 packed_int32(int index) const;
+  void set_packed_int32(int index, ::google::protobuf::int32 value);
+  void add_packed_int32(::google::protobuf::int32 value);
+  const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
+      packed_int32() const;
+  ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
+      mutable_packed_int32();
+
+  // repeated int64 packed_int64 = 91 [packed = true];
+  int packed_int64_size() const;
+  void clear_packed_int64();
+  static const int kPackedInt64FieldNumber = 91;
+  ::google::protobuf::int64 packed_int64(int index) const;
+  void set_packed_int64(int index, ::google::protobuf::int64 value);
+  void add_packed_int64(::google::protobuf::int64 value);
+  const ::google::protobuf::RepeatedField< ::google::protobuf::int64 >&
+      packed_int64() const;
+  ::google::protobuf::RepeatedField< ::google::protobuf::int64 >*
+      mutable_packed_int64();
+
+  // repeated uint32 packed_uint32 = 92 [packed = true];
+  int packed_uint32_size() const;
+  void clear_packed_uint32();
+  static const int kPackedUint32FieldNumber = 92;
+  ::google::protobuf::uint32 packed_uint32(int index) const;
+  void set_packed_uint32(int index, ::google::protobuf::uint32 value);
+  void add_packed_uint32(::google::protobuf::uint32 value);
+  const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
+      packed_uint32() const;
+  ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
+      mutable_packed_uint32();
+
+  // repeated uint64 packed_uint64 = 93 [packed = true];
+  int packed_uint64_size() const;
+  void clear_packed_uint64();
+  static const int kPackedUint64FieldNumber = 93;
+  ::google::protobuf::uint64 packed_uint64(int index) const;
+  void set_packed_uint64(int index, ::google::protobuf::uint64 value);
+  void add_packed_uint64(::google::protobuf::uint64 value);
+  const ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >&
+      packed_uint64() const;
+  ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >*
+      mutable_packed_uint64();
+
+  // repeated sint32 packed_sint32 = 94 [packed = true];
+  int packed_sint32_size() const;
+  void clear_packed_sint32();
+  static const int kPackedSint32FieldNumber = 94;
+  ::google::protobuf::int32 packed_sint32(int index) const;
+  void set_packed_sint32(int index, ::google::protobuf::int32 value);
+  void add_packed_sint32(::google::protobuf::int32 value);
+  const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
+      packed_sint32() const;
+  ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
+      mutable_packed_sint32();
+
+  // repeated sint64 packed_sint64 = 95 [packed = true];
+  int packed_sint64_size() const;
+  void clear_packed_sint64();
+  static const int kPackedSint64FieldNumber = 95;
+  ::google::protobuf::int64 packed_sint64(int index) const;
+  void set_packed_sint64(int index, ::google::protobuf::int64 value);
+  void add_packed_sint64(::google::protobuf::int64 value);
+  const ::google::protobuf::RepeatedField< ::google::protobuf::int64 >&
+      packed_sint64() const;
+  ::google::protobuf::RepeatedField< ::google::protobuf::int64 >*
+      mutable_packed_sint64();
+
+  // repeated fixed32 packed_fixed32 = 96 [packed = true];
+  int packed_fixed32_size() const;
+  void clear_packed_fixed32();
+  static const int kPackedFixed32FieldNumber = 96;
+  ::google::protobuf::uint32 packed_fixed32(int index) const;
+  void set_packed_fixed32(int index, ::google::protobuf::uint32 value);
+  void add_packed_fixed32(::google::protobuf::uint32 value);
+  const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
+      packed_fixed32() const;
+  ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
+      mutable_packed_fixed32();
+
+  // repeated fixed64 packed_fixed64 = 97 [packed = true];
+  int packed_fixed64_size() const;
+  void clear_packed_fixed64();
+  static const int kPackedFixed64FieldNumber = 97;
+  ::google::protobuf::uint64 packed_fixed64(int index) const;
+  void set_packed_fixed64(int index, ::google::protobuf::uint64 value);
+  void add_packed_fixed64(::google::protobuf::uint64 value);
+  const ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >&
+      packed_fixed64() const;
+  ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >*
+      mutable_packed_fixed64();
+
+  // repeated sfixed32 packed_sfixed32 = 98 [packed = true];
+  int packed_sfixed32_size() const;
+  void clear_packed_sfixed32();
+  static const int kPackedSfixed32FieldNumber = 98;
+  ::google::protobuf::int32 packed_sfixed32(int index) const;
+  void set_packed_sfixed32(int index, ::google::protobuf::int32 value);
+  void add_packed_sfixed32(::google::protobuf::int32 value);
+  const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
+      packed_sfixed32() const;
+  ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
+      mutable_packed_sfixed32();
+
+  // repeated sfixed64 packed_sfixed64 = 99 [packed = true];
+  int packed_sfixed64_size() const;
+  void clear_packed_sfixed64();
+  static const int kPackedSfixed64FieldNumber = 99;
+  ::google::protobuf::int64 packed_sfixed64(int index) const;
+  void set_packed_sfixed64(int index, ::google::protobuf::int64 value);
+  void add_packed_sfixed64(::google::protobuf::int64 value);
+  const ::google::protobuf::RepeatedField< ::google::protobuf::int64 >&
+      packed_sfixed64() const;
+  ::google::protobuf::RepeatedField< ::google::protobuf::int64 >*
+      mutable_packed_sfixed64();
+
+  // repeated float packed_float = 100 [packed = true];
+  int packed_float_size() const;
+  void clear_packed_float();
+  static const int kPackedFloatFieldNumber = 100;
+  float packed_float(int index) const;
+  void set_packed_float(int index, float value);
+  void add_packed_float(float value);
+  const ::google::protobuf::RepeatedField< float >&
+      packed_float() const;
+  ::google::protobuf::RepeatedField< float >*
+      mutable_packed_float();
+
+  // repeated double packed_double = 101 [packed = true];
+  int packed_double_size() const;
+  void clear_packed_double();
+  static const int kPackedDoubleFieldNumber = 101;
+  double packed_double(int index) const;
+  void set_packed_double(int index, double value);
+  void add_packed_double(double value);
+  const ::google::protobuf::RepeatedField< double >&
+      packed_double() const;
+  ::google::protobuf::RepeatedField< double >*
+      mutable_packed_double();
+
+  // repeated bool packed_bool = 102 [packed = true];
+  int packed_bool_size() const;
+  void clear_packed_bool();
+  static const int kPackedBoolFieldNumber = 102;
+  bool packed_bool(int index) const;
+  void set_packed_bool(int index, bool value);
+  void add_packed_bool(bool value);
+  const ::google::protobuf::RepeatedField< bool >&
+      packed_bool() const;
+  ::google::protobuf::RepeatedField< bool >*
+      mutable_packed_bool();
+
+  // repeated .protobuf_unittest.ForeignEnumLite packed_enum = 103 [packed = true];
+  int packed_enum_size() const;
+  void clear_packed_enum();
+  static const int kPackedEnumFieldNumber = 103;
+  ::protobuf_unittest::ForeignEnumLite packed_enum(int index) const;
+  void set_packed_enum(int index, ::protobuf_unittest::ForeignEnumLite value);
+  void add_packed_enum(::protobuf_unittest::ForeignEnumLite value);
+  const ::google::protobuf::RepeatedField<int>& packed_enum() const;
+  ::google::protobuf::RepeatedField<int>* mutable_packed_enum();
+
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TestPackedTableDrivenLite)
+ private:
+
+  ::google::protobuf::internal::InternalMetadataWithArenaLite _internal_metadata_;
+  ::google::protobuf::internal::HasBits<1> _has_bits_;
+  mutable int _cached_size_;
+  ::google::protobuf::RepeatedField< ::google::protobuf::int32 > packed_int32_;
+  mutable int _packed_int32_cached_byte_size_;
+  ::google::protobuf::RepeatedField< ::google::protobuf::int64 > packed_int64_;
+  mutable int _packed_int64_cached_byte_size_;
+  ::google::protobuf::RepeatedField< ::google::protobuf::uint32 > packed_uint32_;
+  mutable int _packed_uint32_cached_byte_size_;
+  ::google::protobuf::RepeatedField< ::google::protobuf::uint64 > packed_uint64_;
+  mutable int _packed_uint64_cached_byte_size_;
+  ::google::protobuf::RepeatedField< ::google::protobuf::int32 > packed_sint32_;
+  mutable int _packed_sint32_cached_byte_size_;
+  ::google::protobuf::RepeatedField< ::google::protobuf::int64 > packed_sint64_;
+  mutable int _packed_sint64_cached_byte_size_;
+  ::google::protobuf::RepeatedField< ::google::protobuf::uint32 > packed_fixed32_;
+  mutable int _packed_fixed32_cached_byte_size_;
+  ::google::protobuf::RepeatedField< ::google::protobuf::uint64 > packed_fixed64_;
+  mutable int _packed_fixed64_cached_byte_size_;
+  ::google::protobuf::RepeatedField< ::google::protobuf::int32 > packed_sfixed32_;
+  mutable int _packed_sfixed32_cached_byte_size_;
+  ::google::protobuf::RepeatedField< ::google::protobuf::int64 > packed_sfixed64_;
+  mutable int _packed_sfixed64_cached_byte_size_;
+  ::google::protobuf::RepeatedField< float > packed_float_;
+  mutable int _packed_float_cached_byte_size_;
+  ::google::protobuf::RepeatedField< double > packed_double_;
+  mutable int _packed_double_cached_byte_size_;
+  ::google::protobuf::RepeatedField< bool > packed_bool_;
+  mutable int _packed_bool_cached_byte_size_;
+  ::google::protobuf::RepeatedField<int> packed_enum_;
+  mutable int _packed_enum_cached_byte_size_;
+  friend struct protobuf_google_2fprotobuf_2funittest_5ftable_5fdriven_5flite_2eproto::TableStruct;
+};
+// -------------------------------------------------------------------
+
+class TestRepeatedTableDrivenLite : public ::google::protobuf::MessageLite /* @@protoc_insertion_point(class_definition:protobuf_unittest.TestRepeatedTableDrivenLite) */ {
+ public:
+  TestRepeatedTableDrivenLite();
+  virtual ~TestRepeatedTableDrivenLite();
+
+  TestRepeatedTableDrivenLite(const TestRepeatedTableDrivenLite& from);
+
+  inline TestRepeatedTableDrivenLite& operator=(const TestRepeatedTableDrivenLite& from) {
+    CopyFrom(from);
+    return *this;
+  }
+
+  inline const ::std::string& unknown_fields() const {
+    return _internal_metadata_.unknown_fields();
+  }
+
+  inline ::std::string* mutable_unknown_fields() {
+    return _internal_metadata_.mutable_unknown_fields();
+  }
+
+  static const TestRepeatedTableDrivenLite& default_instance();
+
+  static inline const TestRepeatedTableDrivenLite* internal_default_instance() {
+    return reinterpret_cast<const TestRepeatedTableDrivenLite*>(
+               &_TestRepeatedTableDrivenLite_default_instance_);
+  }
+  static PROTOBUF_CONSTEXPR int const kIndexInFileMessages =
+    5;
+
+  void Swap(TestRepeatedTableDrivenLite* other);
+
+  // implements Message ----------------------------------------------
+
+  inline TestRepeatedTableDrivenLite* New() const PROTOBUF_FINAL { return New(NULL); }
+
+  TestRepeatedTableDrivenLite* New(::google::protobuf::Arena* arena) const PROTOBUF_FINAL;
+  void CheckTypeAndMergeFrom(const ::google::protobuf::MessageLite& from)
+    PROTOBUF_FINAL;
+  void CopyFrom(const TestRepeatedTableDrivenLite& from);
+  void MergeFrom(const TestRepeatedTableDrivenLite& from);
+  void Clear() PROTOBUF_FINAL;
+  bool IsInitialized() const PROTOBUF_FINAL;
+
+  size_t ByteSizeLong() const PROTOBUF_FINAL;
+  bool MergePartialFromCodedStream(
+      ::google::protobuf::io::CodedInputStream* input) PROTOBUF_FINAL;
+  void SerializeWithCachedSizes(
+      ::google::protobuf::io::CodedOutputStream* output) const PROTOBUF_FINAL;
+  void DiscardUnknownFields();
+  ::google::protobuf::uint8* InternalSerializeWithCachedSizesToArray(
+      bool deterministic, ::google::protobuf::uint8* target) const PROTOBUF_FINAL;
+  int GetCachedSize() const PROTOBUF_FINAL { return _cached_size_; }
+  private:
+  void SharedCtor();
+  void SharedDtor();
+  void SetCachedSize(int size) const;
+  void InternalSwap(TestRepeatedTableDrivenLite* other);
+  private:
+  inline ::google::protobuf::Arena* GetArenaNoVirtual() const {
+    return NULL;
+  }
+  inline void* MaybeArenaPtr() const {
+    return NULL;
+  }
+  public:
+
+  ::std::string GetTypeName() const PROTOBUF_FINAL;
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  // repeated int32 int32_values = 1;
+  int int32_values_size() const;
+  void clear_int32_values();
+  static const int kInt32ValuesFieldNumber = 1;
+  ::google::protobuf::int32 int32_values(int index) const;
+  void set_int32_values(int index, ::google::protobuf::int32 value);
+  void add_int32_values(::google::protobuf::int32 value);
+  const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
+      int32_values() const;
+  ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
+      mutable_int32_values();
+
+  // repeated int32 packed_int32_values = 2 [packed = true];
+  int packed_int32_values_size() const;
+  void clear_packed_int32_values();
+  static const int kPackedInt32ValuesFieldNumber = 2;
+  ::google::protobuf::int32 packed_int32_values(int index) const;
+  void set_packed_int32_values(int index, ::google::protobuf::int32 value);
+  void add_packed_int32_values(::google::protobuf::int32 value);
+  const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
+      packed_int32_values() const;
+  ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
+      mutable_packed_int32_values();
+
+  // repeated sint64 packed_sint64_values = 3 [packed = true];
+  int packed_sint64_values_size() const;
+  void clear_packed_sint64_values();
+  static const int kPackedSint64ValuesFieldNumber = 3;
+  ::google::protobuf::int64 packed_sint64_values(int index) const;
+  void set_packed_sint64_values(int index, ::google::protobuf::int64 value);
+  void add_packed_sint64_values(::google::protobuf::int64 value);
+  const ::google::protobuf::RepeatedField< ::google::protobuf::int64 >&
+      packed_sint64_values() const;
+  ::google::protobuf::RepeatedField< ::google::protobuf::int64 >*
+      mutable_packed_sint64_values();
+
+  // repeated fixed32 fixed32_values = 4;
+  int fixed32_values_size() const;
+  void clear_fixed32_values();
+  static const int kFixed32ValuesFieldNumber = 4;
+  ::google::protobuf::uint32 fixed32_values(int index) const;
+  void set_fixed32_values(int index, ::google::protobuf::uint32 value);
+  void add_fixed32_values(::google::protobuf::uint32 value);
+  const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
+      fixed32_values() const;
+  ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
+      mutable_fixed32_values();
+
+  // repeated double packed_double_values = 5 [packed = true];
+  int packed_double_values_size() const;
+  void clear_packed_double_values();
+  static const int kPackedDoubleValuesFieldNumber = 5;
+  double packed_double_values(int index) const;
+  void set_packed_double_values(int index, double value);
+  void add_packed_double_values(double value);
+  const ::google::protobuf::RepeatedField< double >&
+      packed_double_values() const;
+  ::google::protobuf::RepeatedField< double >*
+      mutable_packed_double_values();
+
+  // repeated .protobuf_unittest.ForeignEnumLite enum_values = 6;
+  int enum_values_size() const;
+  void clear_enum_values();
+  static const int kEnumValuesFieldNumber = 6;
+  ::protobuf_unittest::ForeignEnumLite enum_values(int index) const;
+  void set_enum_values(int index, ::protobuf_unittest::ForeignEnumLite value);
+  void add_enum_values(::protobuf_unittest::ForeignEnumLite value);
+  const ::google::protobuf::RepeatedField<int>& enum_values() const;
+  ::google::protobuf::RepeatedField<int>* mutable_enum_values();
+
+  // repeated .protobuf_unittest.ForeignEnumLite packed_enum_values = 7 [packed = true];
+  int packed_enum_values_size() const;
+  void clear_packed_enum_values();
+  static const int kPackedEnumValuesFieldNumber = 7;
+  ::protobuf_unittest::ForeignEnumLite packed_enum_values(int index) const;
+  void set_packed_enum_values(int index, ::protobuf_unittest::ForeignEnumLite value);
+  void add_packed_enum_values(::protobuf_unittest::ForeignEnumLite value);
+  const ::google::protobuf::RepeatedField<int>& packed_enum_values() const;
+  ::google::protobuf::RepeatedField<int>* mutable_packed_enum_values();
+
+  // repeated string string_values = 8;
+  int string_values_size() const;
+  void clear_string_values();
+  static const int kStringValuesFieldNumber = 8;
+  const ::std::string& string_values(int index) const;
+  ::std::string* mutable_string_values(int index);
+  void set_string_values(int index, const ::std::string& value);
+  #if LANG_CXX11
+  void set_string_values(int index, ::std::string&& value);
+  #endif
+  void set_string_values(int index, const char* value);
+  void set_string_values(int index, const char* value, size_t size);
+  ::std::string* add_string_values();
+  void add_string_values(const ::std::string& value);
+  #if LANG_CXX11
+  void add_string_values(::std::string&& value);
+  #endif
+  void add_string_values(const char* value);
+  void add_string_values(const char* value, size_t size);
+  const ::google::protobuf::RepeatedPtrField< ::std::string>& string_values() const;
+  ::google::protobuf::RepeatedPtrField< ::std::string>* mutable_string_values();
+
+  // repeated .protobuf_unittest.TestTableDrivenLite.NestedMessage message_values = 9;
+  int message_values_size() const;
+  void clear_message_values();
+  static const int kMessageValuesFieldNumber = 9;
+  const ::protobuf_unittest::TestTableDrivenLite_NestedMessage& message_values(int index) const;
+  ::protobuf_unittest::TestTableDrivenLite_NestedMessage* mutable_message_values(int index);
+  ::protobuf_unittest::TestTableDrivenLite_NestedMessage* add_message_values();
+  ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::TestTableDrivenLite_NestedMessage >*
+      mutable_message_values();
+  const ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::TestTableDrivenLite_NestedMessage >&
+      message_values() const;
+
+  // @@protoc_insertion_point(class_scope:protobuf_unittest.TestRepeatedTableDrivenLite)
+ private:
+
+  ::google::protobuf::internal::InternalMetadataWithArenaLite _internal_metadata_;
+  ::google::protobuf::internal::HasBits<1> _has_bits_;
+  mutable int _cached_size_;
+  ::google::protobuf::RepeatedField< ::google::protobuf::int32 > int32_values_;
+  ::google::protobuf::RepeatedField< ::google::protobuf::int32 > packed_int32_values_;
+  mutable int _packed_int32_values_cached_byte_size_;
+  ::google::protobuf::RepeatedField< ::google::protobuf::int64 > packed_sint64_values_;
+  mutable int _packed_sint64_values_cached_byte_size_;
+  ::google::protobuf::RepeatedField< ::google::protobuf::uint32 > fixed32_values_;
+  ::google::protobuf::RepeatedField< double > packed_double_values_;
+  mutable int _packed_double_values_cached_byte_size_;
+  ::google::protobuf::RepeatedField<int> enum_values_;
+  ::google::protobuf::RepeatedField<int> packed_enum_values_;
+  mutable int _packed_enum_values_cached_byte_size_;
+  ::google::protobuf::RepeatedPtrField< ::std::string> string_values_;
+  ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::TestTableDrivenLite_NestedMessage > message_values_;
+  friend struct protobuf_google_2fprotobuf_2funittest_5ftable_5fdriven_5flite_2eproto::TableStruct;
+};
+// ===================================================================
+
+
+// ===================================================================
+
+#if !PROTOBUF_INLINE_NOT_IN_HEADERS
+// TestTableDrivenLite_NestedMessage
+
+// optional int32 bb = 1;
+inline bool TestTableDrivenLite_NestedMessage::has_bb() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
+}
+inline void TestTableDrivenLite_NestedMessage::set_has_bb() {
+  _has_bits_[0] |= 0x00000002u;
+}
+inline void TestTableDrivenLite_NestedMessage::clear_has_bb() {
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline void TestTableDrivenLite_NestedMessage::clear_bb() {
+  bb_ = 0;
+  clear_has_bb();
+}
+inline ::google::protobuf::int32 TestTableDrivenLite_NestedMessage::bb() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestTableDrivenLite.NestedMessage.bb)
+  return bb_;
+}
+inline void TestTableDrivenLite_NestedMessage::set_bb(::google::protobuf::int32 value) {
+  set_has_bb();
+  bb_ = value;
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestTableDrivenLite.NestedMessage.bb)
+}
+
+// optional int64 cc = 2;
+inline bool TestTableDrivenLite_NestedMessage::has_cc() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void TestTableDrivenLite_NestedMessage::set_has_cc() {
+  _has_bits_[0] |= 0x00000001u;
+}
+inline void TestTableDrivenLite_NestedMessage::clear_has_cc() {
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline void TestTableDrivenLite_NestedMessage::clear_cc() {
+  cc_ = GOOGLE_LONGLONG(0);
+  clear_has_cc();
+}
+inline ::google::protobuf::int64 TestTableDrivenLite_NestedMessage::cc() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestTableDrivenLite.NestedMessage.cc)
+  return cc_;
+}
+inline void TestTableDrivenLite_NestedMessage::set_cc(::google::protobuf::int64 value) {
+  set_has_cc();
+  cc_ = value;
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestTableDrivenLite.NestedMessage.cc)
+}
+
+// -------------------------------------------------------------------
+
+// TestTableDrivenLite_OptionalGroup
+
+// optional int32 a = 17;
+inline bool TestTableDrivenLite_OptionalGroup::has_a() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void TestTableDrivenLite_OptionalGroup::set_has_a() {
+  _has_bits_[0] |= 0x00000001u;
+}
+inline void TestTableDrivenLite_OptionalGroup::clear_has_a() {
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline void TestTableDrivenLite_OptionalGroup::clear_a() {
+  a_ = 0;
+  clear_has_a();
+}
+inline ::google::protobuf::int32 TestTableDrivenLite_OptionalGroup::a() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestTableDrivenLite.OptionalGroup.a)
+  return a_;
+}
+inline void TestTableDrivenLite_OptionalGroup::set_a(::google::protobuf::int32 value) {
+  set_has_a();
+  a_ = value;
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestTableDrivenLite.OptionalGroup.a)
+}
+
+// -------------------------------------------------------------------
+
+// TestTableDrivenLite_RepeatedGroup
+
+// optional int32 a = 47;
+inline bool TestTableDrivenLite_RepeatedGroup::has_a() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void TestTableDrivenLite_RepeatedGroup::set_has_a() {
+  _has_bits_[0] |= 0x00000001u;
+}
+inline void TestTableDrivenLite_RepeatedGroup::clear_has_a() {
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline void TestTableDrivenLite_RepeatedGroup::clear_a() {
+  a_ = 0;
+  clear_has_a();
+}
+inline ::google::protobuf::int32 TestTableDrivenLite_RepeatedGroup::a() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestTableDrivenLite.RepeatedGroup.a)
+  return a_;
+}
+inline void TestTableDrivenLite_RepeatedGroup::set_a(::google::protobuf::int32 value) {
+  set_has_a();
+  a_ = value;
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestTableDrivenLite.RepeatedGroup.a)
+}
+
+// -------------------------------------------------------------------
+
+// TestTableDrivenLite
+
+// optional int32 optional_int32 = 1;
+inline bool TestTableDrivenLite::has_optional_int32() const {
+  return (_has_bits_[0] & 0x00000040u) != 0;
+}
+inline void TestTableDrivenLite::set_has_optional_int32() {
+  _has_bits_[0] |= 0x00000040u;
+}
+inline void TestTableDrivenLite::clear_has_optional_int32() {
+  _has_bits_[0] &= ~0x00000040u;
+}
+inline void TestTableDrivenLite::clear_optional_int32() {
+  optional_int32_ = 0;
+  clear_has_optional_int32();
+}
+inline ::google::protobuf::int32 TestTableDrivenLite::optional_int32() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestTableDrivenLite.optional_int32)
+  return optional_int32_;
+}
+inline void TestTableDrivenLite::set_optional_int32(::google::protobuf::int32 value) {
+  set_has_optional_int32();
+  optional_int32_ = value;
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestTableDrivenLite.optional_int32)
+}
+
+// optional int64 optional_int64 = 2;
+inline bool TestTableDrivenLite::has_optional_int64() const {
+  return (_has_bits_[0] & 0x00000020u) != 0;
+}
+inline void TestTableDrivenLite::set_has_optional_int64() {
+  _has_bits_[0] |= 0x00000020u;
+}
+inline void TestTableDrivenLite::clear_has_optional_int64() {
+  _has_bits_[0] &= ~0x00000020u;
+}
+inline void TestTableDrivenLite::clear_optional_int64() {
+  optional_int64_ = GOOGLE_LONGLONG(0);
+  clear_has_optional_int64();
+}
+inline ::google::protobuf::int64 TestTableDrivenLite::optional_int64() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestTableDrivenLite.optional_int64)
+  return optional_int64_;
+}
+inline void TestTableDrivenLite::set_optional_int64(::google::protobuf::int64 value) {
+  set_has_optional_int64();
+  optional_int64_ = value;
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestTableDrivenLite.optional_int64)
+}
+
+// optional uint32 optional_uint32 = 3;
+inline bool TestTableDrivenLite::has_optional_uint32() const {
+  return (_has_bits_[0] & 0x00000080u) != 0;
+}
+inline void TestTableDrivenLite::set_has_optional_uint32() {
+  _has_bits_[0] |= 0x00000080u;
+}
+inline void TestTableDrivenLite::clear_has_optional_uint32() {
+  _has_bits_[0] &= ~0x00000080u;
+}
+inline void TestTableDrivenLite::clear_optional_uint32() {
+  optional_uint32_ = 0u;
+  clear_has_optional_uint32();
+}
+inline ::google::protobuf::uint32 TestTableDrivenLite::optional_uint32() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestTableDrivenLite.optional_uint32)
+  return optional_uint32_;
+}
+inline void TestTableDrivenLite::set_optional_uint32(::google::protobuf::uint32 value) {
+  set_has_optional_uint32();
+  optional_uint32_ = value;
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestTableDrivenLite.optional_uint32)
+}
+
+// optional uint64 optional_uint64 = 4;
+inline bool TestTableDrivenLite::has_optional_uint64() const {
+  return (_has_bits_[0] & 0x00000100u) != 0;
+}
+inline void TestTableDrivenLite::set_has_optional_uint64() {
+  _has_bits_[0] |= 0x00000100u;
+}
+inline void TestTableDrivenLite::clear_has_optional_uint64() {
+  _has_bits_[0] &= ~0x00000100u;
+}
+inline void TestTableDrivenLite::clear_optional_uint64() {
+  optional_uint64_ = GOOGLE_ULONGLONG(0);
+  clear_has_optional_uint64();
+}
+inline ::google::protobuf::uint64 TestTableDrivenLite::optional_uint64() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestTableDrivenLite.optional_uint64)
+  return optional_uint64_;
+}
+inline void TestTableDrivenLite::set_optional_uint64(::google::protobuf::uint64 value) {
+  set_has_optional_uint64();
+  optional_uint64_ = value;
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestTableDrivenLite.optional_uint64)
+}
+
+// optional sint32 optional_sint32 = 5;
+inline bool TestTableDrivenLite::has_optional_sint32() const {
+  return (_has_bits_[0] & 0x00000400u) != 0;
+}
+inline void TestTableDrivenLite::set_has_optional_sint32() {
+  _has_bits_[0] |= 0x00000400u;
+}
+inline void TestTableDrivenLite::clear_has_optional_sint32() {
+  _has_bits_[0] &= ~0x00000400u;
+}
+inline void TestTableDrivenLite::clear_optional_sint32() {
+  optional_sint32_ = 0;
+  clear_has_optional_sint32();
+}
+inline ::google::protobuf::int32 TestTableDrivenLite::optional_sint32() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestTableDrivenLite.optional_sint32)
+  return optional_sint32_;
+}
+inline void TestTableDrivenLite::set_optional_sint32(::google::protobuf::int32 value) {
+  set_has_optional_sint32();
+  optional_sint32_ = value;
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestTableDrivenLite.optional_sint32)
+}
+
+// optional sint64 optional_sint64 = 6;
+inline bool TestTableDrivenLite::has_optional_sint64() const {
+  return (_has_bits_[0] & 0x00000200u) != 0;
+}
+inline void TestTableDrivenLite::set_has_optional_sint64() {
+  _has_bits_[0] |= 0x00000200u;
+}
+inline void TestTableDrivenLite::clear_has_optional_sint64() {
+  _has_bits_[0] &= ~0x00000200u;
+}
+inline void TestTableDrivenLite::clear_optional_sint64() {
+  optional_sint64_ = GOOGLE_LONGLONG(0);
+  clear_has_optional_sint64();
+}
+inline ::google::protobuf::int64 TestTableDrivenLite::optional_sint64() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestTableDrivenLite.optional_sint64)
+  return optional_sint64_;
+}
+inline void TestTableDrivenLite::set_optional_sint64(::google::protobuf::int64 value) {
+  set_has_optional_sint64();
+  optional_sint64_ = value;
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestTableDrivenLite.optional_sint64)
+}
+
+// optional fixed32 optional_fixed32 = 7;
+inline bool TestTableDrivenLite::has_optional_fixed32() const {
+  return (_has_bits_[0] & 0x00000800u) != 0;
+}
+inline void TestTableDrivenLite::set_has_optional_fixed32() {
+  _has_bits_[0] |= 0x00000800u;
+}
+inline void TestTableDrivenLite::clear_has_optional_fixed32() {
+  _has_bits_[0] &= ~0x00000800u;
+}
+inline void TestTableDrivenLite::clear_optional_fixed32() {
+  optional_fixed32_ = 0u;
+  clear_has_optional_fixed32();
+}
+inline ::google::protobuf::uint32 TestTableDrivenLite::optional_fixed32() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestTableDrivenLite.optional_fixed32)
+  return optional_fixed32_;
+}
+inline void TestTableDrivenLite::set_optional_fixed32(::google::protobuf::uint32 value) {
+  set_has_optional_fixed32();
+  optional_fixed32_ = value;
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestTableDrivenLite.optional_fixed32)
+}
+
+// optional fixed64 optional_fixed64 = 8;
+inline bool TestTableDrivenLite::has_optional_fixed64() const {
+  return (_has_bits_[0] & 0x00001000u) != 0;
+}
+inline void TestTableDrivenLite::set_has_optional_fixed64() {
+  _has_bits_[0] |= 0x00001000u;
+}
+inline void TestTableDrivenLite::clear_has_optional_fixed64() {
+  _has_bits_[0] &= ~0x00001000u;
+}
+inline void TestTableDrivenLite::clear_optional_fixed64() {
+  optional_fixed64_ = GOOGLE_ULONGLONG(0);
+  clear_has_optional_fixed64();
+}
+inline ::google::protobuf::uint64 TestTableDrivenLite::optional_fixed64() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestTableDrivenLite.optional_fixed64)
+  return optional_fixed64_;
+}
+inline void TestTableDrivenLite::set_optional_fixed64(::google::protobuf::uint64 value) {
+  set_has_optional_fixed64();
+  optional_fixed64_ = value;
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestTableDrivenLite.optional_fixed64)
+}
+
+// optional sfixed32 optional_sfixed32 = 9;
+inline bool TestTableDrivenLite::has_optional_sfixed32() const {
+  return (_has_bits_[0] & 0x00004000u) != 0;
+}
+inline void TestTableDrivenLite::set_has_optional_sfixed32() {
+  _has_bits_[0] |= 0x00004000u;
+}
+inline void TestTableDrivenLite::clear_has_optional_sfixed32() {
+  _has_bits_[0] &= ~0x00004000u;
+}
+inline void TestTableDrivenLite::clear_optional_sfixed32() {
+  optional_sfixed32_ = 0;
+  clear_has_optional_sfixed32();
+}
+inline ::google::protobuf::int32 TestTableDrivenLite::optional_sfixed32() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestTableDrivenLite.optional_sfixed32)
+  return optional_sfixed32_;
+}
+inline void TestTableDrivenLite::set_optional_sfixed32(::google::protobuf::int32 value) {
+  set_has_optional_sfixed32();
+  optional_sfixed32_ = value;
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestTableDrivenLite.optional_sfixed32)
+}
+
+// optional sfixed64 optional_sfixed64 = 10;
+inline bool TestTableDrivenLite::has_optional_sfixed64() const {
+  return (_has_bits_[0] & 0x00002000u) != 0;
+}
+inline void TestTableDrivenLite::set_has_optional_sfixed64() {
+  _has_bits_[0] |= 0x00002000u;
+}
+inline void TestTableDrivenLite::clear_has_optional_sfixed64() {
+  _has_bits_[0] &= ~0x00002000u;
+}
+inline void TestTableDrivenLite::clear_optional_sfixed64() {
+  optional_sfixed64_ = GOOGLE_LONGLONG(0);
+  clear_has_optional_sfixed64();
+}
+inline ::google::protobuf::int64 TestTableDrivenLite::optional_sfixed64() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestTableDrivenLite.optional_sfixed64)
+  return optional_sfixed64_;
+}
+inline void TestTableDrivenLite::set_optional_sfixed64(::google::protobuf::int64 value) {
+  set_has_optional_sfixed64();
+  optional_sfixed64_ = value;
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestTableDrivenLite.optional_sfixed64)
+}
+
+// optional float optional_float = 11;
+inline bool TestTableDrivenLite::has_optional_float() const {
+  return (_has_bits_[0] & 0x00008000u) != 0;
+}
+inline void TestTableDrivenLite::set_has_optional_float() {
+  _has_bits_[0] |= 0x00008000u;
+}
+inline void TestTableDrivenLite::clear_has_optional_float() {
+  _has_bits_[0] &= ~0x00008000u;
+}
+inline void TestTableDrivenLite::clear_optional_float() {
+  optional_float_ = 0;
+  clear_has_optional_float();
+}
+inline float TestTableDrivenLite::optional_float() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestTableDrivenLite.optional_float)
+  return optional_float_;
+}
+inline void TestTableDrivenLite::set_optional_float(float value) {
+  set_has_optional_float();
+  optional_float_ = value;
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestTableDrivenLite.optional_float)
+}
+
+// optional double optional_double = 12;
+inline bool TestTableDrivenLite::has_optional_double() const {
+  return (_has_bits_[0] & 0x00010000u) != 0;
+}
+inline void TestTableDrivenLite::set_has_optional_double() {
+  _has_bits_[0] |= 0x00010000u;
+}
+inline void TestTableDrivenLite::clear_has_optional_double() {
+  _has_bits_[0] &= ~0x00010000u;
+}
+inline void TestTableDrivenLite::clear_optional_double() {
+  optional_double_ = 0;
+  clear_has_optional_double();
+}
+inline double TestTableDrivenLite::optional_double() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestTableDrivenLite.optional_double)
+  return optional_double_;
+}
+inline void TestTableDrivenLite::set_optional_double(double value) {
+  set_has_optional_double();
+  optional_double_ = value;
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestTableDrivenLite.optional_double)
+}
+
+// optional bool optional_bool = 13;
+inline bool TestTableDrivenLite::has_optional_bool() const {
+  return (_has_bits_[0] & 0x00020000u) != 0;
+}
+inline void TestTableDrivenLite::set_has_optional_bool() {
+  _has_bits_[0] |= 0x00020000u;
+}
+inline void TestTableDrivenLite::clear_has_optional_bool() {
+  _has_bits_[0] &= ~0x00020000u;
+}
+inline void TestTableDrivenLite::clear_optional_bool() {
+  optional_bool_ = false;
+  clear_has_optional_bool();
+}
+inline bool TestTableDrivenLite::optional_bool() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestTableDrivenLite.optional_bool)
+  return optional_bool_;
+}
+inline void TestTableDrivenLite::set_optional_bool(bool value) {
+  set_has_optional_bool();
+  optional_bool_ = value;
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestTableDrivenLite.optional_bool)
+}
+
+// optional string optional_string = 14;
+inline bool TestTableDrivenLite::has_optional_string() const {
+  return (_has_bits_[0] & 0x00000001u) != 0;
+}
+inline void TestTableDrivenLite::set_has_optional_string() {
+  _has_bits_[0] |= 0x00000001u;
+}
+inline void TestTableDrivenLite::clear_has_optional_string() {
+  _has_bits_[0] &= ~0x00000001u;
+}
+inline void TestTableDrivenLite::clear_optional_string() {
+  optional_string_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  clear_has_optional_string();
+}
+inline const ::std::string& TestTableDrivenLite::optional_string() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestTableDrivenLite.optional_string)
+  return optional_string_.GetNoArena();
+}
+inline void TestTableDrivenLite::set_optional_string(const ::std::string& value) {
+  set_has_optional_string();
+  optional_string_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestTableDrivenLite.optional_string)
+}
+#if LANG_CXX11
+inline void TestTableDrivenLite::set_optional_string(::std::string&& value) {
+  set_has_optional_string();
+  optional_string_.SetNoArena(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:protobuf_unittest.TestTableDrivenLite.optional_string)
+}
+#endif
+inline void TestTableDrivenLite::set_optional_string(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  set_has_optional_string();
+  optional_string_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:protobuf_unittest.TestTableDrivenLite.optional_string)
+}
+inline void TestTableDrivenLite::set_optional_string(const char* value, size_t size) {
+  set_has_optional_string();
+  optional_string_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:protobuf_unittest.TestTableDrivenLite.optional_string)
+}
+inline ::std::string* TestTableDrivenLite::mutable_optional_string() {
+  set_has_optional_string();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestTableDrivenLite.optional_string)
+  return optional_string_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline ::std::string* TestTableDrivenLite::release_optional_string() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestTableDrivenLite.optional_string)
+  clear_has_optional_string();
+  return optional_string_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void TestTableDrivenLite::set_allocated_optional_string(::std::string* optional_string) {
+  if (optional_string != NULL) {
+    set_has_optional_string();
+  } else {
+    clear_has_optional_string();
+  }
+  optional_string_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), optional_string);
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestTableDrivenLite.optional_string)
+}
+
+// optional bytes optional_bytes = 15;
+inline bool TestTableDrivenLite::has_optional_bytes() const {
+  return (_has_bits_[0] & 0x00000002u) != 0;
+}
+inline void TestTableDrivenLite::set_has_optional_bytes() {
+  _has_bits_[0] |= 0x00000002u;
+}
+inline void TestTableDrivenLite::clear_has_optional_bytes() {
+  _has_bits_[0] &= ~0x00000002u;
+}
+inline void TestTableDrivenLite::clear_optional_bytes() {
+  optional_bytes_.ClearToEmptyNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+  clear_has_optional_bytes();
+}
+inline const ::std::string& TestTableDrivenLite::optional_bytes() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestTableDrivenLite.optional_bytes)
+  return optional_bytes_.GetNoArena();
+}
+inline void TestTableDrivenLite::set_optional_bytes(const ::std::string& value) {
+  set_has_optional_bytes();
+  optional_bytes_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestTableDrivenLite.optional_bytes)
+}
+#if LANG_CXX11
+inline void TestTableDrivenLite::set_optional_bytes(::std::string&& value) {
+  set_has_optional_bytes();
+  optional_bytes_.SetNoArena(
+    &::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::move(value));
+  // @@protoc_insertion_point(field_set_rvalue:protobuf_unittest.TestTableDrivenLite.optional_bytes)
+}
+#endif
+inline void TestTableDrivenLite::set_optional_bytes(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  set_has_optional_bytes();
+  optional_bytes_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), ::std::string(value));
+  // @@protoc_insertion_point(field_set_char:protobuf_unittest.TestTableDrivenLite.optional_bytes)
+}
+inline void TestTableDrivenLite::set_optional_bytes(const void* value, size_t size) {
+  set_has_optional_bytes();
+  optional_bytes_.SetNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(),
+      ::std::string(reinterpret_cast<const char*>(value), size));
+  // @@protoc_insertion_point(field_set_pointer:protobuf_unittest.TestTableDrivenLite.optional_bytes)
+}
+inline ::std::string* TestTableDrivenLite::mutable_optional_bytes() {
+  set_has_optional_bytes();
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestTableDrivenLite.optional_bytes)
+  return optional_bytes_.MutableNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline ::std::string* TestTableDrivenLite::release_optional_bytes() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestTableDrivenLite.optional_bytes)
+  clear_has_optional_bytes();
+  return optional_bytes_.ReleaseNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited());
+}
+inline void TestTableDrivenLite::set_allocated_optional_bytes(::std::string* optional_bytes) {
+  if (optional_bytes != NULL) {
+    set_has_optional_bytes();
+  } else {
+    clear_has_optional_bytes();
+  }
+  optional_bytes_.SetAllocatedNoArena(&::google::protobuf::internal::GetEmptyStringAlreadyInited(), optional_bytes);
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestTableDrivenLite.optional_bytes)
+}
+
+// optional group OptionalGroup = 16 { ... };
+inline bool TestTableDrivenLite::has_optionalgroup() const {
+  return (_has_bits_[0] & 0x00000004u) != 0;
+}
+inline void TestTableDrivenLite::set_has_optionalgroup() {
+  _has_bits_[0] |= 0x00000004u;
+}
+inline void TestTableDrivenLite::clear_has_optionalgroup() {
+  _has_bits_[0] &= ~0x00000004u;
+}
+inline void TestTableDrivenLite::clear_optionalgroup() {
+  if (optionalgroup_ != NULL) optionalgroup_->::protobuf_unittest::TestTableDrivenLite_OptionalGroup::Clear();
+  clear_has_optionalgroup();
+}
+inline const ::protobuf_unittest::TestTableDrivenLite_OptionalGroup& TestTableDrivenLite::optionalgroup() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestTableDrivenLite.optionalgroup)
+  return optionalgroup_ != NULL ? *optionalgroup_
+                         : *::protobuf_unittest::TestTableDrivenLite_OptionalGroup::internal_default_instance();
+}
+inline ::protobuf_unittest::TestTableDrivenLite_OptionalGroup* TestTableDrivenLite::mutable_optionalgroup() {
+  set_has_optionalgroup();
+  if (optionalgroup_ == NULL) {
+    optionalgroup_ = new ::protobuf_unittest::TestTableDrivenLite_OptionalGroup;
+  }
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestTableDrivenLite.optionalgroup)
+  return optionalgroup_;
+}
+inline ::protobuf_unittest::TestTableDrivenLite_OptionalGroup* TestTableDrivenLite::release_optionalgroup() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestTableDrivenLite.optionalgroup)
+  clear_has_optionalgroup();
+  ::protobuf_unittest::TestTableDrivenLite_OptionalGroup* temp = optionalgroup_;
+  optionalgroup_ = NULL;
+  return temp;
+}
+inline void TestTableDrivenLite::set_allocated_optionalgroup(::protobuf_unittest::TestTableDrivenLite_OptionalGroup* optionalgroup) {
+  delete optionalgroup_;
+  optionalgroup_ = optionalgroup;
+  if (optionalgroup) {
+    set_has_optionalgroup();
+  } else {
+    clear_has_optionalgroup();
+  }
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestTableDrivenLite.optionalgroup)
+}
+
+// optional .protobuf_unittest.TestTableDrivenLite.NestedMessage optional_nested_message = 18;
+inline bool TestTableDrivenLite::has_optional_nested_message() const {
+  return (_has_bits_[0] & 0x00000008u) != 0;
+}
+inline void TestTableDrivenLite::set_has_optional_nested_message() {
+  _has_bits_[0] |= 0x00000008u;
+}
+inline void TestTableDrivenLite::clear_has_optional_nested_message() {
+  _has_bits_[0] &= ~0x00000008u;
+}
+inline void TestTableDrivenLite::clear_optional_nested_message() {
+  if (optional_nested_message_ != NULL) optional_nested_message_->::protobuf_unittest::TestTableDrivenLite_NestedMessage::Clear();
+  clear_has_optional_nested_message();
+}
+inline const ::protobuf_unittest::TestTableDrivenLite_NestedMessage& TestTableDrivenLite::optional_nested_message() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestTableDrivenLite.optional_nested_message)
+  return optional_nested_message_ != NULL ? *optional_nested_message_
+                         : *::protobuf_unittest::TestTableDrivenLite_NestedMessage::internal_default_instance();
+}
+inline ::protobuf_unittest::TestTableDrivenLite_NestedMessage* TestTableDrivenLite::mutable_optional_nested_message() {
+  set_has_optional_nested_message();
+  if (optional_nested_message_ == NULL) {
+    optional_nested_message_ = new ::protobuf_unittest::TestTableDrivenLite_NestedMessage;
+  }
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestTableDrivenLite.optional_nested_message)
+  return optional_nested_message_;
+}
+inline ::protobuf_unittest::TestTableDrivenLite_NestedMessage* TestTableDrivenLite::release_optional_nested_message() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestTableDrivenLite.optional_nested_message)
+  clear_has_optional_nested_message();
+  ::protobuf_unittest::TestTableDrivenLite_NestedMessage* temp = optional_nested_message_;
+  optional_nested_message_ = NULL;
+  return temp;
+}
+inline void TestTableDrivenLite::set_allocated_optional_nested_message(::protobuf_unittest::TestTableDrivenLite_NestedMessage* optional_nested_message) {
+  delete optional_nested_message_;
+  optional_nested_message_ = optional_nested_message;
+  if (optional_nested_message) {
+    set_has_optional_nested_message();
+  } else {
+    clear_has_optional_nested_message();
+  }
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestTableDrivenLite.optional_nested_message)
+}
+
+// optional .protobuf_unittest.ForeignMessageLite optional_foreign_message = 19;
+inline bool TestTableDrivenLite::has_optional_foreign_message() const {
+  return (_has_bits_[0] & 0x00000010u) != 0;
+}
+inline void TestTableDrivenLite::set_has_optional_foreign_message() {
+  _has_bits_[0] |= 0x00000010u;
+}
+inline void TestTableDrivenLite::clear_has_optional_foreign_message() {
+  _has_bits_[0] &= ~0x00000010u;
+}
+inline void TestTableDrivenLite::clear_optional_foreign_message() {
+  if (optional_foreign_message_ != NULL) optional_foreign_message_->::protobuf_unittest::ForeignMessageLite::Clear();
+  clear_has_optional_foreign_message();
+}
+inline const ::protobuf_unittest::ForeignMessageLite& TestTableDrivenLite::optional_foreign_message() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestTableDrivenLite.optional_foreign_message)
+  return optional_foreign_message_ != NULL ? *optional_foreign_message_
+                         : *::protobuf_unittest::ForeignMessageLite::internal_default_instance();
+}
+inline ::protobuf_unittest::ForeignMessageLite* TestTableDrivenLite::mutable_optional_foreign_message() {
+  set_has_optional_foreign_message();
+  if (optional_foreign_message_ == NULL) {
+    optional_foreign_message_ = new ::protobuf_unittest::ForeignMessageLite;
+  }
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestTableDrivenLite.optional_foreign_message)
+  return optional_foreign_message_;
+}
+inline ::protobuf_unittest::ForeignMessageLite* TestTableDrivenLite::release_optional_foreign_message() {
+  // @@protoc_insertion_point(field_release:protobuf_unittest.TestTableDrivenLite.optional_foreign_message)
+  clear_has_optional_foreign_message();
+  ::protobuf_unittest::ForeignMessageLite* temp = optional_foreign_message_;
+  optional_foreign_message_ = NULL;
+  return temp;
+}
+inline void TestTableDrivenLite::set_allocated_optional_foreign_message(::protobuf_unittest::ForeignMessageLite* optional_foreign_message) {
+  delete optional_foreign_message_;
+  optional_foreign_message_ = optional_foreign_message;
+  if (optional_foreign_message) {
+    set_has_optional_foreign_message();
+  } else {
+    clear_has_optional_foreign_message();
+  }
+  // @@protoc_insertion_point(field_set_allocated:protobuf_unittest.TestTableDrivenLite.optional_foreign_message)
+}
+
+// optional .protobuf_unittest.TestTableDrivenLite.NestedEnum optional_nested_enum = 21;
+inline bool TestTableDrivenLite::has_optional_nested_enum() const {
+  return (_has_bits_[0] & 0x00040000u) != 0;
+}
+inline void TestTableDrivenLite::set_has_optional_nested_enum() {
+  _has_bits_[0] |= 0x00040000u;
+}
+inline void TestTableDrivenLite::clear_has_optional_nested_enum() {
+  _has_bits_[0] &= ~0x00040000u;
+}
+inline void TestTableDrivenLite::clear_optional_nested_enum() {
+  optional_nested_enum_ = 1;
+  clear_has_optional_nested_enum();
+}
+inline ::protobuf_unittest::TestTableDrivenLite_NestedEnum TestTableDrivenLite::optional_nested_enum() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestTableDrivenLite.optional_nested_enum)
+  return static_cast< ::protobuf_unittest::TestTableDrivenLite_NestedEnum >(optional_nested_enum_);
+}
+inline void TestTableDrivenLite::set_optional_nested_enum(::protobuf_unittest::TestTableDrivenLite_NestedEnum value) {
+  assert(::protobuf_unittest::TestTableDrivenLite_NestedEnum_IsValid(value));
+  set_has_optional_nested_enum();
+  optional_nested_enum_ = value;
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestTableDrivenLite.optional_nested_enum)
+}
+
+// optional .protobuf_unittest.ForeignEnumLite optional_foreign_enum = 22;
+inline bool TestTableDrivenLite::has_optional_foreign_enum() const {
+  return (_has_bits_[0] & 0x00080000u) != 0;
+}
+inline void TestTableDrivenLite::set_has_optional_foreign_enum() {
+  _has_bits_[0] |= 0x00080000u;
+}
+inline void TestTableDrivenLite::clear_has_optional_foreign_enum() {
+  _has_bits_[0] &= ~0x00080000u;
+}
+inline void TestTableDrivenLite::clear_optional_foreign_enum() {
+  optional_foreign_enum_ = 4;
+  clear_has_optional_foreign_enum();
+}
+inline ::protobuf_unittest::ForeignEnumLite TestTableDrivenLite::optional_foreign_enum() const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestTableDrivenLite.optional_foreign_enum)
+  return static_cast< ::protobuf_unittest::ForeignEnumLite >(optional_foreign_enum_);
+}
+inline void TestTableDrivenLite::set_optional_foreign_enum(::protobuf_unittest::ForeignEnumLite value) {
+  assert(::protobuf_unittest::ForeignEnumLite_IsValid(value));
+  set_has_optional_foreign_enum();
+  optional_foreign_enum_ = value;
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestTableDrivenLite.optional_foreign_enum)
+}
+
+// repeated int32 repeated_int32 = 31;
+inline int TestTableDrivenLite::repeated_int32_size() const {
+  return repeated_int32_.size();
+}
+inline void TestTableDrivenLite::clear_repeated_int32() {
+  repeated_int32_.Clear();
+}
+inline ::google::protobuf::int32 TestTableDrivenLite::repeated_int32(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestTableDrivenLite.repeated_int32)
+  return repeated_int32_.Get(index);
+}
+inline void TestTableDrivenLite::set_repeated_int32(int index, ::google::protobuf::int32 value) {
+  repeated_int32_.Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestTableDrivenLite.repeated_int32)
+}
+inline void TestTableDrivenLite::add_repeated_int32(::google::protobuf::int32 value) {
+  repeated_int32_.Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestTableDrivenLite.repeated_int32)
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
+TestTableDrivenLite::repeated_int32() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestTableDrivenLite.repeated_int32)
+  return repeated_int32_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
+TestTableDrivenLite::mutable_repeated_int32() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestTableDrivenLite.repeated_int32)
+  return &repeated_int32_;
+}
+
+// repeated int64 repeated_int64 = 32;
+inline int TestTableDrivenLite::repeated_int64_size() const {
+  return repeated_int64_.size();
+}
+inline void TestTableDrivenLite::clear_repeated_int64() {
+  repeated_int64_.Clear();
+}
+inline ::google::protobuf::int64 TestTableDrivenLite::repeated_int64(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestTableDrivenLite.repeated_int64)
+  return repeated_int64_.Get(index);
+}
+inline void TestTableDrivenLite::set_repeated_int64(int index, ::google::protobuf::int64 value) {
+  repeated_int64_.Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestTableDrivenLite.repeated_int64)
+}
+inline void TestTableDrivenLite::add_repeated_int64(::google::protobuf::int64 value) {
+  repeated_int64_.Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestTableDrivenLite.repeated_int64)
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::int64 >&
+TestTableDrivenLite::repeated_int64() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestTableDrivenLite.repeated_int64)
+  return repeated_int64_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::int64 >*
+TestTableDrivenLite::mutable_repeated_int64() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestTableDrivenLite.repeated_int64)
+  return &repeated_int64_;
+}
+
+// repeated uint32 repeated_uint32 = 33;
+inline int TestTableDrivenLite::repeated_uint32_size() const {
+  return repeated_uint32_.size();
+}
+inline void TestTableDrivenLite::clear_repeated_uint32() {
+  repeated_uint32_.Clear();
+}
+inline ::google::protobuf::uint32 TestTableDrivenLite::repeated_uint32(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestTableDrivenLite.repeated_uint32)
+  return repeated_uint32_.Get(index);
+}
+inline void TestTableDrivenLite::set_repeated_uint32(int index, ::google::protobuf::uint32 value) {
+  repeated_uint32_.Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestTableDrivenLite.repeated_uint32)
+}
+inline void TestTableDrivenLite::add_repeated_uint32(::google::protobuf::uint32 value) {
+  repeated_uint32_.Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestTableDrivenLite.repeated_uint32)
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
+TestTableDrivenLite::repeated_uint32() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestTableDrivenLite.repeated_uint32)
+  return repeated_uint32_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
+TestTableDrivenLite::mutable_repeated_uint32() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestTableDrivenLite.repeated_uint32)
+  return &repeated_uint32_;
+}
+
+// repeated uint64 repeated_uint64 = 34;
+inline int TestTableDrivenLite::repeated_uint64_size() const {
+  return repeated_uint64_.size();
+}
+inline void TestTableDrivenLite::clear_repeated_uint64() {
+  repeated_uint64_.Clear();
+}
+inline ::google::protobuf::uint64 TestTableDrivenLite::repeated_uint64(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestTableDrivenLite.repeated_uint64)
+  return repeated_uint64_.Get(index);
+}
+inline void TestTableDrivenLite::set_repeated_uint64(int index, ::google::protobuf::uint64 value) {
+  repeated_uint64_.Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestTableDrivenLite.repeated_uint64)
+}
+inline void TestTableDrivenLite::add_repeated_uint64(::google::protobuf::uint64 value) {
+  repeated_uint64_.Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestTableDrivenLite.repeated_uint64)
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >&
+TestTableDrivenLite::repeated_uint64() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestTableDrivenLite.repeated_uint64)
+  return repeated_uint64_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >*
+TestTableDrivenLite::mutable_repeated_uint64() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestTableDrivenLite.repeated_uint64)
+  return &repeated_uint64_;
+}
+
+// repeated sint32 repeated_sint32 = 35;
+inline int TestTableDrivenLite::repeated_sint32_size() const {
+  return repeated_sint32_.size();
+}
+inline void TestTableDrivenLite::clear_repeated_sint32() {
+  repeated_sint32_.Clear();
+}
+inline ::google::protobuf::int32 TestTableDrivenLite::repeated_sint32(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestTableDrivenLite.repeated_sint32)
+  return repeated_sint32_.Get(index);
+}
+inline void TestTableDrivenLite::set_repeated_sint32(int index, ::google::protobuf::int32 value) {
+  repeated_sint32_.Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestTableDrivenLite.repeated_sint32)
+}
+inline void TestTableDrivenLite::add_repeated_sint32(::google::protobuf::int32 value) {
+  repeated_sint32_.Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestTableDrivenLite.repeated_sint32)
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
+TestTableDrivenLite::repeated_sint32() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestTableDrivenLite.repeated_sint32)
+  return repeated_sint32_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
+TestTableDrivenLite::mutable_repeated_sint32() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestTableDrivenLite.repeated_sint32)
+  return &repeated_sint32_;
+}
+
+// repeated sint64 repeated_sint64 = 36;
+inline int TestTableDrivenLite::repeated_sint64_size() const {
+  return repeated_sint64_.size();
+}
+inline void TestTableDrivenLite::clear_repeated_sint64() {
+  repeated_sint64_.Clear();
+}
+inline ::google::protobuf::int64 TestTableDrivenLite::repeated_sint64(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestTableDrivenLite.repeated_sint64)
+  return repeated_sint64_.Get(index);
+}
+inline void TestTableDrivenLite::set_repeated_sint64(int index, ::google::protobuf::int64 value) {
+  repeated_sint64_.Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestTableDrivenLite.repeated_sint64)
+}
+inline void TestTableDrivenLite::add_repeated_sint64(::google::protobuf::int64 value) {
+  repeated_sint64_.Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestTableDrivenLite.repeated_sint64)
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::int64 >&
+TestTableDrivenLite::repeated_sint64() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestTableDrivenLite.repeated_sint64)
+  return repeated_sint64_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::int64 >*
+TestTableDrivenLite::mutable_repeated_sint64() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestTableDrivenLite.repeated_sint64)
+  return &repeated_sint64_;
+}
+
+// repeated fixed32 repeated_fixed32 = 37;
+inline int TestTableDrivenLite::repeated_fixed32_size() const {
+  return repeated_fixed32_.size();
+}
+inline void TestTableDrivenLite::clear_repeated_fixed32() {
+  repeated_fixed32_.Clear();
+}
+inline ::google::protobuf::uint32 TestTableDrivenLite::repeated_fixed32(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestTableDrivenLite.repeated_fixed32)
+  return repeated_fixed32_.Get(index);
+}
+inline void TestTableDrivenLite::set_repeated_fixed32(int index, ::google::protobuf::uint32 value) {
+  repeated_fixed32_.Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestTableDrivenLite.repeated_fixed32)
+}
+inline void TestTableDrivenLite::add_repeated_fixed32(::google::protobuf::uint32 value) {
+  repeated_fixed32_.Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestTableDrivenLite.repeated_fixed32)
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
+TestTableDrivenLite::repeated_fixed32() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestTableDrivenLite.repeated_fixed32)
+  return repeated_fixed32_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
+TestTableDrivenLite::mutable_repeated_fixed32() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestTableDrivenLite.repeated_fixed32)
+  return &repeated_fixed32_;
+}
+
+// repeated fixed64 repeated_fixed64 = 38;
+inline int TestTableDrivenLite::repeated_fixed64_size() const {
+  return repeated_fixed64_.size();
+}
+inline void TestTableDrivenLite::clear_repeated_fixed64() {
+  repeated_fixed64_.Clear();
+}
+inline ::google::protobuf::uint64 TestTableDrivenLite::repeated_fixed64(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestTableDrivenLite.repeated_fixed64)
+  return repeated_fixed64_.Get(index);
+}
+inline void TestTableDrivenLite::set_repeated_fixed64(int index, ::google::protobuf::uint64 value) {
+  repeated_fixed64_.Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestTableDrivenLite.repeated_fixed64)
+}
+inline void TestTableDrivenLite::add_repeated_fixed64(::google::protobuf::uint64 value) {
+  repeated_fixed64_.Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestTableDrivenLite.repeated_fixed64)
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >&
+TestTableDrivenLite::repeated_fixed64() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestTableDrivenLite.repeated_fixed64)
+  return repeated_fixed64_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >*
+TestTableDrivenLite::mutable_repeated_fixed64() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestTableDrivenLite.repeated_fixed64)
+  return &repeated_fixed64_;
+}
+
+// repeated sfixed32 repeated_sfixed32 = 39;
+inline int TestTableDrivenLite::repeated_sfixed32_size() const {
+  return repeated_sfixed32_.size();
+}
+inline void TestTableDrivenLite::clear_repeated_sfixed32() {
+  repeated_sfixed32_.Clear();
+}
+inline ::google::protobuf::int32 TestTableDrivenLite::repeated_sfixed32(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestTableDrivenLite.repeated_sfixed32)
+  return repeated_sfixed32_.Get(index);
+}
+inline void TestTableDrivenLite::set_repeated_sfixed32(int index, ::google::protobuf::int32 value) {
+  repeated_sfixed32_.Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestTableDrivenLite.repeated_sfixed32)
+}
+inline void TestTableDrivenLite::add_repeated_sfixed32(::google::protobuf::int32 value) {
+  repeated_sfixed32_.Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestTableDrivenLite.repeated_sfixed32)
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
+TestTableDrivenLite::repeated_sfixed32() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestTableDrivenLite.repeated_sfixed32)
+  return repeated_sfixed32_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
+TestTableDrivenLite::mutable_repeated_sfixed32() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestTableDrivenLite.repeated_sfixed32)
+  return &repeated_sfixed32_;
+}
+
+// repeated sfixed64 repeated_sfixed64 = 40;
+inline int TestTableDrivenLite::repeated_sfixed64_size() const {
+  return repeated_sfixed64_.size();
+}
+inline void TestTableDrivenLite::clear_repeated_sfixed64() {
+  repeated_sfixed64_.Clear();
+}
+inline ::google::protobuf::int64 TestTableDrivenLite::repeated_sfixed64(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestTableDrivenLite.repeated_sfixed64)
+  return repeated_sfixed64_.Get(index);
+}
+inline void TestTableDrivenLite::set_repeated_sfixed64(int index, ::google::protobuf::int64 value) {
+  repeated_sfixed64_.Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestTableDrivenLite.repeated_sfixed64)
+}
+inline void TestTableDrivenLite::add_repeated_sfixed64(::google::protobuf::int64 value) {
+  repeated_sfixed64_.Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestTableDrivenLite.repeated_sfixed64)
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::int64 >&
+TestTableDrivenLite::repeated_sfixed64() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestTableDrivenLite.repeated_sfixed64)
+  return repeated_sfixed64_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::int64 >*
+TestTableDrivenLite::mutable_repeated_sfixed64() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestTableDrivenLite.repeated_sfixed64)
+  return &repeated_sfixed64_;
+}
+
+// repeated float repeated_float = 41;
+inline int TestTableDrivenLite::repeated_float_size() const {
+  return repeated_float_.size();
+}
+inline void TestTableDrivenLite::clear_repeated_float() {
+  repeated_float_.Clear();
+}
+inline float TestTableDrivenLite::repeated_float(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestTableDrivenLite.repeated_float)
+  return repeated_float_.Get(index);
+}
+inline void TestTableDrivenLite::set_repeated_float(int index, float value) {
+  repeated_float_.Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestTableDrivenLite.repeated_float)
+}
+inline void TestTableDrivenLite::add_repeated_float(float value) {
+  repeated_float_.Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestTableDrivenLite.repeated_float)
+}
+inline const ::google::protobuf::RepeatedField< float >&
+TestTableDrivenLite::repeated_float() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestTableDrivenLite.repeated_float)
+  return repeated_float_;
+}
+inline ::google::protobuf::RepeatedField< float >*
+TestTableDrivenLite::mutable_repeated_float() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestTableDrivenLite.repeated_float)
+  return &repeated_float_;
+}
+
+// repeated double repeated_double = 42;
+inline int TestTableDrivenLite::repeated_double_size() const {
+  return repeated_double_.size();
+}
+inline void TestTableDrivenLite::clear_repeated_double() {
+  repeated_double_.Clear();
+}
+inline double TestTableDrivenLite::repeated_double(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestTableDrivenLite.repeated_double)
+  return repeated_double_.Get(index);
+}
+inline void TestTableDrivenLite::set_repeated_double(int index, double value) {
+  repeated_double_.Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestTableDrivenLite.repeated_double)
+}
+inline void TestTableDrivenLite::add_repeated_double(double value) {
+  repeated_double_.Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestTableDrivenLite.repeated_double)
+}
+inline const ::google::protobuf::RepeatedField< double >&
+TestTableDrivenLite::repeated_double() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestTableDrivenLite.repeated_double)
+  return repeated_double_;
+}
+inline ::google::protobuf::RepeatedField< double >*
+TestTableDrivenLite::mutable_repeated_double() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestTableDrivenLite.repeated_double)
+  return &repeated_double_;
+}
+
+// repeated bool repeated_bool = 43;
+inline int TestTableDrivenLite::repeated_bool_size() const {
+  return repeated_bool_.size();
+}
+inline void TestTableDrivenLite::clear_repeated_bool() {
+  repeated_bool_.Clear();
+}
+inline bool TestTableDrivenLite::repeated_bool(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestTableDrivenLite.repeated_bool)
+  return repeated_bool_.Get(index);
+}
+inline void TestTableDrivenLite::set_repeated_bool(int index, bool value) {
+  repeated_bool_.Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestTableDrivenLite.repeated_bool)
+}
+inline void TestTableDrivenLite::add_repeated_bool(bool value) {
+  repeated_bool_.Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestTableDrivenLite.repeated_bool)
+}
+inline const ::google::protobuf::RepeatedField< bool >&
+TestTableDrivenLite::repeated_bool() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestTableDrivenLite.repeated_bool)
+  return repeated_bool_;
+}
+inline ::google::protobuf::RepeatedField< bool >*
+TestTableDrivenLite::mutable_repeated_bool() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestTableDrivenLite.repeated_bool)
+  return &repeated_bool_;
+}
+
+// repeated string repeated_string = 44;
+inline int TestTableDrivenLite::repeated_string_size() const {
+  return repeated_string_.size();
+}
+inline void TestTableDrivenLite::clear_repeated_string() {
+  repeated_string_.Clear();
+}
+inline const ::std::string& TestTableDrivenLite::repeated_string(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestTableDrivenLite.repeated_string)
+  return repeated_string_.Get(index);
+}
+inline ::std::string* TestTableDrivenLite::mutable_repeated_string(int index) {
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestTableDrivenLite.repeated_string)
+  return repeated_string_.Mutable(index);
+}
+inline void TestTableDrivenLite::set_repeated_string(int index, const ::std::string& value) {
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestTableDrivenLite.repeated_string)
+  repeated_string_.Mutable(index)->assign(value);
+}
+#if LANG_CXX11
+inline void TestTableDrivenLite::set_repeated_string(int index, ::std::string&& value) {
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestTableDrivenLite.repeated_string)
+  repeated_string_.Mutable(index)->assign(std::move(value));
+}
+#endif
+inline void TestTableDrivenLite::set_repeated_string(int index, const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  repeated_string_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:protobuf_unittest.TestTableDrivenLite.repeated_string)
+}
+inline void TestTableDrivenLite::set_repeated_string(int index, const char* value, size_t size) {
+  repeated_string_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:protobuf_unittest.TestTableDrivenLite.repeated_string)
+}
+inline ::std::string* TestTableDrivenLite::add_repeated_string() {
+  // @@protoc_insertion_point(field_add_mutable:protobuf_unittest.TestTableDrivenLite.repeated_string)
+  return repeated_string_.Add();
+}
+inline void TestTableDrivenLite::add_repeated_string(const ::std::string& value) {
+  repeated_string_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestTableDrivenLite.repeated_string)
+}
+#if LANG_CXX11
+inline void TestTableDrivenLite::add_repeated_string(::std::string&& value) {
+  repeated_string_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestTableDrivenLite.repeated_string)
+}
+#endif
+inline void TestTableDrivenLite::add_repeated_string(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  repeated_string_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:protobuf_unittest.TestTableDrivenLite.repeated_string)
+}
+inline void TestTableDrivenLite::add_repeated_string(const char* value, size_t size) {
+  repeated_string_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:protobuf_unittest.TestTableDrivenLite.repeated_string)
+}
+inline const ::google::protobuf::RepeatedPtrField< ::std::string>&
+TestTableDrivenLite::repeated_string() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestTableDrivenLite.repeated_string)
+  return repeated_string_;
+}
+inline ::google::protobuf::RepeatedPtrField< ::std::string>*
+TestTableDrivenLite::mutable_repeated_string() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestTableDrivenLite.repeated_string)
+  return &repeated_string_;
+}
+
+// repeated bytes repeated_bytes = 45;
+inline int TestTableDrivenLite::repeated_bytes_size() const {
+  return repeated_bytes_.size();
+}
+inline void TestTableDrivenLite::clear_repeated_bytes() {
+  repeated_bytes_.Clear();
+}
+inline const ::std::string& TestTableDrivenLite::repeated_bytes(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestTableDrivenLite.repeated_bytes)
+  return repeated_bytes_.Get(index);
+}
+inline ::std::string* TestTableDrivenLite::mutable_repeated_bytes(int index) {
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestTableDrivenLite.repeated_bytes)
+  return repeated_bytes_.Mutable(index);
+}
+inline void TestTableDrivenLite::set_repeated_bytes(int index, const ::std::string& value) {
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestTableDrivenLite.repeated_bytes)
+  repeated_bytes_.Mutable(index)->assign(value);
+}
+#if LANG_CXX11
+inline void TestTableDrivenLite::set_repeated_bytes(int index, ::std::string&& value) {
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestTableDrivenLite.repeated_bytes)
+  repeated_bytes_.Mutable(index)->assign(std::move(value));
+}
+#endif
+inline void TestTableDrivenLite::set_repeated_bytes(int index, const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  repeated_bytes_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:protobuf_unittest.TestTableDrivenLite.repeated_bytes)
+}
+inline void TestTableDrivenLite::set_repeated_bytes(int index, const void* value, size_t size) {
+  repeated_bytes_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:protobuf_unittest.TestTableDrivenLite.repeated_bytes)
+}
+inline ::std::string* TestTableDrivenLite::add_repeated_bytes() {
+  // @@protoc_insertion_point(field_add_mutable:protobuf_unittest.TestTableDrivenLite.repeated_bytes)
+  return repeated_bytes_.Add();
+}
+inline void TestTableDrivenLite::add_repeated_bytes(const ::std::string& value) {
+  repeated_bytes_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestTableDrivenLite.repeated_bytes)
+}
+#if LANG_CXX11
+inline void TestTableDrivenLite::add_repeated_bytes(::std::string&& value) {
+  repeated_bytes_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestTableDrivenLite.repeated_bytes)
+}
+#endif
+inline void TestTableDrivenLite::add_repeated_bytes(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  repeated_bytes_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:protobuf_unittest.TestTableDrivenLite.repeated_bytes)
+}
+inline void TestTableDrivenLite::add_repeated_bytes(const void* value, size_t size) {
+  repeated_bytes_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:protobuf_unittest.TestTableDrivenLite.repeated_bytes)
+}
+inline const ::google::protobuf::RepeatedPtrField< ::std::string>&
+TestTableDrivenLite::repeated_bytes() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestTableDrivenLite.repeated_bytes)
+  return repeated_bytes_;
+}
+inline ::google::protobuf::RepeatedPtrField< ::std::string>*
+TestTableDrivenLite::mutable_repeated_bytes() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestTableDrivenLite.repeated_bytes)
+  return &repeated_bytes_;
+}
+
+// repeated group RepeatedGroup = 46 { ... };
+inline int TestTableDrivenLite::repeatedgroup_size() const {
+  return repeatedgroup_.size();
+}
+inline void TestTableDrivenLite::clear_repeatedgroup() {
+  repeatedgroup_.Clear();
+}
+inline const ::protobuf_unittest::TestTableDrivenLite_RepeatedGroup& TestTableDrivenLite::repeatedgroup(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestTableDrivenLite.repeatedgroup)
+  return repeatedgroup_.Get(index);
+}
+inline ::protobuf_unittest::TestTableDrivenLite_RepeatedGroup* TestTableDrivenLite::mutable_repeatedgroup(int index) {
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestTableDrivenLite.repeatedgroup)
+  return repeatedgroup_.Mutable(index);
+}
+inline ::protobuf_unittest::TestTableDrivenLite_RepeatedGroup* TestTableDrivenLite::add_repeatedgroup() {
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestTableDrivenLite.repeatedgroup)
+  return repeatedgroup_.Add();
+}
+inline ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::TestTableDrivenLite_RepeatedGroup >*
+TestTableDrivenLite::mutable_repeatedgroup() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestTableDrivenLite.repeatedgroup)
+  return &repeatedgroup_;
+}
+inline const ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::TestTableDrivenLite_RepeatedGroup >&
+TestTableDrivenLite::repeatedgroup() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestTableDrivenLite.repeatedgroup)
+  return repeatedgroup_;
+}
+
+// repeated .protobuf_unittest.TestTableDrivenLite.NestedMessage repeated_nested_message = 48;
+inline int TestTableDrivenLite::repeated_nested_message_size() const {
+  return repeated_nested_message_.size();
+}
+inline void TestTableDrivenLite::clear_repeated_nested_message() {
+  repeated_nested_message_.Clear();
+}
+inline const ::protobuf_unittest::TestTableDrivenLite_NestedMessage& TestTableDrivenLite::repeated_nested_message(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestTableDrivenLite.repeated_nested_message)
+  return repeated_nested_message_.Get(index);
+}
+inline ::protobuf_unittest::TestTableDrivenLite_NestedMessage* TestTableDrivenLite::mutable_repeated_nested_message(int index) {
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestTableDrivenLite.repeated_nested_message)
+  return repeated_nested_message_.Mutable(index);
+}
+inline ::protobuf_unittest::TestTableDrivenLite_NestedMessage* TestTableDrivenLite::add_repeated_nested_message() {
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestTableDrivenLite.repeated_nested_message)
+  return repeated_nested_message_.Add();
+}
+inline ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::TestTableDrivenLite_NestedMessage >*
+TestTableDrivenLite::mutable_repeated_nested_message() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestTableDrivenLite.repeated_nested_message)
+  return &repeated_nested_message_;
+}
+inline const ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::TestTableDrivenLite_NestedMessage >&
+TestTableDrivenLite::repeated_nested_message() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestTableDrivenLite.repeated_nested_message)
+  return repeated_nested_message_;
+}
+
+// repeated .protobuf_unittest.ForeignMessageLite repeated_foreign_message = 49;
+inline int TestTableDrivenLite::repeated_foreign_message_size() const {
+  return repeated_foreign_message_.size();
+}
+inline void TestTableDrivenLite::clear_repeated_foreign_message() {
+  repeated_foreign_message_.Clear();
+}
+inline const ::protobuf_unittest::ForeignMessageLite& TestTableDrivenLite::repeated_foreign_message(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestTableDrivenLite.repeated_foreign_message)
+  return repeated_foreign_message_.Get(index);
+}
+inline ::protobuf_unittest::ForeignMessageLite* TestTableDrivenLite::mutable_repeated_foreign_message(int index) {
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestTableDrivenLite.repeated_foreign_message)
+  return repeated_foreign_message_.Mutable(index);
+}
+inline ::protobuf_unittest::ForeignMessageLite* TestTableDrivenLite::add_repeated_foreign_message() {
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestTableDrivenLite.repeated_foreign_message)
+  return repeated_foreign_message_.Add();
+}
+inline ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::ForeignMessageLite >*
+TestTableDrivenLite::mutable_repeated_foreign_message() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestTableDrivenLite.repeated_foreign_message)
+  return &repeated_foreign_message_;
+}
+inline const ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::ForeignMessageLite >&
+TestTableDrivenLite::repeated_foreign_message() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestTableDrivenLite.repeated_foreign_message)
+  return repeated_foreign_message_;
+}
+
+// repeated .protobuf_unittest.TestTableDrivenLite.NestedEnum repeated_nested_enum = 51;
+inline int TestTableDrivenLite::repeated_nested_enum_size() const {
+  return repeated_nested_enum_.size();
+}
+inline void TestTableDrivenLite::clear_repeated_nested_enum() {
+  repeated_nested_enum_.Clear();
+}
+inline ::protobuf_unittest::TestTableDrivenLite_NestedEnum TestTableDrivenLite::repeated_nested_enum(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestTableDrivenLite.repeated_nested_enum)
+  return static_cast< ::protobuf_unittest::TestTableDrivenLite_NestedEnum >(repeated_nested_enum_.Get(index));
+}
+inline void TestTableDrivenLite::set_repeated_nested_enum(int index, ::protobuf_unittest::TestTableDrivenLite_NestedEnum value) {
+  assert(::protobuf_unittest::TestTableDrivenLite_NestedEnum_IsValid(value));
+  repeated_nested_enum_.Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestTableDrivenLite.repeated_nested_enum)
+}
+inline void TestTableDrivenLite::add_repeated_nested_enum(::protobuf_unittest::TestTableDrivenLite_NestedEnum value) {
+  assert(::protobuf_unittest::TestTableDrivenLite_NestedEnum_IsValid(value));
+  repeated_nested_enum_.Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestTableDrivenLite.repeated_nested_enum)
+}
+inline const ::google::protobuf::RepeatedField<int>&
+TestTableDrivenLite::repeated_nested_enum() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestTableDrivenLite.repeated_nested_enum)
+  return repeated_nested_enum_;
+}
+inline ::google::protobuf::RepeatedField<int>*
+TestTableDrivenLite::mutable_repeated_nested_enum() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestTableDrivenLite.repeated_nested_enum)
+  return &repeated_nested_enum_;
+}
+
+// repeated .protobuf_unittest.ForeignEnumLite repeated_foreign_enum = 52;
+inline int TestTableDrivenLite::repeated_foreign_enum_size() const {
+  return repeated_foreign_enum_.size();
+}
+inline void TestTableDrivenLite::clear_repeated_foreign_enum() {
+  repeated_foreign_enum_.Clear();
+}
+inline ::protobuf_unittest::ForeignEnumLite TestTableDrivenLite::repeated_foreign_enum(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestTableDrivenLite.repeated_foreign_enum)
+  return static_cast< ::protobuf_unittest::ForeignEnumLite >(repeated_foreign_enum_.Get(index));
+}
+inline void TestTableDrivenLite::set_repeated_foreign_enum(int index, ::protobuf_unittest::ForeignEnumLite value) {
+  assert(::protobuf_unittest::ForeignEnumLite_IsValid(value));
+  repeated_foreign_enum_.Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestTableDrivenLite.repeated_foreign_enum)
+}
+inline void TestTableDrivenLite::add_repeated_foreign_enum(::protobuf_unittest::ForeignEnumLite value) {
+  assert(::protobuf_unittest::ForeignEnumLite_IsValid(value));
+  repeated_foreign_enum_.Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestTableDrivenLite.repeated_foreign_enum)
+}
+inline const ::google::protobuf::RepeatedField<int>&
+TestTableDrivenLite::repeated_foreign_enum() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestTableDrivenLite.repeated_foreign_enum)
+  return repeated_foreign_enum_;
+}
+inline ::google::protobuf::RepeatedField<int>*
+TestTableDrivenLite::mutable_repeated_foreign_enum() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestTableDrivenLite.repeated_foreign_enum)
+  return &repeated_foreign_enum_;
+}
+
+// -------------------------------------------------------------------
+
+// TestPackedTableDrivenLite
+
+// repeated int32 packed_int32 = 90 [packed = true];
+inline int TestPackedTableDrivenLite::packed_int32_size() const {
+  return packed_int32_.size();
+}
+inline void TestPackedTableDrivenLite::clear_packed_int32() {
+  packed_int32_.Clear();
+}
+inline ::google::protobuf::int32 TestPackedTableDrivenLite::packed_int32(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestPackedTableDrivenLite.packed_int32)
+  return packed_int32_.Get(index);
+}
+inline void TestPackedTableDrivenLite::set_packed_int32(int index, ::google::protobuf::int32 value) {
+  packed_int32_.Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestPackedTableDrivenLite.packed_int32)
+}
+inline void TestPackedTableDrivenLite::add_packed_int32(::google::protobuf::int32 value) {
+  packed_int32_.Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestPackedTableDrivenLite.packed_int32)
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
+TestPackedTableDrivenLite::packed_int32() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestPackedTableDrivenLite.packed_int32)
+  return packed_int32_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
+TestPackedTableDrivenLite::mutable_packed_int32() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestPackedTableDrivenLite.packed_int32)
+  return &packed_int32_;
+}
+
+// repeated int64 packed_int64 = 91 [packed = true];
+inline int TestPackedTableDrivenLite::packed_int64_size() const {
+  return packed_int64_.size();
+}
+inline void TestPackedTableDrivenLite::clear_packed_int64() {
+  packed_int64_.Clear();
+}
+inline ::google::protobuf::int64 TestPackedTableDrivenLite::packed_int64(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestPackedTableDrivenLite.packed_int64)
+  return packed_int64_.Get(index);
+}
+inline void TestPackedTableDrivenLite::set_packed_int64(int index, ::google::protobuf::int64 value) {
+  packed_int64_.Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestPackedTableDrivenLite.packed_int64)
+}
+inline void TestPackedTableDrivenLite::add_packed_int64(::google::protobuf::int64 value) {
+  packed_int64_.Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestPackedTableDrivenLite.packed_int64)
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::int64 >&
+TestPackedTableDrivenLite::packed_int64() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestPackedTableDrivenLite.packed_int64)
+  return packed_int64_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::int64 >*
+TestPackedTableDrivenLite::mutable_packed_int64() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestPackedTableDrivenLite.packed_int64)
+  return &packed_int64_;
+}
+
+// repeated uint32 packed_uint32 = 92 [packed = true];
+inline int TestPackedTableDrivenLite::packed_uint32_size() const {
+  return packed_uint32_.size();
+}
+inline void TestPackedTableDrivenLite::clear_packed_uint32() {
+  packed_uint32_.Clear();
+}
+inline ::google::protobuf::uint32 TestPackedTableDrivenLite::packed_uint32(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestPackedTableDrivenLite.packed_uint32)
+  return packed_uint32_.Get(index);
+}
+inline void TestPackedTableDrivenLite::set_packed_uint32(int index, ::google::protobuf::uint32 value) {
+  packed_uint32_.Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestPackedTableDrivenLite.packed_uint32)
+}
+inline void TestPackedTableDrivenLite::add_packed_uint32(::google::protobuf::uint32 value) {
+  packed_uint32_.Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestPackedTableDrivenLite.packed_uint32)
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
+TestPackedTableDrivenLite::packed_uint32() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestPackedTableDrivenLite.packed_uint32)
+  return packed_uint32_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
+TestPackedTableDrivenLite::mutable_packed_uint32() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestPackedTableDrivenLite.packed_uint32)
+  return &packed_uint32_;
+}
+
+// repeated uint64 packed_uint64 = 93 [packed = true];
+inline int TestPackedTableDrivenLite::packed_uint64_size() const {
+  return packed_uint64_.size();
+}
+inline void TestPackedTableDrivenLite::clear_packed_uint64() {
+  packed_uint64_.Clear();
+}
+inline ::google::protobuf::uint64 TestPackedTableDrivenLite::packed_uint64(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestPackedTableDrivenLite.packed_uint64)
+  return packed_uint64_.Get(index);
+}
+inline void TestPackedTableDrivenLite::set_packed_uint64(int index, ::google::protobuf::uint64 value) {
+  packed_uint64_.Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestPackedTableDrivenLite.packed_uint64)
+}
+inline void TestPackedTableDrivenLite::add_packed_uint64(::google::protobuf::uint64 value) {
+  packed_uint64_.Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestPackedTableDrivenLite.packed_uint64)
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >&
+TestPackedTableDrivenLite::packed_uint64() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestPackedTableDrivenLite.packed_uint64)
+  return packed_uint64_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >*
+TestPackedTableDrivenLite::mutable_packed_uint64() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestPackedTableDrivenLite.packed_uint64)
+  return &packed_uint64_;
+}
+
+// repeated sint32 packed_sint32 = 94 [packed = true];
+inline int TestPackedTableDrivenLite::packed_sint32_size() const {
+  return packed_sint32_.size();
+}
+inline void TestPackedTableDrivenLite::clear_packed_sint32() {
+  packed_sint32_.Clear();
+}
+inline ::google::protobuf::int32 TestPackedTableDrivenLite::packed_sint32(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestPackedTableDrivenLite.packed_sint32)
+  return packed_sint32_.Get(index);
+}
+inline void TestPackedTableDrivenLite::set_packed_sint32(int index, ::google::protobuf::int32 value) {
+  packed_sint32_.Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestPackedTableDrivenLite.packed_sint32)
+}
+inline void TestPackedTableDrivenLite::add_packed_sint32(::google::protobuf::int32 value) {
+  packed_sint32_.Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestPackedTableDrivenLite.packed_sint32)
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
+TestPackedTableDrivenLite::packed_sint32() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestPackedTableDrivenLite.packed_sint32)
+  return packed_sint32_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
+TestPackedTableDrivenLite::mutable_packed_sint32() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestPackedTableDrivenLite.packed_sint32)
+  return &packed_sint32_;
+}
+
+// repeated sint64 packed_sint64 = 95 [packed = true];
+inline int TestPackedTableDrivenLite::packed_sint64_size() const {
+  return packed_sint64_.size();
+}
+inline void TestPackedTableDrivenLite::clear_packed_sint64() {
+  packed_sint64_.Clear();
+}
+inline ::google::protobuf::int64 TestPackedTableDrivenLite::packed_sint64(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestPackedTableDrivenLite.packed_sint64)
+  return packed_sint64_.Get(index);
+}
+inline void TestPackedTableDrivenLite::set_packed_sint64(int index, ::google::protobuf::int64 value) {
+  packed_sint64_.Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestPackedTableDrivenLite.packed_sint64)
+}
+inline void TestPackedTableDrivenLite::add_packed_sint64(::google::protobuf::int64 value) {
+  packed_sint64_.Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestPackedTableDrivenLite.packed_sint64)
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::int64 >&
+TestPackedTableDrivenLite::packed_sint64() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestPackedTableDrivenLite.packed_sint64)
+  return packed_sint64_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::int64 >*
+TestPackedTableDrivenLite::mutable_packed_sint64() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestPackedTableDrivenLite.packed_sint64)
+  return &packed_sint64_;
+}
+
+// repeated fixed32 packed_fixed32 = 96 [packed = true];
+inline int TestPackedTableDrivenLite::packed_fixed32_size() const {
+  return packed_fixed32_.size();
+}
+inline void TestPackedTableDrivenLite::clear_packed_fixed32() {
+  packed_fixed32_.Clear();
+}
+inline ::google::protobuf::uint32 TestPackedTableDrivenLite::packed_fixed32(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestPackedTableDrivenLite.packed_fixed32)
+  return packed_fixed32_.Get(index);
+}
+inline void TestPackedTableDrivenLite::set_packed_fixed32(int index, ::google::protobuf::uint32 value) {
+  packed_fixed32_.Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestPackedTableDrivenLite.packed_fixed32)
+}
+inline void TestPackedTableDrivenLite::add_packed_fixed32(::google::protobuf::uint32 value) {
+  packed_fixed32_.Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestPackedTableDrivenLite.packed_fixed32)
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
+TestPackedTableDrivenLite::packed_fixed32() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestPackedTableDrivenLite.packed_fixed32)
+  return packed_fixed32_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
+TestPackedTableDrivenLite::mutable_packed_fixed32() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestPackedTableDrivenLite.packed_fixed32)
+  return &packed_fixed32_;
+}
+
+// repeated fixed64 packed_fixed64 = 97 [packed = true];
+inline int TestPackedTableDrivenLite::packed_fixed64_size() const {
+  return packed_fixed64_.size();
+}
+inline void TestPackedTableDrivenLite::clear_packed_fixed64() {
+  packed_fixed64_.Clear();
+}
+inline ::google::protobuf::uint64 TestPackedTableDrivenLite::packed_fixed64(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestPackedTableDrivenLite.packed_fixed64)
+  return packed_fixed64_.Get(index);
+}
+inline void TestPackedTableDrivenLite::set_packed_fixed64(int index, ::google::protobuf::uint64 value) {
+  packed_fixed64_.Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestPackedTableDrivenLite.packed_fixed64)
+}
+inline void TestPackedTableDrivenLite::add_packed_fixed64(::google::protobuf::uint64 value) {
+  packed_fixed64_.Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestPackedTableDrivenLite.packed_fixed64)
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >&
+TestPackedTableDrivenLite::packed_fixed64() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestPackedTableDrivenLite.packed_fixed64)
+  return packed_fixed64_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::uint64 >*
+TestPackedTableDrivenLite::mutable_packed_fixed64() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestPackedTableDrivenLite.packed_fixed64)
+  return &packed_fixed64_;
+}
+
+// repeated sfixed32 packed_sfixed32 = 98 [packed = true];
+inline int TestPackedTableDrivenLite::packed_sfixed32_size() const {
+  return packed_sfixed32_.size();
+}
+inline void TestPackedTableDrivenLite::clear_packed_sfixed32() {
+  packed_sfixed32_.Clear();
+}
+inline ::google::protobuf::int32 TestPackedTableDrivenLite::packed_sfixed32(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestPackedTableDrivenLite.packed_sfixed32)
+  return packed_sfixed32_.Get(index);
+}
+inline void TestPackedTableDrivenLite::set_packed_sfixed32(int index, ::google::protobuf::int32 value) {
+  packed_sfixed32_.Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestPackedTableDrivenLite.packed_sfixed32)
+}
+inline void TestPackedTableDrivenLite::add_packed_sfixed32(::google::protobuf::int32 value) {
+  packed_sfixed32_.Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestPackedTableDrivenLite.packed_sfixed32)
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
+TestPackedTableDrivenLite::packed_sfixed32() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestPackedTableDrivenLite.packed_sfixed32)
+  return packed_sfixed32_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
+TestPackedTableDrivenLite::mutable_packed_sfixed32() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestPackedTableDrivenLite.packed_sfixed32)
+  return &packed_sfixed32_;
+}
+
+// repeated sfixed64 packed_sfixed64 = 99 [packed = true];
+inline int TestPackedTableDrivenLite::packed_sfixed64_size() const {
+  return packed_sfixed64_.size();
+}
+inline void TestPackedTableDrivenLite::clear_packed_sfixed64() {
+  packed_sfixed64_.Clear();
+}
+inline ::google::protobuf::int64 TestPackedTableDrivenLite::packed_sfixed64(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestPackedTableDrivenLite.packed_sfixed64)
+  return packed_sfixed64_.Get(index);
+}
+inline void TestPackedTableDrivenLite::set_packed_sfixed64(int index, ::google::protobuf::int64 value) {
+  packed_sfixed64_.Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestPackedTableDrivenLite.packed_sfixed64)
+}
+inline void TestPackedTableDrivenLite::add_packed_sfixed64(::google::protobuf::int64 value) {
+  packed_sfixed64_.Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestPackedTableDrivenLite.packed_sfixed64)
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::int64 >&
+TestPackedTableDrivenLite::packed_sfixed64() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestPackedTableDrivenLite.packed_sfixed64)
+  return packed_sfixed64_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::int64 >*
+TestPackedTableDrivenLite::mutable_packed_sfixed64() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestPackedTableDrivenLite.packed_sfixed64)
+  return &packed_sfixed64_;
+}
+
+// repeated float packed_float = 100 [packed = true];
+inline int TestPackedTableDrivenLite::packed_float_size() const {
+  return packed_float_.size();
+}
+inline void TestPackedTableDrivenLite::clear_packed_float() {
+  packed_float_.Clear();
+}
+inline float TestPackedTableDrivenLite::packed_float(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestPackedTableDrivenLite.packed_float)
+  return packed_float_.Get(index);
+}
+inline void TestPackedTableDrivenLite::set_packed_float(int index, float value) {
+  packed_float_.Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestPackedTableDrivenLite.packed_float)
+}
+inline void TestPackedTableDrivenLite::add_packed_float(float value) {
+  packed_float_.Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestPackedTableDrivenLite.packed_float)
+}
+inline const ::google::protobuf::RepeatedField< float >&
+TestPackedTableDrivenLite::packed_float() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestPackedTableDrivenLite.packed_float)
+  return packed_float_;
+}
+inline ::google::protobuf::RepeatedField< float >*
+TestPackedTableDrivenLite::mutable_packed_float() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestPackedTableDrivenLite.packed_float)
+  return &packed_float_;
+}
+
+// repeated double packed_double = 101 [packed = true];
+inline int TestPackedTableDrivenLite::packed_double_size() const {
+  return packed_double_.size();
+}
+inline void TestPackedTableDrivenLite::clear_packed_double() {
+  packed_double_.Clear();
+}
+inline double TestPackedTableDrivenLite::packed_double(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestPackedTableDrivenLite.packed_double)
+  return packed_double_.Get(index);
+}
+inline void TestPackedTableDrivenLite::set_packed_double(int index, double value) {
+  packed_double_.Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestPackedTableDrivenLite.packed_double)
+}
+inline void TestPackedTableDrivenLite::add_packed_double(double value) {
+  packed_double_.Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestPackedTableDrivenLite.packed_double)
+}
+inline const ::google::protobuf::RepeatedField< double >&
+TestPackedTableDrivenLite::packed_double() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestPackedTableDrivenLite.packed_double)
+  return packed_double_;
+}
+inline ::google::protobuf::RepeatedField< double >*
+TestPackedTableDrivenLite::mutable_packed_double() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestPackedTableDrivenLite.packed_double)
+  return &packed_double_;
+}
+
+// repeated bool packed_bool = 102 [packed = true];
+inline int TestPackedTableDrivenLite::packed_bool_size() const {
+  return packed_bool_.size();
+}
+inline void TestPackedTableDrivenLite::clear_packed_bool() {
+  packed_bool_.Clear();
+}
+inline bool TestPackedTableDrivenLite::packed_bool(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestPackedTableDrivenLite.packed_bool)
+  return packed_bool_.Get(index);
+}
+inline void TestPackedTableDrivenLite::set_packed_bool(int index, bool value) {
+  packed_bool_.Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestPackedTableDrivenLite.packed_bool)
+}
+inline void TestPackedTableDrivenLite::add_packed_bool(bool value) {
+  packed_bool_.Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestPackedTableDrivenLite.packed_bool)
+}
+inline const ::google::protobuf::RepeatedField< bool >&
+TestPackedTableDrivenLite::packed_bool() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestPackedTableDrivenLite.packed_bool)
+  return packed_bool_;
+}
+inline ::google::protobuf::RepeatedField< bool >*
+TestPackedTableDrivenLite::mutable_packed_bool() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestPackedTableDrivenLite.packed_bool)
+  return &packed_bool_;
+}
+
+// repeated .protobuf_unittest.ForeignEnumLite packed_enum = 103 [packed = true];
+inline int TestPackedTableDrivenLite::packed_enum_size() const {
+  return packed_enum_.size();
+}
+inline void TestPackedTableDrivenLite::clear_packed_enum() {
+  packed_enum_.Clear();
+}
+inline ::protobuf_unittest::ForeignEnumLite TestPackedTableDrivenLite::packed_enum(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestPackedTableDrivenLite.packed_enum)
+  return static_cast< ::protobuf_unittest::ForeignEnumLite >(packed_enum_.Get(index));
+}
+inline void TestPackedTableDrivenLite::set_packed_enum(int index, ::protobuf_unittest::ForeignEnumLite value) {
+  assert(::protobuf_unittest::ForeignEnumLite_IsValid(value));
+  packed_enum_.Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestPackedTableDrivenLite.packed_enum)
+}
+inline void TestPackedTableDrivenLite::add_packed_enum(::protobuf_unittest::ForeignEnumLite value) {
+  assert(::protobuf_unittest::ForeignEnumLite_IsValid(value));
+  packed_enum_.Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestPackedTableDrivenLite.packed_enum)
+}
+inline const ::google::protobuf::RepeatedField<int>&
+TestPackedTableDrivenLite::packed_enum() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestPackedTableDrivenLite.packed_enum)
+  return packed_enum_;
+}
+inline ::google::protobuf::RepeatedField<int>*
+TestPackedTableDrivenLite::mutable_packed_enum() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestPackedTableDrivenLite.packed_enum)
+  return &packed_enum_;
+}
+
+// -------------------------------------------------------------------
+
+// TestRepeatedTableDrivenLite
+
+// repeated int32 int32_values = 1;
+inline int TestRepeatedTableDrivenLite::int32_values_size() const {
+  return int32_values_.size();
+}
+inline void TestRepeatedTableDrivenLite::clear_int32_values() {
+  int32_values_.Clear();
+}
+inline ::google::protobuf::int32 TestRepeatedTableDrivenLite::int32_values(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestRepeatedTableDrivenLite.int32_values)
+  return int32_values_.Get(index);
+}
+inline void TestRepeatedTableDrivenLite::set_int32_values(int index, ::google::protobuf::int32 value) {
+  int32_values_.Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestRepeatedTableDrivenLite.int32_values)
+}
+inline void TestRepeatedTableDrivenLite::add_int32_values(::google::protobuf::int32 value) {
+  int32_values_.Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestRepeatedTableDrivenLite.int32_values)
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
+TestRepeatedTableDrivenLite::int32_values() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestRepeatedTableDrivenLite.int32_values)
+  return int32_values_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
+TestRepeatedTableDrivenLite::mutable_int32_values() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestRepeatedTableDrivenLite.int32_values)
+  return &int32_values_;
+}
+
+// repeated int32 packed_int32_values = 2 [packed = true];
+inline int TestRepeatedTableDrivenLite::packed_int32_values_size() const {
+  return packed_int32_values_.size();
+}
+inline void TestRepeatedTableDrivenLite::clear_packed_int32_values() {
+  packed_int32_values_.Clear();
+}
+inline ::google::protobuf::int32 TestRepeatedTableDrivenLite::packed_int32_values(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestRepeatedTableDrivenLite.packed_int32_values)
+  return packed_int32_values_.Get(index);
+}
+inline void TestRepeatedTableDrivenLite::set_packed_int32_values(int index, ::google::protobuf::int32 value) {
+  packed_int32_values_.Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestRepeatedTableDrivenLite.packed_int32_values)
+}
+inline void TestRepeatedTableDrivenLite::add_packed_int32_values(::google::protobuf::int32 value) {
+  packed_int32_values_.Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestRepeatedTableDrivenLite.packed_int32_values)
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::int32 >&
+TestRepeatedTableDrivenLite::packed_int32_values() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestRepeatedTableDrivenLite.packed_int32_values)
+  return packed_int32_values_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::int32 >*
+TestRepeatedTableDrivenLite::mutable_packed_int32_values() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestRepeatedTableDrivenLite.packed_int32_values)
+  return &packed_int32_values_;
+}
+
+// repeated sint64 packed_sint64_values = 3 [packed = true];
+inline int TestRepeatedTableDrivenLite::packed_sint64_values_size() const {
+  return packed_sint64_values_.size();
+}
+inline void TestRepeatedTableDrivenLite::clear_packed_sint64_values() {
+  packed_sint64_values_.Clear();
+}
+inline ::google::protobuf::int64 TestRepeatedTableDrivenLite::packed_sint64_values(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestRepeatedTableDrivenLite.packed_sint64_values)
+  return packed_sint64_values_.Get(index);
+}
+inline void TestRepeatedTableDrivenLite::set_packed_sint64_values(int index, ::google::protobuf::int64 value) {
+  packed_sint64_values_.Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestRepeatedTableDrivenLite.packed_sint64_values)
+}
+inline void TestRepeatedTableDrivenLite::add_packed_sint64_values(::google::protobuf::int64 value) {
+  packed_sint64_values_.Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestRepeatedTableDrivenLite.packed_sint64_values)
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::int64 >&
+TestRepeatedTableDrivenLite::packed_sint64_values() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestRepeatedTableDrivenLite.packed_sint64_values)
+  return packed_sint64_values_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::int64 >*
+TestRepeatedTableDrivenLite::mutable_packed_sint64_values() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestRepeatedTableDrivenLite.packed_sint64_values)
+  return &packed_sint64_values_;
+}
+
+// repeated fixed32 fixed32_values = 4;
+inline int TestRepeatedTableDrivenLite::fixed32_values_size() const {
+  return fixed32_values_.size();
+}
+inline void TestRepeatedTableDrivenLite::clear_fixed32_values() {
+  fixed32_values_.Clear();
+}
+inline ::google::protobuf::uint32 TestRepeatedTableDrivenLite::fixed32_values(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestRepeatedTableDrivenLite.fixed32_values)
+  return fixed32_values_.Get(index);
+}
+inline void TestRepeatedTableDrivenLite::set_fixed32_values(int index, ::google::protobuf::uint32 value) {
+  fixed32_values_.Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestRepeatedTableDrivenLite.fixed32_values)
+}
+inline void TestRepeatedTableDrivenLite::add_fixed32_values(::google::protobuf::uint32 value) {
+  fixed32_values_.Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestRepeatedTableDrivenLite.fixed32_values)
+}
+inline const ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >&
+TestRepeatedTableDrivenLite::fixed32_values() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestRepeatedTableDrivenLite.fixed32_values)
+  return fixed32_values_;
+}
+inline ::google::protobuf::RepeatedField< ::google::protobuf::uint32 >*
+TestRepeatedTableDrivenLite::mutable_fixed32_values() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestRepeatedTableDrivenLite.fixed32_values)
+  return &fixed32_values_;
+}
+
+// repeated double packed_double_values = 5 [packed = true];
+inline int TestRepeatedTableDrivenLite::packed_double_values_size() const {
+  return packed_double_values_.size();
+}
+inline void TestRepeatedTableDrivenLite::clear_packed_double_values() {
+  packed_double_values_.Clear();
+}
+inline double TestRepeatedTableDrivenLite::packed_double_values(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestRepeatedTableDrivenLite.packed_double_values)
+  return packed_double_values_.Get(index);
+}
+inline void TestRepeatedTableDrivenLite::set_packed_double_values(int index, double value) {
+  packed_double_values_.Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestRepeatedTableDrivenLite.packed_double_values)
+}
+inline void TestRepeatedTableDrivenLite::add_packed_double_values(double value) {
+  packed_double_values_.Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestRepeatedTableDrivenLite.packed_double_values)
+}
+inline const ::google::protobuf::RepeatedField< double >&
+TestRepeatedTableDrivenLite::packed_double_values() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestRepeatedTableDrivenLite.packed_double_values)
+  return packed_double_values_;
+}
+inline ::google::protobuf::RepeatedField< double >*
+TestRepeatedTableDrivenLite::mutable_packed_double_values() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestRepeatedTableDrivenLite.packed_double_values)
+  return &packed_double_values_;
+}
+
+// repeated .protobuf_unittest.ForeignEnumLite enum_values = 6;
+inline int TestRepeatedTableDrivenLite::enum_values_size() const {
+  return enum_values_.size();
+}
+inline void TestRepeatedTableDrivenLite::clear_enum_values() {
+  enum_values_.Clear();
+}
+inline ::protobuf_unittest::ForeignEnumLite TestRepeatedTableDrivenLite::enum_values(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestRepeatedTableDrivenLite.enum_values)
+  return static_cast< ::protobuf_unittest::ForeignEnumLite >(enum_values_.Get(index));
+}
+inline void TestRepeatedTableDrivenLite::set_enum_values(int index, ::protobuf_unittest::ForeignEnumLite value) {
+  assert(::protobuf_unittest::ForeignEnumLite_IsValid(value));
+  enum_values_.Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestRepeatedTableDrivenLite.enum_values)
+}
+inline void TestRepeatedTableDrivenLite::add_enum_values(::protobuf_unittest::ForeignEnumLite value) {
+  assert(::protobuf_unittest::ForeignEnumLite_IsValid(value));
+  enum_values_.Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestRepeatedTableDrivenLite.enum_values)
+}
+inline const ::google::protobuf::RepeatedField<int>&
+TestRepeatedTableDrivenLite::enum_values() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestRepeatedTableDrivenLite.enum_values)
+  return enum_values_;
+}
+inline ::google::protobuf::RepeatedField<int>*
+TestRepeatedTableDrivenLite::mutable_enum_values() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestRepeatedTableDrivenLite.enum_values)
+  return &enum_values_;
+}
+
+// repeated .protobuf_unittest.ForeignEnumLite packed_enum_values = 7 [packed = true];
+inline int TestRepeatedTableDrivenLite::packed_enum_values_size() const {
+  return packed_enum_values_.size();
+}
+inline void TestRepeatedTableDrivenLite::clear_packed_enum_values() {
+  packed_enum_values_.Clear();
+}
+inline ::protobuf_unittest::ForeignEnumLite TestRepeatedTableDrivenLite::packed_enum_values(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestRepeatedTableDrivenLite.packed_enum_values)
+  return static_cast< ::protobuf_unittest::ForeignEnumLite >(packed_enum_values_.Get(index));
+}
+inline void TestRepeatedTableDrivenLite::set_packed_enum_values(int index, ::protobuf_unittest::ForeignEnumLite value) {
+  assert(::protobuf_unittest::ForeignEnumLite_IsValid(value));
+  packed_enum_values_.Set(index, value);
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestRepeatedTableDrivenLite.packed_enum_values)
+}
+inline void TestRepeatedTableDrivenLite::add_packed_enum_values(::protobuf_unittest::ForeignEnumLite value) {
+  assert(::protobuf_unittest::ForeignEnumLite_IsValid(value));
+  packed_enum_values_.Add(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestRepeatedTableDrivenLite.packed_enum_values)
+}
+inline const ::google::protobuf::RepeatedField<int>&
+TestRepeatedTableDrivenLite::packed_enum_values() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestRepeatedTableDrivenLite.packed_enum_values)
+  return packed_enum_values_;
+}
+inline ::google::protobuf::RepeatedField<int>*
+TestRepeatedTableDrivenLite::mutable_packed_enum_values() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestRepeatedTableDrivenLite.packed_enum_values)
+  return &packed_enum_values_;
+}
+
+// repeated string string_values = 8;
+inline int TestRepeatedTableDrivenLite::string_values_size() const {
+  return string_values_.size();
+}
+inline void TestRepeatedTableDrivenLite::clear_string_values() {
+  string_values_.Clear();
+}
+inline const ::std::string& TestRepeatedTableDrivenLite::string_values(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestRepeatedTableDrivenLite.string_values)
+  return string_values_.Get(index);
+}
+inline ::std::string* TestRepeatedTableDrivenLite::mutable_string_values(int index) {
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestRepeatedTableDrivenLite.string_values)
+  return string_values_.Mutable(index);
+}
+inline void TestRepeatedTableDrivenLite::set_string_values(int index, const ::std::string& value) {
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestRepeatedTableDrivenLite.string_values)
+  string_values_.Mutable(index)->assign(value);
+}
+#if LANG_CXX11
+inline void TestRepeatedTableDrivenLite::set_string_values(int index, ::std::string&& value) {
+  // @@protoc_insertion_point(field_set:protobuf_unittest.TestRepeatedTableDrivenLite.string_values)
+  string_values_.Mutable(index)->assign(std::move(value));
+}
+#endif
+inline void TestRepeatedTableDrivenLite::set_string_values(int index, const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  string_values_.Mutable(index)->assign(value);
+  // @@protoc_insertion_point(field_set_char:protobuf_unittest.TestRepeatedTableDrivenLite.string_values)
+}
+inline void TestRepeatedTableDrivenLite::set_string_values(int index, const char* value, size_t size) {
+  string_values_.Mutable(index)->assign(
+    reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_set_pointer:protobuf_unittest.TestRepeatedTableDrivenLite.string_values)
+}
+inline ::std::string* TestRepeatedTableDrivenLite::add_string_values() {
+  // @@protoc_insertion_point(field_add_mutable:protobuf_unittest.TestRepeatedTableDrivenLite.string_values)
+  return string_values_.Add();
+}
+inline void TestRepeatedTableDrivenLite::add_string_values(const ::std::string& value) {
+  string_values_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestRepeatedTableDrivenLite.string_values)
+}
+#if LANG_CXX11
+inline void TestRepeatedTableDrivenLite::add_string_values(::std::string&& value) {
+  string_values_.Add(std::move(value));
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestRepeatedTableDrivenLite.string_values)
+}
+#endif
+inline void TestRepeatedTableDrivenLite::add_string_values(const char* value) {
+  GOOGLE_DCHECK(value != NULL);
+  string_values_.Add()->assign(value);
+  // @@protoc_insertion_point(field_add_char:protobuf_unittest.TestRepeatedTableDrivenLite.string_values)
+}
+inline void TestRepeatedTableDrivenLite::add_string_values(const char* value, size_t size) {
+  string_values_.Add()->assign(reinterpret_cast<const char*>(value), size);
+  // @@protoc_insertion_point(field_add_pointer:protobuf_unittest.TestRepeatedTableDrivenLite.string_values)
+}
+inline const ::google::protobuf::RepeatedPtrField< ::std::string>&
+TestRepeatedTableDrivenLite::string_values() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestRepeatedTableDrivenLite.string_values)
+  return string_values_;
+}
+inline ::google::protobuf::RepeatedPtrField< ::std::string>*
+TestRepeatedTableDrivenLite::mutable_string_values() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestRepeatedTableDrivenLite.string_values)
+  return &string_values_;
+}
+
+// repeated .protobuf_unittest.TestTableDrivenLite.NestedMessage message_values = 9;
+inline int TestRepeatedTableDrivenLite::message_values_size() const {
+  return message_values_.size();
+}
+inline void TestRepeatedTableDrivenLite::clear_message_values() {
+  message_values_.Clear();
+}
+inline const ::protobuf_unittest::TestTableDrivenLite_NestedMessage& TestRepeatedTableDrivenLite::message_values(int index) const {
+  // @@protoc_insertion_point(field_get:protobuf_unittest.TestRepeatedTableDrivenLite.message_values)
+  return message_values_.Get(index);
+}
+inline ::protobuf_unittest::TestTableDrivenLite_NestedMessage* TestRepeatedTableDrivenLite::mutable_message_values(int index) {
+  // @@protoc_insertion_point(field_mutable:protobuf_unittest.TestRepeatedTableDrivenLite.message_values)
+  return message_values_.Mutable(index);
+}
+inline ::protobuf_unittest::TestTableDrivenLite_NestedMessage* TestRepeatedTableDrivenLite::add_message_values() {
+  // @@protoc_insertion_point(field_add:protobuf_unittest.TestRepeatedTableDrivenLite.message_values)
+  return message_values_.Add();
+}
+inline ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::TestTableDrivenLite_NestedMessage >*
+TestRepeatedTableDrivenLite::mutable_message_values() {
+  // @@protoc_insertion_point(field_mutable_list:protobuf_unittest.TestRepeatedTableDrivenLite.message_values)
+  return &message_values_;
+}
+inline const ::google::protobuf::RepeatedPtrField< ::protobuf_unittest::TestTableDrivenLite_NestedMessage >&
+TestRepeatedTableDrivenLite::message_values() const {
+  // @@protoc_insertion_point(field_list:protobuf_unittest.TestRepeatedTableDrivenLite.message_values)
+  return message_values_;
+}
+
+#endif  // !PROTOBUF_INLINE_NOT_IN_HEADERS
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+
+// @@protoc_insertion_point(namespace_scope)
+
+
+}  // namespace protobuf_unittest
+
+#ifndef SWIG
+namespace google {
+namespace protobuf {
+
+template <> struct is_proto_enum< ::protobuf_unittest::TestTableDrivenLite_NestedEnum> : ::google::protobuf::internal::true_type {};
+
+}  // namespace protobuf
+}  // namespace google
+#endif  // SWIG
+
+// @@protoc_insertion_point(global_scope)
+
+#endif  // PROTOBUF_google_2fprotobuf_2funittest_5ftable_5fdriven_5flite_2eproto__INCLUDED
@@ -34,13 +34,18 @@
 
 #include <google/protobuf/unknown_field_set.h>
 
+#include <string.h>
+#include <algorithm>
+
 #include <google/protobuf/stubs/logging.h>
 #include <google/protobuf/stubs/common.h>
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/io/zero_copy_stream.h>
 #include <google/protobuf/io/zero_copy_stream_impl.h>
+#include <google/protobuf/arena.h>
 #include <google/protobuf/metadata.h>
 #include <google/protobuf/wire_format.h>
+#include <google/protobuf/wire_format_lite.h>
 #include <google/protobuf/stubs/stl_util.h>
 
 namespace google {
@@ -70,17 +75,53 @@ const UnknownFieldSet* UnknownFieldSet::default_instance() {
   return default_unknown_field_set_instance_;
 }
 
+void UnknownFieldSet::DeleteFields(std::vector<UnknownField>* fields) {
+  int n = fields->size();
+  while (n > 0) {
+    (*fields)[--n].Delete();
+  }
+  delete fields;
+}
+
 void UnknownFieldSet::ClearFallback() {
-  GOOGLE_DCHECK(fields_ != NULL && fields_->size() > 0);
-  int n = fields_->size();
-  do {
-    (*fields_)[--n].Delete();
-  } while (n > 0);
-  delete fields_;
-  fields_ = NULL;
+  GOOGLE_DCHECK((fields_ != NULL && fields_->size() > 0) || has_raw_fields());
+  if (fields_ != NULL) {
+    DeleteFields(fields_);
+    fields_ = NULL;
+  }
+  if (raw_ != NULL) {
+    if (raw_->parsed != 0) {
+      DeleteFields(reinterpret_cast<std::vector<UnknownField>*>(raw_->parsed));
+      raw_->parsed = 0;
+    }
+    raw_->size = 0;
+  }
+}
+
+void UnknownFieldSet::FreeRawFields() {
+  GOOGLE_DCHECK(!has_raw_fields());
+  // On an arena the buffer and the RawFields struct belong to the arena.
+  if (arena_ == NULL) {
+    ::operator delete[](raw_->data);
+    ::operator delete[](raw_);
+  }
+  raw_ = NULL;
+}
+
+void UnknownFieldSet::SwapFallback(UnknownFieldSet* other) {
+  // The raw buffers are owned by different arenas, so swap by copying.
+  UnknownFieldSet temp;
+  temp.MergeFromAndDestroy(this);
+  MergeFrom(*other);
+  other->Clear();
+  other->MergeFromAndDestroy(&temp);
 }
 
 void UnknownFieldSet::InternalMergeFrom(const UnknownFieldSet& other) {
+  if (other.has_raw_fields()) {
+    AppendRawBytes(other.raw_->data, other.raw_->size);
+    return;
+  }
   int other_field_count = other.field_count();
   if (other_field_count > 0) {
     fields_ = new std::vector<UnknownField>();
@@ -92,12 +133,17 @@ void UnknownFieldSet::InternalMergeFrom(const UnknownFieldSet& other) {
 }
 
 void UnknownFieldSet::MergeFrom(const UnknownFieldSet& other) {
+  if (other.has_raw_fields() && fields_ == NULL) {
+    AppendRawBytes(other.raw_->data, other.raw_->size);
+    return;
+  }
   int other_field_count = other.field_count();
   if (other_field_count > 0) {
+    if (has_raw_fields()) ConvertRawFields();
     if (fields_ == NULL) fields_ = new std::vector<UnknownField>();
     for (int i = 0; i < other_field_count; i++) {
-      fields_->push_back((*other.fields_)[i]);
-      fields_->back().DeepCopy((*other.fields_)[i]);
+      fields_->push_back(other.field(i));
+      fields_->back().DeepCopy(other.field(i));
     }
   }
 }
@@ -105,8 +151,22 @@ void UnknownFieldSet::MergeFrom(const UnknownFieldSet& other) {
 // A specialized MergeFrom for performance when we are merging from an UFS that
 // is temporary and can be destroyed in the process.
 void UnknownFieldSet::MergeFromAndDestroy(UnknownFieldSet* other) {
+  if (other->has_raw_fields() && fields_ == NULL) {
+    if (!has_raw_fields() && arena_ == NULL && other->arena_ == NULL) {
+      // Steal the buffer rather than copying it.
+      if (raw_ != NULL) FreeRawFields();
+      raw_ = other->raw_;
+      other->raw_ = NULL;
+    } else {
+      AppendRawBytes(other->raw_->data, other->raw_->size);
+      other->Clear();
+    }
+    return;
+  }
+  if (other->has_raw_fields()) other->ConvertRawFields();
   int other_field_count = other->field_count();
   if (other_field_count > 0) {
+    if (has_raw_fields()) ConvertRawFields();
     if (fields_ == NULL) fields_ = new std::vector<UnknownField>();
     for (int i = 0; i < other_field_count; i++) {
       fields_->push_back((*other->fields_)[i]);
@@ -124,9 +184,13 @@ void UnknownFieldSet::MergeToInternalMetdata(
 }
 
 size_t UnknownFieldSet::SpaceUsedExcludingSelfLong() const {
-  if (fields_ == NULL) return 0;
+  size_t total_size = 0;
+  if (raw_ != NULL) {
+    total_size += sizeof(*raw_) + raw_->capacity;
+  }
+  if (fields_ == NULL) return total_size;
 
-  size_t total_size = sizeof(*fields_) + sizeof(UnknownField) * fields_->size();
+  total_size += sizeof(*fields_) + sizeof(UnknownField) * fields_->size();
 
   for (int i = 0; i < fields_->size(); i++) {
     const UnknownField& field = (*fields_)[i];
@@ -151,6 +215,7 @@ size_t UnknownFieldSet::SpaceUsedLong() const {
 }
 
 void UnknownFieldSet::AddVarint(int number, uint64 value) {
+  if (has_raw_fields()) ConvertRawFields();
   UnknownField field;
   field.number_ = number;
   field.SetType(UnknownField::TYPE_VARINT);
@@ -160,6 +225,7 @@ void UnknownFieldSet::AddVarint(int number, uint64 value) {
 }
 
 void UnknownFieldSet::AddFixed32(int number, uint32 value) {
+  if (has_raw_fields()) ConvertRawFields();
   UnknownField field;
   field.number_ = number;
   field.SetType(UnknownField::TYPE_FIXED32);
@@ -169,6 +235,7 @@ void UnknownFieldSet::AddFixed32(int number, uint32 value) {
 }
 
 void UnknownFieldSet::AddFixed64(int number, uint64 value) {
+  if (has_raw_fields()) ConvertRawFields();
   UnknownField field;
   field.number_ = number;
   field.SetType(UnknownField::TYPE_FIXED64);
@@ -178,6 +245,7 @@ void UnknownFieldSet::AddFixed64(int number, uint64 value) {
 }
 
 string* UnknownFieldSet::AddLengthDelimited(int number) {
+  if (has_raw_fields()) ConvertRawFields();
   UnknownField field;
   field.number_ = number;
   field.SetType(UnknownField::TYPE_LENGTH_DELIMITED);
@@ -189,6 +257,7 @@ string* UnknownFieldSet::AddLengthDelimited(int number) {
 
 
 UnknownFieldSet* UnknownFieldSet::AddGroup(int number) {
+  if (has_raw_fields()) ConvertRawFields();
   UnknownField field;
   field.number_ = number;
   field.SetType(UnknownField::TYPE_GROUP);
@@ -199,12 +268,14 @@ UnknownFieldSet* UnknownFieldSet::AddGroup(int number) {
 }
 
 void UnknownFieldSet::AddField(const UnknownField& field) {
+  if (has_raw_fields()) ConvertRawFields();
   if (fields_ == NULL) fields_ = new std::vector<UnknownField>();
   fields_->push_back(field);
   fields_->back().DeepCopy(field);
 }
 
 void UnknownFieldSet::DeleteSubrange(int start, int num) {
+  if (has_raw_fields()) ConvertRawFields();
   // Delete the specified fields.
   for (int i = 0; i < num; ++i) {
     (*fields_)[i + start].Delete();
@@ -225,6 +296,7 @@ void UnknownFieldSet::DeleteSubrange(int start, int num) {
 }
 
 void UnknownFieldSet::DeleteByNumber(int number) {
+  if (has_raw_fields()) ConvertRawFields();
   if (fields_ == NULL) return;
   int left = 0;  // The number of fields left after deletion.
   for (int i = 0; i < fields_->size(); ++i) {
@@ -246,6 +318,220 @@ void UnknownFieldSet::DeleteByNumber(int number) {
   }
 }
 
+char* UnknownFieldSet::ReserveRawBytes(int size) {
+  if (raw_ == NULL) {
+    raw_ = Arena::CreateArray<RawFields>(arena_, 1);
+    raw_->data = NULL;
+    raw_->size = 0;
+    raw_->capacity = 0;
+    raw_->parsed = 0;
+  }
+  if (raw_->parsed != 0) {
+    // The bytes are about to change; drop the decoded copy.
+    DeleteFields(reinterpret_cast<std::vector<UnknownField>*>(raw_->parsed));
+    raw_->parsed = 0;
+  }
+  if (raw_->capacity - raw_->size < size) {
+    int new_capacity = std::max(raw_->capacity * 2, raw_->size + size);
+    new_capacity = std::max(new_capacity, 64);
+    char* new_data = Arena::CreateArray<char>(arena_, new_capacity);
+    if (raw_->size > 0) memcpy(new_data, raw_->data, raw_->size);
+    if (arena_ == NULL) ::operator delete[](raw_->data);
+    raw_->data = new_data;
+    raw_->capacity = new_capacity;
+  }
+  return raw_->data + raw_->size;
+}
+
+void UnknownFieldSet::AppendRawBytes(const void* data, int size) {
+  GOOGLE_DCHECK(fields_ == NULL);
+  memcpy(ReserveRawBytes(size), data, size);
+  raw_->size += size;
+}
+
+bool UnknownFieldSet::ParseRawField(io::CodedInputStream* input, uint32 tag) {
+  GOOGLE_DCHECK(fields_ == NULL);
+  int old_size = raw_fields_size();
+  if (!AppendRawField(input, tag)) {
+    if (raw_ != NULL) raw_->size = old_size;
+    return false;
+  }
+  return true;
+}
+
+// Appends tag and the field that follows it in input to raw_.  The checks
+// mirror those of WireFormat::SkipField(), which is what the field would have
+// gone through had it been stored in fields_.
+bool UnknownFieldSet::AppendRawField(io::CodedInputStream* input, uint32 tag) {
+  typedef internal::WireFormatLite WireFormatLite;
+  // Field number 0 is illegal.
+  if (WireFormatLite::GetTagFieldNumber(tag) == 0) return false;
+
+  // Enough room for a tag (5 bytes) plus a varint (10 bytes), a fixed64 or a
+  // length prefix.
+  static const int kMaxHeaderSize = 15;
+  uint8* target = reinterpret_cast<uint8*>(ReserveRawBytes(kMaxHeaderSize));
+  uint8* start = target;
+  target = io::CodedOutputStream::WriteVarint32ToArray(tag, target);
+
+  switch (WireFormatLite::GetTagWireType(tag)) {
+    case WireFormatLite::WIRETYPE_VARINT: {
+      uint64 value;
+      if (!input->ReadVarint64(&value)) return false;
+      target = io::CodedOutputStream::WriteVarint64ToArray(value, target);
+      raw_->size += target - start;
+      return true;
+    }
+    case WireFormatLite::WIRETYPE_FIXED64: {
+      uint64 value;
+      if (!input->ReadLittleEndian64(&value)) return false;
+      target = io::CodedOutputStream::WriteLittleEndian64ToArray(value, target);
+      raw_->size += target - start;
+      return true;
+    }
+    case WireFormatLite::WIRETYPE_LENGTH_DELIMITED: {
+      uint32 length;
+      if (!input->ReadVarint32(&length)) return false;
+      target = io::CodedOutputStream::WriteVarint32ToArray(length, target);
+      raw_->size += target - start;
+      // Copy straight out of the input buffer.  The length is not trusted, so
+      // the buffer only grows by what has actually been read.
+      while (length > 0) {
+        const void* data;
+        int available;
+        if (!input->GetDirectBufferPointer(&data, &available)) return false;
+        int chunk = static_cast<int>(
+            std::min(static_cast<uint32>(available), length));
+        AppendRawBytes(data, chunk);
+        input->Skip(chunk);
+        length -= chunk;
+      }
+      return true;
+    }
+    case WireFormatLite::WIRETYPE_START_GROUP: {
+      raw_->size += target - start;
+      if (!input->IncrementRecursionDepth()) return false;
+      const uint32 end_tag = WireFormatLite::MakeTag(
+          WireFormatLite::GetTagFieldNumber(tag),
+          WireFormatLite::WIRETYPE_END_GROUP);
+      while (true) {
+        uint32 field_tag = input->ReadTag();
+        if (field_tag == end_tag) break;
+        // End of input, or the end of some other group.
+        if (field_tag == 0 ||
+            WireFormatLite::GetTagWireType(field_tag) ==
+                WireFormatLite::WIRETYPE_END_GROUP) {
+          return false;
+        }
+        if (!AppendRawField(input, field_tag)) return false;
+      }
+      input->DecrementRecursionDepth();
+      target = reinterpret_cast<uint8*>(ReserveRawBytes(5));
+      start = target;
+      target = io::CodedOutputStream::WriteVarint32ToArray(end_tag, target);
+      raw_->size += target - start;
+      return true;
+    }
+    case WireFormatLite::WIRETYPE_END_GROUP: {
+      return false;
+    }
+    case WireFormatLite::WIRETYPE_FIXED32: {
+      uint32 value;
+      if (!input->ReadLittleEndian32(&value)) return false;
+      target = io::CodedOutputStream::WriteLittleEndian32ToArray(value, target);
+      raw_->size += target - start;
+      return true;
+    }
+    default: {
+      return false;
+    }
+  }
+}
+
+// Decodes fields into this set up to and including end_tag, or up to the end
+// of input when end_tag is 0.
+bool UnknownFieldSet::DecodeFields(io::CodedInputStream* input,
+                                   uint32 end_tag) {
+  typedef internal::WireFormatLite WireFormatLite;
+  while (true) {
+    uint32 tag = input->ReadTag();
+    if (tag == end_tag) return true;
+    if (tag == 0) return false;
+    int number = WireFormatLite::GetTagFieldNumber(tag);
+    switch (WireFormatLite::GetTagWireType(tag)) {
+      case WireFormatLite::WIRETYPE_VARINT: {
+        uint64 value;
+        if (!input->ReadVarint64(&value)) return false;
+        AddVarint(number, value);
+        break;
+      }
+      case WireFormatLite::WIRETYPE_FIXED64: {
+        uint64 value;
+        if (!input->ReadLittleEndian64(&value)) return false;
+        AddFixed64(number, value);
+        break;
+      }
+      case WireFormatLite::WIRETYPE_LENGTH_DELIMITED: {
+        uint32 length;
+        if (!input->ReadVarint32(&length)) return false;
+        if (!input->ReadString(AddLengthDelimited(number), length)) {
+          return false;
+        }
+        break;
+      }
+      case WireFormatLite::WIRETYPE_START_GROUP: {
+        if (!AddGroup(number)->DecodeFields(
+                input, WireFormatLite::MakeTag(
+                           number, WireFormatLite::WIRETYPE_END_GROUP))) {
+          return false;
+        }
+        break;
+      }
+      case WireFormatLite::WIRETYPE_FIXED32: {
+        uint32 value;
+        if (!input->ReadLittleEndian32(&value)) return false;
+        AddFixed32(number, value);
+        break;
+      }
+      default: {
+        return false;
+      }
+    }
+  }
+}
+
+const std::vector<UnknownField>& UnknownFieldSet::parsed_raw_fields() const {
+  GOOGLE_DCHECK(has_raw_fields());
+  internal::AtomicWord parsed = internal::Acquire_Load(&raw_->parsed);
+  if (parsed == 0) {
+    UnknownFieldSet decoded;
+    io::CodedInputStream input(reinterpret_cast<const uint8*>(raw_->data),
+                               raw_->size);
+    bool ok = decoded.DecodeFields(&input, 0);
+    GOOGLE_DCHECK(ok && decoded.fields_ != NULL);
+    (void)ok;
+    internal::AtomicWord fields =
+        reinterpret_cast<internal::AtomicWord>(decoded.fields_);
+    decoded.fields_ = NULL;
+    if (internal::Release_CompareAndSwap(&raw_->parsed, 0, fields) == 0) {
+      parsed = fields;
+    } else {
+      // Another thread got there first.
+      DeleteFields(reinterpret_cast<std::vector<UnknownField>*>(fields));
+      parsed = internal::Acquire_Load(&raw_->parsed);
+    }
+  }
+  return *reinterpret_cast<const std::vector<UnknownField>*>(parsed);
+}
+
+void UnknownFieldSet::ConvertRawFields() {
+  GOOGLE_DCHECK(has_raw_fields() && fields_ == NULL);
+  parsed_raw_fields();
+  fields_ = reinterpret_cast<std::vector<UnknownField>*>(raw_->parsed);
+  raw_->parsed = 0;
+  raw_->size = 0;
+}
+
 bool UnknownFieldSet::MergeFromCodedStream(io::CodedInputStream* input) {
   UnknownFieldSet other;
   if (internal::WireFormat::SkipMessage(input, &other) &&
@@ -41,6 +41,7 @@
 #include <assert.h>
 #include <string>
 #include <vector>
+#include <google/protobuf/stubs/atomicops.h>
 #include <google/protobuf/stubs/common.h>
 #include <google/protobuf/stubs/logging.h>
 #include <google/protobuf/generated_message_util.h>
@@ -59,6 +60,7 @@ namespace protobuf {
                                     // extension_set_heavy.cc
   }
 
+class Arena;                        // arena.h
 class Message;                      // message.h
 class UnknownField;                 // below
 
@@ -83,7 +85,7 @@ class LIBPROTOBUF_EXPORT UnknownFieldSet {
   inline void Clear();
 
   // Remove all fields and deallocate internal data objects
-  void ClearAndFreeMemory();
+  inline void ClearAndFreeMemory();
 
   // Is this set empty?
   inline bool empty() const;
@@ -166,10 +168,52 @@ class LIBPROTOBUF_EXPORT UnknownFieldSet {
  private:
   // For InternalMergeFrom
   friend class UnknownField;
+  // For InternalSetArena
+  friend class internal::InternalMetadataWithArena;
+  // For ParseRawField and raw_fields_data
+  friend class internal::WireFormat;
+
+  // Unknown fields in wire format.  While fields_ is NULL,
+  // WireFormat::SkipField() appends every skipped field here instead of
+  // decoding it, so a message that is parsed and serialized again (e.g. by a
+  // proxy) copies its unknown fields as a single block of bytes.  field() and
+  // field_count() decode the bytes into 'parsed' on first use; any mutation
+  // moves the decoded fields into fields_ and empties the buffer.
+  struct RawFields {
+    char* data;
+    int size;
+    int capacity;
+    // A const std::vector<UnknownField>* decoded from data, or 0.  Published
+    // with a compare-and-swap so that concurrent const readers are safe.
+    mutable internal::AtomicWord parsed;
+  };
+
   // Merges from other UnknownFieldSet. This method assumes, that this object
   // is newly created and has fields_ == NULL;
   void InternalMergeFrom(const UnknownFieldSet& other);
   void ClearFallback();
+  void SwapFallback(UnknownFieldSet* other);
+  void FreeRawFields();
+
+  // Sets the arena which owns this set; raw field data is then allocated on
+  // it.  Must be called while the set is still empty.
+  void InternalSetArena(Arena* arena) { arena_ = arena; }
+
+  // Raw field support; see RawFields above.
+  inline bool has_raw_fields() const;
+  inline const char* raw_fields_data() const;
+  inline int raw_fields_size() const;
+  // Reads the field whose tag has just been read from input and appends it to
+  // the raw buffer.  Only valid while fields_ is NULL.
+  bool ParseRawField(io::CodedInputStream* input, uint32 tag);
+  bool AppendRawField(io::CodedInputStream* input, uint32 tag);
+  void AppendRawBytes(const void* data, int size);
+  char* ReserveRawBytes(int size);
+  const std::vector<UnknownField>& parsed_raw_fields() const;
+  // Moves the raw fields into fields_, decoding them if necessary.
+  void ConvertRawFields();
+  bool DecodeFields(io::CodedInputStream* input, uint32 end_tag);
+  static void DeleteFields(std::vector<UnknownField>* fields);
 
   // fields_ is either NULL, or a pointer to a vector that is *non-empty*. We
   // never hold the empty vector because we want the 'do we have any unknown
@@ -178,6 +222,10 @@ class LIBPROTOBUF_EXPORT UnknownFieldSet {
   // variable hot in the cache, without the need to go touch a vector somewhere
   // else in memory.
   std::vector<UnknownField>* fields_;
+  // Invariant: fields_ is NULL whenever raw_ holds any bytes.  raw_ itself is
+  // kept across Clear() so that its buffer can be reused.
+  RawFields* raw_;
+  Arena* arena_;
   GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(UnknownFieldSet);
 };
 
@@ -256,38 +304,68 @@ class LIBPROTOBUF_EXPORT UnknownField {
 // ===================================================================
 // inline implementations
 
-inline UnknownFieldSet::UnknownFieldSet() : fields_(NULL) {}
+inline UnknownFieldSet::UnknownFieldSet()
+    : fields_(NULL), raw_(NULL), arena_(NULL) {}
 
-inline UnknownFieldSet::~UnknownFieldSet() { Clear(); }
+inline UnknownFieldSet::~UnknownFieldSet() { ClearAndFreeMemory(); }
 
-inline void UnknownFieldSet::ClearAndFreeMemory() { Clear(); }
+inline void UnknownFieldSet::ClearAndFreeMemory() {
+  Clear();
+  if (raw_ != NULL) {
+    FreeRawFields();
+  }
+}
 
 inline void UnknownFieldSet::Clear() {
-  if (fields_ != NULL) {
+  if (fields_ != NULL || has_raw_fields()) {
     ClearFallback();
   }
 }
 
 inline bool UnknownFieldSet::empty() const {
   // Invariant: fields_ is never empty if present.
-  return !fields_;
+  return !fields_ && !has_raw_fields();
 }
 
 inline void UnknownFieldSet::Swap(UnknownFieldSet* x) {
-  std::swap(fields_, x->fields_);
+  if (arena_ == x->arena_) {
+    std::swap(fields_, x->fields_);
+    std::swap(raw_, x->raw_);
+  } else {
+    SwapFallback(x);
+  }
 }
 
 inline int UnknownFieldSet::field_count() const {
+  if (GOOGLE_PREDICT_FALSE(has_raw_fields())) {
+    return static_cast<int>(parsed_raw_fields().size());
+  }
   return fields_ ? static_cast<int>(fields_->size()) : 0;
 }
 inline const UnknownField& UnknownFieldSet::field(int index) const {
+  if (GOOGLE_PREDICT_FALSE(has_raw_fields())) {
+    return parsed_raw_fields()[index];
+  }
   GOOGLE_DCHECK(fields_ != NULL);
   return (*fields_)[index];
 }
 inline UnknownField* UnknownFieldSet::mutable_field(int index) {
+  if (GOOGLE_PREDICT_FALSE(has_raw_fields())) {
+    ConvertRawFields();
+  }
   return &(*fields_)[index];
 }
 
+inline bool UnknownFieldSet::has_raw_fields() const {
+  return raw_ != NULL && raw_->size > 0;
+}
+inline const char* UnknownFieldSet::raw_fields_data() const {
+  return raw_->data;
+}
+inline int UnknownFieldSet::raw_fields_size() const {
+  return raw_ != NULL ? raw_->size : 0;
+}
+
 inline void UnknownFieldSet::AddLengthDelimited(
     int number, const string& value) {
   AddLengthDelimited(number)->assign(value);
@@ -36,6 +36,7 @@
 // tests handling of unknown fields throughout the system.
 
 #include <google/protobuf/unknown_field_set.h>
+#include <google/protobuf/arena.h>
 #include <google/protobuf/descriptor.h>
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/io/zero_copy_stream_impl.h>
@@ -604,6 +605,65 @@ TEST_F(UnknownFieldSetTest, DeleteByNumber) {
                       MAKE_VECTOR(kExpectedFieldNumbers5));
 }
 #undef MAKE_VECTOR
+
+TEST_F(UnknownFieldSetTest, PassThrough) {
+  const string data = all_fields_data_ + string("\xf8\x7f\x01", 3);
+  unittest::TestEmptyMessage message;
+  ASSERT_TRUE(message.ParseFromString(data));
+  EXPECT_EQ(data, message.SerializeAsString());
+  EXPECT_EQ(static_cast<int>(data.size()), message.ByteSize());
+
+  // Reading the fields decodes them without changing the set.
+  const UnknownFieldSet& unknown_fields = message.unknown_fields();
+  ASSERT_EQ(unknown_fields_->field_count() + 1, unknown_fields.field_count());
+  const UnknownField& last =
+      unknown_fields.field(unknown_fields.field_count() - 1);
+  EXPECT_EQ(2047, last.number());
+  EXPECT_EQ(1, last.varint());
+  EXPECT_EQ(data, message.SerializeAsString());
+
+  // Mutating the set keeps the decoded fields, in order.
+  message.mutable_unknown_fields()->AddVarint(1, 2);
+  EXPECT_EQ(unknown_fields_->field_count() + 2, unknown_fields.field_count());
+  EXPECT_EQ(2047, unknown_fields.field(unknown_fields.field_count() - 2)
+                      .number());
+  EXPECT_EQ(all_fields_data_ + string("\xf8\x7f\x01\x08\x02", 5),
+            message.SerializeAsString());
+}
+
+TEST_F(UnknownFieldSetTest, Arena) {
+  Arena arena;
+  unittest::TestEmptyMessage* message =
+      Arena::CreateMessage<unittest::TestEmptyMessage>(&arena);
+  ASSERT_TRUE(message->ParseFromString(all_fields_data_));
+  EXPECT_EQ(all_fields_data_, message->SerializeAsString());
+  ASSERT_EQ(unknown_fields_->field_count(),
+            message->unknown_fields().field_count());
+
+  // Merge in both directions between the arena and the heap.
+  unittest::TestEmptyMessage heap_message;
+  heap_message.MergeFrom(*message);
+  message->MergeFrom(heap_message);
+  EXPECT_EQ(all_fields_data_ + all_fields_data_, message->SerializeAsString());
+
+  // Swapping across arenas copies the fields.
+  message->mutable_unknown_fields()->Swap(
+      heap_message.mutable_unknown_fields());
+  EXPECT_EQ(all_fields_data_, message->SerializeAsString());
+  EXPECT_EQ(all_fields_data_ + all_fields_data_,
+            heap_message.SerializeAsString());
+
+  // A cleared set reuses its buffer.
+  message->Clear();
+  EXPECT_TRUE(message->unknown_fields().empty());
+  ASSERT_TRUE(message->ParseFromString(all_fields_data_));
+  EXPECT_EQ(all_fields_data_, message->SerializeAsString());
+  message->mutable_unknown_fields()->DeleteByNumber(
+      unknown_fields_->field(0).number());
+  EXPECT_EQ(unknown_fields_->field_count() - 1,
+            message->unknown_fields().field_count());
+}
+
 }  // namespace
 
 }  // namespace protobuf
@@ -69,6 +69,19 @@ DefaultValueObjectWriter::DefaultValueObjectWriter(
       field_scrub_callback_(NULL),
       ow_(ow) {}
 
+DefaultValueObjectWriter::DefaultValueObjectWriter(
+    const TypeInfo* typeinfo, const google::protobuf::Type& type,
+    ObjectWriter* ow)
+    : typeinfo_(typeinfo),
+      own_typeinfo_(false),
+      type_(type),
+      current_(NULL),
+      root_(NULL),
+      suppress_empty_list_(false),
+      preserve_proto_field_names_(false),
+      field_scrub_callback_(NULL),
+      ow_(ow) {}
+
 DefaultValueObjectWriter::~DefaultValueObjectWriter() {
   for (int i = 0; i < string_values_.size(); ++i) {
     delete string_values_[i];
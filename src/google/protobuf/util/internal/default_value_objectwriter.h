@@ -83,6 +83,12 @@ class LIBPROTOBUF_EXPORT DefaultValueObjectWriter : public ObjectWriter {
                            const google::protobuf::Type& type,
                            ObjectWriter* ow);
 
+  // Like the constructor above but looks up types through a TypeInfo, which
+  // must outlive this object.
+  DefaultValueObjectWriter(const TypeInfo* typeinfo,
+                           const google::protobuf::Type& type,
+                           ObjectWriter* ow);
+
   virtual ~DefaultValueObjectWriter();
 
   // ObjectWriter methods.
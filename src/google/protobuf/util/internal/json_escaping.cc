@@ -30,6 +30,17 @@
 
 #include <google/protobuf/util/internal/json_escaping.h>
 
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define GOOGLE_PROTOBUF_JSON_ESCAPING_SSE2
+#if defined(__AVX2__)
+#define GOOGLE_PROTOBUF_JSON_ESCAPING_AVX2
+#include <immintrin.h>
+#else
+#include <emmintrin.h>
+#endif
+#endif
+
 #include <google/protobuf/stubs/logging.h>
 #include <google/protobuf/stubs/common.h>
 
@@ -84,6 +95,60 @@ static const char kCommonEscapes[160][7] = {
   "\\u009c", "\\u009d", "\\u009e", "\\u009f"
 };
 
+// Returns true if the given byte is a whole code point that is output as is.
+inline bool IsUnescapedAscii(char c) {
+  const uint8 u = static_cast<uint8>(c);
+  return u >= 0x20 && u < 0x7f && kCommonEscapes[u][0] == '\0';
+}
+
+// Returns the lowest index whose bit is set in the non-zero mask.
+inline int FirstSetBit(uint32 mask) {
+  return Bits::Log2FloorNonZero(mask & (~mask + 1));
+}
+
+// Returns the length of the longest prefix of [begin, end) made of bytes for
+// which IsUnescapedAscii() is true. Text is mostly plain ASCII, so runs of it
+// are skipped a vector at a time rather than decoded code point by code point.
+int UnescapedAsciiPrefixLength(const char* begin, const char* end) {
+  const char* p = begin;
+#ifdef GOOGLE_PROTOBUF_JSON_ESCAPING_AVX2
+  // Bytes below 0x20 and non-ASCII bytes are the ones less than 0x20 as
+  // signed chars.
+  const __m256i space256 = _mm256_set1_epi8(0x20);
+  for (; end - p >= 32; p += 32) {
+    const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+    const __m256i special = _mm256_or_si256(
+        _mm256_or_si256(_mm256_cmpgt_epi8(space256, v),
+                        _mm256_cmpeq_epi8(v, _mm256_set1_epi8(0x7f))),
+        _mm256_or_si256(
+            _mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('"')),
+                            _mm256_cmpeq_epi8(v, _mm256_set1_epi8('\\'))),
+            _mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('<')),
+                            _mm256_cmpeq_epi8(v, _mm256_set1_epi8('>')))));
+    const uint32 mask = _mm256_movemask_epi8(special);
+    if (mask != 0) return p - begin + FirstSetBit(mask);
+  }
+#endif
+#ifdef GOOGLE_PROTOBUF_JSON_ESCAPING_SSE2
+  const __m128i space = _mm_set1_epi8(0x20);
+  for (; end - p >= 16; p += 16) {
+    const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    const __m128i special = _mm_or_si128(
+        _mm_or_si128(_mm_cmplt_epi8(v, space),
+                     _mm_cmpeq_epi8(v, _mm_set1_epi8(0x7f))),
+        _mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('"')),
+                         _mm_cmpeq_epi8(v, _mm_set1_epi8('\\'))),
+            _mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('<')),
+                         _mm_cmpeq_epi8(v, _mm_set1_epi8('>')))));
+    const uint32 mask = _mm_movemask_epi8(special);
+    if (mask != 0) return p - begin + FirstSetBit(mask);
+  }
+#endif
+  while (p < end && IsUnescapedAscii(*p)) ++p;
+  return p - begin;
+}
+
 // Determines if the given char value is a unicode surrogate code unit (either
 // high-surrogate or low-surrogate).
 inline bool IsSurrogate(uint32 c) {
@@ -316,8 +381,8 @@ void JsonEscaping::Escape(strings::ByteSource* input,
     StringPiece str = input->Peek();
     StringPiece escaped;
     int i = 0;
-    int num_read;
-    bool ok;
+    int num_read = 0;
+    bool ok = true;
     bool cp_was_split = num_left > 0;
     // Loop until we encounter either
     //   i) a code point that needs to be escaped; or
@@ -325,6 +390,11 @@ void JsonEscaping::Escape(strings::ByteSource* input,
     // iii) a character that is not a valid utf8; or
     //  iv) end of the StringPiece str is reached.
     do {
+      if (num_left == 0) {
+        i += UnescapedAsciiPrefixLength(str.data() + i,
+                                        str.data() + str.length());
+        if (i == str.length()) break;  // case iv
+      }
       ok = ReadCodePoint(str, i, &cp, &num_left, &num_read);
       if (num_left > 0 || !ok) break;  // case iii or iv
       escaped = EscapeCodePoint(cp, buffer, cp_was_split);
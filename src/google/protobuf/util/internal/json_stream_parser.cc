@@ -30,6 +30,17 @@
 
 #include <google/protobuf/util/internal/json_stream_parser.h>
 
+#if defined(__SSE2__) || defined(_M_X64) || \
+    (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define GOOGLE_PROTOBUF_JSON_PARSER_SSE2
+#if defined(__AVX2__)
+#define GOOGLE_PROTOBUF_JSON_PARSER_AVX2
+#include <immintrin.h>
+#else
+#include <emmintrin.h>
+#endif
+#endif
+
 #include <algorithm>
 #include <cctype>
 #include <cerrno>
@@ -97,6 +108,69 @@ static bool MatchKey(StringPiece input) {
   return !input.empty() && IsLetter(input[0]);
 }
 
+// Returns the lowest index whose bit is set in the non-zero mask.
+inline int FirstSetBit(uint32 mask) {
+  return Bits::Log2FloorNonZero(mask & (~mask + 1));
+}
+
+// Returns the length of the longest prefix of [begin, end) made of ASCII
+// characters other than quotes and backslashes, which a string parse just
+// steps over. Such runs are skipped a vector at a time.
+static int PlainStringPrefixLength(const char* begin, const char* end) {
+  const char* p = begin;
+#ifdef GOOGLE_PROTOBUF_JSON_PARSER_AVX2
+  for (; end - p >= 32; p += 32) {
+    const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(p));
+    const __m256i special = _mm256_or_si256(
+        _mm256_or_si256(_mm256_cmpeq_epi8(v, _mm256_set1_epi8('"')),
+                        _mm256_cmpeq_epi8(v, _mm256_set1_epi8('\''))),
+        _mm256_cmpeq_epi8(v, _mm256_set1_epi8('\\')));
+    // Non-ASCII bytes have their high bit set already.
+    const uint32 mask = _mm256_movemask_epi8(_mm256_or_si256(special, v));
+    if (mask != 0) return p - begin + FirstSetBit(mask);
+  }
+#endif
+#ifdef GOOGLE_PROTOBUF_JSON_PARSER_SSE2
+  for (; end - p >= 16; p += 16) {
+    const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    const __m128i special =
+        _mm_or_si128(_mm_or_si128(_mm_cmpeq_epi8(v, _mm_set1_epi8('"')),
+                                  _mm_cmpeq_epi8(v, _mm_set1_epi8('\''))),
+                     _mm_cmpeq_epi8(v, _mm_set1_epi8('\\')));
+    const uint32 mask = _mm_movemask_epi8(_mm_or_si128(special, v));
+    if (mask != 0) return p - begin + FirstSetBit(mask);
+  }
+#endif
+  while (p < end && static_cast<uint8>(*p) < 0x80 && *p != '"' &&
+         *p != '\'' && *p != '\\') {
+    ++p;
+  }
+  return p - begin;
+}
+
+// Returns the length of the longest prefix of [begin, end) for which
+// ascii_isspace() is true. Only the indentation of pretty-printed input is
+// long enough to be worth skipping a vector at a time.
+static int WhitespacePrefixLength(const char* begin, const char* end) {
+  const char* p = begin;
+  if (p == end || !ascii_isspace(*p)) return 0;
+#ifdef GOOGLE_PROTOBUF_JSON_PARSER_SSE2
+  for (; end - p >= 16; p += 16) {
+    const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(p));
+    // '\t', '\n', '\v', '\f' and '\r' are 9 to 13.
+    const __m128i control = _mm_cmpeq_epi8(
+        _mm_subs_epu8(_mm_sub_epi8(v, _mm_set1_epi8('\t')), _mm_set1_epi8(4)),
+        _mm_setzero_si128());
+    const __m128i space =
+        _mm_or_si128(control, _mm_cmpeq_epi8(v, _mm_set1_epi8(' ')));
+    const uint32 mask = ~_mm_movemask_epi8(space) & 0xffff;
+    if (mask != 0) return p - begin + FirstSetBit(mask);
+  }
+#endif
+  while (p < end && ascii_isspace(*p)) ++p;
+  return p - begin;
+}
+
 JsonStreamParser::JsonStreamParser(ObjectWriter* ow)
     : ow_(ow),
       stack_(),
@@ -319,6 +393,9 @@ util::Status JsonStreamParser::ParseStringHelper() {
   // Track where we last copied data from so we can minimize copying.
   const char* last = p_.data();
   while (!p_.empty()) {
+    p_.remove_prefix(
+        PlainStringPrefixLength(p_.data(), p_.data() + p_.size()));
+    if (p_.empty()) break;
     const char* data = p_.data();
     if (*data == '\\') {
       // We're about to handle an escape, copy all bytes from last to data.
@@ -768,9 +845,7 @@ util::Status JsonStreamParser::ReportUnknown(StringPiece message) {
 }
 
 void JsonStreamParser::SkipWhitespace() {
-  while (!p_.empty() && ascii_isspace(*p_.data())) {
-    Advance();
-  }
+  p_.remove_prefix(WhitespacePrefixLength(p_.data(), p_.data() + p_.size()));
 }
 
 void JsonStreamParser::Advance() {
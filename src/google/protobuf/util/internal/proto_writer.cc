@@ -263,11 +263,21 @@ inline Status WriteString(int field_number, const DataPiece& data,
   return s.status();
 }
 
-// Writes an ENUM field, including tag, to the stream.
+// Writes an ENUM field, including tag, to the stream. Names are looked up
+// through the TypeInfo first; DataPiece::ToEnum() handles the rest.
 inline Status WriteEnum(int field_number, const DataPiece& data,
+                        const TypeInfo* typeinfo,
                         const google::protobuf::Enum* enum_type,
                         CodedOutputStream* stream,
                         bool use_lower_camel_for_enums) {
+  if (data.type() == DataPiece::TYPE_STRING) {
+    const google::protobuf::EnumValue* value =
+        typeinfo->FindEnumValueByName(enum_type, data.str());
+    if (value != NULL) {
+      WireFormatLite::WriteEnum(field_number, value->number(), stream);
+      return Status();
+    }
+  }
   StatusOr<int> e = data.ToEnum(enum_type, use_lower_camel_for_enums);
   if (e.ok()) {
     WireFormatLite::WriteEnum(field_number, e.ValueOrDie(), stream);
@@ -663,7 +673,7 @@ ProtoWriter* ProtoWriter::RenderPrimitiveField(
       break;
     }
     case google::protobuf::Field_Kind_TYPE_ENUM: {
-      status = WriteEnum(field.number(), data,
+      status = WriteEnum(field.number(), data, typeinfo_,
                          typeinfo_->GetEnumByTypeUrl(field.type_url()),
                          stream_.get(), use_lower_camel_for_enums_);
       break;
@@ -73,20 +73,9 @@ namespace {
 
 static int kDefaultMaxRecursionDepth = 64;
 
-// Finds a field with the given number. NULL if none found.
-const google::protobuf::Field* FindFieldByNumber(
-    const google::protobuf::Type& type, int number);
-
 // Returns true if the field is packable.
 bool IsPackable(const google::protobuf::Field& field);
 
-// Finds an enum value with the given number. NULL if none found.
-const google::protobuf::EnumValue* FindEnumValueByNumber(
-    const google::protobuf::Enum& tech_enum, int number);
-
-// Utility function to format nanos.
-const string FormatNanos(uint32 nanos, bool with_trailing_zeros);
-
 StatusOr<string> MapKeyDefaultValueAsString(
     const google::protobuf::Field& field) {
   switch (field.kind()) {
@@ -160,7 +149,8 @@ Status ProtoStreamObjectSource::NamedWriteTo(StringPiece name,
 const google::protobuf::Field* ProtoStreamObjectSource::FindAndVerifyField(
     const google::protobuf::Type& type, uint32 tag) const {
   // Lookup the new field in the type by tag number.
-  const google::protobuf::Field* field = FindFieldByNumber(type, tag >> 3);
+  const google::protobuf::Field* field =
+      typeinfo_->FindFieldByNumber(&type, tag >> 3);
   // Verify if the field corresponds to the wire type in tag.
   // If there is any discrepancy, mark the field as not found.
   if (field != NULL) {
@@ -291,7 +281,7 @@ StatusOr<uint32> ProtoStreamObjectSource::RenderMap(
         if (map_key.empty()) {
           // An absent map key is treated as the default.
           const google::protobuf::Field* key_field =
-              FindFieldByNumber(*field_type, 1);
+              typeinfo_->FindFieldByNumber(field_type, 1);
           if (key_field == NULL) {
             // The Type info for this map entry is incorrect. It should always
             // have a field named "key" and with field number 1.
@@ -881,7 +871,7 @@ Status ProtoStreamObjectSource::RenderNonMessageField(
       // are printed as integers.
       if (en != NULL) {
         const google::protobuf::EnumValue* enum_value =
-            FindEnumValueByNumber(*en, buffer32);
+            typeinfo_->FindEnumValueByNumber(en, buffer32);
         if (enum_value != NULL) {
           if (use_lower_camel_for_enums_)
             ow->RenderString(field_name, ToCamelCase(enum_value->name()));
@@ -1007,7 +997,7 @@ const string ProtoStreamObjectSource::ReadFieldValueAsString(
       // Lookup the name of the enum, and render that. Skips unknown enums.
       if (en != NULL) {
         const google::protobuf::EnumValue* enum_value =
-            FindEnumValueByNumber(*en, buffer32);
+            typeinfo_->FindEnumValueByNumber(en, buffer32);
         if (enum_value != NULL) {
           result = enum_value->name();
         }
@@ -1083,17 +1073,6 @@ Status ProtoStreamObjectSource::IncrementRecursionDepth(
 }
 
 namespace {
-// TODO(skarvaje): Speed this up by not doing a linear scan.
-const google::protobuf::Field* FindFieldByNumber(
-    const google::protobuf::Type& type, int number) {
-  for (int i = 0; i < type.fields_size(); ++i) {
-    if (type.fields(i).number() == number) {
-      return &type.fields(i);
-    }
-  }
-  return NULL;
-}
-
 // TODO(skarvaje): Replace FieldDescriptor by implementing IsTypePackable()
 // using tech Field.
 bool IsPackable(const google::protobuf::Field& field) {
@@ -1102,33 +1081,6 @@ bool IsPackable(const google::protobuf::Field& field) {
          google::protobuf::FieldDescriptor::IsTypePackable(
              static_cast<google::protobuf::FieldDescriptor::Type>(field.kind()));
 }
-
-// TODO(skarvaje): Speed this up by not doing a linear scan.
-const google::protobuf::EnumValue* FindEnumValueByNumber(
-    const google::protobuf::Enum& tech_enum, int number) {
-  for (int i = 0; i < tech_enum.enumvalue_size(); ++i) {
-    const google::protobuf::EnumValue& ev = tech_enum.enumvalue(i);
-    if (ev.number() == number) {
-      return &ev;
-    }
-  }
-  return NULL;
-}
-
-// TODO(skarvaje): Look into optimizing this by not doing computation on
-// double.
-const string FormatNanos(uint32 nanos, bool with_trailing_zeros) {
-  if (nanos == 0) {
-    return with_trailing_zeros ? ".000" : "";
-  }
-
-  const char* format =
-      (nanos % 1000 != 0) ? "%.9f" : (nanos % 1000000 != 0) ? "%.6f" : "%.3f";
-  string formatted =
-      StringPrintf(format, static_cast<double>(nanos) / kNanosPerSecond);
-  // remove the leading 0 before decimal.
-  return formatted.substr(1);
-}
 }  // namespace
 
 }  // namespace converter
@@ -89,95 +89,6 @@ ProtoStreamObjectWriter::~ProtoStreamObjectWriter() {
   }
 }
 
-namespace {
-// Utility method to split a string representation of Timestamp or Duration and
-// return the parts.
-void SplitSecondsAndNanos(StringPiece input, StringPiece* seconds,
-                          StringPiece* nanos) {
-  size_t idx = input.rfind('.');
-  if (idx != string::npos) {
-    *seconds = input.substr(0, idx);
-    *nanos = input.substr(idx + 1);
-  } else {
-    *seconds = input;
-    *nanos = StringPiece();
-  }
-}
-
-Status GetNanosFromStringPiece(StringPiece s_nanos,
-                               const char* parse_failure_message,
-                               const char* exceeded_limit_message,
-                               int32* nanos) {
-  *nanos = 0;
-
-  // Count the number of leading 0s and consume them.
-  int num_leading_zeros = 0;
-  while (s_nanos.Consume("0")) {
-    num_leading_zeros++;
-  }
-  int32 i_nanos = 0;
-  // 's_nanos' contains fractional seconds -- i.e. 'nanos' is equal to
-  // "0." + s_nanos.ToString() seconds. An int32 is used for the
-  // conversion to 'nanos', rather than a double, so that there is no
-  // loss of precision.
-  if (!s_nanos.empty() && !safe_strto32(s_nanos.ToString(), &i_nanos)) {
-    return Status(INVALID_ARGUMENT, parse_failure_message);
-  }
-  if (i_nanos > kNanosPerSecond || i_nanos < 0) {
-    return Status(INVALID_ARGUMENT, exceeded_limit_message);
-  }
-  // s_nanos should only have digits. No whitespace.
-  if (s_nanos.find_first_not_of("0123456789") != StringPiece::npos) {
-    return Status(INVALID_ARGUMENT, parse_failure_message);
-  }
-
-  if (i_nanos > 0) {
-    // 'scale' is the number of digits to the right of the decimal
-    // point in "0." + s_nanos.ToString()
-    int32 scale = num_leading_zeros + s_nanos.size();
-    // 'conversion' converts i_nanos into nanoseconds.
-    // conversion = kNanosPerSecond / static_cast<int32>(std::pow(10, scale))
-    // For efficiency, we precompute the conversion factor.
-    int32 conversion = 0;
-    switch (scale) {
-      case 1:
-        conversion = 100000000;
-        break;
-      case 2:
-        conversion = 10000000;
-        break;
-      case 3:
-        conversion = 1000000;
-        break;
-      case 4:
-        conversion = 100000;
-        break;
-      case 5:
-        conversion = 10000;
-        break;
-      case 6:
-        conversion = 1000;
-        break;
-      case 7:
-        conversion = 100;
-        break;
-      case 8:
-        conversion = 10;
-        break;
-      case 9:
-        conversion = 1;
-        break;
-      default:
-        return Status(INVALID_ARGUMENT, exceeded_limit_message);
-    }
-    *nanos = i_nanos * conversion;
-  }
-
-  return Status();
-}
-
-}  // namespace
-
 ProtoStreamObjectWriter::AnyWriter::AnyWriter(ProtoStreamObjectWriter* parent)
     : parent_(parent),
       ow_(),
@@ -975,41 +886,10 @@ Status ProtoStreamObjectWriter::RenderDuration(ProtoStreamObjectWriter* ow,
                          data.ValueAsStringOrDefault("")));
   }
 
-  StringPiece value(data.str());
-
-  if (!value.ends_with("s")) {
-    return Status(INVALID_ARGUMENT,
-                  "Illegal duration format; duration must end with 's'");
-  }
-  value = value.substr(0, value.size() - 1);
-  int sign = 1;
-  if (value.starts_with("-")) {
-    sign = -1;
-    value = value.substr(1);
-  }
-
-  StringPiece s_secs, s_nanos;
-  SplitSecondsAndNanos(value, &s_secs, &s_nanos);
-  uint64 unsigned_seconds;
-  if (!safe_strtou64(s_secs, &unsigned_seconds)) {
-    return Status(INVALID_ARGUMENT,
-                  "Invalid duration format, failed to parse seconds");
-  }
-
-  int32 nanos = 0;
-  Status nanos_status = GetNanosFromStringPiece(
-      s_nanos, "Invalid duration format, failed to parse nano seconds",
-      "Duration value exceeds limits", &nanos);
-  if (!nanos_status.ok()) {
-    return nanos_status;
-  }
-  nanos = sign * nanos;
-
-  int64 seconds = sign * unsigned_seconds;
-  if (seconds > kDurationMaxSeconds || seconds < kDurationMinSeconds ||
-      nanos <= -kNanosPerSecond || nanos >= kNanosPerSecond) {
-    return Status(INVALID_ARGUMENT, "Duration value exceeds limits");
-  }
+  int64 seconds;
+  int32 nanos;
+  Status status = ParseDuration(data.str(), &seconds, &nanos);
+  if (!status.ok()) return status;
 
   ow->ProtoWriter::RenderDataPiece("seconds", DataPiece(seconds));
   ow->ProtoWriter::RenderDataPiece("nanos", DataPiece(nanos));
@@ -66,6 +66,7 @@ namespace util {
 namespace converter {
 
 class ObjectLocationTracker;
+class ReflectionObjectWriter;
 
 // An ObjectWriter that can write protobuf bytes directly from writer events.
 // This class supports all special types like Struct and Map. It uses
@@ -312,6 +313,8 @@ class LIBPROTOBUF_EXPORT ProtoStreamObjectWriter : public ProtoWriter {
     GOOGLE_DISALLOW_IMPLICIT_CONSTRUCTORS(Item);
   };
 
+  // Shares the caller's TypeInfo; used for nested values written by AnyWriter
+  // and by ReflectionObjectWriter.
   ProtoStreamObjectWriter(const TypeInfo* typeinfo,
                           const google::protobuf::Type& type,
                           strings::ByteSink* output, ErrorListener* listener);
@@ -397,6 +400,8 @@ class LIBPROTOBUF_EXPORT ProtoStreamObjectWriter : public ProtoWriter {
   // Reference to the options that control this class's behavior.
   const ProtoStreamObjectWriter::Options options_;
 
+  friend class ReflectionObjectWriter;
+
   GOOGLE_DISALLOW_IMPLICIT_CONSTRUCTORS(ProtoStreamObjectWriter);
 };
 
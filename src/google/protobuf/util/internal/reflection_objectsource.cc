@@ -0,0 +1,677 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// https://developers.google.com/protocol-buffers/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include <google/protobuf/util/internal/reflection_objectsource.h>
+
+#include <memory>
+#ifndef _SHARED_PTR_H
+#include <google/protobuf/stubs/shared_ptr.h>
+#endif
+#include <utility>
+#include <vector>
+
+#include <google/protobuf/stubs/common.h>
+#include <google/protobuf/stubs/stringprintf.h>
+#include <google/protobuf/stubs/time.h>
+#include <google/protobuf/any.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/dynamic_message.h>
+#include <google/protobuf/map_field.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/util/internal/field_mask_utility.h>
+#include <google/protobuf/util/internal/constants.h>
+#include <google/protobuf/util/internal/utility.h>
+#include <google/protobuf/stubs/strutil.h>
+#include <google/protobuf/stubs/map_util.h>
+#include <google/protobuf/stubs/status_macros.h>
+
+
+namespace google {
+namespace protobuf {
+namespace util {
+using util::Status;
+namespace converter {
+
+using google::protobuf::Descriptor;
+using google::protobuf::EnumValueDescriptor;
+using google::protobuf::FieldDescriptor;
+
+namespace {
+
+static int kDefaultMaxRecursionDepth = 64;
+
+// Returns the string form of a map key, as used for the JSON object name.
+string MapKeyAsString(const MapKey& key) {
+  switch (key.type()) {
+    case FieldDescriptor::CPPTYPE_BOOL:
+      return key.GetBoolValue() ? "true" : "false";
+    case FieldDescriptor::CPPTYPE_INT32:
+      return SimpleItoa(key.GetInt32Value());
+    case FieldDescriptor::CPPTYPE_INT64:
+      return SimpleItoa(key.GetInt64Value());
+    case FieldDescriptor::CPPTYPE_UINT32:
+      return SimpleItoa(key.GetUInt32Value());
+    case FieldDescriptor::CPPTYPE_UINT64:
+      return SimpleItoa(key.GetUInt64Value());
+    case FieldDescriptor::CPPTYPE_STRING:
+      return key.GetStringValue();
+    default:
+      return string();
+  }
+}
+
+// Reads the seconds and nanos fields of a google.protobuf.Timestamp or
+// google.protobuf.Duration message.
+std::pair<int64, int32> GetSecondsAndNanos(const Message& message) {
+  const Descriptor* descriptor = message.GetDescriptor();
+  const Reflection* reflection = message.GetReflection();
+  // 'seconds' has field number of 1 and 'nanos' has field number 2
+  // //google/protobuf/timestamp.proto & duration.proto
+  const FieldDescriptor* seconds_field = descriptor->FindFieldByNumber(1);
+  const FieldDescriptor* nanos_field = descriptor->FindFieldByNumber(2);
+  int64 seconds = seconds_field != NULL
+                      ? reflection->GetInt64(message, seconds_field)
+                      : 0;
+  int32 nanos =
+      nanos_field != NULL ? reflection->GetInt32(message, nanos_field) : 0;
+  return std::pair<int64, int32>(seconds, nanos);
+}
+}  // namespace
+
+
+ReflectionObjectSource::ReflectionObjectSource(const Message& message)
+    : message_(message),
+      use_lower_camel_for_enums_(false),
+      use_ints_for_enums_(false),
+      preserve_proto_field_names_(false),
+      recursion_depth_(0),
+      max_recursion_depth_(kDefaultMaxRecursionDepth) {}
+
+ReflectionObjectSource::~ReflectionObjectSource() {}
+
+Status ReflectionObjectSource::NamedWriteTo(StringPiece name,
+                                            ObjectWriter* ow) const {
+  return WriteMessage(message_, name, true, ow);
+}
+
+Status ReflectionObjectSource::WriteMessage(const Message& message,
+                                            StringPiece name,
+                                            bool include_start_and_end,
+                                            ObjectWriter* ow) const {
+  const TypeRenderer* type_renderer =
+      FindTypeRenderer(message.GetDescriptor()->full_name());
+  if (type_renderer != NULL) {
+    return (*type_renderer)(this, message, name, ow);
+  }
+
+  // ListFields() returns the present fields ordered by field number, which
+  // is the order they appear in on the wire.
+  std::vector<const FieldDescriptor*> fields;
+  message.GetReflection()->ListFields(message, &fields);
+
+  if (include_start_and_end) {
+    ow->StartObject(name);
+  }
+  for (int i = 0; i < fields.size(); ++i) {
+    const FieldDescriptor* field = fields[i];
+    // Extensions are not part of the message's type information, so they are
+    // skipped like any other unknown field.
+    if (field->is_extension()) continue;
+    const string& field_name =
+        preserve_proto_field_names_ ? field->name() : field->json_name();
+    if (field->is_map()) {
+      ow->StartObject(field_name);
+      RETURN_IF_ERROR(RenderMap(message, field, ow));
+      ow->EndObject();
+    } else if (field->is_repeated()) {
+      RETURN_IF_ERROR(RenderList(message, field, field_name, ow));
+    } else {
+      RETURN_IF_ERROR(RenderField(message, field, -1, field_name, ow));
+    }
+  }
+  if (include_start_and_end) {
+    ow->EndObject();
+  }
+  return util::Status();
+}
+
+Status ReflectionObjectSource::RenderMessage(const Message& message,
+                                             StringPiece name,
+                                             ObjectWriter* ow) const {
+  // Short-circuit any special type rendering to save call-stack space.
+  const string& type_name = message.GetDescriptor()->full_name();
+  const TypeRenderer* type_renderer = FindTypeRenderer(type_name);
+  if (type_renderer != NULL) {
+    return (*type_renderer)(this, message, name, ow);
+  }
+  RETURN_IF_ERROR(IncrementRecursionDepth(type_name, name));
+  RETURN_IF_ERROR(WriteMessage(message, name, true, ow));
+  --recursion_depth_;
+  return util::Status();
+}
+
+Status ReflectionObjectSource::RenderList(const Message& message,
+                                          const FieldDescriptor* field,
+                                          StringPiece name,
+                                          ObjectWriter* ow) const {
+  int size = message.GetReflection()->FieldSize(message, field);
+  ow->StartList(name);
+  for (int i = 0; i < size; ++i) {
+    RETURN_IF_ERROR(RenderField(message, field, i, "", ow));
+  }
+  ow->EndList();
+  return util::Status();
+}
+
+Status ReflectionObjectSource::RenderMap(const Message& message,
+                                         const FieldDescriptor* field,
+                                         ObjectWriter* ow) const {
+  const Reflection* reflection = message.GetReflection();
+  // Map values are field number 2 of the map entry.
+  const FieldDescriptor* value_field =
+      field->message_type()->FindFieldByNumber(2);
+  if (value_field == NULL) {
+    return Status(util::error::INTERNAL, "Invalid map entry.");
+  }
+
+  // Iterating the map brings it up to date with the repeated field view first,
+  // and visits the entries in the same order as the generated serializer.
+  Message* mutable_message = const_cast<Message*>(&message);
+  MapIterator end = reflection->MapEnd(mutable_message, field);
+  for (MapIterator it = reflection->MapBegin(mutable_message, field);
+       it != end; ++it) {
+    string map_key = MapKeyAsString(it.GetKey());
+    if (map_key.empty()) {
+      // Key is empty, force it to render as empty (for string values).
+      ow->empty_name_ok_for_next_key();
+    }
+    RETURN_IF_ERROR(RenderMapValue(value_field, it.GetValueRef(), map_key, ow));
+  }
+  return util::Status();
+}
+
+Status ReflectionObjectSource::RenderField(const Message& message,
+                                           const FieldDescriptor* field,
+                                           int index, StringPiece name,
+                                           ObjectWriter* ow) const {
+  const Reflection* reflection = message.GetReflection();
+  switch (field->cpp_type()) {
+    case FieldDescriptor::CPPTYPE_BOOL: {
+      ow->RenderBool(name, index < 0 ? reflection->GetBool(message, field)
+                                     : reflection->GetRepeatedBool(
+                                           message, field, index));
+      break;
+    }
+    case FieldDescriptor::CPPTYPE_INT32: {
+      ow->RenderInt32(name, index < 0 ? reflection->GetInt32(message, field)
+                                      : reflection->GetRepeatedInt32(
+                                            message, field, index));
+      break;
+    }
+    case FieldDescriptor::CPPTYPE_INT64: {
+      ow->RenderInt64(name, index < 0 ? reflection->GetInt64(message, field)
+                                      : reflection->GetRepeatedInt64(
+                                            message, field, index));
+      break;
+    }
+    case FieldDescriptor::CPPTYPE_UINT32: {
+      ow->RenderUint32(name, index < 0 ? reflection->GetUInt32(message, field)
+                                       : reflection->GetRepeatedUInt32(
+                                             message, field, index));
+      break;
+    }
+    case FieldDescriptor::CPPTYPE_UINT64: {
+      ow->RenderUint64(name, index < 0 ? reflection->GetUInt64(message, field)
+                                       : reflection->GetRepeatedUInt64(
+                                             message, field, index));
+      break;
+    }
+    case FieldDescriptor::CPPTYPE_FLOAT: {
+      ow->RenderFloat(name, index < 0 ? reflection->GetFloat(message, field)
+                                      : reflection->GetRepeatedFloat(
+                                            message, field, index));
+      break;
+    }
+    case FieldDescriptor::CPPTYPE_DOUBLE: {
+      ow->RenderDouble(name, index < 0 ? reflection->GetDouble(message, field)
+                                       : reflection->GetRepeatedDouble(
+                                             message, field, index));
+      break;
+    }
+    case FieldDescriptor::CPPTYPE_ENUM: {
+      RenderEnum(field,
+                 index < 0
+                     ? reflection->GetEnumValue(message, field)
+                     : reflection->GetRepeatedEnumValue(message, field, index),
+                 name, ow);
+      break;
+    }
+    case FieldDescriptor::CPPTYPE_STRING: {
+      string scratch;
+      const string& value =
+          index < 0
+              ? reflection->GetStringReference(message, field, &scratch)
+              : reflection->GetRepeatedStringReference(message, field, index,
+                                                       &scratch);
+      if (field->type() == FieldDescriptor::TYPE_BYTES) {
+        ow->RenderBytes(name, value);
+      } else {
+        ow->RenderString(name, value);
+      }
+      break;
+    }
+    case FieldDescriptor::CPPTYPE_MESSAGE: {
+      return RenderMessage(
+          index < 0 ? reflection->GetMessage(message, field)
+                    : reflection->GetRepeatedMessage(message, field, index),
+          name, ow);
+    }
+    default:
+      break;
+  }
+  return util::Status();
+}
+
+Status ReflectionObjectSource::RenderMapValue(const FieldDescriptor* field,
+                                              const MapValueRef& value,
+                                              StringPiece name,
+                                              ObjectWriter* ow) const {
+  switch (field->cpp_type()) {
+    case FieldDescriptor::CPPTYPE_BOOL:
+      ow->RenderBool(name, value.GetBoolValue());
+      break;
+    case FieldDescriptor::CPPTYPE_INT32:
+      ow->RenderInt32(name, value.GetInt32Value());
+      break;
+    case FieldDescriptor::CPPTYPE_INT64:
+      ow->RenderInt64(name, value.GetInt64Value());
+      break;
+    case FieldDescriptor::CPPTYPE_UINT32:
+      ow->RenderUint32(name, value.GetUInt32Value());
+      break;
+    case FieldDescriptor::CPPTYPE_UINT64:
+      ow->RenderUint64(name, value.GetUInt64Value());
+      break;
+    case FieldDescriptor::CPPTYPE_FLOAT:
+      ow->RenderFloat(name, value.GetFloatValue());
+      break;
+    case FieldDescriptor::CPPTYPE_DOUBLE:
+      ow->RenderDouble(name, value.GetDoubleValue());
+      break;
+    case FieldDescriptor::CPPTYPE_ENUM:
+      RenderEnum(field, value.GetEnumValue(), name, ow);
+      break;
+    case FieldDescriptor::CPPTYPE_STRING:
+      if (field->type() == FieldDescriptor::TYPE_BYTES) {
+        ow->RenderBytes(name, value.GetStringValue());
+      } else {
+        ow->RenderString(name, value.GetStringValue());
+      }
+      break;
+    case FieldDescriptor::CPPTYPE_MESSAGE:
+      return RenderMessage(value.GetMessageValue(), name, ow);
+    default:
+      break;
+  }
+  return util::Status();
+}
+
+void ReflectionObjectSource::RenderEnum(const FieldDescriptor* field,
+                                        int value, StringPiece name,
+                                        ObjectWriter* ow) const {
+  // If the field represents an explicit NULL value, render null.
+  if (field->enum_type()->full_name() == "google.protobuf.NullValue") {
+    ow->RenderNull(name);
+    return;
+  }
+
+  // No need to lookup enum value if we need to render int.
+  if (use_ints_for_enums_) {
+    ow->RenderInt32(name, value);
+    return;
+  }
+
+  // Lookup the name of the enum, and render that. Unknown enum values are
+  // printed as integers.
+  const EnumValueDescriptor* enum_value =
+      field->enum_type()->FindValueByNumber(value);
+  if (enum_value == NULL) {
+    ow->RenderInt32(name, value);
+  } else if (use_lower_camel_for_enums_) {
+    ow->RenderString(name, ToCamelCase(enum_value->name()));
+  } else {
+    ow->RenderString(name, enum_value->name());
+  }
+}
+
+Status ReflectionObjectSource::RenderTimestamp(const ReflectionObjectSource* os,
+                                               const Message& message,
+                                               StringPiece field_name,
+                                               ObjectWriter* ow) {
+  std::pair<int64, int32> p = GetSecondsAndNanos(message);
+  int64 seconds = p.first;
+  int32 nanos = p.second;
+  if (seconds > kTimestampMaxSeconds || seconds < kTimestampMinSeconds) {
+    return Status(
+        util::error::INTERNAL,
+        StrCat("Timestamp seconds exceeds limit for field: ", field_name));
+  }
+
+  if (nanos < 0 || nanos >= kNanosPerSecond) {
+    return Status(
+        util::error::INTERNAL,
+        StrCat("Timestamp nanos exceeds limit for field: ", field_name));
+  }
+
+  ow->RenderString(field_name,
+                   ::google::protobuf::internal::FormatTime(seconds, nanos));
+
+  return util::Status();
+}
+
+Status ReflectionObjectSource::RenderDuration(const ReflectionObjectSource* os,
+                                              const Message& message,
+                                              StringPiece field_name,
+                                              ObjectWriter* ow) {
+  std::pair<int64, int32> p = GetSecondsAndNanos(message);
+  int64 seconds = p.first;
+  int32 nanos = p.second;
+  if (seconds > kDurationMaxSeconds || seconds < kDurationMinSeconds) {
+    return Status(
+        util::error::INTERNAL,
+        StrCat("Duration seconds exceeds limit for field: ", field_name));
+  }
+
+  if (nanos <= -kNanosPerSecond || nanos >= kNanosPerSecond) {
+    return Status(
+        util::error::INTERNAL,
+        StrCat("Duration nanos exceeds limit for field: ", field_name));
+  }
+
+  string sign = "";
+  if (seconds < 0) {
+    if (nanos > 0) {
+      return Status(util::error::INTERNAL,
+                    StrCat("Duration nanos is non-negative, but seconds is "
+                           "negative for field: ",
+                           field_name));
+    }
+    sign = "-";
+    seconds = -seconds;
+    nanos = -nanos;
+  } else if (seconds == 0 && nanos < 0) {
+    sign = "-";
+    nanos = -nanos;
+  }
+  string formatted_duration =
+      StringPrintf("%s%lld%ss", sign.c_str(), seconds,
+                   FormatNanos(nanos, false).c_str());
+  ow->RenderString(field_name, formatted_duration);
+  return util::Status();
+}
+
+Status ReflectionObjectSource::RenderWrapper(const ReflectionObjectSource* os,
+                                             const Message& message,
+                                             StringPiece field_name,
+                                             ObjectWriter* ow) {
+  // All wrappers hold their value in field number 1. An unset value renders
+  // as the default, the same as an absent field on the wire.
+  const FieldDescriptor* field = message.GetDescriptor()->FindFieldByNumber(1);
+  if (field == NULL) {
+    return Status(util::error::INTERNAL, "Invalid wrapper message.");
+  }
+  return os->RenderField(message, field, -1, field_name, ow);
+}
+
+Status ReflectionObjectSource::RenderStruct(const ReflectionObjectSource* os,
+                                            const Message& message,
+                                            StringPiece field_name,
+                                            ObjectWriter* ow) {
+  std::vector<const FieldDescriptor*> fields;
+  message.GetReflection()->ListFields(message, &fields);
+  ow->StartObject(field_name);
+  for (int i = 0; i < fields.size(); ++i) {
+    // google.protobuf.Struct has only one field that is a map. Hence we use
+    // RenderMap to render that field.
+    if (fields[i]->is_map()) {
+      RETURN_IF_ERROR(os->RenderMap(message, fields[i], ow));
+    }
+  }
+  ow->EndObject();
+  return util::Status();
+}
+
+Status ReflectionObjectSource::RenderStructValue(
+    const ReflectionObjectSource* os, const Message& message,
+    StringPiece field_name, ObjectWriter* ow) {
+  std::vector<const FieldDescriptor*> fields;
+  message.GetReflection()->ListFields(message, &fields);
+  for (int i = 0; i < fields.size(); ++i) {
+    if (fields[i]->is_extension()) continue;
+    RETURN_IF_ERROR(os->RenderField(message, fields[i], -1, field_name, ow));
+  }
+  return util::Status();
+}
+
+Status ReflectionObjectSource::RenderStructListValue(
+    const ReflectionObjectSource* os, const Message& message,
+    StringPiece field_name, ObjectWriter* ow) {
+  std::vector<const FieldDescriptor*> fields;
+  message.GetReflection()->ListFields(message, &fields);
+
+  // Render empty list when we find empty ListValue message.
+  if (fields.empty()) {
+    ow->StartList(field_name);
+    ow->EndList();
+    return util::Status();
+  }
+
+  for (int i = 0; i < fields.size(); ++i) {
+    if (fields[i]->is_extension()) continue;
+    RETURN_IF_ERROR(os->RenderList(message, fields[i], field_name, ow));
+  }
+  return util::Status();
+}
+
+Status ReflectionObjectSource::RenderAny(const ReflectionObjectSource* os,
+                                         const Message& message,
+                                         StringPiece field_name,
+                                         ObjectWriter* ow) {
+  // An Any is of the form { string type_url = 1; bytes value = 2; }
+  const Descriptor* descriptor = message.GetDescriptor();
+  const Reflection* reflection = message.GetReflection();
+  const FieldDescriptor* type_url_field = descriptor->FindFieldByNumber(1);
+  const FieldDescriptor* value_field = descriptor->FindFieldByNumber(2);
+  if (type_url_field == NULL || value_field == NULL) {
+    return Status(util::error::INTERNAL, "Invalid Any message.");
+  }
+  string type_url_scratch;
+  string value_scratch;
+  const string& type_url = reflection->GetStringReference(
+      message, type_url_field, &type_url_scratch);
+  const string& value =
+      reflection->GetStringReference(message, value_field, &value_scratch);
+
+  // If there is no value, we don't lookup the type, we just output it (if
+  // present). If both type and value are empty we output an empty object.
+  if (value.empty()) {
+    ow->StartObject(field_name);
+    if (!type_url.empty()) {
+      ow->RenderString("@type", type_url);
+    }
+    ow->EndObject();
+    return util::Status();
+  }
+
+  // If there is a value but no type, we cannot render it, so report an error.
+  if (type_url.empty()) {
+    return util::Status(util::error::INTERNAL,
+                        "Invalid Any, the type_url is missing.");
+  }
+
+  // The payload type is looked up in the pool of the message being rendered,
+  // which is the pool a TypeResolver would have been built from.
+  string full_type_name;
+  const Descriptor* nested_descriptor = NULL;
+  const DescriptorPool* pool = os->message_.GetDescriptor()->file()->pool();
+  if (::google::protobuf::internal::ParseAnyTypeUrl(type_url, &full_type_name)) {
+    nested_descriptor = pool->FindMessageTypeByName(full_type_name);
+  }
+  if (nested_descriptor == NULL) {
+    return util::Status(util::error::INTERNAL,
+                        "Invalid type URL, unknown type: " + type_url);
+  }
+
+  // Prefer the factory the rendered message came from; it knows generated
+  // types and owns the prototypes of dynamic ones.
+  google::protobuf::scoped_ptr<DynamicMessageFactory> dynamic_factory;
+  const Message* prototype =
+      os->message_.GetReflection()->GetMessageFactory()->GetPrototype(
+          nested_descriptor);
+  if (prototype == NULL) {
+    dynamic_factory.reset(new DynamicMessageFactory(pool));
+    prototype = dynamic_factory->GetPrototype(nested_descriptor);
+  }
+  google::protobuf::scoped_ptr<Message> nested(prototype->New());
+  if (!nested->ParsePartialFromString(value)) {
+    return util::Status(util::error::INVALID_ARGUMENT,
+                        "Nested protocol message not parsed in its entirety.");
+  }
+
+  // We know the type so we can render it. Recursively render the nested
+  // message using a nested ReflectionObjectSource.
+  ReflectionObjectSource nested_os(*nested);
+
+  // We manually call start and end object here so we can inject the @type.
+  ow->StartObject(field_name);
+  ow->RenderString("@type", type_url);
+  util::Status result = nested_os.WriteMessage(*nested, "value", false, ow);
+  ow->EndObject();
+  return result;
+}
+
+Status ReflectionObjectSource::RenderFieldMask(
+    const ReflectionObjectSource* os, const Message& message,
+    StringPiece field_name, ObjectWriter* ow) {
+  std::vector<const FieldDescriptor*> fields;
+  message.GetReflection()->ListFields(message, &fields);
+  string combined;
+  for (int i = 0; i < fields.size(); ++i) {
+    const FieldDescriptor* field = fields[i];
+    if (field->number() != 1 || field->name() != "paths" ||
+        field->cpp_type() != FieldDescriptor::CPPTYPE_STRING ||
+        !field->is_repeated()) {
+      return util::Status(util::error::INTERNAL,
+                          "Invalid FieldMask, unexpected field.");
+    }
+    const Reflection* reflection = message.GetReflection();
+    int size = reflection->FieldSize(message, field);
+    string scratch;
+    for (int j = 0; j < size; ++j) {
+      if (!combined.empty()) {
+        combined.append(",");
+      }
+      combined.append(ConvertFieldMaskPath(
+          reflection->GetRepeatedStringReference(message, field, j, &scratch),
+          &ToCamelCase));
+    }
+  }
+  ow->RenderString(field_name, combined);
+  return util::Status();
+}
+
+
+hash_map<string, ReflectionObjectSource::TypeRenderer>*
+    ReflectionObjectSource::renderers_ = NULL;
+GOOGLE_PROTOBUF_DECLARE_ONCE(reflection_source_renderers_init_);
+
+void ReflectionObjectSource::InitRendererMap() {
+  renderers_ = new hash_map<string, ReflectionObjectSource::TypeRenderer>();
+  (*renderers_)["google.protobuf.Timestamp"] =
+      &ReflectionObjectSource::RenderTimestamp;
+  (*renderers_)["google.protobuf.Duration"] =
+      &ReflectionObjectSource::RenderDuration;
+  (*renderers_)["google.protobuf.DoubleValue"] =
+      &ReflectionObjectSource::RenderWrapper;
+  (*renderers_)["google.protobuf.FloatValue"] =
+      &ReflectionObjectSource::RenderWrapper;
+  (*renderers_)["google.protobuf.Int64Value"] =
+      &ReflectionObjectSource::RenderWrapper;
+  (*renderers_)["google.protobuf.UInt64Value"] =
+      &ReflectionObjectSource::RenderWrapper;
+  (*renderers_)["google.protobuf.Int32Value"] =
+      &ReflectionObjectSource::RenderWrapper;
+  (*renderers_)["google.protobuf.UInt32Value"] =
+      &ReflectionObjectSource::RenderWrapper;
+  (*renderers_)["google.protobuf.BoolValue"] =
+      &ReflectionObjectSource::RenderWrapper;
+  (*renderers_)["google.protobuf.StringValue"] =
+      &ReflectionObjectSource::RenderWrapper;
+  (*renderers_)["google.protobuf.BytesValue"] =
+      &ReflectionObjectSource::RenderWrapper;
+  (*renderers_)["google.protobuf.Any"] = &ReflectionObjectSource::RenderAny;
+  (*renderers_)["google.protobuf.Struct"] =
+      &ReflectionObjectSource::RenderStruct;
+  (*renderers_)["google.protobuf.Value"] =
+      &ReflectionObjectSource::RenderStructValue;
+  (*renderers_)["google.protobuf.ListValue"] =
+      &ReflectionObjectSource::RenderStructListValue;
+  (*renderers_)["google.protobuf.FieldMask"] =
+      &ReflectionObjectSource::RenderFieldMask;
+  ::google::protobuf::internal::OnShutdown(&DeleteRendererMap);
+}
+
+void ReflectionObjectSource::DeleteRendererMap() {
+  delete ReflectionObjectSource::renderers_;
+  renderers_ = NULL;
+}
+
+// static
+ReflectionObjectSource::TypeRenderer*
+ReflectionObjectSource::FindTypeRenderer(const string& type_name) {
+  ::google::protobuf::GoogleOnceInit(&reflection_source_renderers_init_,
+                                     &InitRendererMap);
+  return FindOrNull(*renderers_, type_name);
+}
+
+Status ReflectionObjectSource::IncrementRecursionDepth(
+    StringPiece type_name, StringPiece field_name) const {
+  if (++recursion_depth_ > max_recursion_depth_) {
+    return Status(
+        util::error::INVALID_ARGUMENT,
+        StrCat("Message too deep. Max recursion depth reached for type '",
+               type_name, "', field '", field_name, "'"));
+  }
+  return util::Status();
+}
+
+}  // namespace converter
+}  // namespace util
+}  // namespace protobuf
+}  // namespace google
@@ -0,0 +1,402 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// https://developers.google.com/protocol-buffers/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+#include <google/protobuf/util/internal/reflection_objectsource.h>
+
+#include <memory>
+#ifndef _SHARED_PTR_H
+#include <google/protobuf/stubs/shared_ptr.h>
+#endif
+
+#include <google/protobuf/any.pb.h>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/io/zero_copy_stream_impl_lite.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/util/internal/json_objectwriter.h>
+#include <google/protobuf/util/internal/protostream_objectsource.h>
+#include <google/protobuf/util/internal/testdata/books.pb.h>
+#include <google/protobuf/util/internal/testdata/maps.pb.h>
+#include <google/protobuf/util/internal/constants.h>
+#include <google/protobuf/util/json_format_proto3.pb.h>
+#include <google/protobuf/util/type_resolver.h>
+#include <google/protobuf/util/type_resolver_util.h>
+#include <google/protobuf/stubs/strutil.h>
+#include <gtest/gtest.h>
+
+
+namespace google {
+namespace protobuf {
+namespace util {
+namespace converter {
+
+using google::protobuf::DescriptorPool;
+using google::protobuf::Message;
+using google::protobuf::io::ArrayInputStream;
+using google::protobuf::io::CodedInputStream;
+using google::protobuf::io::CodedOutputStream;
+using google::protobuf::io::StringOutputStream;
+using google::protobuf::testing::Author;
+using google::protobuf::testing::Book;
+using google::protobuf::testing::Cyclic;
+using google::protobuf::testing::MapOut;
+using proto3::TestAny;
+using proto3::TestDuration;
+using proto3::TestFieldMask;
+using proto3::TestListValue;
+using proto3::TestMap;
+using proto3::TestMessage;
+using proto3::TestOneof;
+using proto3::TestStruct;
+using proto3::TestTimestamp;
+using proto3::TestValue;
+using proto3::TestWrapper;
+using util::Status;
+
+// ReflectionObjectSource must produce the same output as rendering the
+// serialized message with ProtoStreamObjectSource, so each test renders both
+// ways and compares the JSON.
+class ReflectionObjectSourceTest : public ::testing::Test {
+ protected:
+  ReflectionObjectSourceTest()
+      : resolver_(NewTypeResolverForDescriptorPool(
+            kTypeServiceBaseUrl, DescriptorPool::generated_pool())),
+        use_lower_camel_for_enums_(false),
+        use_ints_for_enums_(false),
+        preserve_proto_field_names_(false) {}
+
+  Status RenderWithReflection(const Message& message, string* json) {
+    ReflectionObjectSource os(message);
+    os.set_use_lower_camel_for_enums(use_lower_camel_for_enums_);
+    os.set_use_ints_for_enums(use_ints_for_enums_);
+    os.set_preserve_proto_field_names(preserve_proto_field_names_);
+    StringOutputStream output_stream(json);
+    CodedOutputStream out_stream(&output_stream);
+    JsonObjectWriter ow("", &out_stream);
+    return os.WriteTo(&ow);
+  }
+
+  Status RenderFromBinary(const Message& message, string* json) {
+    google::protobuf::Type type;
+    Status status = resolver_->ResolveMessageType(
+        StrCat(kTypeServiceBaseUrl, "/",
+               message.GetDescriptor()->full_name()),
+        &type);
+    if (!status.ok()) return status;
+    string binary = message.SerializePartialAsString();
+    ArrayInputStream arr_stream(binary.data(), binary.size());
+    CodedInputStream in_stream(&arr_stream);
+    ProtoStreamObjectSource os(&in_stream, resolver_.get(), type);
+    os.set_use_lower_camel_for_enums(use_lower_camel_for_enums_);
+    os.set_use_ints_for_enums(use_ints_for_enums_);
+    os.set_preserve_proto_field_names(preserve_proto_field_names_);
+    StringOutputStream output_stream(json);
+    CodedOutputStream out_stream(&output_stream);
+    JsonObjectWriter ow("", &out_stream);
+    return os.WriteTo(&ow);
+  }
+
+  // Returns the JSON rendered through reflection after checking that it
+  // matches the binary rendering.
+  string DoTest(const Message& message) {
+    string expected;
+    string actual;
+    EXPECT_TRUE(RenderFromBinary(message, &expected).ok());
+    EXPECT_TRUE(RenderWithReflection(message, &actual).ok());
+    EXPECT_EQ(expected, actual);
+    return actual;
+  }
+
+  google::protobuf::scoped_ptr<TypeResolver> resolver_;
+  bool use_lower_camel_for_enums_;
+  bool use_ints_for_enums_;
+  bool preserve_proto_field_names_;
+};
+
+TEST_F(ReflectionObjectSourceTest, Proto3Primitives) {
+  TestMessage m;
+  m.set_bool_value(true);
+  m.set_int32_value(-32);
+  m.set_int64_value(-64);
+  m.set_uint32_value(32);
+  m.set_uint64_value(GOOGLE_ULONGLONG(18446744073709551615));
+  m.set_float_value(1.5f);
+  m.set_double_value(-2.25);
+  m.set_string_value("str\"\n\xE2\x82\xAC");
+  m.set_bytes_value("\x00\xff\x01", 3);
+  m.set_enum_value(proto3::BAR);
+  m.mutable_message_value()->set_value(7);
+  m.add_repeated_int32_value(1);
+  m.add_repeated_int32_value(-2);
+  m.add_repeated_string_value("a");
+  m.add_repeated_string_value("");
+  m.add_repeated_enum_value(proto3::FOO);
+  m.add_repeated_enum_value(static_cast<proto3::EnumType>(12));
+  m.add_repeated_message_value()->set_value(1);
+  m.add_repeated_message_value();
+  DoTest(m);
+  DoTest(TestMessage());
+}
+
+TEST_F(ReflectionObjectSourceTest, Proto2FieldsAndOptions) {
+  Book book;
+  book.set_title("My Book");
+  book.set_length(340);
+  book.set_published(1234567890);
+  book.set_type(Book::ACTION_AND_ADVENTURE);
+  book.mutable_publisher()->set_name("Publisher");
+  Author* author = book.mutable_author();
+  author->set_id(12345);
+  author->set_name("Jane Austen");
+  author->add_pseudonym("A Lady");
+  author->set_alive(false);
+  author->add_friend_()->set_name("Cassandra");
+  Book::Label* label = book.add_labels();
+  label->set_key("key");
+  label->set_value("value");
+  EXPECT_EQ(
+      "{\"title\":\"My Book\",\"author\":{\"@id\":\"12345\",\"name\":\"Jane "
+      "Austen\",\"pseudonym\":[\"A Lady\"],\"alive\":false,\"friend\":[{"
+      "\"name\":\"Cassandra\"}]},\"length\":340,\"published\":\"1234567890\","
+      "\"publisher\":{\"name\":\"Publisher\"},\"labels\":[{\"key\":\"key\","
+      "\"value\":\"value\"}],\"type\":\"ACTION_AND_ADVENTURE\"}",
+      DoTest(book));
+
+  use_lower_camel_for_enums_ = true;
+  DoTest(book);
+  use_ints_for_enums_ = true;
+  DoTest(book);
+  preserve_proto_field_names_ = true;
+  DoTest(book);
+}
+
+TEST_F(ReflectionObjectSourceTest, Oneof) {
+  TestOneof m;
+  m.set_oneof_int32_value(0);
+  DoTest(m);
+  m.set_oneof_enum_value(proto3::FOO);
+  DoTest(m);
+  m.mutable_oneof_message_value();
+  DoTest(m);
+}
+
+TEST_F(ReflectionObjectSourceTest, Maps) {
+  TestMap m;
+  (*m.mutable_bool_map())[true] = 1;
+  (*m.mutable_bool_map())[false] = 2;
+  (*m.mutable_int32_map())[-1] = 3;
+  (*m.mutable_int64_map())[GOOGLE_LONGLONG(-9223372036854775807)] = 4;
+  (*m.mutable_uint32_map())[4294967295U] = 5;
+  (*m.mutable_uint64_map())[GOOGLE_ULONGLONG(18446744073709551615)] = 6;
+  (*m.mutable_string_map())["one"] = 7;
+  (*m.mutable_string_map())[""] = 8;
+  DoTest(m);
+
+  MapOut out;
+  (*out.mutable_map1())["k"].set_foo("bar");
+  (*(*out.mutable_map2())["nested"].mutable_map3())[1] = "one";
+  (*out.mutable_map4())[false] = "no";
+  out.set_bar("baz");
+  DoTest(out);
+}
+
+TEST_F(ReflectionObjectSourceTest, MapsModifiedThroughReflection) {
+  // Adding an entry through the repeated field view leaves the map itself out
+  // of date until it is next read.
+  TestMap m;
+  (*m.mutable_int32_map())[1] = 1;
+  const Reflection* reflection = m.GetReflection();
+  const FieldDescriptor* field =
+      m.GetDescriptor()->FindFieldByName("int32_map");
+  Message* entry = reflection->AddMessage(&m, field);
+  entry->GetReflection()->SetInt32(
+      entry, entry->GetDescriptor()->FindFieldByNumber(1), 2);
+  entry->GetReflection()->SetInt32(
+      entry, entry->GetDescriptor()->FindFieldByNumber(2), 20);
+
+  string actual;
+  EXPECT_TRUE(RenderWithReflection(m, &actual).ok());
+  string expected;
+  EXPECT_TRUE(RenderFromBinary(m, &expected).ok());
+  EXPECT_EQ(expected, actual);
+  EXPECT_EQ(2, m.int32_map().size());
+}
+
+TEST_F(ReflectionObjectSourceTest, Wrappers) {
+  TestWrapper m;
+  m.mutable_bool_value()->set_value(true);
+  m.mutable_int32_value();
+  m.mutable_int64_value()->set_value(-1);
+  m.mutable_uint64_value()->set_value(1);
+  m.mutable_float_value()->set_value(0.5f);
+  m.mutable_double_value();
+  m.mutable_string_value()->set_value("s");
+  m.mutable_bytes_value()->set_value("b");
+  m.add_repeated_uint32_value()->set_value(3);
+  m.add_repeated_uint32_value();
+  EXPECT_EQ(
+      "{\"boolValue\":true,\"int32Value\":0,\"int64Value\":\"-1\","
+      "\"uint64Value\":\"1\",\"floatValue\":0.5,\"doubleValue\":0,"
+      "\"stringValue\":\"s\",\"bytesValue\":\"Yg==\","
+      "\"repeatedUint32Value\":[3,0]}",
+      DoTest(m));
+}
+
+TEST_F(ReflectionObjectSourceTest, TimestampAndDuration) {
+  TestTimestamp timestamp;
+  timestamp.mutable_value()->set_seconds(1);
+  timestamp.mutable_value()->set_nanos(10000000);
+  timestamp.add_repeated_value();
+  EXPECT_EQ(
+      "{\"value\":\"1970-01-01T00:00:01.010Z\","
+      "\"repeatedValue\":[\"1970-01-01T00:00:00Z\"]}",
+      DoTest(timestamp));
+
+  TestDuration duration;
+  duration.mutable_value()->set_seconds(-3);
+  duration.mutable_value()->set_nanos(-100);
+  duration.add_repeated_value()->set_nanos(-5000);
+  EXPECT_EQ("{\"value\":\"-3.000000100s\",\"repeatedValue\":[\"-0.000005s\"]}",
+            DoTest(duration));
+
+  string json;
+  timestamp.mutable_value()->set_seconds(kTimestampMaxSeconds + 1);
+  Status status = RenderWithReflection(timestamp, &json);
+  EXPECT_EQ(util::error::INTERNAL, status.error_code());
+  EXPECT_EQ("Timestamp seconds exceeds limit for field: value",
+            status.error_message());
+
+  duration.mutable_value()->set_seconds(-1);
+  duration.mutable_value()->set_nanos(1);
+  status = RenderWithReflection(duration, &json);
+  EXPECT_EQ(util::error::INTERNAL, status.error_code());
+}
+
+TEST_F(ReflectionObjectSourceTest, StructValueAndListValue) {
+  TestStruct s;
+  google::protobuf::Struct* value = s.mutable_value();
+  (*value->mutable_fields())["null"].set_null_value(
+      google::protobuf::NULL_VALUE);
+  (*value->mutable_fields())["number"].set_number_value(1.5);
+  (*value->mutable_fields())["string"].set_string_value("s");
+  (*value->mutable_fields())["bool"].set_bool_value(false);
+  google::protobuf::ListValue* list =
+      (*value->mutable_fields())["list"].mutable_list_value();
+  list->add_values()->set_number_value(1);
+  list->add_values()->mutable_struct_value();
+  list->add_values()->mutable_list_value();
+  (*(*value->mutable_fields())["nested"].mutable_struct_value()
+        ->mutable_fields())["k"]
+      .set_string_value("v");
+  s.add_repeated_value();
+  DoTest(s);
+
+  TestValue v;
+  v.mutable_value()->set_string_value("single");
+  v.add_repeated_value()->set_number_value(2);
+  DoTest(v);
+
+  TestListValue l;
+  l.mutable_value();
+  l.add_repeated_value()->add_values()->set_bool_value(true);
+  EXPECT_EQ("{\"value\":[],\"repeatedValue\":[[true]]}", DoTest(l));
+}
+
+TEST_F(ReflectionObjectSourceTest, Any) {
+  TestAny m;
+  TestMessage payload;
+  payload.set_int32_value(5);
+  payload.mutable_message_value()->set_value(6);
+  m.mutable_value()->PackFrom(payload);
+
+  google::protobuf::Duration duration;
+  duration.set_seconds(2);
+  m.add_repeated_value()->PackFrom(duration);
+  m.add_repeated_value()->set_type_url(
+      "type.googleapis.com/google.protobuf.Duration");
+  m.add_repeated_value();
+
+  google::protobuf::Any nested;
+  nested.PackFrom(payload);
+  m.add_repeated_value()->PackFrom(nested);
+  EXPECT_EQ(
+      "{\"value\":{\"@type\":\"type.googleapis.com/proto3.TestMessage\","
+      "\"int32Value\":5,\"messageValue\":{\"value\":6}},"
+      "\"repeatedValue\":[{\"@type\":\"type.googleapis.com/"
+      "google.protobuf.Duration\",\"value\":\"2s\"},{\"@type\":"
+      "\"type.googleapis.com/google.protobuf.Duration\"},{},{\"@type\":"
+      "\"type.googleapis.com/google.protobuf.Any\",\"value\":{\"@type\":"
+      "\"type.googleapis.com/proto3.TestMessage\",\"int32Value\":5,"
+      "\"messageValue\":{\"value\":6}}}]}",
+      DoTest(m));
+
+  string json;
+  m.mutable_value()->set_type_url("type.googleapis.com/proto3.NoSuchType");
+  Status status = RenderWithReflection(m, &json);
+  EXPECT_EQ(util::error::INTERNAL, status.error_code());
+
+  m.mutable_value()->set_type_url("");
+  status = RenderWithReflection(m, &json);
+  EXPECT_EQ(util::error::INTERNAL, status.error_code());
+  EXPECT_EQ("Invalid Any, the type_url is missing.", status.error_message());
+}
+
+TEST_F(ReflectionObjectSourceTest, FieldMask) {
+  TestFieldMask m;
+  m.mutable_value()->add_paths("foo_bar");
+  m.mutable_value()->add_paths("baz.qux_quux");
+  EXPECT_EQ("{\"value\":\"fooBar,baz.quxQuux\"}", DoTest(m));
+}
+
+TEST_F(ReflectionObjectSourceTest, RecursionDepth) {
+  Cyclic cyclic;
+  Cyclic* current = &cyclic;
+  for (int i = 0; i < 3; ++i) {
+    current->set_m_int(i);
+    current = current->mutable_m_cyclic();
+  }
+  DoTest(cyclic);
+
+  ReflectionObjectSource os(cyclic);
+  os.set_max_recursion_depth(2);
+  string json;
+  StringOutputStream output_stream(&json);
+  CodedOutputStream out_stream(&output_stream);
+  JsonObjectWriter ow("", &out_stream);
+  Status status = os.WriteTo(&ow);
+  EXPECT_EQ(util::error::INVALID_ARGUMENT, status.error_code());
+  EXPECT_EQ(
+      "Message too deep. Max recursion depth reached for type "
+      "'google.protobuf.testing.Cyclic', field 'mCyclic'",
+      status.error_message());
+}
+
+}  // namespace converter
+}  // namespace util
+}  // namespace protobuf
+}  // namespace google
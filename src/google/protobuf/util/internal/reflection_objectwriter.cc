@@ -0,0 +1,1020 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// https://developers.google.com/protocol-buffers/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <google/protobuf/util/internal/reflection_objectwriter.h>
+
+#include <google/protobuf/stubs/callback.h>
+#include <google/protobuf/stubs/once.h>
+#include <google/protobuf/stubs/time.h>
+#include <google/protobuf/io/coded_stream.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/message.h>
+#include <google/protobuf/type.pb.h>
+#include <google/protobuf/unknown_field_set.h>
+#include <google/protobuf/util/internal/field_mask_utility.h>
+#include <google/protobuf/util/internal/object_location_tracker.h>
+#include <google/protobuf/util/internal/constants.h>
+#include <google/protobuf/util/internal/protostream_objectwriter.h>
+#include <google/protobuf/util/internal/type_info.h>
+#include <google/protobuf/util/internal/utility.h>
+#include <google/protobuf/stubs/strutil.h>
+#include <google/protobuf/stubs/map_util.h>
+#include <google/protobuf/stubs/statusor.h>
+
+
+namespace google {
+namespace protobuf {
+namespace util {
+namespace converter {
+
+using google::protobuf::Descriptor;
+using google::protobuf::EnumDescriptor;
+using google::protobuf::EnumValueDescriptor;
+using google::protobuf::FieldDescriptor;
+using google::protobuf::OneofDescriptor;
+using util::error::INVALID_ARGUMENT;
+using util::Status;
+using util::StatusOr;
+
+namespace {
+
+const char kStructNullValueType[] = "google.protobuf.NullValue";
+
+// Converts a DataPiece to the number of a value of 'enum_type', accepting the
+// same spellings as DataPiece::ToEnum() does for google.protobuf.Enum.
+StatusOr<int> ToEnum(const DataPiece& data, const EnumDescriptor* enum_type) {
+  // google.protobuf.NULL_VALUE
+  if (data.type() == DataPiece::TYPE_NULL) return 0;
+
+  if (data.type() == DataPiece::TYPE_STRING) {
+    // First try the given value as a name.
+    string enum_name = data.str().ToString();
+    const EnumValueDescriptor* value = enum_type->FindValueByName(enum_name);
+    if (value != NULL) return value->number();
+
+    // Check if int version of enum is sent as string.
+    StatusOr<int32> int_value = data.ToInt32();
+    if (int_value.ok()) {
+      value = enum_type->FindValueByNumber(int_value.ValueOrDie());
+      if (value != NULL) return value->number();
+    }
+
+    // Next try a normalized name.
+    for (string::iterator it = enum_name.begin(); it != enum_name.end(); ++it) {
+      *it = *it == '-' ? '_' : ascii_toupper(*it);
+    }
+    value = enum_type->FindValueByName(enum_name);
+    if (value != NULL) return value->number();
+  } else {
+    // Unknown enum values are preserved, so any number is accepted.
+    return data.ToInt32();
+  }
+  return Status(INVALID_ARGUMENT, data.ValueAsStringOrDefault(
+                                      "Cannot find enum with given value."));
+}
+
+// Returns the name of the google.protobuf.Field kind of 'field', as reported
+// in errors by ProtoWriter.
+string KindName(const FieldDescriptor* field) {
+  // Field.Kind uses the same numbering as FieldDescriptor::Type.
+  return google::protobuf::Field_Kind_Name(
+      static_cast<google::protobuf::Field_Kind>(field->type()));
+}
+
+// Adds a path, converted to snake case, to a google.protobuf.FieldMask.
+Status AddFieldMaskPath(Message* message, StringPiece path) {
+  message->GetReflection()->AddString(
+      message, message->GetDescriptor()->FindFieldByNumber(1),
+      ConvertFieldMaskPath(path, &ToSnakeCase));
+  return Status();
+}
+
+}  // namespace
+
+// An element of the message being written: a message, or a list or map field
+// of the enclosing message. Tracks the location for error reporting the same
+// way ProtoWriter::ProtoElement does.
+class ReflectionObjectWriter::Element : public BaseElement,
+                                        public LocationTrackerInterface {
+ public:
+  // Constructor for the root element.
+  explicit Element(Message* message)
+      : BaseElement(NULL),
+        message_(message),
+        field_(NULL),
+        is_list_(false),
+        is_placeholder_(false),
+        array_index_(-1) {}
+
+  // Constructor for 'field' of the parent element. 'message' is the message
+  // of the field, or the enclosing message for lists and maps.
+  Element(Element* parent, const FieldDescriptor* field, Message* message,
+          bool is_list, bool is_placeholder)
+      : BaseElement(parent),
+        message_(message),
+        field_(field),
+        is_list_(is_list),
+        is_placeholder_(is_placeholder),
+        array_index_(is_list ? 0 : -1) {}
+
+  virtual ~Element() {}
+
+  Message* message() const { return message_; }
+  const FieldDescriptor* field() const { return field_; }
+  bool is_list() const { return is_list_; }
+  bool is_map() const { return is_list_ && field_->is_map(); }
+  bool is_placeholder() const { return is_placeholder_; }
+
+  // Moves to the next item of a list or map.
+  void NextIndex() { ++array_index_; }
+
+  // Returns false if the map key was already added to this map.
+  bool InsertMapKeyIfNotPresent(StringPiece map_key) {
+    if (map_keys_ == NULL) map_keys_.reset(new hash_set<string>);
+    return InsertIfNotPresent(map_keys_.get(), map_key.ToString());
+  }
+
+  virtual string ToString() const;
+
+ protected:
+  virtual Element* parent() const {
+    return static_cast<Element*>(BaseElement::parent());
+  }
+
+ private:
+  Message* message_;
+  const FieldDescriptor* field_;
+  bool is_list_;
+  bool is_placeholder_;
+
+  // Number of items started so far in a list or map, -1 otherwise.
+  int array_index_;
+
+  // Keys already seen, for maps.
+  google::protobuf::scoped_ptr<hash_set<string> > map_keys_;
+
+  GOOGLE_DISALLOW_IMPLICIT_CONSTRUCTORS(Element);
+};
+
+string ReflectionObjectWriter::Element::ToString() const {
+  if (parent() == NULL) return "";
+  string loc = parent()->ToString();
+  if (!field_->is_repeated() || parent()->field_ != field_) {
+    const string& name = field_->name();
+    size_t i = 0;
+    while (i < name.size() && (ascii_isalnum(name[i]) || name[i] == '_')) ++i;
+    if (i > 0 && i == name.size()) {  // safe field name
+      if (loc.empty()) {
+        loc = name;
+      } else {
+        StrAppend(&loc, ".", name);
+      }
+    } else {
+      StrAppend(&loc, "[\"", CEscape(name), "\"]");
+    }
+  }
+  if (field_->is_repeated() && array_index_ > 0) {
+    StrAppend(&loc, "[", array_index_ - 1, "]");
+  }
+  return loc.empty() ? "." : loc;
+}
+
+// Collects the bytes a ProtoStreamObjectWriter writes for a delegated value
+// and reports its errors relative to the location of that value.
+class ReflectionObjectWriter::Delegate : public ErrorListener {
+ public:
+  Delegate(Message* message, const string& location, ErrorListener* listener)
+      : message_(message),
+        location_(location),
+        listener_(listener),
+        sink_(&buffer_),
+        depth_(0),
+        failed_(false) {}
+  virtual ~Delegate() {}
+
+  ProtoStreamObjectWriter* writer() { return writer_.get(); }
+  void set_writer(ProtoStreamObjectWriter* writer) { writer_.reset(writer); }
+  strings::ByteSink* sink() { return &sink_; }
+
+  // Nesting of the objects and lists forwarded so far.
+  void IncrementDepth() { ++depth_; }
+  int DecrementDepth() { return --depth_; }
+  int depth() const { return depth_; }
+
+  // Merges the written value into the message, unless there were errors.
+  void Merge() {
+    if (failed_) return;
+    io::CodedInputStream input(
+        reinterpret_cast<const uint8*>(buffer_.data()), buffer_.size());
+    if (!message_->MergePartialFromCodedStream(&input) ||
+        !input.ConsumedEntireMessage()) {
+      GOOGLE_LOG(DFATAL) << "Invalid output for "
+                  << message_->GetDescriptor()->full_name();
+    }
+  }
+
+  // ErrorListener methods.
+  virtual void InvalidName(const LocationTrackerInterface& loc,
+                           StringPiece invalid_name, StringPiece message) {
+    failed_ = true;
+    listener_->InvalidName(Location(location_, loc), invalid_name, message);
+  }
+
+  virtual void InvalidValue(const LocationTrackerInterface& loc,
+                            StringPiece type_name, StringPiece value) {
+    failed_ = true;
+    listener_->InvalidValue(Location(location_, loc), type_name, value);
+  }
+
+  virtual void MissingField(const LocationTrackerInterface& loc,
+                            StringPiece missing_name) {
+    failed_ = true;
+    listener_->MissingField(Location(location_, loc), missing_name);
+  }
+
+ private:
+  // A location within the delegated value.
+  class Location : public LocationTrackerInterface {
+   public:
+    Location(const string& prefix, const LocationTrackerInterface& loc)
+        : prefix_(prefix), loc_(loc) {}
+
+    virtual string ToString() const {
+      string loc = loc_.ToString();
+      if (loc.empty()) return prefix_;
+      if (prefix_.empty()) return loc;
+      return loc[0] == '[' ? StrCat(prefix_, loc) : StrCat(prefix_, ".", loc);
+    }
+
+   private:
+    const string& prefix_;
+    const LocationTrackerInterface& loc_;
+
+    GOOGLE_DISALLOW_IMPLICIT_CONSTRUCTORS(Location);
+  };
+
+  Message* message_;
+  const string location_;
+  ErrorListener* listener_;
+  string buffer_;
+  strings::StringByteSink sink_;
+  google::protobuf::scoped_ptr<ProtoStreamObjectWriter> writer_;
+  int depth_;
+  bool failed_;
+
+  GOOGLE_DISALLOW_IMPLICIT_CONSTRUCTORS(Delegate);
+};
+
+ReflectionObjectWriter::ReflectionObjectWriter(TypeResolver* type_resolver,
+                                               Message* message,
+                                               ErrorListener* listener)
+    : type_resolver_(type_resolver),
+      typeinfo_(NULL),
+      own_typeinfo_(true),
+      message_(message),
+      listener_(listener),
+      element_(NULL),
+      delegate_(NULL),
+      tracker_(new ObjectLocationTracker()),
+      invalid_depth_(0),
+      ignore_unknown_fields_(false),
+      done_(false) {
+  StartRoot();
+}
+
+ReflectionObjectWriter::ReflectionObjectWriter(const TypeInfo* typeinfo,
+                                               Message* message,
+                                               ErrorListener* listener)
+    : type_resolver_(NULL),
+      typeinfo_(typeinfo),
+      own_typeinfo_(false),
+      message_(message),
+      listener_(listener),
+      element_(NULL),
+      delegate_(NULL),
+      tracker_(new ObjectLocationTracker()),
+      invalid_depth_(0),
+      ignore_unknown_fields_(false),
+      done_(false) {
+  StartRoot();
+}
+
+ReflectionObjectWriter::~ReflectionObjectWriter() {
+  if (own_typeinfo_) {
+    // The delegate's writer uses the TypeInfo until it is destroyed.
+    delegate_.reset();
+    delete typeinfo_;
+  }
+  if (element_ == NULL) return;
+  // Cleanup explicitly in order to avoid destructor stack overflow when input
+  // is deeply nested.
+  google::protobuf::scoped_ptr<BaseElement> element(
+      static_cast<BaseElement*>(element_.get())->pop<BaseElement>());
+  while (element != NULL) {
+    element.reset(element->pop<BaseElement>());
+  }
+}
+
+StructuredObjectWriter::BaseElement* ReflectionObjectWriter::element() {
+  return element_.get();
+}
+
+ReflectionObjectWriter* ReflectionObjectWriter::StartObject(
+    StringPiece name) {
+  if (delegate_ != NULL) {
+    delegate_->writer()->StartObject(name);
+    delegate_->IncrementDepth();
+    return this;
+  }
+
+  if (invalid_depth_ > 0) {
+    ++invalid_depth_;
+    return this;
+  }
+
+  // Starting the root message.
+  if (element_ == NULL) {
+    if (!name.empty()) {
+      InvalidName(name, "Root element should not be named.");
+    }
+    element_.reset(new Element(message_));
+    return this;
+  }
+
+  const FieldDescriptor* field = NULL;
+  if (element_->is_map()) {
+    if (!ValidMapKey(name)) {
+      ++invalid_depth_;
+      return this;
+    }
+    // The object is the value of a new map entry, which stays on the stack
+    // as a placeholder until the value ends.
+    field = StartMapEntry(name);
+  } else if (element_->is_list()) {
+    // Objects in a list are items of the list's field.
+    field = element_->field();
+    element_->NextIndex();
+  } else {
+    field = Lookup(name);
+    if (field == NULL || !ValidOneof(field, name)) {
+      ++invalid_depth_;
+      return this;
+    }
+  }
+
+  if (field->cpp_type() != FieldDescriptor::CPPTYPE_MESSAGE) {
+    InvalidName(name, "Proto field is not a message, cannot start object.");
+    PopPlaceholders();
+    ++invalid_depth_;
+    return this;
+  }
+
+  // A map is triggered by a StartObject() call on a map field.
+  if (field->is_map() && !element_->is_placeholder() &&
+      !element_->is_list()) {
+    Push(field, element_->message(), true, false);
+    return this;
+  }
+
+  Message* message = MutableField(element_->message(), field);
+  const Descriptor* type = field->message_type();
+  if (IsDelegated(type) && type->full_name() != kStructListValueType) {
+    if (!StartDelegate(message, field)) {
+      PopPlaceholders();
+      ++invalid_depth_;
+      return this;
+    }
+    delegate_->writer()->StartObject("");
+    delegate_->IncrementDepth();
+    return this;
+  }
+
+  Push(field, message, false, false);
+  return this;
+}
+
+ReflectionObjectWriter* ReflectionObjectWriter::EndObject() {
+  if (delegate_ != NULL) {
+    delegate_->writer()->EndObject();
+    if (delegate_->DecrementDepth() == 0) {
+      FinishDelegate();
+      PopPlaceholders();
+    }
+    return this;
+  }
+
+  if (invalid_depth_ > 0) {
+    --invalid_depth_;
+    return this;
+  }
+
+  if (element_ == NULL) return this;
+
+  if (!element_->is_list()) CheckRequiredFields();
+  Pop();
+  if (element_ == NULL) done_ = true;
+  return this;
+}
+
+ReflectionObjectWriter* ReflectionObjectWriter::StartList(StringPiece name) {
+  if (delegate_ != NULL) {
+    delegate_->writer()->StartList(name);
+    delegate_->IncrementDepth();
+    return this;
+  }
+
+  if (invalid_depth_ > 0) {
+    ++invalid_depth_;
+    return this;
+  }
+
+  // Since we cannot have a top-level repeated item in protobuf, the only way
+  // this is valid is if the root is google.protobuf.ListValue or
+  // google.protobuf.Value, which are delegated.
+  if (element_ == NULL) {
+    InvalidName(name, name.empty() ? "Root element must be a message."
+                                   : "Root element should not be named.");
+    ++invalid_depth_;
+    return this;
+  }
+
+  const FieldDescriptor* field = NULL;
+  bool is_item = true;
+  if (element_->is_map()) {
+    if (!ValidMapKey(name)) {
+      ++invalid_depth_;
+      return this;
+    }
+    field = StartMapEntry(name);
+  } else if (element_->is_list()) {
+    field = element_->field();
+  } else {
+    field = Lookup(name);
+    if (field == NULL || !ValidOneof(field, name)) {
+      ++invalid_depth_;
+      return this;
+    }
+    is_item = !field->is_repeated();
+  }
+
+  // google.protobuf.Value and google.protobuf.ListValue are rendered as a
+  // list, anywhere a single message is expected.
+  const Descriptor* type = field->message_type();
+  if (is_item && type != NULL &&
+      (type->full_name() == kStructValueType ||
+       type->full_name() == kStructListValueType)) {
+    if (element_->is_list()) element_->NextIndex();
+    if (!StartDelegate(MutableField(element_->message(), field), field)) {
+      PopPlaceholders();
+      ++invalid_depth_;
+      return this;
+    }
+    delegate_->writer()->StartList("");
+    delegate_->IncrementDepth();
+    return this;
+  }
+
+  if (element_->is_placeholder()) {
+    InvalidFieldValue(field, "Map",
+                      StrCat("Cannot have repeated items ('", name,
+                             "') within a map."));
+    PopPlaceholders();
+    ++invalid_depth_;
+    return this;
+  }
+
+  if (!field->is_repeated()) {
+    InvalidName(name, "Proto field is not repeating, cannot start list.");
+    ++invalid_depth_;
+    return this;
+  }
+
+  if (field->is_map()) {
+    InvalidValue("Map",
+                 StrCat("Cannot bind a list to map for field '", name, "'."));
+    ++invalid_depth_;
+    return this;
+  }
+
+  // A list nested in a list of the same field adds to that field, as it does
+  // in ProtoWriter.
+  Push(field, element_->message(), true, false);
+  return this;
+}
+
+ReflectionObjectWriter* ReflectionObjectWriter::EndList() {
+  if (delegate_ != NULL) {
+    delegate_->writer()->EndList();
+    if (delegate_->DecrementDepth() == 0) {
+      FinishDelegate();
+      PopPlaceholders();
+    }
+    return this;
+  }
+
+  if (invalid_depth_ > 0) {
+    --invalid_depth_;
+    return this;
+  }
+
+  if (element_ != NULL) Pop();
+  return this;
+}
+
+ReflectionObjectWriter* ReflectionObjectWriter::RenderDataPiece(
+    StringPiece name, const DataPiece& data) {
+  if (delegate_ != NULL) {
+    delegate_->writer()->RenderDataPiece(name, data);
+    // A scalar is the whole value when the root is delegated.
+    if (delegate_->depth() == 0) FinishDelegate();
+    return this;
+  }
+
+  if (invalid_depth_ > 0) return this;
+
+  if (element_ == NULL) {
+    InvalidName(name, "Root element must be a message.");
+    return this;
+  }
+
+  if (element_->is_map()) {
+    if (!ValidMapKey(name)) return this;
+    // Unlike for other fields, an explicit null still adds the map entry.
+    const FieldDescriptor* value_field = StartMapEntry(name);
+    RenderField(element_->message(), value_field, name, data);
+    Pop();
+    return this;
+  }
+
+  const FieldDescriptor* field = NULL;
+  if (element_->is_list()) {
+    field = element_->field();
+    if (data.type() == DataPiece::TYPE_NULL && !AcceptsNull(field)) {
+      return this;
+    }
+    element_->NextIndex();
+  } else {
+    field = Lookup(name);
+    if (field == NULL) return this;
+    if (data.type() == DataPiece::TYPE_NULL && !AcceptsNull(field)) {
+      return this;
+    }
+    if (!ValidOneof(field, name)) return this;
+  }
+
+  RenderField(element_->message(), field, name, data);
+  return this;
+}
+
+const FieldDescriptor* ReflectionObjectWriter::Lookup(StringPiece name) {
+  if (name.empty()) {
+    InvalidName(name, "Proto fields must have a name.");
+    return NULL;
+  }
+  const FieldDescriptor* field =
+      FindField(element_->message()->GetDescriptor(), name);
+  if (field == NULL && !ignore_unknown_fields_) {
+    InvalidName(name, "Cannot find field.");
+  }
+  return field;
+}
+
+const FieldDescriptor* ReflectionObjectWriter::FindField(
+    const Descriptor* descriptor, StringPiece name) {
+  lookup_name_.assign(name.data(), name.size());
+  // The JSON name is the lowerCamelCase name unless the json_name option is
+  // used, so check the camelcase index first.
+  const FieldDescriptor* field =
+      descriptor->FindFieldByCamelcaseName(lookup_name_);
+  if (field != NULL && field->json_name() == lookup_name_) return field;
+  field = descriptor->FindFieldByName(lookup_name_);
+  if (field != NULL) return field;
+  for (int i = 0; i < descriptor->field_count(); ++i) {
+    if (descriptor->field(i)->json_name() == lookup_name_) {
+      return descriptor->field(i);
+    }
+  }
+  return NULL;
+}
+
+bool ReflectionObjectWriter::ValidOneof(const FieldDescriptor* field,
+                                        StringPiece name) {
+  const OneofDescriptor* oneof = field->containing_oneof();
+  if (oneof == NULL) return true;
+  const Message& message = *element_->message();
+  if (message.GetReflection()->HasOneof(message, oneof)) {
+    InvalidValue("oneof", StrCat("oneof field '", oneof->name(),
+                                 "' is already set. Cannot set '", name, "'"));
+    return false;
+  }
+  return true;
+}
+
+bool ReflectionObjectWriter::ValidMapKey(StringPiece name) {
+  if (!element_->InsertMapKeyIfNotPresent(name)) {
+    listener_->InvalidName(
+        location(), name,
+        StrCat("Repeated map key: '", name, "' is already set."));
+    return false;
+  }
+  return true;
+}
+
+const FieldDescriptor* ReflectionObjectWriter::StartMapEntry(
+    StringPiece name) {
+  element_->NextIndex();
+  Message* entry = element_->message()->GetReflection()->AddMessage(
+      element_->message(), element_->field());
+  Push(element_->field(), entry, false, true);
+
+  // Map entries have a "key" field numbered 1 and a "value" field numbered 2.
+  const Descriptor* descriptor = entry->GetDescriptor();
+  const FieldDescriptor* key_field = descriptor->FindFieldByNumber(1);
+  Status status = RenderPrimitiveField(
+      entry, key_field, DataPiece(name, use_strict_base64_decoding()));
+  if (!status.ok()) {
+    InvalidFieldValue(key_field, KindName(key_field), status.error_message());
+  }
+  return descriptor->FindFieldByNumber(2);
+}
+
+void ReflectionObjectWriter::RenderField(Message* message,
+                                         const FieldDescriptor* field,
+                                         StringPiece name,
+                                         const DataPiece& data) {
+  if (field->cpp_type() == FieldDescriptor::CPPTYPE_MESSAGE) {
+    const string& type_name = field->message_type()->full_name();
+    if (type_name == kStructValueType) {
+      if (StartDelegate(MutableField(message, field), field)) {
+        delegate_->writer()->RenderDataPiece("", data);
+        FinishDelegate();
+      }
+      return;
+    }
+
+    const TypeRenderer* type_renderer = FindTypeRenderer(type_name);
+    if (type_renderer == NULL) {
+      InvalidFieldValue(field, GetFullTypeWithUrl(type_name),
+                        data.ValueAsStringOrDefault(""));
+      return;
+    }
+
+    // Render the special type with an element pushed for it, so that errors
+    // are reported at its location.
+    Push(field, MutableField(message, field), false, false);
+    Status status = (*type_renderer)(this, element_->message(), data);
+    if (!status.ok()) {
+      InvalidValue(GetFullTypeWithUrl(type_name),
+                   StrCat("Field '", name, "', ", status.error_message()));
+    }
+    element_.reset(element_->pop<Element>());
+    return;
+  }
+
+  if (data.type() == DataPiece::TYPE_NULL && !AcceptsNull(field)) return;
+
+  Status status = RenderPrimitiveField(message, field, data);
+  if (!status.ok()) {
+    InvalidFieldValue(field, KindName(field), status.error_message());
+  }
+}
+
+// Sets a singular field or adds to a repeated one, with the value converted by
+// the given DataPiece method.
+#define RENDER_PRIMITIVE_FIELD(CPPTYPE, TYPE, METHOD, CONVERT)          \
+  case FieldDescriptor::CPPTYPE_##CPPTYPE: {                             \
+    StatusOr<TYPE> value = data.CONVERT();                               \
+    if (!value.ok()) return value.status();                              \
+    if (field->is_repeated()) {                                          \
+      reflection->Add##METHOD(message, field, value.ValueOrDie());       \
+    } else {                                                             \
+      reflection->Set##METHOD(message, field, value.ValueOrDie());       \
+    }                                                                    \
+    return Status();                                                     \
+  }
+
+Status ReflectionObjectWriter::RenderPrimitiveField(
+    Message* message, const FieldDescriptor* field, const DataPiece& data) {
+  const Reflection* reflection = message->GetReflection();
+  switch (field->cpp_type()) {
+    RENDER_PRIMITIVE_FIELD(INT32, int32, Int32, ToInt32)
+    RENDER_PRIMITIVE_FIELD(INT64, int64, Int64, ToInt64)
+    RENDER_PRIMITIVE_FIELD(UINT32, uint32, UInt32, ToUint32)
+    RENDER_PRIMITIVE_FIELD(UINT64, uint64, UInt64, ToUint64)
+    RENDER_PRIMITIVE_FIELD(DOUBLE, double, Double, ToDouble)
+    RENDER_PRIMITIVE_FIELD(FLOAT, float, Float, ToFloat)
+    RENDER_PRIMITIVE_FIELD(BOOL, bool, Bool, ToBool)
+    case FieldDescriptor::CPPTYPE_STRING: {
+      StatusOr<string> value = field->type() == FieldDescriptor::TYPE_BYTES
+                                   ? data.ToBytes()
+                                   : data.ToString();
+      if (!value.ok()) return value.status();
+      if (field->is_repeated()) {
+        reflection->AddString(message, field, value.ValueOrDie());
+      } else {
+        reflection->SetString(message, field, value.ValueOrDie());
+      }
+      return Status();
+    }
+    case FieldDescriptor::CPPTYPE_ENUM: {
+      StatusOr<int> value = ToEnum(data, field->enum_type());
+      if (!value.ok()) return value.status();
+      // Closed enums keep unknown values in the unknown fields, where the
+      // binary parser would have put them.
+      if (message->GetDescriptor()->file()->syntax() !=
+              FileDescriptor::SYNTAX_PROTO3 &&
+          field->enum_type()->FindValueByNumber(value.ValueOrDie()) == NULL) {
+        reflection->MutableUnknownFields(message)->AddVarint(
+            field->number(), value.ValueOrDie());
+      } else if (field->is_repeated()) {
+        reflection->AddEnumValue(message, field, value.ValueOrDie());
+      } else {
+        reflection->SetEnumValue(message, field, value.ValueOrDie());
+      }
+      return Status();
+    }
+    default:  // CPPTYPE_MESSAGE
+      return Status(INVALID_ARGUMENT, data.ValueAsStringOrDefault(""));
+  }
+}
+
+#undef RENDER_PRIMITIVE_FIELD
+
+Message* ReflectionObjectWriter::MutableField(Message* message,
+                                              const FieldDescriptor* field) {
+  const Reflection* reflection = message->GetReflection();
+  return field->is_repeated() ? reflection->AddMessage(message, field)
+                              : reflection->MutableMessage(message, field);
+}
+
+bool ReflectionObjectWriter::AcceptsNull(const FieldDescriptor* field) {
+  switch (field->cpp_type()) {
+    case FieldDescriptor::CPPTYPE_MESSAGE:
+      return field->message_type()->full_name() == kStructValueType;
+    case FieldDescriptor::CPPTYPE_ENUM:
+      return field->enum_type()->full_name() == kStructNullValueType;
+    default:
+      return false;
+  }
+}
+
+void ReflectionObjectWriter::StartRoot() {
+  // The special JSON forms of a well known type at the root are handled by
+  // ProtoStreamObjectWriter as a whole.
+  const Descriptor* descriptor = message_->GetDescriptor();
+  if (IsDelegated(descriptor) ||
+      FindTypeRenderer(descriptor->full_name()) != NULL) {
+    StartDelegate(message_, NULL);
+  }
+}
+
+bool ReflectionObjectWriter::IsDelegated(const Descriptor* descriptor) {
+  const string& type_name = descriptor->full_name();
+  return type_name == kAnyType || type_name == kStructType ||
+         type_name == kStructValueType || type_name == kStructListValueType;
+}
+
+bool ReflectionObjectWriter::StartDelegate(Message* message,
+                                           const FieldDescriptor* field) {
+  if (typeinfo_ == NULL) typeinfo_ = TypeInfo::NewTypeInfo(type_resolver_);
+  const google::protobuf::Type* type = typeinfo_->GetTypeByTypeUrl(
+      GetFullTypeWithUrl(message->GetDescriptor()->full_name()));
+  if (type == NULL) {
+    InvalidName(field != NULL ? field->name() : "",
+                StrCat("Missing descriptor for field: ",
+                       GetFullTypeWithUrl(
+                           message->GetDescriptor()->full_name())));
+    return false;
+  }
+
+  string location;
+  if (field != NULL) {
+    Push(field, message, false, false);
+    location = element_->ToString();
+    element_.reset(element_->pop<Element>());
+  }
+  delegate_.reset(new Delegate(message, location, listener_));
+  ProtoStreamObjectWriter* writer = new ProtoStreamObjectWriter(
+      typeinfo_, *type, delegate_->sink(), delegate_.get());
+  writer->set_ignore_unknown_fields(ignore_unknown_fields_);
+  writer->set_use_strict_base64_decoding(use_strict_base64_decoding());
+  delegate_->set_writer(writer);
+  return true;
+}
+
+void ReflectionObjectWriter::FinishDelegate() {
+  delegate_->Merge();
+  delegate_.reset();
+  if (element_ == NULL) done_ = true;
+}
+
+void ReflectionObjectWriter::Push(const FieldDescriptor* field,
+                                  Message* message, bool is_list,
+                                  bool is_placeholder) {
+  element_.reset(new Element(element_.release(), field, message, is_list,
+                             is_placeholder));
+}
+
+void ReflectionObjectWriter::Pop() {
+  element_.reset(element_->pop<Element>());
+  PopPlaceholders();
+}
+
+void ReflectionObjectWriter::PopPlaceholders() {
+  while (element_ != NULL && element_->is_placeholder()) {
+    element_.reset(element_->pop<Element>());
+  }
+}
+
+void ReflectionObjectWriter::CheckRequiredFields() {
+  const Message& message = *element_->message();
+  const Descriptor* descriptor = message.GetDescriptor();
+  if (descriptor->file()->syntax() == FileDescriptor::SYNTAX_PROTO3) return;
+  const Reflection* reflection = message.GetReflection();
+  for (int i = 0; i < descriptor->field_count(); ++i) {
+    const FieldDescriptor* field = descriptor->field(i);
+    if (field->is_required() && !reflection->HasField(message, field)) {
+      MissingField(field->name());
+    }
+  }
+}
+
+void ReflectionObjectWriter::InvalidName(StringPiece unknown_name,
+                                         StringPiece message) {
+  listener_->InvalidName(location(), ToSnakeCase(unknown_name), message);
+}
+
+void ReflectionObjectWriter::InvalidValue(StringPiece type_name,
+                                          StringPiece value) {
+  listener_->InvalidValue(location(), type_name, value);
+}
+
+void ReflectionObjectWriter::InvalidFieldValue(const FieldDescriptor* field,
+                                               StringPiece type_name,
+                                               StringPiece value) {
+  Push(field, NULL, false, false);
+  InvalidValue(type_name, value);
+  element_.reset(element_->pop<Element>());
+}
+
+void ReflectionObjectWriter::MissingField(StringPiece missing_name) {
+  listener_->MissingField(location(), missing_name);
+}
+
+const LocationTrackerInterface& ReflectionObjectWriter::location() {
+  if (element_ != NULL) return *element_;
+  return *tracker_;
+}
+
+Status ReflectionObjectWriter::RenderTimestamp(ReflectionObjectWriter* ow,
+                                               Message* message,
+                                               const DataPiece& data) {
+  if (data.type() == DataPiece::TYPE_NULL) return Status();
+  if (data.type() != DataPiece::TYPE_STRING) {
+    return Status(INVALID_ARGUMENT,
+                  StrCat("Invalid data type for timestamp, value is ",
+                         data.ValueAsStringOrDefault("")));
+  }
+
+  StringPiece value(data.str());
+
+  int64 seconds;
+  int32 nanos;
+  if (!::google::protobuf::internal::ParseTime(value.ToString(), &seconds,
+                                               &nanos)) {
+    return Status(INVALID_ARGUMENT, StrCat("Invalid time format: ", value));
+  }
+
+  const Reflection* reflection = message->GetReflection();
+  const Descriptor* descriptor = message->GetDescriptor();
+  reflection->SetInt64(message, descriptor->FindFieldByNumber(1), seconds);
+  reflection->SetInt32(message, descriptor->FindFieldByNumber(2), nanos);
+  return Status();
+}
+
+Status ReflectionObjectWriter::RenderDuration(ReflectionObjectWriter* ow,
+                                              Message* message,
+                                              const DataPiece& data) {
+  if (data.type() == DataPiece::TYPE_NULL) return Status();
+  if (data.type() != DataPiece::TYPE_STRING) {
+    return Status(INVALID_ARGUMENT,
+                  StrCat("Invalid data type for duration, value is ",
+                         data.ValueAsStringOrDefault("")));
+  }
+
+  int64 seconds;
+  int32 nanos;
+  Status status = ParseDuration(data.str(), &seconds, &nanos);
+  if (!status.ok()) return status;
+
+  const Reflection* reflection = message->GetReflection();
+  const Descriptor* descriptor = message->GetDescriptor();
+  reflection->SetInt64(message, descriptor->FindFieldByNumber(1), seconds);
+  reflection->SetInt32(message, descriptor->FindFieldByNumber(2), nanos);
+  return Status();
+}
+
+Status ReflectionObjectWriter::RenderFieldMask(ReflectionObjectWriter* ow,
+                                               Message* message,
+                                               const DataPiece& data) {
+  if (data.type() == DataPiece::TYPE_NULL) return Status();
+  if (data.type() != DataPiece::TYPE_STRING) {
+    return Status(INVALID_ARGUMENT,
+                  StrCat("Invalid data type for field mask, value is ",
+                         data.ValueAsStringOrDefault("")));
+  }
+
+  google::protobuf::scoped_ptr<ResultCallback1<util::Status, StringPiece> > callback(
+      NewPermanentCallback(&AddFieldMaskPath, message));
+  return DecodeCompactFieldMaskPaths(data.str(), callback.get());
+}
+
+Status ReflectionObjectWriter::RenderWrapper(ReflectionObjectWriter* ow,
+                                             Message* message,
+                                             const DataPiece& data) {
+  if (data.type() == DataPiece::TYPE_NULL) return Status();
+  // Wrappers have a single field named "value". Conversion errors are
+  // reported at its location.
+  ow->RenderField(message, message->GetDescriptor()->FindFieldByNumber(1),
+                  "value", data);
+  return Status();
+}
+
+// Map of functions that are responsible for rendering well known type
+// represented by the key.
+hash_map<string, ReflectionObjectWriter::TypeRenderer>*
+    ReflectionObjectWriter::renderers_ = NULL;
+GOOGLE_PROTOBUF_DECLARE_ONCE(reflection_writer_renderers_init_);
+
+void ReflectionObjectWriter::InitRendererMap() {
+  renderers_ = new hash_map<string, ReflectionObjectWriter::TypeRenderer>();
+  (*renderers_)["google.protobuf.Timestamp"] =
+      &ReflectionObjectWriter::RenderTimestamp;
+  (*renderers_)["google.protobuf.Duration"] =
+      &ReflectionObjectWriter::RenderDuration;
+  (*renderers_)["google.protobuf.FieldMask"] =
+      &ReflectionObjectWriter::RenderFieldMask;
+  (*renderers_)["google.protobuf.DoubleValue"] =
+      &ReflectionObjectWriter::RenderWrapper;
+  (*renderers_)["google.protobuf.FloatValue"] =
+      &ReflectionObjectWriter::RenderWrapper;
+  (*renderers_)["google.protobuf.Int64Value"] =
+      &ReflectionObjectWriter::RenderWrapper;
+  (*renderers_)["google.protobuf.UInt64Value"] =
+      &ReflectionObjectWriter::RenderWrapper;
+  (*renderers_)["google.protobuf.Int32Value"] =
+      &ReflectionObjectWriter::RenderWrapper;
+  (*renderers_)["google.protobuf.UInt32Value"] =
+      &ReflectionObjectWriter::RenderWrapper;
+  (*renderers_)["google.protobuf.BoolValue"] =
+      &ReflectionObjectWriter::RenderWrapper;
+  (*renderers_)["google.protobuf.StringValue"] =
+      &ReflectionObjectWriter::RenderWrapper;
+  (*renderers_)["google.protobuf.BytesValue"] =
+      &ReflectionObjectWriter::RenderWrapper;
+  ::google::protobuf::internal::OnShutdown(&DeleteRendererMap);
+}
+
+void ReflectionObjectWriter::DeleteRendererMap() {
+  delete ReflectionObjectWriter::renderers_;
+  renderers_ = NULL;
+}
+
+ReflectionObjectWriter::TypeRenderer*
+ReflectionObjectWriter::FindTypeRenderer(const string& type_name) {
+  ::google::protobuf::GoogleOnceInit(&reflection_writer_renderers_init_,
+                                     &InitRendererMap);
+  return FindOrNull(*renderers_, type_name);
+}
+
+}  // namespace converter
+}  // namespace util
+}  // namespace protobuf
+}  // namespace google
@@ -0,0 +1,305 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// https://developers.google.com/protocol-buffers/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#ifndef GOOGLE_PROTOBUF_UTIL_CONVERTER_REFLECTION_OBJECTWRITER_H__
+#define GOOGLE_PROTOBUF_UTIL_CONVERTER_REFLECTION_OBJECTWRITER_H__
+
+#include <google/protobuf/stubs/hash.h>
+#include <memory>
+#ifndef _SHARED_PTR_H
+#include <google/protobuf/stubs/shared_ptr.h>
+#endif
+#include <string>
+
+#include <google/protobuf/stubs/common.h>
+#include <google/protobuf/util/internal/datapiece.h>
+#include <google/protobuf/util/internal/error_listener.h>
+#include <google/protobuf/util/internal/structured_objectwriter.h>
+#include <google/protobuf/util/type_resolver.h>
+#include <google/protobuf/stubs/stringpiece.h>
+#include <google/protobuf/stubs/status.h>
+
+
+namespace google {
+namespace protobuf {
+class Descriptor;
+class FieldDescriptor;
+class Message;
+}  // namespace protobuf
+
+
+namespace protobuf {
+namespace util {
+namespace converter {
+
+class ObjectLocationTracker;
+class ProtoStreamObjectWriter;
+class TypeInfo;
+
+// An ObjectWriter that populates a Message in place through its Reflection
+// interface, so parsing JSON into a Message does not need to go through the
+// binary format. Nested messages are created with the arena of the message
+// they belong to. Errors are reported to the ErrorListener with the same
+// locations and messages as ProtoStreamObjectWriter uses.
+//
+// google.protobuf.Any, Struct, Value and ListValue are handed off to a
+// ProtoStreamObjectWriter and the bytes it produces are merged into the
+// corresponding submessage; this is the only use of the type information.
+//
+// Sample usage:
+//   ReflectionObjectWriter ow(type_resolver, message, listener);
+//   JsonStreamParser parser(&ow);
+//   Status status = parser.Parse(json);
+class LIBPROTOBUF_EXPORT ReflectionObjectWriter : public StructuredObjectWriter {
+ public:
+  // Constructor. Does not take ownership of any parameter passed in. The
+  // type_resolver must resolve type urls with the "type.googleapis.com"
+  // prefix.
+  ReflectionObjectWriter(TypeResolver* type_resolver, Message* message,
+                         ErrorListener* listener);
+  // Like the constructor above but resolves the delegated types through a
+  // TypeInfo, which may be shared with other writers.
+  ReflectionObjectWriter(const TypeInfo* typeinfo, Message* message,
+                         ErrorListener* listener);
+  virtual ~ReflectionObjectWriter();
+
+  // ObjectWriter methods.
+  virtual ReflectionObjectWriter* StartObject(StringPiece name);
+  virtual ReflectionObjectWriter* EndObject();
+  virtual ReflectionObjectWriter* StartList(StringPiece name);
+  virtual ReflectionObjectWriter* EndList();
+  virtual ReflectionObjectWriter* RenderBool(StringPiece name, bool value) {
+    return RenderDataPiece(name, DataPiece(value));
+  }
+  virtual ReflectionObjectWriter* RenderInt32(StringPiece name, int32 value) {
+    return RenderDataPiece(name, DataPiece(value));
+  }
+  virtual ReflectionObjectWriter* RenderUint32(StringPiece name,
+                                               uint32 value) {
+    return RenderDataPiece(name, DataPiece(value));
+  }
+  virtual ReflectionObjectWriter* RenderInt64(StringPiece name, int64 value) {
+    return RenderDataPiece(name, DataPiece(value));
+  }
+  virtual ReflectionObjectWriter* RenderUint64(StringPiece name,
+                                               uint64 value) {
+    return RenderDataPiece(name, DataPiece(value));
+  }
+  virtual ReflectionObjectWriter* RenderDouble(StringPiece name,
+                                               double value) {
+    return RenderDataPiece(name, DataPiece(value));
+  }
+  virtual ReflectionObjectWriter* RenderFloat(StringPiece name, float value) {
+    return RenderDataPiece(name, DataPiece(value));
+  }
+  virtual ReflectionObjectWriter* RenderString(StringPiece name,
+                                               StringPiece value) {
+    return RenderDataPiece(name,
+                           DataPiece(value, use_strict_base64_decoding()));
+  }
+  virtual ReflectionObjectWriter* RenderBytes(StringPiece name,
+                                              StringPiece value) {
+    return RenderDataPiece(
+        name, DataPiece(value, false, use_strict_base64_decoding()));
+  }
+  virtual ReflectionObjectWriter* RenderNull(StringPiece name) {
+    return RenderDataPiece(name, DataPiece::NullData());
+  }
+
+  // Sets the value of the field identified by 'name' in the current message
+  // from 'data'.
+  ReflectionObjectWriter* RenderDataPiece(StringPiece name,
+                                          const DataPiece& data);
+
+  // When true, the root message has been completely written.
+  virtual bool done() { return done_; }
+
+  void set_ignore_unknown_fields(bool ignore_unknown_fields) {
+    ignore_unknown_fields_ = ignore_unknown_fields;
+  }
+
+ protected:
+  virtual BaseElement* element();
+
+ private:
+  class Element;
+  class Delegate;
+
+  // Function that sets a well known type from its JSON scalar representation.
+  typedef util::Status (*TypeRenderer)(ReflectionObjectWriter*, Message*,
+                                         const DataPiece&);
+
+  // Looks up the field 'name' of the current message, reporting an error
+  // unless it is found or unknown fields are ignored.
+  const FieldDescriptor* Lookup(StringPiece name);
+
+  // Finds a field by its JSON name or its original proto name.
+  const FieldDescriptor* FindField(const Descriptor* descriptor,
+                                   StringPiece name);
+
+  // Returns false and reports an error if another field of the oneof that
+  // 'field' belongs to is already set in the current message.
+  bool ValidOneof(const FieldDescriptor* field, StringPiece name);
+
+  // Returns false and reports an error if the map key was already seen in
+  // the current map.
+  bool ValidMapKey(StringPiece name);
+
+  // Adds an entry to the current map, sets its key from 'name' and pushes a
+  // placeholder element for it. Returns the entry's value field.
+  const FieldDescriptor* StartMapEntry(StringPiece name);
+
+  // Sets 'field' of 'message' from a scalar, handling the well known types
+  // that are rendered as JSON scalars. Null leaves non-message fields unset.
+  void RenderField(Message* message, const FieldDescriptor* field,
+                   StringPiece name, const DataPiece& data);
+
+  // Sets, or adds to when the field is repeated, a non-message field.
+  util::Status RenderPrimitiveField(Message* message,
+                                      const FieldDescriptor* field,
+                                      const DataPiece& data);
+
+  // Returns the submessage to write 'field' of 'message' into, adding one if
+  // the field is repeated.
+  Message* MutableField(Message* message, const FieldDescriptor* field);
+
+  // Returns true if an explicit null sets 'field' rather than being ignored.
+  static bool AcceptsNull(const FieldDescriptor* field);
+
+  // Hands off the whole root message when its type has a special JSON form.
+  void StartRoot();
+
+  // Returns true for the message types that are handed off to a
+  // ProtoStreamObjectWriter.
+  static bool IsDelegated(const Descriptor* descriptor);
+
+  // Starts handing off events to a ProtoStreamObjectWriter that writes into
+  // 'message'. Errors are reported relative to 'field' of the current element,
+  // or to the root when 'field' is NULL. Returns false if the type of the
+  // message cannot be resolved.
+  bool StartDelegate(Message* message, const FieldDescriptor* field);
+
+  // Merges the value written by the delegate into its message.
+  void FinishDelegate();
+
+  // Pushes a new element for 'field' of the current element.
+  void Push(const FieldDescriptor* field, Message* message, bool is_list,
+            bool is_placeholder);
+
+  // Pops the current element, along with the placeholders below it.
+  void Pop();
+
+  // Pops the map entry placeholders on top of the stack.
+  void PopPlaceholders();
+
+  // Reports missing required fields of the current message.
+  void CheckRequiredFields();
+
+  // Error reporting helpers. The *Field variants report at the location of
+  // 'field' within the current element.
+  void InvalidName(StringPiece unknown_name, StringPiece message);
+  void InvalidValue(StringPiece type_name, StringPiece value);
+  void InvalidFieldValue(const FieldDescriptor* field, StringPiece type_name,
+                         StringPiece value);
+  void MissingField(StringPiece missing_name);
+
+  // Returns the location tracker to use for tracking locations for errors.
+  const LocationTrackerInterface& location();
+
+  // Renders google.protobuf.Timestamp from its RFC 3339 string form.
+  static util::Status RenderTimestamp(ReflectionObjectWriter* ow,
+                                        Message* message,
+                                        const DataPiece& data);
+
+  // Renders google.protobuf.Duration from its "<seconds>.<nanos>s" form.
+  static util::Status RenderDuration(ReflectionObjectWriter* ow,
+                                       Message* message,
+                                       const DataPiece& data);
+
+  // Renders google.protobuf.FieldMask from its comma separated form.
+  static util::Status RenderFieldMask(ReflectionObjectWriter* ow,
+                                        Message* message,
+                                        const DataPiece& data);
+
+  // Renders the well known types in google/protobuf/wrappers.proto from their
+  // wrapped value.
+  static util::Status RenderWrapper(ReflectionObjectWriter* ow,
+                                      Message* message, const DataPiece& data);
+
+  static hash_map<string, TypeRenderer>* renderers_;
+  static void InitRendererMap();
+  static void DeleteRendererMap();
+  static TypeRenderer* FindTypeRenderer(const string& type_name);
+
+  // Used to resolve the types of the delegated values. Not owned. NULL when
+  // the writer was given a TypeInfo.
+  TypeResolver* type_resolver_;
+
+  // Shared by all of the delegated values. Unless given to the constructor,
+  // created from type_resolver_ on the first one.
+  const TypeInfo* typeinfo_;
+
+  // Whether the TypeInfo object is owned by this class.
+  bool own_typeinfo_;
+
+  // The message being written. Not owned.
+  Message* message_;
+
+  ErrorListener* listener_;
+
+  // The current element, NULL before the root message is started and after
+  // it has ended.
+  google::protobuf::scoped_ptr<Element> element_;
+
+  // The value currently handed off to a ProtoStreamObjectWriter, if any.
+  google::protobuf::scoped_ptr<Delegate> delegate_;
+
+  // Location used for errors reported outside of the root message.
+  google::protobuf::scoped_ptr<ObjectLocationTracker> tracker_;
+
+  // Reused buffer for field name lookups.
+  string lookup_name_;
+
+  // Depth of the unknown or invalid subtree being skipped.
+  int invalid_depth_;
+
+  bool ignore_unknown_fields_;
+
+  bool done_;
+
+  GOOGLE_DISALLOW_IMPLICIT_CONSTRUCTORS(ReflectionObjectWriter);
+};
+
+}  // namespace converter
+}  // namespace util
+}  // namespace protobuf
+
+}  // namespace google
+#endif  // GOOGLE_PROTOBUF_UTIL_CONVERTER_REFLECTION_OBJECTWRITER_H__
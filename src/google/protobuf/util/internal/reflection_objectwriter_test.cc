@@ -0,0 +1,424 @@
+// Protocol Buffers - Google's data interchange format
+// Copyright 2008 Google Inc.  All rights reserved.
+// https://developers.google.com/protocol-buffers/
+//
+// Redistribution and use in source and binary forms, with or without
+// modification, are permitted provided that the following conditions are
+// met:
+//
+//     * Redistributions of source code must retain the above copyright
+// notice, this list of conditions and the following disclaimer.
+//     * Redistributions in binary form must reproduce the above
+// copyright notice, this list of conditions and the following disclaimer
+// in the documentation and/or other materials provided with the
+// distribution.
+//     * Neither the name of Google Inc. nor the names of its
+// contributors may be used to endorse or promote products derived from
+// this software without specific prior written permission.
+//
+// THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+// "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+// LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+// A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+// OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+// SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+// LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+// DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+// THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+// (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+// OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+#include <google/protobuf/util/internal/reflection_objectwriter.h>
+
+#include <memory>
+#ifndef _SHARED_PTR_H
+#include <google/protobuf/stubs/shared_ptr.h>
+#endif
+#include <vector>
+
+#include <google/protobuf/any.pb.h>
+#include <google/protobuf/struct.pb.h>
+#include <google/protobuf/timestamp.pb.h>
+#include <google/protobuf/descriptor.h>
+#include <google/protobuf/dynamic_message.h>
+#include <google/protobuf/util/internal/error_listener.h>
+#include <google/protobuf/util/internal/json_stream_parser.h>
+#include <google/protobuf/util/internal/protostream_objectwriter.h>
+#include <google/protobuf/util/internal/testdata/books.pb.h>
+#include <google/protobuf/util/internal/constants.h>
+#include <google/protobuf/util/json_format_proto3.pb.h>
+#include <google/protobuf/util/message_differencer.h>
+#include <google/protobuf/util/type_resolver.h>
+#include <google/protobuf/util/type_resolver_util.h>
+#include <google/protobuf/stubs/bytestream.h>
+#include <google/protobuf/stubs/strutil.h>
+#include <gtest/gtest.h>
+
+
+namespace google {
+namespace protobuf {
+namespace util {
+namespace converter {
+
+using google::protobuf::DescriptorPool;
+using google::protobuf::DynamicMessageFactory;
+using google::protobuf::Message;
+using google::protobuf::testing::Book;
+using proto3::TestAny;
+using proto3::TestDuration;
+using proto3::TestFieldMask;
+using proto3::TestListValue;
+using proto3::TestMap;
+using proto3::TestMessage;
+using proto3::TestOneof;
+using proto3::TestStruct;
+using proto3::TestTimestamp;
+using proto3::TestValue;
+using proto3::TestWrapper;
+using util::Status;
+
+// Records every error in the format used by JsonStringToMessage().
+class RecordingErrorListener : public ErrorListener {
+ public:
+  RecordingErrorListener() {}
+  virtual ~RecordingErrorListener() {}
+
+  virtual void InvalidName(const LocationTrackerInterface& loc,
+                           StringPiece unknown_name, StringPiece message) {
+    errors_.push_back(StrCat(loc.ToString(), ": ", message));
+  }
+
+  virtual void InvalidValue(const LocationTrackerInterface& loc,
+                            StringPiece type_name, StringPiece value) {
+    errors_.push_back(StrCat(loc.ToString(), ": invalid value ", value,
+                             " for type ", type_name));
+  }
+
+  virtual void MissingField(const LocationTrackerInterface& loc,
+                            StringPiece missing_name) {
+    errors_.push_back(StrCat(loc.ToString(), ": missing field ", missing_name));
+  }
+
+  const std::vector<string>& errors() const { return errors_; }
+
+ private:
+  std::vector<string> errors_;
+
+  GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(RecordingErrorListener);
+};
+
+// ReflectionObjectWriter must populate the message the same way as parsing
+// the output of ProtoStreamObjectWriter does, and report the same errors, so
+// each test parses the JSON both ways and compares the results.
+class ReflectionObjectWriterTest : public ::testing::Test {
+ protected:
+  ReflectionObjectWriterTest()
+      : resolver_(NewTypeResolverForDescriptorPool(
+            kTypeServiceBaseUrl, DescriptorPool::generated_pool())),
+        ignore_unknown_fields_(false) {}
+
+  Status ParseWithReflection(const string& json, Message* message,
+                             std::vector<string>* errors) {
+    RecordingErrorListener listener;
+    ReflectionObjectWriter ow(resolver_.get(), message, &listener);
+    ow.set_ignore_unknown_fields(ignore_unknown_fields_);
+    JsonStreamParser parser(&ow);
+    Status status = parser.Parse(json);
+    if (status.ok()) status = parser.FinishParse();
+    *errors = listener.errors();
+    return status;
+  }
+
+  Status ParseFromBinary(const string& json, Message* message,
+                         std::vector<string>* errors) {
+    google::protobuf::Type type;
+    Status status = resolver_->ResolveMessageType(
+        StrCat(kTypeServiceBaseUrl, "/",
+               message->GetDescriptor()->full_name()),
+        &type);
+    if (!status.ok()) return status;
+    string binary;
+    strings::StringByteSink sink(&binary);
+    RecordingErrorListener listener;
+    ProtoStreamObjectWriter::Options options;
+    options.ignore_unknown_fields = ignore_unknown_fields_;
+    ProtoStreamObjectWriter ow(resolver_.get(), type, &sink, &listener,
+                               options);
+    JsonStreamParser parser(&ow);
+    status = parser.Parse(json);
+    if (status.ok()) status = parser.FinishParse();
+    *errors = listener.errors();
+    if (status.ok() && errors->empty() &&
+        !message->ParsePartialFromString(binary)) {
+      errors->push_back("Invalid binary output.");
+    }
+    return status;
+  }
+
+  // Parses the JSON into 'message' through reflection after checking that
+  // the result matches parsing the binary output.
+  void DoTest(const string& json, Message* message) {
+    google::protobuf::scoped_ptr<Message> expected(message->New());
+    std::vector<string> expected_errors;
+    std::vector<string> errors;
+    EXPECT_TRUE(ParseFromBinary(json, expected.get(), &expected_errors).ok());
+    EXPECT_TRUE(ParseWithReflection(json, message, &errors).ok());
+    EXPECT_TRUE(expected_errors.empty()) << expected_errors[0];
+    EXPECT_TRUE(errors.empty()) << errors[0];
+    EXPECT_TRUE(MessageDifferencer::Equals(*expected, *message))
+        << "Expected:\n" << expected->DebugString() << "Actual:\n"
+        << message->DebugString();
+  }
+
+  // Returns the errors reported through reflection after checking that they
+  // match the errors of the binary path.
+  std::vector<string> DoErrorTest(const string& json,
+                                  const Message& prototype) {
+    google::protobuf::scoped_ptr<Message> expected(prototype.New());
+    google::protobuf::scoped_ptr<Message> actual(prototype.New());
+    std::vector<string> expected_errors;
+    std::vector<string> errors;
+    ParseFromBinary(json, expected.get(), &expected_errors);
+    ParseWithReflection(json, actual.get(), &errors);
+    EXPECT_FALSE(errors.empty());
+    EXPECT_EQ(expected_errors, errors);
+    return errors;
+  }
+
+  google::protobuf::scoped_ptr<TypeResolver> resolver_;
+  bool ignore_unknown_fields_;
+};
+
+TEST_F(ReflectionObjectWriterTest, Proto3Primitives) {
+  TestMessage m;
+  DoTest(
+      "{\"boolValue\": true, \"int32Value\": -32, \"int64Value\": \"-64\","
+      " \"uint32Value\": 32, \"uint64Value\": \"18446744073709551615\","
+      " \"floatValue\": 1.5, \"doubleValue\": \"-Infinity\","
+      " \"stringValue\": \"str\\\"\\n\\u20ac\", \"bytesValue\": \"AP8B\","
+      " \"enumValue\": \"BAR\", \"messageValue\": {\"value\": 7},"
+      " \"repeatedInt32Value\": [1, -2], \"repeatedStringValue\": [\"a\", \"\"],"
+      " \"repeatedEnumValue\": [\"foo\", 1, 12, \"1\"],"
+      " \"repeatedMessageValue\": [{\"value\": 1}, {}],"
+      " \"repeated_bool_value\": [true, null, false]}",
+      &m);
+  EXPECT_EQ(-32, m.int32_value());
+  EXPECT_EQ(7, m.message_value().value());
+  ASSERT_EQ(4, m.repeated_enum_value_size());
+  EXPECT_EQ(12, m.repeated_enum_value(2));
+  EXPECT_EQ(2, m.repeated_bool_value_size());
+  m.Clear();
+  DoTest("{}", &m);
+}
+
+TEST_F(ReflectionObjectWriterTest, Proto2FieldsAndJsonNames) {
+  Book book;
+  DoTest(
+      "{\"title\": \"My Book\", \"length\": 340, \"published\": 1234567890,"
+      " \"author\": {\"@id\": 1, \"name\": \"Tolstoy\","
+      " \"pseudonym\": [\"A\", \"B\"], \"friend\": [{\"name\": \"C\"}]},"
+      " \"publisher\": {\"name\": \"Penguin\"},"
+      " \"labels\": [{\"key\": \"a\", \"value\": \"b\"}],"
+      " \"type\": \"action-and-adventure\"}",
+      &book);
+  EXPECT_EQ(1, book.author().id());
+  EXPECT_EQ(Book::ACTION_AND_ADVENTURE, book.type());
+
+  // Groups are parsed like messages, which the binary path does not support.
+  book.Clear();
+  std::vector<string> errors;
+  EXPECT_TRUE(ParseWithReflection(
+                  "{\"data\": {\"year\": 2010, \"copyright\": \"Acme\"}}",
+                  &book, &errors).ok());
+  EXPECT_TRUE(errors.empty());
+  EXPECT_EQ(2010, book.data().year());
+
+  // An unknown value of a closed enum ends up in the unknown fields.
+  book.Clear();
+  DoTest("{\"type\": 7}", &book);
+  EXPECT_FALSE(book.has_type());
+  EXPECT_EQ(1, book.GetReflection()->GetUnknownFields(book).field_count());
+}
+
+TEST_F(ReflectionObjectWriterTest, Oneof) {
+  TestOneof m;
+  DoTest("{\"oneofMessageValue\": {\"value\": 1}}", &m);
+  EXPECT_TRUE(m.has_oneof_message_value());
+  DoErrorTest("{\"oneofInt32Value\": 1, \"oneofStringValue\": \"a\"}",
+              TestOneof());
+}
+
+TEST_F(ReflectionObjectWriterTest, Maps) {
+  TestMap m;
+  DoTest(
+      "{\"boolMap\": {\"true\": 1, \"false\": 2},"
+      " \"int32Map\": {\"-1\": 1, \"2\": 2},"
+      " \"int64Map\": {\"-3\": 3}, \"uint32Map\": {\"4\": 4},"
+      " \"uint64Map\": {\"18446744073709551615\": 5},"
+      " \"stringMap\": {\"\": 6}}",
+      &m);
+  EXPECT_EQ(2, m.int32_map().at(2));
+
+  // A null value still adds the entry. The binary path writes no value for it
+  // either, but parsing that output sets the value field of the entry.
+  m.Clear();
+  std::vector<string> errors;
+  EXPECT_TRUE(
+      ParseWithReflection("{\"stringMap\": {\"a\": null}}", &m, &errors).ok());
+  EXPECT_TRUE(errors.empty());
+  EXPECT_EQ(0, m.string_map().at("a"));
+  DoErrorTest("{\"int32Map\": {\"1\": 1, \"1\": 2}}", TestMap());
+  DoErrorTest("{\"int32Map\": {\"x\": 1}}", TestMap());
+  DoErrorTest("{\"int32Map\": [1]}", TestMap());
+}
+
+TEST_F(ReflectionObjectWriterTest, Wrappers) {
+  TestWrapper m;
+  DoTest(
+      "{\"boolValue\": false, \"int32Value\": 0, \"int64Value\": \"-64\","
+      " \"uint64Value\": \"64\", \"floatValue\": 1.5, \"doubleValue\": -2,"
+      " \"stringValue\": \"s\", \"bytesValue\": \"AQI=\", \"uint32Value\": null,"
+      " \"repeatedInt32Value\": [1, 2], \"repeatedStringValue\": []}",
+      &m);
+  EXPECT_TRUE(m.has_int32_value());
+  EXPECT_FALSE(m.has_uint32_value());
+  DoErrorTest("{\"int32Value\": \"abc\"}", TestWrapper());
+  DoErrorTest("{\"repeatedInt32Value\": [1, true]}", TestWrapper());
+}
+
+TEST_F(ReflectionObjectWriterTest, TimestampAndDuration) {
+  TestTimestamp timestamp;
+  DoTest(
+      "{\"value\": \"1970-01-01T00:00:01.5Z\","
+      " \"repeatedValue\": [\"0001-01-01T00:00:00Z\", null]}",
+      &timestamp);
+  EXPECT_EQ(1, timestamp.value().seconds());
+  EXPECT_EQ(500000000, timestamp.value().nanos());
+  DoErrorTest("{\"value\": \"yesterday\"}", TestTimestamp());
+  DoErrorTest("{\"value\": 12}", TestTimestamp());
+
+  TestDuration duration;
+  DoTest("{\"value\": \"-1.000000001s\", \"repeatedValue\": [\"0s\"]}",
+         &duration);
+  EXPECT_EQ(-1, duration.value().seconds());
+  EXPECT_EQ(-1, duration.value().nanos());
+  DoErrorTest("{\"value\": \"1\"}", TestDuration());
+  DoErrorTest("{\"value\": \"315576000001s\"}", TestDuration());
+}
+
+TEST_F(ReflectionObjectWriterTest, FieldMask) {
+  TestFieldMask m;
+  DoTest("{\"value\": \"foo.barBaz,qux\"}", &m);
+  ASSERT_EQ(2, m.value().paths_size());
+  EXPECT_EQ("foo.bar_baz", m.value().paths(0));
+}
+
+TEST_F(ReflectionObjectWriterTest, StructValueAndListValue) {
+  TestStruct s;
+  DoTest(
+      "{\"value\": {\"a\": 1, \"b\": [true, null, {\"c\": \"d\"}]},"
+      " \"repeatedValue\": [{}, {\"e\": {}}]}",
+      &s);
+  EXPECT_EQ(2, s.value().fields_size());
+
+  TestValue v;
+  DoTest(
+      "{\"value\": null, \"repeatedValue\": [1, \"a\", null, [2, [3]],"
+      " {\"f\": false}]}",
+      &v);
+  EXPECT_EQ(google::protobuf::Value::kNullValue, v.value().kind_case());
+  EXPECT_EQ(5, v.repeated_value_size());
+
+  TestListValue l;
+  DoTest(
+      "{\"value\": [1, {\"a\": [2]}], \"repeatedValue\": [[], [null]]}", &l);
+  EXPECT_EQ(2, l.value().values_size());
+  DoErrorTest("{\"value\": {\"a\": 1, \"b\": {\"c\": 1, \"c\": 2}}}",
+              TestStruct());
+}
+
+TEST_F(ReflectionObjectWriterTest, Any) {
+  TestAny m;
+  DoTest(
+      "{\"value\": {\"@type\": \"type.googleapis.com/proto3.TestMessage\","
+      " \"int32Value\": 5},"
+      " \"repeatedValue\": [{\"@type\":"
+      " \"type.googleapis.com/google.protobuf.Timestamp\","
+      " \"value\": \"1970-01-01T00:00:00Z\"}]}",
+      &m);
+  TestMessage payload;
+  ASSERT_TRUE(m.value().UnpackTo(&payload));
+  EXPECT_EQ(5, payload.int32_value());
+
+  // Errors inside an Any are reported at their full path, unlike on the
+  // binary path.
+  m.Clear();
+  std::vector<string> errors;
+  ParseWithReflection(
+      "{\"value\": {\"@type\": \"type.googleapis.com/proto3.TestMessage\","
+      " \"int32Value\": \"x\"}}",
+      &m, &errors);
+  ASSERT_EQ(1, errors.size());
+  EXPECT_EQ("value.int32_value: invalid value \"x\" for type TYPE_INT32",
+            errors[0]);
+}
+
+TEST_F(ReflectionObjectWriterTest, WellKnownTypeAtRoot) {
+  google::protobuf::Value value;
+  DoTest("[1, {\"a\": null}]", &value);
+  EXPECT_EQ(2, value.list_value().values_size());
+
+  google::protobuf::Struct s;
+  DoTest("{\"a\": {\"b\": \"c\"}}", &s);
+
+  google::protobuf::Timestamp timestamp;
+  DoTest("\"1970-01-01T00:00:10Z\"", &timestamp);
+  EXPECT_EQ(10, timestamp.seconds());
+
+  google::protobuf::Any any;
+  DoTest(
+      "{\"@type\": \"type.googleapis.com/proto3.TestMessage\","
+      " \"messageValue\": {\"value\": 1}}",
+      &any);
+}
+
+TEST_F(ReflectionObjectWriterTest, DynamicMessage) {
+  DynamicMessageFactory factory;
+  google::protobuf::scoped_ptr<Message> message(
+      factory.GetPrototype(TestMessage::descriptor())->New());
+  DoTest(
+      "{\"int32Value\": 1, \"repeatedMessageValue\": [{\"value\": 2}],"
+      " \"enumValue\": 1}",
+      message.get());
+}
+
+TEST_F(ReflectionObjectWriterTest, Errors) {
+  DoErrorTest("{\"unknownName\": 0}", TestMessage());
+  DoErrorTest("{\"int32Value\": 2147483648}", TestMessage());
+  DoErrorTest("{\"repeatedInt32Value\": [1, \"x\"]}", TestMessage());
+  DoErrorTest("{\"messageValue\": {\"value\": 1.5}}", TestMessage());
+  DoErrorTest("{\"messageValue\": 1}", TestMessage());
+  DoErrorTest("{\"int32Value\": [1]}", TestMessage());
+  DoErrorTest("{\"enumValue\": \"BAZ\"}", TestMessage());
+  DoErrorTest("[]", TestMessage());
+  DoErrorTest("{\"publisher\": {}}", Book());
+  DoErrorTest("{\"author\": {\"friend\": [{\"@id\": \"x\"}]}}", Book());
+
+  ignore_unknown_fields_ = true;
+  TestMessage m;
+  DoTest("{\"unknownName\": {\"a\": [1]}, \"int32Value\": 1}", &m);
+  EXPECT_EQ(1, m.int32_value());
+}
+
+TEST_F(ReflectionObjectWriterTest, ObjectForNonMessageField) {
+  TestMessage m;
+  std::vector<string> errors;
+  ParseWithReflection("{\"int32Value\": {}}", &m, &errors);
+  ASSERT_EQ(1, errors.size());
+  EXPECT_EQ(": Proto field is not a message, cannot start object.", errors[0]);
+}
+
+}  // namespace converter
+}  // namespace util
+}  // namespace protobuf
+}  // namespace google
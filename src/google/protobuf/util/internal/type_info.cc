@@ -30,14 +30,15 @@
 
 #include <google/protobuf/util/internal/type_info.h>
 
-#include <map>
 #include <set>
 
 #include <google/protobuf/stubs/common.h>
+#include <google/protobuf/stubs/hash.h>
 #include <google/protobuf/type.pb.h>
 #include <google/protobuf/util/internal/utility.h>
 #include <google/protobuf/stubs/stringpiece.h>
 #include <google/protobuf/stubs/map_util.h>
+#include <google/protobuf/stubs/mutex.h>
 #include <google/protobuf/stubs/status.h>
 #include <google/protobuf/stubs/statusor.h>
 
@@ -60,112 +61,167 @@ class TypeInfoForTypeResolver : public TypeInfo {
 
   virtual util::StatusOr<const google::protobuf::Type*> ResolveTypeUrl(
       StringPiece type_url) const {
-    std::map<StringPiece, StatusOrType>::iterator it =
-        cached_types_.find(type_url);
-    if (it != cached_types_.end()) {
-      return it->second;
+    MutexLock lock(&mutex_);
+    const google::protobuf::Type* cached =
+        FindPtrOrNull(cached_types_, type_url);
+    if (cached != NULL) {
+      return cached;
     }
-    // Stores the string value so it can be referenced using StringPiece in the
-    // cached_types_ map.
-    const string& string_type_url =
-        *string_storage_.insert(type_url.ToString()).first;
+    string string_type_url = type_url.ToString();
     google::protobuf::scoped_ptr<google::protobuf::Type> type(new google::protobuf::Type());
     util::Status status =
         type_resolver_->ResolveMessageType(string_type_url, type.get());
-    StatusOrType result =
-        status.ok() ? StatusOrType(type.release()) : StatusOrType(status);
-    cached_types_[string_type_url] = result;
-    return result;
+    if (!status.ok()) {
+      // Failures are not cached, so types added to the pool later are found
+      // and bad type urls in the input do not grow the cache.
+      return status;
+    }
+    // Stores the string value so it can be referenced using StringPiece in the
+    // cached_types_ map.
+    cached_types_[*string_storage_.insert(string_type_url).first] = type.get();
+    return type.release();
   }
 
   virtual const google::protobuf::Type* GetTypeByTypeUrl(
       StringPiece type_url) const {
-    StatusOrType result = ResolveTypeUrl(type_url);
+    util::StatusOr<const google::protobuf::Type*> result =
+        ResolveTypeUrl(type_url);
     return result.ok() ? result.ValueOrDie() : NULL;
   }
 
   virtual const google::protobuf::Enum* GetEnumByTypeUrl(
       StringPiece type_url) const {
-    std::map<StringPiece, StatusOrEnum>::iterator it =
-        cached_enums_.find(type_url);
-    if (it != cached_enums_.end()) {
-      return it->second.ok() ? it->second.ValueOrDie() : NULL;
+    MutexLock lock(&mutex_);
+    const google::protobuf::Enum* cached =
+        FindPtrOrNull(cached_enums_, type_url);
+    if (cached != NULL) {
+      return cached;
     }
-    // Stores the string value so it can be referenced using StringPiece in the
-    // cached_enums_ map.
-    const string& string_type_url =
-        *string_storage_.insert(type_url.ToString()).first;
+    string string_type_url = type_url.ToString();
     google::protobuf::scoped_ptr<google::protobuf::Enum> enum_type(
         new google::protobuf::Enum());
     util::Status status =
         type_resolver_->ResolveEnumType(string_type_url, enum_type.get());
-    StatusOrEnum result =
-        status.ok() ? StatusOrEnum(enum_type.release()) : StatusOrEnum(status);
-    cached_enums_[string_type_url] = result;
-    return result.ok() ? result.ValueOrDie() : NULL;
+    if (!status.ok()) {
+      return NULL;
+    }
+    // Stores the string value so it can be referenced using StringPiece in the
+    // cached_enums_ map.
+    cached_enums_[*string_storage_.insert(string_type_url).first] =
+        enum_type.get();
+    return enum_type.release();
   }
 
   virtual const google::protobuf::Field* FindField(
       const google::protobuf::Type* type, StringPiece camel_case_name) const {
-    std::map<const google::protobuf::Type*, CamelCaseNameTable>::const_iterator
-        it = indexed_types_.find(type);
-    const CamelCaseNameTable& camel_case_name_table =
-        (it == indexed_types_.end())
-            ? PopulateNameLookupTable(type, &indexed_types_[type])
-            : it->second;
-    StringPiece name =
-        FindWithDefault(camel_case_name_table, camel_case_name, StringPiece());
-    if (name.empty()) {
-      // Didn't find a mapping. Use whatever provided.
-      name = camel_case_name;
-    }
-    return FindFieldInTypeOrNull(type, name);
+    if (type == NULL) return NULL;
+    return FindPtrOrNull(GetFieldTable(type).by_name, camel_case_name);
+  }
+
+  virtual const google::protobuf::Field* FindFieldByNumber(
+      const google::protobuf::Type* type, int32 number) const {
+    if (type == NULL) return NULL;
+    return FindPtrOrNull(GetFieldTable(type).by_number, number);
+  }
+
+  virtual const google::protobuf::EnumValue* FindEnumValueByName(
+      const google::protobuf::Enum* enum_type, StringPiece name) const {
+    if (enum_type == NULL) return NULL;
+    return FindPtrOrNull(GetEnumValueTable(enum_type).by_name, name);
+  }
+
+  virtual const google::protobuf::EnumValue* FindEnumValueByNumber(
+      const google::protobuf::Enum* enum_type, int32 number) const {
+    if (enum_type == NULL) return NULL;
+    return FindPtrOrNull(GetEnumValueTable(enum_type).by_number, number);
   }
 
  private:
-  typedef util::StatusOr<const google::protobuf::Type*> StatusOrType;
-  typedef util::StatusOr<const google::protobuf::Enum*> StatusOrEnum;
-  typedef std::map<StringPiece, StringPiece> CamelCaseNameTable;
+  // Lookup tables over the fields of a Type. by_name holds both the json_name
+  // and the original name of every field, with json_names taking precedence.
+  // When names or numbers collide, the first field wins, like a linear scan
+  // over the fields would.
+  struct FieldTable {
+    hash_map<StringPiece, const google::protobuf::Field*> by_name;
+    hash_map<int32, const google::protobuf::Field*> by_number;
+  };
+
+  // Lookup tables over the values of an Enum.
+  struct EnumValueTable {
+    hash_map<StringPiece, const google::protobuf::EnumValue*> by_name;
+    hash_map<int32, const google::protobuf::EnumValue*> by_number;
+  };
 
   template <typename T>
-  static void DeleteCachedTypes(std::map<StringPiece, T>* cached_types) {
-    for (typename std::map<StringPiece, T>::iterator it = cached_types->begin();
+  static void DeleteCachedTypes(hash_map<StringPiece, const T*>* cached_types) {
+    for (typename hash_map<StringPiece, const T*>::iterator it =
+             cached_types->begin();
          it != cached_types->end(); ++it) {
-      if (it->second.ok()) {
-        delete it->second.ValueOrDie();
-      }
+      delete it->second;
     }
   }
 
-  const CamelCaseNameTable& PopulateNameLookupTable(
-      const google::protobuf::Type* type,
-      CamelCaseNameTable* camel_case_name_table) const {
+  // The tables are never modified once built, so the returned reference can
+  // be used after the lock is released.
+  const FieldTable& GetFieldTable(const google::protobuf::Type* type) const {
+    MutexLock lock(&mutex_);
+    hash_map<const google::protobuf::Type*, FieldTable>::const_iterator it =
+        field_tables_.find(type);
+    if (it != field_tables_.end()) return it->second;
+
+    FieldTable* table = &field_tables_[type];
     for (int i = 0; i < type->fields_size(); ++i) {
       const google::protobuf::Field& field = type->fields(i);
-      StringPiece name = field.name();
-      StringPiece camel_case_name = field.json_name();
-      const StringPiece* existing =
-          InsertOrReturnExisting(camel_case_name_table, camel_case_name, name);
-      if (existing && *existing != name) {
-        GOOGLE_LOG(WARNING) << "Field '" << name << "' and '" << *existing
-                     << "' map to the same camel case name '" << camel_case_name
-                     << "'.";
+      const google::protobuf::Field** existing = InsertOrReturnExisting(
+          &table->by_name, StringPiece(field.json_name()), &field);
+      if (existing != NULL && (*existing)->name() != field.name()) {
+        GOOGLE_LOG(WARNING) << "Field '" << field.name() << "' and '"
+                     << (*existing)->name()
+                     << "' map to the same camel case name '"
+                     << field.json_name() << "'.";
       }
+      InsertIfNotPresent(&table->by_number, field.number(), &field);
     }
-    return *camel_case_name_table;
+    for (int i = 0; i < type->fields_size(); ++i) {
+      const google::protobuf::Field& field = type->fields(i);
+      InsertIfNotPresent(&table->by_name, StringPiece(field.name()), &field);
+    }
+    return *table;
+  }
+
+  const EnumValueTable& GetEnumValueTable(
+      const google::protobuf::Enum* enum_type) const {
+    MutexLock lock(&mutex_);
+    hash_map<const google::protobuf::Enum*, EnumValueTable>::const_iterator it =
+        enum_value_tables_.find(enum_type);
+    if (it != enum_value_tables_.end()) return it->second;
+
+    EnumValueTable* table = &enum_value_tables_[enum_type];
+    for (int i = 0; i < enum_type->enumvalue_size(); ++i) {
+      const google::protobuf::EnumValue& value = enum_type->enumvalue(i);
+      InsertIfNotPresent(&table->by_name, StringPiece(value.name()), &value);
+      InsertIfNotPresent(&table->by_number, value.number(), &value);
+    }
+    return *table;
   }
 
   TypeResolver* type_resolver_;
 
+  // Guards all of the caches below.
+  mutable Mutex mutex_;
+
   // Stores string values that will be referenced by StringPieces in
   // cached_types_, cached_enums_.
   mutable std::set<string> string_storage_;
 
-  mutable std::map<StringPiece, StatusOrType> cached_types_;
-  mutable std::map<StringPiece, StatusOrEnum> cached_enums_;
+  mutable hash_map<StringPiece, const google::protobuf::Type*> cached_types_;
+  mutable hash_map<StringPiece, const google::protobuf::Enum*> cached_enums_;
 
-  mutable std::map<const google::protobuf::Type*, CamelCaseNameTable>
-      indexed_types_;
+  // Built on first use for every Type and Enum looked into, whether or not
+  // it was resolved by this TypeInfo.
+  mutable hash_map<const google::protobuf::Type*, FieldTable> field_tables_;
+  mutable hash_map<const google::protobuf::Enum*, EnumValueTable>
+      enum_value_tables_;
 };
 }  // namespace
 
@@ -42,8 +42,9 @@ namespace google {
 namespace protobuf {
 namespace util {
 namespace converter {
-// Internal helper class for type resolving. Note that this class is not
-// thread-safe and should only be accessed in one thread.
+// Internal helper class for type resolving. The TypeInfo returned by
+// NewTypeInfo() is thread-safe, so it can be shared by conversions running
+// concurrently on different threads.
 class LIBPROTOBUF_EXPORT TypeInfo {
  public:
   TypeInfo() {}
@@ -76,8 +77,23 @@ class LIBPROTOBUF_EXPORT TypeInfo {
       const google::protobuf::Type* type,
       StringPiece camel_case_name) const = 0;
 
+  // Looks up a field in the specified type given its number.
+  virtual const google::protobuf::Field* FindFieldByNumber(
+      const google::protobuf::Type* type, int32 number) const = 0;
+
+  // Looks up a value in the specified enum given its name.
+  virtual const google::protobuf::EnumValue* FindEnumValueByName(
+      const google::protobuf::Enum* enum_type, StringPiece name) const = 0;
+
+  // Looks up a value in the specified enum given its number.
+  virtual const google::protobuf::EnumValue* FindEnumValueByNumber(
+      const google::protobuf::Enum* enum_type, int32 number) const = 0;
+
   // Creates a TypeInfo object that looks up type information from a
-  // TypeResolver. Caller takes ownership of the returned pointer.
+  // TypeResolver, which must be thread-safe if the TypeInfo is shared between
+  // threads. Types are resolved once and kept until the TypeInfo is
+  // destroyed; failed resolutions are retried on every lookup. Caller takes
+  // ownership of the returned pointer.
   static TypeInfo* NewTypeInfo(TypeResolver* type_resolver);
 
  private:
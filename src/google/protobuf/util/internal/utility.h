@@ -197,6 +197,17 @@ inline string ValueAsString(double value) {
   return DoubleAsString(value);
 }
 
+// Formats the fractional part of a timestamp or duration (e.g. ".123" for
+// 123000000 nanos). Returns an empty string for zero nanos unless
+// with_trailing_zeros is set, in which case ".000" is returned.
+LIBPROTOBUF_EXPORT string FormatNanos(uint32 nanos, bool with_trailing_zeros);
+
+// Parses the JSON representation of a google.protobuf.Duration (e.g. "1.5s")
+// into its seconds and nanos. Returns INVALID_ARGUMENT for malformed or out of
+// range values.
+LIBPROTOBUF_EXPORT util::Status ParseDuration(StringPiece value, int64* seconds,
+                                              int32* nanos);
+
 // Converts a string to float. Unlike safe_strtof, conversion will fail if the
 // value fits into double but not float (e.g., DBL_MAX).
 LIBPROTOBUF_EXPORT bool SafeStrToFloat(StringPiece str, float* value);
@@ -30,6 +30,10 @@
 
 #include <google/protobuf/util/json_util.h>
 
+#include <list>
+#include <memory>
+#include <utility>
+
 #include <google/protobuf/stubs/common.h>
 #include <google/protobuf/io/coded_stream.h>
 #include <google/protobuf/io/zero_copy_stream.h>
@@ -39,9 +43,14 @@
 #include <google/protobuf/util/internal/json_stream_parser.h>
 #include <google/protobuf/util/internal/protostream_objectsource.h>
 #include <google/protobuf/util/internal/protostream_objectwriter.h>
+#include <google/protobuf/util/internal/reflection_objectsource.h>
+#include <google/protobuf/util/internal/reflection_objectwriter.h>
+#include <google/protobuf/util/internal/type_info.h>
 #include <google/protobuf/util/type_resolver.h>
 #include <google/protobuf/util/type_resolver_util.h>
 #include <google/protobuf/stubs/bytestream.h>
+#include <google/protobuf/stubs/mutex.h>
+#include <google/protobuf/stubs/shared_ptr.h>
 #include <google/protobuf/stubs/status_macros.h>
 
 namespace google {
@@ -187,61 +196,142 @@ util::Status JsonToBinaryString(TypeResolver* resolver,
 
 namespace {
 const char* kTypeUrlPrefix = "type.googleapis.com";
-TypeResolver* generated_type_resolver_ = NULL;
-GOOGLE_PROTOBUF_DECLARE_ONCE(generated_type_resolver_init_);
+
+// Number of DescriptorPools other than the generated pool whose type
+// information is kept between calls.
+const size_t kMaxCachedPools = 16;
 
 string GetTypeUrl(const Message& message) {
   return string(kTypeUrlPrefix) + "/" + message.GetDescriptor()->full_name();
 }
 
-void DeleteGeneratedTypeResolver() { delete generated_type_resolver_; }
+// The type information of a DescriptorPool. Its TypeInfo is thread-safe and
+// keeps every type it resolves, so conversions sharing it convert each type
+// of the pool to a google::protobuf::Type only once.
+class PoolTypeInfo {
+ public:
+  explicit PoolTypeInfo(const DescriptorPool* pool)
+      : resolver_(NewTypeResolverForDescriptorPool(kTypeUrlPrefix, pool)),
+        typeinfo_(converter::TypeInfo::NewTypeInfo(resolver_.get())) {}
+
+  const converter::TypeInfo* typeinfo() const { return typeinfo_.get(); }
+
+ private:
+  google::protobuf::scoped_ptr<TypeResolver> resolver_;
+  google::protobuf::scoped_ptr<converter::TypeInfo> typeinfo_;
+
+  GOOGLE_DISALLOW_EVIL_CONSTRUCTORS(PoolTypeInfo);
+};
+
+typedef google::protobuf::internal::shared_ptr<PoolTypeInfo> PoolTypeInfoPtr;
+typedef std::list<std::pair<int64, PoolTypeInfoPtr> > PoolTypeInfoList;
+
+PoolTypeInfoPtr* generated_pool_type_info_ = NULL;
+// Most recently used first. Entries are keyed by
+// DescriptorPool::InternalUniqueId() rather than by address, so an entry is
+// never used for a pool allocated where a destroyed one used to be; the
+// entries of destroyed pools simply age out.
+PoolTypeInfoList* pool_type_infos_ = NULL;
+Mutex* pool_type_infos_mutex_ = NULL;
+GOOGLE_PROTOBUF_DECLARE_ONCE(pool_type_infos_init_);
+
+void DeletePoolTypeInfos() {
+  delete generated_pool_type_info_;
+  delete pool_type_infos_;
+  delete pool_type_infos_mutex_;
+}
+
+void InitPoolTypeInfos() {
+  generated_pool_type_info_ =
+      new PoolTypeInfoPtr(new PoolTypeInfo(DescriptorPool::generated_pool()));
+  pool_type_infos_ = new PoolTypeInfoList;
+  pool_type_infos_mutex_ = new Mutex;
+  ::google::protobuf::internal::OnShutdown(&DeletePoolTypeInfos);
+}
+
+// Returns the type information of the pool, creating it on first use. The
+// returned pointer stays valid even if the entry is evicted meanwhile.
+PoolTypeInfoPtr GetPoolTypeInfo(const DescriptorPool* pool) {
+  ::google::protobuf::GoogleOnceInit(&pool_type_infos_init_, &InitPoolTypeInfos);
+  if (pool == DescriptorPool::generated_pool()) {
+    return *generated_pool_type_info_;
+  }
 
-void InitGeneratedTypeResolver() {
-  generated_type_resolver_ = NewTypeResolverForDescriptorPool(
-      kTypeUrlPrefix, DescriptorPool::generated_pool());
-  ::google::protobuf::internal::OnShutdown(&DeleteGeneratedTypeResolver);
+  MutexLock lock(pool_type_infos_mutex_);
+  const int64 id = pool->InternalUniqueId();
+  for (PoolTypeInfoList::iterator it = pool_type_infos_->begin();
+       it != pool_type_infos_->end(); ++it) {
+    if (it->first == id) {
+      pool_type_infos_->splice(pool_type_infos_->begin(), *pool_type_infos_,
+                               it);
+      return it->second;
+    }
+  }
+  if (pool_type_infos_->size() >= kMaxCachedPools) {
+    pool_type_infos_->pop_back();
+  }
+  pool_type_infos_->push_front(
+      std::make_pair(id, PoolTypeInfoPtr(new PoolTypeInfo(pool))));
+  return pool_type_infos_->front().second;
 }
 
-TypeResolver* GetGeneratedTypeResolver() {
-  ::google::protobuf::GoogleOnceInit(&generated_type_resolver_init_, &InitGeneratedTypeResolver);
-  return generated_type_resolver_;
+// Renders the message by walking it through reflection, without serializing
+// it to the binary format first.
+util::Status MessageToJsonStream(const Message& message,
+                                 io::ZeroCopyOutputStream* json_output,
+                                 const JsonPrintOptions& options) {
+  converter::ReflectionObjectSource source(message);
+  source.set_use_ints_for_enums(options.always_print_enums_as_ints);
+  source.set_preserve_proto_field_names(options.preserve_proto_field_names);
+  io::CodedOutputStream out_stream(json_output);
+  converter::JsonObjectWriter json_writer(options.add_whitespace ? " " : "",
+                                          &out_stream);
+  if (!options.always_print_primitive_fields) {
+    return source.WriteTo(&json_writer);
+  }
+
+  // DefaultValueObjectWriter fills in the absent fields from the type
+  // information, so only this mode needs it.
+  PoolTypeInfoPtr pool_type_info =
+      GetPoolTypeInfo(message.GetDescriptor()->file()->pool());
+  util::StatusOr<const google::protobuf::Type*> type =
+      pool_type_info->typeinfo()->ResolveTypeUrl(GetTypeUrl(message));
+  if (!type.ok()) {
+    return type.status();
+  }
+  converter::DefaultValueObjectWriter default_value_writer(
+      pool_type_info->typeinfo(), *type.ValueOrDie(), &json_writer);
+  default_value_writer.set_preserve_proto_field_names(
+      options.preserve_proto_field_names);
+  return source.WriteTo(&default_value_writer);
 }
 }  // namespace
 
 util::Status MessageToJsonString(const Message& message, string* output,
                                    const JsonOptions& options) {
-  const DescriptorPool* pool = message.GetDescriptor()->file()->pool();
-  TypeResolver* resolver =
-      pool == DescriptorPool::generated_pool()
-          ? GetGeneratedTypeResolver()
-          : NewTypeResolverForDescriptorPool(kTypeUrlPrefix, pool);
-  util::Status result =
-      BinaryToJsonString(resolver, GetTypeUrl(message),
-                         message.SerializeAsString(), output, options);
-  if (pool != DescriptorPool::generated_pool()) {
-    delete resolver;
-  }
-  return result;
+  io::StringOutputStream output_stream(output);
+  return MessageToJsonStream(message, &output_stream, options);
 }
 
 util::Status JsonStringToMessage(const string& input, Message* message,
                                    const JsonParseOptions& options) {
-  const DescriptorPool* pool = message->GetDescriptor()->file()->pool();
-  TypeResolver* resolver =
-      pool == DescriptorPool::generated_pool()
-          ? GetGeneratedTypeResolver()
-          : NewTypeResolverForDescriptorPool(kTypeUrlPrefix, pool);
-  string binary;
-  util::Status result = JsonToBinaryString(
-      resolver, GetTypeUrl(*message), input, &binary, options);
-  if (result.ok() && !message->ParseFromString(binary)) {
-    result =
-        util::Status(util::error::INVALID_ARGUMENT,
-                       "JSON transcoder produced invalid protobuf output.");
-  }
-  if (pool != DescriptorPool::generated_pool()) {
-    delete resolver;
-  }
+  PoolTypeInfoPtr pool_type_info =
+      GetPoolTypeInfo(message->GetDescriptor()->file()->pool());
+  // The JSON is written straight into a new message through reflection, which
+  // is swapped in only on success so that 'message' is left untouched on
+  // errors.
+  Message* parsed = message->New(message->GetArena());
+  google::protobuf::scoped_ptr<Message> owned_parsed(
+      message->GetArena() == NULL ? parsed : NULL);
+  StatusErrorListener listener;
+  converter::ReflectionObjectWriter reflection_writer(
+      pool_type_info->typeinfo(), parsed, &listener);
+  reflection_writer.set_ignore_unknown_fields(options.ignore_unknown_fields);
+  converter::JsonStreamParser parser(&reflection_writer);
+  util::Status result = parser.Parse(input);
+  if (result.ok()) result = parser.FinishParse();
+  if (result.ok()) result = listener.GetStatus();
+  if (result.ok()) message->GetReflection()->Swap(message, parsed);
   return result;
 }
 
@@ -32,14 +32,22 @@
 
 #include <list>
 #include <string>
+#if LANG_CXX11
+#include <thread>
+#endif
+#include <vector>
 
 #include <google/protobuf/io/zero_copy_stream.h>
+#include <google/protobuf/arena.h>
+#include <google/protobuf/descriptor.pb.h>
 #include <google/protobuf/descriptor_database.h>
 #include <google/protobuf/dynamic_message.h>
 #include <google/protobuf/util/internal/testdata/maps.pb.h>
 #include <google/protobuf/util/json_format_proto3.pb.h>
+#include <google/protobuf/unittest.pb.h>
 #include <google/protobuf/util/type_resolver.h>
 #include <google/protobuf/util/type_resolver_util.h>
+#include <google/protobuf/stubs/strutil.h>
 #include <gtest/gtest.h>
 
 namespace google {
@@ -293,6 +301,29 @@ TEST_F(JsonUtilTest, TestParseErrors) {
   EXPECT_FALSE(FromJson("{\"int32Value\":2147483648}", &m, options));
 }
 
+TEST_F(JsonUtilTest, TestParseErrorLeavesMessageUnchanged) {
+  TestMessage m;
+  m.set_int32_value(1);
+  EXPECT_FALSE(FromJson("{\"stringValue\":\"a\",\"int32Value\":\"x\"}",
+                        &m));
+  EXPECT_EQ(1, m.int32_value());
+  EXPECT_EQ("", m.string_value());
+}
+
+TEST_F(JsonUtilTest, TestParseArenaMessage) {
+  Arena arena;
+  protobuf_unittest::TestAllTypes* m =
+      Arena::CreateMessage<protobuf_unittest::TestAllTypes>(&arena);
+  ASSERT_TRUE(FromJson(
+      "{\"optionalInt32\":1,\"optionalNestedMessage\":{\"bb\":2},"
+      "\"repeatedString\":[\"a\",\"b\"]}",
+      m));
+  EXPECT_EQ(&arena, m->GetArena());
+  EXPECT_EQ(1, m->optional_int32());
+  EXPECT_EQ(2, m->optional_nested_message().bb());
+  EXPECT_EQ(2, m->repeated_string_size());
+}
+
 TEST_F(JsonUtilTest, TestDynamicMessage) {
   // Some random message but good enough to test the wrapper functions.
   string input =
@@ -332,6 +363,96 @@ TEST_F(JsonUtilTest, TestDynamicMessage) {
   EXPECT_EQ(ToJson(generated, options), ToJson(*message, options));
 }
 
+// Builds "test.Reused" in the pool: a proto3 message with a single int32
+// field of the given name.
+const Descriptor* BuildReusedMessage(DescriptorPool* pool,
+                                     const string& field_name) {
+  FileDescriptorProto file;
+  file.set_name("reused.proto");
+  file.set_package("test");
+  file.set_syntax("proto3");
+  DescriptorProto* message = file.add_message_type();
+  message->set_name("Reused");
+  FieldDescriptorProto* field = message->add_field();
+  field->set_name(field_name);
+  field->set_number(1);
+  field->set_label(FieldDescriptorProto::LABEL_OPTIONAL);
+  field->set_type(FieldDescriptorProto::TYPE_INT32);
+  if (pool->BuildFile(file) == NULL) return NULL;
+  return pool->FindMessageTypeByName("test.Reused");
+}
+
+TEST_F(JsonUtilTest, TestDynamicPoolsDoNotShareTypes) {
+  // The type information of dynamic pools is kept between calls. Pools that
+  // define the same type name differently, including pools allocated where
+  // a destroyed one used to be, must each see their own definition. More
+  // pools than are kept are used so that entries also get evicted.
+  JsonPrintOptions options;
+  options.always_print_primitive_fields = true;
+  for (int i = 0; i < 40; ++i) {
+    const string field_name = "field" + SimpleItoa(i);
+    google::protobuf::scoped_ptr<DescriptorPool> pool(new DescriptorPool);
+    const Descriptor* descriptor = BuildReusedMessage(pool.get(), field_name);
+    ASSERT_TRUE(descriptor != NULL);
+    DynamicMessageFactory factory;
+    google::protobuf::scoped_ptr<Message> message(
+        factory.GetPrototype(descriptor)->New());
+    EXPECT_EQ("{\"" + field_name + "\":0}", ToJson(*message, options));
+    ASSERT_TRUE(FromJson("{\"" + field_name + "\":5}", message.get()));
+    EXPECT_EQ("{\"" + field_name + "\":5}", ToJson(*message, options));
+  }
+}
+
+#if LANG_CXX11
+TEST_F(JsonUtilTest, TestConcurrentConversions) {
+  // Threads share the type information of the generated pool and of a
+  // dynamic pool; everybody must get the same results.
+  DescriptorPoolDatabase database(*DescriptorPool::generated_pool());
+  DescriptorPool pool(&database);
+  DynamicMessageFactory factory;
+  const Message* prototype =
+      factory.GetPrototype(pool.FindMessageTypeByName("proto3.TestMessage"));
+  ASSERT_TRUE(prototype != NULL);
+
+  const string input =
+      "{\"int32Value\":1024,\"enumValue\":\"BAR\","
+      "\"repeatedMessageValue\":[{\"value\":40},{\"value\":96}]}";
+  JsonPrintOptions options;
+  options.always_print_primitive_fields = true;
+  TestMessage expected_message;
+  ASSERT_TRUE(FromJson(input, &expected_message));
+  const string expected = ToJson(expected_message, options);
+
+  const int kThreads = 8;
+  const int kIterations = 100;
+  std::vector<string> generated_results(kThreads);
+  std::vector<string> dynamic_results(kThreads);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kThreads; t++) {
+    threads.push_back(std::thread([&, t]() {
+      for (int i = 0; i < kIterations; i++) {
+        TestMessage generated;
+        google::protobuf::scoped_ptr<Message> dynamic(prototype->New());
+        if (!FromJson(input, &generated) ||
+            !FromJson(input, dynamic.get())) {
+          return;
+        }
+        generated_results[t] = ToJson(generated, options);
+        dynamic_results[t] = ToJson(*dynamic, options);
+      }
+    }));
+  }
+  for (int t = 0; t < kThreads; t++) {
+    threads[t].join();
+  }
+
+  for (int t = 0; t < kThreads; t++) {
+    EXPECT_EQ(expected, generated_results[t]);
+    EXPECT_EQ(expected, dynamic_results[t]);
+  }
+}
+#endif  // LANG_CXX11
+
 typedef std::pair<char*, int> Segment;
 // A ZeroCopyOutputStream that writes to multiple buffers.
 class SegmentedZeroCopyOutputStream : public io::ZeroCopyOutputStream {
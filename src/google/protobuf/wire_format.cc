@@ -83,6 +83,12 @@ void UnknownFieldSetFieldSkipper::SkipUnknownEnum(
 
 bool WireFormat::SkipField(io::CodedInputStream* input, uint32 tag,
                            UnknownFieldSet* unknown_fields) {
+  if (unknown_fields != NULL && unknown_fields->fields_ == NULL) {
+    // Nothing has been decoded into the set yet; keep the field's bytes as
+    // they are.  See UnknownFieldSet::RawFields.
+    return unknown_fields->ParseRawField(input, tag);
+  }
+
   int number = WireFormatLite::GetTagFieldNumber(tag);
   // Field number 0 is illegal.
   if (number == 0) return false;
@@ -190,6 +196,11 @@ bool WireFormat::ReadPackedEnumPreserveUnknowns(io::CodedInputStream* input,
 
 void WireFormat::SerializeUnknownFields(const UnknownFieldSet& unknown_fields,
                                         io::CodedOutputStream* output) {
+  if (unknown_fields.has_raw_fields()) {
+    output->WriteRaw(unknown_fields.raw_fields_data(),
+                     unknown_fields.raw_fields_size());
+    return;
+  }
   for (int i = 0; i < unknown_fields.field_count(); i++) {
     const UnknownField& field = unknown_fields.field(i);
     switch (field.type()) {
@@ -229,6 +240,11 @@ void WireFormat::SerializeUnknownFields(const UnknownFieldSet& unknown_fields,
 uint8* WireFormat::SerializeUnknownFieldsToArray(
     const UnknownFieldSet& unknown_fields,
     uint8* target) {
+  if (unknown_fields.has_raw_fields()) {
+    return io::CodedOutputStream::WriteRawToArray(
+        unknown_fields.raw_fields_data(), unknown_fields.raw_fields_size(),
+        target);
+  }
   for (int i = 0; i < unknown_fields.field_count(); i++) {
     const UnknownField& field = unknown_fields.field(i);
 
@@ -321,6 +337,9 @@ uint8* WireFormat::SerializeUnknownMessageSetItemsToArray(
 
 size_t WireFormat::ComputeUnknownFieldsSize(
     const UnknownFieldSet& unknown_fields) {
+  if (unknown_fields.has_raw_fields()) {
+    return unknown_fields.raw_fields_size();
+  }
   size_t size = 0;
   for (int i = 0; i < unknown_fields.field_count(); i++) {
     const UnknownField& field = unknown_fields.field(i);
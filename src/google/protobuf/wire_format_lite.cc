@@ -34,7 +34,7 @@
 
 #include <google/protobuf/wire_format_lite_inl.h>
 
-#ifdef __SSE_4_1__
+#if defined(__SSE4_1__) || defined(__BMI2__)
 #include <immintrin.h>
 #endif
 #include <stack>
@@ -344,6 +344,131 @@ bool WireFormatLite::ReadPackedEnumPreserveUnknowns(
   return true;
 }
 
+namespace {
+static const int kMaxVarintBytes = 10;
+
+// Converts a decoded varint to the C++ type of a packed field, the same way
+// the corresponding ReadPrimitive() specialization does.
+template <typename CType, enum WireFormatLite::FieldType DeclaredType>
+inline CType VarintToPrimitive(uint64 value);
+
+template <>
+inline int32 VarintToPrimitive<int32, WireFormatLite::TYPE_INT32>(
+    uint64 value) {
+  return static_cast<int32>(static_cast<uint32>(value));
+}
+template <>
+inline int64 VarintToPrimitive<int64, WireFormatLite::TYPE_INT64>(
+    uint64 value) {
+  return static_cast<int64>(value);
+}
+template <>
+inline uint32 VarintToPrimitive<uint32, WireFormatLite::TYPE_UINT32>(
+    uint64 value) {
+  return static_cast<uint32>(value);
+}
+template <>
+inline uint64 VarintToPrimitive<uint64, WireFormatLite::TYPE_UINT64>(
+    uint64 value) {
+  return value;
+}
+template <>
+inline int32 VarintToPrimitive<int32, WireFormatLite::TYPE_SINT32>(
+    uint64 value) {
+  return WireFormatLite::ZigZagDecode32(static_cast<uint32>(value));
+}
+template <>
+inline int64 VarintToPrimitive<int64, WireFormatLite::TYPE_SINT64>(
+    uint64 value) {
+  return WireFormatLite::ZigZagDecode64(value);
+}
+template <>
+inline bool VarintToPrimitive<bool, WireFormatLite::TYPE_BOOL>(uint64 value) {
+  return value != 0;
+}
+template <>
+inline int VarintToPrimitive<int, WireFormatLite::TYPE_ENUM>(uint64 value) {
+  return static_cast<int>(static_cast<uint32>(value));
+}
+}  // anonymous namespace
+
+template <typename CType, enum WireFormatLite::FieldType DeclaredType>
+bool WireFormatLite::ReadPackedVarintPrimitive(io::CodedInputStream* input,
+                                               RepeatedField<CType>* values) {
+  int length;
+  if (!input->ReadVarintSizeAsInt(&length)) return false;
+  const void* void_pointer;
+  int size;
+  input->GetDirectBufferPointerInline(&void_pointer, &size);
+  if (length > size) {
+    // The field is not contiguous in the current buffer (or is truncated), so
+    // read it one value at a time.
+    io::CodedInputStream::Limit limit = input->PushLimit(length);
+    while (input->BytesUntilLimit() > 0) {
+      CType value;
+      if (!ReadPrimitive<CType, DeclaredType>(input, &value)) return false;
+      values->Add(value);
+    }
+    input->PopLimit(limit);
+    return true;
+  }
+
+  const uint8* ptr = reinterpret_cast<const uint8*>(void_pointer);
+  const uint8* end = ptr + length;
+  // If the last byte terminates a varint, no varint can run past the end of
+  // the field, and every byte without a continuation bit ends exactly one
+  // value.  That lets us size *values once and decode without bounds checks.
+  if (length > 0 && (end[-1] & 0x80)) return false;
+  int count = 0;
+  for (const uint8* p = ptr; p < end; ++p) {
+    count += *p < 0x80;
+  }
+  values->Reserve(values->size() + count);
+
+  uint64 temp;
+  while (end - ptr >= kMaxVarintBytes) {
+    ptr = io::CodedInputStream::InternalReadVarint64FromArray(ptr, &temp);
+    if (ptr == NULL) return false;
+    values->AddAlreadyReserved(VarintToPrimitive<CType, DeclaredType>(temp));
+  }
+  // Fewer than kMaxVarintBytes bytes are left; decode them from a zero-padded
+  // copy so the decoder may still read a full varint's worth of bytes.
+  uint8 tail[2 * kMaxVarintBytes] = {0};
+  const int tail_size = static_cast<int>(end - ptr);
+  memcpy(tail, ptr, tail_size);
+  for (const uint8* p = tail; p < tail + tail_size;) {
+    p = io::CodedInputStream::InternalReadVarint64FromArray(p, &temp);
+    if (p == NULL) return false;
+    values->AddAlreadyReserved(VarintToPrimitive<CType, DeclaredType>(temp));
+  }
+  return input->Skip(length);
+}
+
+template bool WireFormatLite::ReadPackedVarintPrimitive<
+    int32, WireFormatLite::TYPE_INT32>(io::CodedInputStream* input,
+                                       RepeatedField<int32>* values);
+template bool WireFormatLite::ReadPackedVarintPrimitive<
+    int64, WireFormatLite::TYPE_INT64>(io::CodedInputStream* input,
+                                       RepeatedField<int64>* values);
+template bool WireFormatLite::ReadPackedVarintPrimitive<
+    uint32, WireFormatLite::TYPE_UINT32>(io::CodedInputStream* input,
+                                         RepeatedField<uint32>* values);
+template bool WireFormatLite::ReadPackedVarintPrimitive<
+    uint64, WireFormatLite::TYPE_UINT64>(io::CodedInputStream* input,
+                                         RepeatedField<uint64>* values);
+template bool WireFormatLite::ReadPackedVarintPrimitive<
+    int32, WireFormatLite::TYPE_SINT32>(io::CodedInputStream* input,
+                                        RepeatedField<int32>* values);
+template bool WireFormatLite::ReadPackedVarintPrimitive<
+    int64, WireFormatLite::TYPE_SINT64>(io::CodedInputStream* input,
+                                        RepeatedField<int64>* values);
+template bool WireFormatLite::ReadPackedVarintPrimitive<
+    bool, WireFormatLite::TYPE_BOOL>(io::CodedInputStream* input,
+                                     RepeatedField<bool>* values);
+template bool WireFormatLite::ReadPackedVarintPrimitive<
+    int, WireFormatLite::TYPE_ENUM>(io::CodedInputStream* input,
+                                    RepeatedField<int>* values);
+
 #if !defined(PROTOBUF_LITTLE_ENDIAN)
 
 namespace {
@@ -635,11 +760,11 @@ bool WireFormatLite::VerifyUtf8String(const char* data,
   return true;
 }
 
-#ifdef __SSE_4_1__
+#ifdef __SSE4_1__
 template<typename T, bool ZigZag, bool SignExtended>
 static size_t VarintSize(
     const T* data, const int n,
-    const internal::enable_if<sizeof(T) == 4>::type* = NULL) {
+    const typename internal::enable_if<sizeof(T) == 4>::type* = NULL) {
 #if __cplusplus >= 201103L
   // is_unsigned<T> => !ZigZag
   static_assert((std::is_unsigned<T>::value ^ ZigZag) ||
@@ -735,7 +860,8 @@ size_t WireFormatLite::UInt32Size(const RepeatedField<uint32>& value) {
 }
 
 size_t WireFormatLite::SInt32Size(const RepeatedField<int32>& value) {
-  return VarintSize<int32, true, true>(value.data(), value.size());
+  // ZigZag-encoded values are never sign extended.
+  return VarintSize<int32, true, false>(value.data(), value.size());
 }
 
 size_t WireFormatLite::EnumSize(const RepeatedField<int>& value) {
@@ -743,7 +869,7 @@ size_t WireFormatLite::EnumSize(const RepeatedField<int>& value) {
   return VarintSize<int, false, true>(value.data(), value.size());
 }
 
-#else  // !__SSE_4_1__
+#else  // !__SSE4_1__
 size_t WireFormatLite::Int32Size(const RepeatedField<int32>& value) {
   size_t out = 0;
   const int n = value.size();
@@ -781,6 +907,184 @@ size_t WireFormatLite::EnumSize(const RepeatedField<int>& value) {
 }
 #endif
 
+// The bits a value is varint-encoded from.  Negative int32s are sign
+// extended to 64 bits, which makes them ten bytes on the wire.
+static inline uint64 VarintBits(int32 value, bool zigzag) {
+  return zigzag ? WireFormatLite::ZigZagEncode32(value)
+                : static_cast<uint64>(static_cast<int64>(value));
+}
+static inline uint64 VarintBits(uint32 value, bool /* zigzag */) {
+  return value;
+}
+static inline uint64 VarintBits(int64 value, bool zigzag) {
+  return zigzag ? WireFormatLite::ZigZagEncode64(value)
+                : static_cast<uint64>(value);
+}
+static inline uint64 VarintBits(uint64 value, bool /* zigzag */) {
+  return value;
+}
+
+#if defined(PROTOBUF_LITTLE_ENDIAN)
+// The bulk encoders for packed fields write a group of kVarintGroupSize values
+// at a time as long as at least 2 * kVarintGroupSize values are left.  Every
+// value takes at least one byte, so there are then at least eight bytes of
+// output left for each value in the group, which lets the group writers store
+// whole words.
+static const int kVarintGroupSize = 8;
+
+#ifdef __BMI2__
+// Writes the varint of bits with whole-word stores and returns a pointer past
+// its actual length.  The bytes stored after it are garbage that the
+// following values overwrite; at most ten bytes are stored, and only for
+// values at least nine bytes long.  With pdep this takes no branches on the
+// length, which makes arrays of mixed-length values much cheaper.
+static inline uint8* WriteVarintUnchecked(uint64 bits, uint8* target) {
+  static const uint64 kPayloadBits = GOOGLE_ULONGLONG(0x7f7f7f7f7f7f7f7f);
+  static const uint64 kContinuationBits = GOOGLE_ULONGLONG(0x8080808080808080);
+  uint64 word = _pdep_u64(bits, kPayloadBits);
+  if (GOOGLE_PREDICT_TRUE(bits < (GOOGLE_ULONGLONG(1) << 56))) {
+    const int size =
+        static_cast<int>(io::CodedOutputStream::VarintSize64(bits));
+    // Every byte but the last has its continuation bit set.
+    word |= kContinuationBits & ((GOOGLE_ULONGLONG(1) << (8 * (size - 1))) - 1);
+    memcpy(target, &word, sizeof(word));
+    return target + size;
+  }
+  // The first eight bytes all continue.  The ninth holds the next seven bits
+  // and, in its high bit, whether the last bit follows in a tenth byte.
+  word |= kContinuationBits;
+  const uint32 high_bits = static_cast<uint32>(bits >> 56);
+  const uint16 tail = static_cast<uint16>(high_bits | (high_bits >> 7) << 8);
+  memcpy(target, &word, sizeof(word));
+  memcpy(target + sizeof(word), &tail, sizeof(tail));
+  return target + 9 + (high_bits >> 7);
+}
+#endif  // __BMI2__
+
+template <typename T, bool ZigZag>
+static inline uint8* WriteVarintGroupOneByOne(const T* data, uint8* target) {
+  for (int i = 0; i < kVarintGroupSize; i++) {
+    const uint64 bits = VarintBits(data[i], ZigZag);
+#ifdef __BMI2__
+    target = WriteVarintUnchecked(bits, target);
+#else
+    target = io::CodedOutputStream::WriteVarint64ToArray(bits, target);
+#endif
+  }
+  return target;
+}
+
+// Packed arrays are often dominated by values below 128.  When a whole group
+// is, gather the low byte of each value and store them all at once.
+#ifdef __SSE4_1__
+template <typename T, bool ZigZag>
+static inline uint8* WriteVarintGroup(
+    const T* data, uint8* target,
+    const typename internal::enable_if<sizeof(T) == 4>::type* = NULL) {
+  // Any bit above the low seven makes a value longer than one byte.
+  const __m128i high_bits = _mm_set1_epi32(~0x7f);
+  // Gathers the low byte of each 32-bit lane into the low four bytes.
+  const __m128i low_bytes = _mm_setr_epi8(0, 4, 8, 12, -1, -1, -1, -1,
+                                          -1, -1, -1, -1, -1, -1, -1, -1);
+
+  __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+  __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + 4));
+  if (ZigZag) {
+    // Note:  the right-shift must be arithmetic
+    a = _mm_xor_si128(_mm_slli_epi32(a, 1), _mm_srai_epi32(a, 31));
+    b = _mm_xor_si128(_mm_slli_epi32(b, 1), _mm_srai_epi32(b, 31));
+  }
+  if (!_mm_testz_si128(_mm_or_si128(a, b), high_bits)) {
+    return WriteVarintGroupOneByOne<T, ZigZag>(data, target);
+  }
+  __m128i bytes = _mm_unpacklo_epi32(_mm_shuffle_epi8(a, low_bytes),
+                                     _mm_shuffle_epi8(b, low_bytes));
+  _mm_storel_epi64(reinterpret_cast<__m128i*>(target), bytes);
+  return target + kVarintGroupSize;
+}
+#endif  // __SSE4_1__
+
+template <typename T, bool ZigZag>
+static inline uint8* WriteVarintGroup(
+    const T* data, uint8* target
+#ifdef __SSE4_1__
+    , const typename internal::enable_if<sizeof(T) == 8>::type* = NULL
+#endif
+    ) {
+  GOOGLE_COMPILE_ASSERT(kVarintGroupSize == sizeof(uint64),
+                        group_must_fill_a_word);
+  uint64 any_bits = 0;
+  uint64 word = 0;
+  for (int i = 0; i < kVarintGroupSize; i++) {
+    const uint64 bits = VarintBits(data[i], ZigZag);
+    any_bits |= bits;
+    word |= bits << (8 * i);
+  }
+  if (any_bits >= 0x80) {
+    return WriteVarintGroupOneByOne<T, ZigZag>(data, target);
+  }
+  memcpy(target, &word, sizeof(word));
+  return target + kVarintGroupSize;
+}
+#endif  // PROTOBUF_LITTLE_ENDIAN
+
+template <typename T, bool ZigZag>
+static uint8* WriteVarintArray(const T* data, const int n, uint8* target) {
+  int i = 0;
+#if defined(PROTOBUF_LITTLE_ENDIAN)
+  for (; i + 2 * kVarintGroupSize <= n; i += kVarintGroupSize) {
+    target = WriteVarintGroup<T, ZigZag>(data + i, target);
+  }
+#endif
+  for (; i < n; i++) {
+    target = io::CodedOutputStream::WriteVarint64ToArray(
+        VarintBits(data[i], ZigZag), target);
+  }
+  return target;
+}
+
+uint8* WireFormatLite::WriteInt32NoTagToArray(
+    const RepeatedField< int32>& value, uint8* target) {
+  return WriteVarintArray<int32, false>(
+      value.unsafe_data(), value.size(), target);
+}
+
+uint8* WireFormatLite::WriteInt64NoTagToArray(
+    const RepeatedField< int64>& value, uint8* target) {
+  return WriteVarintArray<int64, false>(
+      value.unsafe_data(), value.size(), target);
+}
+
+uint8* WireFormatLite::WriteUInt32NoTagToArray(
+    const RepeatedField<uint32>& value, uint8* target) {
+  return WriteVarintArray<uint32, false>(
+      value.unsafe_data(), value.size(), target);
+}
+
+uint8* WireFormatLite::WriteUInt64NoTagToArray(
+    const RepeatedField<uint64>& value, uint8* target) {
+  return WriteVarintArray<uint64, false>(
+      value.unsafe_data(), value.size(), target);
+}
+
+uint8* WireFormatLite::WriteSInt32NoTagToArray(
+    const RepeatedField< int32>& value, uint8* target) {
+  return WriteVarintArray<int32, true>(
+      value.unsafe_data(), value.size(), target);
+}
+
+uint8* WireFormatLite::WriteSInt64NoTagToArray(
+    const RepeatedField< int64>& value, uint8* target) {
+  return WriteVarintArray<int64, true>(
+      value.unsafe_data(), value.size(), target);
+}
+
+uint8* WireFormatLite::WriteEnumNoTagToArray(
+    const RepeatedField<   int>& value, uint8* target) {
+  return WriteVarintArray<int, false>(
+      value.unsafe_data(), value.size(), target);
+}
+
 }  // namespace internal
 }  // namespace protobuf
 }  // namespace google
@@ -502,17 +502,19 @@ class LIBPROTOBUF_EXPORT WireFormatLite {
       const RepeatedField<T>& value,
       uint8* (*Writer)(T, uint8*), uint8* target);
 
-  INL static uint8* WriteInt32NoTagToArray(
+  // The varint types are encoded by bulk kernels in wire_format_lite.cc,
+  // which write runs of single-byte values without per-value branches.
+  static uint8* WriteInt32NoTagToArray(
       const RepeatedField< int32>& value, uint8* output);
-  INL static uint8* WriteInt64NoTagToArray(
+  static uint8* WriteInt64NoTagToArray(
       const RepeatedField< int64>& value, uint8* output);
-  INL static uint8* WriteUInt32NoTagToArray(
+  static uint8* WriteUInt32NoTagToArray(
       const RepeatedField<uint32>& value, uint8* output);
-  INL static uint8* WriteUInt64NoTagToArray(
+  static uint8* WriteUInt64NoTagToArray(
       const RepeatedField<uint64>& value, uint8* output);
-  INL static uint8* WriteSInt32NoTagToArray(
+  static uint8* WriteSInt32NoTagToArray(
       const RepeatedField< int32>& value, uint8* output);
-  INL static uint8* WriteSInt64NoTagToArray(
+  static uint8* WriteSInt64NoTagToArray(
       const RepeatedField< int64>& value, uint8* output);
   INL static uint8* WriteFixed32NoTagToArray(
       const RepeatedField<uint32>& value, uint8* output);
@@ -528,7 +530,7 @@ class LIBPROTOBUF_EXPORT WireFormatLite {
       const RepeatedField<double>& value, uint8* output);
   INL static uint8* WriteBoolNoTagToArray(
       const RepeatedField<  bool>& value, uint8* output);
-  INL static uint8* WriteEnumNoTagToArray(
+  static uint8* WriteEnumNoTagToArray(
       const RepeatedField<   int>& value, uint8* output);
 
   // Write fields, including tags.
@@ -719,6 +721,13 @@ class LIBPROTOBUF_EXPORT WireFormatLite {
   GOOGLE_ATTRIBUTE_ALWAYS_INLINE static bool ReadPackedFixedSizePrimitive(
       google::protobuf::io::CodedInputStream* input, RepeatedField<CType>* value);
 
+  // Like ReadPackedFixedSizePrimitive but for the varint types.  When the
+  // whole field is in the current buffer, the values are counted up front and
+  // decoded in one tight loop.  Defined in wire_format_lite.cc.
+  template <typename CType, enum FieldType DeclaredType>
+  static bool ReadPackedVarintPrimitive(
+      google::protobuf::io::CodedInputStream* input, RepeatedField<CType>* value);
+
   static const CppType kFieldTypeToCppTypeMap[];
   static const WireFormatLite::WireType kWireTypeForFieldType[];
 
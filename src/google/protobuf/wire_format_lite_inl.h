@@ -419,6 +419,29 @@ READ_REPEATED_PACKED_FIXED_SIZE_PRIMITIVE(double, TYPE_DOUBLE)
 
 #undef READ_REPEATED_PACKED_FIXED_SIZE_PRIMITIVE
 
+// Specializations of ReadPackedPrimitive for the varint types, which use the
+// bulk decoder.
+#define READ_REPEATED_PACKED_VARINT_PRIMITIVE(CPPTYPE, DECLARED_TYPE)          \
+template <>                                                                    \
+inline bool WireFormatLite::ReadPackedPrimitive<                               \
+  CPPTYPE, WireFormatLite::DECLARED_TYPE>(                                     \
+    io::CodedInputStream* input,                                               \
+    RepeatedField<CPPTYPE>* values) {                                          \
+  return ReadPackedVarintPrimitive<                                            \
+      CPPTYPE, WireFormatLite::DECLARED_TYPE>(input, values);                  \
+}
+
+READ_REPEATED_PACKED_VARINT_PRIMITIVE(int32, TYPE_INT32)
+READ_REPEATED_PACKED_VARINT_PRIMITIVE(int64, TYPE_INT64)
+READ_REPEATED_PACKED_VARINT_PRIMITIVE(uint32, TYPE_UINT32)
+READ_REPEATED_PACKED_VARINT_PRIMITIVE(uint64, TYPE_UINT64)
+READ_REPEATED_PACKED_VARINT_PRIMITIVE(int32, TYPE_SINT32)
+READ_REPEATED_PACKED_VARINT_PRIMITIVE(int64, TYPE_SINT64)
+READ_REPEATED_PACKED_VARINT_PRIMITIVE(bool, TYPE_BOOL)
+READ_REPEATED_PACKED_VARINT_PRIMITIVE(int, TYPE_ENUM)
+
+#undef READ_REPEATED_PACKED_VARINT_PRIMITIVE
+
 template <typename CType, enum WireFormatLite::FieldType DeclaredType>
 bool WireFormatLite::ReadPackedPrimitiveNoInline(io::CodedInputStream* input,
                                                  RepeatedField<CType>* values) {
@@ -703,30 +726,6 @@ inline uint8* WireFormatLite::WriteFixedNoTagToArray(
 #endif
 }
 
-inline uint8* WireFormatLite::WriteInt32NoTagToArray(
-    const RepeatedField< int32>& value, uint8* target) {
-  return WritePrimitiveNoTagToArray(value, WriteInt32NoTagToArray, target);
-}
-inline uint8* WireFormatLite::WriteInt64NoTagToArray(
-    const RepeatedField< int64>& value, uint8* target) {
-  return WritePrimitiveNoTagToArray(value, WriteInt64NoTagToArray, target);
-}
-inline uint8* WireFormatLite::WriteUInt32NoTagToArray(
-    const RepeatedField<uint32>& value, uint8* target) {
-  return WritePrimitiveNoTagToArray(value, WriteUInt32NoTagToArray, target);
-}
-inline uint8* WireFormatLite::WriteUInt64NoTagToArray(
-    const RepeatedField<uint64>& value, uint8* target) {
-  return WritePrimitiveNoTagToArray(value, WriteUInt64NoTagToArray, target);
-}
-inline uint8* WireFormatLite::WriteSInt32NoTagToArray(
-    const RepeatedField< int32>& value, uint8* target) {
-  return WritePrimitiveNoTagToArray(value, WriteSInt32NoTagToArray, target);
-}
-inline uint8* WireFormatLite::WriteSInt64NoTagToArray(
-    const RepeatedField< int64>& value, uint8* target) {
-  return WritePrimitiveNoTagToArray(value, WriteSInt64NoTagToArray, target);
-}
 inline uint8* WireFormatLite::WriteFixed32NoTagToArray(
     const RepeatedField<uint32>& value, uint8* target) {
   return WriteFixedNoTagToArray(value, WriteFixed32NoTagToArray, target);
@@ -755,10 +754,6 @@ inline uint8* WireFormatLite::WriteBoolNoTagToArray(
     const RepeatedField<  bool>& value, uint8* target) {
   return WritePrimitiveNoTagToArray(value, WriteBoolNoTagToArray, target);
 }
-inline uint8* WireFormatLite::WriteEnumNoTagToArray(
-    const RepeatedField<   int>& value, uint8* target) {
-  return WritePrimitiveNoTagToArray(value, WriteEnumNoTagToArray, target);
-}
 
 inline uint8* WireFormatLite::WriteInt32ToArray(int field_number,
                                                 int32 value,
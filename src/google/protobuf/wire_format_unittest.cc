@@ -1354,6 +1354,11 @@ TEST(RepeatedVarint, SInt32) {
     v.Add((1 << n) - 1);
   }
 
+  // ZigZag encoding of large magnitudes sets the high bit, which must not be
+  // mistaken for sign extension.
+  v.Add(kint32max);
+  v.Add(kint32min);
+
   // Check consistency with the scalar SInt32Size.
   size_t expected = 0;
   for (int i = 0; i < v.size(); i++) {
@@ -1436,6 +1441,133 @@ TEST(RepeatedVarint, Enum) {
   EXPECT_EQ(expected, WireFormatLite::EnumSize(v));
 }
 
+// Checks that the bulk encoder for a packed field writes the same bytes as
+// encoding one value at a time.
+template <typename T>
+void ExpectBulkEncodingMatches(
+    const RepeatedField<T>& values,
+    uint8* (*bulk_writer)(const RepeatedField<T>&, uint8*),
+    uint8* (*writer)(T, uint8*)) {
+  // A varint takes at most 10 bytes.
+  string bulk(values.size() * 10, '\0');
+  string expected(values.size() * 10, '\0');
+  uint8* bulk_start = reinterpret_cast<uint8*>(&bulk[0]);
+  uint8* expected_start = reinterpret_cast<uint8*>(&expected[0]);
+  bulk.resize(bulk_writer(values, bulk_start) - bulk_start);
+  uint8* expected_end = expected_start;
+  for (int i = 0; i < values.size(); i++) {
+    expected_end = writer(values.Get(i), expected_end);
+  }
+  expected.resize(expected_end - expected_start);
+  EXPECT_EQ(expected, bulk);
+}
+
+TEST(RepeatedVarint, WriteNoTagToArray) {
+  RepeatedField<int32> v32;
+  RepeatedField<int64> v64;
+
+  // Runs of small values, which are written a group at a time, broken up by
+  // negative and multi-byte ones, and a length that is not a multiple of any
+  // group size.
+  for (int i = 0; i < 101; i++) {
+    int32 value = i % 23 == 0 ? -i : i % 17 == 0 ? i << 20 : i % 64;
+    v32.Add(value);
+    v64.Add(i % 19 == 0 ? static_cast<int64>(value) << 30 : value);
+  }
+
+  ExpectBulkEncodingMatches<int32>(v32, WireFormatLite::WriteInt32NoTagToArray,
+                                   WireFormatLite::WriteInt32NoTagToArray);
+  ExpectBulkEncodingMatches<int32>(v32, WireFormatLite::WriteSInt32NoTagToArray,
+                                   WireFormatLite::WriteSInt32NoTagToArray);
+  ExpectBulkEncodingMatches<int>(v32, WireFormatLite::WriteEnumNoTagToArray,
+                                 WireFormatLite::WriteEnumNoTagToArray);
+  ExpectBulkEncodingMatches<int64>(v64, WireFormatLite::WriteInt64NoTagToArray,
+                                   WireFormatLite::WriteInt64NoTagToArray);
+  ExpectBulkEncodingMatches<int64>(v64, WireFormatLite::WriteSInt64NoTagToArray,
+                                   WireFormatLite::WriteSInt64NoTagToArray);
+
+  RepeatedField<uint32> u32;
+  RepeatedField<uint64> u64;
+  for (int i = 0; i < v32.size(); i++) {
+    u32.Add(static_cast<uint32>(v32.Get(i)));
+    u64.Add(static_cast<uint64>(v64.Get(i)));
+  }
+  ExpectBulkEncodingMatches<uint32>(u32,
+                                    WireFormatLite::WriteUInt32NoTagToArray,
+                                    WireFormatLite::WriteUInt32NoTagToArray);
+  ExpectBulkEncodingMatches<uint64>(u64,
+                                    WireFormatLite::WriteUInt64NoTagToArray,
+                                    WireFormatLite::WriteUInt64NoTagToArray);
+}
+
+// Encodes |values| as the payload of a packed SInt64 field, preceded by its
+// length.
+string EncodePackedSInt64(const RepeatedField<int64>& values) {
+  string payload;
+  {
+    io::StringOutputStream raw_output(&payload);
+    io::CodedOutputStream output(&raw_output);
+    for (int i = 0; i < values.size(); i++) {
+      WireFormatLite::WriteSInt64NoTag(values.Get(i), &output);
+    }
+  }
+  string data;
+  {
+    io::StringOutputStream raw_output(&data);
+    io::CodedOutputStream output(&raw_output);
+    output.WriteVarint32(payload.size());
+    output.WriteString(payload);
+  }
+  return data;
+}
+
+TEST(RepeatedVarint, ReadPacked) {
+  RepeatedField<int64> v;
+
+  // Insert -2^n, 2^n and 2^n-1, so that every varint length shows up.
+  for (int n = 0; n < 64; n++) {
+    v.Add(-(GOOGLE_LONGLONG(1) << n));
+    v.Add(GOOGLE_LONGLONG(1) << n);
+    v.Add((GOOGLE_LONGLONG(1) << n) - 1);
+  }
+  string data = EncodePackedSInt64(v);
+
+  // Read from a flat array, which decodes the whole field in one pass, and in
+  // small chunks, which takes the one-value-at-a-time path.
+  for (int chunk_size = 1; chunk_size <= data.size(); chunk_size *= 16) {
+    SCOPED_TRACE(chunk_size);
+    io::ArrayInputStream raw_input(data.data(), data.size(), chunk_size);
+    io::CodedInputStream input(&raw_input);
+    RepeatedField<int64> read;
+    read.Add(42);
+    ASSERT_TRUE((WireFormatLite::ReadPackedPrimitive<
+                 int64, WireFormatLite::TYPE_SINT64>(&input, &read)));
+    EXPECT_EQ(data.size(), input.CurrentPosition());
+    ASSERT_EQ(v.size() + 1, read.size());
+    EXPECT_EQ(42, read.Get(0));
+    for (int i = 0; i < v.size(); i++) {
+      EXPECT_EQ(v.Get(i), read.Get(i + 1));
+    }
+  }
+}
+
+TEST(RepeatedVarint, ReadPackedInvalid) {
+  RepeatedField<uint64> read;
+
+  // The last varint runs past the end of the field.
+  const uint8 kTruncated[] = {3, 0x01, 0x80, 0x80, 0x01};
+  io::CodedInputStream truncated(kTruncated, sizeof(kTruncated));
+  EXPECT_FALSE((WireFormatLite::ReadPackedPrimitive<
+                uint64, WireFormatLite::TYPE_UINT64>(&truncated, &read)));
+
+  // A varint longer than 10 bytes.
+  const uint8 kTooLong[] = {11, 0x80, 0x80, 0x80, 0x80, 0x80, 0x80,
+                            0x80, 0x80, 0x80, 0x80, 0x01};
+  io::CodedInputStream too_long(kTooLong, sizeof(kTooLong));
+  EXPECT_FALSE((WireFormatLite::ReadPackedPrimitive<
+                uint64, WireFormatLite::TYPE_UINT64>(&too_long, &read)));
+}
+
 }  // namespace
 }  // namespace internal
 }  // namespace protobuf